@@ -0,0 +1,3903 @@
+; Input corpus for the check-perf 'gvn' benchmark: diamond control flow
+; with fully redundant loads for GVN/PRE to eliminate. Deliberately
+; repetitive.
+
+define i32 @rload0(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload1(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload2(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload3(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload4(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload5(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload6(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload7(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload8(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload9(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload10(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload11(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload12(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload13(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload14(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload15(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload16(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload17(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload18(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload19(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload20(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload21(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload22(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload23(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload24(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload25(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload26(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload27(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload28(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload29(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload30(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload31(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload32(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload33(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload34(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload35(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload36(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload37(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload38(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload39(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload40(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload41(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload42(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload43(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload44(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload45(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload46(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload47(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload48(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload49(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload50(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload51(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload52(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload53(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload54(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload55(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload56(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload57(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload58(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload59(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload60(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload61(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload62(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload63(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload64(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload65(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload66(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload67(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload68(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload69(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload70(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload71(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload72(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload73(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload74(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload75(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload76(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload77(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload78(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload79(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload80(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload81(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload82(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload83(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload84(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload85(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload86(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload87(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload88(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload89(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload90(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload91(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload92(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload93(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload94(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload95(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload96(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload97(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload98(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload99(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload100(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload101(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload102(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload103(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload104(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload105(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload106(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload107(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload108(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload109(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload110(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload111(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload112(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload113(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload114(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload115(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload116(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload117(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload118(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload119(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload120(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload121(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload122(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload123(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload124(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload125(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload126(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload127(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload128(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload129(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload130(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload131(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload132(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload133(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload134(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload135(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload136(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload137(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload138(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload139(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload140(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload141(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload142(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload143(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload144(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload145(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload146(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload147(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload148(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
+
+define i32 @rload149(i32* %p, i32* %q, i1 %c) {
+entry:
+  %v0 = load i32, i32* %p
+  %w0 = load i32, i32* %q
+  br i1 %c, label %t, label %f
+t:
+  %v1 = load i32, i32* %p
+  %w1 = load i32, i32* %q
+  %a0 = add i32 %v1, %w1
+  %a1 = add i32 %a0, %v0
+  br label %m
+f:
+  %v2 = load i32, i32* %p
+  %w2 = load i32, i32* %q
+  %b0 = mul i32 %v2, %w2
+  %b1 = add i32 %b0, %w0
+  br label %m
+m:
+  %phi = phi i32 [ %a1, %t ], [ %b1, %f ]
+  %v3 = load i32, i32* %p
+  %w3 = load i32, i32* %q
+  %s0 = add i32 %phi, %v3
+  %s1 = add i32 %s0, %w3
+  ret i32 %s1
+}
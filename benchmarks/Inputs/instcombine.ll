@@ -0,0 +1,6363 @@
+; Input corpus for the check-perf 'instcombine' benchmark: long chains
+; of constant arithmetic that instcombine folds instruction by
+; instruction. Deliberately repetitive.
+
+define i32 @chain0(i32 %a, i32 %b) {
+  %v1 = add i32 %a, 1
+  %v2 = xor i32 %v1, 256
+  %v3 = and i32 %v2, 65537
+  %v4 = or i32 %v3, 4099
+  %v5 = add i32 %v4, 11
+  %v6 = xor i32 %v5, 38
+  %v7 = add i32 %v6, 12351
+  %v8 = and i32 %v7, 16777222
+  %v9 = add i32 %v8, 9
+  %v10 = xor i32 %v9, 264
+  %v11 = and i32 %v10, 65545
+  %v12 = or i32 %v11, 4107
+  %v13 = add i32 %v12, 19
+  %v14 = xor i32 %v13, 46
+  %v15 = add i32 %v14, 12359
+  %v16 = and i32 %v15, 16777230
+  %v17 = add i32 %v16, 17
+  %v18 = xor i32 %v17, 272
+  %v19 = and i32 %v18, 65553
+  %v20 = or i32 %v19, 4115
+  %v21 = add i32 %v20, 27
+  %v22 = xor i32 %v21, 54
+  %v23 = add i32 %v22, 12367
+  %v24 = and i32 %v23, 16777238
+  %v25 = add i32 %v24, 25
+  %v26 = xor i32 %v25, 280
+  %v27 = and i32 %v26, 65561
+  %v28 = or i32 %v27, 4123
+  %v29 = add i32 %v28, 35
+  %v30 = xor i32 %v29, 62
+  %v31 = add i32 %v30, 12375
+  %v32 = and i32 %v31, 16777246
+  %v33 = add i32 %v32, 33
+  %v34 = xor i32 %v33, 288
+  %v35 = and i32 %v34, 65569
+  %v36 = or i32 %v35, 4131
+  %v37 = add i32 %v36, 43
+  %v38 = xor i32 %v37, 70
+  %v39 = add i32 %v38, 12383
+  %v40 = and i32 %v39, 16777254
+  %v41 = add i32 %v40, 41
+  %v42 = xor i32 %v41, 296
+  %v43 = and i32 %v42, 65577
+  %v44 = or i32 %v43, 4139
+  %v45 = add i32 %v44, 51
+  %v46 = xor i32 %v45, 78
+  %v47 = add i32 %v46, 12391
+  %v48 = and i32 %v47, 16777262
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain1(i32 %a, i32 %b) {
+  %v1 = xor i32 %a, 255
+  %v2 = and i32 %v1, 65536
+  %v3 = or i32 %v2, 4098
+  %v4 = add i32 %v3, 10
+  %v5 = xor i32 %v4, 37
+  %v6 = add i32 %v5, 12350
+  %v7 = and i32 %v6, 16777221
+  %v8 = add i32 %v7, 8
+  %v9 = xor i32 %v8, 263
+  %v10 = and i32 %v9, 65544
+  %v11 = or i32 %v10, 4106
+  %v12 = add i32 %v11, 18
+  %v13 = xor i32 %v12, 45
+  %v14 = add i32 %v13, 12358
+  %v15 = and i32 %v14, 16777229
+  %v16 = add i32 %v15, 16
+  %v17 = xor i32 %v16, 271
+  %v18 = and i32 %v17, 65552
+  %v19 = or i32 %v18, 4114
+  %v20 = add i32 %v19, 26
+  %v21 = xor i32 %v20, 53
+  %v22 = add i32 %v21, 12366
+  %v23 = and i32 %v22, 16777237
+  %v24 = add i32 %v23, 24
+  %v25 = xor i32 %v24, 279
+  %v26 = and i32 %v25, 65560
+  %v27 = or i32 %v26, 4122
+  %v28 = add i32 %v27, 34
+  %v29 = xor i32 %v28, 61
+  %v30 = add i32 %v29, 12374
+  %v31 = and i32 %v30, 16777245
+  %v32 = add i32 %v31, 32
+  %v33 = xor i32 %v32, 287
+  %v34 = and i32 %v33, 65568
+  %v35 = or i32 %v34, 4130
+  %v36 = add i32 %v35, 42
+  %v37 = xor i32 %v36, 69
+  %v38 = add i32 %v37, 12382
+  %v39 = and i32 %v38, 16777253
+  %v40 = add i32 %v39, 40
+  %v41 = xor i32 %v40, 295
+  %v42 = and i32 %v41, 65576
+  %v43 = or i32 %v42, 4138
+  %v44 = add i32 %v43, 50
+  %v45 = xor i32 %v44, 77
+  %v46 = add i32 %v45, 12390
+  %v47 = and i32 %v46, 16777261
+  %v48 = add i32 %v47, 48
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain2(i32 %a, i32 %b) {
+  %v1 = and i32 %a, 65535
+  %v2 = or i32 %v1, 4097
+  %v3 = add i32 %v2, 9
+  %v4 = xor i32 %v3, 36
+  %v5 = add i32 %v4, 12349
+  %v6 = and i32 %v5, 16777220
+  %v7 = add i32 %v6, 7
+  %v8 = xor i32 %v7, 262
+  %v9 = and i32 %v8, 65543
+  %v10 = or i32 %v9, 4105
+  %v11 = add i32 %v10, 17
+  %v12 = xor i32 %v11, 44
+  %v13 = add i32 %v12, 12357
+  %v14 = and i32 %v13, 16777228
+  %v15 = add i32 %v14, 15
+  %v16 = xor i32 %v15, 270
+  %v17 = and i32 %v16, 65551
+  %v18 = or i32 %v17, 4113
+  %v19 = add i32 %v18, 25
+  %v20 = xor i32 %v19, 52
+  %v21 = add i32 %v20, 12365
+  %v22 = and i32 %v21, 16777236
+  %v23 = add i32 %v22, 23
+  %v24 = xor i32 %v23, 278
+  %v25 = and i32 %v24, 65559
+  %v26 = or i32 %v25, 4121
+  %v27 = add i32 %v26, 33
+  %v28 = xor i32 %v27, 60
+  %v29 = add i32 %v28, 12373
+  %v30 = and i32 %v29, 16777244
+  %v31 = add i32 %v30, 31
+  %v32 = xor i32 %v31, 286
+  %v33 = and i32 %v32, 65567
+  %v34 = or i32 %v33, 4129
+  %v35 = add i32 %v34, 41
+  %v36 = xor i32 %v35, 68
+  %v37 = add i32 %v36, 12381
+  %v38 = and i32 %v37, 16777252
+  %v39 = add i32 %v38, 39
+  %v40 = xor i32 %v39, 294
+  %v41 = and i32 %v40, 65575
+  %v42 = or i32 %v41, 4137
+  %v43 = add i32 %v42, 49
+  %v44 = xor i32 %v43, 76
+  %v45 = add i32 %v44, 12389
+  %v46 = and i32 %v45, 16777260
+  %v47 = add i32 %v46, 47
+  %v48 = xor i32 %v47, 302
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain3(i32 %a, i32 %b) {
+  %v1 = or i32 %a, 4096
+  %v2 = add i32 %v1, 8
+  %v3 = xor i32 %v2, 35
+  %v4 = add i32 %v3, 12348
+  %v5 = and i32 %v4, 16777219
+  %v6 = add i32 %v5, 6
+  %v7 = xor i32 %v6, 261
+  %v8 = and i32 %v7, 65542
+  %v9 = or i32 %v8, 4104
+  %v10 = add i32 %v9, 16
+  %v11 = xor i32 %v10, 43
+  %v12 = add i32 %v11, 12356
+  %v13 = and i32 %v12, 16777227
+  %v14 = add i32 %v13, 14
+  %v15 = xor i32 %v14, 269
+  %v16 = and i32 %v15, 65550
+  %v17 = or i32 %v16, 4112
+  %v18 = add i32 %v17, 24
+  %v19 = xor i32 %v18, 51
+  %v20 = add i32 %v19, 12364
+  %v21 = and i32 %v20, 16777235
+  %v22 = add i32 %v21, 22
+  %v23 = xor i32 %v22, 277
+  %v24 = and i32 %v23, 65558
+  %v25 = or i32 %v24, 4120
+  %v26 = add i32 %v25, 32
+  %v27 = xor i32 %v26, 59
+  %v28 = add i32 %v27, 12372
+  %v29 = and i32 %v28, 16777243
+  %v30 = add i32 %v29, 30
+  %v31 = xor i32 %v30, 285
+  %v32 = and i32 %v31, 65566
+  %v33 = or i32 %v32, 4128
+  %v34 = add i32 %v33, 40
+  %v35 = xor i32 %v34, 67
+  %v36 = add i32 %v35, 12380
+  %v37 = and i32 %v36, 16777251
+  %v38 = add i32 %v37, 38
+  %v39 = xor i32 %v38, 293
+  %v40 = and i32 %v39, 65574
+  %v41 = or i32 %v40, 4136
+  %v42 = add i32 %v41, 48
+  %v43 = xor i32 %v42, 75
+  %v44 = add i32 %v43, 12388
+  %v45 = and i32 %v44, 16777259
+  %v46 = add i32 %v45, 46
+  %v47 = xor i32 %v46, 301
+  %v48 = and i32 %v47, 65582
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain4(i32 %a, i32 %b) {
+  %v1 = add i32 %a, 7
+  %v2 = xor i32 %v1, 34
+  %v3 = add i32 %v2, 12347
+  %v4 = and i32 %v3, 16777218
+  %v5 = add i32 %v4, 5
+  %v6 = xor i32 %v5, 260
+  %v7 = and i32 %v6, 65541
+  %v8 = or i32 %v7, 4103
+  %v9 = add i32 %v8, 15
+  %v10 = xor i32 %v9, 42
+  %v11 = add i32 %v10, 12355
+  %v12 = and i32 %v11, 16777226
+  %v13 = add i32 %v12, 13
+  %v14 = xor i32 %v13, 268
+  %v15 = and i32 %v14, 65549
+  %v16 = or i32 %v15, 4111
+  %v17 = add i32 %v16, 23
+  %v18 = xor i32 %v17, 50
+  %v19 = add i32 %v18, 12363
+  %v20 = and i32 %v19, 16777234
+  %v21 = add i32 %v20, 21
+  %v22 = xor i32 %v21, 276
+  %v23 = and i32 %v22, 65557
+  %v24 = or i32 %v23, 4119
+  %v25 = add i32 %v24, 31
+  %v26 = xor i32 %v25, 58
+  %v27 = add i32 %v26, 12371
+  %v28 = and i32 %v27, 16777242
+  %v29 = add i32 %v28, 29
+  %v30 = xor i32 %v29, 284
+  %v31 = and i32 %v30, 65565
+  %v32 = or i32 %v31, 4127
+  %v33 = add i32 %v32, 39
+  %v34 = xor i32 %v33, 66
+  %v35 = add i32 %v34, 12379
+  %v36 = and i32 %v35, 16777250
+  %v37 = add i32 %v36, 37
+  %v38 = xor i32 %v37, 292
+  %v39 = and i32 %v38, 65573
+  %v40 = or i32 %v39, 4135
+  %v41 = add i32 %v40, 47
+  %v42 = xor i32 %v41, 74
+  %v43 = add i32 %v42, 12387
+  %v44 = and i32 %v43, 16777258
+  %v45 = add i32 %v44, 45
+  %v46 = xor i32 %v45, 300
+  %v47 = and i32 %v46, 65581
+  %v48 = or i32 %v47, 4143
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain5(i32 %a, i32 %b) {
+  %v1 = xor i32 %a, 33
+  %v2 = add i32 %v1, 12346
+  %v3 = and i32 %v2, 16777217
+  %v4 = add i32 %v3, 4
+  %v5 = xor i32 %v4, 259
+  %v6 = and i32 %v5, 65540
+  %v7 = or i32 %v6, 4102
+  %v8 = add i32 %v7, 14
+  %v9 = xor i32 %v8, 41
+  %v10 = add i32 %v9, 12354
+  %v11 = and i32 %v10, 16777225
+  %v12 = add i32 %v11, 12
+  %v13 = xor i32 %v12, 267
+  %v14 = and i32 %v13, 65548
+  %v15 = or i32 %v14, 4110
+  %v16 = add i32 %v15, 22
+  %v17 = xor i32 %v16, 49
+  %v18 = add i32 %v17, 12362
+  %v19 = and i32 %v18, 16777233
+  %v20 = add i32 %v19, 20
+  %v21 = xor i32 %v20, 275
+  %v22 = and i32 %v21, 65556
+  %v23 = or i32 %v22, 4118
+  %v24 = add i32 %v23, 30
+  %v25 = xor i32 %v24, 57
+  %v26 = add i32 %v25, 12370
+  %v27 = and i32 %v26, 16777241
+  %v28 = add i32 %v27, 28
+  %v29 = xor i32 %v28, 283
+  %v30 = and i32 %v29, 65564
+  %v31 = or i32 %v30, 4126
+  %v32 = add i32 %v31, 38
+  %v33 = xor i32 %v32, 65
+  %v34 = add i32 %v33, 12378
+  %v35 = and i32 %v34, 16777249
+  %v36 = add i32 %v35, 36
+  %v37 = xor i32 %v36, 291
+  %v38 = and i32 %v37, 65572
+  %v39 = or i32 %v38, 4134
+  %v40 = add i32 %v39, 46
+  %v41 = xor i32 %v40, 73
+  %v42 = add i32 %v41, 12386
+  %v43 = and i32 %v42, 16777257
+  %v44 = add i32 %v43, 44
+  %v45 = xor i32 %v44, 299
+  %v46 = and i32 %v45, 65580
+  %v47 = or i32 %v46, 4142
+  %v48 = add i32 %v47, 54
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain6(i32 %a, i32 %b) {
+  %v1 = add i32 %a, 12345
+  %v2 = and i32 %v1, 16777216
+  %v3 = add i32 %v2, 3
+  %v4 = xor i32 %v3, 258
+  %v5 = and i32 %v4, 65539
+  %v6 = or i32 %v5, 4101
+  %v7 = add i32 %v6, 13
+  %v8 = xor i32 %v7, 40
+  %v9 = add i32 %v8, 12353
+  %v10 = and i32 %v9, 16777224
+  %v11 = add i32 %v10, 11
+  %v12 = xor i32 %v11, 266
+  %v13 = and i32 %v12, 65547
+  %v14 = or i32 %v13, 4109
+  %v15 = add i32 %v14, 21
+  %v16 = xor i32 %v15, 48
+  %v17 = add i32 %v16, 12361
+  %v18 = and i32 %v17, 16777232
+  %v19 = add i32 %v18, 19
+  %v20 = xor i32 %v19, 274
+  %v21 = and i32 %v20, 65555
+  %v22 = or i32 %v21, 4117
+  %v23 = add i32 %v22, 29
+  %v24 = xor i32 %v23, 56
+  %v25 = add i32 %v24, 12369
+  %v26 = and i32 %v25, 16777240
+  %v27 = add i32 %v26, 27
+  %v28 = xor i32 %v27, 282
+  %v29 = and i32 %v28, 65563
+  %v30 = or i32 %v29, 4125
+  %v31 = add i32 %v30, 37
+  %v32 = xor i32 %v31, 64
+  %v33 = add i32 %v32, 12377
+  %v34 = and i32 %v33, 16777248
+  %v35 = add i32 %v34, 35
+  %v36 = xor i32 %v35, 290
+  %v37 = and i32 %v36, 65571
+  %v38 = or i32 %v37, 4133
+  %v39 = add i32 %v38, 45
+  %v40 = xor i32 %v39, 72
+  %v41 = add i32 %v40, 12385
+  %v42 = and i32 %v41, 16777256
+  %v43 = add i32 %v42, 43
+  %v44 = xor i32 %v43, 298
+  %v45 = and i32 %v44, 65579
+  %v46 = or i32 %v45, 4141
+  %v47 = add i32 %v46, 53
+  %v48 = xor i32 %v47, 80
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain7(i32 %a, i32 %b) {
+  %v1 = and i32 %a, 16777215
+  %v2 = add i32 %v1, 2
+  %v3 = xor i32 %v2, 257
+  %v4 = and i32 %v3, 65538
+  %v5 = or i32 %v4, 4100
+  %v6 = add i32 %v5, 12
+  %v7 = xor i32 %v6, 39
+  %v8 = add i32 %v7, 12352
+  %v9 = and i32 %v8, 16777223
+  %v10 = add i32 %v9, 10
+  %v11 = xor i32 %v10, 265
+  %v12 = and i32 %v11, 65546
+  %v13 = or i32 %v12, 4108
+  %v14 = add i32 %v13, 20
+  %v15 = xor i32 %v14, 47
+  %v16 = add i32 %v15, 12360
+  %v17 = and i32 %v16, 16777231
+  %v18 = add i32 %v17, 18
+  %v19 = xor i32 %v18, 273
+  %v20 = and i32 %v19, 65554
+  %v21 = or i32 %v20, 4116
+  %v22 = add i32 %v21, 28
+  %v23 = xor i32 %v22, 55
+  %v24 = add i32 %v23, 12368
+  %v25 = and i32 %v24, 16777239
+  %v26 = add i32 %v25, 26
+  %v27 = xor i32 %v26, 281
+  %v28 = and i32 %v27, 65562
+  %v29 = or i32 %v28, 4124
+  %v30 = add i32 %v29, 36
+  %v31 = xor i32 %v30, 63
+  %v32 = add i32 %v31, 12376
+  %v33 = and i32 %v32, 16777247
+  %v34 = add i32 %v33, 34
+  %v35 = xor i32 %v34, 289
+  %v36 = and i32 %v35, 65570
+  %v37 = or i32 %v36, 4132
+  %v38 = add i32 %v37, 44
+  %v39 = xor i32 %v38, 71
+  %v40 = add i32 %v39, 12384
+  %v41 = and i32 %v40, 16777255
+  %v42 = add i32 %v41, 42
+  %v43 = xor i32 %v42, 297
+  %v44 = and i32 %v43, 65578
+  %v45 = or i32 %v44, 4140
+  %v46 = add i32 %v45, 52
+  %v47 = xor i32 %v46, 79
+  %v48 = add i32 %v47, 12392
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain8(i32 %a, i32 %b) {
+  %v1 = add i32 %a, 1
+  %v2 = xor i32 %v1, 256
+  %v3 = and i32 %v2, 65537
+  %v4 = or i32 %v3, 4099
+  %v5 = add i32 %v4, 11
+  %v6 = xor i32 %v5, 38
+  %v7 = add i32 %v6, 12351
+  %v8 = and i32 %v7, 16777222
+  %v9 = add i32 %v8, 9
+  %v10 = xor i32 %v9, 264
+  %v11 = and i32 %v10, 65545
+  %v12 = or i32 %v11, 4107
+  %v13 = add i32 %v12, 19
+  %v14 = xor i32 %v13, 46
+  %v15 = add i32 %v14, 12359
+  %v16 = and i32 %v15, 16777230
+  %v17 = add i32 %v16, 17
+  %v18 = xor i32 %v17, 272
+  %v19 = and i32 %v18, 65553
+  %v20 = or i32 %v19, 4115
+  %v21 = add i32 %v20, 27
+  %v22 = xor i32 %v21, 54
+  %v23 = add i32 %v22, 12367
+  %v24 = and i32 %v23, 16777238
+  %v25 = add i32 %v24, 25
+  %v26 = xor i32 %v25, 280
+  %v27 = and i32 %v26, 65561
+  %v28 = or i32 %v27, 4123
+  %v29 = add i32 %v28, 35
+  %v30 = xor i32 %v29, 62
+  %v31 = add i32 %v30, 12375
+  %v32 = and i32 %v31, 16777246
+  %v33 = add i32 %v32, 33
+  %v34 = xor i32 %v33, 288
+  %v35 = and i32 %v34, 65569
+  %v36 = or i32 %v35, 4131
+  %v37 = add i32 %v36, 43
+  %v38 = xor i32 %v37, 70
+  %v39 = add i32 %v38, 12383
+  %v40 = and i32 %v39, 16777254
+  %v41 = add i32 %v40, 41
+  %v42 = xor i32 %v41, 296
+  %v43 = and i32 %v42, 65577
+  %v44 = or i32 %v43, 4139
+  %v45 = add i32 %v44, 51
+  %v46 = xor i32 %v45, 78
+  %v47 = add i32 %v46, 12391
+  %v48 = and i32 %v47, 16777262
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain9(i32 %a, i32 %b) {
+  %v1 = xor i32 %a, 255
+  %v2 = and i32 %v1, 65536
+  %v3 = or i32 %v2, 4098
+  %v4 = add i32 %v3, 10
+  %v5 = xor i32 %v4, 37
+  %v6 = add i32 %v5, 12350
+  %v7 = and i32 %v6, 16777221
+  %v8 = add i32 %v7, 8
+  %v9 = xor i32 %v8, 263
+  %v10 = and i32 %v9, 65544
+  %v11 = or i32 %v10, 4106
+  %v12 = add i32 %v11, 18
+  %v13 = xor i32 %v12, 45
+  %v14 = add i32 %v13, 12358
+  %v15 = and i32 %v14, 16777229
+  %v16 = add i32 %v15, 16
+  %v17 = xor i32 %v16, 271
+  %v18 = and i32 %v17, 65552
+  %v19 = or i32 %v18, 4114
+  %v20 = add i32 %v19, 26
+  %v21 = xor i32 %v20, 53
+  %v22 = add i32 %v21, 12366
+  %v23 = and i32 %v22, 16777237
+  %v24 = add i32 %v23, 24
+  %v25 = xor i32 %v24, 279
+  %v26 = and i32 %v25, 65560
+  %v27 = or i32 %v26, 4122
+  %v28 = add i32 %v27, 34
+  %v29 = xor i32 %v28, 61
+  %v30 = add i32 %v29, 12374
+  %v31 = and i32 %v30, 16777245
+  %v32 = add i32 %v31, 32
+  %v33 = xor i32 %v32, 287
+  %v34 = and i32 %v33, 65568
+  %v35 = or i32 %v34, 4130
+  %v36 = add i32 %v35, 42
+  %v37 = xor i32 %v36, 69
+  %v38 = add i32 %v37, 12382
+  %v39 = and i32 %v38, 16777253
+  %v40 = add i32 %v39, 40
+  %v41 = xor i32 %v40, 295
+  %v42 = and i32 %v41, 65576
+  %v43 = or i32 %v42, 4138
+  %v44 = add i32 %v43, 50
+  %v45 = xor i32 %v44, 77
+  %v46 = add i32 %v45, 12390
+  %v47 = and i32 %v46, 16777261
+  %v48 = add i32 %v47, 48
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain10(i32 %a, i32 %b) {
+  %v1 = and i32 %a, 65535
+  %v2 = or i32 %v1, 4097
+  %v3 = add i32 %v2, 9
+  %v4 = xor i32 %v3, 36
+  %v5 = add i32 %v4, 12349
+  %v6 = and i32 %v5, 16777220
+  %v7 = add i32 %v6, 7
+  %v8 = xor i32 %v7, 262
+  %v9 = and i32 %v8, 65543
+  %v10 = or i32 %v9, 4105
+  %v11 = add i32 %v10, 17
+  %v12 = xor i32 %v11, 44
+  %v13 = add i32 %v12, 12357
+  %v14 = and i32 %v13, 16777228
+  %v15 = add i32 %v14, 15
+  %v16 = xor i32 %v15, 270
+  %v17 = and i32 %v16, 65551
+  %v18 = or i32 %v17, 4113
+  %v19 = add i32 %v18, 25
+  %v20 = xor i32 %v19, 52
+  %v21 = add i32 %v20, 12365
+  %v22 = and i32 %v21, 16777236
+  %v23 = add i32 %v22, 23
+  %v24 = xor i32 %v23, 278
+  %v25 = and i32 %v24, 65559
+  %v26 = or i32 %v25, 4121
+  %v27 = add i32 %v26, 33
+  %v28 = xor i32 %v27, 60
+  %v29 = add i32 %v28, 12373
+  %v30 = and i32 %v29, 16777244
+  %v31 = add i32 %v30, 31
+  %v32 = xor i32 %v31, 286
+  %v33 = and i32 %v32, 65567
+  %v34 = or i32 %v33, 4129
+  %v35 = add i32 %v34, 41
+  %v36 = xor i32 %v35, 68
+  %v37 = add i32 %v36, 12381
+  %v38 = and i32 %v37, 16777252
+  %v39 = add i32 %v38, 39
+  %v40 = xor i32 %v39, 294
+  %v41 = and i32 %v40, 65575
+  %v42 = or i32 %v41, 4137
+  %v43 = add i32 %v42, 49
+  %v44 = xor i32 %v43, 76
+  %v45 = add i32 %v44, 12389
+  %v46 = and i32 %v45, 16777260
+  %v47 = add i32 %v46, 47
+  %v48 = xor i32 %v47, 302
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain11(i32 %a, i32 %b) {
+  %v1 = or i32 %a, 4096
+  %v2 = add i32 %v1, 8
+  %v3 = xor i32 %v2, 35
+  %v4 = add i32 %v3, 12348
+  %v5 = and i32 %v4, 16777219
+  %v6 = add i32 %v5, 6
+  %v7 = xor i32 %v6, 261
+  %v8 = and i32 %v7, 65542
+  %v9 = or i32 %v8, 4104
+  %v10 = add i32 %v9, 16
+  %v11 = xor i32 %v10, 43
+  %v12 = add i32 %v11, 12356
+  %v13 = and i32 %v12, 16777227
+  %v14 = add i32 %v13, 14
+  %v15 = xor i32 %v14, 269
+  %v16 = and i32 %v15, 65550
+  %v17 = or i32 %v16, 4112
+  %v18 = add i32 %v17, 24
+  %v19 = xor i32 %v18, 51
+  %v20 = add i32 %v19, 12364
+  %v21 = and i32 %v20, 16777235
+  %v22 = add i32 %v21, 22
+  %v23 = xor i32 %v22, 277
+  %v24 = and i32 %v23, 65558
+  %v25 = or i32 %v24, 4120
+  %v26 = add i32 %v25, 32
+  %v27 = xor i32 %v26, 59
+  %v28 = add i32 %v27, 12372
+  %v29 = and i32 %v28, 16777243
+  %v30 = add i32 %v29, 30
+  %v31 = xor i32 %v30, 285
+  %v32 = and i32 %v31, 65566
+  %v33 = or i32 %v32, 4128
+  %v34 = add i32 %v33, 40
+  %v35 = xor i32 %v34, 67
+  %v36 = add i32 %v35, 12380
+  %v37 = and i32 %v36, 16777251
+  %v38 = add i32 %v37, 38
+  %v39 = xor i32 %v38, 293
+  %v40 = and i32 %v39, 65574
+  %v41 = or i32 %v40, 4136
+  %v42 = add i32 %v41, 48
+  %v43 = xor i32 %v42, 75
+  %v44 = add i32 %v43, 12388
+  %v45 = and i32 %v44, 16777259
+  %v46 = add i32 %v45, 46
+  %v47 = xor i32 %v46, 301
+  %v48 = and i32 %v47, 65582
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain12(i32 %a, i32 %b) {
+  %v1 = add i32 %a, 7
+  %v2 = xor i32 %v1, 34
+  %v3 = add i32 %v2, 12347
+  %v4 = and i32 %v3, 16777218
+  %v5 = add i32 %v4, 5
+  %v6 = xor i32 %v5, 260
+  %v7 = and i32 %v6, 65541
+  %v8 = or i32 %v7, 4103
+  %v9 = add i32 %v8, 15
+  %v10 = xor i32 %v9, 42
+  %v11 = add i32 %v10, 12355
+  %v12 = and i32 %v11, 16777226
+  %v13 = add i32 %v12, 13
+  %v14 = xor i32 %v13, 268
+  %v15 = and i32 %v14, 65549
+  %v16 = or i32 %v15, 4111
+  %v17 = add i32 %v16, 23
+  %v18 = xor i32 %v17, 50
+  %v19 = add i32 %v18, 12363
+  %v20 = and i32 %v19, 16777234
+  %v21 = add i32 %v20, 21
+  %v22 = xor i32 %v21, 276
+  %v23 = and i32 %v22, 65557
+  %v24 = or i32 %v23, 4119
+  %v25 = add i32 %v24, 31
+  %v26 = xor i32 %v25, 58
+  %v27 = add i32 %v26, 12371
+  %v28 = and i32 %v27, 16777242
+  %v29 = add i32 %v28, 29
+  %v30 = xor i32 %v29, 284
+  %v31 = and i32 %v30, 65565
+  %v32 = or i32 %v31, 4127
+  %v33 = add i32 %v32, 39
+  %v34 = xor i32 %v33, 66
+  %v35 = add i32 %v34, 12379
+  %v36 = and i32 %v35, 16777250
+  %v37 = add i32 %v36, 37
+  %v38 = xor i32 %v37, 292
+  %v39 = and i32 %v38, 65573
+  %v40 = or i32 %v39, 4135
+  %v41 = add i32 %v40, 47
+  %v42 = xor i32 %v41, 74
+  %v43 = add i32 %v42, 12387
+  %v44 = and i32 %v43, 16777258
+  %v45 = add i32 %v44, 45
+  %v46 = xor i32 %v45, 300
+  %v47 = and i32 %v46, 65581
+  %v48 = or i32 %v47, 4143
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain13(i32 %a, i32 %b) {
+  %v1 = xor i32 %a, 33
+  %v2 = add i32 %v1, 12346
+  %v3 = and i32 %v2, 16777217
+  %v4 = add i32 %v3, 4
+  %v5 = xor i32 %v4, 259
+  %v6 = and i32 %v5, 65540
+  %v7 = or i32 %v6, 4102
+  %v8 = add i32 %v7, 14
+  %v9 = xor i32 %v8, 41
+  %v10 = add i32 %v9, 12354
+  %v11 = and i32 %v10, 16777225
+  %v12 = add i32 %v11, 12
+  %v13 = xor i32 %v12, 267
+  %v14 = and i32 %v13, 65548
+  %v15 = or i32 %v14, 4110
+  %v16 = add i32 %v15, 22
+  %v17 = xor i32 %v16, 49
+  %v18 = add i32 %v17, 12362
+  %v19 = and i32 %v18, 16777233
+  %v20 = add i32 %v19, 20
+  %v21 = xor i32 %v20, 275
+  %v22 = and i32 %v21, 65556
+  %v23 = or i32 %v22, 4118
+  %v24 = add i32 %v23, 30
+  %v25 = xor i32 %v24, 57
+  %v26 = add i32 %v25, 12370
+  %v27 = and i32 %v26, 16777241
+  %v28 = add i32 %v27, 28
+  %v29 = xor i32 %v28, 283
+  %v30 = and i32 %v29, 65564
+  %v31 = or i32 %v30, 4126
+  %v32 = add i32 %v31, 38
+  %v33 = xor i32 %v32, 65
+  %v34 = add i32 %v33, 12378
+  %v35 = and i32 %v34, 16777249
+  %v36 = add i32 %v35, 36
+  %v37 = xor i32 %v36, 291
+  %v38 = and i32 %v37, 65572
+  %v39 = or i32 %v38, 4134
+  %v40 = add i32 %v39, 46
+  %v41 = xor i32 %v40, 73
+  %v42 = add i32 %v41, 12386
+  %v43 = and i32 %v42, 16777257
+  %v44 = add i32 %v43, 44
+  %v45 = xor i32 %v44, 299
+  %v46 = and i32 %v45, 65580
+  %v47 = or i32 %v46, 4142
+  %v48 = add i32 %v47, 54
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain14(i32 %a, i32 %b) {
+  %v1 = add i32 %a, 12345
+  %v2 = and i32 %v1, 16777216
+  %v3 = add i32 %v2, 3
+  %v4 = xor i32 %v3, 258
+  %v5 = and i32 %v4, 65539
+  %v6 = or i32 %v5, 4101
+  %v7 = add i32 %v6, 13
+  %v8 = xor i32 %v7, 40
+  %v9 = add i32 %v8, 12353
+  %v10 = and i32 %v9, 16777224
+  %v11 = add i32 %v10, 11
+  %v12 = xor i32 %v11, 266
+  %v13 = and i32 %v12, 65547
+  %v14 = or i32 %v13, 4109
+  %v15 = add i32 %v14, 21
+  %v16 = xor i32 %v15, 48
+  %v17 = add i32 %v16, 12361
+  %v18 = and i32 %v17, 16777232
+  %v19 = add i32 %v18, 19
+  %v20 = xor i32 %v19, 274
+  %v21 = and i32 %v20, 65555
+  %v22 = or i32 %v21, 4117
+  %v23 = add i32 %v22, 29
+  %v24 = xor i32 %v23, 56
+  %v25 = add i32 %v24, 12369
+  %v26 = and i32 %v25, 16777240
+  %v27 = add i32 %v26, 27
+  %v28 = xor i32 %v27, 282
+  %v29 = and i32 %v28, 65563
+  %v30 = or i32 %v29, 4125
+  %v31 = add i32 %v30, 37
+  %v32 = xor i32 %v31, 64
+  %v33 = add i32 %v32, 12377
+  %v34 = and i32 %v33, 16777248
+  %v35 = add i32 %v34, 35
+  %v36 = xor i32 %v35, 290
+  %v37 = and i32 %v36, 65571
+  %v38 = or i32 %v37, 4133
+  %v39 = add i32 %v38, 45
+  %v40 = xor i32 %v39, 72
+  %v41 = add i32 %v40, 12385
+  %v42 = and i32 %v41, 16777256
+  %v43 = add i32 %v42, 43
+  %v44 = xor i32 %v43, 298
+  %v45 = and i32 %v44, 65579
+  %v46 = or i32 %v45, 4141
+  %v47 = add i32 %v46, 53
+  %v48 = xor i32 %v47, 80
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain15(i32 %a, i32 %b) {
+  %v1 = and i32 %a, 16777215
+  %v2 = add i32 %v1, 2
+  %v3 = xor i32 %v2, 257
+  %v4 = and i32 %v3, 65538
+  %v5 = or i32 %v4, 4100
+  %v6 = add i32 %v5, 12
+  %v7 = xor i32 %v6, 39
+  %v8 = add i32 %v7, 12352
+  %v9 = and i32 %v8, 16777223
+  %v10 = add i32 %v9, 10
+  %v11 = xor i32 %v10, 265
+  %v12 = and i32 %v11, 65546
+  %v13 = or i32 %v12, 4108
+  %v14 = add i32 %v13, 20
+  %v15 = xor i32 %v14, 47
+  %v16 = add i32 %v15, 12360
+  %v17 = and i32 %v16, 16777231
+  %v18 = add i32 %v17, 18
+  %v19 = xor i32 %v18, 273
+  %v20 = and i32 %v19, 65554
+  %v21 = or i32 %v20, 4116
+  %v22 = add i32 %v21, 28
+  %v23 = xor i32 %v22, 55
+  %v24 = add i32 %v23, 12368
+  %v25 = and i32 %v24, 16777239
+  %v26 = add i32 %v25, 26
+  %v27 = xor i32 %v26, 281
+  %v28 = and i32 %v27, 65562
+  %v29 = or i32 %v28, 4124
+  %v30 = add i32 %v29, 36
+  %v31 = xor i32 %v30, 63
+  %v32 = add i32 %v31, 12376
+  %v33 = and i32 %v32, 16777247
+  %v34 = add i32 %v33, 34
+  %v35 = xor i32 %v34, 289
+  %v36 = and i32 %v35, 65570
+  %v37 = or i32 %v36, 4132
+  %v38 = add i32 %v37, 44
+  %v39 = xor i32 %v38, 71
+  %v40 = add i32 %v39, 12384
+  %v41 = and i32 %v40, 16777255
+  %v42 = add i32 %v41, 42
+  %v43 = xor i32 %v42, 297
+  %v44 = and i32 %v43, 65578
+  %v45 = or i32 %v44, 4140
+  %v46 = add i32 %v45, 52
+  %v47 = xor i32 %v46, 79
+  %v48 = add i32 %v47, 12392
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain16(i32 %a, i32 %b) {
+  %v1 = add i32 %a, 1
+  %v2 = xor i32 %v1, 256
+  %v3 = and i32 %v2, 65537
+  %v4 = or i32 %v3, 4099
+  %v5 = add i32 %v4, 11
+  %v6 = xor i32 %v5, 38
+  %v7 = add i32 %v6, 12351
+  %v8 = and i32 %v7, 16777222
+  %v9 = add i32 %v8, 9
+  %v10 = xor i32 %v9, 264
+  %v11 = and i32 %v10, 65545
+  %v12 = or i32 %v11, 4107
+  %v13 = add i32 %v12, 19
+  %v14 = xor i32 %v13, 46
+  %v15 = add i32 %v14, 12359
+  %v16 = and i32 %v15, 16777230
+  %v17 = add i32 %v16, 17
+  %v18 = xor i32 %v17, 272
+  %v19 = and i32 %v18, 65553
+  %v20 = or i32 %v19, 4115
+  %v21 = add i32 %v20, 27
+  %v22 = xor i32 %v21, 54
+  %v23 = add i32 %v22, 12367
+  %v24 = and i32 %v23, 16777238
+  %v25 = add i32 %v24, 25
+  %v26 = xor i32 %v25, 280
+  %v27 = and i32 %v26, 65561
+  %v28 = or i32 %v27, 4123
+  %v29 = add i32 %v28, 35
+  %v30 = xor i32 %v29, 62
+  %v31 = add i32 %v30, 12375
+  %v32 = and i32 %v31, 16777246
+  %v33 = add i32 %v32, 33
+  %v34 = xor i32 %v33, 288
+  %v35 = and i32 %v34, 65569
+  %v36 = or i32 %v35, 4131
+  %v37 = add i32 %v36, 43
+  %v38 = xor i32 %v37, 70
+  %v39 = add i32 %v38, 12383
+  %v40 = and i32 %v39, 16777254
+  %v41 = add i32 %v40, 41
+  %v42 = xor i32 %v41, 296
+  %v43 = and i32 %v42, 65577
+  %v44 = or i32 %v43, 4139
+  %v45 = add i32 %v44, 51
+  %v46 = xor i32 %v45, 78
+  %v47 = add i32 %v46, 12391
+  %v48 = and i32 %v47, 16777262
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain17(i32 %a, i32 %b) {
+  %v1 = xor i32 %a, 255
+  %v2 = and i32 %v1, 65536
+  %v3 = or i32 %v2, 4098
+  %v4 = add i32 %v3, 10
+  %v5 = xor i32 %v4, 37
+  %v6 = add i32 %v5, 12350
+  %v7 = and i32 %v6, 16777221
+  %v8 = add i32 %v7, 8
+  %v9 = xor i32 %v8, 263
+  %v10 = and i32 %v9, 65544
+  %v11 = or i32 %v10, 4106
+  %v12 = add i32 %v11, 18
+  %v13 = xor i32 %v12, 45
+  %v14 = add i32 %v13, 12358
+  %v15 = and i32 %v14, 16777229
+  %v16 = add i32 %v15, 16
+  %v17 = xor i32 %v16, 271
+  %v18 = and i32 %v17, 65552
+  %v19 = or i32 %v18, 4114
+  %v20 = add i32 %v19, 26
+  %v21 = xor i32 %v20, 53
+  %v22 = add i32 %v21, 12366
+  %v23 = and i32 %v22, 16777237
+  %v24 = add i32 %v23, 24
+  %v25 = xor i32 %v24, 279
+  %v26 = and i32 %v25, 65560
+  %v27 = or i32 %v26, 4122
+  %v28 = add i32 %v27, 34
+  %v29 = xor i32 %v28, 61
+  %v30 = add i32 %v29, 12374
+  %v31 = and i32 %v30, 16777245
+  %v32 = add i32 %v31, 32
+  %v33 = xor i32 %v32, 287
+  %v34 = and i32 %v33, 65568
+  %v35 = or i32 %v34, 4130
+  %v36 = add i32 %v35, 42
+  %v37 = xor i32 %v36, 69
+  %v38 = add i32 %v37, 12382
+  %v39 = and i32 %v38, 16777253
+  %v40 = add i32 %v39, 40
+  %v41 = xor i32 %v40, 295
+  %v42 = and i32 %v41, 65576
+  %v43 = or i32 %v42, 4138
+  %v44 = add i32 %v43, 50
+  %v45 = xor i32 %v44, 77
+  %v46 = add i32 %v45, 12390
+  %v47 = and i32 %v46, 16777261
+  %v48 = add i32 %v47, 48
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain18(i32 %a, i32 %b) {
+  %v1 = and i32 %a, 65535
+  %v2 = or i32 %v1, 4097
+  %v3 = add i32 %v2, 9
+  %v4 = xor i32 %v3, 36
+  %v5 = add i32 %v4, 12349
+  %v6 = and i32 %v5, 16777220
+  %v7 = add i32 %v6, 7
+  %v8 = xor i32 %v7, 262
+  %v9 = and i32 %v8, 65543
+  %v10 = or i32 %v9, 4105
+  %v11 = add i32 %v10, 17
+  %v12 = xor i32 %v11, 44
+  %v13 = add i32 %v12, 12357
+  %v14 = and i32 %v13, 16777228
+  %v15 = add i32 %v14, 15
+  %v16 = xor i32 %v15, 270
+  %v17 = and i32 %v16, 65551
+  %v18 = or i32 %v17, 4113
+  %v19 = add i32 %v18, 25
+  %v20 = xor i32 %v19, 52
+  %v21 = add i32 %v20, 12365
+  %v22 = and i32 %v21, 16777236
+  %v23 = add i32 %v22, 23
+  %v24 = xor i32 %v23, 278
+  %v25 = and i32 %v24, 65559
+  %v26 = or i32 %v25, 4121
+  %v27 = add i32 %v26, 33
+  %v28 = xor i32 %v27, 60
+  %v29 = add i32 %v28, 12373
+  %v30 = and i32 %v29, 16777244
+  %v31 = add i32 %v30, 31
+  %v32 = xor i32 %v31, 286
+  %v33 = and i32 %v32, 65567
+  %v34 = or i32 %v33, 4129
+  %v35 = add i32 %v34, 41
+  %v36 = xor i32 %v35, 68
+  %v37 = add i32 %v36, 12381
+  %v38 = and i32 %v37, 16777252
+  %v39 = add i32 %v38, 39
+  %v40 = xor i32 %v39, 294
+  %v41 = and i32 %v40, 65575
+  %v42 = or i32 %v41, 4137
+  %v43 = add i32 %v42, 49
+  %v44 = xor i32 %v43, 76
+  %v45 = add i32 %v44, 12389
+  %v46 = and i32 %v45, 16777260
+  %v47 = add i32 %v46, 47
+  %v48 = xor i32 %v47, 302
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain19(i32 %a, i32 %b) {
+  %v1 = or i32 %a, 4096
+  %v2 = add i32 %v1, 8
+  %v3 = xor i32 %v2, 35
+  %v4 = add i32 %v3, 12348
+  %v5 = and i32 %v4, 16777219
+  %v6 = add i32 %v5, 6
+  %v7 = xor i32 %v6, 261
+  %v8 = and i32 %v7, 65542
+  %v9 = or i32 %v8, 4104
+  %v10 = add i32 %v9, 16
+  %v11 = xor i32 %v10, 43
+  %v12 = add i32 %v11, 12356
+  %v13 = and i32 %v12, 16777227
+  %v14 = add i32 %v13, 14
+  %v15 = xor i32 %v14, 269
+  %v16 = and i32 %v15, 65550
+  %v17 = or i32 %v16, 4112
+  %v18 = add i32 %v17, 24
+  %v19 = xor i32 %v18, 51
+  %v20 = add i32 %v19, 12364
+  %v21 = and i32 %v20, 16777235
+  %v22 = add i32 %v21, 22
+  %v23 = xor i32 %v22, 277
+  %v24 = and i32 %v23, 65558
+  %v25 = or i32 %v24, 4120
+  %v26 = add i32 %v25, 32
+  %v27 = xor i32 %v26, 59
+  %v28 = add i32 %v27, 12372
+  %v29 = and i32 %v28, 16777243
+  %v30 = add i32 %v29, 30
+  %v31 = xor i32 %v30, 285
+  %v32 = and i32 %v31, 65566
+  %v33 = or i32 %v32, 4128
+  %v34 = add i32 %v33, 40
+  %v35 = xor i32 %v34, 67
+  %v36 = add i32 %v35, 12380
+  %v37 = and i32 %v36, 16777251
+  %v38 = add i32 %v37, 38
+  %v39 = xor i32 %v38, 293
+  %v40 = and i32 %v39, 65574
+  %v41 = or i32 %v40, 4136
+  %v42 = add i32 %v41, 48
+  %v43 = xor i32 %v42, 75
+  %v44 = add i32 %v43, 12388
+  %v45 = and i32 %v44, 16777259
+  %v46 = add i32 %v45, 46
+  %v47 = xor i32 %v46, 301
+  %v48 = and i32 %v47, 65582
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain20(i32 %a, i32 %b) {
+  %v1 = add i32 %a, 7
+  %v2 = xor i32 %v1, 34
+  %v3 = add i32 %v2, 12347
+  %v4 = and i32 %v3, 16777218
+  %v5 = add i32 %v4, 5
+  %v6 = xor i32 %v5, 260
+  %v7 = and i32 %v6, 65541
+  %v8 = or i32 %v7, 4103
+  %v9 = add i32 %v8, 15
+  %v10 = xor i32 %v9, 42
+  %v11 = add i32 %v10, 12355
+  %v12 = and i32 %v11, 16777226
+  %v13 = add i32 %v12, 13
+  %v14 = xor i32 %v13, 268
+  %v15 = and i32 %v14, 65549
+  %v16 = or i32 %v15, 4111
+  %v17 = add i32 %v16, 23
+  %v18 = xor i32 %v17, 50
+  %v19 = add i32 %v18, 12363
+  %v20 = and i32 %v19, 16777234
+  %v21 = add i32 %v20, 21
+  %v22 = xor i32 %v21, 276
+  %v23 = and i32 %v22, 65557
+  %v24 = or i32 %v23, 4119
+  %v25 = add i32 %v24, 31
+  %v26 = xor i32 %v25, 58
+  %v27 = add i32 %v26, 12371
+  %v28 = and i32 %v27, 16777242
+  %v29 = add i32 %v28, 29
+  %v30 = xor i32 %v29, 284
+  %v31 = and i32 %v30, 65565
+  %v32 = or i32 %v31, 4127
+  %v33 = add i32 %v32, 39
+  %v34 = xor i32 %v33, 66
+  %v35 = add i32 %v34, 12379
+  %v36 = and i32 %v35, 16777250
+  %v37 = add i32 %v36, 37
+  %v38 = xor i32 %v37, 292
+  %v39 = and i32 %v38, 65573
+  %v40 = or i32 %v39, 4135
+  %v41 = add i32 %v40, 47
+  %v42 = xor i32 %v41, 74
+  %v43 = add i32 %v42, 12387
+  %v44 = and i32 %v43, 16777258
+  %v45 = add i32 %v44, 45
+  %v46 = xor i32 %v45, 300
+  %v47 = and i32 %v46, 65581
+  %v48 = or i32 %v47, 4143
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain21(i32 %a, i32 %b) {
+  %v1 = xor i32 %a, 33
+  %v2 = add i32 %v1, 12346
+  %v3 = and i32 %v2, 16777217
+  %v4 = add i32 %v3, 4
+  %v5 = xor i32 %v4, 259
+  %v6 = and i32 %v5, 65540
+  %v7 = or i32 %v6, 4102
+  %v8 = add i32 %v7, 14
+  %v9 = xor i32 %v8, 41
+  %v10 = add i32 %v9, 12354
+  %v11 = and i32 %v10, 16777225
+  %v12 = add i32 %v11, 12
+  %v13 = xor i32 %v12, 267
+  %v14 = and i32 %v13, 65548
+  %v15 = or i32 %v14, 4110
+  %v16 = add i32 %v15, 22
+  %v17 = xor i32 %v16, 49
+  %v18 = add i32 %v17, 12362
+  %v19 = and i32 %v18, 16777233
+  %v20 = add i32 %v19, 20
+  %v21 = xor i32 %v20, 275
+  %v22 = and i32 %v21, 65556
+  %v23 = or i32 %v22, 4118
+  %v24 = add i32 %v23, 30
+  %v25 = xor i32 %v24, 57
+  %v26 = add i32 %v25, 12370
+  %v27 = and i32 %v26, 16777241
+  %v28 = add i32 %v27, 28
+  %v29 = xor i32 %v28, 283
+  %v30 = and i32 %v29, 65564
+  %v31 = or i32 %v30, 4126
+  %v32 = add i32 %v31, 38
+  %v33 = xor i32 %v32, 65
+  %v34 = add i32 %v33, 12378
+  %v35 = and i32 %v34, 16777249
+  %v36 = add i32 %v35, 36
+  %v37 = xor i32 %v36, 291
+  %v38 = and i32 %v37, 65572
+  %v39 = or i32 %v38, 4134
+  %v40 = add i32 %v39, 46
+  %v41 = xor i32 %v40, 73
+  %v42 = add i32 %v41, 12386
+  %v43 = and i32 %v42, 16777257
+  %v44 = add i32 %v43, 44
+  %v45 = xor i32 %v44, 299
+  %v46 = and i32 %v45, 65580
+  %v47 = or i32 %v46, 4142
+  %v48 = add i32 %v47, 54
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain22(i32 %a, i32 %b) {
+  %v1 = add i32 %a, 12345
+  %v2 = and i32 %v1, 16777216
+  %v3 = add i32 %v2, 3
+  %v4 = xor i32 %v3, 258
+  %v5 = and i32 %v4, 65539
+  %v6 = or i32 %v5, 4101
+  %v7 = add i32 %v6, 13
+  %v8 = xor i32 %v7, 40
+  %v9 = add i32 %v8, 12353
+  %v10 = and i32 %v9, 16777224
+  %v11 = add i32 %v10, 11
+  %v12 = xor i32 %v11, 266
+  %v13 = and i32 %v12, 65547
+  %v14 = or i32 %v13, 4109
+  %v15 = add i32 %v14, 21
+  %v16 = xor i32 %v15, 48
+  %v17 = add i32 %v16, 12361
+  %v18 = and i32 %v17, 16777232
+  %v19 = add i32 %v18, 19
+  %v20 = xor i32 %v19, 274
+  %v21 = and i32 %v20, 65555
+  %v22 = or i32 %v21, 4117
+  %v23 = add i32 %v22, 29
+  %v24 = xor i32 %v23, 56
+  %v25 = add i32 %v24, 12369
+  %v26 = and i32 %v25, 16777240
+  %v27 = add i32 %v26, 27
+  %v28 = xor i32 %v27, 282
+  %v29 = and i32 %v28, 65563
+  %v30 = or i32 %v29, 4125
+  %v31 = add i32 %v30, 37
+  %v32 = xor i32 %v31, 64
+  %v33 = add i32 %v32, 12377
+  %v34 = and i32 %v33, 16777248
+  %v35 = add i32 %v34, 35
+  %v36 = xor i32 %v35, 290
+  %v37 = and i32 %v36, 65571
+  %v38 = or i32 %v37, 4133
+  %v39 = add i32 %v38, 45
+  %v40 = xor i32 %v39, 72
+  %v41 = add i32 %v40, 12385
+  %v42 = and i32 %v41, 16777256
+  %v43 = add i32 %v42, 43
+  %v44 = xor i32 %v43, 298
+  %v45 = and i32 %v44, 65579
+  %v46 = or i32 %v45, 4141
+  %v47 = add i32 %v46, 53
+  %v48 = xor i32 %v47, 80
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain23(i32 %a, i32 %b) {
+  %v1 = and i32 %a, 16777215
+  %v2 = add i32 %v1, 2
+  %v3 = xor i32 %v2, 257
+  %v4 = and i32 %v3, 65538
+  %v5 = or i32 %v4, 4100
+  %v6 = add i32 %v5, 12
+  %v7 = xor i32 %v6, 39
+  %v8 = add i32 %v7, 12352
+  %v9 = and i32 %v8, 16777223
+  %v10 = add i32 %v9, 10
+  %v11 = xor i32 %v10, 265
+  %v12 = and i32 %v11, 65546
+  %v13 = or i32 %v12, 4108
+  %v14 = add i32 %v13, 20
+  %v15 = xor i32 %v14, 47
+  %v16 = add i32 %v15, 12360
+  %v17 = and i32 %v16, 16777231
+  %v18 = add i32 %v17, 18
+  %v19 = xor i32 %v18, 273
+  %v20 = and i32 %v19, 65554
+  %v21 = or i32 %v20, 4116
+  %v22 = add i32 %v21, 28
+  %v23 = xor i32 %v22, 55
+  %v24 = add i32 %v23, 12368
+  %v25 = and i32 %v24, 16777239
+  %v26 = add i32 %v25, 26
+  %v27 = xor i32 %v26, 281
+  %v28 = and i32 %v27, 65562
+  %v29 = or i32 %v28, 4124
+  %v30 = add i32 %v29, 36
+  %v31 = xor i32 %v30, 63
+  %v32 = add i32 %v31, 12376
+  %v33 = and i32 %v32, 16777247
+  %v34 = add i32 %v33, 34
+  %v35 = xor i32 %v34, 289
+  %v36 = and i32 %v35, 65570
+  %v37 = or i32 %v36, 4132
+  %v38 = add i32 %v37, 44
+  %v39 = xor i32 %v38, 71
+  %v40 = add i32 %v39, 12384
+  %v41 = and i32 %v40, 16777255
+  %v42 = add i32 %v41, 42
+  %v43 = xor i32 %v42, 297
+  %v44 = and i32 %v43, 65578
+  %v45 = or i32 %v44, 4140
+  %v46 = add i32 %v45, 52
+  %v47 = xor i32 %v46, 79
+  %v48 = add i32 %v47, 12392
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain24(i32 %a, i32 %b) {
+  %v1 = add i32 %a, 1
+  %v2 = xor i32 %v1, 256
+  %v3 = and i32 %v2, 65537
+  %v4 = or i32 %v3, 4099
+  %v5 = add i32 %v4, 11
+  %v6 = xor i32 %v5, 38
+  %v7 = add i32 %v6, 12351
+  %v8 = and i32 %v7, 16777222
+  %v9 = add i32 %v8, 9
+  %v10 = xor i32 %v9, 264
+  %v11 = and i32 %v10, 65545
+  %v12 = or i32 %v11, 4107
+  %v13 = add i32 %v12, 19
+  %v14 = xor i32 %v13, 46
+  %v15 = add i32 %v14, 12359
+  %v16 = and i32 %v15, 16777230
+  %v17 = add i32 %v16, 17
+  %v18 = xor i32 %v17, 272
+  %v19 = and i32 %v18, 65553
+  %v20 = or i32 %v19, 4115
+  %v21 = add i32 %v20, 27
+  %v22 = xor i32 %v21, 54
+  %v23 = add i32 %v22, 12367
+  %v24 = and i32 %v23, 16777238
+  %v25 = add i32 %v24, 25
+  %v26 = xor i32 %v25, 280
+  %v27 = and i32 %v26, 65561
+  %v28 = or i32 %v27, 4123
+  %v29 = add i32 %v28, 35
+  %v30 = xor i32 %v29, 62
+  %v31 = add i32 %v30, 12375
+  %v32 = and i32 %v31, 16777246
+  %v33 = add i32 %v32, 33
+  %v34 = xor i32 %v33, 288
+  %v35 = and i32 %v34, 65569
+  %v36 = or i32 %v35, 4131
+  %v37 = add i32 %v36, 43
+  %v38 = xor i32 %v37, 70
+  %v39 = add i32 %v38, 12383
+  %v40 = and i32 %v39, 16777254
+  %v41 = add i32 %v40, 41
+  %v42 = xor i32 %v41, 296
+  %v43 = and i32 %v42, 65577
+  %v44 = or i32 %v43, 4139
+  %v45 = add i32 %v44, 51
+  %v46 = xor i32 %v45, 78
+  %v47 = add i32 %v46, 12391
+  %v48 = and i32 %v47, 16777262
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain25(i32 %a, i32 %b) {
+  %v1 = xor i32 %a, 255
+  %v2 = and i32 %v1, 65536
+  %v3 = or i32 %v2, 4098
+  %v4 = add i32 %v3, 10
+  %v5 = xor i32 %v4, 37
+  %v6 = add i32 %v5, 12350
+  %v7 = and i32 %v6, 16777221
+  %v8 = add i32 %v7, 8
+  %v9 = xor i32 %v8, 263
+  %v10 = and i32 %v9, 65544
+  %v11 = or i32 %v10, 4106
+  %v12 = add i32 %v11, 18
+  %v13 = xor i32 %v12, 45
+  %v14 = add i32 %v13, 12358
+  %v15 = and i32 %v14, 16777229
+  %v16 = add i32 %v15, 16
+  %v17 = xor i32 %v16, 271
+  %v18 = and i32 %v17, 65552
+  %v19 = or i32 %v18, 4114
+  %v20 = add i32 %v19, 26
+  %v21 = xor i32 %v20, 53
+  %v22 = add i32 %v21, 12366
+  %v23 = and i32 %v22, 16777237
+  %v24 = add i32 %v23, 24
+  %v25 = xor i32 %v24, 279
+  %v26 = and i32 %v25, 65560
+  %v27 = or i32 %v26, 4122
+  %v28 = add i32 %v27, 34
+  %v29 = xor i32 %v28, 61
+  %v30 = add i32 %v29, 12374
+  %v31 = and i32 %v30, 16777245
+  %v32 = add i32 %v31, 32
+  %v33 = xor i32 %v32, 287
+  %v34 = and i32 %v33, 65568
+  %v35 = or i32 %v34, 4130
+  %v36 = add i32 %v35, 42
+  %v37 = xor i32 %v36, 69
+  %v38 = add i32 %v37, 12382
+  %v39 = and i32 %v38, 16777253
+  %v40 = add i32 %v39, 40
+  %v41 = xor i32 %v40, 295
+  %v42 = and i32 %v41, 65576
+  %v43 = or i32 %v42, 4138
+  %v44 = add i32 %v43, 50
+  %v45 = xor i32 %v44, 77
+  %v46 = add i32 %v45, 12390
+  %v47 = and i32 %v46, 16777261
+  %v48 = add i32 %v47, 48
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain26(i32 %a, i32 %b) {
+  %v1 = and i32 %a, 65535
+  %v2 = or i32 %v1, 4097
+  %v3 = add i32 %v2, 9
+  %v4 = xor i32 %v3, 36
+  %v5 = add i32 %v4, 12349
+  %v6 = and i32 %v5, 16777220
+  %v7 = add i32 %v6, 7
+  %v8 = xor i32 %v7, 262
+  %v9 = and i32 %v8, 65543
+  %v10 = or i32 %v9, 4105
+  %v11 = add i32 %v10, 17
+  %v12 = xor i32 %v11, 44
+  %v13 = add i32 %v12, 12357
+  %v14 = and i32 %v13, 16777228
+  %v15 = add i32 %v14, 15
+  %v16 = xor i32 %v15, 270
+  %v17 = and i32 %v16, 65551
+  %v18 = or i32 %v17, 4113
+  %v19 = add i32 %v18, 25
+  %v20 = xor i32 %v19, 52
+  %v21 = add i32 %v20, 12365
+  %v22 = and i32 %v21, 16777236
+  %v23 = add i32 %v22, 23
+  %v24 = xor i32 %v23, 278
+  %v25 = and i32 %v24, 65559
+  %v26 = or i32 %v25, 4121
+  %v27 = add i32 %v26, 33
+  %v28 = xor i32 %v27, 60
+  %v29 = add i32 %v28, 12373
+  %v30 = and i32 %v29, 16777244
+  %v31 = add i32 %v30, 31
+  %v32 = xor i32 %v31, 286
+  %v33 = and i32 %v32, 65567
+  %v34 = or i32 %v33, 4129
+  %v35 = add i32 %v34, 41
+  %v36 = xor i32 %v35, 68
+  %v37 = add i32 %v36, 12381
+  %v38 = and i32 %v37, 16777252
+  %v39 = add i32 %v38, 39
+  %v40 = xor i32 %v39, 294
+  %v41 = and i32 %v40, 65575
+  %v42 = or i32 %v41, 4137
+  %v43 = add i32 %v42, 49
+  %v44 = xor i32 %v43, 76
+  %v45 = add i32 %v44, 12389
+  %v46 = and i32 %v45, 16777260
+  %v47 = add i32 %v46, 47
+  %v48 = xor i32 %v47, 302
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain27(i32 %a, i32 %b) {
+  %v1 = or i32 %a, 4096
+  %v2 = add i32 %v1, 8
+  %v3 = xor i32 %v2, 35
+  %v4 = add i32 %v3, 12348
+  %v5 = and i32 %v4, 16777219
+  %v6 = add i32 %v5, 6
+  %v7 = xor i32 %v6, 261
+  %v8 = and i32 %v7, 65542
+  %v9 = or i32 %v8, 4104
+  %v10 = add i32 %v9, 16
+  %v11 = xor i32 %v10, 43
+  %v12 = add i32 %v11, 12356
+  %v13 = and i32 %v12, 16777227
+  %v14 = add i32 %v13, 14
+  %v15 = xor i32 %v14, 269
+  %v16 = and i32 %v15, 65550
+  %v17 = or i32 %v16, 4112
+  %v18 = add i32 %v17, 24
+  %v19 = xor i32 %v18, 51
+  %v20 = add i32 %v19, 12364
+  %v21 = and i32 %v20, 16777235
+  %v22 = add i32 %v21, 22
+  %v23 = xor i32 %v22, 277
+  %v24 = and i32 %v23, 65558
+  %v25 = or i32 %v24, 4120
+  %v26 = add i32 %v25, 32
+  %v27 = xor i32 %v26, 59
+  %v28 = add i32 %v27, 12372
+  %v29 = and i32 %v28, 16777243
+  %v30 = add i32 %v29, 30
+  %v31 = xor i32 %v30, 285
+  %v32 = and i32 %v31, 65566
+  %v33 = or i32 %v32, 4128
+  %v34 = add i32 %v33, 40
+  %v35 = xor i32 %v34, 67
+  %v36 = add i32 %v35, 12380
+  %v37 = and i32 %v36, 16777251
+  %v38 = add i32 %v37, 38
+  %v39 = xor i32 %v38, 293
+  %v40 = and i32 %v39, 65574
+  %v41 = or i32 %v40, 4136
+  %v42 = add i32 %v41, 48
+  %v43 = xor i32 %v42, 75
+  %v44 = add i32 %v43, 12388
+  %v45 = and i32 %v44, 16777259
+  %v46 = add i32 %v45, 46
+  %v47 = xor i32 %v46, 301
+  %v48 = and i32 %v47, 65582
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain28(i32 %a, i32 %b) {
+  %v1 = add i32 %a, 7
+  %v2 = xor i32 %v1, 34
+  %v3 = add i32 %v2, 12347
+  %v4 = and i32 %v3, 16777218
+  %v5 = add i32 %v4, 5
+  %v6 = xor i32 %v5, 260
+  %v7 = and i32 %v6, 65541
+  %v8 = or i32 %v7, 4103
+  %v9 = add i32 %v8, 15
+  %v10 = xor i32 %v9, 42
+  %v11 = add i32 %v10, 12355
+  %v12 = and i32 %v11, 16777226
+  %v13 = add i32 %v12, 13
+  %v14 = xor i32 %v13, 268
+  %v15 = and i32 %v14, 65549
+  %v16 = or i32 %v15, 4111
+  %v17 = add i32 %v16, 23
+  %v18 = xor i32 %v17, 50
+  %v19 = add i32 %v18, 12363
+  %v20 = and i32 %v19, 16777234
+  %v21 = add i32 %v20, 21
+  %v22 = xor i32 %v21, 276
+  %v23 = and i32 %v22, 65557
+  %v24 = or i32 %v23, 4119
+  %v25 = add i32 %v24, 31
+  %v26 = xor i32 %v25, 58
+  %v27 = add i32 %v26, 12371
+  %v28 = and i32 %v27, 16777242
+  %v29 = add i32 %v28, 29
+  %v30 = xor i32 %v29, 284
+  %v31 = and i32 %v30, 65565
+  %v32 = or i32 %v31, 4127
+  %v33 = add i32 %v32, 39
+  %v34 = xor i32 %v33, 66
+  %v35 = add i32 %v34, 12379
+  %v36 = and i32 %v35, 16777250
+  %v37 = add i32 %v36, 37
+  %v38 = xor i32 %v37, 292
+  %v39 = and i32 %v38, 65573
+  %v40 = or i32 %v39, 4135
+  %v41 = add i32 %v40, 47
+  %v42 = xor i32 %v41, 74
+  %v43 = add i32 %v42, 12387
+  %v44 = and i32 %v43, 16777258
+  %v45 = add i32 %v44, 45
+  %v46 = xor i32 %v45, 300
+  %v47 = and i32 %v46, 65581
+  %v48 = or i32 %v47, 4143
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain29(i32 %a, i32 %b) {
+  %v1 = xor i32 %a, 33
+  %v2 = add i32 %v1, 12346
+  %v3 = and i32 %v2, 16777217
+  %v4 = add i32 %v3, 4
+  %v5 = xor i32 %v4, 259
+  %v6 = and i32 %v5, 65540
+  %v7 = or i32 %v6, 4102
+  %v8 = add i32 %v7, 14
+  %v9 = xor i32 %v8, 41
+  %v10 = add i32 %v9, 12354
+  %v11 = and i32 %v10, 16777225
+  %v12 = add i32 %v11, 12
+  %v13 = xor i32 %v12, 267
+  %v14 = and i32 %v13, 65548
+  %v15 = or i32 %v14, 4110
+  %v16 = add i32 %v15, 22
+  %v17 = xor i32 %v16, 49
+  %v18 = add i32 %v17, 12362
+  %v19 = and i32 %v18, 16777233
+  %v20 = add i32 %v19, 20
+  %v21 = xor i32 %v20, 275
+  %v22 = and i32 %v21, 65556
+  %v23 = or i32 %v22, 4118
+  %v24 = add i32 %v23, 30
+  %v25 = xor i32 %v24, 57
+  %v26 = add i32 %v25, 12370
+  %v27 = and i32 %v26, 16777241
+  %v28 = add i32 %v27, 28
+  %v29 = xor i32 %v28, 283
+  %v30 = and i32 %v29, 65564
+  %v31 = or i32 %v30, 4126
+  %v32 = add i32 %v31, 38
+  %v33 = xor i32 %v32, 65
+  %v34 = add i32 %v33, 12378
+  %v35 = and i32 %v34, 16777249
+  %v36 = add i32 %v35, 36
+  %v37 = xor i32 %v36, 291
+  %v38 = and i32 %v37, 65572
+  %v39 = or i32 %v38, 4134
+  %v40 = add i32 %v39, 46
+  %v41 = xor i32 %v40, 73
+  %v42 = add i32 %v41, 12386
+  %v43 = and i32 %v42, 16777257
+  %v44 = add i32 %v43, 44
+  %v45 = xor i32 %v44, 299
+  %v46 = and i32 %v45, 65580
+  %v47 = or i32 %v46, 4142
+  %v48 = add i32 %v47, 54
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain30(i32 %a, i32 %b) {
+  %v1 = add i32 %a, 12345
+  %v2 = and i32 %v1, 16777216
+  %v3 = add i32 %v2, 3
+  %v4 = xor i32 %v3, 258
+  %v5 = and i32 %v4, 65539
+  %v6 = or i32 %v5, 4101
+  %v7 = add i32 %v6, 13
+  %v8 = xor i32 %v7, 40
+  %v9 = add i32 %v8, 12353
+  %v10 = and i32 %v9, 16777224
+  %v11 = add i32 %v10, 11
+  %v12 = xor i32 %v11, 266
+  %v13 = and i32 %v12, 65547
+  %v14 = or i32 %v13, 4109
+  %v15 = add i32 %v14, 21
+  %v16 = xor i32 %v15, 48
+  %v17 = add i32 %v16, 12361
+  %v18 = and i32 %v17, 16777232
+  %v19 = add i32 %v18, 19
+  %v20 = xor i32 %v19, 274
+  %v21 = and i32 %v20, 65555
+  %v22 = or i32 %v21, 4117
+  %v23 = add i32 %v22, 29
+  %v24 = xor i32 %v23, 56
+  %v25 = add i32 %v24, 12369
+  %v26 = and i32 %v25, 16777240
+  %v27 = add i32 %v26, 27
+  %v28 = xor i32 %v27, 282
+  %v29 = and i32 %v28, 65563
+  %v30 = or i32 %v29, 4125
+  %v31 = add i32 %v30, 37
+  %v32 = xor i32 %v31, 64
+  %v33 = add i32 %v32, 12377
+  %v34 = and i32 %v33, 16777248
+  %v35 = add i32 %v34, 35
+  %v36 = xor i32 %v35, 290
+  %v37 = and i32 %v36, 65571
+  %v38 = or i32 %v37, 4133
+  %v39 = add i32 %v38, 45
+  %v40 = xor i32 %v39, 72
+  %v41 = add i32 %v40, 12385
+  %v42 = and i32 %v41, 16777256
+  %v43 = add i32 %v42, 43
+  %v44 = xor i32 %v43, 298
+  %v45 = and i32 %v44, 65579
+  %v46 = or i32 %v45, 4141
+  %v47 = add i32 %v46, 53
+  %v48 = xor i32 %v47, 80
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain31(i32 %a, i32 %b) {
+  %v1 = and i32 %a, 16777215
+  %v2 = add i32 %v1, 2
+  %v3 = xor i32 %v2, 257
+  %v4 = and i32 %v3, 65538
+  %v5 = or i32 %v4, 4100
+  %v6 = add i32 %v5, 12
+  %v7 = xor i32 %v6, 39
+  %v8 = add i32 %v7, 12352
+  %v9 = and i32 %v8, 16777223
+  %v10 = add i32 %v9, 10
+  %v11 = xor i32 %v10, 265
+  %v12 = and i32 %v11, 65546
+  %v13 = or i32 %v12, 4108
+  %v14 = add i32 %v13, 20
+  %v15 = xor i32 %v14, 47
+  %v16 = add i32 %v15, 12360
+  %v17 = and i32 %v16, 16777231
+  %v18 = add i32 %v17, 18
+  %v19 = xor i32 %v18, 273
+  %v20 = and i32 %v19, 65554
+  %v21 = or i32 %v20, 4116
+  %v22 = add i32 %v21, 28
+  %v23 = xor i32 %v22, 55
+  %v24 = add i32 %v23, 12368
+  %v25 = and i32 %v24, 16777239
+  %v26 = add i32 %v25, 26
+  %v27 = xor i32 %v26, 281
+  %v28 = and i32 %v27, 65562
+  %v29 = or i32 %v28, 4124
+  %v30 = add i32 %v29, 36
+  %v31 = xor i32 %v30, 63
+  %v32 = add i32 %v31, 12376
+  %v33 = and i32 %v32, 16777247
+  %v34 = add i32 %v33, 34
+  %v35 = xor i32 %v34, 289
+  %v36 = and i32 %v35, 65570
+  %v37 = or i32 %v36, 4132
+  %v38 = add i32 %v37, 44
+  %v39 = xor i32 %v38, 71
+  %v40 = add i32 %v39, 12384
+  %v41 = and i32 %v40, 16777255
+  %v42 = add i32 %v41, 42
+  %v43 = xor i32 %v42, 297
+  %v44 = and i32 %v43, 65578
+  %v45 = or i32 %v44, 4140
+  %v46 = add i32 %v45, 52
+  %v47 = xor i32 %v46, 79
+  %v48 = add i32 %v47, 12392
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain32(i32 %a, i32 %b) {
+  %v1 = add i32 %a, 1
+  %v2 = xor i32 %v1, 256
+  %v3 = and i32 %v2, 65537
+  %v4 = or i32 %v3, 4099
+  %v5 = add i32 %v4, 11
+  %v6 = xor i32 %v5, 38
+  %v7 = add i32 %v6, 12351
+  %v8 = and i32 %v7, 16777222
+  %v9 = add i32 %v8, 9
+  %v10 = xor i32 %v9, 264
+  %v11 = and i32 %v10, 65545
+  %v12 = or i32 %v11, 4107
+  %v13 = add i32 %v12, 19
+  %v14 = xor i32 %v13, 46
+  %v15 = add i32 %v14, 12359
+  %v16 = and i32 %v15, 16777230
+  %v17 = add i32 %v16, 17
+  %v18 = xor i32 %v17, 272
+  %v19 = and i32 %v18, 65553
+  %v20 = or i32 %v19, 4115
+  %v21 = add i32 %v20, 27
+  %v22 = xor i32 %v21, 54
+  %v23 = add i32 %v22, 12367
+  %v24 = and i32 %v23, 16777238
+  %v25 = add i32 %v24, 25
+  %v26 = xor i32 %v25, 280
+  %v27 = and i32 %v26, 65561
+  %v28 = or i32 %v27, 4123
+  %v29 = add i32 %v28, 35
+  %v30 = xor i32 %v29, 62
+  %v31 = add i32 %v30, 12375
+  %v32 = and i32 %v31, 16777246
+  %v33 = add i32 %v32, 33
+  %v34 = xor i32 %v33, 288
+  %v35 = and i32 %v34, 65569
+  %v36 = or i32 %v35, 4131
+  %v37 = add i32 %v36, 43
+  %v38 = xor i32 %v37, 70
+  %v39 = add i32 %v38, 12383
+  %v40 = and i32 %v39, 16777254
+  %v41 = add i32 %v40, 41
+  %v42 = xor i32 %v41, 296
+  %v43 = and i32 %v42, 65577
+  %v44 = or i32 %v43, 4139
+  %v45 = add i32 %v44, 51
+  %v46 = xor i32 %v45, 78
+  %v47 = add i32 %v46, 12391
+  %v48 = and i32 %v47, 16777262
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain33(i32 %a, i32 %b) {
+  %v1 = xor i32 %a, 255
+  %v2 = and i32 %v1, 65536
+  %v3 = or i32 %v2, 4098
+  %v4 = add i32 %v3, 10
+  %v5 = xor i32 %v4, 37
+  %v6 = add i32 %v5, 12350
+  %v7 = and i32 %v6, 16777221
+  %v8 = add i32 %v7, 8
+  %v9 = xor i32 %v8, 263
+  %v10 = and i32 %v9, 65544
+  %v11 = or i32 %v10, 4106
+  %v12 = add i32 %v11, 18
+  %v13 = xor i32 %v12, 45
+  %v14 = add i32 %v13, 12358
+  %v15 = and i32 %v14, 16777229
+  %v16 = add i32 %v15, 16
+  %v17 = xor i32 %v16, 271
+  %v18 = and i32 %v17, 65552
+  %v19 = or i32 %v18, 4114
+  %v20 = add i32 %v19, 26
+  %v21 = xor i32 %v20, 53
+  %v22 = add i32 %v21, 12366
+  %v23 = and i32 %v22, 16777237
+  %v24 = add i32 %v23, 24
+  %v25 = xor i32 %v24, 279
+  %v26 = and i32 %v25, 65560
+  %v27 = or i32 %v26, 4122
+  %v28 = add i32 %v27, 34
+  %v29 = xor i32 %v28, 61
+  %v30 = add i32 %v29, 12374
+  %v31 = and i32 %v30, 16777245
+  %v32 = add i32 %v31, 32
+  %v33 = xor i32 %v32, 287
+  %v34 = and i32 %v33, 65568
+  %v35 = or i32 %v34, 4130
+  %v36 = add i32 %v35, 42
+  %v37 = xor i32 %v36, 69
+  %v38 = add i32 %v37, 12382
+  %v39 = and i32 %v38, 16777253
+  %v40 = add i32 %v39, 40
+  %v41 = xor i32 %v40, 295
+  %v42 = and i32 %v41, 65576
+  %v43 = or i32 %v42, 4138
+  %v44 = add i32 %v43, 50
+  %v45 = xor i32 %v44, 77
+  %v46 = add i32 %v45, 12390
+  %v47 = and i32 %v46, 16777261
+  %v48 = add i32 %v47, 48
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain34(i32 %a, i32 %b) {
+  %v1 = and i32 %a, 65535
+  %v2 = or i32 %v1, 4097
+  %v3 = add i32 %v2, 9
+  %v4 = xor i32 %v3, 36
+  %v5 = add i32 %v4, 12349
+  %v6 = and i32 %v5, 16777220
+  %v7 = add i32 %v6, 7
+  %v8 = xor i32 %v7, 262
+  %v9 = and i32 %v8, 65543
+  %v10 = or i32 %v9, 4105
+  %v11 = add i32 %v10, 17
+  %v12 = xor i32 %v11, 44
+  %v13 = add i32 %v12, 12357
+  %v14 = and i32 %v13, 16777228
+  %v15 = add i32 %v14, 15
+  %v16 = xor i32 %v15, 270
+  %v17 = and i32 %v16, 65551
+  %v18 = or i32 %v17, 4113
+  %v19 = add i32 %v18, 25
+  %v20 = xor i32 %v19, 52
+  %v21 = add i32 %v20, 12365
+  %v22 = and i32 %v21, 16777236
+  %v23 = add i32 %v22, 23
+  %v24 = xor i32 %v23, 278
+  %v25 = and i32 %v24, 65559
+  %v26 = or i32 %v25, 4121
+  %v27 = add i32 %v26, 33
+  %v28 = xor i32 %v27, 60
+  %v29 = add i32 %v28, 12373
+  %v30 = and i32 %v29, 16777244
+  %v31 = add i32 %v30, 31
+  %v32 = xor i32 %v31, 286
+  %v33 = and i32 %v32, 65567
+  %v34 = or i32 %v33, 4129
+  %v35 = add i32 %v34, 41
+  %v36 = xor i32 %v35, 68
+  %v37 = add i32 %v36, 12381
+  %v38 = and i32 %v37, 16777252
+  %v39 = add i32 %v38, 39
+  %v40 = xor i32 %v39, 294
+  %v41 = and i32 %v40, 65575
+  %v42 = or i32 %v41, 4137
+  %v43 = add i32 %v42, 49
+  %v44 = xor i32 %v43, 76
+  %v45 = add i32 %v44, 12389
+  %v46 = and i32 %v45, 16777260
+  %v47 = add i32 %v46, 47
+  %v48 = xor i32 %v47, 302
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain35(i32 %a, i32 %b) {
+  %v1 = or i32 %a, 4096
+  %v2 = add i32 %v1, 8
+  %v3 = xor i32 %v2, 35
+  %v4 = add i32 %v3, 12348
+  %v5 = and i32 %v4, 16777219
+  %v6 = add i32 %v5, 6
+  %v7 = xor i32 %v6, 261
+  %v8 = and i32 %v7, 65542
+  %v9 = or i32 %v8, 4104
+  %v10 = add i32 %v9, 16
+  %v11 = xor i32 %v10, 43
+  %v12 = add i32 %v11, 12356
+  %v13 = and i32 %v12, 16777227
+  %v14 = add i32 %v13, 14
+  %v15 = xor i32 %v14, 269
+  %v16 = and i32 %v15, 65550
+  %v17 = or i32 %v16, 4112
+  %v18 = add i32 %v17, 24
+  %v19 = xor i32 %v18, 51
+  %v20 = add i32 %v19, 12364
+  %v21 = and i32 %v20, 16777235
+  %v22 = add i32 %v21, 22
+  %v23 = xor i32 %v22, 277
+  %v24 = and i32 %v23, 65558
+  %v25 = or i32 %v24, 4120
+  %v26 = add i32 %v25, 32
+  %v27 = xor i32 %v26, 59
+  %v28 = add i32 %v27, 12372
+  %v29 = and i32 %v28, 16777243
+  %v30 = add i32 %v29, 30
+  %v31 = xor i32 %v30, 285
+  %v32 = and i32 %v31, 65566
+  %v33 = or i32 %v32, 4128
+  %v34 = add i32 %v33, 40
+  %v35 = xor i32 %v34, 67
+  %v36 = add i32 %v35, 12380
+  %v37 = and i32 %v36, 16777251
+  %v38 = add i32 %v37, 38
+  %v39 = xor i32 %v38, 293
+  %v40 = and i32 %v39, 65574
+  %v41 = or i32 %v40, 4136
+  %v42 = add i32 %v41, 48
+  %v43 = xor i32 %v42, 75
+  %v44 = add i32 %v43, 12388
+  %v45 = and i32 %v44, 16777259
+  %v46 = add i32 %v45, 46
+  %v47 = xor i32 %v46, 301
+  %v48 = and i32 %v47, 65582
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain36(i32 %a, i32 %b) {
+  %v1 = add i32 %a, 7
+  %v2 = xor i32 %v1, 34
+  %v3 = add i32 %v2, 12347
+  %v4 = and i32 %v3, 16777218
+  %v5 = add i32 %v4, 5
+  %v6 = xor i32 %v5, 260
+  %v7 = and i32 %v6, 65541
+  %v8 = or i32 %v7, 4103
+  %v9 = add i32 %v8, 15
+  %v10 = xor i32 %v9, 42
+  %v11 = add i32 %v10, 12355
+  %v12 = and i32 %v11, 16777226
+  %v13 = add i32 %v12, 13
+  %v14 = xor i32 %v13, 268
+  %v15 = and i32 %v14, 65549
+  %v16 = or i32 %v15, 4111
+  %v17 = add i32 %v16, 23
+  %v18 = xor i32 %v17, 50
+  %v19 = add i32 %v18, 12363
+  %v20 = and i32 %v19, 16777234
+  %v21 = add i32 %v20, 21
+  %v22 = xor i32 %v21, 276
+  %v23 = and i32 %v22, 65557
+  %v24 = or i32 %v23, 4119
+  %v25 = add i32 %v24, 31
+  %v26 = xor i32 %v25, 58
+  %v27 = add i32 %v26, 12371
+  %v28 = and i32 %v27, 16777242
+  %v29 = add i32 %v28, 29
+  %v30 = xor i32 %v29, 284
+  %v31 = and i32 %v30, 65565
+  %v32 = or i32 %v31, 4127
+  %v33 = add i32 %v32, 39
+  %v34 = xor i32 %v33, 66
+  %v35 = add i32 %v34, 12379
+  %v36 = and i32 %v35, 16777250
+  %v37 = add i32 %v36, 37
+  %v38 = xor i32 %v37, 292
+  %v39 = and i32 %v38, 65573
+  %v40 = or i32 %v39, 4135
+  %v41 = add i32 %v40, 47
+  %v42 = xor i32 %v41, 74
+  %v43 = add i32 %v42, 12387
+  %v44 = and i32 %v43, 16777258
+  %v45 = add i32 %v44, 45
+  %v46 = xor i32 %v45, 300
+  %v47 = and i32 %v46, 65581
+  %v48 = or i32 %v47, 4143
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain37(i32 %a, i32 %b) {
+  %v1 = xor i32 %a, 33
+  %v2 = add i32 %v1, 12346
+  %v3 = and i32 %v2, 16777217
+  %v4 = add i32 %v3, 4
+  %v5 = xor i32 %v4, 259
+  %v6 = and i32 %v5, 65540
+  %v7 = or i32 %v6, 4102
+  %v8 = add i32 %v7, 14
+  %v9 = xor i32 %v8, 41
+  %v10 = add i32 %v9, 12354
+  %v11 = and i32 %v10, 16777225
+  %v12 = add i32 %v11, 12
+  %v13 = xor i32 %v12, 267
+  %v14 = and i32 %v13, 65548
+  %v15 = or i32 %v14, 4110
+  %v16 = add i32 %v15, 22
+  %v17 = xor i32 %v16, 49
+  %v18 = add i32 %v17, 12362
+  %v19 = and i32 %v18, 16777233
+  %v20 = add i32 %v19, 20
+  %v21 = xor i32 %v20, 275
+  %v22 = and i32 %v21, 65556
+  %v23 = or i32 %v22, 4118
+  %v24 = add i32 %v23, 30
+  %v25 = xor i32 %v24, 57
+  %v26 = add i32 %v25, 12370
+  %v27 = and i32 %v26, 16777241
+  %v28 = add i32 %v27, 28
+  %v29 = xor i32 %v28, 283
+  %v30 = and i32 %v29, 65564
+  %v31 = or i32 %v30, 4126
+  %v32 = add i32 %v31, 38
+  %v33 = xor i32 %v32, 65
+  %v34 = add i32 %v33, 12378
+  %v35 = and i32 %v34, 16777249
+  %v36 = add i32 %v35, 36
+  %v37 = xor i32 %v36, 291
+  %v38 = and i32 %v37, 65572
+  %v39 = or i32 %v38, 4134
+  %v40 = add i32 %v39, 46
+  %v41 = xor i32 %v40, 73
+  %v42 = add i32 %v41, 12386
+  %v43 = and i32 %v42, 16777257
+  %v44 = add i32 %v43, 44
+  %v45 = xor i32 %v44, 299
+  %v46 = and i32 %v45, 65580
+  %v47 = or i32 %v46, 4142
+  %v48 = add i32 %v47, 54
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain38(i32 %a, i32 %b) {
+  %v1 = add i32 %a, 12345
+  %v2 = and i32 %v1, 16777216
+  %v3 = add i32 %v2, 3
+  %v4 = xor i32 %v3, 258
+  %v5 = and i32 %v4, 65539
+  %v6 = or i32 %v5, 4101
+  %v7 = add i32 %v6, 13
+  %v8 = xor i32 %v7, 40
+  %v9 = add i32 %v8, 12353
+  %v10 = and i32 %v9, 16777224
+  %v11 = add i32 %v10, 11
+  %v12 = xor i32 %v11, 266
+  %v13 = and i32 %v12, 65547
+  %v14 = or i32 %v13, 4109
+  %v15 = add i32 %v14, 21
+  %v16 = xor i32 %v15, 48
+  %v17 = add i32 %v16, 12361
+  %v18 = and i32 %v17, 16777232
+  %v19 = add i32 %v18, 19
+  %v20 = xor i32 %v19, 274
+  %v21 = and i32 %v20, 65555
+  %v22 = or i32 %v21, 4117
+  %v23 = add i32 %v22, 29
+  %v24 = xor i32 %v23, 56
+  %v25 = add i32 %v24, 12369
+  %v26 = and i32 %v25, 16777240
+  %v27 = add i32 %v26, 27
+  %v28 = xor i32 %v27, 282
+  %v29 = and i32 %v28, 65563
+  %v30 = or i32 %v29, 4125
+  %v31 = add i32 %v30, 37
+  %v32 = xor i32 %v31, 64
+  %v33 = add i32 %v32, 12377
+  %v34 = and i32 %v33, 16777248
+  %v35 = add i32 %v34, 35
+  %v36 = xor i32 %v35, 290
+  %v37 = and i32 %v36, 65571
+  %v38 = or i32 %v37, 4133
+  %v39 = add i32 %v38, 45
+  %v40 = xor i32 %v39, 72
+  %v41 = add i32 %v40, 12385
+  %v42 = and i32 %v41, 16777256
+  %v43 = add i32 %v42, 43
+  %v44 = xor i32 %v43, 298
+  %v45 = and i32 %v44, 65579
+  %v46 = or i32 %v45, 4141
+  %v47 = add i32 %v46, 53
+  %v48 = xor i32 %v47, 80
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain39(i32 %a, i32 %b) {
+  %v1 = and i32 %a, 16777215
+  %v2 = add i32 %v1, 2
+  %v3 = xor i32 %v2, 257
+  %v4 = and i32 %v3, 65538
+  %v5 = or i32 %v4, 4100
+  %v6 = add i32 %v5, 12
+  %v7 = xor i32 %v6, 39
+  %v8 = add i32 %v7, 12352
+  %v9 = and i32 %v8, 16777223
+  %v10 = add i32 %v9, 10
+  %v11 = xor i32 %v10, 265
+  %v12 = and i32 %v11, 65546
+  %v13 = or i32 %v12, 4108
+  %v14 = add i32 %v13, 20
+  %v15 = xor i32 %v14, 47
+  %v16 = add i32 %v15, 12360
+  %v17 = and i32 %v16, 16777231
+  %v18 = add i32 %v17, 18
+  %v19 = xor i32 %v18, 273
+  %v20 = and i32 %v19, 65554
+  %v21 = or i32 %v20, 4116
+  %v22 = add i32 %v21, 28
+  %v23 = xor i32 %v22, 55
+  %v24 = add i32 %v23, 12368
+  %v25 = and i32 %v24, 16777239
+  %v26 = add i32 %v25, 26
+  %v27 = xor i32 %v26, 281
+  %v28 = and i32 %v27, 65562
+  %v29 = or i32 %v28, 4124
+  %v30 = add i32 %v29, 36
+  %v31 = xor i32 %v30, 63
+  %v32 = add i32 %v31, 12376
+  %v33 = and i32 %v32, 16777247
+  %v34 = add i32 %v33, 34
+  %v35 = xor i32 %v34, 289
+  %v36 = and i32 %v35, 65570
+  %v37 = or i32 %v36, 4132
+  %v38 = add i32 %v37, 44
+  %v39 = xor i32 %v38, 71
+  %v40 = add i32 %v39, 12384
+  %v41 = and i32 %v40, 16777255
+  %v42 = add i32 %v41, 42
+  %v43 = xor i32 %v42, 297
+  %v44 = and i32 %v43, 65578
+  %v45 = or i32 %v44, 4140
+  %v46 = add i32 %v45, 52
+  %v47 = xor i32 %v46, 79
+  %v48 = add i32 %v47, 12392
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain40(i32 %a, i32 %b) {
+  %v1 = add i32 %a, 1
+  %v2 = xor i32 %v1, 256
+  %v3 = and i32 %v2, 65537
+  %v4 = or i32 %v3, 4099
+  %v5 = add i32 %v4, 11
+  %v6 = xor i32 %v5, 38
+  %v7 = add i32 %v6, 12351
+  %v8 = and i32 %v7, 16777222
+  %v9 = add i32 %v8, 9
+  %v10 = xor i32 %v9, 264
+  %v11 = and i32 %v10, 65545
+  %v12 = or i32 %v11, 4107
+  %v13 = add i32 %v12, 19
+  %v14 = xor i32 %v13, 46
+  %v15 = add i32 %v14, 12359
+  %v16 = and i32 %v15, 16777230
+  %v17 = add i32 %v16, 17
+  %v18 = xor i32 %v17, 272
+  %v19 = and i32 %v18, 65553
+  %v20 = or i32 %v19, 4115
+  %v21 = add i32 %v20, 27
+  %v22 = xor i32 %v21, 54
+  %v23 = add i32 %v22, 12367
+  %v24 = and i32 %v23, 16777238
+  %v25 = add i32 %v24, 25
+  %v26 = xor i32 %v25, 280
+  %v27 = and i32 %v26, 65561
+  %v28 = or i32 %v27, 4123
+  %v29 = add i32 %v28, 35
+  %v30 = xor i32 %v29, 62
+  %v31 = add i32 %v30, 12375
+  %v32 = and i32 %v31, 16777246
+  %v33 = add i32 %v32, 33
+  %v34 = xor i32 %v33, 288
+  %v35 = and i32 %v34, 65569
+  %v36 = or i32 %v35, 4131
+  %v37 = add i32 %v36, 43
+  %v38 = xor i32 %v37, 70
+  %v39 = add i32 %v38, 12383
+  %v40 = and i32 %v39, 16777254
+  %v41 = add i32 %v40, 41
+  %v42 = xor i32 %v41, 296
+  %v43 = and i32 %v42, 65577
+  %v44 = or i32 %v43, 4139
+  %v45 = add i32 %v44, 51
+  %v46 = xor i32 %v45, 78
+  %v47 = add i32 %v46, 12391
+  %v48 = and i32 %v47, 16777262
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain41(i32 %a, i32 %b) {
+  %v1 = xor i32 %a, 255
+  %v2 = and i32 %v1, 65536
+  %v3 = or i32 %v2, 4098
+  %v4 = add i32 %v3, 10
+  %v5 = xor i32 %v4, 37
+  %v6 = add i32 %v5, 12350
+  %v7 = and i32 %v6, 16777221
+  %v8 = add i32 %v7, 8
+  %v9 = xor i32 %v8, 263
+  %v10 = and i32 %v9, 65544
+  %v11 = or i32 %v10, 4106
+  %v12 = add i32 %v11, 18
+  %v13 = xor i32 %v12, 45
+  %v14 = add i32 %v13, 12358
+  %v15 = and i32 %v14, 16777229
+  %v16 = add i32 %v15, 16
+  %v17 = xor i32 %v16, 271
+  %v18 = and i32 %v17, 65552
+  %v19 = or i32 %v18, 4114
+  %v20 = add i32 %v19, 26
+  %v21 = xor i32 %v20, 53
+  %v22 = add i32 %v21, 12366
+  %v23 = and i32 %v22, 16777237
+  %v24 = add i32 %v23, 24
+  %v25 = xor i32 %v24, 279
+  %v26 = and i32 %v25, 65560
+  %v27 = or i32 %v26, 4122
+  %v28 = add i32 %v27, 34
+  %v29 = xor i32 %v28, 61
+  %v30 = add i32 %v29, 12374
+  %v31 = and i32 %v30, 16777245
+  %v32 = add i32 %v31, 32
+  %v33 = xor i32 %v32, 287
+  %v34 = and i32 %v33, 65568
+  %v35 = or i32 %v34, 4130
+  %v36 = add i32 %v35, 42
+  %v37 = xor i32 %v36, 69
+  %v38 = add i32 %v37, 12382
+  %v39 = and i32 %v38, 16777253
+  %v40 = add i32 %v39, 40
+  %v41 = xor i32 %v40, 295
+  %v42 = and i32 %v41, 65576
+  %v43 = or i32 %v42, 4138
+  %v44 = add i32 %v43, 50
+  %v45 = xor i32 %v44, 77
+  %v46 = add i32 %v45, 12390
+  %v47 = and i32 %v46, 16777261
+  %v48 = add i32 %v47, 48
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain42(i32 %a, i32 %b) {
+  %v1 = and i32 %a, 65535
+  %v2 = or i32 %v1, 4097
+  %v3 = add i32 %v2, 9
+  %v4 = xor i32 %v3, 36
+  %v5 = add i32 %v4, 12349
+  %v6 = and i32 %v5, 16777220
+  %v7 = add i32 %v6, 7
+  %v8 = xor i32 %v7, 262
+  %v9 = and i32 %v8, 65543
+  %v10 = or i32 %v9, 4105
+  %v11 = add i32 %v10, 17
+  %v12 = xor i32 %v11, 44
+  %v13 = add i32 %v12, 12357
+  %v14 = and i32 %v13, 16777228
+  %v15 = add i32 %v14, 15
+  %v16 = xor i32 %v15, 270
+  %v17 = and i32 %v16, 65551
+  %v18 = or i32 %v17, 4113
+  %v19 = add i32 %v18, 25
+  %v20 = xor i32 %v19, 52
+  %v21 = add i32 %v20, 12365
+  %v22 = and i32 %v21, 16777236
+  %v23 = add i32 %v22, 23
+  %v24 = xor i32 %v23, 278
+  %v25 = and i32 %v24, 65559
+  %v26 = or i32 %v25, 4121
+  %v27 = add i32 %v26, 33
+  %v28 = xor i32 %v27, 60
+  %v29 = add i32 %v28, 12373
+  %v30 = and i32 %v29, 16777244
+  %v31 = add i32 %v30, 31
+  %v32 = xor i32 %v31, 286
+  %v33 = and i32 %v32, 65567
+  %v34 = or i32 %v33, 4129
+  %v35 = add i32 %v34, 41
+  %v36 = xor i32 %v35, 68
+  %v37 = add i32 %v36, 12381
+  %v38 = and i32 %v37, 16777252
+  %v39 = add i32 %v38, 39
+  %v40 = xor i32 %v39, 294
+  %v41 = and i32 %v40, 65575
+  %v42 = or i32 %v41, 4137
+  %v43 = add i32 %v42, 49
+  %v44 = xor i32 %v43, 76
+  %v45 = add i32 %v44, 12389
+  %v46 = and i32 %v45, 16777260
+  %v47 = add i32 %v46, 47
+  %v48 = xor i32 %v47, 302
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain43(i32 %a, i32 %b) {
+  %v1 = or i32 %a, 4096
+  %v2 = add i32 %v1, 8
+  %v3 = xor i32 %v2, 35
+  %v4 = add i32 %v3, 12348
+  %v5 = and i32 %v4, 16777219
+  %v6 = add i32 %v5, 6
+  %v7 = xor i32 %v6, 261
+  %v8 = and i32 %v7, 65542
+  %v9 = or i32 %v8, 4104
+  %v10 = add i32 %v9, 16
+  %v11 = xor i32 %v10, 43
+  %v12 = add i32 %v11, 12356
+  %v13 = and i32 %v12, 16777227
+  %v14 = add i32 %v13, 14
+  %v15 = xor i32 %v14, 269
+  %v16 = and i32 %v15, 65550
+  %v17 = or i32 %v16, 4112
+  %v18 = add i32 %v17, 24
+  %v19 = xor i32 %v18, 51
+  %v20 = add i32 %v19, 12364
+  %v21 = and i32 %v20, 16777235
+  %v22 = add i32 %v21, 22
+  %v23 = xor i32 %v22, 277
+  %v24 = and i32 %v23, 65558
+  %v25 = or i32 %v24, 4120
+  %v26 = add i32 %v25, 32
+  %v27 = xor i32 %v26, 59
+  %v28 = add i32 %v27, 12372
+  %v29 = and i32 %v28, 16777243
+  %v30 = add i32 %v29, 30
+  %v31 = xor i32 %v30, 285
+  %v32 = and i32 %v31, 65566
+  %v33 = or i32 %v32, 4128
+  %v34 = add i32 %v33, 40
+  %v35 = xor i32 %v34, 67
+  %v36 = add i32 %v35, 12380
+  %v37 = and i32 %v36, 16777251
+  %v38 = add i32 %v37, 38
+  %v39 = xor i32 %v38, 293
+  %v40 = and i32 %v39, 65574
+  %v41 = or i32 %v40, 4136
+  %v42 = add i32 %v41, 48
+  %v43 = xor i32 %v42, 75
+  %v44 = add i32 %v43, 12388
+  %v45 = and i32 %v44, 16777259
+  %v46 = add i32 %v45, 46
+  %v47 = xor i32 %v46, 301
+  %v48 = and i32 %v47, 65582
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain44(i32 %a, i32 %b) {
+  %v1 = add i32 %a, 7
+  %v2 = xor i32 %v1, 34
+  %v3 = add i32 %v2, 12347
+  %v4 = and i32 %v3, 16777218
+  %v5 = add i32 %v4, 5
+  %v6 = xor i32 %v5, 260
+  %v7 = and i32 %v6, 65541
+  %v8 = or i32 %v7, 4103
+  %v9 = add i32 %v8, 15
+  %v10 = xor i32 %v9, 42
+  %v11 = add i32 %v10, 12355
+  %v12 = and i32 %v11, 16777226
+  %v13 = add i32 %v12, 13
+  %v14 = xor i32 %v13, 268
+  %v15 = and i32 %v14, 65549
+  %v16 = or i32 %v15, 4111
+  %v17 = add i32 %v16, 23
+  %v18 = xor i32 %v17, 50
+  %v19 = add i32 %v18, 12363
+  %v20 = and i32 %v19, 16777234
+  %v21 = add i32 %v20, 21
+  %v22 = xor i32 %v21, 276
+  %v23 = and i32 %v22, 65557
+  %v24 = or i32 %v23, 4119
+  %v25 = add i32 %v24, 31
+  %v26 = xor i32 %v25, 58
+  %v27 = add i32 %v26, 12371
+  %v28 = and i32 %v27, 16777242
+  %v29 = add i32 %v28, 29
+  %v30 = xor i32 %v29, 284
+  %v31 = and i32 %v30, 65565
+  %v32 = or i32 %v31, 4127
+  %v33 = add i32 %v32, 39
+  %v34 = xor i32 %v33, 66
+  %v35 = add i32 %v34, 12379
+  %v36 = and i32 %v35, 16777250
+  %v37 = add i32 %v36, 37
+  %v38 = xor i32 %v37, 292
+  %v39 = and i32 %v38, 65573
+  %v40 = or i32 %v39, 4135
+  %v41 = add i32 %v40, 47
+  %v42 = xor i32 %v41, 74
+  %v43 = add i32 %v42, 12387
+  %v44 = and i32 %v43, 16777258
+  %v45 = add i32 %v44, 45
+  %v46 = xor i32 %v45, 300
+  %v47 = and i32 %v46, 65581
+  %v48 = or i32 %v47, 4143
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain45(i32 %a, i32 %b) {
+  %v1 = xor i32 %a, 33
+  %v2 = add i32 %v1, 12346
+  %v3 = and i32 %v2, 16777217
+  %v4 = add i32 %v3, 4
+  %v5 = xor i32 %v4, 259
+  %v6 = and i32 %v5, 65540
+  %v7 = or i32 %v6, 4102
+  %v8 = add i32 %v7, 14
+  %v9 = xor i32 %v8, 41
+  %v10 = add i32 %v9, 12354
+  %v11 = and i32 %v10, 16777225
+  %v12 = add i32 %v11, 12
+  %v13 = xor i32 %v12, 267
+  %v14 = and i32 %v13, 65548
+  %v15 = or i32 %v14, 4110
+  %v16 = add i32 %v15, 22
+  %v17 = xor i32 %v16, 49
+  %v18 = add i32 %v17, 12362
+  %v19 = and i32 %v18, 16777233
+  %v20 = add i32 %v19, 20
+  %v21 = xor i32 %v20, 275
+  %v22 = and i32 %v21, 65556
+  %v23 = or i32 %v22, 4118
+  %v24 = add i32 %v23, 30
+  %v25 = xor i32 %v24, 57
+  %v26 = add i32 %v25, 12370
+  %v27 = and i32 %v26, 16777241
+  %v28 = add i32 %v27, 28
+  %v29 = xor i32 %v28, 283
+  %v30 = and i32 %v29, 65564
+  %v31 = or i32 %v30, 4126
+  %v32 = add i32 %v31, 38
+  %v33 = xor i32 %v32, 65
+  %v34 = add i32 %v33, 12378
+  %v35 = and i32 %v34, 16777249
+  %v36 = add i32 %v35, 36
+  %v37 = xor i32 %v36, 291
+  %v38 = and i32 %v37, 65572
+  %v39 = or i32 %v38, 4134
+  %v40 = add i32 %v39, 46
+  %v41 = xor i32 %v40, 73
+  %v42 = add i32 %v41, 12386
+  %v43 = and i32 %v42, 16777257
+  %v44 = add i32 %v43, 44
+  %v45 = xor i32 %v44, 299
+  %v46 = and i32 %v45, 65580
+  %v47 = or i32 %v46, 4142
+  %v48 = add i32 %v47, 54
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain46(i32 %a, i32 %b) {
+  %v1 = add i32 %a, 12345
+  %v2 = and i32 %v1, 16777216
+  %v3 = add i32 %v2, 3
+  %v4 = xor i32 %v3, 258
+  %v5 = and i32 %v4, 65539
+  %v6 = or i32 %v5, 4101
+  %v7 = add i32 %v6, 13
+  %v8 = xor i32 %v7, 40
+  %v9 = add i32 %v8, 12353
+  %v10 = and i32 %v9, 16777224
+  %v11 = add i32 %v10, 11
+  %v12 = xor i32 %v11, 266
+  %v13 = and i32 %v12, 65547
+  %v14 = or i32 %v13, 4109
+  %v15 = add i32 %v14, 21
+  %v16 = xor i32 %v15, 48
+  %v17 = add i32 %v16, 12361
+  %v18 = and i32 %v17, 16777232
+  %v19 = add i32 %v18, 19
+  %v20 = xor i32 %v19, 274
+  %v21 = and i32 %v20, 65555
+  %v22 = or i32 %v21, 4117
+  %v23 = add i32 %v22, 29
+  %v24 = xor i32 %v23, 56
+  %v25 = add i32 %v24, 12369
+  %v26 = and i32 %v25, 16777240
+  %v27 = add i32 %v26, 27
+  %v28 = xor i32 %v27, 282
+  %v29 = and i32 %v28, 65563
+  %v30 = or i32 %v29, 4125
+  %v31 = add i32 %v30, 37
+  %v32 = xor i32 %v31, 64
+  %v33 = add i32 %v32, 12377
+  %v34 = and i32 %v33, 16777248
+  %v35 = add i32 %v34, 35
+  %v36 = xor i32 %v35, 290
+  %v37 = and i32 %v36, 65571
+  %v38 = or i32 %v37, 4133
+  %v39 = add i32 %v38, 45
+  %v40 = xor i32 %v39, 72
+  %v41 = add i32 %v40, 12385
+  %v42 = and i32 %v41, 16777256
+  %v43 = add i32 %v42, 43
+  %v44 = xor i32 %v43, 298
+  %v45 = and i32 %v44, 65579
+  %v46 = or i32 %v45, 4141
+  %v47 = add i32 %v46, 53
+  %v48 = xor i32 %v47, 80
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain47(i32 %a, i32 %b) {
+  %v1 = and i32 %a, 16777215
+  %v2 = add i32 %v1, 2
+  %v3 = xor i32 %v2, 257
+  %v4 = and i32 %v3, 65538
+  %v5 = or i32 %v4, 4100
+  %v6 = add i32 %v5, 12
+  %v7 = xor i32 %v6, 39
+  %v8 = add i32 %v7, 12352
+  %v9 = and i32 %v8, 16777223
+  %v10 = add i32 %v9, 10
+  %v11 = xor i32 %v10, 265
+  %v12 = and i32 %v11, 65546
+  %v13 = or i32 %v12, 4108
+  %v14 = add i32 %v13, 20
+  %v15 = xor i32 %v14, 47
+  %v16 = add i32 %v15, 12360
+  %v17 = and i32 %v16, 16777231
+  %v18 = add i32 %v17, 18
+  %v19 = xor i32 %v18, 273
+  %v20 = and i32 %v19, 65554
+  %v21 = or i32 %v20, 4116
+  %v22 = add i32 %v21, 28
+  %v23 = xor i32 %v22, 55
+  %v24 = add i32 %v23, 12368
+  %v25 = and i32 %v24, 16777239
+  %v26 = add i32 %v25, 26
+  %v27 = xor i32 %v26, 281
+  %v28 = and i32 %v27, 65562
+  %v29 = or i32 %v28, 4124
+  %v30 = add i32 %v29, 36
+  %v31 = xor i32 %v30, 63
+  %v32 = add i32 %v31, 12376
+  %v33 = and i32 %v32, 16777247
+  %v34 = add i32 %v33, 34
+  %v35 = xor i32 %v34, 289
+  %v36 = and i32 %v35, 65570
+  %v37 = or i32 %v36, 4132
+  %v38 = add i32 %v37, 44
+  %v39 = xor i32 %v38, 71
+  %v40 = add i32 %v39, 12384
+  %v41 = and i32 %v40, 16777255
+  %v42 = add i32 %v41, 42
+  %v43 = xor i32 %v42, 297
+  %v44 = and i32 %v43, 65578
+  %v45 = or i32 %v44, 4140
+  %v46 = add i32 %v45, 52
+  %v47 = xor i32 %v46, 79
+  %v48 = add i32 %v47, 12392
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain48(i32 %a, i32 %b) {
+  %v1 = add i32 %a, 1
+  %v2 = xor i32 %v1, 256
+  %v3 = and i32 %v2, 65537
+  %v4 = or i32 %v3, 4099
+  %v5 = add i32 %v4, 11
+  %v6 = xor i32 %v5, 38
+  %v7 = add i32 %v6, 12351
+  %v8 = and i32 %v7, 16777222
+  %v9 = add i32 %v8, 9
+  %v10 = xor i32 %v9, 264
+  %v11 = and i32 %v10, 65545
+  %v12 = or i32 %v11, 4107
+  %v13 = add i32 %v12, 19
+  %v14 = xor i32 %v13, 46
+  %v15 = add i32 %v14, 12359
+  %v16 = and i32 %v15, 16777230
+  %v17 = add i32 %v16, 17
+  %v18 = xor i32 %v17, 272
+  %v19 = and i32 %v18, 65553
+  %v20 = or i32 %v19, 4115
+  %v21 = add i32 %v20, 27
+  %v22 = xor i32 %v21, 54
+  %v23 = add i32 %v22, 12367
+  %v24 = and i32 %v23, 16777238
+  %v25 = add i32 %v24, 25
+  %v26 = xor i32 %v25, 280
+  %v27 = and i32 %v26, 65561
+  %v28 = or i32 %v27, 4123
+  %v29 = add i32 %v28, 35
+  %v30 = xor i32 %v29, 62
+  %v31 = add i32 %v30, 12375
+  %v32 = and i32 %v31, 16777246
+  %v33 = add i32 %v32, 33
+  %v34 = xor i32 %v33, 288
+  %v35 = and i32 %v34, 65569
+  %v36 = or i32 %v35, 4131
+  %v37 = add i32 %v36, 43
+  %v38 = xor i32 %v37, 70
+  %v39 = add i32 %v38, 12383
+  %v40 = and i32 %v39, 16777254
+  %v41 = add i32 %v40, 41
+  %v42 = xor i32 %v41, 296
+  %v43 = and i32 %v42, 65577
+  %v44 = or i32 %v43, 4139
+  %v45 = add i32 %v44, 51
+  %v46 = xor i32 %v45, 78
+  %v47 = add i32 %v46, 12391
+  %v48 = and i32 %v47, 16777262
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain49(i32 %a, i32 %b) {
+  %v1 = xor i32 %a, 255
+  %v2 = and i32 %v1, 65536
+  %v3 = or i32 %v2, 4098
+  %v4 = add i32 %v3, 10
+  %v5 = xor i32 %v4, 37
+  %v6 = add i32 %v5, 12350
+  %v7 = and i32 %v6, 16777221
+  %v8 = add i32 %v7, 8
+  %v9 = xor i32 %v8, 263
+  %v10 = and i32 %v9, 65544
+  %v11 = or i32 %v10, 4106
+  %v12 = add i32 %v11, 18
+  %v13 = xor i32 %v12, 45
+  %v14 = add i32 %v13, 12358
+  %v15 = and i32 %v14, 16777229
+  %v16 = add i32 %v15, 16
+  %v17 = xor i32 %v16, 271
+  %v18 = and i32 %v17, 65552
+  %v19 = or i32 %v18, 4114
+  %v20 = add i32 %v19, 26
+  %v21 = xor i32 %v20, 53
+  %v22 = add i32 %v21, 12366
+  %v23 = and i32 %v22, 16777237
+  %v24 = add i32 %v23, 24
+  %v25 = xor i32 %v24, 279
+  %v26 = and i32 %v25, 65560
+  %v27 = or i32 %v26, 4122
+  %v28 = add i32 %v27, 34
+  %v29 = xor i32 %v28, 61
+  %v30 = add i32 %v29, 12374
+  %v31 = and i32 %v30, 16777245
+  %v32 = add i32 %v31, 32
+  %v33 = xor i32 %v32, 287
+  %v34 = and i32 %v33, 65568
+  %v35 = or i32 %v34, 4130
+  %v36 = add i32 %v35, 42
+  %v37 = xor i32 %v36, 69
+  %v38 = add i32 %v37, 12382
+  %v39 = and i32 %v38, 16777253
+  %v40 = add i32 %v39, 40
+  %v41 = xor i32 %v40, 295
+  %v42 = and i32 %v41, 65576
+  %v43 = or i32 %v42, 4138
+  %v44 = add i32 %v43, 50
+  %v45 = xor i32 %v44, 77
+  %v46 = add i32 %v45, 12390
+  %v47 = and i32 %v46, 16777261
+  %v48 = add i32 %v47, 48
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain50(i32 %a, i32 %b) {
+  %v1 = and i32 %a, 65535
+  %v2 = or i32 %v1, 4097
+  %v3 = add i32 %v2, 9
+  %v4 = xor i32 %v3, 36
+  %v5 = add i32 %v4, 12349
+  %v6 = and i32 %v5, 16777220
+  %v7 = add i32 %v6, 7
+  %v8 = xor i32 %v7, 262
+  %v9 = and i32 %v8, 65543
+  %v10 = or i32 %v9, 4105
+  %v11 = add i32 %v10, 17
+  %v12 = xor i32 %v11, 44
+  %v13 = add i32 %v12, 12357
+  %v14 = and i32 %v13, 16777228
+  %v15 = add i32 %v14, 15
+  %v16 = xor i32 %v15, 270
+  %v17 = and i32 %v16, 65551
+  %v18 = or i32 %v17, 4113
+  %v19 = add i32 %v18, 25
+  %v20 = xor i32 %v19, 52
+  %v21 = add i32 %v20, 12365
+  %v22 = and i32 %v21, 16777236
+  %v23 = add i32 %v22, 23
+  %v24 = xor i32 %v23, 278
+  %v25 = and i32 %v24, 65559
+  %v26 = or i32 %v25, 4121
+  %v27 = add i32 %v26, 33
+  %v28 = xor i32 %v27, 60
+  %v29 = add i32 %v28, 12373
+  %v30 = and i32 %v29, 16777244
+  %v31 = add i32 %v30, 31
+  %v32 = xor i32 %v31, 286
+  %v33 = and i32 %v32, 65567
+  %v34 = or i32 %v33, 4129
+  %v35 = add i32 %v34, 41
+  %v36 = xor i32 %v35, 68
+  %v37 = add i32 %v36, 12381
+  %v38 = and i32 %v37, 16777252
+  %v39 = add i32 %v38, 39
+  %v40 = xor i32 %v39, 294
+  %v41 = and i32 %v40, 65575
+  %v42 = or i32 %v41, 4137
+  %v43 = add i32 %v42, 49
+  %v44 = xor i32 %v43, 76
+  %v45 = add i32 %v44, 12389
+  %v46 = and i32 %v45, 16777260
+  %v47 = add i32 %v46, 47
+  %v48 = xor i32 %v47, 302
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain51(i32 %a, i32 %b) {
+  %v1 = or i32 %a, 4096
+  %v2 = add i32 %v1, 8
+  %v3 = xor i32 %v2, 35
+  %v4 = add i32 %v3, 12348
+  %v5 = and i32 %v4, 16777219
+  %v6 = add i32 %v5, 6
+  %v7 = xor i32 %v6, 261
+  %v8 = and i32 %v7, 65542
+  %v9 = or i32 %v8, 4104
+  %v10 = add i32 %v9, 16
+  %v11 = xor i32 %v10, 43
+  %v12 = add i32 %v11, 12356
+  %v13 = and i32 %v12, 16777227
+  %v14 = add i32 %v13, 14
+  %v15 = xor i32 %v14, 269
+  %v16 = and i32 %v15, 65550
+  %v17 = or i32 %v16, 4112
+  %v18 = add i32 %v17, 24
+  %v19 = xor i32 %v18, 51
+  %v20 = add i32 %v19, 12364
+  %v21 = and i32 %v20, 16777235
+  %v22 = add i32 %v21, 22
+  %v23 = xor i32 %v22, 277
+  %v24 = and i32 %v23, 65558
+  %v25 = or i32 %v24, 4120
+  %v26 = add i32 %v25, 32
+  %v27 = xor i32 %v26, 59
+  %v28 = add i32 %v27, 12372
+  %v29 = and i32 %v28, 16777243
+  %v30 = add i32 %v29, 30
+  %v31 = xor i32 %v30, 285
+  %v32 = and i32 %v31, 65566
+  %v33 = or i32 %v32, 4128
+  %v34 = add i32 %v33, 40
+  %v35 = xor i32 %v34, 67
+  %v36 = add i32 %v35, 12380
+  %v37 = and i32 %v36, 16777251
+  %v38 = add i32 %v37, 38
+  %v39 = xor i32 %v38, 293
+  %v40 = and i32 %v39, 65574
+  %v41 = or i32 %v40, 4136
+  %v42 = add i32 %v41, 48
+  %v43 = xor i32 %v42, 75
+  %v44 = add i32 %v43, 12388
+  %v45 = and i32 %v44, 16777259
+  %v46 = add i32 %v45, 46
+  %v47 = xor i32 %v46, 301
+  %v48 = and i32 %v47, 65582
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain52(i32 %a, i32 %b) {
+  %v1 = add i32 %a, 7
+  %v2 = xor i32 %v1, 34
+  %v3 = add i32 %v2, 12347
+  %v4 = and i32 %v3, 16777218
+  %v5 = add i32 %v4, 5
+  %v6 = xor i32 %v5, 260
+  %v7 = and i32 %v6, 65541
+  %v8 = or i32 %v7, 4103
+  %v9 = add i32 %v8, 15
+  %v10 = xor i32 %v9, 42
+  %v11 = add i32 %v10, 12355
+  %v12 = and i32 %v11, 16777226
+  %v13 = add i32 %v12, 13
+  %v14 = xor i32 %v13, 268
+  %v15 = and i32 %v14, 65549
+  %v16 = or i32 %v15, 4111
+  %v17 = add i32 %v16, 23
+  %v18 = xor i32 %v17, 50
+  %v19 = add i32 %v18, 12363
+  %v20 = and i32 %v19, 16777234
+  %v21 = add i32 %v20, 21
+  %v22 = xor i32 %v21, 276
+  %v23 = and i32 %v22, 65557
+  %v24 = or i32 %v23, 4119
+  %v25 = add i32 %v24, 31
+  %v26 = xor i32 %v25, 58
+  %v27 = add i32 %v26, 12371
+  %v28 = and i32 %v27, 16777242
+  %v29 = add i32 %v28, 29
+  %v30 = xor i32 %v29, 284
+  %v31 = and i32 %v30, 65565
+  %v32 = or i32 %v31, 4127
+  %v33 = add i32 %v32, 39
+  %v34 = xor i32 %v33, 66
+  %v35 = add i32 %v34, 12379
+  %v36 = and i32 %v35, 16777250
+  %v37 = add i32 %v36, 37
+  %v38 = xor i32 %v37, 292
+  %v39 = and i32 %v38, 65573
+  %v40 = or i32 %v39, 4135
+  %v41 = add i32 %v40, 47
+  %v42 = xor i32 %v41, 74
+  %v43 = add i32 %v42, 12387
+  %v44 = and i32 %v43, 16777258
+  %v45 = add i32 %v44, 45
+  %v46 = xor i32 %v45, 300
+  %v47 = and i32 %v46, 65581
+  %v48 = or i32 %v47, 4143
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain53(i32 %a, i32 %b) {
+  %v1 = xor i32 %a, 33
+  %v2 = add i32 %v1, 12346
+  %v3 = and i32 %v2, 16777217
+  %v4 = add i32 %v3, 4
+  %v5 = xor i32 %v4, 259
+  %v6 = and i32 %v5, 65540
+  %v7 = or i32 %v6, 4102
+  %v8 = add i32 %v7, 14
+  %v9 = xor i32 %v8, 41
+  %v10 = add i32 %v9, 12354
+  %v11 = and i32 %v10, 16777225
+  %v12 = add i32 %v11, 12
+  %v13 = xor i32 %v12, 267
+  %v14 = and i32 %v13, 65548
+  %v15 = or i32 %v14, 4110
+  %v16 = add i32 %v15, 22
+  %v17 = xor i32 %v16, 49
+  %v18 = add i32 %v17, 12362
+  %v19 = and i32 %v18, 16777233
+  %v20 = add i32 %v19, 20
+  %v21 = xor i32 %v20, 275
+  %v22 = and i32 %v21, 65556
+  %v23 = or i32 %v22, 4118
+  %v24 = add i32 %v23, 30
+  %v25 = xor i32 %v24, 57
+  %v26 = add i32 %v25, 12370
+  %v27 = and i32 %v26, 16777241
+  %v28 = add i32 %v27, 28
+  %v29 = xor i32 %v28, 283
+  %v30 = and i32 %v29, 65564
+  %v31 = or i32 %v30, 4126
+  %v32 = add i32 %v31, 38
+  %v33 = xor i32 %v32, 65
+  %v34 = add i32 %v33, 12378
+  %v35 = and i32 %v34, 16777249
+  %v36 = add i32 %v35, 36
+  %v37 = xor i32 %v36, 291
+  %v38 = and i32 %v37, 65572
+  %v39 = or i32 %v38, 4134
+  %v40 = add i32 %v39, 46
+  %v41 = xor i32 %v40, 73
+  %v42 = add i32 %v41, 12386
+  %v43 = and i32 %v42, 16777257
+  %v44 = add i32 %v43, 44
+  %v45 = xor i32 %v44, 299
+  %v46 = and i32 %v45, 65580
+  %v47 = or i32 %v46, 4142
+  %v48 = add i32 %v47, 54
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain54(i32 %a, i32 %b) {
+  %v1 = add i32 %a, 12345
+  %v2 = and i32 %v1, 16777216
+  %v3 = add i32 %v2, 3
+  %v4 = xor i32 %v3, 258
+  %v5 = and i32 %v4, 65539
+  %v6 = or i32 %v5, 4101
+  %v7 = add i32 %v6, 13
+  %v8 = xor i32 %v7, 40
+  %v9 = add i32 %v8, 12353
+  %v10 = and i32 %v9, 16777224
+  %v11 = add i32 %v10, 11
+  %v12 = xor i32 %v11, 266
+  %v13 = and i32 %v12, 65547
+  %v14 = or i32 %v13, 4109
+  %v15 = add i32 %v14, 21
+  %v16 = xor i32 %v15, 48
+  %v17 = add i32 %v16, 12361
+  %v18 = and i32 %v17, 16777232
+  %v19 = add i32 %v18, 19
+  %v20 = xor i32 %v19, 274
+  %v21 = and i32 %v20, 65555
+  %v22 = or i32 %v21, 4117
+  %v23 = add i32 %v22, 29
+  %v24 = xor i32 %v23, 56
+  %v25 = add i32 %v24, 12369
+  %v26 = and i32 %v25, 16777240
+  %v27 = add i32 %v26, 27
+  %v28 = xor i32 %v27, 282
+  %v29 = and i32 %v28, 65563
+  %v30 = or i32 %v29, 4125
+  %v31 = add i32 %v30, 37
+  %v32 = xor i32 %v31, 64
+  %v33 = add i32 %v32, 12377
+  %v34 = and i32 %v33, 16777248
+  %v35 = add i32 %v34, 35
+  %v36 = xor i32 %v35, 290
+  %v37 = and i32 %v36, 65571
+  %v38 = or i32 %v37, 4133
+  %v39 = add i32 %v38, 45
+  %v40 = xor i32 %v39, 72
+  %v41 = add i32 %v40, 12385
+  %v42 = and i32 %v41, 16777256
+  %v43 = add i32 %v42, 43
+  %v44 = xor i32 %v43, 298
+  %v45 = and i32 %v44, 65579
+  %v46 = or i32 %v45, 4141
+  %v47 = add i32 %v46, 53
+  %v48 = xor i32 %v47, 80
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain55(i32 %a, i32 %b) {
+  %v1 = and i32 %a, 16777215
+  %v2 = add i32 %v1, 2
+  %v3 = xor i32 %v2, 257
+  %v4 = and i32 %v3, 65538
+  %v5 = or i32 %v4, 4100
+  %v6 = add i32 %v5, 12
+  %v7 = xor i32 %v6, 39
+  %v8 = add i32 %v7, 12352
+  %v9 = and i32 %v8, 16777223
+  %v10 = add i32 %v9, 10
+  %v11 = xor i32 %v10, 265
+  %v12 = and i32 %v11, 65546
+  %v13 = or i32 %v12, 4108
+  %v14 = add i32 %v13, 20
+  %v15 = xor i32 %v14, 47
+  %v16 = add i32 %v15, 12360
+  %v17 = and i32 %v16, 16777231
+  %v18 = add i32 %v17, 18
+  %v19 = xor i32 %v18, 273
+  %v20 = and i32 %v19, 65554
+  %v21 = or i32 %v20, 4116
+  %v22 = add i32 %v21, 28
+  %v23 = xor i32 %v22, 55
+  %v24 = add i32 %v23, 12368
+  %v25 = and i32 %v24, 16777239
+  %v26 = add i32 %v25, 26
+  %v27 = xor i32 %v26, 281
+  %v28 = and i32 %v27, 65562
+  %v29 = or i32 %v28, 4124
+  %v30 = add i32 %v29, 36
+  %v31 = xor i32 %v30, 63
+  %v32 = add i32 %v31, 12376
+  %v33 = and i32 %v32, 16777247
+  %v34 = add i32 %v33, 34
+  %v35 = xor i32 %v34, 289
+  %v36 = and i32 %v35, 65570
+  %v37 = or i32 %v36, 4132
+  %v38 = add i32 %v37, 44
+  %v39 = xor i32 %v38, 71
+  %v40 = add i32 %v39, 12384
+  %v41 = and i32 %v40, 16777255
+  %v42 = add i32 %v41, 42
+  %v43 = xor i32 %v42, 297
+  %v44 = and i32 %v43, 65578
+  %v45 = or i32 %v44, 4140
+  %v46 = add i32 %v45, 52
+  %v47 = xor i32 %v46, 79
+  %v48 = add i32 %v47, 12392
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain56(i32 %a, i32 %b) {
+  %v1 = add i32 %a, 1
+  %v2 = xor i32 %v1, 256
+  %v3 = and i32 %v2, 65537
+  %v4 = or i32 %v3, 4099
+  %v5 = add i32 %v4, 11
+  %v6 = xor i32 %v5, 38
+  %v7 = add i32 %v6, 12351
+  %v8 = and i32 %v7, 16777222
+  %v9 = add i32 %v8, 9
+  %v10 = xor i32 %v9, 264
+  %v11 = and i32 %v10, 65545
+  %v12 = or i32 %v11, 4107
+  %v13 = add i32 %v12, 19
+  %v14 = xor i32 %v13, 46
+  %v15 = add i32 %v14, 12359
+  %v16 = and i32 %v15, 16777230
+  %v17 = add i32 %v16, 17
+  %v18 = xor i32 %v17, 272
+  %v19 = and i32 %v18, 65553
+  %v20 = or i32 %v19, 4115
+  %v21 = add i32 %v20, 27
+  %v22 = xor i32 %v21, 54
+  %v23 = add i32 %v22, 12367
+  %v24 = and i32 %v23, 16777238
+  %v25 = add i32 %v24, 25
+  %v26 = xor i32 %v25, 280
+  %v27 = and i32 %v26, 65561
+  %v28 = or i32 %v27, 4123
+  %v29 = add i32 %v28, 35
+  %v30 = xor i32 %v29, 62
+  %v31 = add i32 %v30, 12375
+  %v32 = and i32 %v31, 16777246
+  %v33 = add i32 %v32, 33
+  %v34 = xor i32 %v33, 288
+  %v35 = and i32 %v34, 65569
+  %v36 = or i32 %v35, 4131
+  %v37 = add i32 %v36, 43
+  %v38 = xor i32 %v37, 70
+  %v39 = add i32 %v38, 12383
+  %v40 = and i32 %v39, 16777254
+  %v41 = add i32 %v40, 41
+  %v42 = xor i32 %v41, 296
+  %v43 = and i32 %v42, 65577
+  %v44 = or i32 %v43, 4139
+  %v45 = add i32 %v44, 51
+  %v46 = xor i32 %v45, 78
+  %v47 = add i32 %v46, 12391
+  %v48 = and i32 %v47, 16777262
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain57(i32 %a, i32 %b) {
+  %v1 = xor i32 %a, 255
+  %v2 = and i32 %v1, 65536
+  %v3 = or i32 %v2, 4098
+  %v4 = add i32 %v3, 10
+  %v5 = xor i32 %v4, 37
+  %v6 = add i32 %v5, 12350
+  %v7 = and i32 %v6, 16777221
+  %v8 = add i32 %v7, 8
+  %v9 = xor i32 %v8, 263
+  %v10 = and i32 %v9, 65544
+  %v11 = or i32 %v10, 4106
+  %v12 = add i32 %v11, 18
+  %v13 = xor i32 %v12, 45
+  %v14 = add i32 %v13, 12358
+  %v15 = and i32 %v14, 16777229
+  %v16 = add i32 %v15, 16
+  %v17 = xor i32 %v16, 271
+  %v18 = and i32 %v17, 65552
+  %v19 = or i32 %v18, 4114
+  %v20 = add i32 %v19, 26
+  %v21 = xor i32 %v20, 53
+  %v22 = add i32 %v21, 12366
+  %v23 = and i32 %v22, 16777237
+  %v24 = add i32 %v23, 24
+  %v25 = xor i32 %v24, 279
+  %v26 = and i32 %v25, 65560
+  %v27 = or i32 %v26, 4122
+  %v28 = add i32 %v27, 34
+  %v29 = xor i32 %v28, 61
+  %v30 = add i32 %v29, 12374
+  %v31 = and i32 %v30, 16777245
+  %v32 = add i32 %v31, 32
+  %v33 = xor i32 %v32, 287
+  %v34 = and i32 %v33, 65568
+  %v35 = or i32 %v34, 4130
+  %v36 = add i32 %v35, 42
+  %v37 = xor i32 %v36, 69
+  %v38 = add i32 %v37, 12382
+  %v39 = and i32 %v38, 16777253
+  %v40 = add i32 %v39, 40
+  %v41 = xor i32 %v40, 295
+  %v42 = and i32 %v41, 65576
+  %v43 = or i32 %v42, 4138
+  %v44 = add i32 %v43, 50
+  %v45 = xor i32 %v44, 77
+  %v46 = add i32 %v45, 12390
+  %v47 = and i32 %v46, 16777261
+  %v48 = add i32 %v47, 48
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain58(i32 %a, i32 %b) {
+  %v1 = and i32 %a, 65535
+  %v2 = or i32 %v1, 4097
+  %v3 = add i32 %v2, 9
+  %v4 = xor i32 %v3, 36
+  %v5 = add i32 %v4, 12349
+  %v6 = and i32 %v5, 16777220
+  %v7 = add i32 %v6, 7
+  %v8 = xor i32 %v7, 262
+  %v9 = and i32 %v8, 65543
+  %v10 = or i32 %v9, 4105
+  %v11 = add i32 %v10, 17
+  %v12 = xor i32 %v11, 44
+  %v13 = add i32 %v12, 12357
+  %v14 = and i32 %v13, 16777228
+  %v15 = add i32 %v14, 15
+  %v16 = xor i32 %v15, 270
+  %v17 = and i32 %v16, 65551
+  %v18 = or i32 %v17, 4113
+  %v19 = add i32 %v18, 25
+  %v20 = xor i32 %v19, 52
+  %v21 = add i32 %v20, 12365
+  %v22 = and i32 %v21, 16777236
+  %v23 = add i32 %v22, 23
+  %v24 = xor i32 %v23, 278
+  %v25 = and i32 %v24, 65559
+  %v26 = or i32 %v25, 4121
+  %v27 = add i32 %v26, 33
+  %v28 = xor i32 %v27, 60
+  %v29 = add i32 %v28, 12373
+  %v30 = and i32 %v29, 16777244
+  %v31 = add i32 %v30, 31
+  %v32 = xor i32 %v31, 286
+  %v33 = and i32 %v32, 65567
+  %v34 = or i32 %v33, 4129
+  %v35 = add i32 %v34, 41
+  %v36 = xor i32 %v35, 68
+  %v37 = add i32 %v36, 12381
+  %v38 = and i32 %v37, 16777252
+  %v39 = add i32 %v38, 39
+  %v40 = xor i32 %v39, 294
+  %v41 = and i32 %v40, 65575
+  %v42 = or i32 %v41, 4137
+  %v43 = add i32 %v42, 49
+  %v44 = xor i32 %v43, 76
+  %v45 = add i32 %v44, 12389
+  %v46 = and i32 %v45, 16777260
+  %v47 = add i32 %v46, 47
+  %v48 = xor i32 %v47, 302
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain59(i32 %a, i32 %b) {
+  %v1 = or i32 %a, 4096
+  %v2 = add i32 %v1, 8
+  %v3 = xor i32 %v2, 35
+  %v4 = add i32 %v3, 12348
+  %v5 = and i32 %v4, 16777219
+  %v6 = add i32 %v5, 6
+  %v7 = xor i32 %v6, 261
+  %v8 = and i32 %v7, 65542
+  %v9 = or i32 %v8, 4104
+  %v10 = add i32 %v9, 16
+  %v11 = xor i32 %v10, 43
+  %v12 = add i32 %v11, 12356
+  %v13 = and i32 %v12, 16777227
+  %v14 = add i32 %v13, 14
+  %v15 = xor i32 %v14, 269
+  %v16 = and i32 %v15, 65550
+  %v17 = or i32 %v16, 4112
+  %v18 = add i32 %v17, 24
+  %v19 = xor i32 %v18, 51
+  %v20 = add i32 %v19, 12364
+  %v21 = and i32 %v20, 16777235
+  %v22 = add i32 %v21, 22
+  %v23 = xor i32 %v22, 277
+  %v24 = and i32 %v23, 65558
+  %v25 = or i32 %v24, 4120
+  %v26 = add i32 %v25, 32
+  %v27 = xor i32 %v26, 59
+  %v28 = add i32 %v27, 12372
+  %v29 = and i32 %v28, 16777243
+  %v30 = add i32 %v29, 30
+  %v31 = xor i32 %v30, 285
+  %v32 = and i32 %v31, 65566
+  %v33 = or i32 %v32, 4128
+  %v34 = add i32 %v33, 40
+  %v35 = xor i32 %v34, 67
+  %v36 = add i32 %v35, 12380
+  %v37 = and i32 %v36, 16777251
+  %v38 = add i32 %v37, 38
+  %v39 = xor i32 %v38, 293
+  %v40 = and i32 %v39, 65574
+  %v41 = or i32 %v40, 4136
+  %v42 = add i32 %v41, 48
+  %v43 = xor i32 %v42, 75
+  %v44 = add i32 %v43, 12388
+  %v45 = and i32 %v44, 16777259
+  %v46 = add i32 %v45, 46
+  %v47 = xor i32 %v46, 301
+  %v48 = and i32 %v47, 65582
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain60(i32 %a, i32 %b) {
+  %v1 = add i32 %a, 7
+  %v2 = xor i32 %v1, 34
+  %v3 = add i32 %v2, 12347
+  %v4 = and i32 %v3, 16777218
+  %v5 = add i32 %v4, 5
+  %v6 = xor i32 %v5, 260
+  %v7 = and i32 %v6, 65541
+  %v8 = or i32 %v7, 4103
+  %v9 = add i32 %v8, 15
+  %v10 = xor i32 %v9, 42
+  %v11 = add i32 %v10, 12355
+  %v12 = and i32 %v11, 16777226
+  %v13 = add i32 %v12, 13
+  %v14 = xor i32 %v13, 268
+  %v15 = and i32 %v14, 65549
+  %v16 = or i32 %v15, 4111
+  %v17 = add i32 %v16, 23
+  %v18 = xor i32 %v17, 50
+  %v19 = add i32 %v18, 12363
+  %v20 = and i32 %v19, 16777234
+  %v21 = add i32 %v20, 21
+  %v22 = xor i32 %v21, 276
+  %v23 = and i32 %v22, 65557
+  %v24 = or i32 %v23, 4119
+  %v25 = add i32 %v24, 31
+  %v26 = xor i32 %v25, 58
+  %v27 = add i32 %v26, 12371
+  %v28 = and i32 %v27, 16777242
+  %v29 = add i32 %v28, 29
+  %v30 = xor i32 %v29, 284
+  %v31 = and i32 %v30, 65565
+  %v32 = or i32 %v31, 4127
+  %v33 = add i32 %v32, 39
+  %v34 = xor i32 %v33, 66
+  %v35 = add i32 %v34, 12379
+  %v36 = and i32 %v35, 16777250
+  %v37 = add i32 %v36, 37
+  %v38 = xor i32 %v37, 292
+  %v39 = and i32 %v38, 65573
+  %v40 = or i32 %v39, 4135
+  %v41 = add i32 %v40, 47
+  %v42 = xor i32 %v41, 74
+  %v43 = add i32 %v42, 12387
+  %v44 = and i32 %v43, 16777258
+  %v45 = add i32 %v44, 45
+  %v46 = xor i32 %v45, 300
+  %v47 = and i32 %v46, 65581
+  %v48 = or i32 %v47, 4143
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain61(i32 %a, i32 %b) {
+  %v1 = xor i32 %a, 33
+  %v2 = add i32 %v1, 12346
+  %v3 = and i32 %v2, 16777217
+  %v4 = add i32 %v3, 4
+  %v5 = xor i32 %v4, 259
+  %v6 = and i32 %v5, 65540
+  %v7 = or i32 %v6, 4102
+  %v8 = add i32 %v7, 14
+  %v9 = xor i32 %v8, 41
+  %v10 = add i32 %v9, 12354
+  %v11 = and i32 %v10, 16777225
+  %v12 = add i32 %v11, 12
+  %v13 = xor i32 %v12, 267
+  %v14 = and i32 %v13, 65548
+  %v15 = or i32 %v14, 4110
+  %v16 = add i32 %v15, 22
+  %v17 = xor i32 %v16, 49
+  %v18 = add i32 %v17, 12362
+  %v19 = and i32 %v18, 16777233
+  %v20 = add i32 %v19, 20
+  %v21 = xor i32 %v20, 275
+  %v22 = and i32 %v21, 65556
+  %v23 = or i32 %v22, 4118
+  %v24 = add i32 %v23, 30
+  %v25 = xor i32 %v24, 57
+  %v26 = add i32 %v25, 12370
+  %v27 = and i32 %v26, 16777241
+  %v28 = add i32 %v27, 28
+  %v29 = xor i32 %v28, 283
+  %v30 = and i32 %v29, 65564
+  %v31 = or i32 %v30, 4126
+  %v32 = add i32 %v31, 38
+  %v33 = xor i32 %v32, 65
+  %v34 = add i32 %v33, 12378
+  %v35 = and i32 %v34, 16777249
+  %v36 = add i32 %v35, 36
+  %v37 = xor i32 %v36, 291
+  %v38 = and i32 %v37, 65572
+  %v39 = or i32 %v38, 4134
+  %v40 = add i32 %v39, 46
+  %v41 = xor i32 %v40, 73
+  %v42 = add i32 %v41, 12386
+  %v43 = and i32 %v42, 16777257
+  %v44 = add i32 %v43, 44
+  %v45 = xor i32 %v44, 299
+  %v46 = and i32 %v45, 65580
+  %v47 = or i32 %v46, 4142
+  %v48 = add i32 %v47, 54
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain62(i32 %a, i32 %b) {
+  %v1 = add i32 %a, 12345
+  %v2 = and i32 %v1, 16777216
+  %v3 = add i32 %v2, 3
+  %v4 = xor i32 %v3, 258
+  %v5 = and i32 %v4, 65539
+  %v6 = or i32 %v5, 4101
+  %v7 = add i32 %v6, 13
+  %v8 = xor i32 %v7, 40
+  %v9 = add i32 %v8, 12353
+  %v10 = and i32 %v9, 16777224
+  %v11 = add i32 %v10, 11
+  %v12 = xor i32 %v11, 266
+  %v13 = and i32 %v12, 65547
+  %v14 = or i32 %v13, 4109
+  %v15 = add i32 %v14, 21
+  %v16 = xor i32 %v15, 48
+  %v17 = add i32 %v16, 12361
+  %v18 = and i32 %v17, 16777232
+  %v19 = add i32 %v18, 19
+  %v20 = xor i32 %v19, 274
+  %v21 = and i32 %v20, 65555
+  %v22 = or i32 %v21, 4117
+  %v23 = add i32 %v22, 29
+  %v24 = xor i32 %v23, 56
+  %v25 = add i32 %v24, 12369
+  %v26 = and i32 %v25, 16777240
+  %v27 = add i32 %v26, 27
+  %v28 = xor i32 %v27, 282
+  %v29 = and i32 %v28, 65563
+  %v30 = or i32 %v29, 4125
+  %v31 = add i32 %v30, 37
+  %v32 = xor i32 %v31, 64
+  %v33 = add i32 %v32, 12377
+  %v34 = and i32 %v33, 16777248
+  %v35 = add i32 %v34, 35
+  %v36 = xor i32 %v35, 290
+  %v37 = and i32 %v36, 65571
+  %v38 = or i32 %v37, 4133
+  %v39 = add i32 %v38, 45
+  %v40 = xor i32 %v39, 72
+  %v41 = add i32 %v40, 12385
+  %v42 = and i32 %v41, 16777256
+  %v43 = add i32 %v42, 43
+  %v44 = xor i32 %v43, 298
+  %v45 = and i32 %v44, 65579
+  %v46 = or i32 %v45, 4141
+  %v47 = add i32 %v46, 53
+  %v48 = xor i32 %v47, 80
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain63(i32 %a, i32 %b) {
+  %v1 = and i32 %a, 16777215
+  %v2 = add i32 %v1, 2
+  %v3 = xor i32 %v2, 257
+  %v4 = and i32 %v3, 65538
+  %v5 = or i32 %v4, 4100
+  %v6 = add i32 %v5, 12
+  %v7 = xor i32 %v6, 39
+  %v8 = add i32 %v7, 12352
+  %v9 = and i32 %v8, 16777223
+  %v10 = add i32 %v9, 10
+  %v11 = xor i32 %v10, 265
+  %v12 = and i32 %v11, 65546
+  %v13 = or i32 %v12, 4108
+  %v14 = add i32 %v13, 20
+  %v15 = xor i32 %v14, 47
+  %v16 = add i32 %v15, 12360
+  %v17 = and i32 %v16, 16777231
+  %v18 = add i32 %v17, 18
+  %v19 = xor i32 %v18, 273
+  %v20 = and i32 %v19, 65554
+  %v21 = or i32 %v20, 4116
+  %v22 = add i32 %v21, 28
+  %v23 = xor i32 %v22, 55
+  %v24 = add i32 %v23, 12368
+  %v25 = and i32 %v24, 16777239
+  %v26 = add i32 %v25, 26
+  %v27 = xor i32 %v26, 281
+  %v28 = and i32 %v27, 65562
+  %v29 = or i32 %v28, 4124
+  %v30 = add i32 %v29, 36
+  %v31 = xor i32 %v30, 63
+  %v32 = add i32 %v31, 12376
+  %v33 = and i32 %v32, 16777247
+  %v34 = add i32 %v33, 34
+  %v35 = xor i32 %v34, 289
+  %v36 = and i32 %v35, 65570
+  %v37 = or i32 %v36, 4132
+  %v38 = add i32 %v37, 44
+  %v39 = xor i32 %v38, 71
+  %v40 = add i32 %v39, 12384
+  %v41 = and i32 %v40, 16777255
+  %v42 = add i32 %v41, 42
+  %v43 = xor i32 %v42, 297
+  %v44 = and i32 %v43, 65578
+  %v45 = or i32 %v44, 4140
+  %v46 = add i32 %v45, 52
+  %v47 = xor i32 %v46, 79
+  %v48 = add i32 %v47, 12392
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain64(i32 %a, i32 %b) {
+  %v1 = add i32 %a, 1
+  %v2 = xor i32 %v1, 256
+  %v3 = and i32 %v2, 65537
+  %v4 = or i32 %v3, 4099
+  %v5 = add i32 %v4, 11
+  %v6 = xor i32 %v5, 38
+  %v7 = add i32 %v6, 12351
+  %v8 = and i32 %v7, 16777222
+  %v9 = add i32 %v8, 9
+  %v10 = xor i32 %v9, 264
+  %v11 = and i32 %v10, 65545
+  %v12 = or i32 %v11, 4107
+  %v13 = add i32 %v12, 19
+  %v14 = xor i32 %v13, 46
+  %v15 = add i32 %v14, 12359
+  %v16 = and i32 %v15, 16777230
+  %v17 = add i32 %v16, 17
+  %v18 = xor i32 %v17, 272
+  %v19 = and i32 %v18, 65553
+  %v20 = or i32 %v19, 4115
+  %v21 = add i32 %v20, 27
+  %v22 = xor i32 %v21, 54
+  %v23 = add i32 %v22, 12367
+  %v24 = and i32 %v23, 16777238
+  %v25 = add i32 %v24, 25
+  %v26 = xor i32 %v25, 280
+  %v27 = and i32 %v26, 65561
+  %v28 = or i32 %v27, 4123
+  %v29 = add i32 %v28, 35
+  %v30 = xor i32 %v29, 62
+  %v31 = add i32 %v30, 12375
+  %v32 = and i32 %v31, 16777246
+  %v33 = add i32 %v32, 33
+  %v34 = xor i32 %v33, 288
+  %v35 = and i32 %v34, 65569
+  %v36 = or i32 %v35, 4131
+  %v37 = add i32 %v36, 43
+  %v38 = xor i32 %v37, 70
+  %v39 = add i32 %v38, 12383
+  %v40 = and i32 %v39, 16777254
+  %v41 = add i32 %v40, 41
+  %v42 = xor i32 %v41, 296
+  %v43 = and i32 %v42, 65577
+  %v44 = or i32 %v43, 4139
+  %v45 = add i32 %v44, 51
+  %v46 = xor i32 %v45, 78
+  %v47 = add i32 %v46, 12391
+  %v48 = and i32 %v47, 16777262
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain65(i32 %a, i32 %b) {
+  %v1 = xor i32 %a, 255
+  %v2 = and i32 %v1, 65536
+  %v3 = or i32 %v2, 4098
+  %v4 = add i32 %v3, 10
+  %v5 = xor i32 %v4, 37
+  %v6 = add i32 %v5, 12350
+  %v7 = and i32 %v6, 16777221
+  %v8 = add i32 %v7, 8
+  %v9 = xor i32 %v8, 263
+  %v10 = and i32 %v9, 65544
+  %v11 = or i32 %v10, 4106
+  %v12 = add i32 %v11, 18
+  %v13 = xor i32 %v12, 45
+  %v14 = add i32 %v13, 12358
+  %v15 = and i32 %v14, 16777229
+  %v16 = add i32 %v15, 16
+  %v17 = xor i32 %v16, 271
+  %v18 = and i32 %v17, 65552
+  %v19 = or i32 %v18, 4114
+  %v20 = add i32 %v19, 26
+  %v21 = xor i32 %v20, 53
+  %v22 = add i32 %v21, 12366
+  %v23 = and i32 %v22, 16777237
+  %v24 = add i32 %v23, 24
+  %v25 = xor i32 %v24, 279
+  %v26 = and i32 %v25, 65560
+  %v27 = or i32 %v26, 4122
+  %v28 = add i32 %v27, 34
+  %v29 = xor i32 %v28, 61
+  %v30 = add i32 %v29, 12374
+  %v31 = and i32 %v30, 16777245
+  %v32 = add i32 %v31, 32
+  %v33 = xor i32 %v32, 287
+  %v34 = and i32 %v33, 65568
+  %v35 = or i32 %v34, 4130
+  %v36 = add i32 %v35, 42
+  %v37 = xor i32 %v36, 69
+  %v38 = add i32 %v37, 12382
+  %v39 = and i32 %v38, 16777253
+  %v40 = add i32 %v39, 40
+  %v41 = xor i32 %v40, 295
+  %v42 = and i32 %v41, 65576
+  %v43 = or i32 %v42, 4138
+  %v44 = add i32 %v43, 50
+  %v45 = xor i32 %v44, 77
+  %v46 = add i32 %v45, 12390
+  %v47 = and i32 %v46, 16777261
+  %v48 = add i32 %v47, 48
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain66(i32 %a, i32 %b) {
+  %v1 = and i32 %a, 65535
+  %v2 = or i32 %v1, 4097
+  %v3 = add i32 %v2, 9
+  %v4 = xor i32 %v3, 36
+  %v5 = add i32 %v4, 12349
+  %v6 = and i32 %v5, 16777220
+  %v7 = add i32 %v6, 7
+  %v8 = xor i32 %v7, 262
+  %v9 = and i32 %v8, 65543
+  %v10 = or i32 %v9, 4105
+  %v11 = add i32 %v10, 17
+  %v12 = xor i32 %v11, 44
+  %v13 = add i32 %v12, 12357
+  %v14 = and i32 %v13, 16777228
+  %v15 = add i32 %v14, 15
+  %v16 = xor i32 %v15, 270
+  %v17 = and i32 %v16, 65551
+  %v18 = or i32 %v17, 4113
+  %v19 = add i32 %v18, 25
+  %v20 = xor i32 %v19, 52
+  %v21 = add i32 %v20, 12365
+  %v22 = and i32 %v21, 16777236
+  %v23 = add i32 %v22, 23
+  %v24 = xor i32 %v23, 278
+  %v25 = and i32 %v24, 65559
+  %v26 = or i32 %v25, 4121
+  %v27 = add i32 %v26, 33
+  %v28 = xor i32 %v27, 60
+  %v29 = add i32 %v28, 12373
+  %v30 = and i32 %v29, 16777244
+  %v31 = add i32 %v30, 31
+  %v32 = xor i32 %v31, 286
+  %v33 = and i32 %v32, 65567
+  %v34 = or i32 %v33, 4129
+  %v35 = add i32 %v34, 41
+  %v36 = xor i32 %v35, 68
+  %v37 = add i32 %v36, 12381
+  %v38 = and i32 %v37, 16777252
+  %v39 = add i32 %v38, 39
+  %v40 = xor i32 %v39, 294
+  %v41 = and i32 %v40, 65575
+  %v42 = or i32 %v41, 4137
+  %v43 = add i32 %v42, 49
+  %v44 = xor i32 %v43, 76
+  %v45 = add i32 %v44, 12389
+  %v46 = and i32 %v45, 16777260
+  %v47 = add i32 %v46, 47
+  %v48 = xor i32 %v47, 302
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain67(i32 %a, i32 %b) {
+  %v1 = or i32 %a, 4096
+  %v2 = add i32 %v1, 8
+  %v3 = xor i32 %v2, 35
+  %v4 = add i32 %v3, 12348
+  %v5 = and i32 %v4, 16777219
+  %v6 = add i32 %v5, 6
+  %v7 = xor i32 %v6, 261
+  %v8 = and i32 %v7, 65542
+  %v9 = or i32 %v8, 4104
+  %v10 = add i32 %v9, 16
+  %v11 = xor i32 %v10, 43
+  %v12 = add i32 %v11, 12356
+  %v13 = and i32 %v12, 16777227
+  %v14 = add i32 %v13, 14
+  %v15 = xor i32 %v14, 269
+  %v16 = and i32 %v15, 65550
+  %v17 = or i32 %v16, 4112
+  %v18 = add i32 %v17, 24
+  %v19 = xor i32 %v18, 51
+  %v20 = add i32 %v19, 12364
+  %v21 = and i32 %v20, 16777235
+  %v22 = add i32 %v21, 22
+  %v23 = xor i32 %v22, 277
+  %v24 = and i32 %v23, 65558
+  %v25 = or i32 %v24, 4120
+  %v26 = add i32 %v25, 32
+  %v27 = xor i32 %v26, 59
+  %v28 = add i32 %v27, 12372
+  %v29 = and i32 %v28, 16777243
+  %v30 = add i32 %v29, 30
+  %v31 = xor i32 %v30, 285
+  %v32 = and i32 %v31, 65566
+  %v33 = or i32 %v32, 4128
+  %v34 = add i32 %v33, 40
+  %v35 = xor i32 %v34, 67
+  %v36 = add i32 %v35, 12380
+  %v37 = and i32 %v36, 16777251
+  %v38 = add i32 %v37, 38
+  %v39 = xor i32 %v38, 293
+  %v40 = and i32 %v39, 65574
+  %v41 = or i32 %v40, 4136
+  %v42 = add i32 %v41, 48
+  %v43 = xor i32 %v42, 75
+  %v44 = add i32 %v43, 12388
+  %v45 = and i32 %v44, 16777259
+  %v46 = add i32 %v45, 46
+  %v47 = xor i32 %v46, 301
+  %v48 = and i32 %v47, 65582
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain68(i32 %a, i32 %b) {
+  %v1 = add i32 %a, 7
+  %v2 = xor i32 %v1, 34
+  %v3 = add i32 %v2, 12347
+  %v4 = and i32 %v3, 16777218
+  %v5 = add i32 %v4, 5
+  %v6 = xor i32 %v5, 260
+  %v7 = and i32 %v6, 65541
+  %v8 = or i32 %v7, 4103
+  %v9 = add i32 %v8, 15
+  %v10 = xor i32 %v9, 42
+  %v11 = add i32 %v10, 12355
+  %v12 = and i32 %v11, 16777226
+  %v13 = add i32 %v12, 13
+  %v14 = xor i32 %v13, 268
+  %v15 = and i32 %v14, 65549
+  %v16 = or i32 %v15, 4111
+  %v17 = add i32 %v16, 23
+  %v18 = xor i32 %v17, 50
+  %v19 = add i32 %v18, 12363
+  %v20 = and i32 %v19, 16777234
+  %v21 = add i32 %v20, 21
+  %v22 = xor i32 %v21, 276
+  %v23 = and i32 %v22, 65557
+  %v24 = or i32 %v23, 4119
+  %v25 = add i32 %v24, 31
+  %v26 = xor i32 %v25, 58
+  %v27 = add i32 %v26, 12371
+  %v28 = and i32 %v27, 16777242
+  %v29 = add i32 %v28, 29
+  %v30 = xor i32 %v29, 284
+  %v31 = and i32 %v30, 65565
+  %v32 = or i32 %v31, 4127
+  %v33 = add i32 %v32, 39
+  %v34 = xor i32 %v33, 66
+  %v35 = add i32 %v34, 12379
+  %v36 = and i32 %v35, 16777250
+  %v37 = add i32 %v36, 37
+  %v38 = xor i32 %v37, 292
+  %v39 = and i32 %v38, 65573
+  %v40 = or i32 %v39, 4135
+  %v41 = add i32 %v40, 47
+  %v42 = xor i32 %v41, 74
+  %v43 = add i32 %v42, 12387
+  %v44 = and i32 %v43, 16777258
+  %v45 = add i32 %v44, 45
+  %v46 = xor i32 %v45, 300
+  %v47 = and i32 %v46, 65581
+  %v48 = or i32 %v47, 4143
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain69(i32 %a, i32 %b) {
+  %v1 = xor i32 %a, 33
+  %v2 = add i32 %v1, 12346
+  %v3 = and i32 %v2, 16777217
+  %v4 = add i32 %v3, 4
+  %v5 = xor i32 %v4, 259
+  %v6 = and i32 %v5, 65540
+  %v7 = or i32 %v6, 4102
+  %v8 = add i32 %v7, 14
+  %v9 = xor i32 %v8, 41
+  %v10 = add i32 %v9, 12354
+  %v11 = and i32 %v10, 16777225
+  %v12 = add i32 %v11, 12
+  %v13 = xor i32 %v12, 267
+  %v14 = and i32 %v13, 65548
+  %v15 = or i32 %v14, 4110
+  %v16 = add i32 %v15, 22
+  %v17 = xor i32 %v16, 49
+  %v18 = add i32 %v17, 12362
+  %v19 = and i32 %v18, 16777233
+  %v20 = add i32 %v19, 20
+  %v21 = xor i32 %v20, 275
+  %v22 = and i32 %v21, 65556
+  %v23 = or i32 %v22, 4118
+  %v24 = add i32 %v23, 30
+  %v25 = xor i32 %v24, 57
+  %v26 = add i32 %v25, 12370
+  %v27 = and i32 %v26, 16777241
+  %v28 = add i32 %v27, 28
+  %v29 = xor i32 %v28, 283
+  %v30 = and i32 %v29, 65564
+  %v31 = or i32 %v30, 4126
+  %v32 = add i32 %v31, 38
+  %v33 = xor i32 %v32, 65
+  %v34 = add i32 %v33, 12378
+  %v35 = and i32 %v34, 16777249
+  %v36 = add i32 %v35, 36
+  %v37 = xor i32 %v36, 291
+  %v38 = and i32 %v37, 65572
+  %v39 = or i32 %v38, 4134
+  %v40 = add i32 %v39, 46
+  %v41 = xor i32 %v40, 73
+  %v42 = add i32 %v41, 12386
+  %v43 = and i32 %v42, 16777257
+  %v44 = add i32 %v43, 44
+  %v45 = xor i32 %v44, 299
+  %v46 = and i32 %v45, 65580
+  %v47 = or i32 %v46, 4142
+  %v48 = add i32 %v47, 54
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain70(i32 %a, i32 %b) {
+  %v1 = add i32 %a, 12345
+  %v2 = and i32 %v1, 16777216
+  %v3 = add i32 %v2, 3
+  %v4 = xor i32 %v3, 258
+  %v5 = and i32 %v4, 65539
+  %v6 = or i32 %v5, 4101
+  %v7 = add i32 %v6, 13
+  %v8 = xor i32 %v7, 40
+  %v9 = add i32 %v8, 12353
+  %v10 = and i32 %v9, 16777224
+  %v11 = add i32 %v10, 11
+  %v12 = xor i32 %v11, 266
+  %v13 = and i32 %v12, 65547
+  %v14 = or i32 %v13, 4109
+  %v15 = add i32 %v14, 21
+  %v16 = xor i32 %v15, 48
+  %v17 = add i32 %v16, 12361
+  %v18 = and i32 %v17, 16777232
+  %v19 = add i32 %v18, 19
+  %v20 = xor i32 %v19, 274
+  %v21 = and i32 %v20, 65555
+  %v22 = or i32 %v21, 4117
+  %v23 = add i32 %v22, 29
+  %v24 = xor i32 %v23, 56
+  %v25 = add i32 %v24, 12369
+  %v26 = and i32 %v25, 16777240
+  %v27 = add i32 %v26, 27
+  %v28 = xor i32 %v27, 282
+  %v29 = and i32 %v28, 65563
+  %v30 = or i32 %v29, 4125
+  %v31 = add i32 %v30, 37
+  %v32 = xor i32 %v31, 64
+  %v33 = add i32 %v32, 12377
+  %v34 = and i32 %v33, 16777248
+  %v35 = add i32 %v34, 35
+  %v36 = xor i32 %v35, 290
+  %v37 = and i32 %v36, 65571
+  %v38 = or i32 %v37, 4133
+  %v39 = add i32 %v38, 45
+  %v40 = xor i32 %v39, 72
+  %v41 = add i32 %v40, 12385
+  %v42 = and i32 %v41, 16777256
+  %v43 = add i32 %v42, 43
+  %v44 = xor i32 %v43, 298
+  %v45 = and i32 %v44, 65579
+  %v46 = or i32 %v45, 4141
+  %v47 = add i32 %v46, 53
+  %v48 = xor i32 %v47, 80
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain71(i32 %a, i32 %b) {
+  %v1 = and i32 %a, 16777215
+  %v2 = add i32 %v1, 2
+  %v3 = xor i32 %v2, 257
+  %v4 = and i32 %v3, 65538
+  %v5 = or i32 %v4, 4100
+  %v6 = add i32 %v5, 12
+  %v7 = xor i32 %v6, 39
+  %v8 = add i32 %v7, 12352
+  %v9 = and i32 %v8, 16777223
+  %v10 = add i32 %v9, 10
+  %v11 = xor i32 %v10, 265
+  %v12 = and i32 %v11, 65546
+  %v13 = or i32 %v12, 4108
+  %v14 = add i32 %v13, 20
+  %v15 = xor i32 %v14, 47
+  %v16 = add i32 %v15, 12360
+  %v17 = and i32 %v16, 16777231
+  %v18 = add i32 %v17, 18
+  %v19 = xor i32 %v18, 273
+  %v20 = and i32 %v19, 65554
+  %v21 = or i32 %v20, 4116
+  %v22 = add i32 %v21, 28
+  %v23 = xor i32 %v22, 55
+  %v24 = add i32 %v23, 12368
+  %v25 = and i32 %v24, 16777239
+  %v26 = add i32 %v25, 26
+  %v27 = xor i32 %v26, 281
+  %v28 = and i32 %v27, 65562
+  %v29 = or i32 %v28, 4124
+  %v30 = add i32 %v29, 36
+  %v31 = xor i32 %v30, 63
+  %v32 = add i32 %v31, 12376
+  %v33 = and i32 %v32, 16777247
+  %v34 = add i32 %v33, 34
+  %v35 = xor i32 %v34, 289
+  %v36 = and i32 %v35, 65570
+  %v37 = or i32 %v36, 4132
+  %v38 = add i32 %v37, 44
+  %v39 = xor i32 %v38, 71
+  %v40 = add i32 %v39, 12384
+  %v41 = and i32 %v40, 16777255
+  %v42 = add i32 %v41, 42
+  %v43 = xor i32 %v42, 297
+  %v44 = and i32 %v43, 65578
+  %v45 = or i32 %v44, 4140
+  %v46 = add i32 %v45, 52
+  %v47 = xor i32 %v46, 79
+  %v48 = add i32 %v47, 12392
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain72(i32 %a, i32 %b) {
+  %v1 = add i32 %a, 1
+  %v2 = xor i32 %v1, 256
+  %v3 = and i32 %v2, 65537
+  %v4 = or i32 %v3, 4099
+  %v5 = add i32 %v4, 11
+  %v6 = xor i32 %v5, 38
+  %v7 = add i32 %v6, 12351
+  %v8 = and i32 %v7, 16777222
+  %v9 = add i32 %v8, 9
+  %v10 = xor i32 %v9, 264
+  %v11 = and i32 %v10, 65545
+  %v12 = or i32 %v11, 4107
+  %v13 = add i32 %v12, 19
+  %v14 = xor i32 %v13, 46
+  %v15 = add i32 %v14, 12359
+  %v16 = and i32 %v15, 16777230
+  %v17 = add i32 %v16, 17
+  %v18 = xor i32 %v17, 272
+  %v19 = and i32 %v18, 65553
+  %v20 = or i32 %v19, 4115
+  %v21 = add i32 %v20, 27
+  %v22 = xor i32 %v21, 54
+  %v23 = add i32 %v22, 12367
+  %v24 = and i32 %v23, 16777238
+  %v25 = add i32 %v24, 25
+  %v26 = xor i32 %v25, 280
+  %v27 = and i32 %v26, 65561
+  %v28 = or i32 %v27, 4123
+  %v29 = add i32 %v28, 35
+  %v30 = xor i32 %v29, 62
+  %v31 = add i32 %v30, 12375
+  %v32 = and i32 %v31, 16777246
+  %v33 = add i32 %v32, 33
+  %v34 = xor i32 %v33, 288
+  %v35 = and i32 %v34, 65569
+  %v36 = or i32 %v35, 4131
+  %v37 = add i32 %v36, 43
+  %v38 = xor i32 %v37, 70
+  %v39 = add i32 %v38, 12383
+  %v40 = and i32 %v39, 16777254
+  %v41 = add i32 %v40, 41
+  %v42 = xor i32 %v41, 296
+  %v43 = and i32 %v42, 65577
+  %v44 = or i32 %v43, 4139
+  %v45 = add i32 %v44, 51
+  %v46 = xor i32 %v45, 78
+  %v47 = add i32 %v46, 12391
+  %v48 = and i32 %v47, 16777262
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain73(i32 %a, i32 %b) {
+  %v1 = xor i32 %a, 255
+  %v2 = and i32 %v1, 65536
+  %v3 = or i32 %v2, 4098
+  %v4 = add i32 %v3, 10
+  %v5 = xor i32 %v4, 37
+  %v6 = add i32 %v5, 12350
+  %v7 = and i32 %v6, 16777221
+  %v8 = add i32 %v7, 8
+  %v9 = xor i32 %v8, 263
+  %v10 = and i32 %v9, 65544
+  %v11 = or i32 %v10, 4106
+  %v12 = add i32 %v11, 18
+  %v13 = xor i32 %v12, 45
+  %v14 = add i32 %v13, 12358
+  %v15 = and i32 %v14, 16777229
+  %v16 = add i32 %v15, 16
+  %v17 = xor i32 %v16, 271
+  %v18 = and i32 %v17, 65552
+  %v19 = or i32 %v18, 4114
+  %v20 = add i32 %v19, 26
+  %v21 = xor i32 %v20, 53
+  %v22 = add i32 %v21, 12366
+  %v23 = and i32 %v22, 16777237
+  %v24 = add i32 %v23, 24
+  %v25 = xor i32 %v24, 279
+  %v26 = and i32 %v25, 65560
+  %v27 = or i32 %v26, 4122
+  %v28 = add i32 %v27, 34
+  %v29 = xor i32 %v28, 61
+  %v30 = add i32 %v29, 12374
+  %v31 = and i32 %v30, 16777245
+  %v32 = add i32 %v31, 32
+  %v33 = xor i32 %v32, 287
+  %v34 = and i32 %v33, 65568
+  %v35 = or i32 %v34, 4130
+  %v36 = add i32 %v35, 42
+  %v37 = xor i32 %v36, 69
+  %v38 = add i32 %v37, 12382
+  %v39 = and i32 %v38, 16777253
+  %v40 = add i32 %v39, 40
+  %v41 = xor i32 %v40, 295
+  %v42 = and i32 %v41, 65576
+  %v43 = or i32 %v42, 4138
+  %v44 = add i32 %v43, 50
+  %v45 = xor i32 %v44, 77
+  %v46 = add i32 %v45, 12390
+  %v47 = and i32 %v46, 16777261
+  %v48 = add i32 %v47, 48
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain74(i32 %a, i32 %b) {
+  %v1 = and i32 %a, 65535
+  %v2 = or i32 %v1, 4097
+  %v3 = add i32 %v2, 9
+  %v4 = xor i32 %v3, 36
+  %v5 = add i32 %v4, 12349
+  %v6 = and i32 %v5, 16777220
+  %v7 = add i32 %v6, 7
+  %v8 = xor i32 %v7, 262
+  %v9 = and i32 %v8, 65543
+  %v10 = or i32 %v9, 4105
+  %v11 = add i32 %v10, 17
+  %v12 = xor i32 %v11, 44
+  %v13 = add i32 %v12, 12357
+  %v14 = and i32 %v13, 16777228
+  %v15 = add i32 %v14, 15
+  %v16 = xor i32 %v15, 270
+  %v17 = and i32 %v16, 65551
+  %v18 = or i32 %v17, 4113
+  %v19 = add i32 %v18, 25
+  %v20 = xor i32 %v19, 52
+  %v21 = add i32 %v20, 12365
+  %v22 = and i32 %v21, 16777236
+  %v23 = add i32 %v22, 23
+  %v24 = xor i32 %v23, 278
+  %v25 = and i32 %v24, 65559
+  %v26 = or i32 %v25, 4121
+  %v27 = add i32 %v26, 33
+  %v28 = xor i32 %v27, 60
+  %v29 = add i32 %v28, 12373
+  %v30 = and i32 %v29, 16777244
+  %v31 = add i32 %v30, 31
+  %v32 = xor i32 %v31, 286
+  %v33 = and i32 %v32, 65567
+  %v34 = or i32 %v33, 4129
+  %v35 = add i32 %v34, 41
+  %v36 = xor i32 %v35, 68
+  %v37 = add i32 %v36, 12381
+  %v38 = and i32 %v37, 16777252
+  %v39 = add i32 %v38, 39
+  %v40 = xor i32 %v39, 294
+  %v41 = and i32 %v40, 65575
+  %v42 = or i32 %v41, 4137
+  %v43 = add i32 %v42, 49
+  %v44 = xor i32 %v43, 76
+  %v45 = add i32 %v44, 12389
+  %v46 = and i32 %v45, 16777260
+  %v47 = add i32 %v46, 47
+  %v48 = xor i32 %v47, 302
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain75(i32 %a, i32 %b) {
+  %v1 = or i32 %a, 4096
+  %v2 = add i32 %v1, 8
+  %v3 = xor i32 %v2, 35
+  %v4 = add i32 %v3, 12348
+  %v5 = and i32 %v4, 16777219
+  %v6 = add i32 %v5, 6
+  %v7 = xor i32 %v6, 261
+  %v8 = and i32 %v7, 65542
+  %v9 = or i32 %v8, 4104
+  %v10 = add i32 %v9, 16
+  %v11 = xor i32 %v10, 43
+  %v12 = add i32 %v11, 12356
+  %v13 = and i32 %v12, 16777227
+  %v14 = add i32 %v13, 14
+  %v15 = xor i32 %v14, 269
+  %v16 = and i32 %v15, 65550
+  %v17 = or i32 %v16, 4112
+  %v18 = add i32 %v17, 24
+  %v19 = xor i32 %v18, 51
+  %v20 = add i32 %v19, 12364
+  %v21 = and i32 %v20, 16777235
+  %v22 = add i32 %v21, 22
+  %v23 = xor i32 %v22, 277
+  %v24 = and i32 %v23, 65558
+  %v25 = or i32 %v24, 4120
+  %v26 = add i32 %v25, 32
+  %v27 = xor i32 %v26, 59
+  %v28 = add i32 %v27, 12372
+  %v29 = and i32 %v28, 16777243
+  %v30 = add i32 %v29, 30
+  %v31 = xor i32 %v30, 285
+  %v32 = and i32 %v31, 65566
+  %v33 = or i32 %v32, 4128
+  %v34 = add i32 %v33, 40
+  %v35 = xor i32 %v34, 67
+  %v36 = add i32 %v35, 12380
+  %v37 = and i32 %v36, 16777251
+  %v38 = add i32 %v37, 38
+  %v39 = xor i32 %v38, 293
+  %v40 = and i32 %v39, 65574
+  %v41 = or i32 %v40, 4136
+  %v42 = add i32 %v41, 48
+  %v43 = xor i32 %v42, 75
+  %v44 = add i32 %v43, 12388
+  %v45 = and i32 %v44, 16777259
+  %v46 = add i32 %v45, 46
+  %v47 = xor i32 %v46, 301
+  %v48 = and i32 %v47, 65582
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain76(i32 %a, i32 %b) {
+  %v1 = add i32 %a, 7
+  %v2 = xor i32 %v1, 34
+  %v3 = add i32 %v2, 12347
+  %v4 = and i32 %v3, 16777218
+  %v5 = add i32 %v4, 5
+  %v6 = xor i32 %v5, 260
+  %v7 = and i32 %v6, 65541
+  %v8 = or i32 %v7, 4103
+  %v9 = add i32 %v8, 15
+  %v10 = xor i32 %v9, 42
+  %v11 = add i32 %v10, 12355
+  %v12 = and i32 %v11, 16777226
+  %v13 = add i32 %v12, 13
+  %v14 = xor i32 %v13, 268
+  %v15 = and i32 %v14, 65549
+  %v16 = or i32 %v15, 4111
+  %v17 = add i32 %v16, 23
+  %v18 = xor i32 %v17, 50
+  %v19 = add i32 %v18, 12363
+  %v20 = and i32 %v19, 16777234
+  %v21 = add i32 %v20, 21
+  %v22 = xor i32 %v21, 276
+  %v23 = and i32 %v22, 65557
+  %v24 = or i32 %v23, 4119
+  %v25 = add i32 %v24, 31
+  %v26 = xor i32 %v25, 58
+  %v27 = add i32 %v26, 12371
+  %v28 = and i32 %v27, 16777242
+  %v29 = add i32 %v28, 29
+  %v30 = xor i32 %v29, 284
+  %v31 = and i32 %v30, 65565
+  %v32 = or i32 %v31, 4127
+  %v33 = add i32 %v32, 39
+  %v34 = xor i32 %v33, 66
+  %v35 = add i32 %v34, 12379
+  %v36 = and i32 %v35, 16777250
+  %v37 = add i32 %v36, 37
+  %v38 = xor i32 %v37, 292
+  %v39 = and i32 %v38, 65573
+  %v40 = or i32 %v39, 4135
+  %v41 = add i32 %v40, 47
+  %v42 = xor i32 %v41, 74
+  %v43 = add i32 %v42, 12387
+  %v44 = and i32 %v43, 16777258
+  %v45 = add i32 %v44, 45
+  %v46 = xor i32 %v45, 300
+  %v47 = and i32 %v46, 65581
+  %v48 = or i32 %v47, 4143
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain77(i32 %a, i32 %b) {
+  %v1 = xor i32 %a, 33
+  %v2 = add i32 %v1, 12346
+  %v3 = and i32 %v2, 16777217
+  %v4 = add i32 %v3, 4
+  %v5 = xor i32 %v4, 259
+  %v6 = and i32 %v5, 65540
+  %v7 = or i32 %v6, 4102
+  %v8 = add i32 %v7, 14
+  %v9 = xor i32 %v8, 41
+  %v10 = add i32 %v9, 12354
+  %v11 = and i32 %v10, 16777225
+  %v12 = add i32 %v11, 12
+  %v13 = xor i32 %v12, 267
+  %v14 = and i32 %v13, 65548
+  %v15 = or i32 %v14, 4110
+  %v16 = add i32 %v15, 22
+  %v17 = xor i32 %v16, 49
+  %v18 = add i32 %v17, 12362
+  %v19 = and i32 %v18, 16777233
+  %v20 = add i32 %v19, 20
+  %v21 = xor i32 %v20, 275
+  %v22 = and i32 %v21, 65556
+  %v23 = or i32 %v22, 4118
+  %v24 = add i32 %v23, 30
+  %v25 = xor i32 %v24, 57
+  %v26 = add i32 %v25, 12370
+  %v27 = and i32 %v26, 16777241
+  %v28 = add i32 %v27, 28
+  %v29 = xor i32 %v28, 283
+  %v30 = and i32 %v29, 65564
+  %v31 = or i32 %v30, 4126
+  %v32 = add i32 %v31, 38
+  %v33 = xor i32 %v32, 65
+  %v34 = add i32 %v33, 12378
+  %v35 = and i32 %v34, 16777249
+  %v36 = add i32 %v35, 36
+  %v37 = xor i32 %v36, 291
+  %v38 = and i32 %v37, 65572
+  %v39 = or i32 %v38, 4134
+  %v40 = add i32 %v39, 46
+  %v41 = xor i32 %v40, 73
+  %v42 = add i32 %v41, 12386
+  %v43 = and i32 %v42, 16777257
+  %v44 = add i32 %v43, 44
+  %v45 = xor i32 %v44, 299
+  %v46 = and i32 %v45, 65580
+  %v47 = or i32 %v46, 4142
+  %v48 = add i32 %v47, 54
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain78(i32 %a, i32 %b) {
+  %v1 = add i32 %a, 12345
+  %v2 = and i32 %v1, 16777216
+  %v3 = add i32 %v2, 3
+  %v4 = xor i32 %v3, 258
+  %v5 = and i32 %v4, 65539
+  %v6 = or i32 %v5, 4101
+  %v7 = add i32 %v6, 13
+  %v8 = xor i32 %v7, 40
+  %v9 = add i32 %v8, 12353
+  %v10 = and i32 %v9, 16777224
+  %v11 = add i32 %v10, 11
+  %v12 = xor i32 %v11, 266
+  %v13 = and i32 %v12, 65547
+  %v14 = or i32 %v13, 4109
+  %v15 = add i32 %v14, 21
+  %v16 = xor i32 %v15, 48
+  %v17 = add i32 %v16, 12361
+  %v18 = and i32 %v17, 16777232
+  %v19 = add i32 %v18, 19
+  %v20 = xor i32 %v19, 274
+  %v21 = and i32 %v20, 65555
+  %v22 = or i32 %v21, 4117
+  %v23 = add i32 %v22, 29
+  %v24 = xor i32 %v23, 56
+  %v25 = add i32 %v24, 12369
+  %v26 = and i32 %v25, 16777240
+  %v27 = add i32 %v26, 27
+  %v28 = xor i32 %v27, 282
+  %v29 = and i32 %v28, 65563
+  %v30 = or i32 %v29, 4125
+  %v31 = add i32 %v30, 37
+  %v32 = xor i32 %v31, 64
+  %v33 = add i32 %v32, 12377
+  %v34 = and i32 %v33, 16777248
+  %v35 = add i32 %v34, 35
+  %v36 = xor i32 %v35, 290
+  %v37 = and i32 %v36, 65571
+  %v38 = or i32 %v37, 4133
+  %v39 = add i32 %v38, 45
+  %v40 = xor i32 %v39, 72
+  %v41 = add i32 %v40, 12385
+  %v42 = and i32 %v41, 16777256
+  %v43 = add i32 %v42, 43
+  %v44 = xor i32 %v43, 298
+  %v45 = and i32 %v44, 65579
+  %v46 = or i32 %v45, 4141
+  %v47 = add i32 %v46, 53
+  %v48 = xor i32 %v47, 80
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain79(i32 %a, i32 %b) {
+  %v1 = and i32 %a, 16777215
+  %v2 = add i32 %v1, 2
+  %v3 = xor i32 %v2, 257
+  %v4 = and i32 %v3, 65538
+  %v5 = or i32 %v4, 4100
+  %v6 = add i32 %v5, 12
+  %v7 = xor i32 %v6, 39
+  %v8 = add i32 %v7, 12352
+  %v9 = and i32 %v8, 16777223
+  %v10 = add i32 %v9, 10
+  %v11 = xor i32 %v10, 265
+  %v12 = and i32 %v11, 65546
+  %v13 = or i32 %v12, 4108
+  %v14 = add i32 %v13, 20
+  %v15 = xor i32 %v14, 47
+  %v16 = add i32 %v15, 12360
+  %v17 = and i32 %v16, 16777231
+  %v18 = add i32 %v17, 18
+  %v19 = xor i32 %v18, 273
+  %v20 = and i32 %v19, 65554
+  %v21 = or i32 %v20, 4116
+  %v22 = add i32 %v21, 28
+  %v23 = xor i32 %v22, 55
+  %v24 = add i32 %v23, 12368
+  %v25 = and i32 %v24, 16777239
+  %v26 = add i32 %v25, 26
+  %v27 = xor i32 %v26, 281
+  %v28 = and i32 %v27, 65562
+  %v29 = or i32 %v28, 4124
+  %v30 = add i32 %v29, 36
+  %v31 = xor i32 %v30, 63
+  %v32 = add i32 %v31, 12376
+  %v33 = and i32 %v32, 16777247
+  %v34 = add i32 %v33, 34
+  %v35 = xor i32 %v34, 289
+  %v36 = and i32 %v35, 65570
+  %v37 = or i32 %v36, 4132
+  %v38 = add i32 %v37, 44
+  %v39 = xor i32 %v38, 71
+  %v40 = add i32 %v39, 12384
+  %v41 = and i32 %v40, 16777255
+  %v42 = add i32 %v41, 42
+  %v43 = xor i32 %v42, 297
+  %v44 = and i32 %v43, 65578
+  %v45 = or i32 %v44, 4140
+  %v46 = add i32 %v45, 52
+  %v47 = xor i32 %v46, 79
+  %v48 = add i32 %v47, 12392
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain80(i32 %a, i32 %b) {
+  %v1 = add i32 %a, 1
+  %v2 = xor i32 %v1, 256
+  %v3 = and i32 %v2, 65537
+  %v4 = or i32 %v3, 4099
+  %v5 = add i32 %v4, 11
+  %v6 = xor i32 %v5, 38
+  %v7 = add i32 %v6, 12351
+  %v8 = and i32 %v7, 16777222
+  %v9 = add i32 %v8, 9
+  %v10 = xor i32 %v9, 264
+  %v11 = and i32 %v10, 65545
+  %v12 = or i32 %v11, 4107
+  %v13 = add i32 %v12, 19
+  %v14 = xor i32 %v13, 46
+  %v15 = add i32 %v14, 12359
+  %v16 = and i32 %v15, 16777230
+  %v17 = add i32 %v16, 17
+  %v18 = xor i32 %v17, 272
+  %v19 = and i32 %v18, 65553
+  %v20 = or i32 %v19, 4115
+  %v21 = add i32 %v20, 27
+  %v22 = xor i32 %v21, 54
+  %v23 = add i32 %v22, 12367
+  %v24 = and i32 %v23, 16777238
+  %v25 = add i32 %v24, 25
+  %v26 = xor i32 %v25, 280
+  %v27 = and i32 %v26, 65561
+  %v28 = or i32 %v27, 4123
+  %v29 = add i32 %v28, 35
+  %v30 = xor i32 %v29, 62
+  %v31 = add i32 %v30, 12375
+  %v32 = and i32 %v31, 16777246
+  %v33 = add i32 %v32, 33
+  %v34 = xor i32 %v33, 288
+  %v35 = and i32 %v34, 65569
+  %v36 = or i32 %v35, 4131
+  %v37 = add i32 %v36, 43
+  %v38 = xor i32 %v37, 70
+  %v39 = add i32 %v38, 12383
+  %v40 = and i32 %v39, 16777254
+  %v41 = add i32 %v40, 41
+  %v42 = xor i32 %v41, 296
+  %v43 = and i32 %v42, 65577
+  %v44 = or i32 %v43, 4139
+  %v45 = add i32 %v44, 51
+  %v46 = xor i32 %v45, 78
+  %v47 = add i32 %v46, 12391
+  %v48 = and i32 %v47, 16777262
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain81(i32 %a, i32 %b) {
+  %v1 = xor i32 %a, 255
+  %v2 = and i32 %v1, 65536
+  %v3 = or i32 %v2, 4098
+  %v4 = add i32 %v3, 10
+  %v5 = xor i32 %v4, 37
+  %v6 = add i32 %v5, 12350
+  %v7 = and i32 %v6, 16777221
+  %v8 = add i32 %v7, 8
+  %v9 = xor i32 %v8, 263
+  %v10 = and i32 %v9, 65544
+  %v11 = or i32 %v10, 4106
+  %v12 = add i32 %v11, 18
+  %v13 = xor i32 %v12, 45
+  %v14 = add i32 %v13, 12358
+  %v15 = and i32 %v14, 16777229
+  %v16 = add i32 %v15, 16
+  %v17 = xor i32 %v16, 271
+  %v18 = and i32 %v17, 65552
+  %v19 = or i32 %v18, 4114
+  %v20 = add i32 %v19, 26
+  %v21 = xor i32 %v20, 53
+  %v22 = add i32 %v21, 12366
+  %v23 = and i32 %v22, 16777237
+  %v24 = add i32 %v23, 24
+  %v25 = xor i32 %v24, 279
+  %v26 = and i32 %v25, 65560
+  %v27 = or i32 %v26, 4122
+  %v28 = add i32 %v27, 34
+  %v29 = xor i32 %v28, 61
+  %v30 = add i32 %v29, 12374
+  %v31 = and i32 %v30, 16777245
+  %v32 = add i32 %v31, 32
+  %v33 = xor i32 %v32, 287
+  %v34 = and i32 %v33, 65568
+  %v35 = or i32 %v34, 4130
+  %v36 = add i32 %v35, 42
+  %v37 = xor i32 %v36, 69
+  %v38 = add i32 %v37, 12382
+  %v39 = and i32 %v38, 16777253
+  %v40 = add i32 %v39, 40
+  %v41 = xor i32 %v40, 295
+  %v42 = and i32 %v41, 65576
+  %v43 = or i32 %v42, 4138
+  %v44 = add i32 %v43, 50
+  %v45 = xor i32 %v44, 77
+  %v46 = add i32 %v45, 12390
+  %v47 = and i32 %v46, 16777261
+  %v48 = add i32 %v47, 48
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain82(i32 %a, i32 %b) {
+  %v1 = and i32 %a, 65535
+  %v2 = or i32 %v1, 4097
+  %v3 = add i32 %v2, 9
+  %v4 = xor i32 %v3, 36
+  %v5 = add i32 %v4, 12349
+  %v6 = and i32 %v5, 16777220
+  %v7 = add i32 %v6, 7
+  %v8 = xor i32 %v7, 262
+  %v9 = and i32 %v8, 65543
+  %v10 = or i32 %v9, 4105
+  %v11 = add i32 %v10, 17
+  %v12 = xor i32 %v11, 44
+  %v13 = add i32 %v12, 12357
+  %v14 = and i32 %v13, 16777228
+  %v15 = add i32 %v14, 15
+  %v16 = xor i32 %v15, 270
+  %v17 = and i32 %v16, 65551
+  %v18 = or i32 %v17, 4113
+  %v19 = add i32 %v18, 25
+  %v20 = xor i32 %v19, 52
+  %v21 = add i32 %v20, 12365
+  %v22 = and i32 %v21, 16777236
+  %v23 = add i32 %v22, 23
+  %v24 = xor i32 %v23, 278
+  %v25 = and i32 %v24, 65559
+  %v26 = or i32 %v25, 4121
+  %v27 = add i32 %v26, 33
+  %v28 = xor i32 %v27, 60
+  %v29 = add i32 %v28, 12373
+  %v30 = and i32 %v29, 16777244
+  %v31 = add i32 %v30, 31
+  %v32 = xor i32 %v31, 286
+  %v33 = and i32 %v32, 65567
+  %v34 = or i32 %v33, 4129
+  %v35 = add i32 %v34, 41
+  %v36 = xor i32 %v35, 68
+  %v37 = add i32 %v36, 12381
+  %v38 = and i32 %v37, 16777252
+  %v39 = add i32 %v38, 39
+  %v40 = xor i32 %v39, 294
+  %v41 = and i32 %v40, 65575
+  %v42 = or i32 %v41, 4137
+  %v43 = add i32 %v42, 49
+  %v44 = xor i32 %v43, 76
+  %v45 = add i32 %v44, 12389
+  %v46 = and i32 %v45, 16777260
+  %v47 = add i32 %v46, 47
+  %v48 = xor i32 %v47, 302
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain83(i32 %a, i32 %b) {
+  %v1 = or i32 %a, 4096
+  %v2 = add i32 %v1, 8
+  %v3 = xor i32 %v2, 35
+  %v4 = add i32 %v3, 12348
+  %v5 = and i32 %v4, 16777219
+  %v6 = add i32 %v5, 6
+  %v7 = xor i32 %v6, 261
+  %v8 = and i32 %v7, 65542
+  %v9 = or i32 %v8, 4104
+  %v10 = add i32 %v9, 16
+  %v11 = xor i32 %v10, 43
+  %v12 = add i32 %v11, 12356
+  %v13 = and i32 %v12, 16777227
+  %v14 = add i32 %v13, 14
+  %v15 = xor i32 %v14, 269
+  %v16 = and i32 %v15, 65550
+  %v17 = or i32 %v16, 4112
+  %v18 = add i32 %v17, 24
+  %v19 = xor i32 %v18, 51
+  %v20 = add i32 %v19, 12364
+  %v21 = and i32 %v20, 16777235
+  %v22 = add i32 %v21, 22
+  %v23 = xor i32 %v22, 277
+  %v24 = and i32 %v23, 65558
+  %v25 = or i32 %v24, 4120
+  %v26 = add i32 %v25, 32
+  %v27 = xor i32 %v26, 59
+  %v28 = add i32 %v27, 12372
+  %v29 = and i32 %v28, 16777243
+  %v30 = add i32 %v29, 30
+  %v31 = xor i32 %v30, 285
+  %v32 = and i32 %v31, 65566
+  %v33 = or i32 %v32, 4128
+  %v34 = add i32 %v33, 40
+  %v35 = xor i32 %v34, 67
+  %v36 = add i32 %v35, 12380
+  %v37 = and i32 %v36, 16777251
+  %v38 = add i32 %v37, 38
+  %v39 = xor i32 %v38, 293
+  %v40 = and i32 %v39, 65574
+  %v41 = or i32 %v40, 4136
+  %v42 = add i32 %v41, 48
+  %v43 = xor i32 %v42, 75
+  %v44 = add i32 %v43, 12388
+  %v45 = and i32 %v44, 16777259
+  %v46 = add i32 %v45, 46
+  %v47 = xor i32 %v46, 301
+  %v48 = and i32 %v47, 65582
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain84(i32 %a, i32 %b) {
+  %v1 = add i32 %a, 7
+  %v2 = xor i32 %v1, 34
+  %v3 = add i32 %v2, 12347
+  %v4 = and i32 %v3, 16777218
+  %v5 = add i32 %v4, 5
+  %v6 = xor i32 %v5, 260
+  %v7 = and i32 %v6, 65541
+  %v8 = or i32 %v7, 4103
+  %v9 = add i32 %v8, 15
+  %v10 = xor i32 %v9, 42
+  %v11 = add i32 %v10, 12355
+  %v12 = and i32 %v11, 16777226
+  %v13 = add i32 %v12, 13
+  %v14 = xor i32 %v13, 268
+  %v15 = and i32 %v14, 65549
+  %v16 = or i32 %v15, 4111
+  %v17 = add i32 %v16, 23
+  %v18 = xor i32 %v17, 50
+  %v19 = add i32 %v18, 12363
+  %v20 = and i32 %v19, 16777234
+  %v21 = add i32 %v20, 21
+  %v22 = xor i32 %v21, 276
+  %v23 = and i32 %v22, 65557
+  %v24 = or i32 %v23, 4119
+  %v25 = add i32 %v24, 31
+  %v26 = xor i32 %v25, 58
+  %v27 = add i32 %v26, 12371
+  %v28 = and i32 %v27, 16777242
+  %v29 = add i32 %v28, 29
+  %v30 = xor i32 %v29, 284
+  %v31 = and i32 %v30, 65565
+  %v32 = or i32 %v31, 4127
+  %v33 = add i32 %v32, 39
+  %v34 = xor i32 %v33, 66
+  %v35 = add i32 %v34, 12379
+  %v36 = and i32 %v35, 16777250
+  %v37 = add i32 %v36, 37
+  %v38 = xor i32 %v37, 292
+  %v39 = and i32 %v38, 65573
+  %v40 = or i32 %v39, 4135
+  %v41 = add i32 %v40, 47
+  %v42 = xor i32 %v41, 74
+  %v43 = add i32 %v42, 12387
+  %v44 = and i32 %v43, 16777258
+  %v45 = add i32 %v44, 45
+  %v46 = xor i32 %v45, 300
+  %v47 = and i32 %v46, 65581
+  %v48 = or i32 %v47, 4143
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain85(i32 %a, i32 %b) {
+  %v1 = xor i32 %a, 33
+  %v2 = add i32 %v1, 12346
+  %v3 = and i32 %v2, 16777217
+  %v4 = add i32 %v3, 4
+  %v5 = xor i32 %v4, 259
+  %v6 = and i32 %v5, 65540
+  %v7 = or i32 %v6, 4102
+  %v8 = add i32 %v7, 14
+  %v9 = xor i32 %v8, 41
+  %v10 = add i32 %v9, 12354
+  %v11 = and i32 %v10, 16777225
+  %v12 = add i32 %v11, 12
+  %v13 = xor i32 %v12, 267
+  %v14 = and i32 %v13, 65548
+  %v15 = or i32 %v14, 4110
+  %v16 = add i32 %v15, 22
+  %v17 = xor i32 %v16, 49
+  %v18 = add i32 %v17, 12362
+  %v19 = and i32 %v18, 16777233
+  %v20 = add i32 %v19, 20
+  %v21 = xor i32 %v20, 275
+  %v22 = and i32 %v21, 65556
+  %v23 = or i32 %v22, 4118
+  %v24 = add i32 %v23, 30
+  %v25 = xor i32 %v24, 57
+  %v26 = add i32 %v25, 12370
+  %v27 = and i32 %v26, 16777241
+  %v28 = add i32 %v27, 28
+  %v29 = xor i32 %v28, 283
+  %v30 = and i32 %v29, 65564
+  %v31 = or i32 %v30, 4126
+  %v32 = add i32 %v31, 38
+  %v33 = xor i32 %v32, 65
+  %v34 = add i32 %v33, 12378
+  %v35 = and i32 %v34, 16777249
+  %v36 = add i32 %v35, 36
+  %v37 = xor i32 %v36, 291
+  %v38 = and i32 %v37, 65572
+  %v39 = or i32 %v38, 4134
+  %v40 = add i32 %v39, 46
+  %v41 = xor i32 %v40, 73
+  %v42 = add i32 %v41, 12386
+  %v43 = and i32 %v42, 16777257
+  %v44 = add i32 %v43, 44
+  %v45 = xor i32 %v44, 299
+  %v46 = and i32 %v45, 65580
+  %v47 = or i32 %v46, 4142
+  %v48 = add i32 %v47, 54
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain86(i32 %a, i32 %b) {
+  %v1 = add i32 %a, 12345
+  %v2 = and i32 %v1, 16777216
+  %v3 = add i32 %v2, 3
+  %v4 = xor i32 %v3, 258
+  %v5 = and i32 %v4, 65539
+  %v6 = or i32 %v5, 4101
+  %v7 = add i32 %v6, 13
+  %v8 = xor i32 %v7, 40
+  %v9 = add i32 %v8, 12353
+  %v10 = and i32 %v9, 16777224
+  %v11 = add i32 %v10, 11
+  %v12 = xor i32 %v11, 266
+  %v13 = and i32 %v12, 65547
+  %v14 = or i32 %v13, 4109
+  %v15 = add i32 %v14, 21
+  %v16 = xor i32 %v15, 48
+  %v17 = add i32 %v16, 12361
+  %v18 = and i32 %v17, 16777232
+  %v19 = add i32 %v18, 19
+  %v20 = xor i32 %v19, 274
+  %v21 = and i32 %v20, 65555
+  %v22 = or i32 %v21, 4117
+  %v23 = add i32 %v22, 29
+  %v24 = xor i32 %v23, 56
+  %v25 = add i32 %v24, 12369
+  %v26 = and i32 %v25, 16777240
+  %v27 = add i32 %v26, 27
+  %v28 = xor i32 %v27, 282
+  %v29 = and i32 %v28, 65563
+  %v30 = or i32 %v29, 4125
+  %v31 = add i32 %v30, 37
+  %v32 = xor i32 %v31, 64
+  %v33 = add i32 %v32, 12377
+  %v34 = and i32 %v33, 16777248
+  %v35 = add i32 %v34, 35
+  %v36 = xor i32 %v35, 290
+  %v37 = and i32 %v36, 65571
+  %v38 = or i32 %v37, 4133
+  %v39 = add i32 %v38, 45
+  %v40 = xor i32 %v39, 72
+  %v41 = add i32 %v40, 12385
+  %v42 = and i32 %v41, 16777256
+  %v43 = add i32 %v42, 43
+  %v44 = xor i32 %v43, 298
+  %v45 = and i32 %v44, 65579
+  %v46 = or i32 %v45, 4141
+  %v47 = add i32 %v46, 53
+  %v48 = xor i32 %v47, 80
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain87(i32 %a, i32 %b) {
+  %v1 = and i32 %a, 16777215
+  %v2 = add i32 %v1, 2
+  %v3 = xor i32 %v2, 257
+  %v4 = and i32 %v3, 65538
+  %v5 = or i32 %v4, 4100
+  %v6 = add i32 %v5, 12
+  %v7 = xor i32 %v6, 39
+  %v8 = add i32 %v7, 12352
+  %v9 = and i32 %v8, 16777223
+  %v10 = add i32 %v9, 10
+  %v11 = xor i32 %v10, 265
+  %v12 = and i32 %v11, 65546
+  %v13 = or i32 %v12, 4108
+  %v14 = add i32 %v13, 20
+  %v15 = xor i32 %v14, 47
+  %v16 = add i32 %v15, 12360
+  %v17 = and i32 %v16, 16777231
+  %v18 = add i32 %v17, 18
+  %v19 = xor i32 %v18, 273
+  %v20 = and i32 %v19, 65554
+  %v21 = or i32 %v20, 4116
+  %v22 = add i32 %v21, 28
+  %v23 = xor i32 %v22, 55
+  %v24 = add i32 %v23, 12368
+  %v25 = and i32 %v24, 16777239
+  %v26 = add i32 %v25, 26
+  %v27 = xor i32 %v26, 281
+  %v28 = and i32 %v27, 65562
+  %v29 = or i32 %v28, 4124
+  %v30 = add i32 %v29, 36
+  %v31 = xor i32 %v30, 63
+  %v32 = add i32 %v31, 12376
+  %v33 = and i32 %v32, 16777247
+  %v34 = add i32 %v33, 34
+  %v35 = xor i32 %v34, 289
+  %v36 = and i32 %v35, 65570
+  %v37 = or i32 %v36, 4132
+  %v38 = add i32 %v37, 44
+  %v39 = xor i32 %v38, 71
+  %v40 = add i32 %v39, 12384
+  %v41 = and i32 %v40, 16777255
+  %v42 = add i32 %v41, 42
+  %v43 = xor i32 %v42, 297
+  %v44 = and i32 %v43, 65578
+  %v45 = or i32 %v44, 4140
+  %v46 = add i32 %v45, 52
+  %v47 = xor i32 %v46, 79
+  %v48 = add i32 %v47, 12392
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain88(i32 %a, i32 %b) {
+  %v1 = add i32 %a, 1
+  %v2 = xor i32 %v1, 256
+  %v3 = and i32 %v2, 65537
+  %v4 = or i32 %v3, 4099
+  %v5 = add i32 %v4, 11
+  %v6 = xor i32 %v5, 38
+  %v7 = add i32 %v6, 12351
+  %v8 = and i32 %v7, 16777222
+  %v9 = add i32 %v8, 9
+  %v10 = xor i32 %v9, 264
+  %v11 = and i32 %v10, 65545
+  %v12 = or i32 %v11, 4107
+  %v13 = add i32 %v12, 19
+  %v14 = xor i32 %v13, 46
+  %v15 = add i32 %v14, 12359
+  %v16 = and i32 %v15, 16777230
+  %v17 = add i32 %v16, 17
+  %v18 = xor i32 %v17, 272
+  %v19 = and i32 %v18, 65553
+  %v20 = or i32 %v19, 4115
+  %v21 = add i32 %v20, 27
+  %v22 = xor i32 %v21, 54
+  %v23 = add i32 %v22, 12367
+  %v24 = and i32 %v23, 16777238
+  %v25 = add i32 %v24, 25
+  %v26 = xor i32 %v25, 280
+  %v27 = and i32 %v26, 65561
+  %v28 = or i32 %v27, 4123
+  %v29 = add i32 %v28, 35
+  %v30 = xor i32 %v29, 62
+  %v31 = add i32 %v30, 12375
+  %v32 = and i32 %v31, 16777246
+  %v33 = add i32 %v32, 33
+  %v34 = xor i32 %v33, 288
+  %v35 = and i32 %v34, 65569
+  %v36 = or i32 %v35, 4131
+  %v37 = add i32 %v36, 43
+  %v38 = xor i32 %v37, 70
+  %v39 = add i32 %v38, 12383
+  %v40 = and i32 %v39, 16777254
+  %v41 = add i32 %v40, 41
+  %v42 = xor i32 %v41, 296
+  %v43 = and i32 %v42, 65577
+  %v44 = or i32 %v43, 4139
+  %v45 = add i32 %v44, 51
+  %v46 = xor i32 %v45, 78
+  %v47 = add i32 %v46, 12391
+  %v48 = and i32 %v47, 16777262
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain89(i32 %a, i32 %b) {
+  %v1 = xor i32 %a, 255
+  %v2 = and i32 %v1, 65536
+  %v3 = or i32 %v2, 4098
+  %v4 = add i32 %v3, 10
+  %v5 = xor i32 %v4, 37
+  %v6 = add i32 %v5, 12350
+  %v7 = and i32 %v6, 16777221
+  %v8 = add i32 %v7, 8
+  %v9 = xor i32 %v8, 263
+  %v10 = and i32 %v9, 65544
+  %v11 = or i32 %v10, 4106
+  %v12 = add i32 %v11, 18
+  %v13 = xor i32 %v12, 45
+  %v14 = add i32 %v13, 12358
+  %v15 = and i32 %v14, 16777229
+  %v16 = add i32 %v15, 16
+  %v17 = xor i32 %v16, 271
+  %v18 = and i32 %v17, 65552
+  %v19 = or i32 %v18, 4114
+  %v20 = add i32 %v19, 26
+  %v21 = xor i32 %v20, 53
+  %v22 = add i32 %v21, 12366
+  %v23 = and i32 %v22, 16777237
+  %v24 = add i32 %v23, 24
+  %v25 = xor i32 %v24, 279
+  %v26 = and i32 %v25, 65560
+  %v27 = or i32 %v26, 4122
+  %v28 = add i32 %v27, 34
+  %v29 = xor i32 %v28, 61
+  %v30 = add i32 %v29, 12374
+  %v31 = and i32 %v30, 16777245
+  %v32 = add i32 %v31, 32
+  %v33 = xor i32 %v32, 287
+  %v34 = and i32 %v33, 65568
+  %v35 = or i32 %v34, 4130
+  %v36 = add i32 %v35, 42
+  %v37 = xor i32 %v36, 69
+  %v38 = add i32 %v37, 12382
+  %v39 = and i32 %v38, 16777253
+  %v40 = add i32 %v39, 40
+  %v41 = xor i32 %v40, 295
+  %v42 = and i32 %v41, 65576
+  %v43 = or i32 %v42, 4138
+  %v44 = add i32 %v43, 50
+  %v45 = xor i32 %v44, 77
+  %v46 = add i32 %v45, 12390
+  %v47 = and i32 %v46, 16777261
+  %v48 = add i32 %v47, 48
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain90(i32 %a, i32 %b) {
+  %v1 = and i32 %a, 65535
+  %v2 = or i32 %v1, 4097
+  %v3 = add i32 %v2, 9
+  %v4 = xor i32 %v3, 36
+  %v5 = add i32 %v4, 12349
+  %v6 = and i32 %v5, 16777220
+  %v7 = add i32 %v6, 7
+  %v8 = xor i32 %v7, 262
+  %v9 = and i32 %v8, 65543
+  %v10 = or i32 %v9, 4105
+  %v11 = add i32 %v10, 17
+  %v12 = xor i32 %v11, 44
+  %v13 = add i32 %v12, 12357
+  %v14 = and i32 %v13, 16777228
+  %v15 = add i32 %v14, 15
+  %v16 = xor i32 %v15, 270
+  %v17 = and i32 %v16, 65551
+  %v18 = or i32 %v17, 4113
+  %v19 = add i32 %v18, 25
+  %v20 = xor i32 %v19, 52
+  %v21 = add i32 %v20, 12365
+  %v22 = and i32 %v21, 16777236
+  %v23 = add i32 %v22, 23
+  %v24 = xor i32 %v23, 278
+  %v25 = and i32 %v24, 65559
+  %v26 = or i32 %v25, 4121
+  %v27 = add i32 %v26, 33
+  %v28 = xor i32 %v27, 60
+  %v29 = add i32 %v28, 12373
+  %v30 = and i32 %v29, 16777244
+  %v31 = add i32 %v30, 31
+  %v32 = xor i32 %v31, 286
+  %v33 = and i32 %v32, 65567
+  %v34 = or i32 %v33, 4129
+  %v35 = add i32 %v34, 41
+  %v36 = xor i32 %v35, 68
+  %v37 = add i32 %v36, 12381
+  %v38 = and i32 %v37, 16777252
+  %v39 = add i32 %v38, 39
+  %v40 = xor i32 %v39, 294
+  %v41 = and i32 %v40, 65575
+  %v42 = or i32 %v41, 4137
+  %v43 = add i32 %v42, 49
+  %v44 = xor i32 %v43, 76
+  %v45 = add i32 %v44, 12389
+  %v46 = and i32 %v45, 16777260
+  %v47 = add i32 %v46, 47
+  %v48 = xor i32 %v47, 302
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain91(i32 %a, i32 %b) {
+  %v1 = or i32 %a, 4096
+  %v2 = add i32 %v1, 8
+  %v3 = xor i32 %v2, 35
+  %v4 = add i32 %v3, 12348
+  %v5 = and i32 %v4, 16777219
+  %v6 = add i32 %v5, 6
+  %v7 = xor i32 %v6, 261
+  %v8 = and i32 %v7, 65542
+  %v9 = or i32 %v8, 4104
+  %v10 = add i32 %v9, 16
+  %v11 = xor i32 %v10, 43
+  %v12 = add i32 %v11, 12356
+  %v13 = and i32 %v12, 16777227
+  %v14 = add i32 %v13, 14
+  %v15 = xor i32 %v14, 269
+  %v16 = and i32 %v15, 65550
+  %v17 = or i32 %v16, 4112
+  %v18 = add i32 %v17, 24
+  %v19 = xor i32 %v18, 51
+  %v20 = add i32 %v19, 12364
+  %v21 = and i32 %v20, 16777235
+  %v22 = add i32 %v21, 22
+  %v23 = xor i32 %v22, 277
+  %v24 = and i32 %v23, 65558
+  %v25 = or i32 %v24, 4120
+  %v26 = add i32 %v25, 32
+  %v27 = xor i32 %v26, 59
+  %v28 = add i32 %v27, 12372
+  %v29 = and i32 %v28, 16777243
+  %v30 = add i32 %v29, 30
+  %v31 = xor i32 %v30, 285
+  %v32 = and i32 %v31, 65566
+  %v33 = or i32 %v32, 4128
+  %v34 = add i32 %v33, 40
+  %v35 = xor i32 %v34, 67
+  %v36 = add i32 %v35, 12380
+  %v37 = and i32 %v36, 16777251
+  %v38 = add i32 %v37, 38
+  %v39 = xor i32 %v38, 293
+  %v40 = and i32 %v39, 65574
+  %v41 = or i32 %v40, 4136
+  %v42 = add i32 %v41, 48
+  %v43 = xor i32 %v42, 75
+  %v44 = add i32 %v43, 12388
+  %v45 = and i32 %v44, 16777259
+  %v46 = add i32 %v45, 46
+  %v47 = xor i32 %v46, 301
+  %v48 = and i32 %v47, 65582
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain92(i32 %a, i32 %b) {
+  %v1 = add i32 %a, 7
+  %v2 = xor i32 %v1, 34
+  %v3 = add i32 %v2, 12347
+  %v4 = and i32 %v3, 16777218
+  %v5 = add i32 %v4, 5
+  %v6 = xor i32 %v5, 260
+  %v7 = and i32 %v6, 65541
+  %v8 = or i32 %v7, 4103
+  %v9 = add i32 %v8, 15
+  %v10 = xor i32 %v9, 42
+  %v11 = add i32 %v10, 12355
+  %v12 = and i32 %v11, 16777226
+  %v13 = add i32 %v12, 13
+  %v14 = xor i32 %v13, 268
+  %v15 = and i32 %v14, 65549
+  %v16 = or i32 %v15, 4111
+  %v17 = add i32 %v16, 23
+  %v18 = xor i32 %v17, 50
+  %v19 = add i32 %v18, 12363
+  %v20 = and i32 %v19, 16777234
+  %v21 = add i32 %v20, 21
+  %v22 = xor i32 %v21, 276
+  %v23 = and i32 %v22, 65557
+  %v24 = or i32 %v23, 4119
+  %v25 = add i32 %v24, 31
+  %v26 = xor i32 %v25, 58
+  %v27 = add i32 %v26, 12371
+  %v28 = and i32 %v27, 16777242
+  %v29 = add i32 %v28, 29
+  %v30 = xor i32 %v29, 284
+  %v31 = and i32 %v30, 65565
+  %v32 = or i32 %v31, 4127
+  %v33 = add i32 %v32, 39
+  %v34 = xor i32 %v33, 66
+  %v35 = add i32 %v34, 12379
+  %v36 = and i32 %v35, 16777250
+  %v37 = add i32 %v36, 37
+  %v38 = xor i32 %v37, 292
+  %v39 = and i32 %v38, 65573
+  %v40 = or i32 %v39, 4135
+  %v41 = add i32 %v40, 47
+  %v42 = xor i32 %v41, 74
+  %v43 = add i32 %v42, 12387
+  %v44 = and i32 %v43, 16777258
+  %v45 = add i32 %v44, 45
+  %v46 = xor i32 %v45, 300
+  %v47 = and i32 %v46, 65581
+  %v48 = or i32 %v47, 4143
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain93(i32 %a, i32 %b) {
+  %v1 = xor i32 %a, 33
+  %v2 = add i32 %v1, 12346
+  %v3 = and i32 %v2, 16777217
+  %v4 = add i32 %v3, 4
+  %v5 = xor i32 %v4, 259
+  %v6 = and i32 %v5, 65540
+  %v7 = or i32 %v6, 4102
+  %v8 = add i32 %v7, 14
+  %v9 = xor i32 %v8, 41
+  %v10 = add i32 %v9, 12354
+  %v11 = and i32 %v10, 16777225
+  %v12 = add i32 %v11, 12
+  %v13 = xor i32 %v12, 267
+  %v14 = and i32 %v13, 65548
+  %v15 = or i32 %v14, 4110
+  %v16 = add i32 %v15, 22
+  %v17 = xor i32 %v16, 49
+  %v18 = add i32 %v17, 12362
+  %v19 = and i32 %v18, 16777233
+  %v20 = add i32 %v19, 20
+  %v21 = xor i32 %v20, 275
+  %v22 = and i32 %v21, 65556
+  %v23 = or i32 %v22, 4118
+  %v24 = add i32 %v23, 30
+  %v25 = xor i32 %v24, 57
+  %v26 = add i32 %v25, 12370
+  %v27 = and i32 %v26, 16777241
+  %v28 = add i32 %v27, 28
+  %v29 = xor i32 %v28, 283
+  %v30 = and i32 %v29, 65564
+  %v31 = or i32 %v30, 4126
+  %v32 = add i32 %v31, 38
+  %v33 = xor i32 %v32, 65
+  %v34 = add i32 %v33, 12378
+  %v35 = and i32 %v34, 16777249
+  %v36 = add i32 %v35, 36
+  %v37 = xor i32 %v36, 291
+  %v38 = and i32 %v37, 65572
+  %v39 = or i32 %v38, 4134
+  %v40 = add i32 %v39, 46
+  %v41 = xor i32 %v40, 73
+  %v42 = add i32 %v41, 12386
+  %v43 = and i32 %v42, 16777257
+  %v44 = add i32 %v43, 44
+  %v45 = xor i32 %v44, 299
+  %v46 = and i32 %v45, 65580
+  %v47 = or i32 %v46, 4142
+  %v48 = add i32 %v47, 54
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain94(i32 %a, i32 %b) {
+  %v1 = add i32 %a, 12345
+  %v2 = and i32 %v1, 16777216
+  %v3 = add i32 %v2, 3
+  %v4 = xor i32 %v3, 258
+  %v5 = and i32 %v4, 65539
+  %v6 = or i32 %v5, 4101
+  %v7 = add i32 %v6, 13
+  %v8 = xor i32 %v7, 40
+  %v9 = add i32 %v8, 12353
+  %v10 = and i32 %v9, 16777224
+  %v11 = add i32 %v10, 11
+  %v12 = xor i32 %v11, 266
+  %v13 = and i32 %v12, 65547
+  %v14 = or i32 %v13, 4109
+  %v15 = add i32 %v14, 21
+  %v16 = xor i32 %v15, 48
+  %v17 = add i32 %v16, 12361
+  %v18 = and i32 %v17, 16777232
+  %v19 = add i32 %v18, 19
+  %v20 = xor i32 %v19, 274
+  %v21 = and i32 %v20, 65555
+  %v22 = or i32 %v21, 4117
+  %v23 = add i32 %v22, 29
+  %v24 = xor i32 %v23, 56
+  %v25 = add i32 %v24, 12369
+  %v26 = and i32 %v25, 16777240
+  %v27 = add i32 %v26, 27
+  %v28 = xor i32 %v27, 282
+  %v29 = and i32 %v28, 65563
+  %v30 = or i32 %v29, 4125
+  %v31 = add i32 %v30, 37
+  %v32 = xor i32 %v31, 64
+  %v33 = add i32 %v32, 12377
+  %v34 = and i32 %v33, 16777248
+  %v35 = add i32 %v34, 35
+  %v36 = xor i32 %v35, 290
+  %v37 = and i32 %v36, 65571
+  %v38 = or i32 %v37, 4133
+  %v39 = add i32 %v38, 45
+  %v40 = xor i32 %v39, 72
+  %v41 = add i32 %v40, 12385
+  %v42 = and i32 %v41, 16777256
+  %v43 = add i32 %v42, 43
+  %v44 = xor i32 %v43, 298
+  %v45 = and i32 %v44, 65579
+  %v46 = or i32 %v45, 4141
+  %v47 = add i32 %v46, 53
+  %v48 = xor i32 %v47, 80
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain95(i32 %a, i32 %b) {
+  %v1 = and i32 %a, 16777215
+  %v2 = add i32 %v1, 2
+  %v3 = xor i32 %v2, 257
+  %v4 = and i32 %v3, 65538
+  %v5 = or i32 %v4, 4100
+  %v6 = add i32 %v5, 12
+  %v7 = xor i32 %v6, 39
+  %v8 = add i32 %v7, 12352
+  %v9 = and i32 %v8, 16777223
+  %v10 = add i32 %v9, 10
+  %v11 = xor i32 %v10, 265
+  %v12 = and i32 %v11, 65546
+  %v13 = or i32 %v12, 4108
+  %v14 = add i32 %v13, 20
+  %v15 = xor i32 %v14, 47
+  %v16 = add i32 %v15, 12360
+  %v17 = and i32 %v16, 16777231
+  %v18 = add i32 %v17, 18
+  %v19 = xor i32 %v18, 273
+  %v20 = and i32 %v19, 65554
+  %v21 = or i32 %v20, 4116
+  %v22 = add i32 %v21, 28
+  %v23 = xor i32 %v22, 55
+  %v24 = add i32 %v23, 12368
+  %v25 = and i32 %v24, 16777239
+  %v26 = add i32 %v25, 26
+  %v27 = xor i32 %v26, 281
+  %v28 = and i32 %v27, 65562
+  %v29 = or i32 %v28, 4124
+  %v30 = add i32 %v29, 36
+  %v31 = xor i32 %v30, 63
+  %v32 = add i32 %v31, 12376
+  %v33 = and i32 %v32, 16777247
+  %v34 = add i32 %v33, 34
+  %v35 = xor i32 %v34, 289
+  %v36 = and i32 %v35, 65570
+  %v37 = or i32 %v36, 4132
+  %v38 = add i32 %v37, 44
+  %v39 = xor i32 %v38, 71
+  %v40 = add i32 %v39, 12384
+  %v41 = and i32 %v40, 16777255
+  %v42 = add i32 %v41, 42
+  %v43 = xor i32 %v42, 297
+  %v44 = and i32 %v43, 65578
+  %v45 = or i32 %v44, 4140
+  %v46 = add i32 %v45, 52
+  %v47 = xor i32 %v46, 79
+  %v48 = add i32 %v47, 12392
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain96(i32 %a, i32 %b) {
+  %v1 = add i32 %a, 1
+  %v2 = xor i32 %v1, 256
+  %v3 = and i32 %v2, 65537
+  %v4 = or i32 %v3, 4099
+  %v5 = add i32 %v4, 11
+  %v6 = xor i32 %v5, 38
+  %v7 = add i32 %v6, 12351
+  %v8 = and i32 %v7, 16777222
+  %v9 = add i32 %v8, 9
+  %v10 = xor i32 %v9, 264
+  %v11 = and i32 %v10, 65545
+  %v12 = or i32 %v11, 4107
+  %v13 = add i32 %v12, 19
+  %v14 = xor i32 %v13, 46
+  %v15 = add i32 %v14, 12359
+  %v16 = and i32 %v15, 16777230
+  %v17 = add i32 %v16, 17
+  %v18 = xor i32 %v17, 272
+  %v19 = and i32 %v18, 65553
+  %v20 = or i32 %v19, 4115
+  %v21 = add i32 %v20, 27
+  %v22 = xor i32 %v21, 54
+  %v23 = add i32 %v22, 12367
+  %v24 = and i32 %v23, 16777238
+  %v25 = add i32 %v24, 25
+  %v26 = xor i32 %v25, 280
+  %v27 = and i32 %v26, 65561
+  %v28 = or i32 %v27, 4123
+  %v29 = add i32 %v28, 35
+  %v30 = xor i32 %v29, 62
+  %v31 = add i32 %v30, 12375
+  %v32 = and i32 %v31, 16777246
+  %v33 = add i32 %v32, 33
+  %v34 = xor i32 %v33, 288
+  %v35 = and i32 %v34, 65569
+  %v36 = or i32 %v35, 4131
+  %v37 = add i32 %v36, 43
+  %v38 = xor i32 %v37, 70
+  %v39 = add i32 %v38, 12383
+  %v40 = and i32 %v39, 16777254
+  %v41 = add i32 %v40, 41
+  %v42 = xor i32 %v41, 296
+  %v43 = and i32 %v42, 65577
+  %v44 = or i32 %v43, 4139
+  %v45 = add i32 %v44, 51
+  %v46 = xor i32 %v45, 78
+  %v47 = add i32 %v46, 12391
+  %v48 = and i32 %v47, 16777262
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain97(i32 %a, i32 %b) {
+  %v1 = xor i32 %a, 255
+  %v2 = and i32 %v1, 65536
+  %v3 = or i32 %v2, 4098
+  %v4 = add i32 %v3, 10
+  %v5 = xor i32 %v4, 37
+  %v6 = add i32 %v5, 12350
+  %v7 = and i32 %v6, 16777221
+  %v8 = add i32 %v7, 8
+  %v9 = xor i32 %v8, 263
+  %v10 = and i32 %v9, 65544
+  %v11 = or i32 %v10, 4106
+  %v12 = add i32 %v11, 18
+  %v13 = xor i32 %v12, 45
+  %v14 = add i32 %v13, 12358
+  %v15 = and i32 %v14, 16777229
+  %v16 = add i32 %v15, 16
+  %v17 = xor i32 %v16, 271
+  %v18 = and i32 %v17, 65552
+  %v19 = or i32 %v18, 4114
+  %v20 = add i32 %v19, 26
+  %v21 = xor i32 %v20, 53
+  %v22 = add i32 %v21, 12366
+  %v23 = and i32 %v22, 16777237
+  %v24 = add i32 %v23, 24
+  %v25 = xor i32 %v24, 279
+  %v26 = and i32 %v25, 65560
+  %v27 = or i32 %v26, 4122
+  %v28 = add i32 %v27, 34
+  %v29 = xor i32 %v28, 61
+  %v30 = add i32 %v29, 12374
+  %v31 = and i32 %v30, 16777245
+  %v32 = add i32 %v31, 32
+  %v33 = xor i32 %v32, 287
+  %v34 = and i32 %v33, 65568
+  %v35 = or i32 %v34, 4130
+  %v36 = add i32 %v35, 42
+  %v37 = xor i32 %v36, 69
+  %v38 = add i32 %v37, 12382
+  %v39 = and i32 %v38, 16777253
+  %v40 = add i32 %v39, 40
+  %v41 = xor i32 %v40, 295
+  %v42 = and i32 %v41, 65576
+  %v43 = or i32 %v42, 4138
+  %v44 = add i32 %v43, 50
+  %v45 = xor i32 %v44, 77
+  %v46 = add i32 %v45, 12390
+  %v47 = and i32 %v46, 16777261
+  %v48 = add i32 %v47, 48
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain98(i32 %a, i32 %b) {
+  %v1 = and i32 %a, 65535
+  %v2 = or i32 %v1, 4097
+  %v3 = add i32 %v2, 9
+  %v4 = xor i32 %v3, 36
+  %v5 = add i32 %v4, 12349
+  %v6 = and i32 %v5, 16777220
+  %v7 = add i32 %v6, 7
+  %v8 = xor i32 %v7, 262
+  %v9 = and i32 %v8, 65543
+  %v10 = or i32 %v9, 4105
+  %v11 = add i32 %v10, 17
+  %v12 = xor i32 %v11, 44
+  %v13 = add i32 %v12, 12357
+  %v14 = and i32 %v13, 16777228
+  %v15 = add i32 %v14, 15
+  %v16 = xor i32 %v15, 270
+  %v17 = and i32 %v16, 65551
+  %v18 = or i32 %v17, 4113
+  %v19 = add i32 %v18, 25
+  %v20 = xor i32 %v19, 52
+  %v21 = add i32 %v20, 12365
+  %v22 = and i32 %v21, 16777236
+  %v23 = add i32 %v22, 23
+  %v24 = xor i32 %v23, 278
+  %v25 = and i32 %v24, 65559
+  %v26 = or i32 %v25, 4121
+  %v27 = add i32 %v26, 33
+  %v28 = xor i32 %v27, 60
+  %v29 = add i32 %v28, 12373
+  %v30 = and i32 %v29, 16777244
+  %v31 = add i32 %v30, 31
+  %v32 = xor i32 %v31, 286
+  %v33 = and i32 %v32, 65567
+  %v34 = or i32 %v33, 4129
+  %v35 = add i32 %v34, 41
+  %v36 = xor i32 %v35, 68
+  %v37 = add i32 %v36, 12381
+  %v38 = and i32 %v37, 16777252
+  %v39 = add i32 %v38, 39
+  %v40 = xor i32 %v39, 294
+  %v41 = and i32 %v40, 65575
+  %v42 = or i32 %v41, 4137
+  %v43 = add i32 %v42, 49
+  %v44 = xor i32 %v43, 76
+  %v45 = add i32 %v44, 12389
+  %v46 = and i32 %v45, 16777260
+  %v47 = add i32 %v46, 47
+  %v48 = xor i32 %v47, 302
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain99(i32 %a, i32 %b) {
+  %v1 = or i32 %a, 4096
+  %v2 = add i32 %v1, 8
+  %v3 = xor i32 %v2, 35
+  %v4 = add i32 %v3, 12348
+  %v5 = and i32 %v4, 16777219
+  %v6 = add i32 %v5, 6
+  %v7 = xor i32 %v6, 261
+  %v8 = and i32 %v7, 65542
+  %v9 = or i32 %v8, 4104
+  %v10 = add i32 %v9, 16
+  %v11 = xor i32 %v10, 43
+  %v12 = add i32 %v11, 12356
+  %v13 = and i32 %v12, 16777227
+  %v14 = add i32 %v13, 14
+  %v15 = xor i32 %v14, 269
+  %v16 = and i32 %v15, 65550
+  %v17 = or i32 %v16, 4112
+  %v18 = add i32 %v17, 24
+  %v19 = xor i32 %v18, 51
+  %v20 = add i32 %v19, 12364
+  %v21 = and i32 %v20, 16777235
+  %v22 = add i32 %v21, 22
+  %v23 = xor i32 %v22, 277
+  %v24 = and i32 %v23, 65558
+  %v25 = or i32 %v24, 4120
+  %v26 = add i32 %v25, 32
+  %v27 = xor i32 %v26, 59
+  %v28 = add i32 %v27, 12372
+  %v29 = and i32 %v28, 16777243
+  %v30 = add i32 %v29, 30
+  %v31 = xor i32 %v30, 285
+  %v32 = and i32 %v31, 65566
+  %v33 = or i32 %v32, 4128
+  %v34 = add i32 %v33, 40
+  %v35 = xor i32 %v34, 67
+  %v36 = add i32 %v35, 12380
+  %v37 = and i32 %v36, 16777251
+  %v38 = add i32 %v37, 38
+  %v39 = xor i32 %v38, 293
+  %v40 = and i32 %v39, 65574
+  %v41 = or i32 %v40, 4136
+  %v42 = add i32 %v41, 48
+  %v43 = xor i32 %v42, 75
+  %v44 = add i32 %v43, 12388
+  %v45 = and i32 %v44, 16777259
+  %v46 = add i32 %v45, 46
+  %v47 = xor i32 %v46, 301
+  %v48 = and i32 %v47, 65582
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain100(i32 %a, i32 %b) {
+  %v1 = add i32 %a, 7
+  %v2 = xor i32 %v1, 34
+  %v3 = add i32 %v2, 12347
+  %v4 = and i32 %v3, 16777218
+  %v5 = add i32 %v4, 5
+  %v6 = xor i32 %v5, 260
+  %v7 = and i32 %v6, 65541
+  %v8 = or i32 %v7, 4103
+  %v9 = add i32 %v8, 15
+  %v10 = xor i32 %v9, 42
+  %v11 = add i32 %v10, 12355
+  %v12 = and i32 %v11, 16777226
+  %v13 = add i32 %v12, 13
+  %v14 = xor i32 %v13, 268
+  %v15 = and i32 %v14, 65549
+  %v16 = or i32 %v15, 4111
+  %v17 = add i32 %v16, 23
+  %v18 = xor i32 %v17, 50
+  %v19 = add i32 %v18, 12363
+  %v20 = and i32 %v19, 16777234
+  %v21 = add i32 %v20, 21
+  %v22 = xor i32 %v21, 276
+  %v23 = and i32 %v22, 65557
+  %v24 = or i32 %v23, 4119
+  %v25 = add i32 %v24, 31
+  %v26 = xor i32 %v25, 58
+  %v27 = add i32 %v26, 12371
+  %v28 = and i32 %v27, 16777242
+  %v29 = add i32 %v28, 29
+  %v30 = xor i32 %v29, 284
+  %v31 = and i32 %v30, 65565
+  %v32 = or i32 %v31, 4127
+  %v33 = add i32 %v32, 39
+  %v34 = xor i32 %v33, 66
+  %v35 = add i32 %v34, 12379
+  %v36 = and i32 %v35, 16777250
+  %v37 = add i32 %v36, 37
+  %v38 = xor i32 %v37, 292
+  %v39 = and i32 %v38, 65573
+  %v40 = or i32 %v39, 4135
+  %v41 = add i32 %v40, 47
+  %v42 = xor i32 %v41, 74
+  %v43 = add i32 %v42, 12387
+  %v44 = and i32 %v43, 16777258
+  %v45 = add i32 %v44, 45
+  %v46 = xor i32 %v45, 300
+  %v47 = and i32 %v46, 65581
+  %v48 = or i32 %v47, 4143
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain101(i32 %a, i32 %b) {
+  %v1 = xor i32 %a, 33
+  %v2 = add i32 %v1, 12346
+  %v3 = and i32 %v2, 16777217
+  %v4 = add i32 %v3, 4
+  %v5 = xor i32 %v4, 259
+  %v6 = and i32 %v5, 65540
+  %v7 = or i32 %v6, 4102
+  %v8 = add i32 %v7, 14
+  %v9 = xor i32 %v8, 41
+  %v10 = add i32 %v9, 12354
+  %v11 = and i32 %v10, 16777225
+  %v12 = add i32 %v11, 12
+  %v13 = xor i32 %v12, 267
+  %v14 = and i32 %v13, 65548
+  %v15 = or i32 %v14, 4110
+  %v16 = add i32 %v15, 22
+  %v17 = xor i32 %v16, 49
+  %v18 = add i32 %v17, 12362
+  %v19 = and i32 %v18, 16777233
+  %v20 = add i32 %v19, 20
+  %v21 = xor i32 %v20, 275
+  %v22 = and i32 %v21, 65556
+  %v23 = or i32 %v22, 4118
+  %v24 = add i32 %v23, 30
+  %v25 = xor i32 %v24, 57
+  %v26 = add i32 %v25, 12370
+  %v27 = and i32 %v26, 16777241
+  %v28 = add i32 %v27, 28
+  %v29 = xor i32 %v28, 283
+  %v30 = and i32 %v29, 65564
+  %v31 = or i32 %v30, 4126
+  %v32 = add i32 %v31, 38
+  %v33 = xor i32 %v32, 65
+  %v34 = add i32 %v33, 12378
+  %v35 = and i32 %v34, 16777249
+  %v36 = add i32 %v35, 36
+  %v37 = xor i32 %v36, 291
+  %v38 = and i32 %v37, 65572
+  %v39 = or i32 %v38, 4134
+  %v40 = add i32 %v39, 46
+  %v41 = xor i32 %v40, 73
+  %v42 = add i32 %v41, 12386
+  %v43 = and i32 %v42, 16777257
+  %v44 = add i32 %v43, 44
+  %v45 = xor i32 %v44, 299
+  %v46 = and i32 %v45, 65580
+  %v47 = or i32 %v46, 4142
+  %v48 = add i32 %v47, 54
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain102(i32 %a, i32 %b) {
+  %v1 = add i32 %a, 12345
+  %v2 = and i32 %v1, 16777216
+  %v3 = add i32 %v2, 3
+  %v4 = xor i32 %v3, 258
+  %v5 = and i32 %v4, 65539
+  %v6 = or i32 %v5, 4101
+  %v7 = add i32 %v6, 13
+  %v8 = xor i32 %v7, 40
+  %v9 = add i32 %v8, 12353
+  %v10 = and i32 %v9, 16777224
+  %v11 = add i32 %v10, 11
+  %v12 = xor i32 %v11, 266
+  %v13 = and i32 %v12, 65547
+  %v14 = or i32 %v13, 4109
+  %v15 = add i32 %v14, 21
+  %v16 = xor i32 %v15, 48
+  %v17 = add i32 %v16, 12361
+  %v18 = and i32 %v17, 16777232
+  %v19 = add i32 %v18, 19
+  %v20 = xor i32 %v19, 274
+  %v21 = and i32 %v20, 65555
+  %v22 = or i32 %v21, 4117
+  %v23 = add i32 %v22, 29
+  %v24 = xor i32 %v23, 56
+  %v25 = add i32 %v24, 12369
+  %v26 = and i32 %v25, 16777240
+  %v27 = add i32 %v26, 27
+  %v28 = xor i32 %v27, 282
+  %v29 = and i32 %v28, 65563
+  %v30 = or i32 %v29, 4125
+  %v31 = add i32 %v30, 37
+  %v32 = xor i32 %v31, 64
+  %v33 = add i32 %v32, 12377
+  %v34 = and i32 %v33, 16777248
+  %v35 = add i32 %v34, 35
+  %v36 = xor i32 %v35, 290
+  %v37 = and i32 %v36, 65571
+  %v38 = or i32 %v37, 4133
+  %v39 = add i32 %v38, 45
+  %v40 = xor i32 %v39, 72
+  %v41 = add i32 %v40, 12385
+  %v42 = and i32 %v41, 16777256
+  %v43 = add i32 %v42, 43
+  %v44 = xor i32 %v43, 298
+  %v45 = and i32 %v44, 65579
+  %v46 = or i32 %v45, 4141
+  %v47 = add i32 %v46, 53
+  %v48 = xor i32 %v47, 80
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain103(i32 %a, i32 %b) {
+  %v1 = and i32 %a, 16777215
+  %v2 = add i32 %v1, 2
+  %v3 = xor i32 %v2, 257
+  %v4 = and i32 %v3, 65538
+  %v5 = or i32 %v4, 4100
+  %v6 = add i32 %v5, 12
+  %v7 = xor i32 %v6, 39
+  %v8 = add i32 %v7, 12352
+  %v9 = and i32 %v8, 16777223
+  %v10 = add i32 %v9, 10
+  %v11 = xor i32 %v10, 265
+  %v12 = and i32 %v11, 65546
+  %v13 = or i32 %v12, 4108
+  %v14 = add i32 %v13, 20
+  %v15 = xor i32 %v14, 47
+  %v16 = add i32 %v15, 12360
+  %v17 = and i32 %v16, 16777231
+  %v18 = add i32 %v17, 18
+  %v19 = xor i32 %v18, 273
+  %v20 = and i32 %v19, 65554
+  %v21 = or i32 %v20, 4116
+  %v22 = add i32 %v21, 28
+  %v23 = xor i32 %v22, 55
+  %v24 = add i32 %v23, 12368
+  %v25 = and i32 %v24, 16777239
+  %v26 = add i32 %v25, 26
+  %v27 = xor i32 %v26, 281
+  %v28 = and i32 %v27, 65562
+  %v29 = or i32 %v28, 4124
+  %v30 = add i32 %v29, 36
+  %v31 = xor i32 %v30, 63
+  %v32 = add i32 %v31, 12376
+  %v33 = and i32 %v32, 16777247
+  %v34 = add i32 %v33, 34
+  %v35 = xor i32 %v34, 289
+  %v36 = and i32 %v35, 65570
+  %v37 = or i32 %v36, 4132
+  %v38 = add i32 %v37, 44
+  %v39 = xor i32 %v38, 71
+  %v40 = add i32 %v39, 12384
+  %v41 = and i32 %v40, 16777255
+  %v42 = add i32 %v41, 42
+  %v43 = xor i32 %v42, 297
+  %v44 = and i32 %v43, 65578
+  %v45 = or i32 %v44, 4140
+  %v46 = add i32 %v45, 52
+  %v47 = xor i32 %v46, 79
+  %v48 = add i32 %v47, 12392
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain104(i32 %a, i32 %b) {
+  %v1 = add i32 %a, 1
+  %v2 = xor i32 %v1, 256
+  %v3 = and i32 %v2, 65537
+  %v4 = or i32 %v3, 4099
+  %v5 = add i32 %v4, 11
+  %v6 = xor i32 %v5, 38
+  %v7 = add i32 %v6, 12351
+  %v8 = and i32 %v7, 16777222
+  %v9 = add i32 %v8, 9
+  %v10 = xor i32 %v9, 264
+  %v11 = and i32 %v10, 65545
+  %v12 = or i32 %v11, 4107
+  %v13 = add i32 %v12, 19
+  %v14 = xor i32 %v13, 46
+  %v15 = add i32 %v14, 12359
+  %v16 = and i32 %v15, 16777230
+  %v17 = add i32 %v16, 17
+  %v18 = xor i32 %v17, 272
+  %v19 = and i32 %v18, 65553
+  %v20 = or i32 %v19, 4115
+  %v21 = add i32 %v20, 27
+  %v22 = xor i32 %v21, 54
+  %v23 = add i32 %v22, 12367
+  %v24 = and i32 %v23, 16777238
+  %v25 = add i32 %v24, 25
+  %v26 = xor i32 %v25, 280
+  %v27 = and i32 %v26, 65561
+  %v28 = or i32 %v27, 4123
+  %v29 = add i32 %v28, 35
+  %v30 = xor i32 %v29, 62
+  %v31 = add i32 %v30, 12375
+  %v32 = and i32 %v31, 16777246
+  %v33 = add i32 %v32, 33
+  %v34 = xor i32 %v33, 288
+  %v35 = and i32 %v34, 65569
+  %v36 = or i32 %v35, 4131
+  %v37 = add i32 %v36, 43
+  %v38 = xor i32 %v37, 70
+  %v39 = add i32 %v38, 12383
+  %v40 = and i32 %v39, 16777254
+  %v41 = add i32 %v40, 41
+  %v42 = xor i32 %v41, 296
+  %v43 = and i32 %v42, 65577
+  %v44 = or i32 %v43, 4139
+  %v45 = add i32 %v44, 51
+  %v46 = xor i32 %v45, 78
+  %v47 = add i32 %v46, 12391
+  %v48 = and i32 %v47, 16777262
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain105(i32 %a, i32 %b) {
+  %v1 = xor i32 %a, 255
+  %v2 = and i32 %v1, 65536
+  %v3 = or i32 %v2, 4098
+  %v4 = add i32 %v3, 10
+  %v5 = xor i32 %v4, 37
+  %v6 = add i32 %v5, 12350
+  %v7 = and i32 %v6, 16777221
+  %v8 = add i32 %v7, 8
+  %v9 = xor i32 %v8, 263
+  %v10 = and i32 %v9, 65544
+  %v11 = or i32 %v10, 4106
+  %v12 = add i32 %v11, 18
+  %v13 = xor i32 %v12, 45
+  %v14 = add i32 %v13, 12358
+  %v15 = and i32 %v14, 16777229
+  %v16 = add i32 %v15, 16
+  %v17 = xor i32 %v16, 271
+  %v18 = and i32 %v17, 65552
+  %v19 = or i32 %v18, 4114
+  %v20 = add i32 %v19, 26
+  %v21 = xor i32 %v20, 53
+  %v22 = add i32 %v21, 12366
+  %v23 = and i32 %v22, 16777237
+  %v24 = add i32 %v23, 24
+  %v25 = xor i32 %v24, 279
+  %v26 = and i32 %v25, 65560
+  %v27 = or i32 %v26, 4122
+  %v28 = add i32 %v27, 34
+  %v29 = xor i32 %v28, 61
+  %v30 = add i32 %v29, 12374
+  %v31 = and i32 %v30, 16777245
+  %v32 = add i32 %v31, 32
+  %v33 = xor i32 %v32, 287
+  %v34 = and i32 %v33, 65568
+  %v35 = or i32 %v34, 4130
+  %v36 = add i32 %v35, 42
+  %v37 = xor i32 %v36, 69
+  %v38 = add i32 %v37, 12382
+  %v39 = and i32 %v38, 16777253
+  %v40 = add i32 %v39, 40
+  %v41 = xor i32 %v40, 295
+  %v42 = and i32 %v41, 65576
+  %v43 = or i32 %v42, 4138
+  %v44 = add i32 %v43, 50
+  %v45 = xor i32 %v44, 77
+  %v46 = add i32 %v45, 12390
+  %v47 = and i32 %v46, 16777261
+  %v48 = add i32 %v47, 48
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain106(i32 %a, i32 %b) {
+  %v1 = and i32 %a, 65535
+  %v2 = or i32 %v1, 4097
+  %v3 = add i32 %v2, 9
+  %v4 = xor i32 %v3, 36
+  %v5 = add i32 %v4, 12349
+  %v6 = and i32 %v5, 16777220
+  %v7 = add i32 %v6, 7
+  %v8 = xor i32 %v7, 262
+  %v9 = and i32 %v8, 65543
+  %v10 = or i32 %v9, 4105
+  %v11 = add i32 %v10, 17
+  %v12 = xor i32 %v11, 44
+  %v13 = add i32 %v12, 12357
+  %v14 = and i32 %v13, 16777228
+  %v15 = add i32 %v14, 15
+  %v16 = xor i32 %v15, 270
+  %v17 = and i32 %v16, 65551
+  %v18 = or i32 %v17, 4113
+  %v19 = add i32 %v18, 25
+  %v20 = xor i32 %v19, 52
+  %v21 = add i32 %v20, 12365
+  %v22 = and i32 %v21, 16777236
+  %v23 = add i32 %v22, 23
+  %v24 = xor i32 %v23, 278
+  %v25 = and i32 %v24, 65559
+  %v26 = or i32 %v25, 4121
+  %v27 = add i32 %v26, 33
+  %v28 = xor i32 %v27, 60
+  %v29 = add i32 %v28, 12373
+  %v30 = and i32 %v29, 16777244
+  %v31 = add i32 %v30, 31
+  %v32 = xor i32 %v31, 286
+  %v33 = and i32 %v32, 65567
+  %v34 = or i32 %v33, 4129
+  %v35 = add i32 %v34, 41
+  %v36 = xor i32 %v35, 68
+  %v37 = add i32 %v36, 12381
+  %v38 = and i32 %v37, 16777252
+  %v39 = add i32 %v38, 39
+  %v40 = xor i32 %v39, 294
+  %v41 = and i32 %v40, 65575
+  %v42 = or i32 %v41, 4137
+  %v43 = add i32 %v42, 49
+  %v44 = xor i32 %v43, 76
+  %v45 = add i32 %v44, 12389
+  %v46 = and i32 %v45, 16777260
+  %v47 = add i32 %v46, 47
+  %v48 = xor i32 %v47, 302
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain107(i32 %a, i32 %b) {
+  %v1 = or i32 %a, 4096
+  %v2 = add i32 %v1, 8
+  %v3 = xor i32 %v2, 35
+  %v4 = add i32 %v3, 12348
+  %v5 = and i32 %v4, 16777219
+  %v6 = add i32 %v5, 6
+  %v7 = xor i32 %v6, 261
+  %v8 = and i32 %v7, 65542
+  %v9 = or i32 %v8, 4104
+  %v10 = add i32 %v9, 16
+  %v11 = xor i32 %v10, 43
+  %v12 = add i32 %v11, 12356
+  %v13 = and i32 %v12, 16777227
+  %v14 = add i32 %v13, 14
+  %v15 = xor i32 %v14, 269
+  %v16 = and i32 %v15, 65550
+  %v17 = or i32 %v16, 4112
+  %v18 = add i32 %v17, 24
+  %v19 = xor i32 %v18, 51
+  %v20 = add i32 %v19, 12364
+  %v21 = and i32 %v20, 16777235
+  %v22 = add i32 %v21, 22
+  %v23 = xor i32 %v22, 277
+  %v24 = and i32 %v23, 65558
+  %v25 = or i32 %v24, 4120
+  %v26 = add i32 %v25, 32
+  %v27 = xor i32 %v26, 59
+  %v28 = add i32 %v27, 12372
+  %v29 = and i32 %v28, 16777243
+  %v30 = add i32 %v29, 30
+  %v31 = xor i32 %v30, 285
+  %v32 = and i32 %v31, 65566
+  %v33 = or i32 %v32, 4128
+  %v34 = add i32 %v33, 40
+  %v35 = xor i32 %v34, 67
+  %v36 = add i32 %v35, 12380
+  %v37 = and i32 %v36, 16777251
+  %v38 = add i32 %v37, 38
+  %v39 = xor i32 %v38, 293
+  %v40 = and i32 %v39, 65574
+  %v41 = or i32 %v40, 4136
+  %v42 = add i32 %v41, 48
+  %v43 = xor i32 %v42, 75
+  %v44 = add i32 %v43, 12388
+  %v45 = and i32 %v44, 16777259
+  %v46 = add i32 %v45, 46
+  %v47 = xor i32 %v46, 301
+  %v48 = and i32 %v47, 65582
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain108(i32 %a, i32 %b) {
+  %v1 = add i32 %a, 7
+  %v2 = xor i32 %v1, 34
+  %v3 = add i32 %v2, 12347
+  %v4 = and i32 %v3, 16777218
+  %v5 = add i32 %v4, 5
+  %v6 = xor i32 %v5, 260
+  %v7 = and i32 %v6, 65541
+  %v8 = or i32 %v7, 4103
+  %v9 = add i32 %v8, 15
+  %v10 = xor i32 %v9, 42
+  %v11 = add i32 %v10, 12355
+  %v12 = and i32 %v11, 16777226
+  %v13 = add i32 %v12, 13
+  %v14 = xor i32 %v13, 268
+  %v15 = and i32 %v14, 65549
+  %v16 = or i32 %v15, 4111
+  %v17 = add i32 %v16, 23
+  %v18 = xor i32 %v17, 50
+  %v19 = add i32 %v18, 12363
+  %v20 = and i32 %v19, 16777234
+  %v21 = add i32 %v20, 21
+  %v22 = xor i32 %v21, 276
+  %v23 = and i32 %v22, 65557
+  %v24 = or i32 %v23, 4119
+  %v25 = add i32 %v24, 31
+  %v26 = xor i32 %v25, 58
+  %v27 = add i32 %v26, 12371
+  %v28 = and i32 %v27, 16777242
+  %v29 = add i32 %v28, 29
+  %v30 = xor i32 %v29, 284
+  %v31 = and i32 %v30, 65565
+  %v32 = or i32 %v31, 4127
+  %v33 = add i32 %v32, 39
+  %v34 = xor i32 %v33, 66
+  %v35 = add i32 %v34, 12379
+  %v36 = and i32 %v35, 16777250
+  %v37 = add i32 %v36, 37
+  %v38 = xor i32 %v37, 292
+  %v39 = and i32 %v38, 65573
+  %v40 = or i32 %v39, 4135
+  %v41 = add i32 %v40, 47
+  %v42 = xor i32 %v41, 74
+  %v43 = add i32 %v42, 12387
+  %v44 = and i32 %v43, 16777258
+  %v45 = add i32 %v44, 45
+  %v46 = xor i32 %v45, 300
+  %v47 = and i32 %v46, 65581
+  %v48 = or i32 %v47, 4143
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain109(i32 %a, i32 %b) {
+  %v1 = xor i32 %a, 33
+  %v2 = add i32 %v1, 12346
+  %v3 = and i32 %v2, 16777217
+  %v4 = add i32 %v3, 4
+  %v5 = xor i32 %v4, 259
+  %v6 = and i32 %v5, 65540
+  %v7 = or i32 %v6, 4102
+  %v8 = add i32 %v7, 14
+  %v9 = xor i32 %v8, 41
+  %v10 = add i32 %v9, 12354
+  %v11 = and i32 %v10, 16777225
+  %v12 = add i32 %v11, 12
+  %v13 = xor i32 %v12, 267
+  %v14 = and i32 %v13, 65548
+  %v15 = or i32 %v14, 4110
+  %v16 = add i32 %v15, 22
+  %v17 = xor i32 %v16, 49
+  %v18 = add i32 %v17, 12362
+  %v19 = and i32 %v18, 16777233
+  %v20 = add i32 %v19, 20
+  %v21 = xor i32 %v20, 275
+  %v22 = and i32 %v21, 65556
+  %v23 = or i32 %v22, 4118
+  %v24 = add i32 %v23, 30
+  %v25 = xor i32 %v24, 57
+  %v26 = add i32 %v25, 12370
+  %v27 = and i32 %v26, 16777241
+  %v28 = add i32 %v27, 28
+  %v29 = xor i32 %v28, 283
+  %v30 = and i32 %v29, 65564
+  %v31 = or i32 %v30, 4126
+  %v32 = add i32 %v31, 38
+  %v33 = xor i32 %v32, 65
+  %v34 = add i32 %v33, 12378
+  %v35 = and i32 %v34, 16777249
+  %v36 = add i32 %v35, 36
+  %v37 = xor i32 %v36, 291
+  %v38 = and i32 %v37, 65572
+  %v39 = or i32 %v38, 4134
+  %v40 = add i32 %v39, 46
+  %v41 = xor i32 %v40, 73
+  %v42 = add i32 %v41, 12386
+  %v43 = and i32 %v42, 16777257
+  %v44 = add i32 %v43, 44
+  %v45 = xor i32 %v44, 299
+  %v46 = and i32 %v45, 65580
+  %v47 = or i32 %v46, 4142
+  %v48 = add i32 %v47, 54
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain110(i32 %a, i32 %b) {
+  %v1 = add i32 %a, 12345
+  %v2 = and i32 %v1, 16777216
+  %v3 = add i32 %v2, 3
+  %v4 = xor i32 %v3, 258
+  %v5 = and i32 %v4, 65539
+  %v6 = or i32 %v5, 4101
+  %v7 = add i32 %v6, 13
+  %v8 = xor i32 %v7, 40
+  %v9 = add i32 %v8, 12353
+  %v10 = and i32 %v9, 16777224
+  %v11 = add i32 %v10, 11
+  %v12 = xor i32 %v11, 266
+  %v13 = and i32 %v12, 65547
+  %v14 = or i32 %v13, 4109
+  %v15 = add i32 %v14, 21
+  %v16 = xor i32 %v15, 48
+  %v17 = add i32 %v16, 12361
+  %v18 = and i32 %v17, 16777232
+  %v19 = add i32 %v18, 19
+  %v20 = xor i32 %v19, 274
+  %v21 = and i32 %v20, 65555
+  %v22 = or i32 %v21, 4117
+  %v23 = add i32 %v22, 29
+  %v24 = xor i32 %v23, 56
+  %v25 = add i32 %v24, 12369
+  %v26 = and i32 %v25, 16777240
+  %v27 = add i32 %v26, 27
+  %v28 = xor i32 %v27, 282
+  %v29 = and i32 %v28, 65563
+  %v30 = or i32 %v29, 4125
+  %v31 = add i32 %v30, 37
+  %v32 = xor i32 %v31, 64
+  %v33 = add i32 %v32, 12377
+  %v34 = and i32 %v33, 16777248
+  %v35 = add i32 %v34, 35
+  %v36 = xor i32 %v35, 290
+  %v37 = and i32 %v36, 65571
+  %v38 = or i32 %v37, 4133
+  %v39 = add i32 %v38, 45
+  %v40 = xor i32 %v39, 72
+  %v41 = add i32 %v40, 12385
+  %v42 = and i32 %v41, 16777256
+  %v43 = add i32 %v42, 43
+  %v44 = xor i32 %v43, 298
+  %v45 = and i32 %v44, 65579
+  %v46 = or i32 %v45, 4141
+  %v47 = add i32 %v46, 53
+  %v48 = xor i32 %v47, 80
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain111(i32 %a, i32 %b) {
+  %v1 = and i32 %a, 16777215
+  %v2 = add i32 %v1, 2
+  %v3 = xor i32 %v2, 257
+  %v4 = and i32 %v3, 65538
+  %v5 = or i32 %v4, 4100
+  %v6 = add i32 %v5, 12
+  %v7 = xor i32 %v6, 39
+  %v8 = add i32 %v7, 12352
+  %v9 = and i32 %v8, 16777223
+  %v10 = add i32 %v9, 10
+  %v11 = xor i32 %v10, 265
+  %v12 = and i32 %v11, 65546
+  %v13 = or i32 %v12, 4108
+  %v14 = add i32 %v13, 20
+  %v15 = xor i32 %v14, 47
+  %v16 = add i32 %v15, 12360
+  %v17 = and i32 %v16, 16777231
+  %v18 = add i32 %v17, 18
+  %v19 = xor i32 %v18, 273
+  %v20 = and i32 %v19, 65554
+  %v21 = or i32 %v20, 4116
+  %v22 = add i32 %v21, 28
+  %v23 = xor i32 %v22, 55
+  %v24 = add i32 %v23, 12368
+  %v25 = and i32 %v24, 16777239
+  %v26 = add i32 %v25, 26
+  %v27 = xor i32 %v26, 281
+  %v28 = and i32 %v27, 65562
+  %v29 = or i32 %v28, 4124
+  %v30 = add i32 %v29, 36
+  %v31 = xor i32 %v30, 63
+  %v32 = add i32 %v31, 12376
+  %v33 = and i32 %v32, 16777247
+  %v34 = add i32 %v33, 34
+  %v35 = xor i32 %v34, 289
+  %v36 = and i32 %v35, 65570
+  %v37 = or i32 %v36, 4132
+  %v38 = add i32 %v37, 44
+  %v39 = xor i32 %v38, 71
+  %v40 = add i32 %v39, 12384
+  %v41 = and i32 %v40, 16777255
+  %v42 = add i32 %v41, 42
+  %v43 = xor i32 %v42, 297
+  %v44 = and i32 %v43, 65578
+  %v45 = or i32 %v44, 4140
+  %v46 = add i32 %v45, 52
+  %v47 = xor i32 %v46, 79
+  %v48 = add i32 %v47, 12392
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain112(i32 %a, i32 %b) {
+  %v1 = add i32 %a, 1
+  %v2 = xor i32 %v1, 256
+  %v3 = and i32 %v2, 65537
+  %v4 = or i32 %v3, 4099
+  %v5 = add i32 %v4, 11
+  %v6 = xor i32 %v5, 38
+  %v7 = add i32 %v6, 12351
+  %v8 = and i32 %v7, 16777222
+  %v9 = add i32 %v8, 9
+  %v10 = xor i32 %v9, 264
+  %v11 = and i32 %v10, 65545
+  %v12 = or i32 %v11, 4107
+  %v13 = add i32 %v12, 19
+  %v14 = xor i32 %v13, 46
+  %v15 = add i32 %v14, 12359
+  %v16 = and i32 %v15, 16777230
+  %v17 = add i32 %v16, 17
+  %v18 = xor i32 %v17, 272
+  %v19 = and i32 %v18, 65553
+  %v20 = or i32 %v19, 4115
+  %v21 = add i32 %v20, 27
+  %v22 = xor i32 %v21, 54
+  %v23 = add i32 %v22, 12367
+  %v24 = and i32 %v23, 16777238
+  %v25 = add i32 %v24, 25
+  %v26 = xor i32 %v25, 280
+  %v27 = and i32 %v26, 65561
+  %v28 = or i32 %v27, 4123
+  %v29 = add i32 %v28, 35
+  %v30 = xor i32 %v29, 62
+  %v31 = add i32 %v30, 12375
+  %v32 = and i32 %v31, 16777246
+  %v33 = add i32 %v32, 33
+  %v34 = xor i32 %v33, 288
+  %v35 = and i32 %v34, 65569
+  %v36 = or i32 %v35, 4131
+  %v37 = add i32 %v36, 43
+  %v38 = xor i32 %v37, 70
+  %v39 = add i32 %v38, 12383
+  %v40 = and i32 %v39, 16777254
+  %v41 = add i32 %v40, 41
+  %v42 = xor i32 %v41, 296
+  %v43 = and i32 %v42, 65577
+  %v44 = or i32 %v43, 4139
+  %v45 = add i32 %v44, 51
+  %v46 = xor i32 %v45, 78
+  %v47 = add i32 %v46, 12391
+  %v48 = and i32 %v47, 16777262
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain113(i32 %a, i32 %b) {
+  %v1 = xor i32 %a, 255
+  %v2 = and i32 %v1, 65536
+  %v3 = or i32 %v2, 4098
+  %v4 = add i32 %v3, 10
+  %v5 = xor i32 %v4, 37
+  %v6 = add i32 %v5, 12350
+  %v7 = and i32 %v6, 16777221
+  %v8 = add i32 %v7, 8
+  %v9 = xor i32 %v8, 263
+  %v10 = and i32 %v9, 65544
+  %v11 = or i32 %v10, 4106
+  %v12 = add i32 %v11, 18
+  %v13 = xor i32 %v12, 45
+  %v14 = add i32 %v13, 12358
+  %v15 = and i32 %v14, 16777229
+  %v16 = add i32 %v15, 16
+  %v17 = xor i32 %v16, 271
+  %v18 = and i32 %v17, 65552
+  %v19 = or i32 %v18, 4114
+  %v20 = add i32 %v19, 26
+  %v21 = xor i32 %v20, 53
+  %v22 = add i32 %v21, 12366
+  %v23 = and i32 %v22, 16777237
+  %v24 = add i32 %v23, 24
+  %v25 = xor i32 %v24, 279
+  %v26 = and i32 %v25, 65560
+  %v27 = or i32 %v26, 4122
+  %v28 = add i32 %v27, 34
+  %v29 = xor i32 %v28, 61
+  %v30 = add i32 %v29, 12374
+  %v31 = and i32 %v30, 16777245
+  %v32 = add i32 %v31, 32
+  %v33 = xor i32 %v32, 287
+  %v34 = and i32 %v33, 65568
+  %v35 = or i32 %v34, 4130
+  %v36 = add i32 %v35, 42
+  %v37 = xor i32 %v36, 69
+  %v38 = add i32 %v37, 12382
+  %v39 = and i32 %v38, 16777253
+  %v40 = add i32 %v39, 40
+  %v41 = xor i32 %v40, 295
+  %v42 = and i32 %v41, 65576
+  %v43 = or i32 %v42, 4138
+  %v44 = add i32 %v43, 50
+  %v45 = xor i32 %v44, 77
+  %v46 = add i32 %v45, 12390
+  %v47 = and i32 %v46, 16777261
+  %v48 = add i32 %v47, 48
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain114(i32 %a, i32 %b) {
+  %v1 = and i32 %a, 65535
+  %v2 = or i32 %v1, 4097
+  %v3 = add i32 %v2, 9
+  %v4 = xor i32 %v3, 36
+  %v5 = add i32 %v4, 12349
+  %v6 = and i32 %v5, 16777220
+  %v7 = add i32 %v6, 7
+  %v8 = xor i32 %v7, 262
+  %v9 = and i32 %v8, 65543
+  %v10 = or i32 %v9, 4105
+  %v11 = add i32 %v10, 17
+  %v12 = xor i32 %v11, 44
+  %v13 = add i32 %v12, 12357
+  %v14 = and i32 %v13, 16777228
+  %v15 = add i32 %v14, 15
+  %v16 = xor i32 %v15, 270
+  %v17 = and i32 %v16, 65551
+  %v18 = or i32 %v17, 4113
+  %v19 = add i32 %v18, 25
+  %v20 = xor i32 %v19, 52
+  %v21 = add i32 %v20, 12365
+  %v22 = and i32 %v21, 16777236
+  %v23 = add i32 %v22, 23
+  %v24 = xor i32 %v23, 278
+  %v25 = and i32 %v24, 65559
+  %v26 = or i32 %v25, 4121
+  %v27 = add i32 %v26, 33
+  %v28 = xor i32 %v27, 60
+  %v29 = add i32 %v28, 12373
+  %v30 = and i32 %v29, 16777244
+  %v31 = add i32 %v30, 31
+  %v32 = xor i32 %v31, 286
+  %v33 = and i32 %v32, 65567
+  %v34 = or i32 %v33, 4129
+  %v35 = add i32 %v34, 41
+  %v36 = xor i32 %v35, 68
+  %v37 = add i32 %v36, 12381
+  %v38 = and i32 %v37, 16777252
+  %v39 = add i32 %v38, 39
+  %v40 = xor i32 %v39, 294
+  %v41 = and i32 %v40, 65575
+  %v42 = or i32 %v41, 4137
+  %v43 = add i32 %v42, 49
+  %v44 = xor i32 %v43, 76
+  %v45 = add i32 %v44, 12389
+  %v46 = and i32 %v45, 16777260
+  %v47 = add i32 %v46, 47
+  %v48 = xor i32 %v47, 302
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain115(i32 %a, i32 %b) {
+  %v1 = or i32 %a, 4096
+  %v2 = add i32 %v1, 8
+  %v3 = xor i32 %v2, 35
+  %v4 = add i32 %v3, 12348
+  %v5 = and i32 %v4, 16777219
+  %v6 = add i32 %v5, 6
+  %v7 = xor i32 %v6, 261
+  %v8 = and i32 %v7, 65542
+  %v9 = or i32 %v8, 4104
+  %v10 = add i32 %v9, 16
+  %v11 = xor i32 %v10, 43
+  %v12 = add i32 %v11, 12356
+  %v13 = and i32 %v12, 16777227
+  %v14 = add i32 %v13, 14
+  %v15 = xor i32 %v14, 269
+  %v16 = and i32 %v15, 65550
+  %v17 = or i32 %v16, 4112
+  %v18 = add i32 %v17, 24
+  %v19 = xor i32 %v18, 51
+  %v20 = add i32 %v19, 12364
+  %v21 = and i32 %v20, 16777235
+  %v22 = add i32 %v21, 22
+  %v23 = xor i32 %v22, 277
+  %v24 = and i32 %v23, 65558
+  %v25 = or i32 %v24, 4120
+  %v26 = add i32 %v25, 32
+  %v27 = xor i32 %v26, 59
+  %v28 = add i32 %v27, 12372
+  %v29 = and i32 %v28, 16777243
+  %v30 = add i32 %v29, 30
+  %v31 = xor i32 %v30, 285
+  %v32 = and i32 %v31, 65566
+  %v33 = or i32 %v32, 4128
+  %v34 = add i32 %v33, 40
+  %v35 = xor i32 %v34, 67
+  %v36 = add i32 %v35, 12380
+  %v37 = and i32 %v36, 16777251
+  %v38 = add i32 %v37, 38
+  %v39 = xor i32 %v38, 293
+  %v40 = and i32 %v39, 65574
+  %v41 = or i32 %v40, 4136
+  %v42 = add i32 %v41, 48
+  %v43 = xor i32 %v42, 75
+  %v44 = add i32 %v43, 12388
+  %v45 = and i32 %v44, 16777259
+  %v46 = add i32 %v45, 46
+  %v47 = xor i32 %v46, 301
+  %v48 = and i32 %v47, 65582
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain116(i32 %a, i32 %b) {
+  %v1 = add i32 %a, 7
+  %v2 = xor i32 %v1, 34
+  %v3 = add i32 %v2, 12347
+  %v4 = and i32 %v3, 16777218
+  %v5 = add i32 %v4, 5
+  %v6 = xor i32 %v5, 260
+  %v7 = and i32 %v6, 65541
+  %v8 = or i32 %v7, 4103
+  %v9 = add i32 %v8, 15
+  %v10 = xor i32 %v9, 42
+  %v11 = add i32 %v10, 12355
+  %v12 = and i32 %v11, 16777226
+  %v13 = add i32 %v12, 13
+  %v14 = xor i32 %v13, 268
+  %v15 = and i32 %v14, 65549
+  %v16 = or i32 %v15, 4111
+  %v17 = add i32 %v16, 23
+  %v18 = xor i32 %v17, 50
+  %v19 = add i32 %v18, 12363
+  %v20 = and i32 %v19, 16777234
+  %v21 = add i32 %v20, 21
+  %v22 = xor i32 %v21, 276
+  %v23 = and i32 %v22, 65557
+  %v24 = or i32 %v23, 4119
+  %v25 = add i32 %v24, 31
+  %v26 = xor i32 %v25, 58
+  %v27 = add i32 %v26, 12371
+  %v28 = and i32 %v27, 16777242
+  %v29 = add i32 %v28, 29
+  %v30 = xor i32 %v29, 284
+  %v31 = and i32 %v30, 65565
+  %v32 = or i32 %v31, 4127
+  %v33 = add i32 %v32, 39
+  %v34 = xor i32 %v33, 66
+  %v35 = add i32 %v34, 12379
+  %v36 = and i32 %v35, 16777250
+  %v37 = add i32 %v36, 37
+  %v38 = xor i32 %v37, 292
+  %v39 = and i32 %v38, 65573
+  %v40 = or i32 %v39, 4135
+  %v41 = add i32 %v40, 47
+  %v42 = xor i32 %v41, 74
+  %v43 = add i32 %v42, 12387
+  %v44 = and i32 %v43, 16777258
+  %v45 = add i32 %v44, 45
+  %v46 = xor i32 %v45, 300
+  %v47 = and i32 %v46, 65581
+  %v48 = or i32 %v47, 4143
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain117(i32 %a, i32 %b) {
+  %v1 = xor i32 %a, 33
+  %v2 = add i32 %v1, 12346
+  %v3 = and i32 %v2, 16777217
+  %v4 = add i32 %v3, 4
+  %v5 = xor i32 %v4, 259
+  %v6 = and i32 %v5, 65540
+  %v7 = or i32 %v6, 4102
+  %v8 = add i32 %v7, 14
+  %v9 = xor i32 %v8, 41
+  %v10 = add i32 %v9, 12354
+  %v11 = and i32 %v10, 16777225
+  %v12 = add i32 %v11, 12
+  %v13 = xor i32 %v12, 267
+  %v14 = and i32 %v13, 65548
+  %v15 = or i32 %v14, 4110
+  %v16 = add i32 %v15, 22
+  %v17 = xor i32 %v16, 49
+  %v18 = add i32 %v17, 12362
+  %v19 = and i32 %v18, 16777233
+  %v20 = add i32 %v19, 20
+  %v21 = xor i32 %v20, 275
+  %v22 = and i32 %v21, 65556
+  %v23 = or i32 %v22, 4118
+  %v24 = add i32 %v23, 30
+  %v25 = xor i32 %v24, 57
+  %v26 = add i32 %v25, 12370
+  %v27 = and i32 %v26, 16777241
+  %v28 = add i32 %v27, 28
+  %v29 = xor i32 %v28, 283
+  %v30 = and i32 %v29, 65564
+  %v31 = or i32 %v30, 4126
+  %v32 = add i32 %v31, 38
+  %v33 = xor i32 %v32, 65
+  %v34 = add i32 %v33, 12378
+  %v35 = and i32 %v34, 16777249
+  %v36 = add i32 %v35, 36
+  %v37 = xor i32 %v36, 291
+  %v38 = and i32 %v37, 65572
+  %v39 = or i32 %v38, 4134
+  %v40 = add i32 %v39, 46
+  %v41 = xor i32 %v40, 73
+  %v42 = add i32 %v41, 12386
+  %v43 = and i32 %v42, 16777257
+  %v44 = add i32 %v43, 44
+  %v45 = xor i32 %v44, 299
+  %v46 = and i32 %v45, 65580
+  %v47 = or i32 %v46, 4142
+  %v48 = add i32 %v47, 54
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain118(i32 %a, i32 %b) {
+  %v1 = add i32 %a, 12345
+  %v2 = and i32 %v1, 16777216
+  %v3 = add i32 %v2, 3
+  %v4 = xor i32 %v3, 258
+  %v5 = and i32 %v4, 65539
+  %v6 = or i32 %v5, 4101
+  %v7 = add i32 %v6, 13
+  %v8 = xor i32 %v7, 40
+  %v9 = add i32 %v8, 12353
+  %v10 = and i32 %v9, 16777224
+  %v11 = add i32 %v10, 11
+  %v12 = xor i32 %v11, 266
+  %v13 = and i32 %v12, 65547
+  %v14 = or i32 %v13, 4109
+  %v15 = add i32 %v14, 21
+  %v16 = xor i32 %v15, 48
+  %v17 = add i32 %v16, 12361
+  %v18 = and i32 %v17, 16777232
+  %v19 = add i32 %v18, 19
+  %v20 = xor i32 %v19, 274
+  %v21 = and i32 %v20, 65555
+  %v22 = or i32 %v21, 4117
+  %v23 = add i32 %v22, 29
+  %v24 = xor i32 %v23, 56
+  %v25 = add i32 %v24, 12369
+  %v26 = and i32 %v25, 16777240
+  %v27 = add i32 %v26, 27
+  %v28 = xor i32 %v27, 282
+  %v29 = and i32 %v28, 65563
+  %v30 = or i32 %v29, 4125
+  %v31 = add i32 %v30, 37
+  %v32 = xor i32 %v31, 64
+  %v33 = add i32 %v32, 12377
+  %v34 = and i32 %v33, 16777248
+  %v35 = add i32 %v34, 35
+  %v36 = xor i32 %v35, 290
+  %v37 = and i32 %v36, 65571
+  %v38 = or i32 %v37, 4133
+  %v39 = add i32 %v38, 45
+  %v40 = xor i32 %v39, 72
+  %v41 = add i32 %v40, 12385
+  %v42 = and i32 %v41, 16777256
+  %v43 = add i32 %v42, 43
+  %v44 = xor i32 %v43, 298
+  %v45 = and i32 %v44, 65579
+  %v46 = or i32 %v45, 4141
+  %v47 = add i32 %v46, 53
+  %v48 = xor i32 %v47, 80
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
+
+define i32 @chain119(i32 %a, i32 %b) {
+  %v1 = and i32 %a, 16777215
+  %v2 = add i32 %v1, 2
+  %v3 = xor i32 %v2, 257
+  %v4 = and i32 %v3, 65538
+  %v5 = or i32 %v4, 4100
+  %v6 = add i32 %v5, 12
+  %v7 = xor i32 %v6, 39
+  %v8 = add i32 %v7, 12352
+  %v9 = and i32 %v8, 16777223
+  %v10 = add i32 %v9, 10
+  %v11 = xor i32 %v10, 265
+  %v12 = and i32 %v11, 65546
+  %v13 = or i32 %v12, 4108
+  %v14 = add i32 %v13, 20
+  %v15 = xor i32 %v14, 47
+  %v16 = add i32 %v15, 12360
+  %v17 = and i32 %v16, 16777231
+  %v18 = add i32 %v17, 18
+  %v19 = xor i32 %v18, 273
+  %v20 = and i32 %v19, 65554
+  %v21 = or i32 %v20, 4116
+  %v22 = add i32 %v21, 28
+  %v23 = xor i32 %v22, 55
+  %v24 = add i32 %v23, 12368
+  %v25 = and i32 %v24, 16777239
+  %v26 = add i32 %v25, 26
+  %v27 = xor i32 %v26, 281
+  %v28 = and i32 %v27, 65562
+  %v29 = or i32 %v28, 4124
+  %v30 = add i32 %v29, 36
+  %v31 = xor i32 %v30, 63
+  %v32 = add i32 %v31, 12376
+  %v33 = and i32 %v32, 16777247
+  %v34 = add i32 %v33, 34
+  %v35 = xor i32 %v34, 289
+  %v36 = and i32 %v35, 65570
+  %v37 = or i32 %v36, 4132
+  %v38 = add i32 %v37, 44
+  %v39 = xor i32 %v38, 71
+  %v40 = add i32 %v39, 12384
+  %v41 = and i32 %v40, 16777255
+  %v42 = add i32 %v41, 42
+  %v43 = xor i32 %v42, 297
+  %v44 = and i32 %v43, 65578
+  %v45 = or i32 %v44, 4140
+  %v46 = add i32 %v45, 52
+  %v47 = xor i32 %v46, 79
+  %v48 = add i32 %v47, 12392
+  %v49 = add i32 %v48, %b
+  ret i32 %v49
+}
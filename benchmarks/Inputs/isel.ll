@@ -0,0 +1,2103 @@
+; Input corpus for the check-perf 'isel' benchmark: loop kernels mixing
+; address arithmetic, memory traffic and integer math, compiled with
+; llc -O2. Deliberately repetitive.
+
+define i32 @kernel0(i32* %a, i32* %b, i32* %out, i32 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %loop ]
+  %acc = phi i32 [ 0, %entry ], [ %acc2, %loop ]
+  %pa = getelementptr inbounds i32, i32* %a, i32 %i
+  %va = load i32, i32* %pa
+  %pb = getelementptr inbounds i32, i32* %b, i32 %i
+  %vb = load i32, i32* %pb
+  %m = mul i32 %va, %vb
+  %po = getelementptr inbounds i32, i32* %out, i32 %i
+  store i32 %m, i32* %po
+  %acc2 = add i32 %acc, %m
+  %inc = add nuw nsw i32 %i, 1
+  %cmp = icmp slt i32 %inc, %n
+  br i1 %cmp, label %loop, label %exit
+exit:
+  ret i32 %acc2
+}
+
+define i32 @kernel1(i32* %a, i32* %b, i32* %out, i32 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %loop ]
+  %acc = phi i32 [ 0, %entry ], [ %acc2, %loop ]
+  %pa = getelementptr inbounds i32, i32* %a, i32 %i
+  %va = load i32, i32* %pa
+  %pb = getelementptr inbounds i32, i32* %b, i32 %i
+  %vb = load i32, i32* %pb
+  %m = add i32 %va, %vb
+  %po = getelementptr inbounds i32, i32* %out, i32 %i
+  store i32 %m, i32* %po
+  %acc2 = or i32 %acc, %m
+  %inc = add nuw nsw i32 %i, 1
+  %cmp = icmp slt i32 %inc, %n
+  br i1 %cmp, label %loop, label %exit
+exit:
+  ret i32 %acc2
+}
+
+define i32 @kernel2(i32* %a, i32* %b, i32* %out, i32 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %loop ]
+  %acc = phi i32 [ 0, %entry ], [ %acc2, %loop ]
+  %pa = getelementptr inbounds i32, i32* %a, i32 %i
+  %va = load i32, i32* %pa
+  %pb = getelementptr inbounds i32, i32* %b, i32 %i
+  %vb = load i32, i32* %pb
+  %m = xor i32 %va, %vb
+  %po = getelementptr inbounds i32, i32* %out, i32 %i
+  store i32 %m, i32* %po
+  %acc2 = sub i32 %acc, %m
+  %inc = add nuw nsw i32 %i, 1
+  %cmp = icmp slt i32 %inc, %n
+  br i1 %cmp, label %loop, label %exit
+exit:
+  ret i32 %acc2
+}
+
+define i32 @kernel3(i32* %a, i32* %b, i32* %out, i32 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %loop ]
+  %acc = phi i32 [ 0, %entry ], [ %acc2, %loop ]
+  %pa = getelementptr inbounds i32, i32* %a, i32 %i
+  %va = load i32, i32* %pa
+  %pb = getelementptr inbounds i32, i32* %b, i32 %i
+  %vb = load i32, i32* %pb
+  %m = and i32 %va, %vb
+  %po = getelementptr inbounds i32, i32* %out, i32 %i
+  store i32 %m, i32* %po
+  %acc2 = xor i32 %acc, %m
+  %inc = add nuw nsw i32 %i, 1
+  %cmp = icmp slt i32 %inc, %n
+  br i1 %cmp, label %loop, label %exit
+exit:
+  ret i32 %acc2
+}
+
+define i32 @kernel4(i32* %a, i32* %b, i32* %out, i32 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %loop ]
+  %acc = phi i32 [ 0, %entry ], [ %acc2, %loop ]
+  %pa = getelementptr inbounds i32, i32* %a, i32 %i
+  %va = load i32, i32* %pa
+  %pb = getelementptr inbounds i32, i32* %b, i32 %i
+  %vb = load i32, i32* %pb
+  %m = mul i32 %va, %vb
+  %po = getelementptr inbounds i32, i32* %out, i32 %i
+  store i32 %m, i32* %po
+  %acc2 = add i32 %acc, %m
+  %inc = add nuw nsw i32 %i, 1
+  %cmp = icmp slt i32 %inc, %n
+  br i1 %cmp, label %loop, label %exit
+exit:
+  ret i32 %acc2
+}
+
+define i32 @kernel5(i32* %a, i32* %b, i32* %out, i32 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %loop ]
+  %acc = phi i32 [ 0, %entry ], [ %acc2, %loop ]
+  %pa = getelementptr inbounds i32, i32* %a, i32 %i
+  %va = load i32, i32* %pa
+  %pb = getelementptr inbounds i32, i32* %b, i32 %i
+  %vb = load i32, i32* %pb
+  %m = add i32 %va, %vb
+  %po = getelementptr inbounds i32, i32* %out, i32 %i
+  store i32 %m, i32* %po
+  %acc2 = or i32 %acc, %m
+  %inc = add nuw nsw i32 %i, 1
+  %cmp = icmp slt i32 %inc, %n
+  br i1 %cmp, label %loop, label %exit
+exit:
+  ret i32 %acc2
+}
+
+define i32 @kernel6(i32* %a, i32* %b, i32* %out, i32 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %loop ]
+  %acc = phi i32 [ 0, %entry ], [ %acc2, %loop ]
+  %pa = getelementptr inbounds i32, i32* %a, i32 %i
+  %va = load i32, i32* %pa
+  %pb = getelementptr inbounds i32, i32* %b, i32 %i
+  %vb = load i32, i32* %pb
+  %m = xor i32 %va, %vb
+  %po = getelementptr inbounds i32, i32* %out, i32 %i
+  store i32 %m, i32* %po
+  %acc2 = sub i32 %acc, %m
+  %inc = add nuw nsw i32 %i, 1
+  %cmp = icmp slt i32 %inc, %n
+  br i1 %cmp, label %loop, label %exit
+exit:
+  ret i32 %acc2
+}
+
+define i32 @kernel7(i32* %a, i32* %b, i32* %out, i32 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %loop ]
+  %acc = phi i32 [ 0, %entry ], [ %acc2, %loop ]
+  %pa = getelementptr inbounds i32, i32* %a, i32 %i
+  %va = load i32, i32* %pa
+  %pb = getelementptr inbounds i32, i32* %b, i32 %i
+  %vb = load i32, i32* %pb
+  %m = and i32 %va, %vb
+  %po = getelementptr inbounds i32, i32* %out, i32 %i
+  store i32 %m, i32* %po
+  %acc2 = xor i32 %acc, %m
+  %inc = add nuw nsw i32 %i, 1
+  %cmp = icmp slt i32 %inc, %n
+  br i1 %cmp, label %loop, label %exit
+exit:
+  ret i32 %acc2
+}
+
+define i32 @kernel8(i32* %a, i32* %b, i32* %out, i32 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %loop ]
+  %acc = phi i32 [ 0, %entry ], [ %acc2, %loop ]
+  %pa = getelementptr inbounds i32, i32* %a, i32 %i
+  %va = load i32, i32* %pa
+  %pb = getelementptr inbounds i32, i32* %b, i32 %i
+  %vb = load i32, i32* %pb
+  %m = mul i32 %va, %vb
+  %po = getelementptr inbounds i32, i32* %out, i32 %i
+  store i32 %m, i32* %po
+  %acc2 = add i32 %acc, %m
+  %inc = add nuw nsw i32 %i, 1
+  %cmp = icmp slt i32 %inc, %n
+  br i1 %cmp, label %loop, label %exit
+exit:
+  ret i32 %acc2
+}
+
+define i32 @kernel9(i32* %a, i32* %b, i32* %out, i32 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %loop ]
+  %acc = phi i32 [ 0, %entry ], [ %acc2, %loop ]
+  %pa = getelementptr inbounds i32, i32* %a, i32 %i
+  %va = load i32, i32* %pa
+  %pb = getelementptr inbounds i32, i32* %b, i32 %i
+  %vb = load i32, i32* %pb
+  %m = add i32 %va, %vb
+  %po = getelementptr inbounds i32, i32* %out, i32 %i
+  store i32 %m, i32* %po
+  %acc2 = or i32 %acc, %m
+  %inc = add nuw nsw i32 %i, 1
+  %cmp = icmp slt i32 %inc, %n
+  br i1 %cmp, label %loop, label %exit
+exit:
+  ret i32 %acc2
+}
+
+define i32 @kernel10(i32* %a, i32* %b, i32* %out, i32 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %loop ]
+  %acc = phi i32 [ 0, %entry ], [ %acc2, %loop ]
+  %pa = getelementptr inbounds i32, i32* %a, i32 %i
+  %va = load i32, i32* %pa
+  %pb = getelementptr inbounds i32, i32* %b, i32 %i
+  %vb = load i32, i32* %pb
+  %m = xor i32 %va, %vb
+  %po = getelementptr inbounds i32, i32* %out, i32 %i
+  store i32 %m, i32* %po
+  %acc2 = sub i32 %acc, %m
+  %inc = add nuw nsw i32 %i, 1
+  %cmp = icmp slt i32 %inc, %n
+  br i1 %cmp, label %loop, label %exit
+exit:
+  ret i32 %acc2
+}
+
+define i32 @kernel11(i32* %a, i32* %b, i32* %out, i32 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %loop ]
+  %acc = phi i32 [ 0, %entry ], [ %acc2, %loop ]
+  %pa = getelementptr inbounds i32, i32* %a, i32 %i
+  %va = load i32, i32* %pa
+  %pb = getelementptr inbounds i32, i32* %b, i32 %i
+  %vb = load i32, i32* %pb
+  %m = and i32 %va, %vb
+  %po = getelementptr inbounds i32, i32* %out, i32 %i
+  store i32 %m, i32* %po
+  %acc2 = xor i32 %acc, %m
+  %inc = add nuw nsw i32 %i, 1
+  %cmp = icmp slt i32 %inc, %n
+  br i1 %cmp, label %loop, label %exit
+exit:
+  ret i32 %acc2
+}
+
+define i32 @kernel12(i32* %a, i32* %b, i32* %out, i32 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %loop ]
+  %acc = phi i32 [ 0, %entry ], [ %acc2, %loop ]
+  %pa = getelementptr inbounds i32, i32* %a, i32 %i
+  %va = load i32, i32* %pa
+  %pb = getelementptr inbounds i32, i32* %b, i32 %i
+  %vb = load i32, i32* %pb
+  %m = mul i32 %va, %vb
+  %po = getelementptr inbounds i32, i32* %out, i32 %i
+  store i32 %m, i32* %po
+  %acc2 = add i32 %acc, %m
+  %inc = add nuw nsw i32 %i, 1
+  %cmp = icmp slt i32 %inc, %n
+  br i1 %cmp, label %loop, label %exit
+exit:
+  ret i32 %acc2
+}
+
+define i32 @kernel13(i32* %a, i32* %b, i32* %out, i32 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %loop ]
+  %acc = phi i32 [ 0, %entry ], [ %acc2, %loop ]
+  %pa = getelementptr inbounds i32, i32* %a, i32 %i
+  %va = load i32, i32* %pa
+  %pb = getelementptr inbounds i32, i32* %b, i32 %i
+  %vb = load i32, i32* %pb
+  %m = add i32 %va, %vb
+  %po = getelementptr inbounds i32, i32* %out, i32 %i
+  store i32 %m, i32* %po
+  %acc2 = or i32 %acc, %m
+  %inc = add nuw nsw i32 %i, 1
+  %cmp = icmp slt i32 %inc, %n
+  br i1 %cmp, label %loop, label %exit
+exit:
+  ret i32 %acc2
+}
+
+define i32 @kernel14(i32* %a, i32* %b, i32* %out, i32 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %loop ]
+  %acc = phi i32 [ 0, %entry ], [ %acc2, %loop ]
+  %pa = getelementptr inbounds i32, i32* %a, i32 %i
+  %va = load i32, i32* %pa
+  %pb = getelementptr inbounds i32, i32* %b, i32 %i
+  %vb = load i32, i32* %pb
+  %m = xor i32 %va, %vb
+  %po = getelementptr inbounds i32, i32* %out, i32 %i
+  store i32 %m, i32* %po
+  %acc2 = sub i32 %acc, %m
+  %inc = add nuw nsw i32 %i, 1
+  %cmp = icmp slt i32 %inc, %n
+  br i1 %cmp, label %loop, label %exit
+exit:
+  ret i32 %acc2
+}
+
+define i32 @kernel15(i32* %a, i32* %b, i32* %out, i32 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %loop ]
+  %acc = phi i32 [ 0, %entry ], [ %acc2, %loop ]
+  %pa = getelementptr inbounds i32, i32* %a, i32 %i
+  %va = load i32, i32* %pa
+  %pb = getelementptr inbounds i32, i32* %b, i32 %i
+  %vb = load i32, i32* %pb
+  %m = and i32 %va, %vb
+  %po = getelementptr inbounds i32, i32* %out, i32 %i
+  store i32 %m, i32* %po
+  %acc2 = xor i32 %acc, %m
+  %inc = add nuw nsw i32 %i, 1
+  %cmp = icmp slt i32 %inc, %n
+  br i1 %cmp, label %loop, label %exit
+exit:
+  ret i32 %acc2
+}
+
+define i32 @kernel16(i32* %a, i32* %b, i32* %out, i32 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %loop ]
+  %acc = phi i32 [ 0, %entry ], [ %acc2, %loop ]
+  %pa = getelementptr inbounds i32, i32* %a, i32 %i
+  %va = load i32, i32* %pa
+  %pb = getelementptr inbounds i32, i32* %b, i32 %i
+  %vb = load i32, i32* %pb
+  %m = mul i32 %va, %vb
+  %po = getelementptr inbounds i32, i32* %out, i32 %i
+  store i32 %m, i32* %po
+  %acc2 = add i32 %acc, %m
+  %inc = add nuw nsw i32 %i, 1
+  %cmp = icmp slt i32 %inc, %n
+  br i1 %cmp, label %loop, label %exit
+exit:
+  ret i32 %acc2
+}
+
+define i32 @kernel17(i32* %a, i32* %b, i32* %out, i32 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %loop ]
+  %acc = phi i32 [ 0, %entry ], [ %acc2, %loop ]
+  %pa = getelementptr inbounds i32, i32* %a, i32 %i
+  %va = load i32, i32* %pa
+  %pb = getelementptr inbounds i32, i32* %b, i32 %i
+  %vb = load i32, i32* %pb
+  %m = add i32 %va, %vb
+  %po = getelementptr inbounds i32, i32* %out, i32 %i
+  store i32 %m, i32* %po
+  %acc2 = or i32 %acc, %m
+  %inc = add nuw nsw i32 %i, 1
+  %cmp = icmp slt i32 %inc, %n
+  br i1 %cmp, label %loop, label %exit
+exit:
+  ret i32 %acc2
+}
+
+define i32 @kernel18(i32* %a, i32* %b, i32* %out, i32 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %loop ]
+  %acc = phi i32 [ 0, %entry ], [ %acc2, %loop ]
+  %pa = getelementptr inbounds i32, i32* %a, i32 %i
+  %va = load i32, i32* %pa
+  %pb = getelementptr inbounds i32, i32* %b, i32 %i
+  %vb = load i32, i32* %pb
+  %m = xor i32 %va, %vb
+  %po = getelementptr inbounds i32, i32* %out, i32 %i
+  store i32 %m, i32* %po
+  %acc2 = sub i32 %acc, %m
+  %inc = add nuw nsw i32 %i, 1
+  %cmp = icmp slt i32 %inc, %n
+  br i1 %cmp, label %loop, label %exit
+exit:
+  ret i32 %acc2
+}
+
+define i32 @kernel19(i32* %a, i32* %b, i32* %out, i32 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %loop ]
+  %acc = phi i32 [ 0, %entry ], [ %acc2, %loop ]
+  %pa = getelementptr inbounds i32, i32* %a, i32 %i
+  %va = load i32, i32* %pa
+  %pb = getelementptr inbounds i32, i32* %b, i32 %i
+  %vb = load i32, i32* %pb
+  %m = and i32 %va, %vb
+  %po = getelementptr inbounds i32, i32* %out, i32 %i
+  store i32 %m, i32* %po
+  %acc2 = xor i32 %acc, %m
+  %inc = add nuw nsw i32 %i, 1
+  %cmp = icmp slt i32 %inc, %n
+  br i1 %cmp, label %loop, label %exit
+exit:
+  ret i32 %acc2
+}
+
+define i32 @kernel20(i32* %a, i32* %b, i32* %out, i32 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %loop ]
+  %acc = phi i32 [ 0, %entry ], [ %acc2, %loop ]
+  %pa = getelementptr inbounds i32, i32* %a, i32 %i
+  %va = load i32, i32* %pa
+  %pb = getelementptr inbounds i32, i32* %b, i32 %i
+  %vb = load i32, i32* %pb
+  %m = mul i32 %va, %vb
+  %po = getelementptr inbounds i32, i32* %out, i32 %i
+  store i32 %m, i32* %po
+  %acc2 = add i32 %acc, %m
+  %inc = add nuw nsw i32 %i, 1
+  %cmp = icmp slt i32 %inc, %n
+  br i1 %cmp, label %loop, label %exit
+exit:
+  ret i32 %acc2
+}
+
+define i32 @kernel21(i32* %a, i32* %b, i32* %out, i32 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %loop ]
+  %acc = phi i32 [ 0, %entry ], [ %acc2, %loop ]
+  %pa = getelementptr inbounds i32, i32* %a, i32 %i
+  %va = load i32, i32* %pa
+  %pb = getelementptr inbounds i32, i32* %b, i32 %i
+  %vb = load i32, i32* %pb
+  %m = add i32 %va, %vb
+  %po = getelementptr inbounds i32, i32* %out, i32 %i
+  store i32 %m, i32* %po
+  %acc2 = or i32 %acc, %m
+  %inc = add nuw nsw i32 %i, 1
+  %cmp = icmp slt i32 %inc, %n
+  br i1 %cmp, label %loop, label %exit
+exit:
+  ret i32 %acc2
+}
+
+define i32 @kernel22(i32* %a, i32* %b, i32* %out, i32 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %loop ]
+  %acc = phi i32 [ 0, %entry ], [ %acc2, %loop ]
+  %pa = getelementptr inbounds i32, i32* %a, i32 %i
+  %va = load i32, i32* %pa
+  %pb = getelementptr inbounds i32, i32* %b, i32 %i
+  %vb = load i32, i32* %pb
+  %m = xor i32 %va, %vb
+  %po = getelementptr inbounds i32, i32* %out, i32 %i
+  store i32 %m, i32* %po
+  %acc2 = sub i32 %acc, %m
+  %inc = add nuw nsw i32 %i, 1
+  %cmp = icmp slt i32 %inc, %n
+  br i1 %cmp, label %loop, label %exit
+exit:
+  ret i32 %acc2
+}
+
+define i32 @kernel23(i32* %a, i32* %b, i32* %out, i32 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %loop ]
+  %acc = phi i32 [ 0, %entry ], [ %acc2, %loop ]
+  %pa = getelementptr inbounds i32, i32* %a, i32 %i
+  %va = load i32, i32* %pa
+  %pb = getelementptr inbounds i32, i32* %b, i32 %i
+  %vb = load i32, i32* %pb
+  %m = and i32 %va, %vb
+  %po = getelementptr inbounds i32, i32* %out, i32 %i
+  store i32 %m, i32* %po
+  %acc2 = xor i32 %acc, %m
+  %inc = add nuw nsw i32 %i, 1
+  %cmp = icmp slt i32 %inc, %n
+  br i1 %cmp, label %loop, label %exit
+exit:
+  ret i32 %acc2
+}
+
+define i32 @kernel24(i32* %a, i32* %b, i32* %out, i32 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %loop ]
+  %acc = phi i32 [ 0, %entry ], [ %acc2, %loop ]
+  %pa = getelementptr inbounds i32, i32* %a, i32 %i
+  %va = load i32, i32* %pa
+  %pb = getelementptr inbounds i32, i32* %b, i32 %i
+  %vb = load i32, i32* %pb
+  %m = mul i32 %va, %vb
+  %po = getelementptr inbounds i32, i32* %out, i32 %i
+  store i32 %m, i32* %po
+  %acc2 = add i32 %acc, %m
+  %inc = add nuw nsw i32 %i, 1
+  %cmp = icmp slt i32 %inc, %n
+  br i1 %cmp, label %loop, label %exit
+exit:
+  ret i32 %acc2
+}
+
+define i32 @kernel25(i32* %a, i32* %b, i32* %out, i32 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %loop ]
+  %acc = phi i32 [ 0, %entry ], [ %acc2, %loop ]
+  %pa = getelementptr inbounds i32, i32* %a, i32 %i
+  %va = load i32, i32* %pa
+  %pb = getelementptr inbounds i32, i32* %b, i32 %i
+  %vb = load i32, i32* %pb
+  %m = add i32 %va, %vb
+  %po = getelementptr inbounds i32, i32* %out, i32 %i
+  store i32 %m, i32* %po
+  %acc2 = or i32 %acc, %m
+  %inc = add nuw nsw i32 %i, 1
+  %cmp = icmp slt i32 %inc, %n
+  br i1 %cmp, label %loop, label %exit
+exit:
+  ret i32 %acc2
+}
+
+define i32 @kernel26(i32* %a, i32* %b, i32* %out, i32 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %loop ]
+  %acc = phi i32 [ 0, %entry ], [ %acc2, %loop ]
+  %pa = getelementptr inbounds i32, i32* %a, i32 %i
+  %va = load i32, i32* %pa
+  %pb = getelementptr inbounds i32, i32* %b, i32 %i
+  %vb = load i32, i32* %pb
+  %m = xor i32 %va, %vb
+  %po = getelementptr inbounds i32, i32* %out, i32 %i
+  store i32 %m, i32* %po
+  %acc2 = sub i32 %acc, %m
+  %inc = add nuw nsw i32 %i, 1
+  %cmp = icmp slt i32 %inc, %n
+  br i1 %cmp, label %loop, label %exit
+exit:
+  ret i32 %acc2
+}
+
+define i32 @kernel27(i32* %a, i32* %b, i32* %out, i32 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %loop ]
+  %acc = phi i32 [ 0, %entry ], [ %acc2, %loop ]
+  %pa = getelementptr inbounds i32, i32* %a, i32 %i
+  %va = load i32, i32* %pa
+  %pb = getelementptr inbounds i32, i32* %b, i32 %i
+  %vb = load i32, i32* %pb
+  %m = and i32 %va, %vb
+  %po = getelementptr inbounds i32, i32* %out, i32 %i
+  store i32 %m, i32* %po
+  %acc2 = xor i32 %acc, %m
+  %inc = add nuw nsw i32 %i, 1
+  %cmp = icmp slt i32 %inc, %n
+  br i1 %cmp, label %loop, label %exit
+exit:
+  ret i32 %acc2
+}
+
+define i32 @kernel28(i32* %a, i32* %b, i32* %out, i32 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %loop ]
+  %acc = phi i32 [ 0, %entry ], [ %acc2, %loop ]
+  %pa = getelementptr inbounds i32, i32* %a, i32 %i
+  %va = load i32, i32* %pa
+  %pb = getelementptr inbounds i32, i32* %b, i32 %i
+  %vb = load i32, i32* %pb
+  %m = mul i32 %va, %vb
+  %po = getelementptr inbounds i32, i32* %out, i32 %i
+  store i32 %m, i32* %po
+  %acc2 = add i32 %acc, %m
+  %inc = add nuw nsw i32 %i, 1
+  %cmp = icmp slt i32 %inc, %n
+  br i1 %cmp, label %loop, label %exit
+exit:
+  ret i32 %acc2
+}
+
+define i32 @kernel29(i32* %a, i32* %b, i32* %out, i32 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %loop ]
+  %acc = phi i32 [ 0, %entry ], [ %acc2, %loop ]
+  %pa = getelementptr inbounds i32, i32* %a, i32 %i
+  %va = load i32, i32* %pa
+  %pb = getelementptr inbounds i32, i32* %b, i32 %i
+  %vb = load i32, i32* %pb
+  %m = add i32 %va, %vb
+  %po = getelementptr inbounds i32, i32* %out, i32 %i
+  store i32 %m, i32* %po
+  %acc2 = or i32 %acc, %m
+  %inc = add nuw nsw i32 %i, 1
+  %cmp = icmp slt i32 %inc, %n
+  br i1 %cmp, label %loop, label %exit
+exit:
+  ret i32 %acc2
+}
+
+define i32 @kernel30(i32* %a, i32* %b, i32* %out, i32 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %loop ]
+  %acc = phi i32 [ 0, %entry ], [ %acc2, %loop ]
+  %pa = getelementptr inbounds i32, i32* %a, i32 %i
+  %va = load i32, i32* %pa
+  %pb = getelementptr inbounds i32, i32* %b, i32 %i
+  %vb = load i32, i32* %pb
+  %m = xor i32 %va, %vb
+  %po = getelementptr inbounds i32, i32* %out, i32 %i
+  store i32 %m, i32* %po
+  %acc2 = sub i32 %acc, %m
+  %inc = add nuw nsw i32 %i, 1
+  %cmp = icmp slt i32 %inc, %n
+  br i1 %cmp, label %loop, label %exit
+exit:
+  ret i32 %acc2
+}
+
+define i32 @kernel31(i32* %a, i32* %b, i32* %out, i32 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %loop ]
+  %acc = phi i32 [ 0, %entry ], [ %acc2, %loop ]
+  %pa = getelementptr inbounds i32, i32* %a, i32 %i
+  %va = load i32, i32* %pa
+  %pb = getelementptr inbounds i32, i32* %b, i32 %i
+  %vb = load i32, i32* %pb
+  %m = and i32 %va, %vb
+  %po = getelementptr inbounds i32, i32* %out, i32 %i
+  store i32 %m, i32* %po
+  %acc2 = xor i32 %acc, %m
+  %inc = add nuw nsw i32 %i, 1
+  %cmp = icmp slt i32 %inc, %n
+  br i1 %cmp, label %loop, label %exit
+exit:
+  ret i32 %acc2
+}
+
+define i32 @kernel32(i32* %a, i32* %b, i32* %out, i32 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %loop ]
+  %acc = phi i32 [ 0, %entry ], [ %acc2, %loop ]
+  %pa = getelementptr inbounds i32, i32* %a, i32 %i
+  %va = load i32, i32* %pa
+  %pb = getelementptr inbounds i32, i32* %b, i32 %i
+  %vb = load i32, i32* %pb
+  %m = mul i32 %va, %vb
+  %po = getelementptr inbounds i32, i32* %out, i32 %i
+  store i32 %m, i32* %po
+  %acc2 = add i32 %acc, %m
+  %inc = add nuw nsw i32 %i, 1
+  %cmp = icmp slt i32 %inc, %n
+  br i1 %cmp, label %loop, label %exit
+exit:
+  ret i32 %acc2
+}
+
+define i32 @kernel33(i32* %a, i32* %b, i32* %out, i32 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %loop ]
+  %acc = phi i32 [ 0, %entry ], [ %acc2, %loop ]
+  %pa = getelementptr inbounds i32, i32* %a, i32 %i
+  %va = load i32, i32* %pa
+  %pb = getelementptr inbounds i32, i32* %b, i32 %i
+  %vb = load i32, i32* %pb
+  %m = add i32 %va, %vb
+  %po = getelementptr inbounds i32, i32* %out, i32 %i
+  store i32 %m, i32* %po
+  %acc2 = or i32 %acc, %m
+  %inc = add nuw nsw i32 %i, 1
+  %cmp = icmp slt i32 %inc, %n
+  br i1 %cmp, label %loop, label %exit
+exit:
+  ret i32 %acc2
+}
+
+define i32 @kernel34(i32* %a, i32* %b, i32* %out, i32 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %loop ]
+  %acc = phi i32 [ 0, %entry ], [ %acc2, %loop ]
+  %pa = getelementptr inbounds i32, i32* %a, i32 %i
+  %va = load i32, i32* %pa
+  %pb = getelementptr inbounds i32, i32* %b, i32 %i
+  %vb = load i32, i32* %pb
+  %m = xor i32 %va, %vb
+  %po = getelementptr inbounds i32, i32* %out, i32 %i
+  store i32 %m, i32* %po
+  %acc2 = sub i32 %acc, %m
+  %inc = add nuw nsw i32 %i, 1
+  %cmp = icmp slt i32 %inc, %n
+  br i1 %cmp, label %loop, label %exit
+exit:
+  ret i32 %acc2
+}
+
+define i32 @kernel35(i32* %a, i32* %b, i32* %out, i32 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %loop ]
+  %acc = phi i32 [ 0, %entry ], [ %acc2, %loop ]
+  %pa = getelementptr inbounds i32, i32* %a, i32 %i
+  %va = load i32, i32* %pa
+  %pb = getelementptr inbounds i32, i32* %b, i32 %i
+  %vb = load i32, i32* %pb
+  %m = and i32 %va, %vb
+  %po = getelementptr inbounds i32, i32* %out, i32 %i
+  store i32 %m, i32* %po
+  %acc2 = xor i32 %acc, %m
+  %inc = add nuw nsw i32 %i, 1
+  %cmp = icmp slt i32 %inc, %n
+  br i1 %cmp, label %loop, label %exit
+exit:
+  ret i32 %acc2
+}
+
+define i32 @kernel36(i32* %a, i32* %b, i32* %out, i32 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %loop ]
+  %acc = phi i32 [ 0, %entry ], [ %acc2, %loop ]
+  %pa = getelementptr inbounds i32, i32* %a, i32 %i
+  %va = load i32, i32* %pa
+  %pb = getelementptr inbounds i32, i32* %b, i32 %i
+  %vb = load i32, i32* %pb
+  %m = mul i32 %va, %vb
+  %po = getelementptr inbounds i32, i32* %out, i32 %i
+  store i32 %m, i32* %po
+  %acc2 = add i32 %acc, %m
+  %inc = add nuw nsw i32 %i, 1
+  %cmp = icmp slt i32 %inc, %n
+  br i1 %cmp, label %loop, label %exit
+exit:
+  ret i32 %acc2
+}
+
+define i32 @kernel37(i32* %a, i32* %b, i32* %out, i32 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %loop ]
+  %acc = phi i32 [ 0, %entry ], [ %acc2, %loop ]
+  %pa = getelementptr inbounds i32, i32* %a, i32 %i
+  %va = load i32, i32* %pa
+  %pb = getelementptr inbounds i32, i32* %b, i32 %i
+  %vb = load i32, i32* %pb
+  %m = add i32 %va, %vb
+  %po = getelementptr inbounds i32, i32* %out, i32 %i
+  store i32 %m, i32* %po
+  %acc2 = or i32 %acc, %m
+  %inc = add nuw nsw i32 %i, 1
+  %cmp = icmp slt i32 %inc, %n
+  br i1 %cmp, label %loop, label %exit
+exit:
+  ret i32 %acc2
+}
+
+define i32 @kernel38(i32* %a, i32* %b, i32* %out, i32 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %loop ]
+  %acc = phi i32 [ 0, %entry ], [ %acc2, %loop ]
+  %pa = getelementptr inbounds i32, i32* %a, i32 %i
+  %va = load i32, i32* %pa
+  %pb = getelementptr inbounds i32, i32* %b, i32 %i
+  %vb = load i32, i32* %pb
+  %m = xor i32 %va, %vb
+  %po = getelementptr inbounds i32, i32* %out, i32 %i
+  store i32 %m, i32* %po
+  %acc2 = sub i32 %acc, %m
+  %inc = add nuw nsw i32 %i, 1
+  %cmp = icmp slt i32 %inc, %n
+  br i1 %cmp, label %loop, label %exit
+exit:
+  ret i32 %acc2
+}
+
+define i32 @kernel39(i32* %a, i32* %b, i32* %out, i32 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %loop ]
+  %acc = phi i32 [ 0, %entry ], [ %acc2, %loop ]
+  %pa = getelementptr inbounds i32, i32* %a, i32 %i
+  %va = load i32, i32* %pa
+  %pb = getelementptr inbounds i32, i32* %b, i32 %i
+  %vb = load i32, i32* %pb
+  %m = and i32 %va, %vb
+  %po = getelementptr inbounds i32, i32* %out, i32 %i
+  store i32 %m, i32* %po
+  %acc2 = xor i32 %acc, %m
+  %inc = add nuw nsw i32 %i, 1
+  %cmp = icmp slt i32 %inc, %n
+  br i1 %cmp, label %loop, label %exit
+exit:
+  ret i32 %acc2
+}
+
+define i32 @kernel40(i32* %a, i32* %b, i32* %out, i32 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %loop ]
+  %acc = phi i32 [ 0, %entry ], [ %acc2, %loop ]
+  %pa = getelementptr inbounds i32, i32* %a, i32 %i
+  %va = load i32, i32* %pa
+  %pb = getelementptr inbounds i32, i32* %b, i32 %i
+  %vb = load i32, i32* %pb
+  %m = mul i32 %va, %vb
+  %po = getelementptr inbounds i32, i32* %out, i32 %i
+  store i32 %m, i32* %po
+  %acc2 = add i32 %acc, %m
+  %inc = add nuw nsw i32 %i, 1
+  %cmp = icmp slt i32 %inc, %n
+  br i1 %cmp, label %loop, label %exit
+exit:
+  ret i32 %acc2
+}
+
+define i32 @kernel41(i32* %a, i32* %b, i32* %out, i32 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %loop ]
+  %acc = phi i32 [ 0, %entry ], [ %acc2, %loop ]
+  %pa = getelementptr inbounds i32, i32* %a, i32 %i
+  %va = load i32, i32* %pa
+  %pb = getelementptr inbounds i32, i32* %b, i32 %i
+  %vb = load i32, i32* %pb
+  %m = add i32 %va, %vb
+  %po = getelementptr inbounds i32, i32* %out, i32 %i
+  store i32 %m, i32* %po
+  %acc2 = or i32 %acc, %m
+  %inc = add nuw nsw i32 %i, 1
+  %cmp = icmp slt i32 %inc, %n
+  br i1 %cmp, label %loop, label %exit
+exit:
+  ret i32 %acc2
+}
+
+define i32 @kernel42(i32* %a, i32* %b, i32* %out, i32 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %loop ]
+  %acc = phi i32 [ 0, %entry ], [ %acc2, %loop ]
+  %pa = getelementptr inbounds i32, i32* %a, i32 %i
+  %va = load i32, i32* %pa
+  %pb = getelementptr inbounds i32, i32* %b, i32 %i
+  %vb = load i32, i32* %pb
+  %m = xor i32 %va, %vb
+  %po = getelementptr inbounds i32, i32* %out, i32 %i
+  store i32 %m, i32* %po
+  %acc2 = sub i32 %acc, %m
+  %inc = add nuw nsw i32 %i, 1
+  %cmp = icmp slt i32 %inc, %n
+  br i1 %cmp, label %loop, label %exit
+exit:
+  ret i32 %acc2
+}
+
+define i32 @kernel43(i32* %a, i32* %b, i32* %out, i32 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %loop ]
+  %acc = phi i32 [ 0, %entry ], [ %acc2, %loop ]
+  %pa = getelementptr inbounds i32, i32* %a, i32 %i
+  %va = load i32, i32* %pa
+  %pb = getelementptr inbounds i32, i32* %b, i32 %i
+  %vb = load i32, i32* %pb
+  %m = and i32 %va, %vb
+  %po = getelementptr inbounds i32, i32* %out, i32 %i
+  store i32 %m, i32* %po
+  %acc2 = xor i32 %acc, %m
+  %inc = add nuw nsw i32 %i, 1
+  %cmp = icmp slt i32 %inc, %n
+  br i1 %cmp, label %loop, label %exit
+exit:
+  ret i32 %acc2
+}
+
+define i32 @kernel44(i32* %a, i32* %b, i32* %out, i32 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %loop ]
+  %acc = phi i32 [ 0, %entry ], [ %acc2, %loop ]
+  %pa = getelementptr inbounds i32, i32* %a, i32 %i
+  %va = load i32, i32* %pa
+  %pb = getelementptr inbounds i32, i32* %b, i32 %i
+  %vb = load i32, i32* %pb
+  %m = mul i32 %va, %vb
+  %po = getelementptr inbounds i32, i32* %out, i32 %i
+  store i32 %m, i32* %po
+  %acc2 = add i32 %acc, %m
+  %inc = add nuw nsw i32 %i, 1
+  %cmp = icmp slt i32 %inc, %n
+  br i1 %cmp, label %loop, label %exit
+exit:
+  ret i32 %acc2
+}
+
+define i32 @kernel45(i32* %a, i32* %b, i32* %out, i32 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %loop ]
+  %acc = phi i32 [ 0, %entry ], [ %acc2, %loop ]
+  %pa = getelementptr inbounds i32, i32* %a, i32 %i
+  %va = load i32, i32* %pa
+  %pb = getelementptr inbounds i32, i32* %b, i32 %i
+  %vb = load i32, i32* %pb
+  %m = add i32 %va, %vb
+  %po = getelementptr inbounds i32, i32* %out, i32 %i
+  store i32 %m, i32* %po
+  %acc2 = or i32 %acc, %m
+  %inc = add nuw nsw i32 %i, 1
+  %cmp = icmp slt i32 %inc, %n
+  br i1 %cmp, label %loop, label %exit
+exit:
+  ret i32 %acc2
+}
+
+define i32 @kernel46(i32* %a, i32* %b, i32* %out, i32 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %loop ]
+  %acc = phi i32 [ 0, %entry ], [ %acc2, %loop ]
+  %pa = getelementptr inbounds i32, i32* %a, i32 %i
+  %va = load i32, i32* %pa
+  %pb = getelementptr inbounds i32, i32* %b, i32 %i
+  %vb = load i32, i32* %pb
+  %m = xor i32 %va, %vb
+  %po = getelementptr inbounds i32, i32* %out, i32 %i
+  store i32 %m, i32* %po
+  %acc2 = sub i32 %acc, %m
+  %inc = add nuw nsw i32 %i, 1
+  %cmp = icmp slt i32 %inc, %n
+  br i1 %cmp, label %loop, label %exit
+exit:
+  ret i32 %acc2
+}
+
+define i32 @kernel47(i32* %a, i32* %b, i32* %out, i32 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %loop ]
+  %acc = phi i32 [ 0, %entry ], [ %acc2, %loop ]
+  %pa = getelementptr inbounds i32, i32* %a, i32 %i
+  %va = load i32, i32* %pa
+  %pb = getelementptr inbounds i32, i32* %b, i32 %i
+  %vb = load i32, i32* %pb
+  %m = and i32 %va, %vb
+  %po = getelementptr inbounds i32, i32* %out, i32 %i
+  store i32 %m, i32* %po
+  %acc2 = xor i32 %acc, %m
+  %inc = add nuw nsw i32 %i, 1
+  %cmp = icmp slt i32 %inc, %n
+  br i1 %cmp, label %loop, label %exit
+exit:
+  ret i32 %acc2
+}
+
+define i32 @kernel48(i32* %a, i32* %b, i32* %out, i32 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %loop ]
+  %acc = phi i32 [ 0, %entry ], [ %acc2, %loop ]
+  %pa = getelementptr inbounds i32, i32* %a, i32 %i
+  %va = load i32, i32* %pa
+  %pb = getelementptr inbounds i32, i32* %b, i32 %i
+  %vb = load i32, i32* %pb
+  %m = mul i32 %va, %vb
+  %po = getelementptr inbounds i32, i32* %out, i32 %i
+  store i32 %m, i32* %po
+  %acc2 = add i32 %acc, %m
+  %inc = add nuw nsw i32 %i, 1
+  %cmp = icmp slt i32 %inc, %n
+  br i1 %cmp, label %loop, label %exit
+exit:
+  ret i32 %acc2
+}
+
+define i32 @kernel49(i32* %a, i32* %b, i32* %out, i32 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %loop ]
+  %acc = phi i32 [ 0, %entry ], [ %acc2, %loop ]
+  %pa = getelementptr inbounds i32, i32* %a, i32 %i
+  %va = load i32, i32* %pa
+  %pb = getelementptr inbounds i32, i32* %b, i32 %i
+  %vb = load i32, i32* %pb
+  %m = add i32 %va, %vb
+  %po = getelementptr inbounds i32, i32* %out, i32 %i
+  store i32 %m, i32* %po
+  %acc2 = or i32 %acc, %m
+  %inc = add nuw nsw i32 %i, 1
+  %cmp = icmp slt i32 %inc, %n
+  br i1 %cmp, label %loop, label %exit
+exit:
+  ret i32 %acc2
+}
+
+define i32 @kernel50(i32* %a, i32* %b, i32* %out, i32 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %loop ]
+  %acc = phi i32 [ 0, %entry ], [ %acc2, %loop ]
+  %pa = getelementptr inbounds i32, i32* %a, i32 %i
+  %va = load i32, i32* %pa
+  %pb = getelementptr inbounds i32, i32* %b, i32 %i
+  %vb = load i32, i32* %pb
+  %m = xor i32 %va, %vb
+  %po = getelementptr inbounds i32, i32* %out, i32 %i
+  store i32 %m, i32* %po
+  %acc2 = sub i32 %acc, %m
+  %inc = add nuw nsw i32 %i, 1
+  %cmp = icmp slt i32 %inc, %n
+  br i1 %cmp, label %loop, label %exit
+exit:
+  ret i32 %acc2
+}
+
+define i32 @kernel51(i32* %a, i32* %b, i32* %out, i32 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %loop ]
+  %acc = phi i32 [ 0, %entry ], [ %acc2, %loop ]
+  %pa = getelementptr inbounds i32, i32* %a, i32 %i
+  %va = load i32, i32* %pa
+  %pb = getelementptr inbounds i32, i32* %b, i32 %i
+  %vb = load i32, i32* %pb
+  %m = and i32 %va, %vb
+  %po = getelementptr inbounds i32, i32* %out, i32 %i
+  store i32 %m, i32* %po
+  %acc2 = xor i32 %acc, %m
+  %inc = add nuw nsw i32 %i, 1
+  %cmp = icmp slt i32 %inc, %n
+  br i1 %cmp, label %loop, label %exit
+exit:
+  ret i32 %acc2
+}
+
+define i32 @kernel52(i32* %a, i32* %b, i32* %out, i32 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %loop ]
+  %acc = phi i32 [ 0, %entry ], [ %acc2, %loop ]
+  %pa = getelementptr inbounds i32, i32* %a, i32 %i
+  %va = load i32, i32* %pa
+  %pb = getelementptr inbounds i32, i32* %b, i32 %i
+  %vb = load i32, i32* %pb
+  %m = mul i32 %va, %vb
+  %po = getelementptr inbounds i32, i32* %out, i32 %i
+  store i32 %m, i32* %po
+  %acc2 = add i32 %acc, %m
+  %inc = add nuw nsw i32 %i, 1
+  %cmp = icmp slt i32 %inc, %n
+  br i1 %cmp, label %loop, label %exit
+exit:
+  ret i32 %acc2
+}
+
+define i32 @kernel53(i32* %a, i32* %b, i32* %out, i32 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %loop ]
+  %acc = phi i32 [ 0, %entry ], [ %acc2, %loop ]
+  %pa = getelementptr inbounds i32, i32* %a, i32 %i
+  %va = load i32, i32* %pa
+  %pb = getelementptr inbounds i32, i32* %b, i32 %i
+  %vb = load i32, i32* %pb
+  %m = add i32 %va, %vb
+  %po = getelementptr inbounds i32, i32* %out, i32 %i
+  store i32 %m, i32* %po
+  %acc2 = or i32 %acc, %m
+  %inc = add nuw nsw i32 %i, 1
+  %cmp = icmp slt i32 %inc, %n
+  br i1 %cmp, label %loop, label %exit
+exit:
+  ret i32 %acc2
+}
+
+define i32 @kernel54(i32* %a, i32* %b, i32* %out, i32 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %loop ]
+  %acc = phi i32 [ 0, %entry ], [ %acc2, %loop ]
+  %pa = getelementptr inbounds i32, i32* %a, i32 %i
+  %va = load i32, i32* %pa
+  %pb = getelementptr inbounds i32, i32* %b, i32 %i
+  %vb = load i32, i32* %pb
+  %m = xor i32 %va, %vb
+  %po = getelementptr inbounds i32, i32* %out, i32 %i
+  store i32 %m, i32* %po
+  %acc2 = sub i32 %acc, %m
+  %inc = add nuw nsw i32 %i, 1
+  %cmp = icmp slt i32 %inc, %n
+  br i1 %cmp, label %loop, label %exit
+exit:
+  ret i32 %acc2
+}
+
+define i32 @kernel55(i32* %a, i32* %b, i32* %out, i32 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %loop ]
+  %acc = phi i32 [ 0, %entry ], [ %acc2, %loop ]
+  %pa = getelementptr inbounds i32, i32* %a, i32 %i
+  %va = load i32, i32* %pa
+  %pb = getelementptr inbounds i32, i32* %b, i32 %i
+  %vb = load i32, i32* %pb
+  %m = and i32 %va, %vb
+  %po = getelementptr inbounds i32, i32* %out, i32 %i
+  store i32 %m, i32* %po
+  %acc2 = xor i32 %acc, %m
+  %inc = add nuw nsw i32 %i, 1
+  %cmp = icmp slt i32 %inc, %n
+  br i1 %cmp, label %loop, label %exit
+exit:
+  ret i32 %acc2
+}
+
+define i32 @kernel56(i32* %a, i32* %b, i32* %out, i32 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %loop ]
+  %acc = phi i32 [ 0, %entry ], [ %acc2, %loop ]
+  %pa = getelementptr inbounds i32, i32* %a, i32 %i
+  %va = load i32, i32* %pa
+  %pb = getelementptr inbounds i32, i32* %b, i32 %i
+  %vb = load i32, i32* %pb
+  %m = mul i32 %va, %vb
+  %po = getelementptr inbounds i32, i32* %out, i32 %i
+  store i32 %m, i32* %po
+  %acc2 = add i32 %acc, %m
+  %inc = add nuw nsw i32 %i, 1
+  %cmp = icmp slt i32 %inc, %n
+  br i1 %cmp, label %loop, label %exit
+exit:
+  ret i32 %acc2
+}
+
+define i32 @kernel57(i32* %a, i32* %b, i32* %out, i32 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %loop ]
+  %acc = phi i32 [ 0, %entry ], [ %acc2, %loop ]
+  %pa = getelementptr inbounds i32, i32* %a, i32 %i
+  %va = load i32, i32* %pa
+  %pb = getelementptr inbounds i32, i32* %b, i32 %i
+  %vb = load i32, i32* %pb
+  %m = add i32 %va, %vb
+  %po = getelementptr inbounds i32, i32* %out, i32 %i
+  store i32 %m, i32* %po
+  %acc2 = or i32 %acc, %m
+  %inc = add nuw nsw i32 %i, 1
+  %cmp = icmp slt i32 %inc, %n
+  br i1 %cmp, label %loop, label %exit
+exit:
+  ret i32 %acc2
+}
+
+define i32 @kernel58(i32* %a, i32* %b, i32* %out, i32 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %loop ]
+  %acc = phi i32 [ 0, %entry ], [ %acc2, %loop ]
+  %pa = getelementptr inbounds i32, i32* %a, i32 %i
+  %va = load i32, i32* %pa
+  %pb = getelementptr inbounds i32, i32* %b, i32 %i
+  %vb = load i32, i32* %pb
+  %m = xor i32 %va, %vb
+  %po = getelementptr inbounds i32, i32* %out, i32 %i
+  store i32 %m, i32* %po
+  %acc2 = sub i32 %acc, %m
+  %inc = add nuw nsw i32 %i, 1
+  %cmp = icmp slt i32 %inc, %n
+  br i1 %cmp, label %loop, label %exit
+exit:
+  ret i32 %acc2
+}
+
+define i32 @kernel59(i32* %a, i32* %b, i32* %out, i32 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %loop ]
+  %acc = phi i32 [ 0, %entry ], [ %acc2, %loop ]
+  %pa = getelementptr inbounds i32, i32* %a, i32 %i
+  %va = load i32, i32* %pa
+  %pb = getelementptr inbounds i32, i32* %b, i32 %i
+  %vb = load i32, i32* %pb
+  %m = and i32 %va, %vb
+  %po = getelementptr inbounds i32, i32* %out, i32 %i
+  store i32 %m, i32* %po
+  %acc2 = xor i32 %acc, %m
+  %inc = add nuw nsw i32 %i, 1
+  %cmp = icmp slt i32 %inc, %n
+  br i1 %cmp, label %loop, label %exit
+exit:
+  ret i32 %acc2
+}
+
+define i32 @kernel60(i32* %a, i32* %b, i32* %out, i32 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %loop ]
+  %acc = phi i32 [ 0, %entry ], [ %acc2, %loop ]
+  %pa = getelementptr inbounds i32, i32* %a, i32 %i
+  %va = load i32, i32* %pa
+  %pb = getelementptr inbounds i32, i32* %b, i32 %i
+  %vb = load i32, i32* %pb
+  %m = mul i32 %va, %vb
+  %po = getelementptr inbounds i32, i32* %out, i32 %i
+  store i32 %m, i32* %po
+  %acc2 = add i32 %acc, %m
+  %inc = add nuw nsw i32 %i, 1
+  %cmp = icmp slt i32 %inc, %n
+  br i1 %cmp, label %loop, label %exit
+exit:
+  ret i32 %acc2
+}
+
+define i32 @kernel61(i32* %a, i32* %b, i32* %out, i32 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %loop ]
+  %acc = phi i32 [ 0, %entry ], [ %acc2, %loop ]
+  %pa = getelementptr inbounds i32, i32* %a, i32 %i
+  %va = load i32, i32* %pa
+  %pb = getelementptr inbounds i32, i32* %b, i32 %i
+  %vb = load i32, i32* %pb
+  %m = add i32 %va, %vb
+  %po = getelementptr inbounds i32, i32* %out, i32 %i
+  store i32 %m, i32* %po
+  %acc2 = or i32 %acc, %m
+  %inc = add nuw nsw i32 %i, 1
+  %cmp = icmp slt i32 %inc, %n
+  br i1 %cmp, label %loop, label %exit
+exit:
+  ret i32 %acc2
+}
+
+define i32 @kernel62(i32* %a, i32* %b, i32* %out, i32 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %loop ]
+  %acc = phi i32 [ 0, %entry ], [ %acc2, %loop ]
+  %pa = getelementptr inbounds i32, i32* %a, i32 %i
+  %va = load i32, i32* %pa
+  %pb = getelementptr inbounds i32, i32* %b, i32 %i
+  %vb = load i32, i32* %pb
+  %m = xor i32 %va, %vb
+  %po = getelementptr inbounds i32, i32* %out, i32 %i
+  store i32 %m, i32* %po
+  %acc2 = sub i32 %acc, %m
+  %inc = add nuw nsw i32 %i, 1
+  %cmp = icmp slt i32 %inc, %n
+  br i1 %cmp, label %loop, label %exit
+exit:
+  ret i32 %acc2
+}
+
+define i32 @kernel63(i32* %a, i32* %b, i32* %out, i32 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %loop ]
+  %acc = phi i32 [ 0, %entry ], [ %acc2, %loop ]
+  %pa = getelementptr inbounds i32, i32* %a, i32 %i
+  %va = load i32, i32* %pa
+  %pb = getelementptr inbounds i32, i32* %b, i32 %i
+  %vb = load i32, i32* %pb
+  %m = and i32 %va, %vb
+  %po = getelementptr inbounds i32, i32* %out, i32 %i
+  store i32 %m, i32* %po
+  %acc2 = xor i32 %acc, %m
+  %inc = add nuw nsw i32 %i, 1
+  %cmp = icmp slt i32 %inc, %n
+  br i1 %cmp, label %loop, label %exit
+exit:
+  ret i32 %acc2
+}
+
+define i32 @kernel64(i32* %a, i32* %b, i32* %out, i32 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %loop ]
+  %acc = phi i32 [ 0, %entry ], [ %acc2, %loop ]
+  %pa = getelementptr inbounds i32, i32* %a, i32 %i
+  %va = load i32, i32* %pa
+  %pb = getelementptr inbounds i32, i32* %b, i32 %i
+  %vb = load i32, i32* %pb
+  %m = mul i32 %va, %vb
+  %po = getelementptr inbounds i32, i32* %out, i32 %i
+  store i32 %m, i32* %po
+  %acc2 = add i32 %acc, %m
+  %inc = add nuw nsw i32 %i, 1
+  %cmp = icmp slt i32 %inc, %n
+  br i1 %cmp, label %loop, label %exit
+exit:
+  ret i32 %acc2
+}
+
+define i32 @kernel65(i32* %a, i32* %b, i32* %out, i32 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %loop ]
+  %acc = phi i32 [ 0, %entry ], [ %acc2, %loop ]
+  %pa = getelementptr inbounds i32, i32* %a, i32 %i
+  %va = load i32, i32* %pa
+  %pb = getelementptr inbounds i32, i32* %b, i32 %i
+  %vb = load i32, i32* %pb
+  %m = add i32 %va, %vb
+  %po = getelementptr inbounds i32, i32* %out, i32 %i
+  store i32 %m, i32* %po
+  %acc2 = or i32 %acc, %m
+  %inc = add nuw nsw i32 %i, 1
+  %cmp = icmp slt i32 %inc, %n
+  br i1 %cmp, label %loop, label %exit
+exit:
+  ret i32 %acc2
+}
+
+define i32 @kernel66(i32* %a, i32* %b, i32* %out, i32 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %loop ]
+  %acc = phi i32 [ 0, %entry ], [ %acc2, %loop ]
+  %pa = getelementptr inbounds i32, i32* %a, i32 %i
+  %va = load i32, i32* %pa
+  %pb = getelementptr inbounds i32, i32* %b, i32 %i
+  %vb = load i32, i32* %pb
+  %m = xor i32 %va, %vb
+  %po = getelementptr inbounds i32, i32* %out, i32 %i
+  store i32 %m, i32* %po
+  %acc2 = sub i32 %acc, %m
+  %inc = add nuw nsw i32 %i, 1
+  %cmp = icmp slt i32 %inc, %n
+  br i1 %cmp, label %loop, label %exit
+exit:
+  ret i32 %acc2
+}
+
+define i32 @kernel67(i32* %a, i32* %b, i32* %out, i32 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %loop ]
+  %acc = phi i32 [ 0, %entry ], [ %acc2, %loop ]
+  %pa = getelementptr inbounds i32, i32* %a, i32 %i
+  %va = load i32, i32* %pa
+  %pb = getelementptr inbounds i32, i32* %b, i32 %i
+  %vb = load i32, i32* %pb
+  %m = and i32 %va, %vb
+  %po = getelementptr inbounds i32, i32* %out, i32 %i
+  store i32 %m, i32* %po
+  %acc2 = xor i32 %acc, %m
+  %inc = add nuw nsw i32 %i, 1
+  %cmp = icmp slt i32 %inc, %n
+  br i1 %cmp, label %loop, label %exit
+exit:
+  ret i32 %acc2
+}
+
+define i32 @kernel68(i32* %a, i32* %b, i32* %out, i32 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %loop ]
+  %acc = phi i32 [ 0, %entry ], [ %acc2, %loop ]
+  %pa = getelementptr inbounds i32, i32* %a, i32 %i
+  %va = load i32, i32* %pa
+  %pb = getelementptr inbounds i32, i32* %b, i32 %i
+  %vb = load i32, i32* %pb
+  %m = mul i32 %va, %vb
+  %po = getelementptr inbounds i32, i32* %out, i32 %i
+  store i32 %m, i32* %po
+  %acc2 = add i32 %acc, %m
+  %inc = add nuw nsw i32 %i, 1
+  %cmp = icmp slt i32 %inc, %n
+  br i1 %cmp, label %loop, label %exit
+exit:
+  ret i32 %acc2
+}
+
+define i32 @kernel69(i32* %a, i32* %b, i32* %out, i32 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %loop ]
+  %acc = phi i32 [ 0, %entry ], [ %acc2, %loop ]
+  %pa = getelementptr inbounds i32, i32* %a, i32 %i
+  %va = load i32, i32* %pa
+  %pb = getelementptr inbounds i32, i32* %b, i32 %i
+  %vb = load i32, i32* %pb
+  %m = add i32 %va, %vb
+  %po = getelementptr inbounds i32, i32* %out, i32 %i
+  store i32 %m, i32* %po
+  %acc2 = or i32 %acc, %m
+  %inc = add nuw nsw i32 %i, 1
+  %cmp = icmp slt i32 %inc, %n
+  br i1 %cmp, label %loop, label %exit
+exit:
+  ret i32 %acc2
+}
+
+define i32 @kernel70(i32* %a, i32* %b, i32* %out, i32 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %loop ]
+  %acc = phi i32 [ 0, %entry ], [ %acc2, %loop ]
+  %pa = getelementptr inbounds i32, i32* %a, i32 %i
+  %va = load i32, i32* %pa
+  %pb = getelementptr inbounds i32, i32* %b, i32 %i
+  %vb = load i32, i32* %pb
+  %m = xor i32 %va, %vb
+  %po = getelementptr inbounds i32, i32* %out, i32 %i
+  store i32 %m, i32* %po
+  %acc2 = sub i32 %acc, %m
+  %inc = add nuw nsw i32 %i, 1
+  %cmp = icmp slt i32 %inc, %n
+  br i1 %cmp, label %loop, label %exit
+exit:
+  ret i32 %acc2
+}
+
+define i32 @kernel71(i32* %a, i32* %b, i32* %out, i32 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %loop ]
+  %acc = phi i32 [ 0, %entry ], [ %acc2, %loop ]
+  %pa = getelementptr inbounds i32, i32* %a, i32 %i
+  %va = load i32, i32* %pa
+  %pb = getelementptr inbounds i32, i32* %b, i32 %i
+  %vb = load i32, i32* %pb
+  %m = and i32 %va, %vb
+  %po = getelementptr inbounds i32, i32* %out, i32 %i
+  store i32 %m, i32* %po
+  %acc2 = xor i32 %acc, %m
+  %inc = add nuw nsw i32 %i, 1
+  %cmp = icmp slt i32 %inc, %n
+  br i1 %cmp, label %loop, label %exit
+exit:
+  ret i32 %acc2
+}
+
+define i32 @kernel72(i32* %a, i32* %b, i32* %out, i32 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %loop ]
+  %acc = phi i32 [ 0, %entry ], [ %acc2, %loop ]
+  %pa = getelementptr inbounds i32, i32* %a, i32 %i
+  %va = load i32, i32* %pa
+  %pb = getelementptr inbounds i32, i32* %b, i32 %i
+  %vb = load i32, i32* %pb
+  %m = mul i32 %va, %vb
+  %po = getelementptr inbounds i32, i32* %out, i32 %i
+  store i32 %m, i32* %po
+  %acc2 = add i32 %acc, %m
+  %inc = add nuw nsw i32 %i, 1
+  %cmp = icmp slt i32 %inc, %n
+  br i1 %cmp, label %loop, label %exit
+exit:
+  ret i32 %acc2
+}
+
+define i32 @kernel73(i32* %a, i32* %b, i32* %out, i32 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %loop ]
+  %acc = phi i32 [ 0, %entry ], [ %acc2, %loop ]
+  %pa = getelementptr inbounds i32, i32* %a, i32 %i
+  %va = load i32, i32* %pa
+  %pb = getelementptr inbounds i32, i32* %b, i32 %i
+  %vb = load i32, i32* %pb
+  %m = add i32 %va, %vb
+  %po = getelementptr inbounds i32, i32* %out, i32 %i
+  store i32 %m, i32* %po
+  %acc2 = or i32 %acc, %m
+  %inc = add nuw nsw i32 %i, 1
+  %cmp = icmp slt i32 %inc, %n
+  br i1 %cmp, label %loop, label %exit
+exit:
+  ret i32 %acc2
+}
+
+define i32 @kernel74(i32* %a, i32* %b, i32* %out, i32 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %loop ]
+  %acc = phi i32 [ 0, %entry ], [ %acc2, %loop ]
+  %pa = getelementptr inbounds i32, i32* %a, i32 %i
+  %va = load i32, i32* %pa
+  %pb = getelementptr inbounds i32, i32* %b, i32 %i
+  %vb = load i32, i32* %pb
+  %m = xor i32 %va, %vb
+  %po = getelementptr inbounds i32, i32* %out, i32 %i
+  store i32 %m, i32* %po
+  %acc2 = sub i32 %acc, %m
+  %inc = add nuw nsw i32 %i, 1
+  %cmp = icmp slt i32 %inc, %n
+  br i1 %cmp, label %loop, label %exit
+exit:
+  ret i32 %acc2
+}
+
+define i32 @kernel75(i32* %a, i32* %b, i32* %out, i32 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %loop ]
+  %acc = phi i32 [ 0, %entry ], [ %acc2, %loop ]
+  %pa = getelementptr inbounds i32, i32* %a, i32 %i
+  %va = load i32, i32* %pa
+  %pb = getelementptr inbounds i32, i32* %b, i32 %i
+  %vb = load i32, i32* %pb
+  %m = and i32 %va, %vb
+  %po = getelementptr inbounds i32, i32* %out, i32 %i
+  store i32 %m, i32* %po
+  %acc2 = xor i32 %acc, %m
+  %inc = add nuw nsw i32 %i, 1
+  %cmp = icmp slt i32 %inc, %n
+  br i1 %cmp, label %loop, label %exit
+exit:
+  ret i32 %acc2
+}
+
+define i32 @kernel76(i32* %a, i32* %b, i32* %out, i32 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %loop ]
+  %acc = phi i32 [ 0, %entry ], [ %acc2, %loop ]
+  %pa = getelementptr inbounds i32, i32* %a, i32 %i
+  %va = load i32, i32* %pa
+  %pb = getelementptr inbounds i32, i32* %b, i32 %i
+  %vb = load i32, i32* %pb
+  %m = mul i32 %va, %vb
+  %po = getelementptr inbounds i32, i32* %out, i32 %i
+  store i32 %m, i32* %po
+  %acc2 = add i32 %acc, %m
+  %inc = add nuw nsw i32 %i, 1
+  %cmp = icmp slt i32 %inc, %n
+  br i1 %cmp, label %loop, label %exit
+exit:
+  ret i32 %acc2
+}
+
+define i32 @kernel77(i32* %a, i32* %b, i32* %out, i32 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %loop ]
+  %acc = phi i32 [ 0, %entry ], [ %acc2, %loop ]
+  %pa = getelementptr inbounds i32, i32* %a, i32 %i
+  %va = load i32, i32* %pa
+  %pb = getelementptr inbounds i32, i32* %b, i32 %i
+  %vb = load i32, i32* %pb
+  %m = add i32 %va, %vb
+  %po = getelementptr inbounds i32, i32* %out, i32 %i
+  store i32 %m, i32* %po
+  %acc2 = or i32 %acc, %m
+  %inc = add nuw nsw i32 %i, 1
+  %cmp = icmp slt i32 %inc, %n
+  br i1 %cmp, label %loop, label %exit
+exit:
+  ret i32 %acc2
+}
+
+define i32 @kernel78(i32* %a, i32* %b, i32* %out, i32 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %loop ]
+  %acc = phi i32 [ 0, %entry ], [ %acc2, %loop ]
+  %pa = getelementptr inbounds i32, i32* %a, i32 %i
+  %va = load i32, i32* %pa
+  %pb = getelementptr inbounds i32, i32* %b, i32 %i
+  %vb = load i32, i32* %pb
+  %m = xor i32 %va, %vb
+  %po = getelementptr inbounds i32, i32* %out, i32 %i
+  store i32 %m, i32* %po
+  %acc2 = sub i32 %acc, %m
+  %inc = add nuw nsw i32 %i, 1
+  %cmp = icmp slt i32 %inc, %n
+  br i1 %cmp, label %loop, label %exit
+exit:
+  ret i32 %acc2
+}
+
+define i32 @kernel79(i32* %a, i32* %b, i32* %out, i32 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %loop ]
+  %acc = phi i32 [ 0, %entry ], [ %acc2, %loop ]
+  %pa = getelementptr inbounds i32, i32* %a, i32 %i
+  %va = load i32, i32* %pa
+  %pb = getelementptr inbounds i32, i32* %b, i32 %i
+  %vb = load i32, i32* %pb
+  %m = and i32 %va, %vb
+  %po = getelementptr inbounds i32, i32* %out, i32 %i
+  store i32 %m, i32* %po
+  %acc2 = xor i32 %acc, %m
+  %inc = add nuw nsw i32 %i, 1
+  %cmp = icmp slt i32 %inc, %n
+  br i1 %cmp, label %loop, label %exit
+exit:
+  ret i32 %acc2
+}
+
+define i32 @kernel80(i32* %a, i32* %b, i32* %out, i32 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %loop ]
+  %acc = phi i32 [ 0, %entry ], [ %acc2, %loop ]
+  %pa = getelementptr inbounds i32, i32* %a, i32 %i
+  %va = load i32, i32* %pa
+  %pb = getelementptr inbounds i32, i32* %b, i32 %i
+  %vb = load i32, i32* %pb
+  %m = mul i32 %va, %vb
+  %po = getelementptr inbounds i32, i32* %out, i32 %i
+  store i32 %m, i32* %po
+  %acc2 = add i32 %acc, %m
+  %inc = add nuw nsw i32 %i, 1
+  %cmp = icmp slt i32 %inc, %n
+  br i1 %cmp, label %loop, label %exit
+exit:
+  ret i32 %acc2
+}
+
+define i32 @kernel81(i32* %a, i32* %b, i32* %out, i32 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %loop ]
+  %acc = phi i32 [ 0, %entry ], [ %acc2, %loop ]
+  %pa = getelementptr inbounds i32, i32* %a, i32 %i
+  %va = load i32, i32* %pa
+  %pb = getelementptr inbounds i32, i32* %b, i32 %i
+  %vb = load i32, i32* %pb
+  %m = add i32 %va, %vb
+  %po = getelementptr inbounds i32, i32* %out, i32 %i
+  store i32 %m, i32* %po
+  %acc2 = or i32 %acc, %m
+  %inc = add nuw nsw i32 %i, 1
+  %cmp = icmp slt i32 %inc, %n
+  br i1 %cmp, label %loop, label %exit
+exit:
+  ret i32 %acc2
+}
+
+define i32 @kernel82(i32* %a, i32* %b, i32* %out, i32 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %loop ]
+  %acc = phi i32 [ 0, %entry ], [ %acc2, %loop ]
+  %pa = getelementptr inbounds i32, i32* %a, i32 %i
+  %va = load i32, i32* %pa
+  %pb = getelementptr inbounds i32, i32* %b, i32 %i
+  %vb = load i32, i32* %pb
+  %m = xor i32 %va, %vb
+  %po = getelementptr inbounds i32, i32* %out, i32 %i
+  store i32 %m, i32* %po
+  %acc2 = sub i32 %acc, %m
+  %inc = add nuw nsw i32 %i, 1
+  %cmp = icmp slt i32 %inc, %n
+  br i1 %cmp, label %loop, label %exit
+exit:
+  ret i32 %acc2
+}
+
+define i32 @kernel83(i32* %a, i32* %b, i32* %out, i32 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %loop ]
+  %acc = phi i32 [ 0, %entry ], [ %acc2, %loop ]
+  %pa = getelementptr inbounds i32, i32* %a, i32 %i
+  %va = load i32, i32* %pa
+  %pb = getelementptr inbounds i32, i32* %b, i32 %i
+  %vb = load i32, i32* %pb
+  %m = and i32 %va, %vb
+  %po = getelementptr inbounds i32, i32* %out, i32 %i
+  store i32 %m, i32* %po
+  %acc2 = xor i32 %acc, %m
+  %inc = add nuw nsw i32 %i, 1
+  %cmp = icmp slt i32 %inc, %n
+  br i1 %cmp, label %loop, label %exit
+exit:
+  ret i32 %acc2
+}
+
+define i32 @kernel84(i32* %a, i32* %b, i32* %out, i32 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %loop ]
+  %acc = phi i32 [ 0, %entry ], [ %acc2, %loop ]
+  %pa = getelementptr inbounds i32, i32* %a, i32 %i
+  %va = load i32, i32* %pa
+  %pb = getelementptr inbounds i32, i32* %b, i32 %i
+  %vb = load i32, i32* %pb
+  %m = mul i32 %va, %vb
+  %po = getelementptr inbounds i32, i32* %out, i32 %i
+  store i32 %m, i32* %po
+  %acc2 = add i32 %acc, %m
+  %inc = add nuw nsw i32 %i, 1
+  %cmp = icmp slt i32 %inc, %n
+  br i1 %cmp, label %loop, label %exit
+exit:
+  ret i32 %acc2
+}
+
+define i32 @kernel85(i32* %a, i32* %b, i32* %out, i32 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %loop ]
+  %acc = phi i32 [ 0, %entry ], [ %acc2, %loop ]
+  %pa = getelementptr inbounds i32, i32* %a, i32 %i
+  %va = load i32, i32* %pa
+  %pb = getelementptr inbounds i32, i32* %b, i32 %i
+  %vb = load i32, i32* %pb
+  %m = add i32 %va, %vb
+  %po = getelementptr inbounds i32, i32* %out, i32 %i
+  store i32 %m, i32* %po
+  %acc2 = or i32 %acc, %m
+  %inc = add nuw nsw i32 %i, 1
+  %cmp = icmp slt i32 %inc, %n
+  br i1 %cmp, label %loop, label %exit
+exit:
+  ret i32 %acc2
+}
+
+define i32 @kernel86(i32* %a, i32* %b, i32* %out, i32 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %loop ]
+  %acc = phi i32 [ 0, %entry ], [ %acc2, %loop ]
+  %pa = getelementptr inbounds i32, i32* %a, i32 %i
+  %va = load i32, i32* %pa
+  %pb = getelementptr inbounds i32, i32* %b, i32 %i
+  %vb = load i32, i32* %pb
+  %m = xor i32 %va, %vb
+  %po = getelementptr inbounds i32, i32* %out, i32 %i
+  store i32 %m, i32* %po
+  %acc2 = sub i32 %acc, %m
+  %inc = add nuw nsw i32 %i, 1
+  %cmp = icmp slt i32 %inc, %n
+  br i1 %cmp, label %loop, label %exit
+exit:
+  ret i32 %acc2
+}
+
+define i32 @kernel87(i32* %a, i32* %b, i32* %out, i32 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %loop ]
+  %acc = phi i32 [ 0, %entry ], [ %acc2, %loop ]
+  %pa = getelementptr inbounds i32, i32* %a, i32 %i
+  %va = load i32, i32* %pa
+  %pb = getelementptr inbounds i32, i32* %b, i32 %i
+  %vb = load i32, i32* %pb
+  %m = and i32 %va, %vb
+  %po = getelementptr inbounds i32, i32* %out, i32 %i
+  store i32 %m, i32* %po
+  %acc2 = xor i32 %acc, %m
+  %inc = add nuw nsw i32 %i, 1
+  %cmp = icmp slt i32 %inc, %n
+  br i1 %cmp, label %loop, label %exit
+exit:
+  ret i32 %acc2
+}
+
+define i32 @kernel88(i32* %a, i32* %b, i32* %out, i32 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %loop ]
+  %acc = phi i32 [ 0, %entry ], [ %acc2, %loop ]
+  %pa = getelementptr inbounds i32, i32* %a, i32 %i
+  %va = load i32, i32* %pa
+  %pb = getelementptr inbounds i32, i32* %b, i32 %i
+  %vb = load i32, i32* %pb
+  %m = mul i32 %va, %vb
+  %po = getelementptr inbounds i32, i32* %out, i32 %i
+  store i32 %m, i32* %po
+  %acc2 = add i32 %acc, %m
+  %inc = add nuw nsw i32 %i, 1
+  %cmp = icmp slt i32 %inc, %n
+  br i1 %cmp, label %loop, label %exit
+exit:
+  ret i32 %acc2
+}
+
+define i32 @kernel89(i32* %a, i32* %b, i32* %out, i32 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %loop ]
+  %acc = phi i32 [ 0, %entry ], [ %acc2, %loop ]
+  %pa = getelementptr inbounds i32, i32* %a, i32 %i
+  %va = load i32, i32* %pa
+  %pb = getelementptr inbounds i32, i32* %b, i32 %i
+  %vb = load i32, i32* %pb
+  %m = add i32 %va, %vb
+  %po = getelementptr inbounds i32, i32* %out, i32 %i
+  store i32 %m, i32* %po
+  %acc2 = or i32 %acc, %m
+  %inc = add nuw nsw i32 %i, 1
+  %cmp = icmp slt i32 %inc, %n
+  br i1 %cmp, label %loop, label %exit
+exit:
+  ret i32 %acc2
+}
+
+define i32 @kernel90(i32* %a, i32* %b, i32* %out, i32 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %loop ]
+  %acc = phi i32 [ 0, %entry ], [ %acc2, %loop ]
+  %pa = getelementptr inbounds i32, i32* %a, i32 %i
+  %va = load i32, i32* %pa
+  %pb = getelementptr inbounds i32, i32* %b, i32 %i
+  %vb = load i32, i32* %pb
+  %m = xor i32 %va, %vb
+  %po = getelementptr inbounds i32, i32* %out, i32 %i
+  store i32 %m, i32* %po
+  %acc2 = sub i32 %acc, %m
+  %inc = add nuw nsw i32 %i, 1
+  %cmp = icmp slt i32 %inc, %n
+  br i1 %cmp, label %loop, label %exit
+exit:
+  ret i32 %acc2
+}
+
+define i32 @kernel91(i32* %a, i32* %b, i32* %out, i32 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %loop ]
+  %acc = phi i32 [ 0, %entry ], [ %acc2, %loop ]
+  %pa = getelementptr inbounds i32, i32* %a, i32 %i
+  %va = load i32, i32* %pa
+  %pb = getelementptr inbounds i32, i32* %b, i32 %i
+  %vb = load i32, i32* %pb
+  %m = and i32 %va, %vb
+  %po = getelementptr inbounds i32, i32* %out, i32 %i
+  store i32 %m, i32* %po
+  %acc2 = xor i32 %acc, %m
+  %inc = add nuw nsw i32 %i, 1
+  %cmp = icmp slt i32 %inc, %n
+  br i1 %cmp, label %loop, label %exit
+exit:
+  ret i32 %acc2
+}
+
+define i32 @kernel92(i32* %a, i32* %b, i32* %out, i32 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %loop ]
+  %acc = phi i32 [ 0, %entry ], [ %acc2, %loop ]
+  %pa = getelementptr inbounds i32, i32* %a, i32 %i
+  %va = load i32, i32* %pa
+  %pb = getelementptr inbounds i32, i32* %b, i32 %i
+  %vb = load i32, i32* %pb
+  %m = mul i32 %va, %vb
+  %po = getelementptr inbounds i32, i32* %out, i32 %i
+  store i32 %m, i32* %po
+  %acc2 = add i32 %acc, %m
+  %inc = add nuw nsw i32 %i, 1
+  %cmp = icmp slt i32 %inc, %n
+  br i1 %cmp, label %loop, label %exit
+exit:
+  ret i32 %acc2
+}
+
+define i32 @kernel93(i32* %a, i32* %b, i32* %out, i32 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %loop ]
+  %acc = phi i32 [ 0, %entry ], [ %acc2, %loop ]
+  %pa = getelementptr inbounds i32, i32* %a, i32 %i
+  %va = load i32, i32* %pa
+  %pb = getelementptr inbounds i32, i32* %b, i32 %i
+  %vb = load i32, i32* %pb
+  %m = add i32 %va, %vb
+  %po = getelementptr inbounds i32, i32* %out, i32 %i
+  store i32 %m, i32* %po
+  %acc2 = or i32 %acc, %m
+  %inc = add nuw nsw i32 %i, 1
+  %cmp = icmp slt i32 %inc, %n
+  br i1 %cmp, label %loop, label %exit
+exit:
+  ret i32 %acc2
+}
+
+define i32 @kernel94(i32* %a, i32* %b, i32* %out, i32 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %loop ]
+  %acc = phi i32 [ 0, %entry ], [ %acc2, %loop ]
+  %pa = getelementptr inbounds i32, i32* %a, i32 %i
+  %va = load i32, i32* %pa
+  %pb = getelementptr inbounds i32, i32* %b, i32 %i
+  %vb = load i32, i32* %pb
+  %m = xor i32 %va, %vb
+  %po = getelementptr inbounds i32, i32* %out, i32 %i
+  store i32 %m, i32* %po
+  %acc2 = sub i32 %acc, %m
+  %inc = add nuw nsw i32 %i, 1
+  %cmp = icmp slt i32 %inc, %n
+  br i1 %cmp, label %loop, label %exit
+exit:
+  ret i32 %acc2
+}
+
+define i32 @kernel95(i32* %a, i32* %b, i32* %out, i32 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %loop ]
+  %acc = phi i32 [ 0, %entry ], [ %acc2, %loop ]
+  %pa = getelementptr inbounds i32, i32* %a, i32 %i
+  %va = load i32, i32* %pa
+  %pb = getelementptr inbounds i32, i32* %b, i32 %i
+  %vb = load i32, i32* %pb
+  %m = and i32 %va, %vb
+  %po = getelementptr inbounds i32, i32* %out, i32 %i
+  store i32 %m, i32* %po
+  %acc2 = xor i32 %acc, %m
+  %inc = add nuw nsw i32 %i, 1
+  %cmp = icmp slt i32 %inc, %n
+  br i1 %cmp, label %loop, label %exit
+exit:
+  ret i32 %acc2
+}
+
+define i32 @kernel96(i32* %a, i32* %b, i32* %out, i32 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %loop ]
+  %acc = phi i32 [ 0, %entry ], [ %acc2, %loop ]
+  %pa = getelementptr inbounds i32, i32* %a, i32 %i
+  %va = load i32, i32* %pa
+  %pb = getelementptr inbounds i32, i32* %b, i32 %i
+  %vb = load i32, i32* %pb
+  %m = mul i32 %va, %vb
+  %po = getelementptr inbounds i32, i32* %out, i32 %i
+  store i32 %m, i32* %po
+  %acc2 = add i32 %acc, %m
+  %inc = add nuw nsw i32 %i, 1
+  %cmp = icmp slt i32 %inc, %n
+  br i1 %cmp, label %loop, label %exit
+exit:
+  ret i32 %acc2
+}
+
+define i32 @kernel97(i32* %a, i32* %b, i32* %out, i32 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %loop ]
+  %acc = phi i32 [ 0, %entry ], [ %acc2, %loop ]
+  %pa = getelementptr inbounds i32, i32* %a, i32 %i
+  %va = load i32, i32* %pa
+  %pb = getelementptr inbounds i32, i32* %b, i32 %i
+  %vb = load i32, i32* %pb
+  %m = add i32 %va, %vb
+  %po = getelementptr inbounds i32, i32* %out, i32 %i
+  store i32 %m, i32* %po
+  %acc2 = or i32 %acc, %m
+  %inc = add nuw nsw i32 %i, 1
+  %cmp = icmp slt i32 %inc, %n
+  br i1 %cmp, label %loop, label %exit
+exit:
+  ret i32 %acc2
+}
+
+define i32 @kernel98(i32* %a, i32* %b, i32* %out, i32 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %loop ]
+  %acc = phi i32 [ 0, %entry ], [ %acc2, %loop ]
+  %pa = getelementptr inbounds i32, i32* %a, i32 %i
+  %va = load i32, i32* %pa
+  %pb = getelementptr inbounds i32, i32* %b, i32 %i
+  %vb = load i32, i32* %pb
+  %m = xor i32 %va, %vb
+  %po = getelementptr inbounds i32, i32* %out, i32 %i
+  store i32 %m, i32* %po
+  %acc2 = sub i32 %acc, %m
+  %inc = add nuw nsw i32 %i, 1
+  %cmp = icmp slt i32 %inc, %n
+  br i1 %cmp, label %loop, label %exit
+exit:
+  ret i32 %acc2
+}
+
+define i32 @kernel99(i32* %a, i32* %b, i32* %out, i32 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %loop ]
+  %acc = phi i32 [ 0, %entry ], [ %acc2, %loop ]
+  %pa = getelementptr inbounds i32, i32* %a, i32 %i
+  %va = load i32, i32* %pa
+  %pb = getelementptr inbounds i32, i32* %b, i32 %i
+  %vb = load i32, i32* %pb
+  %m = and i32 %va, %vb
+  %po = getelementptr inbounds i32, i32* %out, i32 %i
+  store i32 %m, i32* %po
+  %acc2 = xor i32 %acc, %m
+  %inc = add nuw nsw i32 %i, 1
+  %cmp = icmp slt i32 %inc, %n
+  br i1 %cmp, label %loop, label %exit
+exit:
+  ret i32 %acc2
+}
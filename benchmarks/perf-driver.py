@@ -0,0 +1,114 @@
+#!/usr/bin/env python
+
+"""Driver for the in-tree compile-time benchmarks (the check-perf target).
+
+Runs a fixed set of pass pipelines over the IR corpora in benchmarks/Inputs
+with the just-built opt and llc, reports the best wall time of several runs
+for each benchmark, and optionally compares against a recorded baseline.
+
+Timings depend on the host, so baselines are never checked in. Record one on
+the machine that will run the comparisons:
+
+  $ perf-driver.py --bindir ../build/bin --update-baseline
+
+Later runs with --baseline pointing at that file exit non-zero if any
+benchmark regresses past the threshold (default 1.20x), which is what the
+check-perf build target does.
+"""
+
+from __future__ import print_function
+
+import argparse
+import json
+import os
+import subprocess
+import sys
+import time
+
+# Each benchmark is (name, tool, extra arguments, input file). The inputs are
+# deliberately repetitive: they exist to exercise the pass, not to be read.
+BENCHMARKS = [
+    ('instcombine', 'opt', ['-instcombine', '-disable-output'],
+     'instcombine.ll'),
+    ('gvn', 'opt', ['-gvn', '-disable-output'], 'gvn.ll'),
+    ('isel', 'llc', ['-O2', '-o', os.devnull], 'isel.ll'),
+    ('isel-O0-fastisel', 'llc',
+     ['-O0', '-mtriple=x86_64-unknown-linux-gnu', '-o', os.devnull],
+     'isel.ll'),
+    ('isel-O0-globalisel', 'llc',
+     ['-O0', '-mtriple=x86_64-unknown-linux-gnu', '-global-isel',
+      '-global-isel-abort=0', '-o', os.devnull],
+     'isel.ll'),
+]
+
+
+def run_one(bindir, inputs, name, tool, args, filename, runs):
+    cmd = [os.path.join(bindir, tool)] + args + [os.path.join(inputs,
+                                                              filename)]
+    best = None
+    for _ in range(runs):
+        start = time.time()
+        subprocess.check_call(cmd)
+        elapsed = time.time() - start
+        if best is None or elapsed < best:
+            best = elapsed
+    return best
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument('--bindir', required=True,
+                        help='Directory containing the built opt and llc.')
+    parser.add_argument('--inputs',
+                        default=os.path.join(os.path.dirname(__file__),
+                                             'Inputs'),
+                        help='Directory containing the benchmark inputs.')
+    parser.add_argument('--baseline',
+                        help='Baseline timings to compare against, if the '
+                             'file exists.')
+    parser.add_argument('--update-baseline', action='store_true',
+                        help='Write the measured timings to --baseline '
+                             'instead of comparing.')
+    parser.add_argument('--runs', type=int, default=5,
+                        help='Runs per benchmark; the best time is kept.')
+    parser.add_argument('--threshold', type=float, default=1.20,
+                        help='Fail if time exceeds baseline by this factor.')
+    args = parser.parse_args()
+
+    results = {}
+    for name, tool, tool_args, filename in BENCHMARKS:
+        best = run_one(args.bindir, args.inputs, name, tool, tool_args,
+                       filename, args.runs)
+        results[name] = best
+        print('%-16s %8.3fs' % (name, best))
+
+    if args.update_baseline:
+        if not args.baseline:
+            parser.error('--update-baseline requires --baseline')
+        with open(args.baseline, 'w') as f:
+            json.dump(results, f, indent=2, sort_keys=True)
+        print('Baseline written to %s' % args.baseline)
+        return 0
+
+    if not args.baseline or not os.path.exists(args.baseline):
+        print('No baseline; timings reported only. Record one with '
+              '--update-baseline.')
+        return 0
+
+    with open(args.baseline) as f:
+        baseline = json.load(f)
+
+    failed = False
+    for name, best in sorted(results.items()):
+        if name not in baseline:
+            continue
+        ratio = best / baseline[name]
+        if ratio > args.threshold:
+            print('regression: %s is %.2fx its baseline of %.3fs'
+                  % (name, ratio, baseline[name]))
+            failed = True
+    return 1 if failed else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -78,6 +78,10 @@ if(LLVM_ENABLE_EXPENSIVE_CHECKS)
   add_definitions(-D_GLIBCXX_DEBUG)
 endif()
 
+if(LLVM_ENABLE_ALLOC_PROFILE)
+  add_definitions(-DLLVM_ENABLE_ALLOC_PROFILE)
+endif()
+
 string(TOUPPER "${LLVM_ABI_BREAKING_CHECKS}" uppercase_LLVM_ABI_BREAKING_CHECKS)
 
 if( uppercase_LLVM_ABI_BREAKING_CHECKS STREQUAL "WITH_ASSERTS" )
@@ -9,6 +9,7 @@
 #ifndef LLVM_ADT_DELTAALGORITHM_H
 #define LLVM_ADT_DELTAALGORITHM_H
 
+#include <cstddef>
 #include <set>
 #include <vector>
 
@@ -77,6 +78,18 @@ protected:
   /// ExecuteOneTest - Execute a single test predicate on the change set \p S.
   virtual bool ExecuteOneTest(const changeset_ty &S) = 0;
 
+  /// FindFirstPassingTest - Return the index of the first change set in
+  /// \p Candidates which satisfies the test predicate, or Candidates.size()
+  /// if no candidate does.
+  ///
+  /// The candidates at one search level are independent of one another. The
+  /// default implementation tests them in order and stops at the first
+  /// success; subclasses whose predicate runs an external process may
+  /// override this to execute the candidates concurrently, provided they
+  /// still return the lowest passing index so the search remains
+  /// deterministic.
+  virtual size_t FindFirstPassingTest(const changesetlist_ty &Candidates);
+
   DeltaAlgorithm& operator=(const DeltaAlgorithm&) = default;
 
 public:
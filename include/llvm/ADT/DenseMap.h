@@ -17,18 +17,25 @@
 #include "llvm/ADT/DenseMapInfo.h"
 #include "llvm/ADT/EpochTracker.h"
 #include "llvm/Support/AlignOf.h"
+#include "llvm/Support/AllocProfile.h"
 #include "llvm/Support/Compiler.h"
 #include "llvm/Support/MathExtras.h"
 #include "llvm/Support/type_traits.h"
 #include <algorithm>
 #include <cassert>
 #include <cstddef>
+#include <cstdint>
 #include <cstring>
 #include <iterator>
 #include <limits>
 #include <new>
+#include <type_traits>
 #include <utility>
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 namespace llvm {
 
 namespace detail {
@@ -43,6 +50,63 @@ struct DenseMapPair : public std::pair<KeyT, ValueT> {
   const ValueT &getSecond() const { return std::pair<KeyT, ValueT>::second; }
 };
 
+// Control byte values for the group-probed bucket layout.  A full bucket
+// stores the low 7 bits of its key's hash, so a one-byte compare filters out
+// almost every non-matching bucket without touching the bucket array itself.
+enum : uint8_t {
+  GroupProbeEmpty = 0x80,
+  GroupProbeTombstone = 0xFE
+};
+
+/// The number of control bytes probed at a time.  This matches the width of
+/// an SSE2 vector; the portable fallback scans the same group size.
+const unsigned GroupProbeWidth = 16;
+
+/// Return a bitmask with one bit per control byte in the group, set when the
+/// byte equals \p Tag.
+inline unsigned matchGroupTag(const uint8_t *Group, uint8_t Tag) {
+#if defined(__SSE2__)
+  __m128i G = _mm_loadu_si128(reinterpret_cast<const __m128i *>(Group));
+  __m128i T = _mm_set1_epi8(static_cast<char>(Tag));
+  return _mm_movemask_epi8(_mm_cmpeq_epi8(G, T));
+#else
+  unsigned Mask = 0;
+  for (unsigned I = 0; I != GroupProbeWidth; ++I)
+    Mask |= unsigned(Group[I] == Tag) << I;
+  return Mask;
+#endif
+}
+
+/// True when KeyInfoT opts its maps into the group-probed bucket layout,
+/// i.e. when it is an instantiation of GroupProbedDenseMapInfo.  This is a
+/// pure type-pattern match rather than a member sniff so that evaluating it
+/// in DenseMap's base-class list never instantiates DenseMapInfo<KeyT>;
+/// clients must stay free to declare map members before providing their
+/// explicit DenseMapInfo specialization.
+template <typename KeyInfoT> struct DenseMapInfoGroupProbing {
+  static const bool value = false;
+};
+
+} // end namespace detail
+
+/// Opt a DenseMap instantiation into the SwissTable-style control-byte bucket
+/// layout by using this as its KeyInfoT, e.g.
+///   DenseMap<K, V, GroupProbedDenseMapInfo<K>>
+/// The map then keeps a one-byte control array next to the buckets and probes
+/// it a vector register at a time, so a lookup only touches buckets whose
+/// hash tag matches.  This costs one byte per bucket and is most profitable
+/// for large maps with expensive-to-compare or cache-unfriendly buckets.
+/// SmallDenseMap ignores the opt-in and keeps the plain layout.
+template <typename T, typename Info = DenseMapInfo<T>>
+struct GroupProbedDenseMapInfo : Info {};
+
+namespace detail {
+
+template <typename T, typename Info>
+struct DenseMapInfoGroupProbing<GroupProbedDenseMapInfo<T, Info>> {
+  static const bool value = true;
+};
+
 } // end namespace detail
 
 template <
@@ -51,7 +115,7 @@ template <
 class DenseMapIterator;
 
 template <typename DerivedT, typename KeyT, typename ValueT, typename KeyInfoT,
-          typename BucketT>
+          typename BucketT, bool GroupProbing = false>
 class DenseMapBase : public DebugEpochBase {
   template <typename T>
   using const_arg_type_t = typename const_pointer_or_const_ref<T>::type;
@@ -117,6 +181,7 @@ public:
       }
     }
     assert(NumEntries == 0 && "Node count imbalance!");
+    resetControlBytes();
     setNumEntries(0);
     setNumTombstones(0);
   }
@@ -250,6 +315,7 @@ public:
 
     TheBucket->getSecond().~ValueT();
     TheBucket->getFirst() = getTombstoneKey();
+    setControlByte(TheBucket, detail::GroupProbeTombstone);
     decrementNumEntries();
     incrementNumTombstones();
     return true;
@@ -258,6 +324,7 @@ public:
     BucketT *TheBucket = &*I;
     TheBucket->getSecond().~ValueT();
     TheBucket->getFirst() = getTombstoneKey();
+    setControlByte(TheBucket, detail::GroupProbeTombstone);
     decrementNumEntries();
     incrementNumTombstones();
   }
@@ -323,6 +390,7 @@ protected:
     const KeyT EmptyKey = getEmptyKey();
     for (BucketT *B = getBuckets(), *E = getBucketsEnd(); B != E; ++B)
       ::new (&B->getFirst()) KeyT(EmptyKey);
+    resetControlBytes();
   }
 
   /// Returns the number of buckets to allocate to ensure that the DenseMap can
@@ -352,6 +420,8 @@ protected:
         assert(!FoundVal && "Key already in new map?");
         DestBucket->getFirst() = std::move(B->getFirst());
         ::new (&DestBucket->getSecond()) ValueT(std::move(B->getSecond()));
+        setControlByte(DestBucket,
+                       getControlTag(getHashValue(DestBucket->getFirst())));
         incrementNumEntries();
 
         // Free the value.
@@ -362,8 +432,8 @@ protected:
   }
 
   template <typename OtherBaseT>
-  void copyFrom(
-      const DenseMapBase<OtherBaseT, KeyT, ValueT, KeyInfoT, BucketT> &other) {
+  void copyFrom(const DenseMapBase<OtherBaseT, KeyT, ValueT, KeyInfoT, BucketT,
+                                   GroupProbing> &other) {
     assert(&other != this);
     assert(getNumBuckets() == other.getNumBuckets());
 
@@ -382,6 +452,7 @@ protected:
           ::new (&getBuckets()[i].getSecond())
               ValueT(other.getBuckets()[i].getSecond());
       }
+    rebuildControlBytes();
   }
 
   static unsigned getHashValue(const KeyT &Val) {
@@ -441,6 +512,44 @@ private:
     return getBuckets() + getNumBuckets();
   }
 
+  uint8_t *getControlBytes() const {
+    return static_cast<const DerivedT *>(this)->getControlBytes();
+  }
+
+  /// Return the one-byte hash tag stored in the control array for a full
+  /// bucket.  The top bit is clear so tags never collide with the empty or
+  /// tombstone markers.
+  static uint8_t getControlTag(unsigned Hash) { return Hash & 0x7F; }
+
+  void setControlByte(const BucketT *B, uint8_t C) {
+    if (GroupProbing)
+      getControlBytes()[B - getBuckets()] = C;
+  }
+
+  void resetControlBytes() {
+    if (GroupProbing && getNumBuckets() != 0)
+      memset(getControlBytes(), detail::GroupProbeEmpty, getNumBuckets());
+  }
+
+  /// Recompute the control bytes from the bucket array.  This is only needed
+  /// after bulk operations (copyFrom) that write buckets directly instead of
+  /// going through insertion.
+  void rebuildControlBytes() {
+    if (!GroupProbing || getNumBuckets() == 0)
+      return;
+
+    const KeyT EmptyKey = getEmptyKey(), TombstoneKey = getTombstoneKey();
+    uint8_t *Ctrl = getControlBytes();
+    for (BucketT *B = getBuckets(), *E = getBucketsEnd(); B != E; ++B, ++Ctrl) {
+      if (KeyInfoT::isEqual(B->getFirst(), EmptyKey))
+        *Ctrl = detail::GroupProbeEmpty;
+      else if (KeyInfoT::isEqual(B->getFirst(), TombstoneKey))
+        *Ctrl = detail::GroupProbeTombstone;
+      else
+        *Ctrl = getControlTag(getHashValue(B->getFirst()));
+    }
+  }
+
   void grow(unsigned AtLeast) {
     static_cast<DerivedT *>(this)->grow(AtLeast);
   }
@@ -505,6 +614,8 @@ private:
     if (!KeyInfoT::isEqual(TheBucket->getFirst(), EmptyKey))
       decrementNumTombstones();
 
+    setControlByte(TheBucket, getControlTag(getHashValue(Lookup)));
+
     return TheBucket;
   }
 
@@ -531,6 +642,9 @@ private:
            !KeyInfoT::isEqual(Val, TombstoneKey) &&
            "Empty/Tombstone value shouldn't be inserted into map!");
 
+    if (GroupProbing)
+      return LookupBucketForGroupProbed(Val, FoundBucket);
+
     unsigned BucketNo = getHashValue(Val) & (NumBuckets-1);
     unsigned ProbeAmt = 1;
     while (true) {
@@ -563,6 +677,81 @@ private:
     }
   }
 
+  /// The group-probed analogue of LookupBucketFor: probe the control bytes a
+  /// group at a time and only compare keys whose one-byte hash tag matches.
+  template <typename LookupKeyT>
+  bool LookupBucketForGroupProbed(const LookupKeyT &Val,
+                                  const BucketT *&FoundBucket) const {
+    const BucketT *BucketsPtr = getBuckets();
+    const unsigned NumBuckets = getNumBuckets();
+    const uint8_t *Ctrl = getControlBytes();
+    const unsigned Hash = getHashValue(Val);
+    const uint8_t Tag = getControlTag(Hash);
+
+    const BucketT *FoundTombstone = nullptr;
+
+    if (NumBuckets < detail::GroupProbeWidth) {
+      // Tables smaller than a probe group are scanned linearly; the control
+      // bytes still filter out all buckets whose tag cannot match.
+      const BucketT *FoundEmpty = nullptr;
+      for (unsigned I = 0; I != NumBuckets; ++I) {
+        if (Ctrl[I] == Tag &&
+            LLVM_LIKELY(KeyInfoT::isEqual(Val, BucketsPtr[I].getFirst()))) {
+          FoundBucket = BucketsPtr + I;
+          return true;
+        }
+        if (Ctrl[I] == detail::GroupProbeTombstone && !FoundTombstone)
+          FoundTombstone = BucketsPtr + I;
+        if (Ctrl[I] == detail::GroupProbeEmpty && !FoundEmpty)
+          FoundEmpty = BucketsPtr + I;
+      }
+      FoundBucket = FoundTombstone ? FoundTombstone : FoundEmpty;
+      assert(FoundBucket && "Map has neither an empty bucket nor a tombstone");
+      return false;
+    }
+
+    const unsigned NumGroups = NumBuckets / detail::GroupProbeWidth;
+    unsigned GroupNo = (Hash >> 7) & (NumGroups - 1);
+    unsigned ProbeAmt = 1;
+    while (true) {
+      const uint8_t *GroupCtrl = Ctrl + GroupNo * detail::GroupProbeWidth;
+      const BucketT *GroupBuckets =
+          BucketsPtr + GroupNo * detail::GroupProbeWidth;
+
+      unsigned Matches = detail::matchGroupTag(GroupCtrl, Tag);
+      while (Matches) {
+        unsigned I = countTrailingZeros(Matches);
+        if (LLVM_LIKELY(KeyInfoT::isEqual(Val, GroupBuckets[I].getFirst()))) {
+          FoundBucket = GroupBuckets + I;
+          return true;
+        }
+        Matches &= Matches - 1;
+      }
+
+      // If Val ends up not being in the map, we prefer to return the first
+      // tombstone on the probe sequence rather than something that would
+      // require more probing.
+      if (!FoundTombstone)
+        if (unsigned Tombstones =
+                detail::matchGroupTag(GroupCtrl, detail::GroupProbeTombstone))
+          FoundTombstone = GroupBuckets + countTrailingZeros(Tombstones);
+
+      // An empty bucket terminates the probe sequence: the key cannot be in
+      // the map.
+      if (unsigned Empties =
+              detail::matchGroupTag(GroupCtrl, detail::GroupProbeEmpty)) {
+        FoundBucket = FoundTombstone
+                          ? FoundTombstone
+                          : GroupBuckets + countTrailingZeros(Empties);
+        return false;
+      }
+
+      // Quadratic probing over whole groups, mirroring the per-bucket probing
+      // above.
+      GroupNo = (GroupNo + ProbeAmt++) & (NumGroups - 1);
+    }
+  }
+
   template <typename LookupKeyT>
   bool LookupBucketFor(const LookupKeyT &Val, BucketT *&FoundBucket) {
     const BucketT *ConstFoundBucket;
@@ -586,11 +775,18 @@ template <typename KeyT, typename ValueT,
           typename KeyInfoT = DenseMapInfo<KeyT>,
           typename BucketT = detail::DenseMapPair<KeyT, ValueT>>
 class DenseMap : public DenseMapBase<DenseMap<KeyT, ValueT, KeyInfoT, BucketT>,
-                                     KeyT, ValueT, KeyInfoT, BucketT> {
+                                     KeyT, ValueT, KeyInfoT, BucketT,
+                                     detail::DenseMapInfoGroupProbing<
+                                         KeyInfoT>::value> {
+  /// True when KeyInfoT opts this map into the control-byte bucket layout.
+  static const bool GroupProbing =
+      detail::DenseMapInfoGroupProbing<KeyInfoT>::value;
+
   // Lift some types from the dependent base class into this class for
   // simplicity of referring to them.
-  typedef DenseMapBase<DenseMap, KeyT, ValueT, KeyInfoT, BucketT> BaseT;
-  friend class DenseMapBase<DenseMap, KeyT, ValueT, KeyInfoT, BucketT>;
+  typedef DenseMapBase<DenseMap, KeyT, ValueT, KeyInfoT, BucketT, GroupProbing>
+      BaseT;
+  friend BaseT;
 
   BucketT *Buckets;
   unsigned NumEntries;
@@ -724,6 +920,11 @@ private:
     return NumBuckets;
   }
 
+  uint8_t *getControlBytes() const {
+    return GroupProbing ? reinterpret_cast<uint8_t *>(Buckets + NumBuckets)
+                        : nullptr;
+  }
+
   bool allocateBuckets(unsigned Num) {
     NumBuckets = Num;
     if (NumBuckets == 0) {
@@ -731,7 +932,13 @@ private:
       return false;
     }
 
-    Buckets = static_cast<BucketT*>(operator new(sizeof(BucketT) * NumBuckets));
+    // The control bytes of the group-probed layout live in the same
+    // allocation, directly after the buckets.
+    size_t AllocSize = sizeof(BucketT) * NumBuckets;
+    if (GroupProbing)
+      AllocSize += NumBuckets;
+    LLVM_RECORD_ALLOC_GROW(DenseMapGrow, AllocSize);
+    Buckets = static_cast<BucketT *>(operator new(AllocSize));
     return true;
   }
 };
@@ -1017,6 +1224,10 @@ private:
     return Small ? InlineBuckets : getLargeRep()->NumBuckets;
   }
 
+  // SmallDenseMap does not support the group-probed bucket layout; maps whose
+  // KeyInfoT opts in keep the plain layout here.
+  uint8_t *getControlBytes() const { return nullptr; }
+
   void deallocateBuckets() {
     if (Small)
       return;
@@ -1027,6 +1238,7 @@ private:
 
   LargeRep allocateBuckets(unsigned Num) {
     assert(Num > InlineBuckets && "Must allocate more buckets than are inline");
+    LLVM_RECORD_ALLOC_GROW(DenseMapGrow, sizeof(BucketT) * Num);
     LargeRep Rep = {
       static_cast<BucketT*>(operator new(sizeof(BucketT) * Num)), Num
     };
@@ -755,6 +755,55 @@ public:
   void Profile(FoldingSetNodeID &ID) const { ID.AddNodeID(FastID); }
 };
 
+//===----------------------------------------------------------------------===//
+/// HashedFoldingSetNode - This is a subclass of FoldingSetNode which caches
+/// the hash of the node's profile once the folding set has computed it. A
+/// node type opts in by deriving from this class and specializing its
+/// FoldingSetTrait to inherit from HashedFoldingSetTrait below; lookups then
+/// compare the cached hash before re-profiling the node, which prunes almost
+/// every mismatching node off a bucket walk for the price of one word per
+/// node. Only types whose profile never changes while the node is in the set
+/// may use this.
+class HashedFoldingSetNode : public FoldingSetNode {
+  mutable unsigned CachedProfileHash = 0;
+
+public:
+  /// Whether a profile hash has been cached yet. A node whose profile
+  /// genuinely hashes to zero is never considered cached and is simply
+  /// re-profiled on every comparison.
+  bool hasCachedProfileHash() const { return CachedProfileHash != 0; }
+  unsigned getCachedProfileHash() const { return CachedProfileHash; }
+  void setCachedProfileHash(unsigned Hash) const { CachedProfileHash = Hash; }
+};
+
+/// HashedFoldingSetTrait - FoldingSetTrait implementation for node types
+/// deriving from HashedFoldingSetNode.
+template <typename T>
+struct HashedFoldingSetTrait : DefaultFoldingSetTrait<T> {
+  static bool Equals(T &X, const FoldingSetNodeID &ID, unsigned IDHash,
+                     FoldingSetNodeID &TempID) {
+    // A cached hash different from the lookup hash proves inequality without
+    // re-profiling the node.
+    if (X.hasCachedProfileHash() && X.getCachedProfileHash() != IDHash)
+      return false;
+    FoldingSetTrait<T>::Profile(X, TempID);
+    bool Equal = TempID == ID;
+    // On a match the lookup hash is the node's own profile hash, so remember
+    // it without hashing again.
+    if (Equal)
+      X.setCachedProfileHash(IDHash);
+    return Equal;
+  }
+
+  static unsigned ComputeHash(T &X, FoldingSetNodeID &TempID) {
+    if (X.hasCachedProfileHash())
+      return X.getCachedProfileHash();
+    unsigned Hash = DefaultFoldingSetTrait<T>::ComputeHash(X, TempID);
+    X.setCachedProfileHash(Hash);
+    return Hash;
+  }
+};
+
 //===----------------------------------------------------------------------===//
 // Partial specializations of FoldingSetTrait.
 
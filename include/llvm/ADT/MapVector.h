@@ -69,6 +69,12 @@ public:
   std::pair<KeyT, ValueT>       &back()        { return Vector.back(); }
   const std::pair<KeyT, ValueT> &back()  const { return Vector.back(); }
 
+  /// Grow the underlying containers to hold at least \p NumEntries.
+  void reserve(size_type NumEntries) {
+    Map.reserve(NumEntries);
+    Vector.reserve(NumEntries);
+  }
+
   void clear() {
     Map.clear();
     Vector.clear();
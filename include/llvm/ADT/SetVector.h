@@ -137,6 +137,13 @@ public:
     return vector_[n];
   }
 
+  /// \brief Grow the SetVector so that it can contain at least \p Size items
+  /// before resizing again.
+  void reserve(size_type Size) {
+    set_.reserve(Size);
+    vector_.reserve(Size);
+  }
+
   /// \brief Insert a new element into the SetVector.
   /// \returns true if the element was inserted into the SetVector.
   bool insert(const value_type &X) {
@@ -16,6 +16,7 @@
 
 #include "llvm/ADT/iterator_range.h"
 #include "llvm/Support/AlignOf.h"
+#include "llvm/Support/AllocProfile.h"
 #include "llvm/Support/Compiler.h"
 #include "llvm/Support/MathExtras.h"
 #include "llvm/Support/type_traits.h"
@@ -237,6 +238,7 @@ void SmallVectorTemplateBase<T, isPodLike>::grow(size_t MinSize) {
   size_t NewCapacity = size_t(NextPowerOf2(CurCapacity+2));
   if (NewCapacity < MinSize)
     NewCapacity = MinSize;
+  LLVM_RECORD_ALLOC_GROW(SmallVectorGrow, NewCapacity * sizeof(T));
   T *NewElts = static_cast<T*>(malloc(NewCapacity*sizeof(T)));
 
   // Move the elements over.
@@ -185,7 +185,7 @@ class AAResults {
 public:
   // Make these results default constructable and movable. We have to spell
   // these out because MSVC won't synthesize them.
-  AAResults(const TargetLibraryInfo &TLI) : TLI(TLI) {}
+  AAResults(const TargetLibraryInfo &TLI);
   AAResults(AAResults &&Arg);
   ~AAResults();
 
@@ -629,6 +629,12 @@ private:
   std::vector<std::unique_ptr<Concept>> AAs;
 
   std::vector<AnalysisKey *> AADeps;
+
+  /// A cache of \c alias results that persists across queries and passes for
+  /// as long as this aggregation is preserved. Lazily constructed when the
+  /// -aa-persistent-query-cache flag is set; see AliasAnalysis.cpp.
+  struct AliasQueryCache;
+  std::unique_ptr<AliasQueryCache> QueryCache;
 };
 
 /// Temporary typedef for legacy code that uses a generic \c AliasAnalysis
@@ -0,0 +1,127 @@
+//===- CFGTraversal.h - Cached CFG traversal orders -------------*- C++ -*-===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+//
+// This file defines an analysis that caches the reverse post-order of a
+// function's CFG. Many passes build their own ReversePostOrderTraversal,
+// each allocating a visit set and re-walking the whole graph; keeping one
+// ordering per function as an analysis lets CFG-preserving pipelines share
+// a single walk.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_ANALYSIS_CFGTRAVERSAL_H
+#define LLVM_ANALYSIS_CFGTRAVERSAL_H
+
+#include "llvm/ADT/ArrayRef.h"
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/iterator_range.h"
+#include "llvm/IR/PassManager.h"
+#include "llvm/Pass.h"
+#include <vector>
+
+namespace llvm {
+
+class BasicBlock;
+class Function;
+class raw_ostream;
+
+/// The cached traversal orders of a function's CFG.
+///
+/// Holds the reachable basic blocks in reverse post-order together with each
+/// block's position in that order. Unreachable blocks are not visited, which
+/// matches what a fresh ReversePostOrderTraversal of the function would see.
+class CFGTraversal {
+  std::vector<BasicBlock *> RPO;
+  DenseMap<const BasicBlock *, unsigned> RPONumbers;
+
+public:
+  /// Recompute the orders for \p F.
+  void recalculate(Function &F);
+
+  /// The reachable blocks in reverse post-order.
+  ArrayRef<BasicBlock *> getRPO() const { return RPO; }
+
+  /// The reachable blocks in post-order.
+  iterator_range<std::vector<BasicBlock *>::const_reverse_iterator>
+  getPO() const {
+    return make_range(RPO.rbegin(), RPO.rend());
+  }
+
+  /// Return the position of \p BB in the reverse post-order, or ~0u if the
+  /// block is unreachable.
+  unsigned getRPONumber(const BasicBlock *BB) const {
+    auto I = RPONumbers.find(BB);
+    return I == RPONumbers.end() ? ~0u : I->second;
+  }
+
+  /// Return true if \p BB is reachable from the entry block.
+  bool contains(const BasicBlock *BB) const { return RPONumbers.count(BB); }
+
+  void releaseMemory() {
+    RPO.clear();
+    RPONumbers.clear();
+  }
+
+  void print(raw_ostream &OS) const;
+
+  /// Handle invalidation explicitly.
+  bool invalidate(Function &F, const PreservedAnalyses &PA,
+                  FunctionAnalysisManager::Invalidator &);
+};
+
+/// \brief Analysis pass which computes a \c CFGTraversal.
+class CFGTraversalAnalysis : public AnalysisInfoMixin<CFGTraversalAnalysis> {
+  friend AnalysisInfoMixin<CFGTraversalAnalysis>;
+  static AnalysisKey Key;
+
+public:
+  /// \brief Provide the result typedef for this analysis pass.
+  typedef CFGTraversal Result;
+
+  /// \brief Run the analysis pass over a function and produce the traversal
+  ///        orders of its CFG.
+  CFGTraversal run(Function &F, FunctionAnalysisManager &);
+};
+
+/// \brief Printer pass for the \c CFGTraversal.
+class CFGTraversalPrinterPass : public PassInfoMixin<CFGTraversalPrinterPass> {
+  raw_ostream &OS;
+
+public:
+  explicit CFGTraversalPrinterPass(raw_ostream &OS);
+  PreservedAnalyses run(Function &F, FunctionAnalysisManager &AM);
+};
+
+struct CFGTraversalWrapperPass : public FunctionPass {
+  static char ID; // Pass identification, replacement for typeid
+  CFGTraversal CT;
+
+  CFGTraversalWrapperPass() : FunctionPass(ID) {
+    initializeCFGTraversalWrapperPassPass(*PassRegistry::getPassRegistry());
+  }
+
+  CFGTraversal &getCFGTraversal() { return CT; }
+  const CFGTraversal &getCFGTraversal() const { return CT; }
+
+  bool runOnFunction(Function &F) override;
+
+  void getAnalysisUsage(AnalysisUsage &AU) const override {
+    AU.setPreservesAll();
+  }
+
+  void releaseMemory() override {
+    CT.releaseMemory();
+  }
+
+  void print(raw_ostream &OS, const Module *) const override;
+};
+
+} // End llvm namespace
+
+#endif
@@ -573,10 +573,18 @@ public:
       // directly handle the function analysis manager's invalidation here.
       FAM.invalidate(N->getFunction(), PassPA);
 
+      // If the pass preserves all analyses it cannot have mutated the IR for
+      // this function, so the call graph cannot have changed either and we
+      // can skip the update walk over the function body entirely.
+      bool FunctionChanged = !PassPA.areAllPreserved();
+
       // Then intersect the preserved set so that invalidation of module
       // analyses will eventually occur when the module pass completes.
       PA.intersect(std::move(PassPA));
 
+      if (!FunctionChanged)
+        continue;
+
       // Update the call graph based on this function pass. This may also
       // update the current SCC to point to a smaller, more refined SCC.
       CurrentC = &updateCGAndAnalysisManagerForFunctionPass(
@@ -61,6 +61,8 @@
 #include "llvm/IR/ValueHandle.h"
 #include "llvm/Pass.h"
 #include <map>
+#include <memory>
+#include <system_error>
 
 namespace llvm {
 
@@ -105,6 +107,19 @@ class CallGraph {
   /// functions that it calls.
   void addToCallGraph(Function *F);
 
+  /// \brief Add the edges for \p F that do not come from its body: the edge
+  /// from the external calling node if anything outside the module could call
+  /// it, the edge to the calls-external node if it is a declaration, and the
+  /// root bookkeeping for 'main'.
+  void addStructuralEdges(Function *F, CallGraphNode *Node);
+
+  /// \brief Scan the body of \p F and add an edge for every call site.
+  void scanFunctionBody(Function *F, CallGraphNode *Node);
+
+  /// \brief Construct a graph with no edges; used by readFromCache, which
+  /// populates the graph from cached edge lists instead of scanning \p M.
+  CallGraph(Module &M, bool BuildFromModule);
+
 public:
   explicit CallGraph(Module &M);
   CallGraph(CallGraph &&Arg);
@@ -162,6 +177,39 @@ public:
   /// \brief Similar to operator[], but this will insert a new CallGraphNode for
   /// \c F if one does not already exist.
   CallGraphNode *getOrInsertFunction(const Function *F);
+
+  //===---------------------------------------------------------------------
+  // Functions to persist the call graph across processes.
+  //
+
+  /// \brief Serialize this graph, with a content hash per function, to the
+  /// file at \p Path.
+  ///
+  /// The cache records each function's call edges by position in the module's
+  /// function list together with a hash of the function's name and of the
+  /// callees at its call sites, so a later readFromCache can tell which
+  /// functions changed. The file is written to a temporary and renamed into
+  /// place so a crash never leaves a partial cache behind. Returns an error
+  /// code if the file could not be written.
+  std::error_code writeToCache(StringRef Path) const;
+
+  /// \brief Attempt to construct the call graph of \p M from a cache
+  /// previously written by writeToCache.
+  ///
+  /// Functions whose content hash still matches the cache get their call
+  /// edges attached directly from the cached lists, skipping the node lookup
+  /// and edge construction the normal build does per call site; functions
+  /// that changed are rescanned from the IR. Edges that depend on uses or
+  /// linkage rather than on a function's own body (address-taken, external
+  /// linkage, declarations) are always recomputed. Returns null if the cache
+  /// is missing, malformed, or the module's function list was renamed,
+  /// reordered or resized, in which case the caller should build the graph
+  /// normally.
+  ///
+  /// Edges restored from the cache carry no call-site handles, so the
+  /// resulting graph supports traversal (e.g. SCC iteration) but not
+  /// call-site-level updates such as removeCallEdgeFor.
+  static std::unique_ptr<CallGraph> readFromCache(Module &M, StringRef Path);
 };
 
 /// \brief A node in the call graph for a module.
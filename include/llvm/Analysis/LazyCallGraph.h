@@ -35,6 +35,7 @@
 #ifndef LLVM_ANALYSIS_LAZYCALLGRAPH_H
 #define LLVM_ANALYSIS_LAZYCALLGRAPH_H
 
+#include "llvm/ADT/ArrayRef.h"
 #include "llvm/ADT/DenseMap.h"
 #include "llvm/ADT/PointerUnion.h"
 #include "llvm/ADT/STLExtras.h"
@@ -811,6 +812,29 @@ public:
     SmallVector<RefSCC *, 1> removeInternalRefEdge(Node &SourceN,
                                                    Node &TargetN);
 
+    /// Remove a batch of ref edges from \a SourceN which are entirely within
+    /// this RefSCC.
+    ///
+    /// This is a bulk variant of \c removeInternalRefEdge above which removes
+    /// every edge from \a SourceN to a node in \a TargetNs and then re-forms
+    /// the RefSCC structure with a single connectivity computation rather
+    /// than once per removed edge. The invariants documented on
+    /// \c removeInternalRefEdge hold here as well with two adjustments:
+    ///
+    /// 1) With several edges removed at once there need not be a single
+    ///    RefSCC which references all the others, so this RefSCC is merely
+    ///    guaranteed to not be referenced by any RefSCC split out of it
+    ///    rather than to be the parent of all of them.
+    /// 2) The returned postorder sequence covers all of the newly formed
+    ///    RefSCCs; when it is non-empty, the first element is the RefSCC now
+    ///    containing \a SourceN.
+    ///
+    /// The runtime complexity matches a single call to
+    /// \c removeInternalRefEdge: in the worst case O(V+E) over this RefSCC,
+    /// but paid only once for the entire batch.
+    SmallVector<RefSCC *, 1> removeInternalRefEdges(Node &SourceN,
+                                                    ArrayRef<Node *> TargetNs);
+
     /// A convenience wrapper around the above to handle trivial cases of
     /// inserting a new call edge.
     ///
@@ -15,6 +15,7 @@
 #ifndef LLVM_ANALYSIS_LAZYVALUEINFO_H
 #define LLVM_ANALYSIS_LAZYVALUEINFO_H
 
+#include "llvm/ADT/ArrayRef.h"
 #include "llvm/IR/PassManager.h"
 #include "llvm/Pass.h"
 
@@ -93,6 +94,14 @@ public:
   Constant *getConstantOnEdge(Value *V, BasicBlock *FromBB, BasicBlock *ToBB,
                               Instruction *CxtI = nullptr);
 
+  /// Precompute and cache value information for each (value, block) pair with
+  /// a single solver pass, so that the per-value queries above become cache
+  /// hits.  Passes that issue many related queries against one block region
+  /// (e.g. one value per predecessor edge) use this to share the backward
+  /// block walks across the whole batch instead of paying for a separate walk
+  /// per query.  Each pair asks for the value at the end of its block.
+  void batchQueryValues(ArrayRef<std::pair<Value *, BasicBlock *>> Queries);
+
   /// Inform the analysis cache that we have threaded an edge from
   /// PredBB to OldSucc to be from PredBB to NewSucc instead.
   void threadEdge(BasicBlock *PredBB, BasicBlock *OldSucc, BasicBlock *NewSucc);
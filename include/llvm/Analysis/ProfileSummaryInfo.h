@@ -77,6 +77,12 @@ public:
   bool isHotCallSite(const CallSite &CS, BlockFrequencyInfo *BFI);
   /// \brief Returns true if Callsite \p CS is considered cold.
   bool isColdCallSite(const CallSite &CS, BlockFrequencyInfo *BFI);
+  /// \brief Returns true if \p F should get a reduced optimization
+  /// pipeline: the -pgo-cold-function-opt-gate policy is enabled and the
+  /// profile says the function is cold. Expensive function passes consult
+  /// this to skip themselves so PGO builds spend compile time on the
+  /// functions that matter.
+  bool shouldReduceColdFunctionPipeline(const Function *F);
 };
 
 /// An analysis pass based on legacy pass manager to deliver ProfileSummaryInfo.
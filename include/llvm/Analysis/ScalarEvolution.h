@@ -61,7 +61,7 @@ template <> struct FoldingSetTrait<SCEVPredicate>;
 /// This class represents an analyzed expression in the program.  These are
 /// opaque objects that the client is not allowed to do much with directly.
 ///
-class SCEV : public FoldingSetNode {
+class SCEV : public HashedFoldingSetNode {
   friend struct FoldingSetTrait<SCEV>;
 
   /// A reference to an Interned FoldingSetNodeID for this node.  The
@@ -141,15 +141,26 @@ public:
 };
 
 // Specialize FoldingSetTrait for SCEV to avoid needing to compute
-// temporary FoldingSetNodeID values.
+// temporary FoldingSetNodeID values. SCEVs are immutable once uniqued, so
+// they also cache their profile hash and compare it before touching the
+// interned ID data.
 template <> struct FoldingSetTrait<SCEV> : DefaultFoldingSetTrait<SCEV> {
   static void Profile(const SCEV &X, FoldingSetNodeID &ID) { ID = X.FastID; }
   static bool Equals(const SCEV &X, const FoldingSetNodeID &ID, unsigned IDHash,
                      FoldingSetNodeID &TempID) {
-    return ID == X.FastID;
+    if (X.hasCachedProfileHash() && X.getCachedProfileHash() != IDHash)
+      return false;
+    bool Equal = ID == X.FastID;
+    if (Equal)
+      X.setCachedProfileHash(IDHash);
+    return Equal;
   }
   static unsigned ComputeHash(const SCEV &X, FoldingSetNodeID &TempID) {
-    return X.FastID.ComputeHash();
+    if (X.hasCachedProfileHash())
+      return X.getCachedProfileHash();
+    unsigned Hash = X.FastID.ComputeHash();
+    X.setCachedProfileHash(Hash);
+    return Hash;
   }
 };
 
@@ -525,7 +536,8 @@ private:
 
   /// The typedef for ValueExprMap.
   ///
-  typedef DenseMap<SCEVCallbackVH, const SCEV *, DenseMapInfo<Value *>>
+  typedef DenseMap<SCEVCallbackVH, const SCEV *,
+                   GroupProbedDenseMapInfo<Value *>>
       ValueExprMapType;
 
   /// This is a cache of the values we have analyzed so far.
@@ -1454,6 +1466,26 @@ public:
   /// recompute is simpler.
   void forgetLoopDispositions(const Loop *L) { LoopDispositions.clear(); }
 
+  /// Return the number of bytes currently held by SCEV expressions.  On
+  /// loop-dense functions this only ever grows; see forgetAllExpressions().
+  size_t getExpressionMemoryUsage() const {
+    return SCEVAllocator.getTotalMemory();
+  }
+
+  /// Drop every expression and memoized fact this ScalarEvolution has
+  /// created, returning it to its freshly constructed state and releasing
+  /// all expression memory.  Expressions are uniqued by pointer identity and
+  /// freely reference each other, so there is no sound finer eviction
+  /// granularity; this invalidates every `const SCEV *` obtained from this
+  /// instance and may only be called when no client holds one (e.g. between
+  /// two loops of a loop pass).  Later queries recompute from scratch.
+  void forgetAllExpressions();
+
+  /// Call forgetAllExpressions() if -scev-memory-budget is set and the
+  /// expression memory exceeds it.  Returns true if expressions were
+  /// dropped.  The caller must not hold any SCEV pointers.
+  bool forgetAllExpressionsIfOverBudget();
+
   /// Determine the minimum number of zero bits that S is guaranteed to end in
   /// (at every loop iteration).  It is, at the same time, the minimum number
   /// of times S is divisible by 2.  For example, given {4,+,8} it returns 2.
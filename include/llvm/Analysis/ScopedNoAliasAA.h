@@ -14,6 +14,7 @@
 #ifndef LLVM_ANALYSIS_SCOPEDNOALIASAA_H
 #define LLVM_ANALYSIS_SCOPEDNOALIASAA_H
 
+#include "llvm/ADT/DenseMap.h"
 #include "llvm/Analysis/AliasAnalysis.h"
 #include "llvm/IR/Function.h"
 #include "llvm/IR/Metadata.h"
@@ -40,6 +41,13 @@ public:
   ModRefInfo getModRefInfo(ImmutableCallSite CS1, ImmutableCallSite CS2);
 
 private:
+  /// Memoized results of mayAliasInScopes, keyed by the (scope list, noalias
+  /// list) node pair. Uniqued metadata nodes are owned by the LLVMContext for
+  /// its lifetime, so the pointer keys can never dangle, and the same list
+  /// pairs recur across many queries once scope lists are canonicalized.
+  mutable DenseMap<std::pair<const MDNode *, const MDNode *>, bool>
+      MayAliasCache;
+
   bool mayAliasInScopes(const MDNode *Scopes, const MDNode *NoAlias) const;
 };
 
@@ -101,8 +101,12 @@ namespace llvm {
 
   /// Read the header of the specified bitcode buffer and prepare for lazy
   /// deserialization of function bodies. If ShouldLazyLoadMetadata is true,
-  /// lazily load metadata as well. If IsImporting is true, this module is
-  /// being parsed for ThinLTO importing into another module.
+  /// lazily load metadata as well: the module-level metadata block is only
+  /// indexed on open and individual records are materialized on-demand when
+  /// the IR referencing them is, so modules carrying large debug-info graphs
+  /// can be opened in time proportional to what is actually inspected. If
+  /// IsImporting is true, this module is being parsed for ThinLTO importing
+  /// into another module.
   Expected<std::unique_ptr<Module>>
   getLazyBitcodeModule(MemoryBufferRef Buffer, LLVMContext &Context,
                        bool ShouldLazyLoadMetadata = false,
@@ -178,6 +182,28 @@ namespace llvm {
            isRawBitcode(BufPtr, BufEnd);
   }
 
+  /// isCompressedBitcode - Return true if the given bytes are the magic bytes
+  /// for a compressed bitcode container as produced by
+  /// WriteCompressedBitcodeToFile. The container is not parseable directly;
+  /// expand it with decompressBitcodeBuffer first.
+  ///
+  inline bool isCompressedBitcode(const unsigned char *BufPtr,
+                                  const unsigned char *BufEnd) {
+    // 'B', 'C', 'Z', container version.
+    return BufEnd - BufPtr >= 4 &&
+           BufPtr[0] == 'B' &&
+           BufPtr[1] == 'C' &&
+           BufPtr[2] == 'Z' &&
+           BufPtr[3] == 0x01;
+  }
+
+  /// Expand a compressed bitcode container (see isCompressedBitcode) into a
+  /// newly allocated memory buffer holding ordinary bitcode, which can then
+  /// be handed to any of the bitcode reader entry points. Fails if the
+  /// container is malformed or LLVM was built without zlib.
+  Expected<std::unique_ptr<MemoryBuffer>>
+  decompressBitcodeBuffer(MemoryBufferRef Buffer);
+
   /// SkipBitcodeWrapperHeader - Some systems wrap bc files with a special
   /// header for padding or other reasons.  The format of this header is:
   ///
@@ -16,6 +16,8 @@
 
 #include "llvm/IR/ModuleSummaryIndex.h"
 #include "llvm/MC/StringTableBuilder.h"
+#include "llvm/Support/MemoryBuffer.h"
+#include <memory>
 #include <string>
 
 namespace llvm {
@@ -96,6 +98,42 @@ namespace llvm {
                           bool GenerateHash = false,
                           ModuleHash *ModHash = nullptr);
 
+  /// \brief Serialize the specified module into an immutable in-memory
+  /// bitcode snapshot.
+  ///
+  /// The returned buffer shares nothing with the Module or its LLVMContext,
+  /// so once this call returns the caller may hand the buffer to another
+  /// thread (for file I/O, compression, or upload) while IR building
+  /// continues on the live module. This is the supported way to overlap
+  /// emission with mutation: a structural copy-on-write view of a Module is
+  /// not possible because reads go through context-shared uniquing tables
+  /// and value use-lists that mutation rewrites in place. The serialization
+  /// itself still runs on the calling thread and the module must not be
+  /// mutated during it.
+  std::unique_ptr<MemoryBuffer>
+  WriteBitcodeToMemoryBuffer(const Module *M,
+                             bool ShouldPreserveUseListOrder = false,
+                             const ModuleSummaryIndex *Index = nullptr,
+                             bool GenerateHash = false,
+                             ModuleHash *ModHash = nullptr);
+
+  /// \brief Write the specified module to \p Out as a compressed bitcode
+  /// container.
+  ///
+  /// The module is serialized as with WriteBitcodeToFile and the resulting
+  /// bytes are wrapped in a small container holding a magic number, the
+  /// uncompressed size, and a single zlib stream. The container is
+  /// recognized by isCompressedBitcode and expanded with
+  /// decompressBitcodeBuffer; it is not readable by the plain bitcode entry
+  /// points. If LLVM was built without zlib, or compression would not shrink
+  /// the module, ordinary uncompressed bitcode is written instead, so
+  /// callers that sniff the magic bytes handle both outputs.
+  void WriteCompressedBitcodeToFile(const Module *M, raw_ostream &Out,
+                                    bool ShouldPreserveUseListOrder = false,
+                                    const ModuleSummaryIndex *Index = nullptr,
+                                    bool GenerateHash = false,
+                                    ModuleHash *ModHash = nullptr);
+
   /// Write the specified module summary index to the given raw output stream,
   /// where it will be written in a new bitcode block. This is used when
   /// writing the combined index file for ThinLTO. When writing a subset of the
@@ -220,40 +220,65 @@ public:
   }
 
   uint32_t ReadVBR(unsigned NumBits) {
+    static const unsigned Mask = sizeof(word_t) > 4 ? 0x3f : 0x1f;
+    const uint32_t HiMask = 1U << (NumBits-1);
+    const uint32_t LoMask = HiMask-1;
+
     uint32_t Piece = Read(NumBits);
-    if ((Piece & (1U << (NumBits-1))) == 0)
+    if ((Piece & HiMask) == 0)
       return Piece;
 
     uint32_t Result = 0;
     unsigned NextBit = 0;
     while (true) {
-      Result |= (Piece & ((1U << (NumBits-1))-1)) << NextBit;
+      Result |= (Piece & LoMask) << NextBit;
 
-      if ((Piece & (1U << (NumBits-1))) == 0)
+      if ((Piece & HiMask) == 0)
         return Result;
 
       NextBit += NumBits-1;
-      Piece = Read(NumBits);
+      // Fetch the next chunk straight out of CurWord when it is fully
+      // contained, skipping the per-chunk refill checks in Read(). This is
+      // the common case: chunks are narrow and CurWord rarely runs dry.
+      if (BitsInCurWord >= NumBits) {
+        Piece = uint32_t(CurWord) & (HiMask | LoMask);
+        CurWord >>= (NumBits & Mask);
+        BitsInCurWord -= NumBits;
+      } else {
+        Piece = Read(NumBits);
+      }
     }
   }
 
   // Read a VBR that may have a value up to 64-bits in size. The chunk size of
   // the VBR must still be <= 32 bits though.
   uint64_t ReadVBR64(unsigned NumBits) {
+    static const unsigned Mask = sizeof(word_t) > 4 ? 0x3f : 0x1f;
+    const uint32_t HiMask = 1U << (NumBits-1);
+    const uint32_t LoMask = HiMask-1;
+
     uint32_t Piece = Read(NumBits);
-    if ((Piece & (1U << (NumBits-1))) == 0)
+    if ((Piece & HiMask) == 0)
       return uint64_t(Piece);
 
     uint64_t Result = 0;
     unsigned NextBit = 0;
     while (true) {
-      Result |= uint64_t(Piece & ((1U << (NumBits-1))-1)) << NextBit;
+      Result |= uint64_t(Piece & LoMask) << NextBit;
 
-      if ((Piece & (1U << (NumBits-1))) == 0)
+      if ((Piece & HiMask) == 0)
         return Result;
 
       NextBit += NumBits-1;
-      Piece = Read(NumBits);
+      // See ReadVBR for why decoding continuation chunks out of CurWord
+      // directly is worthwhile.
+      if (BitsInCurWord >= NumBits) {
+        Piece = uint32_t(CurWord) & (HiMask | LoMask);
+        CurWord >>= (NumBits & Mask);
+        BitsInCurWord -= NumBits;
+      } else {
+        Piece = Read(NumBits);
+      }
     }
   }
 
@@ -0,0 +1,65 @@
+//===- BinaryMIRFormat.h - Binary MIR container layout ----------*- C++ -*-===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+//
+// This file defines the on-disk layout of the binary MIR container written by
+// the MIR printing pass under -binary-mir and read back by the MIR parser.
+//
+// The container is designed to be consumed directly from a memory mapped
+// buffer: the header, the function index and the string table are read in
+// place, and every machine function body is an independent slice of the file
+// that is only parsed when the corresponding function is materialized. All
+// multi-byte fields are stored little endian and may be unaligned.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_CODEGEN_BINARYMIRFORMAT_H
+#define LLVM_CODEGEN_BINARYMIRFORMAT_H
+
+#include "llvm/Support/Endian.h"
+#include <cstdint>
+
+namespace llvm {
+namespace bmir {
+
+/// The file magic, stored at offset zero.
+const char Magic[4] = {'B', 'M', 'I', 'R'};
+
+/// The current version of the container layout.
+const uint32_t CurrentVersion = 1;
+
+/// The fixed-size file header.
+struct Header {
+  char Magic[4];
+  support::ulittle32_t Version;
+  /// Slice of the file holding the textual LLVM IR module. IRSize is zero
+  /// when the container doesn't embed LLVM IR.
+  support::ulittle64_t IROffset;
+  support::ulittle64_t IRSize;
+  /// Slice of the file holding the function name string table.
+  support::ulittle64_t StrTabOffset;
+  support::ulittle64_t StrTabSize;
+  /// Offset of the function index, an array of NumFunctions FunctionRecords.
+  support::ulittle64_t IndexOffset;
+  support::ulittle64_t NumFunctions;
+};
+
+/// One entry of the function index.
+struct FunctionRecord {
+  /// The function name, as a slice of the string table.
+  support::ulittle64_t NameOffset;
+  support::ulittle64_t NameSize;
+  /// The serialized machine function, as a slice of the file.
+  support::ulittle64_t BodyOffset;
+  support::ulittle64_t BodySize;
+};
+
+} // end namespace bmir
+} // end namespace llvm
+
+#endif // LLVM_CODEGEN_BINARYMIRFORMAT_H
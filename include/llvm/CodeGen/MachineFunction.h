@@ -232,7 +232,11 @@ class MachineFunction {
   // Allocation management for instructions in function.
   Recycler<MachineInstr> InstructionRecycler;
 
-  // Allocation management for operand arrays on instructions.
+  // Allocation management for operand arrays on instructions. Arrays come
+  // from the function's bump allocator in power-of-two capacity classes and
+  // freed arrays go on per-class free lists, so growing an instruction's
+  // operand list in later passes normally reuses memory instead of hitting
+  // the heap, and teardown is just the allocator being reset.
   ArrayRecycler<MachineOperand> OperandRecycler;
 
   // Allocation management for basic blocks in function.
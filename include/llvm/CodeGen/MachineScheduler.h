@@ -933,8 +933,35 @@ protected:
   /// Candidate last picked from Bot boundary.
   SchedCandidate BotCand;
 
+  /// Memoized result of the upward pressure delta query for one node, tagged
+  /// with the state it was derived from.
+  struct CachedPressureDelta {
+    RegPressureDelta Delta;
+    /// Generation of the node's PressureDiff when the delta was computed.
+    unsigned PDiffGen = 0;
+    /// Pressure epoch the delta was computed at; 0 means never computed.
+    unsigned Epoch = 0;
+  };
+
+  /// Cached bottom-zone pressure deltas, indexed by NodeNum.
+  std::vector<CachedPressureDelta> BotDeltaCache;
+  /// Epoch at which each pressure set's bottom tracker state last changed.
+  std::vector<unsigned> PSetEpochs;
+  /// Snapshots of the tracker state the epochs are current with. An empty
+  /// pressure snapshot means no epochs have been taken for this region yet.
+  std::vector<unsigned> BotPressureSnapshot;
+  std::vector<unsigned> BotMaxSnapshot;
+  std::vector<int> CritUnitIncSnapshot;
+  /// Monotonic counter bumped each time the epochs are brought up to date.
+  unsigned BotPressureEpoch = 0;
+
   void checkAcyclicLatency();
 
+  void updateBotPressureEpochs();
+
+  bool cachedDeltaCurrent(const CachedPressureDelta &Entry,
+                          const PressureDiff &PDiff) const;
+
   void initCandidate(SchedCandidate &Cand, SUnit *SU, bool AtTop,
                      const RegPressureTracker &RPTracker,
                      RegPressureTracker &TempTracker);
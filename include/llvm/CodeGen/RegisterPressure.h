@@ -147,6 +147,12 @@ class PressureDiff {
 
   PressureChange PressureChanges[MaxPSets];
 
+  /// Incremented on every mutation so clients can cheaply detect that a
+  /// previously derived result is stale. No initializer: PressureDiff must
+  /// stay trivially default-constructible because PressureDiffs::init
+  /// zero-fills its array with memset/calloc, which also zeroes this field.
+  unsigned Generation;
+
   typedef PressureChange* iterator;
   iterator nonconst_begin() { return &PressureChanges[0]; }
   iterator nonconst_end() { return &PressureChanges[MaxPSets]; }
@@ -156,6 +162,8 @@ public:
   const_iterator begin() const { return &PressureChanges[0]; }
   const_iterator end() const { return &PressureChanges[MaxPSets]; }
 
+  unsigned getGeneration() const { return Generation; }
+
   void addPressureChange(unsigned RegUnit, bool IsDec,
                          const MachineRegisterInfo *MRI);
 
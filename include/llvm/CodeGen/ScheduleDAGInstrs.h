@@ -161,6 +161,15 @@ namespace llvm {
     /// case of a huge region that gets reduced).
     SUnit *BarrierChain;
 
+    /// The number of distinct values each memory dependency map held at
+    /// the end of the previous region. Regions within a function tend to
+    /// look alike, so buildSchedGraph() pre-sizes the maps from these to
+    /// avoid growing and rehashing them entry by entry in steady state.
+    unsigned StoresMapHint;
+    unsigned LoadsMapHint;
+    unsigned NonAliasStoresMapHint;
+    unsigned NonAliasLoadsMapHint;
+
   public:
     /// A list of SUnits, used in Value2SUsMap, during DAG construction.
     /// Note: to gain speed it might be worth investigating an optimized
@@ -50,6 +50,10 @@ public:
   MachineRegisterInfo *RegInfo;
   SelectionDAG *CurDAG;
   SelectionDAGBuilder *SDB;
+  /// The scheduler instance, created lazily for the first block of each
+  /// function and reused for the remaining blocks; ScheduleDAGSDNodes::Run
+  /// resets the per-block state.
+  ScheduleDAGSDNodes *Scheduler;
   AliasAnalysis *AA;
   GCFunctionInfo *GFI;
   CodeGenOpt::Level OptLevel;
@@ -58,6 +62,15 @@ public:
   bool FastISelFailed;
   SmallPtrSet<const Instruction *, 4> ElidedArgCopyInstrs;
 
+  /// Memoized results of CheckPatternPredicate, indexed by predicate number:
+  /// 0 = not evaluated yet, 1 = false, 2 = true. Pattern predicates only
+  /// query the subtarget and per-function options, so their values are fixed
+  /// for the duration of a function; the matcher re-checks the same handful
+  /// of feature predicates for every node it visits, and caching turns each
+  /// re-check into a single byte load. Reset by runOnMachineFunction once
+  /// the subtarget and options for the new function are in place.
+  mutable SmallVector<uint8_t, 64> PatternPredicateCache;
+
   /// Current optimization remark emitter.
   /// Used to report things like combines and FastISel failures.
   std::unique_ptr<OptimizationRemarkEmitter> ORE;
@@ -325,6 +338,12 @@ private:
   /// state machines that start with a OPC_SwitchOpcode node.
   std::vector<unsigned> OpcodeOffset;
 
+  /// OpcodeTypeOffset - The second level of the dispatch cache above: for
+  /// opcodes whose state machine immediately switches on the node's type,
+  /// this maps (opcode << 8) | type to the offset of that type's case so the
+  /// interpreter skips straight to the relevant pattern range.
+  DenseMap<unsigned, unsigned> OpcodeTypeOffset;
+
   void UpdateChains(SDNode *NodeToMatch, SDValue InputChain,
                     SmallVectorImpl<SDNode *> &ChainNodesMatched,
                     bool isMorphNodeTo);
@@ -500,6 +500,12 @@ private:
   /// Unique id per SDNode in the DAG.
   int NodeId = -1;
 
+  /// This node's position in the DAG combiner's worklist, or -1 if it is
+  /// not on the worklist.  Maintained by the DAG combiner so that worklist
+  /// membership tests and removals need no side table; outside of a combine
+  /// it is always -1.
+  int CombinerWorklistIndex = -1;
+
   /// The values that are used by this operation.
   SDUse *OperandList = nullptr;
 
@@ -600,6 +606,12 @@ public:
   /// Set unique node id.
   void setNodeId(int Id) { NodeId = Id; }
 
+  /// Get this node's position in the DAG combiner's worklist.
+  int getCombinerWorklistIndex() const { return CombinerWorklistIndex; }
+
+  /// Set this node's position in the DAG combiner's worklist.
+  void setCombinerWorklistIndex(int Index) { CombinerWorklistIndex = Index; }
+
   /// Return the node ordering.
   unsigned getIROrder() const { return IROrder; }
 
@@ -602,6 +602,52 @@ namespace llvm {
       return newIndex;
     }
 
+    /// Insert all instructions in [Begin, End) into the mapping.
+    ///
+    /// Equivalent to calling insertMachineInstrInMaps on each instruction in
+    /// order, but the available number space between the neighbouring indexes
+    /// is distributed over the whole run up front, so at most one local
+    /// renumbering is needed for the run rather than one per instruction once
+    /// the gap is exhausted.
+    void insertMachineInstrRangeInMaps(MachineBasicBlock::iterator Begin,
+                                       MachineBasicBlock::iterator End) {
+      if (Begin == End)
+        return;
+
+      // Get the entries surrounding the run.
+      IndexList::iterator prevItr =
+          getIndexBefore(*Begin).listEntry()->getIterator();
+      IndexList::iterator nextItr = std::next(prevItr);
+
+      // Distribute the available number space evenly over the run, or use 0
+      // for every instruction if there is no room and force a renumber below.
+      unsigned Count = std::distance(Begin, End);
+      unsigned dist =
+          ((nextItr->getIndex() - prevItr->getIndex()) / (Count + 1)) & ~3u;
+
+      unsigned index = prevItr->getIndex();
+      IndexList::iterator firstItr = indexList.end();
+      for (MachineBasicBlock::iterator I = Begin; I != End; ++I) {
+        MachineInstr &MI = *I;
+        assert(!MI.isInsideBundle() &&
+               "Instructions inside bundles should use bundle start's slot.");
+        assert(mi2iMap.find(&MI) == mi2iMap.end() && "Instr already indexed.");
+        assert(!MI.isDebugValue() && "Cannot number DBG_VALUE instructions.");
+
+        index += dist;
+        IndexList::iterator newItr =
+            indexList.insert(nextItr, createEntry(&MI, index));
+        if (firstItr == indexList.end())
+          firstItr = newItr;
+        mi2iMap.insert(
+            std::make_pair(&MI, SlotIndex(&*newItr, SlotIndex::Slot_Block)));
+      }
+
+      // Renumber locally if there was no room for the run.
+      if (dist == 0)
+        renumberIndexes(firstItr);
+    }
+
     /// Removes machine instruction (bundle) \p MI from the mapping.
     /// This should be called before MachineInstr::eraseFromParent() is used to
     /// remove a whole bundle or an unbundled instruction.
@@ -189,6 +189,25 @@ public:
   /// Get a pointer to the parsed DebugAranges object.
   const DWARFDebugAranges *getDebugAranges();
 
+  /// Parse the DIEs of all compile units on a thread pool and build the
+  /// address range index concurrently. The DIEs stay extracted, so a
+  /// symbolization service can warm up a large context across all hardware
+  /// threads instead of paying for lazy single-threaded parsing on the first
+  /// address lookup. A \p NumThreads of 0 uses all hardware threads. Does
+  /// nothing if the address range index has already been built.
+  void parseDIEsParallel(unsigned NumThreads = 0);
+
+  /// Populate the compile unit address index from data previously written
+  /// by writeAddressIndex(), skipping the scan of every unit's ranges that
+  /// getDebugAranges() performs on first use. Returns false and leaves the
+  /// index unset if \p Data is malformed. The caller is responsible for
+  /// checking that the data was produced from the same binary.
+  bool loadAddressIndex(StringRef Data);
+
+  /// Build the compile unit address index if it has not been built yet and
+  /// serialize it to \p OS in the format expected by loadAddressIndex().
+  void writeAddressIndex(raw_ostream &OS);
+
   /// Get a pointer to the parsed frame information object.
   const DWARFDebugFrame *getDebugFrame();
 
@@ -18,12 +18,31 @@
 namespace llvm {
 
 class DWARFContext;
+class raw_ostream;
 
 class DWARFDebugAranges {
 public:
   void generate(DWARFContext *CTX);
+
+  /// Same as generate(), but extracts the DIEs of the compile units whose
+  /// ranges are not described by .debug_aranges on a thread pool, and keeps
+  /// them extracted so subsequent queries against the units are cheap. A
+  /// \p NumThreads of 0 uses all hardware threads.
+  void generateParallel(DWARFContext *CTX, unsigned NumThreads);
+
   uint32_t findAddress(uint64_t Address) const;
 
+  /// Serialize the constructed index to \p OS in a fixed-width
+  /// little-endian format suitable for caching on disk. Only meaningful
+  /// after generate() or generateParallel().
+  void serialize(raw_ostream &OS) const;
+
+  /// Reconstitute an index written by serialize(), skipping the scan of
+  /// every compile unit's ranges that generate() performs. Returns false
+  /// and clears the index if \p Data is not a well-formed serialized
+  /// index.
+  bool deserialize(StringRef Data);
+
 private:
   void clear();
   void extract(DataExtractor DebugArangesData);
@@ -38,7 +38,11 @@ struct MSFLayout;
 /// itself, the layout is described by an array at a fixed location within
 /// the MSF.  MappedBlockStream provides methods for reading from and writing
 /// to one of these streams transparently, as if it were a contiguous sequence
-/// of bytes.
+/// of bytes.  Reads that fall entirely within a contiguous run of blocks are
+/// served as zero-copy views directly into the underlying (typically memory
+/// mapped) MSF data; only reads that straddle a discontiguity are reassembled
+/// into a copy, and those copies are cached with stable addresses since
+/// clients may hold the returned buffers indefinitely.
 class MappedBlockStream : public BinaryStream {
   friend class WritableMappedBlockStream;
 public:
@@ -71,6 +75,10 @@ public:
 
   llvm::BumpPtrAllocator &getAllocator() { return Pool; }
 
+  /// Drop all cached reassembled buffers and release the memory backing
+  /// them.  Any buffer previously returned by readBytes that did not come
+  /// directly from the underlying MSF data is invalidated, as is anything
+  /// allocated from getAllocator().
   void invalidateCache();
 
   uint32_t getBlockSize() const { return BlockSize; }
@@ -34,13 +34,21 @@ public:
     bool UseSymbolTable : 1;
     bool Demangle : 1;
     bool RelativeAddresses : 1;
+    /// Cache the DWARF address index beside each binary (in a
+    /// "<binary>.llvm-addr-index" file) and reuse it on subsequent runs,
+    /// so repeated symbolization of the same binary skips the scan of
+    /// every compile unit's address ranges. Stale or unwritable caches
+    /// are ignored silently.
+    bool CacheDWARFIndex : 1;
     std::string DefaultArch;
     std::vector<std::string> DsymHints;
     Options(FunctionNameKind PrintFunctions = FunctionNameKind::LinkageName,
             bool UseSymbolTable = true, bool Demangle = true,
-            bool RelativeAddresses = false, std::string DefaultArch = "")
+            bool RelativeAddresses = false, std::string DefaultArch = "",
+            bool CacheDWARFIndex = false)
         : PrintFunctions(PrintFunctions), UseSymbolTable(UseSymbolTable),
           Demangle(Demangle), RelativeAddresses(RelativeAddresses),
+          CacheDWARFIndex(CacheDWARFIndex),
           DefaultArch(std::move(DefaultArch)) {}
   };
 
@@ -14,12 +14,15 @@
 #ifndef LLVM_EXECUTIONENGINE_JITSYMBOL_H
 #define LLVM_EXECUTIONENGINE_JITSYMBOL_H
 
+#include "llvm/ADT/ArrayRef.h"
+
 #include <algorithm>
 #include <cassert>
 #include <cstddef>
 #include <cstdint>
 #include <functional>
 #include <string>
+#include <vector>
 
 namespace llvm {
 
@@ -188,6 +191,16 @@ public:
   /// for handling them manually.
   virtual JITSymbol findSymbol(const std::string &Name) = 0;
 
+  /// This method returns the addresses of a group of symbols, one per entry
+  /// in \p Names and in the same order. Each name is resolved the way
+  /// RuntimeDyld resolves external symbols: the logical dylib is searched
+  /// first, then findSymbol is tried. RuntimeDyld batches all external
+  /// symbols of an object into a single call to this method; resolvers that
+  /// can amortize per-query overhead (for example by issuing one request to a
+  /// remote process) should override the default implementation, which simply
+  /// resolves the names one at a time.
+  virtual std::vector<JITTargetAddress> findSymbols(ArrayRef<std::string> Names);
+
 private:
   virtual void anchor();
 };
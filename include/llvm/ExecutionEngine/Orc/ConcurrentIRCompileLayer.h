@@ -0,0 +1,327 @@
+//===- ConcurrentIRCompileLayer.h - Compile IR on worker threads -*- C++ -*-===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+//
+// Contains the definition for a compiling layer that runs the compiler on a
+// pool of background threads instead of the thread that added the modules.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_EXECUTIONENGINE_ORC_CONCURRENTIRCOMPILELAYER_H
+#define LLVM_EXECUTIONENGINE_ORC_CONCURRENTIRCOMPILELAYER_H
+
+#include "llvm/ADT/STLExtras.h"
+#include "llvm/ADT/StringMap.h"
+#include "llvm/ADT/StringRef.h"
+#include "llvm/ExecutionEngine/JITSymbol.h"
+#include "llvm/IR/CallSite.h"
+#include "llvm/IR/Function.h"
+#include "llvm/IR/Mangler.h"
+#include "llvm/IR/Module.h"
+#include "llvm/Object/ObjectFile.h"
+#include "llvm/Support/ThreadPool.h"
+#include "llvm/Support/raw_ostream.h"
+#include <condition_variable>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace llvm {
+namespace orc {
+
+/// @brief Background-compiling IR layer.
+///
+///   This layer accepts sets of LLVM IR Modules (via addModuleSet) like
+/// IRCompileLayer, but instead of compiling on the calling thread it hands
+/// each set to a pool of worker threads and returns immediately. Lookups of
+/// symbols whose set is still compiling return a JITSymbol whose getAddress
+/// blocks until the background compile has finished, so callers only pay for
+/// compiles whose results they actually need right away.
+///
+///   The compile functor is invoked concurrently from the worker threads and
+/// must be safe to call that way (e.g. by constructing a TargetMachine per
+/// invocation rather than sharing one). As with the other layers, the
+/// client-facing methods themselves must be called from a single thread.
+template <typename BaseLayerT> class ConcurrentIRCompileLayer {
+public:
+  typedef std::function<object::OwningBinary<object::ObjectFile>(Module &)>
+      CompileFtor;
+
+private:
+  typedef typename BaseLayerT::ObjSetHandleT ObjSetHandleT;
+
+  /// State shared between the handle returned to the client and the worker
+  /// thread compiling the set.
+  class PendingSet {
+  public:
+    virtual ~PendingSet() = default;
+
+    /// Return the flags for Name if a module in this set defines it.
+    const JITSymbolFlags *findMangledSymbol(StringRef Name) const {
+      auto I = MangledSymbols.find(Name);
+      return I == MangledSymbols.end() ? nullptr : &I->second;
+    }
+
+    /// Block until the background compile has handed this set's objects to
+    /// the base layer, then return the base layer handle.
+    ObjSetHandleT waitForHandle() {
+      std::unique_lock<std::mutex> Lock(M);
+      while (!Emitted)
+        CV.wait(Lock);
+      return Handle;
+    }
+
+  protected:
+    void notifyEmitted(ObjSetHandleT H) {
+      std::unique_lock<std::mutex> Lock(M);
+      Handle = H;
+      Emitted = true;
+      CV.notify_all();
+    }
+
+    // Built once on the client thread before the worker is scheduled, and
+    // read-only afterwards. Kept after emission so that lookups racing with
+    // the worker still find the set.
+    StringMap<JITSymbolFlags> MangledSymbols;
+
+  private:
+    std::mutex M;
+    std::condition_variable CV;
+    bool Emitted = false;
+    ObjSetHandleT Handle;
+  };
+
+  template <typename ModuleSetT, typename MemoryManagerPtrT,
+            typename SymbolResolverPtrT>
+  class PendingSetImpl : public PendingSet {
+  public:
+    PendingSetImpl(ModuleSetT Ms, MemoryManagerPtrT MemMgr,
+                   SymbolResolverPtrT Resolver)
+        : Ms(std::move(Ms)), MemMgr(std::move(MemMgr)),
+          Resolver(std::move(Resolver)) {
+      // The modules must not be touched once the worker owns them (codegen
+      // mutates the IR), so capture the symbol names and flags up front.
+      buildMangledSymbols();
+    }
+
+    /// Compile every module in the set and add the resulting objects to the
+    /// base layer. Runs on a worker thread.
+    void compileAndEmit(ConcurrentIRCompileLayer &Parent) {
+      std::vector<std::unique_ptr<object::OwningBinary<object::ObjectFile>>>
+        Objects;
+
+      for (const auto &M : Ms) {
+        auto Object =
+          llvm::make_unique<object::OwningBinary<object::ObjectFile>>();
+        *Object = Parent.Compile(*M);
+        Objects.push_back(std::move(Object));
+      }
+
+      ObjSetHandleT H;
+      {
+        std::lock_guard<std::mutex> Lock(Parent.BaseLayerMutex);
+        H = Parent.BaseLayer.addObjectSet(std::move(Objects),
+                                          std::move(MemMgr),
+                                          std::move(Resolver));
+      }
+
+      // The IR is no longer needed once the objects exist.
+      Ms = ModuleSetT();
+      this->notifyEmitted(H);
+    }
+
+  private:
+    void buildMangledSymbols() {
+      for (const auto &M : Ms) {
+        Mangler Mang;
+
+        for (const auto &GO : M->global_objects()) {
+          // Modules don't "provide" decls or common symbols.
+          if (GO.isDeclaration() || GO.hasCommonLinkage())
+            continue;
+
+          std::string MangledName;
+          {
+            raw_string_ostream MangledNameStream(MangledName);
+            Mang.getNameWithPrefix(MangledNameStream, &GO, false);
+          }
+          this->MangledSymbols[MangledName] = JITSymbolFlags::fromGlobalValue(GO);
+        }
+      }
+    }
+
+    ModuleSetT Ms;
+    MemoryManagerPtrT MemMgr;
+    SymbolResolverPtrT Resolver;
+  };
+
+  typedef std::list<std::shared_ptr<PendingSet>> PendingSetListT;
+
+public:
+  /// @brief Handle to a set of compiling (or compiled) modules.
+  typedef typename PendingSetListT::iterator ModuleSetHandleT;
+
+  /// @brief Construct a ConcurrentIRCompileLayer with the given BaseLayer
+  ///        (which must implement the object layer concept), compile functor
+  ///        and number of worker threads.
+  ConcurrentIRCompileLayer(BaseLayerT &BaseLayer, CompileFtor Compile,
+                           unsigned NumCompileThreads)
+      : BaseLayer(BaseLayer), Compile(std::move(Compile)),
+        Pool(NumCompileThreads) {}
+
+  ~ConcurrentIRCompileLayer() {
+    // Don't let worker threads outlive the layer they call back into.
+    Pool.wait();
+  }
+
+  /// @brief Schedule a background compile of each module in the given set.
+  ///        The resulting objects are added to the base layer from the worker
+  ///        thread as soon as they are ready.
+  ///
+  /// @return A handle for the added modules.
+  template <typename ModuleSetT, typename MemoryManagerPtrT,
+            typename SymbolResolverPtrT>
+  ModuleSetHandleT addModuleSet(ModuleSetT Ms,
+                                MemoryManagerPtrT MemMgr,
+                                SymbolResolverPtrT Resolver) {
+    typedef PendingSetImpl<ModuleSetT, MemoryManagerPtrT, SymbolResolverPtrT>
+      SetT;
+
+    auto Set = std::make_shared<SetT>(std::move(Ms), std::move(MemMgr),
+                                      std::move(Resolver));
+    ModuleSetHandleT H = PendingSets.insert(PendingSets.end(), Set);
+    Pool.async([this, Set]() { Set->compileAndEmit(*this); });
+    return H;
+  }
+
+  /// @brief Remove the module set associated with the handle H, waiting for
+  ///        its background compile first if it is still running.
+  void removeModuleSet(ModuleSetHandleT H) {
+    ObjSetHandleT Handle = (*H)->waitForHandle();
+    {
+      std::lock_guard<std::mutex> Lock(BaseLayerMutex);
+      BaseLayer.removeObjectSet(Handle);
+    }
+    PendingSets.erase(H);
+  }
+
+  /// @brief Search for the given named symbol.
+  ///
+  ///   If the symbol is defined by a set that is still compiling, the
+  /// returned JITSymbol's getAddress blocks until the compile finishes
+  /// rather than compiling on the calling thread.
+  ///
+  /// @param Name The name of the symbol to search for.
+  /// @param ExportedSymbolsOnly If true, search only for exported symbols.
+  /// @return A handle for the given named symbol, if it exists.
+  JITSymbol findSymbol(const std::string &Name, bool ExportedSymbolsOnly) {
+    // Definitions added through this layer are resolved via the pending set
+    // list (even once emitted), so that lookups never race with a worker
+    // that is just handing its objects to the base layer.
+    for (auto &Set : PendingSets)
+      if (const JITSymbolFlags *Flags = Set->findMangledSymbol(Name)) {
+        if (ExportedSymbolsOnly && !Flags->isExported())
+          return nullptr;
+        return deferredSymbol(Set, Name, ExportedSymbolsOnly, *Flags);
+      }
+
+    // Otherwise the symbol can only come from definitions that reached the
+    // base layer some other way.
+    std::lock_guard<std::mutex> Lock(BaseLayerMutex);
+    return BaseLayer.findSymbol(Name, ExportedSymbolsOnly);
+  }
+
+  /// @brief Get the address of the given symbol in the context of the set of
+  ///        compiled modules represented by the handle H, waiting for the
+  ///        set's background compile if necessary.
+  /// @param H The handle for the module set to search in.
+  /// @param Name The name of the symbol to search for.
+  /// @param ExportedSymbolsOnly If true, search only for exported symbols.
+  /// @return A handle for the given named symbol, if it is found in the
+  ///         given module set.
+  JITSymbol findSymbolIn(ModuleSetHandleT H, const std::string &Name,
+                         bool ExportedSymbolsOnly) {
+    ObjSetHandleT Handle = (*H)->waitForHandle();
+    std::lock_guard<std::mutex> Lock(BaseLayerMutex);
+    return BaseLayer.findSymbolIn(Handle, Name, ExportedSymbolsOnly);
+  }
+
+  /// @brief Immediately emit and finalize the module set represented by the
+  ///        given handle, waiting for its background compile if necessary.
+  /// @param H Handle for module set to emit/finalize.
+  void emitAndFinalize(ModuleSetHandleT H) {
+    ObjSetHandleT Handle = (*H)->waitForHandle();
+    std::lock_guard<std::mutex> Lock(BaseLayerMutex);
+    BaseLayer.emitAndFinalize(Handle);
+  }
+
+  /// @brief Speculatively materialize the given symbol on a worker thread.
+  ///
+  ///   This forces the compile (and finalization) of the set defining Name
+  /// without blocking the caller, so that a later getAddress from the fast
+  /// path finds the work already done.
+  void speculate(const std::string &Name) {
+    if (auto Symbol = findSymbol(Name, false)) {
+      auto SharedSymbol = std::make_shared<JITSymbol>(std::move(Symbol));
+      Pool.async([SharedSymbol]() { SharedSymbol->getAddress(); });
+    }
+  }
+
+  /// @brief Speculatively materialize the direct callees of F, on the theory
+  ///        that a caller about to be run will call them shortly.
+  ///
+  ///   F must not belong to a set already handed to this layer, since its IR
+  /// may be being compiled (and mutated) concurrently.
+  void speculateCallees(const Function &F) {
+    Mangler Mang;
+
+    for (const BasicBlock &BB : F)
+      for (const Instruction &I : BB) {
+        ImmutableCallSite CS(&I);
+        if (!CS)
+          continue;
+        const Function *Callee = CS.getCalledFunction();
+        if (!Callee || Callee->isDeclaration() || Callee->isIntrinsic())
+          continue;
+
+        std::string MangledName;
+        {
+          raw_string_ostream MangledNameStream(MangledName);
+          Mang.getNameWithPrefix(MangledNameStream, Callee, false);
+        }
+        speculate(MangledName);
+      }
+  }
+
+private:
+  JITSymbol deferredSymbol(std::shared_ptr<PendingSet> Set, std::string Name,
+                           bool ExportedSymbolsOnly, JITSymbolFlags Flags) {
+    auto GetAddress = [this, Set, Name, ExportedSymbolsOnly]()
+        -> JITTargetAddress {
+      ObjSetHandleT Handle = Set->waitForHandle();
+      std::lock_guard<std::mutex> Lock(BaseLayerMutex);
+      return BaseLayer.findSymbolIn(Handle, Name, ExportedSymbolsOnly)
+          .getAddress();
+    };
+    return JITSymbol(std::move(GetAddress), Flags);
+  }
+
+  BaseLayerT &BaseLayer;
+  CompileFtor Compile;
+  ThreadPool Pool;
+  /// Serializes the worker threads' and the client's accesses to BaseLayer.
+  std::mutex BaseLayerMutex;
+  PendingSetListT PendingSets;
+};
+
+} // End namespace orc.
+} // End namespace llvm.
+
+#endif // LLVM_EXECUTIONENGINE_ORC_CONCURRENTIRCOMPILELAYER_H
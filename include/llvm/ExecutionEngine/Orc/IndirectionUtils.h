@@ -26,6 +26,7 @@
 #include "llvm/Support/Process.h"
 #include "llvm/Transforms/Utils/ValueMapper.h"
 #include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <cstdint>
 #include <functional>
@@ -243,6 +244,13 @@ public:
   /// @brief Change the value of the implementation pointer for the stub.
   virtual Error updatePointer(StringRef Name, JITTargetAddress NewAddr) = 0;
 
+  /// @brief Remove the stub with the given name, returning its slot to the
+  ///        manager for reuse by a later createStub call. Returns false if
+  ///        no stub with that name exists or if this manager does not
+  ///        support stub reuse. The stub remains callable (with its last
+  ///        target) until its slot is reused.
+  virtual bool removeStub(StringRef Name) { return false; }
+
 private:
   virtual void anchor();
 };
@@ -304,22 +312,48 @@ public:
     auto I = StubIndexes.find(Name);
     assert(I != StubIndexes.end() && "No stub pointer for symbol");
     auto Key = I->second.first;
-    *IndirectStubsInfos[Key.first].getPtr(Key.second) =
-        reinterpret_cast<void *>(static_cast<uintptr_t>(NewAddr));
+    setPtr(IndirectStubsInfos[Key.first].getPtr(Key.second), NewAddr);
     return Error::success();
   }
 
+  bool removeStub(StringRef Name) override {
+    auto I = StubIndexes.find(Name);
+    if (I == StubIndexes.end())
+      return false;
+    FreeStubs.push_back(I->second.first);
+    StubIndexes.erase(I);
+    return true;
+  }
+
 private:
+  // The stub reads its pointer slot with no synchronization, so publish new
+  // targets with a single release store rather than under a lock. A call
+  // that races with the update sees either the old or the new target, both
+  // of which are safe to run.
+  static void setPtr(void **Ptr, JITTargetAddress Addr) {
+    static_assert(sizeof(std::atomic<uintptr_t>) == sizeof(void *),
+                  "Can't overlay atomic on pointer slot");
+    reinterpret_cast<std::atomic<uintptr_t> *>(Ptr)->store(
+        static_cast<uintptr_t>(Addr), std::memory_order_release);
+  }
+
   Error reserveStubs(unsigned NumStubs) {
     if (NumStubs <= FreeStubs.size())
       return Error::success();
 
     unsigned NewStubsRequired = NumStubs - FreeStubs.size();
+    // Grow the pool geometrically: emitting a fresh block for every small
+    // shortfall makes a slow start for JITs that create stubs a handful at
+    // a time, so size each new slab to at least the number of stubs already
+    // allocated, capped to bound the worst-case over-allocation.
+    NewStubsRequired =
+        std::max(NewStubsRequired, std::min(NumStubsAllocated, 4096u));
     unsigned NewBlockId = IndirectStubsInfos.size();
     typename TargetT::IndirectStubsInfo ISI;
     if (auto Err =
             TargetT::emitIndirectStubsBlock(ISI, NewStubsRequired, nullptr))
       return Err;
+    NumStubsAllocated += ISI.getNumStubs();
     for (unsigned I = 0; I < ISI.getNumStubs(); ++I)
       FreeStubs.push_back(std::make_pair(NewBlockId, I));
     IndirectStubsInfos.push_back(std::move(ISI));
@@ -330,8 +364,7 @@ private:
                           JITSymbolFlags StubFlags) {
     auto Key = FreeStubs.back();
     FreeStubs.pop_back();
-    *IndirectStubsInfos[Key.first].getPtr(Key.second) =
-        reinterpret_cast<void *>(static_cast<uintptr_t>(InitAddr));
+    setPtr(IndirectStubsInfos[Key.first].getPtr(Key.second), InitAddr);
     StubIndexes[StubName] = std::make_pair(Key, StubFlags);
   }
 
@@ -339,6 +372,7 @@ private:
   typedef std::pair<uint16_t, uint16_t> StubKey;
   std::vector<StubKey> FreeStubs;
   StringMap<std::pair<StubKey, JITSymbolFlags>> StubIndexes;
+  unsigned NumStubsAllocated = 0;
 };
 
 /// @brief Create a local compile callback manager.
@@ -0,0 +1,212 @@
+//===- ReOptimizeLayer.h - Hotness-driven recompilation ---------*- C++ -*-===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+//
+// Contains the definition of a layer that manages tiered execution: modules
+// are compiled cheaply up front, calls are routed through indirect stubs, and
+// functions that prove hot at runtime are recompiled and atomically repointed
+// to their optimized implementations.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_EXECUTIONENGINE_ORC_REOPTIMIZELAYER_H
+#define LLVM_EXECUTIONENGINE_ORC_REOPTIMIZELAYER_H
+
+#include "llvm/ADT/StringRef.h"
+#include "llvm/ExecutionEngine/JITSymbol.h"
+#include "llvm/ExecutionEngine/Orc/IndirectionUtils.h"
+#include "llvm/IR/Constants.h"
+#include "llvm/IR/Function.h"
+#include "llvm/IR/GlobalVariable.h"
+#include "llvm/IR/IRBuilder.h"
+#include "llvm/IR/Module.h"
+#include <functional>
+#include <list>
+#include <string>
+#include <vector>
+
+namespace llvm {
+namespace orc {
+
+/// @brief Hotness-driven re-optimization layer.
+///
+///   This layer accepts sets of LLVM IR Modules (via addModuleSet) and hands
+/// them to the base layer, which is expected to compile quickly (e.g. an
+/// IRCompileLayer built around a CodeGenOpt::None target machine). Before the
+/// modules are compiled, every externally visible function is given an entry
+/// counter, and calls resolved through this layer are routed via indirect
+/// stubs. pollForHotFunctions, called periodically by the client, reads the
+/// counters and, for each function whose count has crossed the hotness
+/// threshold, invokes the recompile functor and atomically repoints the
+/// function's stub at the address it returns. Once every function in a set
+/// has been repointed the set's cheap-tier code is removed from the base
+/// layer, reclaiming its memory.
+///
+///   The recompile functor is expected to produce the optimized
+/// implementation from a pristine copy of the IR (typically by adding the
+/// module to a second compile layer built around an aggressive target
+/// machine) - handing it the instrumented module would carry the counters
+/// into the optimized tier. Counters are read directly through their JITed
+/// addresses, so this layer only supports in-process execution. Calls made
+/// without going through the stubs (e.g. direct calls between functions in
+/// the same module) keep executing the tier the caller was compiled at.
+template <typename BaseLayerT> class ReOptimizeLayer {
+private:
+  typedef typename BaseLayerT::ModuleSetHandleT BaseHandleT;
+
+  struct FunctionRecord {
+    std::string Name;
+    std::string CounterName;
+    bool Recompiled = false;
+  };
+
+  struct ModuleSetInfo {
+    BaseHandleT Handle;
+    std::vector<FunctionRecord> Functions;
+    bool BaseRemoved = false;
+  };
+
+  typedef std::list<ModuleSetInfo> ModuleSetInfoListT;
+
+public:
+  /// @brief Handle to a set of added modules.
+  typedef typename ModuleSetInfoListT::iterator ModuleSetHandleT;
+
+  /// @brief Recompile functor: produces the address of an optimized
+  ///        implementation of the named function.
+  typedef std::function<Expected<JITTargetAddress>(StringRef)> RecompileFtor;
+
+  /// @brief Construct a ReOptimizeLayer with the given BaseLayer and stubs
+  ///        manager. Functions whose entry count reaches HotnessThreshold
+  ///        are handed to Recompile on the next poll.
+  ReOptimizeLayer(BaseLayerT &BaseLayer, IndirectStubsManager &StubsMgr,
+                  RecompileFtor Recompile, uint64_t HotnessThreshold)
+      : BaseLayer(BaseLayer), StubsMgr(StubsMgr),
+        Recompile(std::move(Recompile)), HotnessThreshold(HotnessThreshold) {}
+
+  /// @brief Instrument the given modules, add them to the base layer, and
+  ///        build stubs for their externally visible functions.
+  template <typename ModuleSetT, typename MemoryManagerPtrT,
+            typename SymbolResolverPtrT>
+  Expected<ModuleSetHandleT> addModuleSet(ModuleSetT Ms,
+                                          MemoryManagerPtrT MemMgr,
+                                          SymbolResolverPtrT Resolver) {
+    ModuleSetInfo MSI;
+
+    for (auto &M : Ms)
+      for (Function &F : *M) {
+        if (F.isDeclaration() || F.hasLocalLinkage())
+          continue;
+        FunctionRecord FR;
+        FR.Name = F.getName();
+        FR.CounterName = ("__orc_reopt_counter." + F.getName()).str();
+        insertEntryCounter(F, FR.CounterName);
+        MSI.Functions.push_back(std::move(FR));
+      }
+
+    MSI.Handle = BaseLayer.addModuleSet(std::move(Ms), std::move(MemMgr),
+                                        std::move(Resolver));
+
+    for (auto &FR : MSI.Functions) {
+      JITSymbol Sym = BaseLayer.findSymbolIn(MSI.Handle, FR.Name, false);
+      if (auto Err =
+              StubsMgr.createStub(FR.Name, Sym.getAddress(), Sym.getFlags()))
+        return std::move(Err);
+    }
+
+    ModuleSetInfos.push_back(std::move(MSI));
+    return std::prev(ModuleSetInfos.end());
+  }
+
+  /// @brief Remove the module set associated with the handle H. The stubs
+  ///        stay valid but keep pointing at whatever tier was current.
+  void removeModuleSet(ModuleSetHandleT H) {
+    if (!H->BaseRemoved)
+      BaseLayer.removeModuleSet(H->Handle);
+    ModuleSetInfos.erase(H);
+  }
+
+  /// @brief Search for the given named symbol, preferring the stub so that
+  ///        callers pick up re-optimized implementations automatically.
+  JITSymbol findSymbol(const std::string &Name, bool ExportedSymbolsOnly) {
+    if (auto Sym = StubsMgr.findStub(Name, ExportedSymbolsOnly))
+      return Sym;
+    return BaseLayer.findSymbol(Name, ExportedSymbolsOnly);
+  }
+
+  /// @brief Get the address of the given symbol in the context of the set of
+  ///        modules represented by the handle H.
+  JITSymbol findSymbolIn(ModuleSetHandleT H, const std::string &Name,
+                         bool ExportedSymbolsOnly) {
+    return BaseLayer.findSymbolIn(H->Handle, Name, ExportedSymbolsOnly);
+  }
+
+  /// @brief Read the entry counters, recompile and repoint every function
+  ///        whose count has reached the hotness threshold, and reclaim the
+  ///        cheap-tier code of sets that are fully re-optimized.
+  Error pollForHotFunctions() {
+    for (auto &MSI : ModuleSetInfos) {
+      if (MSI.BaseRemoved)
+        continue;
+      bool AllRecompiled = !MSI.Functions.empty();
+      for (auto &FR : MSI.Functions) {
+        if (FR.Recompiled)
+          continue;
+        JITTargetAddress CounterAddr =
+            BaseLayer.findSymbolIn(MSI.Handle, FR.CounterName, false)
+                .getAddress();
+        if (!CounterAddr ||
+            *reinterpret_cast<const volatile uint64_t *>(
+                static_cast<uintptr_t>(CounterAddr)) < HotnessThreshold) {
+          AllRecompiled = false;
+          continue;
+        }
+        auto NewAddrOrErr = Recompile(FR.Name);
+        if (!NewAddrOrErr)
+          return NewAddrOrErr.takeError();
+        if (auto Err = StubsMgr.updatePointer(FR.Name, *NewAddrOrErr))
+          return Err;
+        FR.Recompiled = true;
+      }
+      if (AllRecompiled) {
+        // Every stub in this set points at the optimized tier; the cheap-tier
+        // code (and its counters) can no longer be reached through us.
+        BaseLayer.removeModuleSet(MSI.Handle);
+        MSI.BaseRemoved = true;
+      }
+    }
+    return Error::success();
+  }
+
+private:
+  static void insertEntryCounter(Function &F, StringRef CounterName) {
+    Module &M = *F.getParent();
+    auto *Int64Ty = Type::getInt64Ty(M.getContext());
+    auto *Counter =
+        new GlobalVariable(M, Int64Ty, false, GlobalValue::ExternalLinkage,
+                           ConstantInt::get(Int64Ty, 0), CounterName);
+    Counter->setVisibility(GlobalValue::HiddenVisibility);
+    // A racy increment is fine here: lost updates only delay crossing the
+    // threshold.
+    IRBuilder<> Builder(&*F.getEntryBlock().getFirstInsertionPt());
+    Value *Count = Builder.CreateLoad(Counter, "reopt.count");
+    Builder.CreateStore(Builder.CreateAdd(Count, ConstantInt::get(Int64Ty, 1)),
+                        Counter);
+  }
+
+  BaseLayerT &BaseLayer;
+  IndirectStubsManager &StubsMgr;
+  RecompileFtor Recompile;
+  uint64_t HotnessThreshold;
+  ModuleSetInfoListT ModuleSetInfos;
+};
+
+} // end namespace orc
+} // end namespace llvm
+
+#endif // LLVM_EXECUTIONENGINE_ORC_REOPTIMIZELAYER_H
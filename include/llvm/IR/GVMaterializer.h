@@ -18,6 +18,7 @@
 #ifndef LLVM_IR_GVMATERIALIZER_H
 #define LLVM_IR_GVMATERIALIZER_H
 
+#include "llvm/ADT/ArrayRef.h"
 #include <vector>
 
 namespace llvm {
@@ -37,6 +38,17 @@ public:
   ///
   virtual Error materialize(GlobalValue *GV) = 0;
 
+  /// Make sure all of the given GlobalValues are fully read.
+  ///
+  /// The default implementation materializes the values one by one in the
+  /// given order.  Materializers reading from a file may override this to
+  /// choose a better decode order: the bitcode reader, for instance, decodes
+  /// the requested bodies in increasing stream offset order so that a batch
+  /// request (e.g. a ThinLTO import of hundreds of functions from one
+  /// module) turns into a single forward sweep over the file instead of
+  /// random seeking.
+  virtual Error materialize(ArrayRef<GlobalValue *> GVs);
+
   /// Make sure the entire Module has been completely read.
   ///
   virtual Error materializeModule() = 0;
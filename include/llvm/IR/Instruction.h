@@ -373,6 +373,9 @@ private:
   // These are all implemented in Metadata.cpp.
   MDNode *getMetadataImpl(unsigned KindID) const;
   MDNode *getMetadataImpl(StringRef Kind) const;
+  /// Fill \c N with this instruction's AA metadata attachments using a
+  /// single attachment table lookup, rather than one per kind.
+  void getAAMetadataImpl(AAMDNodes &N) const;
   void
   getAllMetadataImpl(SmallVectorImpl<std::pair<unsigned, MDNode *>> &) const;
   void getAllMetadataOtherThanDebugLocImpl(
@@ -17,6 +17,7 @@
 #define LLVM_IR_INSTRUCTIONS_H
 
 #include "llvm/ADT/ArrayRef.h"
+#include "llvm/ADT/DenseMap.h"
 #include "llvm/ADT/iterator_range.h"
 #include "llvm/ADT/None.h"
 #include "llvm/ADT/SmallVector.h"
@@ -2538,6 +2539,16 @@ class PHINode : public Instruction {
   /// the number actually in use.
   unsigned ReservedSpace;
 
+  /// Number of incoming edges at which getBasicBlockIndex switches from a
+  /// linear scan to a lazily built block-to-index map.
+  static const unsigned BlockIndexThreshold = 32;
+
+  /// Map from incoming block to the index of its first occurrence, built on
+  /// the first getBasicBlockIndex query once the PHI has at least
+  /// BlockIndexThreshold incoming edges. Any change to the incoming blocks
+  /// drops it; see invalidateBlockIndexCache().
+  mutable DenseMap<const BasicBlock *, unsigned> *BlockIndexCache = nullptr;
+
   PHINode(const PHINode &PN);
   // allocate space for exactly zero operands
 
@@ -2593,6 +2604,10 @@ public:
     return new PHINode(Ty, NumReservedValues, NameStr, InsertAtEnd);
   }
 
+  ~PHINode() override {
+    delete BlockIndexCache;
+  }
+
   /// Provide fast operand accessors
   DECLARE_TRANSPARENT_OPERAND_ACCESSORS(Value);
 
@@ -2680,6 +2695,7 @@ public:
   void setIncomingBlock(unsigned i, BasicBlock *BB) {
     assert(BB && "PHI node got a null basic block!");
     block_begin()[i] = BB;
+    invalidateBlockIndexCache();
   }
 
   /// Add an incoming value to the end of the PHI list
@@ -2713,6 +2729,14 @@ public:
   /// block in the value list for this PHI.  Returns -1 if no instance.
   ///
   int getBasicBlockIndex(const BasicBlock *BB) const {
+    // On unusually wide PHIs, answer out of a lazily built map; passes like
+    // SSAUpdater query once per predecessor, which is otherwise quadratic.
+    if (getNumOperands() >= BlockIndexThreshold) {
+      if (!BlockIndexCache)
+        buildBlockIndexCache();
+      auto It = BlockIndexCache->find(BB);
+      return It != BlockIndexCache->end() ? (int)It->second : -1;
+    }
     for (unsigned i = 0, e = getNumOperands(); i != e; ++i)
       if (block_begin()[i] == BB)
         return i;
@@ -2744,6 +2768,18 @@ public:
 
 private:
   void growOperands();
+
+  /// Populate BlockIndexCache from the incoming block list.
+  void buildBlockIndexCache() const;
+
+  /// Drop the block-to-index map; called whenever the incoming blocks
+  /// change. The map is rebuilt on the next large-PHI lookup.
+  void invalidateBlockIndexCache() {
+    if (LLVM_UNLIKELY(BlockIndexCache != nullptr)) {
+      delete BlockIndexCache;
+      BlockIndexCache = nullptr;
+    }
+  }
 };
 
 template <>
@@ -128,6 +128,33 @@ public:
   /// especially in release mode.
   void setDiscardValueNames(bool Discard);
 
+  /// Return true if several threads are allowed to materialize scalar
+  /// constants (ConstantInt/ConstantFP) into this context concurrently.
+  /// Off by default.
+  bool hasConcurrentConstantUniquing() const;
+
+  /// Allow or disallow concurrent materialization of scalar constants into
+  /// this context.  When enabled, the ConstantInt/ConstantFP uniquing tables
+  /// take fine-grained shard locks on every lookup, so parallel importers
+  /// (e.g. ThinLTO function import) can share one context instead of
+  /// duplicating all types and constants per thread.  Uniquing of aggregate
+  /// constants and constant expressions is still unsynchronized, so those
+  /// must not be created concurrently.
+  void setConcurrentConstantUniquing(bool Enable);
+
+  /// Return true if several threads are allowed to materialize types into
+  /// this context concurrently.  Off by default.
+  bool hasConcurrentTypeUniquing() const;
+
+  /// Allow or disallow concurrent materialization of types into this
+  /// context.  When enabled, the type uniquing tables (integer, function,
+  /// struct, array, vector and pointer types, plus the named struct symbol
+  /// table) are guarded by a reader/writer lock: lookups of existing types
+  /// only share the lock, and only type creation takes it exclusively.
+  /// Mutation of already-materialized types (e.g. StructType::setBody) is
+  /// still unsynchronized and must not race with other users of the type.
+  void setConcurrentTypeUniquing(bool Enable);
+
   /// Whether there is a string map for uniquing debug info
   /// identifiers across the context.  Off by default.
   bool isODRUniquingDebugTypes() const;
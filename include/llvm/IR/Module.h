@@ -469,6 +469,12 @@ public:
   /// Make sure the GlobalValue is fully read.
   llvm::Error materialize(GlobalValue *GV);
 
+  /// Make sure all of the given GlobalValues are fully read.  A batch request
+  /// lets the materializer pick an efficient decode order (the bitcode reader
+  /// decodes in stream offset order), so prefer this over materializing one
+  /// value at a time when the full set is known up front.
+  llvm::Error materialize(ArrayRef<GlobalValue *> GVs);
+
   /// Make sure all GlobalValues in this Module are fully read and clear the
   /// Materializer.
   llvm::Error materializeAll();
@@ -24,6 +24,7 @@
 #include "llvm/ADT/StringMap.h"
 #include "llvm/IR/Module.h"
 
+#include <algorithm>
 #include <array>
 
 namespace llvm {
@@ -168,7 +169,7 @@ public:
 
   /// Returns the hash of the original name, it is identical to the GUID for
   /// externally visible symbols, but not for local ones.
-  GlobalValue::GUID getOriginalName() { return OriginalName; }
+  GlobalValue::GUID getOriginalName() const { return OriginalName; }
 
   /// Initialize the original name hash in this summary.
   void setOriginalName(GlobalValue::GUID Name) { OriginalName = Name; }
@@ -529,6 +530,17 @@ private:
   /// GUIDs, it will be mapped to 0.
   std::map<GlobalValue::GUID, GlobalValue::GUID> OidGuidMap;
 
+  /// Flat lookup acceleration structure for GlobalValueMap, built by
+  /// finalizeForReadOnlyUse once the index is fully constructed. The GUID
+  /// keys are stored contiguously in sorted order, so a lookup is a binary
+  /// search over packed memory rather than a pointer chase through map nodes,
+  /// which matters for the thin-link on large combined indexes. The parallel
+  /// iterator vector preserves the map-iterator-based lookup interface.
+  /// Adding a summary after the table is built makes it stale; lookups detect
+  /// this by comparing sizes and fall back to the map.
+  std::vector<GlobalValue::GUID> LookupTableGUIDs;
+  std::vector<const_gvsummary_iterator> LookupTableIters;
+
   // YAML I/O support.
   friend yaml::MappingTraits<ModuleSummaryIndex>;
 
@@ -547,15 +559,43 @@ public:
   /// Get the list of global value summary objects for a given value name.
   const const_gvsummary_iterator
   findGlobalValueSummaryList(StringRef ValueName) const {
-    return GlobalValueMap.find(GlobalValue::getGUID(ValueName));
+    return findGlobalValueSummaryList(GlobalValue::getGUID(ValueName));
   }
 
   /// Get the list of global value summary objects for a given value GUID.
   const const_gvsummary_iterator
   findGlobalValueSummaryList(GlobalValue::GUID ValueGUID) const {
+    // Prefer the flat table when it is in sync with the map (see
+    // finalizeForReadOnlyUse).
+    if (LookupTableGUIDs.size() == GlobalValueMap.size() &&
+        !LookupTableGUIDs.empty()) {
+      auto It = std::lower_bound(LookupTableGUIDs.begin(),
+                                 LookupTableGUIDs.end(), ValueGUID);
+      if (It != LookupTableGUIDs.end() && *It == ValueGUID)
+        return LookupTableIters[It - LookupTableGUIDs.begin()];
+      return GlobalValueMap.end();
+    }
     return GlobalValueMap.find(ValueGUID);
   }
 
+  /// Build the flat GUID lookup table. Call this once the index is fully
+  /// constructed and about to be used for read-mostly access, e.g. at the
+  /// start of the thin-link. Summaries may still be added afterwards; that
+  /// merely invalidates the table and lookups revert to the map.
+  void finalizeForReadOnlyUse() {
+    LookupTableGUIDs.clear();
+    LookupTableIters.clear();
+    LookupTableGUIDs.reserve(GlobalValueMap.size());
+    LookupTableIters.reserve(GlobalValueMap.size());
+    // std::map iterates in key order, so the table is built sorted.
+    for (const_gvsummary_iterator I = GlobalValueMap.begin(),
+                                  E = GlobalValueMap.end();
+         I != E; ++I) {
+      LookupTableGUIDs.push_back(I->first);
+      LookupTableIters.push_back(I);
+    }
+  }
+
   /// Return the GUID for \p OriginalId in the OidGuidMap.
   GlobalValue::GUID getGUIDFromOriginalID(GlobalValue::GUID OriginalID) const {
     const auto I = OidGuidMap.find(OriginalID);
@@ -597,14 +637,20 @@ public:
     if (CalleeInfoList == end()) {
       return nullptr; // This function does not have a summary
     }
-    auto Summary =
-        llvm::find_if(CalleeInfoList->second,
-                      [&](const std::unique_ptr<GlobalValueSummary> &Summary) {
-                        return Summary->modulePath() == ModuleId;
-                      });
-    if (Summary == CalleeInfoList->second.end())
-      return nullptr;
-    return Summary->get();
+    // Summary module paths are references into this index's module path
+    // string table, so resolve ModuleId against the table once and compare
+    // pointers while walking the list: a widely defined linkonce symbol can
+    // carry summaries from thousands of modules, and a string comparison per
+    // entry dominates this lookup on large links.
+    auto ModIt = ModulePathStringTable.find(ModuleId);
+    if (ModIt == ModulePathStringTable.end())
+      return nullptr; // No summaries are from that module.
+    const char *InternedModuleId = ModIt->first().data();
+    for (const std::unique_ptr<GlobalValueSummary> &Summary :
+         CalleeInfoList->second)
+      if (Summary->modulePath().data() == InternedModuleId)
+        return Summary.get();
+    return nullptr;
   }
 
   /// Returns the first GlobalValueSummary for \p GV, asserting that there
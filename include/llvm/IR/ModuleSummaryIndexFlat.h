@@ -0,0 +1,164 @@
+//===- ModuleSummaryIndexFlat.h - Flat summary index format -----*- C++ -*-===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+//
+/// @file
+/// ModuleSummaryIndexFlat.h This file contains a flat, mmap-friendly
+/// serialization of the combined module summary index. Unlike the bitcode
+/// encoding, which has to be deserialized into heap-allocated
+/// GlobalValueSummary objects before use, this format keeps all offsets and
+/// lists in fixed-layout little-endian records so a reader can look up and
+/// walk summaries directly in a memory-mapped buffer.
+///
+/// Layout (all fields little-endian, all records 8-byte aligned):
+///   Header:       magic, version, table offsets and sizes.
+///   Module table: per module: path (offset/length into the string table),
+///                 module ID and SHA1 hash.
+///   GUID table:   (GUID, offset) pairs sorted by GUID, binary searched.
+///   Blocks:       per GUID: a summary count followed by the records.
+///   String table: module path characters.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_IR_MODULESUMMARYINDEXFLAT_H
+#define LLVM_IR_MODULESUMMARYINDEXFLAT_H
+
+#include "llvm/IR/ModuleSummaryIndex.h"
+#include "llvm/Support/Endian.h"
+#include "llvm/Support/Error.h"
+#include "llvm/Support/MemoryBuffer.h"
+
+namespace llvm {
+
+/// Write \p Index to \p OS in the flat summary format. The index must be a
+/// combined index, i.e. all reference and call edges must be GUIDs. Type
+/// identifier information is not serialized.
+Error writeFlatSummaryIndex(const ModuleSummaryIndex &Index, raw_ostream &OS);
+
+/// In-place reader for the flat summary index format. The reader keeps a
+/// reference to the buffer it was created from and never copies summary
+/// data, so the buffer (typically a memory-mapped file) must outlive it.
+class FlatSummaryIndex {
+  const unsigned char *Base;
+  uint32_t NumModules;
+  uint64_t NumGUIDs;
+  uint64_t ModuleTableOffset;
+  uint64_t GUIDTableOffset;
+  uint64_t StringTableOffset;
+
+  FlatSummaryIndex() = default;
+
+  template <typename T> T read(uint64_t Offset) const {
+    return support::endian::read<T, support::little, support::unaligned>(
+        Base + Offset);
+  }
+
+public:
+  /// A read-only view of one summary record.
+  class Summary {
+    friend class FlatSummaryIndex;
+    const FlatSummaryIndex *Index;
+    uint64_t Offset;
+
+    Summary(const FlatSummaryIndex *Index, uint64_t Offset)
+        : Index(Index), Offset(Offset) {}
+
+  public:
+    GlobalValueSummary::SummaryKind getSummaryKind() const {
+      return static_cast<GlobalValueSummary::SummaryKind>(
+          Index->read<uint32_t>(Offset));
+    }
+    GlobalValue::LinkageTypes linkage() const {
+      return static_cast<GlobalValue::LinkageTypes>(
+          Index->read<uint32_t>(Offset + 4) & 0xf);
+    }
+    bool notEligibleToImport() const {
+      return Index->read<uint32_t>(Offset + 4) & 0x10;
+    }
+    bool liveRoot() const { return Index->read<uint32_t>(Offset + 4) & 0x20; }
+    StringRef modulePath() const {
+      return Index->getModulePath(Index->read<uint32_t>(Offset + 8));
+    }
+    /// Instruction count for function summaries, 0 otherwise.
+    unsigned instCount() const { return Index->read<uint32_t>(Offset + 12); }
+    GlobalValue::GUID getOriginalName() const {
+      return Index->read<uint64_t>(Offset + 16);
+    }
+    /// GUID of the aliasee for alias summaries, 0 otherwise.
+    GlobalValue::GUID getAliaseeGUID() const {
+      return Index->read<uint64_t>(Offset + 24);
+    }
+    uint32_t getNumRefs() const { return Index->read<uint32_t>(Offset + 32); }
+    uint32_t getNumCalls() const { return Index->read<uint32_t>(Offset + 36); }
+    GlobalValue::GUID ref(uint32_t I) const {
+      assert(I < getNumRefs() && "Reference index out of range");
+      return Index->read<uint64_t>(Offset + 40 + 8 * (uint64_t)I);
+    }
+    GlobalValue::GUID callGUID(uint32_t I) const {
+      assert(I < getNumCalls() && "Call index out of range");
+      return Index->read<uint64_t>(Offset + 40 + 8 * (uint64_t)getNumRefs() +
+                                   16 * (uint64_t)I);
+    }
+    CalleeInfo::HotnessType callHotness(uint32_t I) const {
+      assert(I < getNumCalls() && "Call index out of range");
+      return static_cast<CalleeInfo::HotnessType>(
+          Index->read<uint64_t>(Offset + 40 + 8 * (uint64_t)getNumRefs() +
+                                16 * (uint64_t)I + 8));
+    }
+    /// Size of this record in bytes; the next record of the same GUID
+    /// starts right behind it.
+    uint64_t getRecordSize() const {
+      return 40 + 8 * (uint64_t)getNumRefs() + 16 * (uint64_t)getNumCalls();
+    }
+  };
+
+  /// The list of summary records for one GUID (one per defining module in
+  /// the COMDAT case). Records are laid out back to back.
+  class SummaryList {
+    friend class FlatSummaryIndex;
+    const FlatSummaryIndex *Index;
+    uint64_t BlockOffset;
+
+    SummaryList(const FlatSummaryIndex *Index, uint64_t BlockOffset)
+        : Index(Index), BlockOffset(BlockOffset) {}
+
+  public:
+    /// An empty list is returned for GUIDs not in the index.
+    uint64_t size() const {
+      return Index ? Index->read<uint64_t>(BlockOffset) : 0;
+    }
+    bool empty() const { return size() == 0; }
+    Summary operator[](uint64_t I) const {
+      assert(I < size() && "Summary index out of range");
+      uint64_t Offset = BlockOffset + 8;
+      for (; I != 0; --I)
+        Offset += Summary(Index, Offset).getRecordSize();
+      return Summary(Index, Offset);
+    }
+  };
+
+  /// Create a reader over \p Buffer, verifying the header. The buffer must
+  /// outlive the returned reader.
+  static Expected<std::unique_ptr<FlatSummaryIndex>>
+  create(MemoryBufferRef Buffer);
+
+  uint64_t getNumGUIDs() const { return NumGUIDs; }
+  uint32_t getNumModules() const { return NumModules; }
+
+  /// Find the summaries recorded for \p GUID by binary search over the GUID
+  /// table; returns an empty list if the GUID is not in the index.
+  SummaryList findSummaries(GlobalValue::GUID GUID) const;
+
+  StringRef getModulePath(uint32_t ModuleIndex) const;
+  uint64_t getModuleId(uint32_t ModuleIndex) const;
+  ModuleHash getModuleHash(uint32_t ModuleIndex) const;
+};
+
+} // end namespace llvm
+
+#endif // LLVM_IR_MODULESUMMARYINDEXFLAT_H
@@ -1135,6 +1135,18 @@ typedef OuterAnalysisManagerProxy<ModuleAnalysisManager, Function>
 /// Note that although function passes can access module analyses, module
 /// analyses are not invalidated while the function passes are running, so they
 /// may be stale.  Function analyses will not be stale.
+///
+/// The exclusive-access contract above is deliberately phrased so that this
+/// adaptor could one day dispatch the per-function runs to a thread pool with
+/// a FunctionAnalysisManager per worker. Today it must not: LLVMContext's
+/// uniquing tables for constants, types, and metadata are shared, unlocked,
+/// mutable state, and the use lists of globals and uniqued constants are
+/// rewritten whenever a pass creates or drops a reference to them, which
+/// virtually every transform does (e.g. materializing an i32 0). Until those
+/// structures are made concurrency-safe or per-thread, in-process parallelism
+/// over one module is a miscompile, however function-local the passes are;
+/// the supported route to parallel optimization is one context per unit of
+/// work, as the ThinLTO backends and SplitModule-based consumers do.
 template <typename FunctionPassT>
 class ModuleToFunctionPassAdaptor
     : public PassInfoMixin<ModuleToFunctionPassAdaptor<FunctionPassT>> {
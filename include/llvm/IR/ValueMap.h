@@ -88,7 +88,8 @@ class ValueMap {
   friend class ValueMapCallbackVH<KeyT, ValueT, Config>;
 
   typedef ValueMapCallbackVH<KeyT, ValueT, Config> ValueMapCVH;
-  typedef DenseMap<ValueMapCVH, ValueT, DenseMapInfo<ValueMapCVH>> MapT;
+  typedef DenseMap<ValueMapCVH, ValueT, GroupProbedDenseMapInfo<ValueMapCVH>>
+      MapT;
   typedef DenseMap<const Metadata *, TrackingMDRef> MDMapT;
   typedef typename Config::ExtraData ExtraData;
   MapT Map;
@@ -17,6 +17,7 @@
 #define LLVM_LTO_LTO_H
 
 #include "llvm/ADT/MapVector.h"
+#include "llvm/ADT/Optional.h"
 #include "llvm/ADT/StringMap.h"
 #include "llvm/ADT/StringSet.h"
 #include "llvm/Analysis/ObjectUtils.h"
@@ -31,6 +32,9 @@
 #include "llvm/Target/TargetOptions.h"
 #include "llvm/Transforms/IPO/FunctionImport.h"
 
+#include <deque>
+#include <mutex>
+
 namespace llvm {
 
 class BitcodeModule;
@@ -39,6 +43,7 @@ class LLVMContext;
 class MemoryBufferRef;
 class Module;
 class Target;
+class ThreadPool;
 class raw_pwrite_stream;
 
 /// Resolve Weak and LinkOnce values in the \p Index. Linkage changes recorded
@@ -290,6 +295,18 @@ private:
     ModuleSummaryIndex CombinedIndex;
     MapVector<StringRef, BitcodeModule> ModuleMap;
     DenseMap<GlobalValue::GUID, StringRef> PrevailingModuleForGUID;
+
+    // Module summaries are parsed on this pool while the linker thread
+    // continues adding inputs and resolving symbols. Each pending entry
+    // carries the position the module had when it was added, so the
+    // deferred merge into CombinedIndex produces the same module IDs as a
+    // synchronous parse; a deque keeps the slots stable while tasks write
+    // to them. See LTO::waitForSummaries().
+    std::unique_ptr<ThreadPool> SummaryPool;
+    std::deque<std::pair<uint64_t, std::unique_ptr<ModuleSummaryIndex>>>
+        PendingSummaries;
+    std::mutex SummaryMu;
+    Optional<Error> SummaryErr;
   } ThinLTO;
 
   // The global resolution for a particular (mangled) symbol name. This is in
@@ -355,6 +372,10 @@ private:
   Error addThinLTO(BitcodeModule BM, ArrayRef<InputFile::Symbol> Syms,
                    const SymbolResolution *&ResI, const SymbolResolution *ResE);
 
+  /// Wait for any summaries still being parsed asynchronously and merge them
+  /// into the combined index.
+  Error waitForSummaries();
+
   Error runRegularLTO(AddStreamFn AddStream);
   Error runThinLTO(AddStreamFn AddStream, NativeObjectCache Cache,
                    bool HasRegularLTO);
@@ -99,6 +99,16 @@ public:
                                     const MCRelaxableFragment *DF,
                                     const MCAsmLayout &Layout) const = 0;
 
+  /// Check whether a fixup whose value is already known exactly would still
+  /// require the associated instruction to be relaxed. The streamer uses this
+  /// to emit the short form of instructions whose targets are resolved while
+  /// streaming, without creating a relaxable fragment. Targets that cannot
+  /// tell without a layout keep the conservative default.
+  virtual bool fixupValueNeedsRelaxation(const MCFixup &Fixup,
+                                         uint64_t Value) const {
+    return true;
+  }
+
   /// Relax the instruction in the given fragment to the next wider instruction.
   ///
   /// \param Inst The instruction to relax, which may be the same as the
@@ -11,6 +11,7 @@
 #define LLVM_MC_MCASSEMBLER_H
 
 #include "llvm/ADT/ArrayRef.h"
+#include "llvm/ADT/DenseMap.h"
 #include "llvm/ADT/iterator.h"
 #include "llvm/ADT/iterator_range.h"
 #include "llvm/ADT/SmallPtrSet.h"
@@ -73,6 +74,19 @@ public:
   using symbol_range = iterator_range<symbol_iterator>;
   using const_symbol_range = iterator_range<const_symbol_iterator>;
 
+  /// Dirty-tracking state for the relaxation loop.  For each fragment that
+  /// may relax, Deps caches the highest layout order among the same-section
+  /// fragments its relaxation decision reads, plus a flag for dependencies
+  /// that cannot be summarized this way (other sections, undefined or
+  /// variable symbols).  PrevMinRelaxed records, per section, the layout
+  /// order of the first fragment relaxed by the previous scan: fragments
+  /// whose dependencies all lie strictly before that point cannot have
+  /// changed their decision and are skipped.
+  struct RelaxDirtyState {
+    DenseMap<const MCFragment *, std::pair<unsigned, bool>> Deps;
+    DenseMap<const MCSection *, unsigned> PrevMinRelaxed;
+  };
+
   using const_indirect_symbol_iterator =
       std::vector<IndirectSymbolData>::const_iterator;
   using indirect_symbol_iterator = std::vector<IndirectSymbolData>::iterator;
@@ -175,11 +189,12 @@ private:
 
   /// \brief Perform one layout iteration and return true if any offsets
   /// were adjusted.
-  bool layoutOnce(MCAsmLayout &Layout);
+  bool layoutOnce(MCAsmLayout &Layout, RelaxDirtyState &Dirty);
 
   /// \brief Perform one layout iteration of the given section and return true
   /// if any offsets were adjusted.
-  bool layoutSectionOnce(MCAsmLayout &Layout, MCSection &Sec);
+  bool layoutSectionOnce(MCAsmLayout &Layout, MCSection &Sec,
+                         RelaxDirtyState &Dirty);
 
   bool relaxInstruction(MCAsmLayout &Layout, MCRelaxableFragment &IF);
 
@@ -226,10 +241,16 @@ public:
   /// defining a separate atom.
   bool isSymbolLinkerVisible(const MCSymbol &SD) const;
 
-  /// Emit the section contents using the given object writer.
-  void writeSectionData(const MCSection *Section,
+  /// Emit the section contents to \p OW.
+  void writeSectionData(MCObjectWriter &OW, const MCSection *Section,
                         const MCAsmLayout &Layout) const;
 
+  /// Emit the section contents using the assembler's object writer.
+  void writeSectionData(const MCSection *Section,
+                        const MCAsmLayout &Layout) const {
+    writeSectionData(getWriter(), Section, Layout);
+  }
+
   /// Check whether a given symbol has been flagged with .thumb_func.
   bool isThumbFunc(const MCSymbol *Func) const;
 
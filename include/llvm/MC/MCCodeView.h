@@ -157,7 +157,7 @@ struct MCCVFunctionInfo {
 /// Holds state from .cv_file and .cv_loc directives for later emission.
 class CodeViewContext {
 public:
-  CodeViewContext();
+  explicit CodeViewContext(MCContext &MCCtx);
   ~CodeViewContext();
 
   bool isValidFileNumber(unsigned FileNumber) const;
@@ -274,6 +274,9 @@ public:
   void emitFileChecksums(MCObjectStreamer &OS);
 
 private:
+  /// The owning context; fragments we create are allocated in its arena.
+  MCContext &MCCtx;
+
   /// The current CodeView line information from the last .cv_loc directive.
   MCCVLoc CurrentCVLoc = MCCVLoc(0, 0, 0, 0, false, true);
   bool CVLocSeen = false;
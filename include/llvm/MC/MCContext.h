@@ -10,6 +10,7 @@
 #ifndef LLVM_MC_MCCONTEXT_H
 #define LLVM_MC_MCCONTEXT_H
 
+#include "llvm/ADT/ArrayRef.h"
 #include "llvm/ADT/DenseMap.h"
 #include "llvm/ADT/SetVector.h"
 #include "llvm/ADT/SmallString.h"
@@ -23,6 +24,7 @@
 #include "llvm/Support/Allocator.h"
 #include "llvm/Support/Compiler.h"
 #include "llvm/Support/Dwarf.h"
+#include "llvm/Support/Mutex.h"
 #include "llvm/Support/raw_ostream.h"
 #include <algorithm>
 #include <cassert>
@@ -60,6 +62,21 @@ namespace llvm {
   public:
     using SymbolTable = StringMap<MCSymbol *, BumpPtrAllocator &>;
 
+    /// Number of hash-selected shards the symbol tables are split into.
+    enum { NumSymbolShards = 16 };
+
+    /// A shard of the name-to-symbol binding table. Each shard owns the
+    /// arena its map storage is allocated from, so shards can grow
+    /// independently when symbols are created from several threads (see
+    /// setConcurrentSymbolCreation()).
+    struct SymbolTableShard {
+      mutable sys::SmartMutex<true> Lock;
+      BumpPtrAllocator Allocator;
+      SymbolTable Symbols;
+
+      SymbolTableShard() : Symbols(Allocator) {}
+    };
+
   private:
     /// The SourceMgr for this object, if any.
     const SourceMgr *SrcMgr;
@@ -89,8 +106,44 @@ namespace llvm {
     SpecificBumpPtrAllocator<MCSectionMachO> MachOAllocator;
     SpecificBumpPtrAllocator<MCSectionWasm> WasmAllocator;
 
-    /// Bindings of names to symbols.
-    SymbolTable Symbols;
+    /// A shard of the used-name table. The name strings and the MCSymbol
+    /// objects named by them are allocated from the shard's arena, under the
+    /// shard's lock when concurrent symbol creation is enabled.
+    struct UsedNamesShard {
+      mutable sys::SmartMutex<true> Lock;
+      BumpPtrAllocator Allocator;
+      StringMap<bool, BumpPtrAllocator &> UsedNames;
+
+      UsedNamesShard() : UsedNames(Allocator) {}
+    };
+
+    /// Lock guard for a symbol table shard that only engages when the
+    /// context is in concurrent symbol creation mode, so the default
+    /// single-threaded path stays lock-free.
+    class OptionalShardLock {
+      sys::SmartMutex<true> *M;
+
+    public:
+      OptionalShardLock(sys::SmartMutex<true> &M, bool Enable)
+          : M(Enable ? &M : nullptr) {
+        if (this->M)
+          this->M->lock();
+      }
+      ~OptionalShardLock() {
+        if (M)
+          M->unlock();
+      }
+    };
+
+    /// Bindings of names to symbols, sharded by name hash.
+    SymbolTableShard SymbolShards[NumSymbolShards];
+
+    /// Select the shard responsible for \p Name. Used for both the symbol
+    /// and the used-name tables; the two have separate shard arrays so the
+    /// lock order is always symbol shard before used-name shard.
+    static unsigned getSymbolShard(StringRef Name) {
+      return static_cast<unsigned>(hash_value(Name)) & (NumSymbolShards - 1);
+    }
 
     /// A mapping from a local label number and an instance count to a symbol.
     /// For example, in the assembly
@@ -103,13 +156,22 @@ namespace llvm {
     /// Keeps tracks of names that were used both for used declared and
     /// artificial symbols. The value is "true" if the name has been used for a
     /// non-section symbol (there can be at most one of those, plus an unlimited
-    /// number of section symbols with the same name).
-    StringMap<bool, BumpPtrAllocator &> UsedNames;
+    /// number of section symbols with the same name). Sharded by name hash.
+    UsedNamesShard UsedNameShards[NumSymbolShards];
+
+    /// When true, accesses to the symbol table shards take their shard lock
+    /// so that several MCStreamer producers may create symbols in this
+    /// context concurrently. Set via setConcurrentSymbolCreation().
+    bool ConcurrentSymbolCreation;
 
     /// The next ID to dole out to an unnamed assembler temporary symbol with
     /// a given prefix.
     StringMap<unsigned> NextID;
 
+    /// Guards NextID in concurrent symbol creation mode. Suffix counters are
+    /// rare enough relative to symbol lookups that they share one lock.
+    mutable sys::SmartMutex<true> NextIDLock;
+
     /// Instances of directional local labels.
     DenseMap<unsigned, MCLabel *> Instances;
     /// NextInstance() creates the next instance of the directional local label
@@ -254,10 +316,14 @@ namespace llvm {
     bool HadError = false;
 
     MCSymbol *createSymbolImpl(const StringMapEntry<bool> *Name,
-                               bool CanBeUnnamed);
+                               bool CanBeUnnamed, BumpPtrAllocator &Alloc);
     MCSymbol *createSymbol(StringRef Name, bool AlwaysAddSuffix,
                            bool IsTemporary);
 
+    /// Return the next suffix value for renamable symbols with the given
+    /// base name, taking NextIDLock in concurrent symbol creation mode.
+    unsigned getNextUniqueID(StringRef Name);
+
     MCSymbol *getOrCreateDirectionalLocalSymbol(unsigned LocalLabelVal,
                                                 unsigned Instance);
 
@@ -291,6 +357,20 @@ namespace llvm {
     void setAllowTemporaryLabels(bool Value) { AllowTemporaryLabels = Value; }
     void setUseNamesOnTempLabels(bool Value) { UseNamesOnTempLabels = Value; }
 
+    /// \brief Enable or disable concurrent symbol creation.
+    ///
+    /// When enabled, accesses to the symbol table shards take their shard
+    /// lock so that several MCStreamer producers may create symbols in this
+    /// context concurrently. Section creation, dwarf state and the rest of
+    /// the context remain caller-synchronized; this only makes the symbol
+    /// uniquing tables safe to share.
+    void setConcurrentSymbolCreation(bool Enable) {
+      ConcurrentSymbolCreation = Enable;
+    }
+    bool hasConcurrentSymbolCreation() const {
+      return ConcurrentSymbolCreation;
+    }
+
     /// \name Module Lifetime Management
     /// @{
 
@@ -344,11 +424,12 @@ namespace llvm {
     /// Set value for a symbol.
     void setSymbolValue(MCStreamer &Streamer, StringRef Sym, uint64_t Val);
 
-    /// getSymbols - Get a reference for the symbol table for clients that
-    /// want to, for example, iterate over all symbols. 'const' because we
-    /// still want any modifications to the table itself to use the MCContext
-    /// APIs.
-    const SymbolTable &getSymbols() const { return Symbols; }
+    /// getSymbols - Get the symbol table shards for clients that want to,
+    /// for example, iterate over all symbols. 'const' because we still want
+    /// any modifications to the table itself to use the MCContext APIs.
+    ArrayRef<SymbolTableShard> getSymbols() const {
+      return makeArrayRef(SymbolShards, NumSymbolShards);
+    }
 
     /// @}
 
@@ -11,14 +11,15 @@
 #define LLVM_MC_MCDISASSEMBLER_MCDISASSEMBLER_H
 
 #include "llvm/MC/MCDisassembler/MCSymbolizer.h"
+#include "llvm/MC/MCInst.h"
 #include <cstdint>
 #include <memory>
+#include <vector>
 
 namespace llvm {
 
 template <typename T> class ArrayRef;
 class MCContext;
-class MCInst;
 class MCSubtargetInfo;
 class raw_ostream;
 
@@ -79,6 +80,33 @@ public:
                                       raw_ostream &VStream,
                                       raw_ostream &CStream) const = 0;
 
+  /// One decode attempt produced by getInstructions. If Status is Fail the
+  /// MCInst contents are unspecified and Size is the number of bytes to skip
+  /// before decoding can resume.
+  struct DecodedInst {
+    MCInst Inst;
+    uint64_t Size;
+    DecodeStatus Status;
+    /// This instruction's slice of the comment buffer that was passed to
+    /// getInstructions.
+    unsigned CommentOffset;
+    unsigned CommentSize;
+  };
+
+  /// Batch version of getInstruction: decode all of \p Bytes, starting at
+  /// \p Address, appending one DecodedInst per decode attempt to \p Insts.
+  /// Undecodable bytes produce a Fail entry covering at least one byte, so
+  /// the range is always fully consumed. Comments are accumulated in
+  /// \p Comments, and each entry records the slice that belongs to it. Both
+  /// containers can be reserved up front and reused across calls to avoid
+  /// per-instruction allocation.
+  ///
+  /// \returns the number of entries appended to \p Insts.
+  size_t getInstructions(std::vector<DecodedInst> &Insts,
+                         SmallVectorImpl<char> &Comments,
+                         ArrayRef<uint8_t> Bytes, uint64_t Address,
+                         raw_ostream &VStream) const;
+
 private:
   MCContext &Ctx;
 
@@ -94,7 +94,9 @@ public:
   /// Destroys the current fragment.
   ///
   /// This must be used instead of delete as MCFragment is non-virtual.
-  /// This method will dispatch to the appropriate subclass.
+  /// This method will dispatch to the appropriate subclass. Fragments are
+  /// allocated in the owning MCContext's arena, so this only runs the
+  /// destructor; the storage is recycled when the context is reset.
   void destroy();
 
   FragmentType getKind() const { return Kind; }
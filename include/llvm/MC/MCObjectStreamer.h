@@ -10,6 +10,7 @@
 #ifndef LLVM_MC_MCOBJECTSTREAMER_H
 #define LLVM_MC_MCOBJECTSTREAMER_H
 
+#include "llvm/ADT/DenseMap.h"
 #include "llvm/ADT/SmallVector.h"
 #include "llvm/MC/MCAssembler.h"
 #include "llvm/MC/MCSection.h"
@@ -40,6 +41,29 @@ class MCObjectStreamer : public MCStreamer {
   bool EmitDebugFrame;
   SmallVector<MCSymbol *, 2> PendingLabels;
 
+  /// Streaming offset tracking for -mc-early-relax. While every fragment
+  /// emitted into a section so far has a size that is independent of layout,
+  /// section offsets are known exactly during streaming and backward
+  /// PC-relative fixups can be resolved without waiting for layout.
+  struct ExactOffsetInfo {
+    /// False once a fragment with a layout-dependent size (or one inserted
+    /// behind the tracker's back) enters the section.
+    bool Exact = true;
+    /// Exact offset of the first byte of Tail.
+    uint64_t TailOffset = 0;
+    /// The last fragment inserted through insert().
+    MCFragment *Tail = nullptr;
+  };
+  DenseMap<MCSection *, ExactOffsetInfo> ExactOffsets;
+  /// Exact start offsets of data fragments in still-exact sections; used to
+  /// compute the addresses of the symbols attached to them.
+  DenseMap<const MCFragment *, uint64_t> ExactFragmentStarts;
+
+  void trackInsertedFragment(MCFragment *F);
+  uint64_t exactTailSize(const ExactOffsetInfo &Info);
+  bool maybeEmitResolvedInstToData(const MCInst &Inst,
+                                   const MCSubtargetInfo &STI);
+
   virtual void EmitInstToData(const MCInst &Inst, const MCSubtargetInfo&) = 0;
   void EmitCFIStartProcImpl(MCDwarfFrameInfo &Frame) override;
   void EmitCFIEndProcImpl(MCDwarfFrameInfo &Frame) override;
@@ -66,6 +90,7 @@ public:
     MCSection *CurSection = getCurrentSectionOnly();
     CurSection->getFragmentList().insert(CurInsertionPoint, F);
     F->setParent(CurSection);
+    trackInsertedFragment(F);
   }
 
   /// Get a data fragment to write into, creating a new one if the current
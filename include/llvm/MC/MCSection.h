@@ -165,7 +165,8 @@ public:
   reverse_iterator rend() { return Fragments.rend(); }
   const_reverse_iterator rend() const  { return Fragments.rend(); }
 
-  MCSection::iterator getSubsectionInsertionPoint(unsigned Subsection);
+  MCSection::iterator getSubsectionInsertionPoint(MCContext &Ctx,
+                                                  unsigned Subsection);
 
   void dump();
 
@@ -162,9 +162,10 @@ protected:
   }
 
   // Provide custom new/delete as we will only allocate space for a name
-  // if we need one.
+  // if we need one. The allocator is the arena of the symbol table shard
+  // that owns the name.
   void *operator new(size_t s, const StringMapEntry<bool> *Name,
-                     MCContext &Ctx);
+                     BumpPtrAllocator &Alloc);
 
 private:
   void operator delete(void *);
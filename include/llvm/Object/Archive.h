@@ -16,6 +16,7 @@
 
 #include "llvm/ADT/iterator_range.h"
 #include "llvm/ADT/Optional.h"
+#include "llvm/ADT/StringMap.h"
 #include "llvm/ADT/StringRef.h"
 #include "llvm/Object/Binary.h"
 #include "llvm/Support/Chrono.h"
@@ -267,9 +268,23 @@ public:
   uint32_t getNumberOfSymbols() const;
 
   std::vector<std::unique_ptr<MemoryBuffer>> takeThinBuffers() {
-    return std::move(ThinBuffers);
+    std::vector<std::unique_ptr<MemoryBuffer>> Buffers;
+    Buffers.reserve(ThinBuffers.size());
+    for (auto &Entry : ThinBuffers)
+      Buffers.push_back(std::move(Entry.second));
+    ThinBuffers.clear();
+    return Buffers;
   }
 
+  /// Open and map every thin archive member on a thread pool, populating
+  /// the buffer cache that Child::getBuffer() consults, so that iterating
+  /// the members afterwards performs no file system calls. Members that
+  /// fail to open are left out of the cache and report their error when
+  /// actually requested. Must not run concurrently with other uses of this
+  /// archive. A \p NumThreads of 0 uses all hardware threads. Does nothing
+  /// for regular archives.
+  Error preloadThinBuffers(unsigned NumThreads = 0);
+
 private:
   StringRef SymbolTable;
   StringRef StringTable;
@@ -280,7 +295,10 @@ private:
 
   unsigned Format : 3;
   unsigned IsThin : 1;
-  mutable std::vector<std::unique_ptr<MemoryBuffer>> ThinBuffers;
+  /// Maps the path of an already loaded thin archive member to its buffer,
+  /// so each referenced file is opened once no matter how many times its
+  /// contents are requested.
+  mutable StringMap<std::unique_ptr<MemoryBuffer>> ThinBuffers;
 };
 
 } // end namespace object
@@ -262,9 +262,16 @@ public:
   using LoadCommandList = SmallVector<LoadCommandInfo, 4>;
   using load_command_iterator = LoadCommandList::const_iterator;
 
+  /// When \p ScanOnly is true the load commands are indexed with only the
+  /// bounds checks needed to walk them and to keep the accessors memory
+  /// safe; the full structural validation normally done here is skipped.
+  /// This makes opening a file dramatically cheaper for tools that scan
+  /// many binaries to read a single table or section, at the cost of not
+  /// diagnosing most forms of malformedness up front.
   static Expected<std::unique_ptr<MachOObjectFile>>
   create(MemoryBufferRef Object, bool IsLittleEndian, bool Is64Bits,
-         uint32_t UniversalCputype = 0, uint32_t UniversalIndex = 0);
+         uint32_t UniversalCputype = 0, uint32_t UniversalIndex = 0,
+         bool ScanOnly = false);
 
   void moveSymbolNext(DataRefImpl &Symb) const override;
 
@@ -616,7 +623,7 @@ public:
 private:
   MachOObjectFile(MemoryBufferRef Object, bool IsLittleEndian, bool Is64Bits,
                   Error &Err, uint32_t UniversalCputype = 0,
-                  uint32_t UniversalIndex = 0);
+                  uint32_t UniversalIndex = 0, bool ScanOnly = false);
 
   uint64_t getSymbolValueImpl(DataRefImpl Symb) const override;
 
@@ -110,7 +110,9 @@ public:
       }
     }
 
-    Expected<std::unique_ptr<MachOObjectFile>> getAsObjectFile() const;
+    /// \p ScanOnly has the same meaning as for MachOObjectFile::create().
+    Expected<std::unique_ptr<MachOObjectFile>>
+    getAsObjectFile(bool ScanOnly = false) const;
 
     Expected<std::unique_ptr<Archive>> getAsArchive() const;
   };
@@ -320,7 +320,8 @@ public:
   static Expected<std::unique_ptr<MachOObjectFile>>
   createMachOObjectFile(MemoryBufferRef Object,
                         uint32_t UniversalCputype = 0,
-                        uint32_t UniversalIndex = 0);
+                        uint32_t UniversalIndex = 0,
+                        bool ScanOnly = false);
 
   static Expected<std::unique_ptr<WasmObjectFile>>
   createWasmObjectFile(MemoryBufferRef Object);
@@ -42,6 +42,7 @@
 namespace llvm {
 
 class IndexedInstrProfReader;
+class MemoryBuffer;
 
 namespace coverage {
 
@@ -425,16 +426,49 @@ public:
 /// This is the main interface to get coverage information, using a profile to
 /// fill out execution counts.
 class CoverageMapping {
-  StringSet<> FunctionNames;
-  std::vector<FunctionRecord> Functions;
-  unsigned MismatchedFunctionCount = 0;
+  /// \brief A function's coverage record as decoded by the reader, kept
+  /// delta-encoded (counter expressions unevaluated) until a query touches
+  /// one of its files. The views point into reader-owned storage.
+  struct RawFunctionRecord {
+    StringRef FunctionName;
+    uint64_t FunctionHash;
+    ArrayRef<StringRef> Filenames;
+    ArrayRef<CounterExpression> Expressions;
+    ArrayRef<CounterMappingRegion> MappingRegions;
+  };
+
+  // Members involved in lazy materialization are mutable so that the const
+  // query methods can expand records on demand.
+  mutable StringSet<> FunctionNames;
+  mutable std::vector<FunctionRecord> Functions;
+  mutable unsigned MismatchedFunctionCount = 0;
+
+  /// Records not yet expanded into Functions, in reader order. Only used
+  /// by mappings created by the file-based load, which owns its readers.
+  mutable std::vector<RawFunctionRecord> PendingRecords;
+
+  /// Storage backing PendingRecords for lazily-loaded mappings.
+  std::vector<std::unique_ptr<MemoryBuffer>> OwnedBuffers;
+  std::vector<std::unique_ptr<CoverageMappingReader>> OwnedReaders;
+  std::unique_ptr<IndexedInstrProfReader> OwnedProfileReader;
 
   CoverageMapping() = default;
   /// \brief Add a function record corresponding to \p Record.
   Error loadFunctionRecord(const CoverageMappingRecord &Record,
-                           IndexedInstrProfReader &ProfileReader);
+                           IndexedInstrProfReader &ProfileReader) const;
+
+  /// \brief Remember \p Record for later materialization instead of
+  /// expanding it now.
+  void registerFunctionRecord(const CoverageMappingRecord &Record);
+
+  /// \brief Expand the pending records that involve \p Filename, or all
+  /// pending records if \p Filename is empty. Lazy-materialization errors
+  /// are treated like profile mismatches: the record is dropped and
+  /// counted, since the query interface has no error channel.
+  void materializeForFile(StringRef Filename) const;
 
 public:
+  ~CoverageMapping();
   CoverageMapping(const CoverageMapping &) = delete;
   CoverageMapping &operator=(const CoverageMapping &) = delete;
 
@@ -462,7 +496,10 @@ public:
   ///
   /// This is a count of functions whose profile is out of date or otherwise
   /// can't be associated with any coverage information.
-  unsigned getMismatchedCount() { return MismatchedFunctionCount; }
+  unsigned getMismatchedCount() {
+    materializeForFile(StringRef());
+    return MismatchedFunctionCount;
+  }
 
   /// \brief Returns a lexicographically sorted, unique list of files that are
   /// covered.
@@ -477,6 +514,7 @@ public:
 
   /// \brief Gets all of the functions covered by this profile.
   iterator_range<FunctionRecordIterator> getCoveredFunctions() const {
+    materializeForFile(StringRef());
     return make_range(FunctionRecordIterator(Functions),
                       FunctionRecordIterator());
   }
@@ -484,6 +522,7 @@ public:
   /// \brief Gets all of the functions in a particular file.
   iterator_range<FunctionRecordIterator>
   getCoveredFunctions(StringRef Filename) const {
+    materializeForFile(Filename);
     return make_range(FunctionRecordIterator(Functions, Filename),
                       FunctionRecordIterator());
   }
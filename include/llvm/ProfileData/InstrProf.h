@@ -37,7 +37,6 @@
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
-#include <list>
 #include <memory>
 #include <string>
 #include <system_error>
@@ -557,8 +556,10 @@ StringRef InstrProfSymtab::getOrigFuncName(uint64_t FuncMD5Hash) {
 }
 
 struct InstrProfValueSiteRecord {
-  /// Value profiling data pairs at a given value site.
-  std::list<InstrProfValueData> ValueData;
+  /// Value profiling data pairs at a given value site. Stored contiguously:
+  /// merging fleet-sized value profiles is bound by allocator traffic and
+  /// pointer chasing when every pair is a separate list node.
+  std::vector<InstrProfValueData> ValueData;
 
   InstrProfValueSiteRecord() { ValueData.clear(); }
   template <class InputIterator>
@@ -567,7 +568,8 @@ struct InstrProfValueSiteRecord {
 
   /// Sort ValueData ascending by Value
   void sortByTargetValues() {
-    ValueData.sort(
+    std::sort(
+        ValueData.begin(), ValueData.end(),
         [](const InstrProfValueData &left, const InstrProfValueData &right) {
           return left.Value < right.Value;
         });
@@ -774,7 +776,10 @@ inline support::endianness getHostEndianness() {
 #include "llvm/ProfileData/InstrProfData.inc"
 
 void InstrProfValueSiteRecord::sortByCount() {
-  ValueData.sort(
+  // Stable so that entries with equal counts keep their target-value order,
+  // which keeps the emitted profile deterministic.
+  std::stable_sort(
+      ValueData.begin(), ValueData.end(),
       [](const InstrProfValueData &left, const InstrProfValueData &right) {
         return left.Count > right.Count;
       });
@@ -281,6 +281,9 @@ enum class HashT : uint32_t;
 /// format.
 class InstrProfLookupTrait {
   std::vector<InstrProfRecord> DataBuffer;
+  // Scratch space for counts lookups on big-endian hosts, where the on-disk
+  // little-endian counters cannot be viewed in place.
+  std::vector<uint64_t> CountsScratch;
   IndexedInstrProf::HashT HashType;
   unsigned FormatVersion;
   // Endianness of the input value profile data.
@@ -322,6 +325,14 @@ public:
                               const unsigned char *const End);
   data_type ReadData(StringRef K, const unsigned char *D, offset_type N);
 
+  /// Scan the on-disk records for the one matching \p FuncHash and point
+  /// \p Counts at its counter values without materializing InstrProfRecords.
+  /// On little-endian hosts the view references the profile mapping directly;
+  /// otherwise it references scratch space owned by this trait that is only
+  /// valid until the next lookup.
+  instrprof_error ReadCounts(const unsigned char *D, offset_type N,
+                             uint64_t FuncHash, ArrayRef<uint64_t> &Counts);
+
   // Used for testing purpose only.
   void setValueProfDataEndianness(support::endianness Endianness) {
     ValueProfDataEndianness = Endianness;
@@ -338,6 +349,11 @@ struct InstrProfReaderIndexBase {
   // Read all the profile records with the key equal to FuncName
   virtual Error getRecords(StringRef FuncName,
                                      ArrayRef<InstrProfRecord> &Data) = 0;
+
+  // Read the counters of the record with the key FuncName and hash FuncHash
+  // as a view into the on-disk data, without materializing profile records.
+  virtual Error getFunctionCounts(StringRef FuncName, uint64_t FuncHash,
+                                  ArrayRef<uint64_t> &Counts) = 0;
   virtual void advanceToNextKey() = 0;
   virtual bool atEnd() const = 0;
   virtual void setValueProfDataEndianness(support::endianness Endianness) = 0;
@@ -367,6 +383,8 @@ public:
   Error getRecords(ArrayRef<InstrProfRecord> &Data) override;
   Error getRecords(StringRef FuncName,
                    ArrayRef<InstrProfRecord> &Data) override;
+  Error getFunctionCounts(StringRef FuncName, uint64_t FuncHash,
+                          ArrayRef<uint64_t> &Counts) override;
   void advanceToNextKey() override { RecordIterator++; }
 
   bool atEnd() const override {
@@ -430,6 +448,14 @@ public:
   Error getFunctionCounts(StringRef FuncName, uint64_t FuncHash,
                           std::vector<uint64_t> &Counts);
 
+  /// Point Counts at the profile data for the given function name without
+  /// copying it. On little-endian hosts the view aliases the profile buffer
+  /// and stays valid for the lifetime of this reader; on big-endian hosts it
+  /// references an internal scratch buffer that is overwritten by the next
+  /// counts lookup.
+  Error getFunctionCountsView(StringRef FuncName, uint64_t FuncHash,
+                              ArrayRef<uint64_t> &Counts);
+
   /// Return the maximum of all known function counts.
   uint64_t getMaximumFunctionCount() { return Summary->getMaxFunctionCount(); }
 
@@ -85,6 +85,16 @@ static inline uint64_t SPMagic() {
          uint64_t('2') << (64 - 56) | uint64_t(0xff);
 }
 
+/// Magic number for the indexed binary format. Identical to SPMagic()
+/// except for the trailing byte, so the two encodings can be told apart
+/// without reading past the first field.
+static inline uint64_t SPIndexedMagic() {
+  return uint64_t('S') << (64 - 8) | uint64_t('P') << (64 - 16) |
+         uint64_t('R') << (64 - 24) | uint64_t('O') << (64 - 32) |
+         uint64_t('F') << (64 - 40) | uint64_t('4') << (64 - 48) |
+         uint64_t('2') << (64 - 56) | uint64_t(0xfe);
+}
+
 static inline uint64_t SPVersion() { return 103; }
 
 /// Represents the relative location of an instruction.
@@ -204,6 +204,30 @@
 //          in the text format documentation above).
 //        FUNCTION BODY
 //          A FUNCTION BODY entry describing the inlined function.
+//
+// Indexed binary format
+// ---------------------
+//
+// This encoding shares the header, summary, name table and function record
+// layout with the binary format above, but uses a different magic number
+// (computed by SPIndexedMagic()) and inserts a function offset table between
+// the name table and the function records:
+//
+// FUNCTION OFFSET TABLE
+//    SIZE (uint32_t)
+//        Number of entries in the table.
+//    ENTRIES
+//        A list of SIZE entries. Each entry contains:
+//          NAME_IDX (uint32_t)
+//            Index into the name table with the function name.
+//          OFFSET (uint64_t)
+//            Byte offset of the function's record relative to the first
+//            byte after the table.
+//
+// The offset table lets the reader deserialize individual functions on
+// demand instead of materializing the whole profile, which matters when a
+// large fleet-wide profile is used to compile a translation unit containing
+// only a few of the functions sampled in it.
 //===----------------------------------------------------------------------===//
 
 #ifndef LLVM_PROFILEDATA_SAMPLEPROFREADER_H
@@ -212,6 +236,7 @@
 #include "llvm/ADT/SmallVector.h"
 #include "llvm/ADT/StringMap.h"
 #include "llvm/ADT/StringRef.h"
+#include "llvm/ADT/StringSet.h"
 #include "llvm/ADT/Twine.h"
 #include "llvm/IR/DiagnosticInfo.h"
 #include "llvm/IR/Function.h"
@@ -231,6 +256,7 @@
 
 namespace llvm {
 
+class Module;
 class raw_ostream;
 
 namespace sampleprof {
@@ -275,6 +301,13 @@ public:
   /// \brief Read sample profiles from the associated file.
   virtual std::error_code read() = 0;
 
+  /// \brief Tell the reader which functions the client intends to query.
+  ///
+  /// Readers that support loading profiles on demand use this to restrict
+  /// read() to the functions defined in \p M. The default implementation
+  /// does nothing; such readers always load the whole profile.
+  virtual void collectFunctionsFrom(const Module &M) {}
+
   /// \brief Print the profile for \p FName on stream \p OS.
   void dumpFunctionProfile(StringRef FName, raw_ostream &OS = dbgs());
 
@@ -282,7 +315,7 @@ public:
   void dump(raw_ostream &OS = dbgs());
 
   /// \brief Return the samples collected for function \p F.
-  FunctionSamples *getSamplesFor(const Function &F) {
+  virtual FunctionSamples *getSamplesFor(const Function &F) {
     // The function name may have been updated by adding suffix. In sample
     // profile, the function names are all stripped, so we need to strip
     // the function name suffix before matching with profile.
@@ -384,9 +417,25 @@ protected:
   /// \brief Return true if we've reached the end of file.
   bool at_eof() const { return Data >= End; }
 
+  /// \brief Read the magic number and version and check them against the
+  /// format this reader expects.
+  std::error_code readMagicIdent();
+
+  /// \brief Check that \p Magic identifies the format this reader expects.
+  virtual std::error_code verifySPMagic(uint64_t Magic);
+
+  /// \brief Read the name table.
+  std::error_code readNameTable();
+
+  /// \brief Read one top-level function record at the current position.
+  std::error_code readFunProfile();
+
   /// Read the contents of the given profile instance.
   std::error_code readProfile(FunctionSamples &FProfile);
 
+  /// \brief Read profile summary.
+  std::error_code readSummary();
+
   /// \brief Points to the current location in the buffer.
   const uint8_t *Data;
 
@@ -398,9 +447,53 @@ protected:
 
 private:
   std::error_code readSummaryEntry(std::vector<ProfileSummaryEntry> &Entries);
+};
 
-  /// \brief Read profile summary.
-  std::error_code readSummary();
+/// \brief Reader for the indexed binary format.
+///
+/// The function offset table in the header makes every function record
+/// individually addressable, so profiles are deserialized only for the
+/// functions the client asks about. See the format description at the top
+/// of the file.
+class SampleProfileReaderIndexedBinary : public SampleProfileReaderBinary {
+public:
+  SampleProfileReaderIndexedBinary(std::unique_ptr<MemoryBuffer> B,
+                                   LLVMContext &C)
+      : SampleProfileReaderBinary(std::move(B), C), Records(nullptr) {}
+
+  /// \brief Read and validate the file header, including the function
+  /// offset table.
+  std::error_code readHeader() override;
+
+  /// \brief Read the profiles of the functions collected from a module, or
+  /// all profiles if no module has been collected from.
+  std::error_code read() override;
+
+  /// \brief Restrict read() to the functions defined in \p M.
+  void collectFunctionsFrom(const Module &M) override;
+
+  /// \brief Return the samples collected for function \p F, loading them
+  /// from the profile on first use.
+  FunctionSamples *getSamplesFor(const Function &F) override;
+
+  /// \brief Return true if \p Buffer is in the format supported by this class.
+  static bool hasFormat(const MemoryBuffer &Buffer);
+
+protected:
+  std::error_code verifySPMagic(uint64_t Magic) override;
+
+private:
+  std::error_code readFuncOffsetTable();
+
+  /// Maps every function name to the offset of its record, relative to
+  /// \c Records.
+  StringMap<uint64_t> FuncOffsetTable;
+
+  /// Functions read() should load. Empty means all of them.
+  StringSet<> FuncsToUse;
+
+  /// \brief Points to the first byte after the function offset table.
+  const uint8_t *Records;
 };
 
 typedef SmallVector<FunctionSamples *, 10> InlineCallStack;
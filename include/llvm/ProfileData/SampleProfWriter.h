@@ -28,7 +28,13 @@
 namespace llvm {
 namespace sampleprof {
 
-enum SampleProfileFormat { SPF_None = 0, SPF_Text, SPF_Binary, SPF_GCC };
+enum SampleProfileFormat {
+  SPF_None = 0,
+  SPF_Text,
+  SPF_Binary,
+  SPF_GCC,
+  SPF_Indexed_Binary
+};
 
 /// \brief Sample-based profile writer. Base class.
 class SampleProfileWriter {
@@ -43,7 +49,7 @@ public:
   /// Write all the sample profiles in the given map of samples.
   ///
   /// \returns status code of the file update operation.
-  std::error_code write(const StringMap<FunctionSamples> &ProfileMap) {
+  virtual std::error_code write(const StringMap<FunctionSamples> &ProfileMap) {
     if (std::error_code EC = writeHeader(ProfileMap))
       return EC;
     for (const auto &I : ProfileMap) {
@@ -121,6 +127,7 @@ protected:
 
   std::error_code
   writeHeader(const StringMap<FunctionSamples> &ProfileMap) override;
+  virtual std::error_code writeMagicIdent();
   std::error_code writeSummary();
   std::error_code writeNameIdx(StringRef FName);
   std::error_code writeBody(const FunctionSamples &S);
@@ -136,6 +143,31 @@ private:
                               SampleProfileFormat Format);
 };
 
+/// \brief Sample-based profile writer (indexed binary format).
+///
+/// Emits the same function records as the binary writer but prefixes them
+/// with a function offset table, so readers can locate and deserialize
+/// individual functions without scanning the whole profile. See the format
+/// description in SampleProfReader.h.
+class SampleProfileWriterIndexedBinary : public SampleProfileWriterBinary {
+public:
+  using SampleProfileWriterBinary::write;
+
+  std::error_code
+  write(const StringMap<FunctionSamples> &ProfileMap) override;
+
+protected:
+  SampleProfileWriterIndexedBinary(std::unique_ptr<raw_ostream> &OS)
+      : SampleProfileWriterBinary(OS) {}
+
+  std::error_code writeMagicIdent() override;
+
+private:
+  friend ErrorOr<std::unique_ptr<SampleProfileWriter>>
+  SampleProfileWriter::create(std::unique_ptr<raw_ostream> &OS,
+                              SampleProfileFormat Format);
+};
+
 } // end namespace sampleprof
 } // end namespace llvm
 
@@ -0,0 +1,65 @@
+//===- AllocProfile.h - Allocation growth instrumentation -------*- C++ -*-===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+//
+// Opt-in instrumentation that records where the containers with inline
+// storage fall back to the heap: SmallVector growth, DenseMap rehashes and
+// BumpPtrAllocator slab allocations.  Each event is attributed to its call
+// site via the return address and aggregated into a per-site histogram that
+// is printed when the process exits, so inline capacities ('N' parameters)
+// and reserve() calls can be tuned from real compile workloads.
+//
+// The hooks compile away entirely unless LLVM_ENABLE_ALLOC_PROFILE is
+// defined (cmake -DLLVM_ENABLE_ALLOC_PROFILE=ON).  An instrumented binary
+// records and reports only when the LLVM_ALLOC_PROFILE environment variable
+// is set.  Call sites are printed as raw addresses; resolve them with
+// llvm-symbolizer or addr2line against the instrumented binary.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_SUPPORT_ALLOCPROFILE_H
+#define LLVM_SUPPORT_ALLOCPROFILE_H
+
+#include <cstddef>
+
+namespace llvm {
+namespace allocprof {
+
+/// The container event being recorded.
+enum AllocKind {
+  /// A SmallVector allocated or reallocated heap storage.
+  SmallVectorGrow,
+  /// A DenseMap or SmallDenseMap allocated a new bucket array.
+  DenseMapGrow,
+  /// A BumpPtrAllocator started a new slab.
+  BumpPtrSlab
+};
+
+#ifdef LLVM_ENABLE_ALLOC_PROFILE
+/// Record one growth event of \p Size bytes at \p ReturnAddress.  Thread
+/// safe; never reenters the instrumented containers.
+void recordGrow(AllocKind Kind, size_t Size, void *ReturnAddress);
+#endif
+
+} // end namespace allocprof
+} // end namespace llvm
+
+#ifdef LLVM_ENABLE_ALLOC_PROFILE
+#if defined(__GNUC__) || defined(__clang__)
+#define LLVM_ALLOC_PROFILE_CALLSITE() __builtin_return_address(0)
+#else
+#define LLVM_ALLOC_PROFILE_CALLSITE() nullptr
+#endif
+#define LLVM_RECORD_ALLOC_GROW(KIND, SIZE)                                     \
+  ::llvm::allocprof::recordGrow(::llvm::allocprof::KIND, (SIZE),               \
+                                LLVM_ALLOC_PROFILE_CALLSITE())
+#else
+#define LLVM_RECORD_ALLOC_GROW(KIND, SIZE) ((void)0)
+#endif
+
+#endif // LLVM_SUPPORT_ALLOCPROFILE_H
@@ -22,6 +22,7 @@
 #define LLVM_SUPPORT_ALLOCATOR_H
 
 #include "llvm/ADT/SmallVector.h"
+#include "llvm/Support/AllocProfile.h"
 #include "llvm/Support/Compiler.h"
 #include "llvm/Support/MathExtras.h"
 #include <algorithm>
@@ -110,6 +111,68 @@ public:
   void PrintStats() const {}
 };
 
+/// \brief An allocator with malloc semantics which recycles standard-size
+/// slabs through a process-wide pool.
+///
+/// Requests of exactly \c PoolableSize bytes are served from a small cache
+/// local to the allocator instance, which is refilled from (and spilled to) a
+/// process-wide lock-free freelist. As an allocator instance is only ever
+/// used from a single thread the local cache is uncontended, so concurrent
+/// arena churn recycles memory without round-tripping through malloc or
+/// serializing on a lock. Requests of any other size pass straight through
+/// to malloc.
+///
+/// This is primarily intended as the underlying allocator of a
+/// \c BumpPtrAllocator (see \c PooledBumpPtrAllocator below) whose default
+/// slab size matches \c PoolableSize.
+class PooledMallocAllocator : public AllocatorBase<PooledMallocAllocator> {
+  /// Head of this instance's intrusive freelist of cached slabs.
+  void *LocalCache = nullptr;
+
+  /// Number of slabs in the local cache.
+  unsigned LocalCacheSize = 0;
+
+public:
+  /// The request size eligible for pooling. This matches the default slab
+  /// size of \c BumpPtrAllocator.
+  static const size_t PoolableSize = 4096;
+
+  PooledMallocAllocator() = default;
+
+  PooledMallocAllocator(PooledMallocAllocator &&Old)
+      : LocalCache(Old.LocalCache), LocalCacheSize(Old.LocalCacheSize) {
+    Old.LocalCache = nullptr;
+    Old.LocalCacheSize = 0;
+  }
+
+  ~PooledMallocAllocator();
+
+  PooledMallocAllocator &operator=(PooledMallocAllocator &&RHS);
+
+  void Reset() {}
+
+  LLVM_ATTRIBUTE_RETURNS_NONNULL void *Allocate(size_t Size,
+                                                size_t /*Alignment*/);
+
+  // Pull in base class overloads.
+  using AllocatorBase<PooledMallocAllocator>::Allocate;
+
+  void Deallocate(const void *Ptr, size_t Size);
+
+  // Pull in base class overloads.
+  using AllocatorBase<PooledMallocAllocator>::Deallocate;
+
+  /// \brief Return all slabs held by the process-wide pool to malloc.
+  ///
+  /// Slabs cached by live allocator instances are unaffected. This is mainly
+  /// useful to hand memory back to the OS after a phase of heavy arena churn
+  /// has finished.
+  static void ReleasePooledMemory();
+
+  /// \brief Print statistics about the process-wide pool to stderr.
+  void PrintStats() const;
+};
+
 namespace detail {
 
 // We call out to an external function to actually print the message as the
@@ -337,6 +400,7 @@ private:
   /// slab, modifying CurPtr and End.
   void StartNewSlab() {
     size_t AllocatedSlabSize = computeSlabSize(Slabs.size());
+    LLVM_RECORD_ALLOC_GROW(BumpPtrSlab, AllocatedSlabSize);
 
     void *NewSlab = Allocator.Allocate(AllocatedSlabSize, 0);
     // We own the new slab and don't want anyone reading anything other than
@@ -374,6 +438,10 @@ private:
 /// parameters.
 typedef BumpPtrAllocatorImpl<> BumpPtrAllocator;
 
+/// \brief A BumpPtrAllocator whose standard-size slabs are recycled through
+/// a process-wide pool rather than malloc.
+typedef BumpPtrAllocatorImpl<PooledMallocAllocator> PooledBumpPtrAllocator;
+
 /// \brief A BumpPtrAllocator that allows only elements of a specific type to be
 /// allocated.
 ///
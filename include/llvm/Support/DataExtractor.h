@@ -36,6 +36,16 @@ public:
   /// \brief Set the address size for this extractor.
   void setAddressSize(uint8_t Size) { AddressSize = Size; }
 
+  /// Hint that the bytes at [offset, offset+length) will be extracted soon.
+  ///
+  /// Parsers that know their next contribution ahead of time (e.g. the next
+  /// compile unit in a debug section) can declare it here; the range is
+  /// forwarded to the OS as an asynchronous readahead hint so that disk
+  /// latency overlaps with parsing when the underlying storage is a cold
+  /// memory-mapped file. The range is clamped to the data; the call never
+  /// blocks and is a no-op on systems without madvise.
+  void prefetch(uint32_t offset, uint32_t length) const;
+
   /// Extract a C string from \a *offset_ptr.
   ///
   /// Returns a pointer to a C String from the data at the offset
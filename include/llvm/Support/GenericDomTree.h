@@ -226,6 +226,28 @@ template <class NodeT> class DominatorTreeBase : public DominatorBase<NodeT> {
     return IDom != nullptr;
   }
 
+  /// \brief Try to assign DFS numbers to \p N, a freshly linked leaf under
+  /// \p IDomNode, without renumbering the rest of the tree.
+  ///
+  /// updateDFSNumbers() spaces consecutive numbers \c DFSGapSize apart, so
+  /// the parent's interval usually has unused numbers after the last child's
+  /// interval. Claiming two of them keeps the laminar interval invariant
+  /// (each interval nested in the parent's, disjoint from the siblings')
+  /// that DominatedBy() relies on. Returns false when the gap is exhausted,
+  /// in which case the caller must invalidate the DFS info.
+  bool tryInsertDFSNumbers(const DomTreeNodeBase<NodeT> *N,
+                           const DomTreeNodeBase<NodeT> *IDomNode) const {
+    int First = IDomNode->DFSNumIn;
+    for (const DomTreeNodeBase<NodeT> *Sibling : *IDomNode)
+      if (Sibling != N)
+        First = std::max(First, Sibling->DFSNumOut);
+    if (IDomNode->DFSNumOut - First <= 2)
+      return false;
+    N->DFSNumIn = First + 1;
+    N->DFSNumOut = First + 2;
+    return true;
+  }
+
   /// \brief Wipe this tree's state without releasing any resources.
   ///
   /// This is essentially a post-move helper only. It leaves the object in an
@@ -235,6 +257,7 @@ template <class NodeT> class DominatorTreeBase : public DominatorBase<NodeT> {
     IDoms.clear();
     Vertex.clear();
     Info.clear();
+    PendingUpdates.clear();
     RootNode = nullptr;
   }
 
@@ -246,6 +269,11 @@ protected:
 
   mutable bool DFSInfoValid = false;
   mutable unsigned int SlowQueries = 0;
+
+  // Stride between consecutive numbers assigned by updateDFSNumbers(). The
+  // unused numbers in between let tryInsertDFSNumbers() place new leaves
+  // without renumbering the whole tree.
+  static const int DFSGapSize = 8;
   // Information record used during immediate dominators computation.
   struct InfoRec {
     unsigned DFSNum = 0;
@@ -264,6 +292,17 @@ protected:
   // Info - Collection of information used during the computation of idoms.
   DenseMap<NodeT *, InfoRec> Info;
 
+  /// \brief A queued CFG edge edit. \see queueEdgeInsertion.
+  struct EdgeUpdate {
+    enum KindTy { Insert, Delete } Kind;
+    NodeT *From;
+    NodeT *To;
+  };
+
+  // Edge edits queued by queueEdgeInsertion/queueEdgeDeletion and retired by
+  // applyPendingUpdates.
+  SmallVector<EdgeUpdate, 8> PendingUpdates;
+
   void reset() {
     DomTreeNodes.clear();
     IDoms.clear();
@@ -272,6 +311,37 @@ protected:
     RootNode = nullptr;
     DFSInfoValid = false;
     SlowQueries = 0;
+    PendingUpdates.clear();
+  }
+
+  /// \brief Returns true if the queued update provably leaves this tree
+  /// unchanged, so that applyPendingUpdates can retire it in constant time.
+  bool isNoChangeUpdate(const EdgeUpdate &U) {
+    DomTreeNodeBase<NodeT> *FromNode = getNode(U.From);
+    DomTreeNodeBase<NodeT> *ToNode = getNode(U.To);
+    if (U.Kind == EdgeUpdate::Insert) {
+      // An edge out of an unreachable block adds no new path from the root,
+      // and a self loop changes nobody's dominators.
+      if (!FromNode || U.From == U.To)
+        return true;
+      // Making To newly reachable can cascade into its successors; let the
+      // caller recalculate.
+      if (!ToNode)
+        return false;
+      // An extra edge into the root changes nothing either.
+      DomTreeNodeBase<NodeT> *IDom = ToNode->getIDom();
+      if (!IDom)
+        return true;
+      // If To already dominates From this is a back edge, and every new path
+      // through it reaches To before From. Otherwise, if To's immediate
+      // dominator dominates From, every new path still runs through it. In
+      // both cases no immediate dominator moves.
+      NodeT *NCA = findNearestCommonDominator(U.From, U.To);
+      return NCA == U.To || NCA == IDom->getBlock();
+    }
+    // Deleting an edge with an unreachable endpoint removes no path from the
+    // root; deleting any other edge can move immediate dominators.
+    return !FromNode || !ToNode;
   }
 
   // NewBB is split and now it has one successor. Update dominator tree to
@@ -343,7 +413,8 @@ public:
         RootNode(std::move(Arg.RootNode)),
         DFSInfoValid(std::move(Arg.DFSInfoValid)),
         SlowQueries(std::move(Arg.SlowQueries)), IDoms(std::move(Arg.IDoms)),
-        Vertex(std::move(Arg.Vertex)), Info(std::move(Arg.Info)) {
+        Vertex(std::move(Arg.Vertex)), Info(std::move(Arg.Info)),
+        PendingUpdates(std::move(Arg.PendingUpdates)) {
     Arg.wipe();
   }
 
@@ -357,6 +428,7 @@ public:
     IDoms = std::move(RHS.IDoms);
     Vertex = std::move(RHS.Vertex);
     Info = std::move(RHS.Info);
+    PendingUpdates = std::move(RHS.PendingUpdates);
     RHS.wipe();
     return *this;
   }
@@ -586,9 +658,14 @@ public:
     assert(getNode(BB) == nullptr && "Block already in dominator tree!");
     DomTreeNodeBase<NodeT> *IDomNode = getNode(DomBB);
     assert(IDomNode && "Not immediate dominator specified for block!");
-    DFSInfoValid = false;
-    return (DomTreeNodes[BB] = IDomNode->addChild(
-                llvm::make_unique<DomTreeNodeBase<NodeT>>(BB, IDomNode))).get();
+    DomTreeNodeBase<NodeT> *NewNode =
+        (DomTreeNodes[BB] = IDomNode->addChild(
+             llvm::make_unique<DomTreeNodeBase<NodeT>>(BB, IDomNode))).get();
+    // The new node is a leaf: number it into the gap under its parent if one
+    // is left, so valid DFS numbers survive the insertion.
+    if (DFSInfoValid && !tryInsertDFSNumbers(NewNode, IDomNode))
+      DFSInfoValid = false;
+    return NewNode;
   }
 
   /// Add a new node to the forward dominator tree and make it a new root.
@@ -622,8 +699,13 @@ public:
   void changeImmediateDominator(DomTreeNodeBase<NodeT> *N,
                                 DomTreeNodeBase<NodeT> *NewIDom) {
     assert(N && NewIDom && "Cannot change null node pointers!");
-    DFSInfoValid = false;
     N->setIDom(NewIDom);
+    // A moved leaf can be renumbered into a gap under its new parent; moving
+    // an inner node would require renumbering its whole subtree, so give up
+    // on the DFS numbers in that case.
+    if (DFSInfoValid &&
+        (!N->getChildren().empty() || !tryInsertDFSNumbers(N, NewIDom)))
+      DFSInfoValid = false;
   }
 
   void changeImmediateDominator(NodeT *BB, NodeT *NewBB) {
@@ -661,6 +743,61 @@ public:
       Split<NodeT *>(NewBB);
   }
 
+  /// \brief Queue the insertion of the CFG edge (\p From, \p To).
+  ///
+  /// Call this after adding the edge to the CFG. The tree is not touched
+  /// until applyPendingUpdates() runs; dominance queries made in between see
+  /// the tree as it was before the queued edits.
+  void queueEdgeInsertion(NodeT *From, NodeT *To) {
+    PendingUpdates.push_back({EdgeUpdate::Insert, From, To});
+  }
+
+  /// \brief Queue the deletion of the CFG edge (\p From, \p To).
+  ///
+  /// Call this after removing the edge from the CFG. \see queueEdgeInsertion.
+  void queueEdgeDeletion(NodeT *From, NodeT *To) {
+    PendingUpdates.push_back({EdgeUpdate::Delete, From, To});
+  }
+
+  /// \brief Returns true if edge updates have been queued but not yet
+  /// applied. While this is true, dominance queries reflect the CFG as it was
+  /// before the queued edits.
+  bool hasPendingUpdates() const { return !PendingUpdates.empty(); }
+
+  /// \brief Apply all queued edge updates.
+  ///
+  /// Updates that provably leave the tree unchanged are retired in constant
+  /// time per edit: inserted back edges, inserted edges whose target's
+  /// immediate dominator already dominates the source, edges into the root,
+  /// self loops, and edits with an unreachable endpoint. The first update
+  /// that may actually move a node falls back to recalculation for the whole
+  /// batch, so a flush costs at most one tree construction no matter how many
+  /// edits it covers.
+  template <class FT> void applyPendingUpdates(FT &F) {
+    if (PendingUpdates.empty())
+      return;
+
+    // The no-change proofs below are phrased for forward dominance only.
+    if (!this->isPostDominator()) {
+      // Each retired update leaves the tree valid for the CFG with that edit
+      // applied, so later updates in the batch may be checked against the
+      // same tree.
+      bool AllTrivial = true;
+      for (const EdgeUpdate &U : PendingUpdates)
+        if (!isNoChangeUpdate(U)) {
+          AllTrivial = false;
+          break;
+        }
+      if (AllTrivial) {
+        PendingUpdates.clear();
+        return;
+      }
+    }
+
+    PendingUpdates.clear();
+    recalculate(F);
+  }
+
   /// print - Convert to human readable form
   ///
   void print(raw_ostream &o) const {
@@ -726,7 +863,10 @@ public:
       return;
     }
 
-    unsigned DFSNum = 0;
+    // Leave DFSGapSize unused numbers between consecutive assignments, so
+    // nodes inserted later can usually be numbered in place (see
+    // tryInsertDFSNumbers) instead of invalidating the numbering.
+    int DFSNum = 0;
 
     SmallVector<std::pair<const DomTreeNodeBase<NodeT> *,
                           typename DomTreeNodeBase<NodeT>::const_iterator>,
@@ -742,7 +882,8 @@ public:
     // node. Otherwise bbs, that are not post dominated by any exit but by the
     // virtual root node, will never be assigned a DFS number.
     WorkStack.push_back(std::make_pair(ThisRoot, ThisRoot->begin()));
-    ThisRoot->DFSNumIn = DFSNum++;
+    ThisRoot->DFSNumIn = DFSNum;
+    DFSNum += DFSGapSize;
 
     while (!WorkStack.empty()) {
       const DomTreeNodeBase<NodeT> *Node = WorkStack.back().first;
@@ -752,7 +893,8 @@ public:
       // If we visited all of the children of this node, "recurse" back up the
       // stack setting the DFOutNum.
       if (ChildIt == Node->end()) {
-        Node->DFSNumOut = DFSNum++;
+        Node->DFSNumOut = DFSNum;
+        DFSNum += DFSGapSize;
         WorkStack.pop_back();
       } else {
         // Otherwise, recursively visit this child.
@@ -760,7 +902,8 @@ public:
         ++WorkStack.back().second;
 
         WorkStack.push_back(std::make_pair(Child, Child->begin()));
-        Child->DFSNumIn = DFSNum++;
+        Child->DFSNumIn = DFSNum;
+        DFSNum += DFSGapSize;
       }
     }
 
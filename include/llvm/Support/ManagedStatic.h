@@ -87,6 +87,16 @@ public:
 /// llvm_shutdown - Deallocate and destroy all ManagedStatic variables.
 void llvm_shutdown();
 
+/// llvm_disable_shutdown - Make subsequent llvm_shutdown() calls no-ops.
+///
+/// Short-lived tools can spend a meaningful fraction of their runtime
+/// walking the ManagedStatic list and running destructors for memory the
+/// operating system is about to reclaim anyway. Calling this before exit
+/// skips that teardown. Do not use it from processes that outlive their
+/// use of LLVM or that need destructor side effects (e.g. flushing
+/// buffered output owned by a ManagedStatic).
+void llvm_disable_shutdown();
+
 /// llvm_shutdown_obj - This is a simple helper class that calls
 /// llvm_shutdown() when it is destroyed.
 struct llvm_shutdown_obj {
@@ -14,6 +14,7 @@
 #ifndef LLVM_SUPPORT_MEMORYBUFFER_H
 #define LLVM_SUPPORT_MEMORYBUFFER_H
 
+#include "llvm/ADT/SmallVector.h"
 #include "llvm/ADT/StringRef.h"
 #include "llvm/ADT/Twine.h"
 #include "llvm/Support/CBindingWrapping.h"
@@ -25,6 +26,7 @@
 
 namespace llvm {
 
+template <typename T> class ArrayRef;
 class MemoryBufferRef;
 
 /// This interface provides simple read-only access to a block of memory, and
@@ -41,6 +43,43 @@ class MemoryBuffer {
   const char *BufferStart; // Start of the buffer.
   const char *BufferEnd;   // End of the buffer.
 
+public:
+  /// Advisory description of how a file-backed buffer will be accessed.
+  ///
+  /// When the buffer ends up memory mapped, the hint is forwarded to the
+  /// kernel (madvise on POSIX systems), which mainly controls readahead
+  /// and, for AccessHint_Bulk, transparent huge page backing.  Hints are
+  /// best-effort: they never affect the contents of the buffer and are
+  /// silently ignored when unsupported or when the file is read rather
+  /// than mapped.
+  enum AccessHint {
+    /// No particular access pattern; kernel defaults apply.
+    AccessHint_None,
+    /// The buffer will be read once from front to back (e.g. streaming a
+    /// large assembly or bitcode file); asks for aggressive readahead and
+    /// early reclaim of already-consumed pages.
+    AccessHint_Sequential,
+    /// Most of the buffer will be touched soon, in no particular order;
+    /// asks the kernel to start faulting it in immediately.
+    AccessHint_WillNeed,
+    /// Like AccessHint_WillNeed, but additionally requests transparent
+    /// huge pages to cut TLB pressure on multi-gigabyte inputs.
+    AccessHint_Bulk
+  };
+
+  /// Hint that the given byte range will be read soon.
+  ///
+  /// Unlike the whole-buffer AccessHint, this is for consumers that discover
+  /// their upcoming accesses as they parse (e.g. the next compile unit's
+  /// contribution in a debug section) and want the kernel to start faulting
+  /// the range in while they work on the current one. The range is widened
+  /// to page boundaries and forwarded as an asynchronous readahead hint;
+  /// this never blocks, never fails visibly, and is a no-op on systems
+  /// without madvise.
+  static void prefetch(const void *Addr, size_t Size);
+
+private:
+
 
 protected:
   MemoryBuffer() = default;
@@ -72,9 +111,12 @@ public:
   /// \param IsVolatile Set to true to indicate that the contents of the file
   /// can change outside the user's control, e.g. when libclang tries to parse
   /// while the user is editing/updating the file or if the file is on an NFS.
+  ///
+  /// \param Hint Advisory access pattern for the buffer, see AccessHint.
   static ErrorOr<std::unique_ptr<MemoryBuffer>>
   getFile(const Twine &Filename, int64_t FileSize = -1,
-          bool RequiresNullTerminator = true, bool IsVolatile = false);
+          bool RequiresNullTerminator = true, bool IsVolatile = false,
+          AccessHint Hint = AccessHint_None);
 
   /// Read all of the specified file into a MemoryBuffer as a stream
   /// (i.e. until EOF reached). This is useful for special files that
@@ -87,7 +129,8 @@ public:
   /// Since this is in the middle of a file, the buffer is not null terminated.
   static ErrorOr<std::unique_ptr<MemoryBuffer>>
   getOpenFileSlice(int FD, const Twine &Filename, uint64_t MapSize,
-                   int64_t Offset, bool IsVolatile = false);
+                   int64_t Offset, bool IsVolatile = false,
+                   AccessHint Hint = AccessHint_None);
 
   /// Given an already-open file descriptor, read the file and return a
   /// MemoryBuffer.
@@ -95,9 +138,12 @@ public:
   /// \param IsVolatile Set to true to indicate that the contents of the file
   /// can change outside the user's control, e.g. when libclang tries to parse
   /// while the user is editing/updating the file or if the file is on an NFS.
+  ///
+  /// \param Hint Advisory access pattern for the buffer, see AccessHint.
   static ErrorOr<std::unique_ptr<MemoryBuffer>>
   getOpenFile(int FD, const Twine &Filename, uint64_t FileSize,
-              bool RequiresNullTerminator = true, bool IsVolatile = false);
+              bool RequiresNullTerminator = true, bool IsVolatile = false,
+              AccessHint Hint = AccessHint_None);
 
   /// Open the specified memory range as a MemoryBuffer. Note that InputData
   /// must be null terminated if RequiresNullTerminator is true.
@@ -138,6 +184,23 @@ public:
   static ErrorOr<std::unique_ptr<MemoryBuffer>>
   getFileSlice(const Twine &Filename, uint64_t MapSize, uint64_t Offset, bool IsVolatile = false);
 
+  /// Open all of the specified files as MemoryBuffers, reading them
+  /// concurrently on a thread pool.  The result vector parallels \p Paths:
+  /// element i holds the buffer (or the error) for Paths[i].  Failures are
+  /// per-file; one unreadable path does not affect the others.
+  ///
+  /// Tools that open many small files in a row (dsymutil, llvm-cov and the
+  /// like) serialize on per-file latency, which dominates on networked
+  /// filesystems; issuing the opens and reads in parallel overlaps those
+  /// round trips.
+  ///
+  /// \param NumThreads Number of reader threads; 0 means one per hardware
+  /// thread.
+  static void
+  getFiles(ArrayRef<std::string> Paths,
+           SmallVectorImpl<ErrorOr<std::unique_ptr<MemoryBuffer>>> &Buffers,
+           unsigned NumThreads = 0);
+
   //===--------------------------------------------------------------------===//
   // Provided for performance analysis.
   //===--------------------------------------------------------------------===//
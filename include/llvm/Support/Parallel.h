@@ -0,0 +1,96 @@
+//===- llvm/Support/Parallel.h - Parallel loop primitives -------*- C++ -*-===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+//
+// This file defines parallel loop primitives layered on top of ThreadPool.
+// They are intended for fork-join loops over independent elements: the call
+// blocks until every iteration has run, iterations may execute on any thread,
+// and a loop body that itself enters one of these primitives degrades to a
+// serial loop rather than deadlocking the pool.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_SUPPORT_PARALLEL_H
+#define LLVM_SUPPORT_PARALLEL_H
+
+#include "llvm/ADT/STLExtras.h"
+#include <cstddef>
+#include <iterator>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace llvm {
+namespace parallel {
+
+namespace detail {
+/// Run \p Fn(ChunkBegin, ChunkEnd) over consecutive chunks of [Begin, End)
+/// on the shared thread pool and block until all chunks have finished. Each
+/// chunk covers at least \p Grain indices. Runs \p Fn(Begin, End) directly on
+/// the calling thread when the range is no larger than the grain size, when
+/// threading is unavailable, or when the caller is itself executing inside a
+/// parallel loop.
+void parallelForImpl(size_t Begin, size_t End, size_t Grain,
+                     function_ref<void(size_t, size_t)> Fn);
+} // end namespace detail
+
+/// Call \p Fn(I) for each I in [Begin, End), potentially in parallel.
+///
+/// \p Fn must be safe to invoke concurrently from several threads. \p Grain
+/// bounds the scheduling overhead for cheap bodies: consecutive indices are
+/// handed to the pool in batches of at least \p Grain.
+template <class FuncTy>
+void parallel_for(size_t Begin, size_t End, FuncTy Fn, size_t Grain = 1) {
+  detail::parallelForImpl(Begin, End, Grain, [&Fn](size_t B, size_t E) {
+    for (size_t I = B; I != E; ++I)
+      Fn(I);
+  });
+}
+
+/// Call \p Fn(*I) for each element of the random access range [Begin, End),
+/// potentially in parallel.
+template <class IterTy, class FuncTy>
+void parallel_for_each(IterTy Begin, IterTy End, FuncTy Fn, size_t Grain = 1) {
+  detail::parallelForImpl(
+      0, static_cast<size_t>(std::distance(Begin, End)), Grain,
+      [&Begin, &Fn](size_t B, size_t E) {
+        for (size_t I = B; I != E; ++I)
+          Fn(*(Begin + I));
+      });
+}
+
+/// Map each element of the random access range [Begin, End) through
+/// \p Transform and combine the results with \p Reduce, potentially in
+/// parallel.
+///
+/// \p Reduce must be associative and \p Init must be its identity value, as
+/// \p Init seeds the accumulator of every chunk. The combination order is
+/// unspecified, so the result of a non-commutative \p Reduce may vary from
+/// run to run.
+template <class IterTy, class ResultTy, class ReduceTy, class TransformTy>
+ResultTy parallel_transform_reduce(IterTy Begin, IterTy End, ResultTy Init,
+                                   ReduceTy Reduce, TransformTy Transform,
+                                   size_t Grain = 1) {
+  ResultTy Result = Init;
+  std::mutex Mutex;
+  detail::parallelForImpl(
+      0, static_cast<size_t>(std::distance(Begin, End)), Grain,
+      [&](size_t B, size_t E) {
+        ResultTy Partial = Init;
+        for (size_t I = B; I != E; ++I)
+          Partial = Reduce(std::move(Partial), Transform(*(Begin + I)));
+        std::lock_guard<std::mutex> Lock(Mutex);
+        Result = Reduce(std::move(Result), std::move(Partial));
+      });
+  return Result;
+}
+
+} // end namespace parallel
+} // end namespace llvm
+
+#endif // LLVM_SUPPORT_PARALLEL_H
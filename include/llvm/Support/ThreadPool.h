@@ -20,11 +20,12 @@
 
 #include <atomic>
 #include <condition_variable>
+#include <deque>
 #include <functional>
 #include <memory>
 #include <mutex>
-#include <queue>
 #include <utility>
+#include <vector>
 
 namespace llvm {
 
@@ -33,6 +34,13 @@ namespace llvm {
 ///
 /// The pool keeps a vector of threads alive, waiting on a condition variable
 /// for some work to become available.
+///
+/// Tasks are distributed over per-worker deques rather than a single shared
+/// queue: submission round-robins over the deques, each worker services its
+/// own deque from the back, and an idle worker steals from the front of
+/// another worker's deque.  This keeps submission and dispatch off a single
+/// global mutex, which becomes the bottleneck on many-core machines running
+/// short tasks (e.g. ThinLTO backends).
 class ThreadPool {
 public:
 #ifndef _MSC_VER
@@ -95,13 +103,34 @@ private:
   /// used to wait for the task to finish and is *non-blocking* on destruction.
   std::shared_future<VoidTy> asyncImpl(TaskTy F);
 
+  /// A per-worker task deque.  The owning worker pushes and pops at the back;
+  /// idle workers steal from the front, so the oldest (and typically largest)
+  /// pending task migrates first.
+  struct TaskQueue {
+    std::mutex Lock;
+    std::deque<PackagedTaskTy> Tasks;
+  };
+
+  /// Try to pop a task from the back of worker \p QueueID's own deque.
+  bool popLocalTask(unsigned QueueID, PackagedTaskTy &Task);
+
+  /// Try to steal a task from the front of some other worker's deque.
+  bool stealTask(unsigned QueueID, PackagedTaskTy &Task);
+
   /// Threads in flight
   std::vector<llvm::thread> Threads;
 
-  /// Tasks waiting for execution in the pool.
-  std::queue<PackagedTaskTy> Tasks;
+  /// One task deque per worker, plus a deque for the sequential fallback when
+  /// threading is disabled.
+  std::vector<std::unique_ptr<TaskQueue>> Queues;
+
+  /// Round-robin cursor for spreading submissions over the deques.
+  std::atomic<unsigned> SubmissionCursor;
+
+  /// Number of tasks queued but not yet picked up by a worker.
+  std::atomic<unsigned> PendingTaskCount;
 
-  /// Locking and signaling for accessing the Tasks queue.
+  /// Locking and signaling for idle workers waiting for work.
   std::mutex QueueLock;
   std::condition_variable QueueCondition;
 
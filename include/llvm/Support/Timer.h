@@ -155,14 +155,26 @@ public:
 
 /// This class is basically a combination of TimeRegion and Timer.  It allows
 /// you to declare a new timer, AND specify the region to time, all in one
-/// statement.  All timers with the same name are merged.  This is primarily
-/// used for debugging and for hunting performance problems.
+/// statement.  All timers with the same name are merged.  Each thread gets a
+/// private timer instance, so regions may be timed concurrently; the
+/// per-thread instances are merged by name when the group is printed.  This
+/// is primarily used for debugging and for hunting performance problems.
 struct NamedRegionTimer : public TimeRegion {
   explicit NamedRegionTimer(StringRef Name, StringRef Description,
                             StringRef GroupName,
                             StringRef GroupDescription, bool Enabled = true);
 };
 
+/// Return true if -time-trace-json was given, i.e. every timer start/stop is
+/// being captured as a Chrome trace event for flame-graph tooling.
+bool timeTraceEnabled();
+
+/// Attach a transient note (typically the name of the IR unit being
+/// processed) to the trace events of timers stopped while the note is set.
+/// Pass an empty string to clear the note.  No-op unless -time-trace-json is
+/// active.
+void setTimeTraceDetail(StringRef Detail);
+
 /// The TimerGroup class is used to group together related timers into a single
 /// report that is printed when the TimerGroup is destroyed.  It is illegal to
 /// destroy a TimerGroup object before all of the Timers in it are gone.  A
@@ -219,6 +231,7 @@ private:
   friend void PrintStatisticsJSON(raw_ostream &OS);
   void addTimer(Timer &T);
   void removeTimer(Timer &T);
+  void mergePrintRecords();
   void prepareToPrintList();
   void PrintQueuedTimers(raw_ostream &OS);
   void printJSONValue(raw_ostream &OS, const PrintRecord &R,
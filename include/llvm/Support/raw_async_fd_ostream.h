@@ -0,0 +1,113 @@
+//===- raw_async_fd_ostream.h - Write-behind file stream --------*- C++ -*-===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+//
+// This file defines raw_async_fd_ostream, a raw_pwrite_stream that writes to
+// a file descriptor from a background thread so the producer does not stall
+// on disk latency.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_SUPPORT_RAW_ASYNC_FD_OSTREAM_H
+#define LLVM_SUPPORT_RAW_ASYNC_FD_OSTREAM_H
+
+#include "llvm/Support/raw_ostream.h"
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace llvm {
+
+/// A raw_ostream that writes to a file descriptor from a background thread.
+///
+/// When the stream buffer fills, the contents are handed to a worker thread
+/// and the producer continues immediately, overlapping serialization with
+/// I/O. Filled buffers are recycled through a small pool, so the stream
+/// settles into double buffering without repeated allocation. If the producer
+/// outruns the disk and the pool is exhausted, writes block until a buffer is
+/// returned.
+///
+/// pwrite() first waits for all queued writes to land, so patching a header
+/// after streaming the body works as it does with raw_fd_ostream, at the cost
+/// of a pipeline stall.
+///
+/// If LLVM was configured without threads, all writes are performed
+/// synchronously on the calling thread.
+class raw_async_fd_ostream : public raw_pwrite_stream {
+  /// The synchronous sink, kept unbuffered; only the worker thread (or the
+  /// producer, when threading is disabled) writes to it.
+  raw_fd_ostream FDS;
+
+  /// Bytes accepted by the stream, including bytes still queued.
+  uint64_t pos = 0;
+
+  std::thread Writer;
+  std::mutex Mutex;
+  /// Signalled when a buffer is queued or shutdown is requested.
+  std::condition_variable WorkAvailable;
+  /// Signalled when a write retires, freeing its buffer.
+  std::condition_variable WriteRetired;
+  std::deque<std::unique_ptr<std::vector<char>>> Queue;
+  std::vector<std::unique_ptr<std::vector<char>>> FreeBuffers;
+  /// Buffers handed out so far; bounded by MaxBuffers.
+  unsigned NumBuffers = 0;
+  /// Queued buffers plus the one the worker is currently writing.
+  unsigned PendingWrites = 0;
+  bool ShuttingDown = false;
+
+  /// See raw_ostream::write_impl.
+  void write_impl(const char *Ptr, size_t Size) override;
+
+  void pwrite_impl(const char *Ptr, size_t Size, uint64_t Offset) override;
+
+  uint64_t current_pos() const override { return pos; }
+
+  /// Use a buffer large enough to amortize the thread hand-off.
+  size_t preferred_buffer_size() const override;
+
+  void writerLoop();
+
+  /// Block until every queued buffer has been written to the descriptor.
+  void drain();
+
+  /// Drain the queue and join the worker thread.
+  void shutdownWriter();
+
+public:
+  /// Open the specified file for writing. If an error occurs, information
+  /// about the error is put into EC, and the stream should be immediately
+  /// destroyed; \p Flags allows optional flags to control how the file will
+  /// be opened.
+  raw_async_fd_ostream(StringRef Filename, std::error_code &EC,
+                       sys::fs::OpenFlags Flags);
+
+  /// FD is the file descriptor that this writes to. If ShouldClose is true,
+  /// this closes the file when the stream is destroyed.
+  raw_async_fd_ostream(int fd, bool shouldClose);
+
+  ~raw_async_fd_ostream() override;
+
+  /// Flush the stream, wait for all outstanding writes, and close the file.
+  void close();
+
+  /// Return true if an output error has been encountered. Errors detected on
+  /// the worker thread become visible here no later than the next drain
+  /// (pwrite, close or destruction).
+  bool has_error() const { return FDS.has_error(); }
+
+  /// Set the flag read by has_error() to false. See
+  /// raw_fd_ostream::clear_error.
+  void clear_error() { FDS.clear_error(); }
+};
+
+} // end namespace llvm
+
+#endif // LLVM_SUPPORT_RAW_ASYNC_FD_OSTREAM_H
@@ -12,6 +12,7 @@
 
 #include "llvm/ADT/DenseMap.h"
 #include "llvm/ADT/STLExtras.h"
+#include "llvm/ADT/SmallPtrSet.h"
 #include "llvm/ADT/SmallVector.h"
 #include "llvm/IR/Instruction.h"
 #include "llvm/Support/Compiler.h"
@@ -28,6 +29,13 @@ class InstCombineWorklist {
   SmallVector<Instruction*, 256> Worklist;
   DenseMap<Instruction*, unsigned> WorklistMap;
 
+  /// Instructions the visitors have already tested without finding a combine.
+  /// The memo survives the bulk repopulation between fixpoint iterations and
+  /// is only dropped when an instruction is re-added through Add(), i.e. when
+  /// it or something near it changed, so later iterations don't re-test
+  /// unchanged instructions against the full pattern set.
+  SmallPtrSet<Instruction*, 32> NoChangeMemo;
+
 public:
   InstCombineWorklist() = default;
 
@@ -39,6 +47,9 @@ public:
   /// Add - Add the specified instruction to the worklist if it isn't already
   /// in it.
   void Add(Instruction *I) {
+    // Adds outside the initial population signal that I or its neighborhood
+    // changed, so it has to be re-tested.
+    NoChangeMemo.erase(I);
     if (WorklistMap.insert(std::make_pair(I, Worklist.size())).second) {
       DEBUG(dbgs() << "IC: ADD: " << *I << '\n');
       Worklist.push_back(I);
@@ -67,6 +78,9 @@ public:
 
   // Remove - remove I from the worklist if it exists.
   void Remove(Instruction *I) {
+    // Called on the way to erasing I from the function; drop the memo so a
+    // later instruction allocated at the same address doesn't inherit it.
+    NoChangeMemo.erase(I);
     DenseMap<Instruction*, unsigned>::iterator It = WorklistMap.find(I);
     if (It == WorklistMap.end()) return; // Not in worklist.
 
@@ -92,6 +106,33 @@ public:
   }
 
 
+  /// ResetNoChangeMemo - Drop the whole no-change memo. The worklist object
+  /// outlives a single function's combine run, and the memo is keyed on
+  /// instruction addresses, so it must not leak into the next function.
+  void ResetNoChangeMemo() {
+    NoChangeMemo.clear();
+  }
+
+  /// InvalidateNoChange - Forget the no-change memo for I because it is
+  /// about to change without going through Add(), e.g. during the function
+  /// scan that repopulates the worklist between iterations.
+  void InvalidateNoChange(Instruction *I) {
+    NoChangeMemo.erase(I);
+  }
+
+  /// MarkNoChange - Record that the visitors found no combine for I. The
+  /// memo holds until I is added to the worklist again or removed from the
+  /// function.
+  void MarkNoChange(Instruction *I) {
+    NoChangeMemo.insert(I);
+  }
+
+  /// IsKnownNoChange - Whether I is known not to combine since the last time
+  /// it (or a neighbor that re-added it) changed.
+  bool IsKnownNoChange(Instruction *I) const {
+    return NoChangeMemo.count(I);
+  }
+
   /// Zap - check that the worklist is empty and nuke the backing store for
   /// the map if it is large.
   void Zap() {
@@ -125,6 +125,23 @@ private:
   DenseMap<uint32_t, LeaderTableEntry> LeaderTable;
   BumpPtrAllocator TableAllocator;
 
+  /// In scalability mode, the leader for each (value number, block) pair is
+  /// additionally cached here so findLeader can probe the dominators of the
+  /// query block directly instead of scanning the whole leader chain. Kept in
+  /// sync by addToLeaderTable and removeFromLeaderTable.
+  DenseMap<std::pair<uint32_t, const BasicBlock *>, Value *> BlockLeaders;
+
+  /// Blocks changed during the current iteration; in scalability mode the
+  /// next iteration only revisits their dominator subtrees.
+  SetVector<BasicBlock *> ChangedBlocks;
+
+  /// Set from the -gvn-scalability flag for the duration of runImpl.
+  bool ScalabilityMode = false;
+
+  /// True while running a repeat iteration that should only reprocess the
+  /// dominator subtrees of ChangedBlocks.
+  bool RestrictToChangedBlocks = false;
+
   // Block-local map of equivalent values to their leader, does not
   // propagate to any successors. Entries added mid-block are applied
   // to the remaining instructions in the block.
@@ -142,6 +159,9 @@ private:
 
   /// Push a new Value to the LeaderTable onto the list for its value number.
   void addToLeaderTable(uint32_t N, Value *V, const BasicBlock *BB) {
+    if (ScalabilityMode)
+      updateBlockLeader(N, V, BB);
+
     LeaderTableEntry &Curr = LeaderTable[N];
     if (!Curr.Val) {
       Curr.Val = V;
@@ -156,6 +176,14 @@ private:
     Curr.Next = Node;
   }
 
+  /// Keep the per-block leader cache in sync with the leader chain for value
+  /// number \p N. Constants are preferred, as they are in findLeader.
+  void updateBlockLeader(uint32_t N, Value *V, const BasicBlock *BB) {
+    Value *&Leader = BlockLeaders[std::make_pair(N, BB)];
+    if (!Leader || (isa<Constant>(V) && !isa<Constant>(Leader)))
+      Leader = V;
+  }
+
   /// Scan the list of values corresponding to a given
   /// value number, and remove the given instruction if encountered.
   void removeFromLeaderTable(uint32_t N, Instruction *I, BasicBlock *BB) {
@@ -183,6 +211,15 @@ private:
         Curr->Next = Next->Next;
       }
     }
+
+    if (ScalabilityMode) {
+      // Rebuild the cached leader for this block from the surviving chain
+      // entries.
+      BlockLeaders.erase(std::make_pair(N, (const BasicBlock *)BB));
+      for (LeaderTableEntry *E = &LeaderTable[N]; E; E = E->Next)
+        if (E->Val && E->BB == BB)
+          updateBlockLeader(N, E->Val, BB);
+    }
   }
 
   // List of critical edges to be split between iterations.
@@ -209,6 +246,7 @@ private:
   // Other helper routines
   bool processInstruction(Instruction *I);
   bool processBlock(BasicBlock *BB);
+  void renumberBlock(BasicBlock *BB);
   void dump(DenseMap<uint32_t, Value *> &d);
   bool iterateOnFunction(Function &F);
   bool performPRE(Function &F);
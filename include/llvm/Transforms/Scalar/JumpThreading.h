@@ -73,6 +73,12 @@ class JumpThreadingPass : public PassInfoMixin<JumpThreadingPass> {
 #endif
   DenseSet<std::pair<Value *, BasicBlock *>> RecursionSet;
 
+  /// Memoized duplication costs for blocks whose terminator is the StopAt
+  /// point. Each entry carries the instruction count it was computed at, so a
+  /// lookup against a block that has since changed recomputes instead of
+  /// returning a stale cost.
+  DenseMap<const BasicBlock *, std::pair<unsigned, unsigned>> DupCostCache;
+
   unsigned BBDupThreshold;
 
   // RAII helper for updating the recursion stack.
@@ -104,6 +110,7 @@ public:
   }
 
   void FindLoopHeaders(Function &F);
+  unsigned getCachedDuplicationCost(BasicBlock *BB);
   bool ProcessBlock(BasicBlock *BB);
   bool ThreadEdge(BasicBlock *BB, const SmallVectorImpl<BasicBlock *> &PredBBs,
                   BasicBlock *SuccBB);
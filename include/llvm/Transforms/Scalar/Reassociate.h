@@ -23,7 +23,7 @@
 #ifndef LLVM_TRANSFORMS_SCALAR_REASSOCIATE_H
 #define LLVM_TRANSFORMS_SCALAR_REASSOCIATE_H
 
-#include "llvm/ADT/PostOrderIterator.h"
+#include "llvm/ADT/ArrayRef.h"
 #include "llvm/ADT/SetVector.h"
 #include "llvm/IR/IRBuilder.h"
 #include "llvm/IR/Operator.h"
@@ -64,8 +64,13 @@ class ReassociatePass : public PassInfoMixin<ReassociatePass> {
 public:
   PreservedAnalyses run(Function &F, FunctionAnalysisManager &);
 
+  /// Run over the blocks of \p F in the given reverse post-order, which must
+  /// cover exactly the reachable blocks. Exposed for the legacy pass, which
+  /// gets the order from CFGTraversalWrapperPass.
+  PreservedAnalyses runImpl(Function &F, ArrayRef<BasicBlock *> RPO);
+
 private:
-  void BuildRankMap(Function &F, ReversePostOrderTraversal<Function *> &RPOT);
+  void BuildRankMap(Function &F, ArrayRef<BasicBlock *> RPO);
   unsigned getRank(Value *V);
   void canonicalizeOperands(Instruction *I);
   void ReassociateExpression(BinaryOperator *I);
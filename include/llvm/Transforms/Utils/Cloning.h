@@ -126,6 +126,46 @@ BasicBlock *CloneBasicBlock(const BasicBlock *BB, ValueToValueMapTy &VMap,
 Function *CloneFunction(Function *F, ValueToValueMapTy &VMap,
                         ClonedCodeInfo *CodeInfo = nullptr);
 
+/// A precomputed recipe for cloning one function many times into its own
+/// module.
+///
+/// CloneFunction rebuilds everything from scratch on every call: each cloned
+/// instruction has all of its operands pushed through the value mapper, even
+/// though for a same-module clone only operands referring to values local to
+/// the source function ever change. A FunctionCloneTemplate walks the source
+/// once and records exactly which operand slots need rewriting; cloneFunction
+/// then stamps out a copy and patches only those slots. Instructions whose
+/// operands the patch list cannot describe (blockaddresses, locals wrapped in
+/// metadata, and phis, which also remap their incoming blocks) fall back to
+/// the value mapper.
+///
+/// The template is invalidated by any change to the source function. It only
+/// produces clones in the source's module with no module-level changes; use
+/// CloneFunction for anything more exotic.
+class FunctionCloneTemplate {
+public:
+  explicit FunctionCloneTemplate(Function &F);
+
+  Function &getFunction() const { return F; }
+
+  /// Return a clone of the source function, added to its module. The VMap is
+  /// filled with mappings from all of the source's arguments, blocks and
+  /// instructions to their new values, as with CloneFunction.
+  Function *cloneFunction(ValueToValueMapTy &VMap,
+                          const Twine &NameSuffix = "") const;
+
+private:
+  Function &F;
+
+  /// Operand slots that refer to function-local values, as (instruction
+  /// index, operand index) pairs over the instructions of F in layout order.
+  std::vector<std::pair<unsigned, unsigned>> PatchPoints;
+
+  /// Indices of instructions that are remapped through the value mapper
+  /// instead of patched in place, in layout order.
+  std::vector<unsigned> FullRemapInsts;
+};
+
 /// Clone OldFunc into NewFunc, transforming the old arguments into references
 /// to VMap values.  Note that if NewFunc already has basic blocks, the ones
 /// cloned into it will be added to the end of the function.  This function
@@ -0,0 +1,121 @@
+//===- IRTransaction.h - Speculative IR mutation with rollback --*- C++ -*-===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+//
+// This file defines IRTransaction, a journal of instruction-level IR
+// mutations that can be undone in bulk. Speculative transforms ("try it,
+// measure, maybe revert") traditionally keep a clone of the whole function
+// around as the undo mechanism; recording just the touched instructions makes
+// the revert cost proportional to the size of the change instead.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_TRANSFORMS_UTILS_IRTRANSACTION_H
+#define LLVM_TRANSFORMS_UTILS_IRTRANSACTION_H
+
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/SmallVector.h"
+#include "llvm/IR/ValueHandle.h"
+
+namespace llvm {
+
+class BasicBlock;
+class Instruction;
+class Value;
+
+/// Journal of instruction creations, deletions and operand rewrites that can
+/// be committed or rolled back as a unit.
+///
+/// The transaction only knows what it is told: a transform must report every
+/// instruction it creates (\c createdInstruction), route deletions through
+/// \c deleteInstruction instead of erasing directly, and announce an
+/// instruction whose operands it is about to rewrite (\c aboutToChange, or
+/// the \c replaceAllUsesWith convenience wrapper which announces all users).
+/// Unreported mutations cannot be undone. On \c rollback, created
+/// instructions are erased, deleted instructions are spliced back into their
+/// original positions, and rewritten operands are restored through the
+/// use-list machinery; \c commit discards the journal and finally frees the
+/// deleted instructions.
+///
+/// Limitations, by design: the journal works at instruction granularity, so
+/// mutations that change an instruction's operand count (PHINode::addIncoming,
+/// adding switch cases) are not restorable in place -- delete the old
+/// instruction through the transaction and create a replacement instead.
+/// Creation or removal of basic blocks is out of scope; speculative
+/// transforms that restructure the CFG should record the terminator rewrites
+/// and leave unreachable blocks in place until after commit.
+class IRTransaction {
+public:
+  IRTransaction() = default;
+  IRTransaction(const IRTransaction &) = delete;
+  IRTransaction &operator=(const IRTransaction &) = delete;
+
+  /// An open transaction is rolled back on destruction, so the journal can
+  /// be used RAII-style with commit() as the explicit success path.
+  ~IRTransaction();
+
+  /// Record that \p I was created by the transaction. On rollback it is
+  /// erased again.
+  void createdInstruction(Instruction *I);
+
+  /// Snapshot \p I's operands before the transaction rewrites them. Only the
+  /// first call for a given instruction takes a snapshot, so it is safe to
+  /// call defensively before every rewrite.
+  void aboutToChange(Instruction *I);
+
+  /// Remove \p I from its basic block on behalf of the transaction. The
+  /// instruction is kept alive (with its operands intact) so rollback can
+  /// splice it back; commit frees it. \p I must have no remaining uses --
+  /// replace them first, e.g. via replaceAllUsesWith.
+  void deleteInstruction(Instruction *I);
+
+  /// Replace all uses of \p From with \p To, snapshotting every instruction
+  /// whose operands the replacement rewrites so rollback restores them.
+  void replaceAllUsesWith(Value *From, Value *To);
+
+  /// Accept all recorded mutations and free the instructions deleted during
+  /// the transaction. The journal is empty afterwards and may be reused.
+  void commit();
+
+  /// Undo all recorded mutations in reverse order. The journal is empty
+  /// afterwards and may be reused.
+  void rollback();
+
+  /// Return true if any mutation has been recorded since the last commit or
+  /// rollback.
+  bool isOpen() const {
+    return !Created.empty() || !Deleted.empty() || !OperandSnapshots.empty();
+  }
+
+private:
+  /// A parked deleted instruction together with its original position,
+  /// expressed as the instruction it immediately preceded (null when it was
+  /// the last one in the block). The successor is tracked with a WeakVH
+  /// because it may itself be deleted and re-inserted by the transaction.
+  struct DeletedInstInfo {
+    Instruction *I;
+    BasicBlock *BB;
+    WeakVH NextInst;
+  };
+
+  /// Instructions created during the transaction, in creation order.
+  SmallVector<Instruction *, 16> Created;
+
+  /// Instructions deleted during the transaction, in deletion order.
+  SmallVector<DeletedInstInfo, 8> Deleted;
+
+  /// Pre-transaction operand lists of rewritten instructions. Operands are
+  /// held as raw pointers: values deleted through the transaction stay alive
+  /// until commit, and deleting a referenced value behind the transaction's
+  /// back is a usage error.
+  DenseMap<Instruction *, SmallVector<Value *, 4>> OperandSnapshots;
+};
+
+} // end namespace llvm
+
+#endif // LLVM_TRANSFORMS_UTILS_IRTRANSACTION_H
@@ -16,6 +16,7 @@
 #include <cstdint>
 #include <vector>
 
+#include "llvm/ADT/STLExtras.h"
 #include "llvm/ADT/StringRef.h"
 #include "llvm/Support/Error.h"
 #include "llvm/Support/FileSystem.h"
@@ -65,6 +66,21 @@ public:
 /// |Filename|.
 Expected<Trace> loadTraceFile(StringRef Filename, bool Sort = false);
 
+/// Visit the records in the XRay log in |Filename| in file order without
+/// materializing the whole trace, for tools that aggregate incrementally and
+/// must handle traces larger than memory. |HeaderVisitor| is invoked exactly
+/// once, before any record is visited; |RecordVisitor| is then invoked on
+/// each record as it is decoded. Returning an error from either visitor
+/// stops the traversal and returns that error.
+///
+/// Note that the records are visited in the order they appear in the log,
+/// which for FDR logs groups records by thread buffer rather than sorting
+/// them by TSC, and that YAML logs are parsed as a whole document first, so
+/// only the binary formats are visited in constant memory.
+Error visitTraceFile(StringRef Filename,
+                     function_ref<Error(const XRayFileHeader &)> HeaderVisitor,
+                     function_ref<Error(const XRayRecord &)> RecordVisitor);
+
 } // namespace xray
 } // namespace llvm
 
@@ -45,6 +45,7 @@
 #include "llvm/IR/IntrinsicInst.h"
 #include "llvm/IR/LLVMContext.h"
 #include "llvm/IR/Type.h"
+#include "llvm/IR/ValueHandle.h"
 #include "llvm/Pass.h"
 using namespace llvm;
 
@@ -53,8 +54,71 @@ using namespace llvm;
 static cl::opt<bool> DisableBasicAA("disable-basicaa", cl::Hidden,
                                     cl::init(false));
 
+/// Cache the result of every alias query in the AAResults aggregation for as
+/// long as the aggregation itself is preserved, so that later passes in the
+/// pipeline which re-ask the same pointer pairs (GVN, LICM, DSE, MemCpyOpt)
+/// hit the cache instead of re-walking GEP chains in BasicAA. The cache is
+/// flushed whenever any cached pointer is deleted or replaced. Note that a
+/// transform which mutates an instruction's operands in place can change
+/// alias results without triggering either event, so this stays off by
+/// default.
+static cl::opt<bool> EnableAAQueryCache(
+    "aa-persistent-query-cache", cl::Hidden, cl::init(false),
+    cl::desc("Cache alias query results across passes, flushing the cache "
+             "whenever a cached pointer is deleted or replaced"));
+
+struct AAResults::AliasQueryCache {
+  /// Cached results, keyed on location pairs canonicalized by pointer
+  /// identity (alias queries are symmetric).
+  DenseMap<std::pair<MemoryLocation, MemoryLocation>, AliasResult> Results;
+
+  /// A value handle that schedules a full flush of the cache when the value
+  /// it watches is deleted or replaced. We cannot cheaply tell which cached
+  /// decompositions a mutated value feeds into, so per-entry invalidation
+  /// would be unsound; discarding everything is the only safe granularity.
+  struct FlushingVH final : CallbackVH {
+    AliasQueryCache *Cache;
+
+    FlushingVH(Value *V, AliasQueryCache *C) : CallbackVH(V), Cache(C) {}
+
+    void deleted() override {
+      Cache->Dirty = true;
+      CallbackVH::deleted();
+    }
+    void allUsesReplacedWith(Value *) override { Cache->Dirty = true; }
+  };
+
+  /// One handle per distinct pointer appearing in Results.
+  std::vector<FlushingVH> Handles;
+  SmallPtrSet<const Value *, 32> Watched;
+
+  /// Set by the handles above; the flush itself is deferred to the next
+  /// lookup so that we never destroy value handles from inside a handle
+  /// callback.
+  bool Dirty = false;
+
+  void flushIfDirty() {
+    if (!Dirty)
+      return;
+    Results.clear();
+    Handles.clear();
+    Watched.clear();
+    Dirty = false;
+  }
+
+  void watch(const Value *V) {
+    if (Watched.insert(V).second)
+      Handles.emplace_back(const_cast<Value *>(V), this);
+  }
+};
+
+// Out of line so that AliasQueryCache can stay an incomplete type in the
+// header.
+AAResults::AAResults(const TargetLibraryInfo &TLI) : TLI(TLI) {}
+
 AAResults::AAResults(AAResults &&Arg)
-    : TLI(Arg.TLI), AAs(std::move(Arg.AAs)), AADeps(std::move(Arg.AADeps)) {
+    : TLI(Arg.TLI), AAs(std::move(Arg.AAs)), AADeps(std::move(Arg.AADeps)),
+      QueryCache(std::move(Arg.QueryCache)) {
   for (auto &AA : AAs)
     AA->setAAResults(this);
 }
@@ -92,12 +156,33 @@ bool AAResults::invalidate(Function &F, const PreservedAnalyses &PA,
 
 AliasResult AAResults::alias(const MemoryLocation &LocA,
                              const MemoryLocation &LocB) {
+  AliasQueryCache *Cache = nullptr;
+  std::pair<MemoryLocation, MemoryLocation> CacheKey(LocA, LocB);
+  if (EnableAAQueryCache) {
+    if (!QueryCache)
+      QueryCache.reset(new AliasQueryCache());
+    Cache = QueryCache.get();
+    Cache->flushIfDirty();
+    if (LocB.Ptr < LocA.Ptr)
+      std::swap(CacheKey.first, CacheKey.second);
+    auto It = Cache->Results.find(CacheKey);
+    if (It != Cache->Results.end())
+      return It->second;
+  }
+
+  AliasResult Result = MayAlias;
   for (const auto &AA : AAs) {
-    auto Result = AA->alias(LocA, LocB);
+    Result = AA->alias(LocA, LocB);
     if (Result != MayAlias)
-      return Result;
+      break;
   }
-  return MayAlias;
+
+  if (Cache) {
+    Cache->Results[CacheKey] = Result;
+    Cache->watch(LocA.Ptr);
+    Cache->watch(LocB.Ptr);
+  }
+  return Result;
 }
 
 bool AAResults::pointsToConstantMemory(const MemoryLocation &Loc,
@@ -0,0 +1,85 @@
+//===- CFGTraversal.cpp - Cached CFG traversal orders ---------------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+//
+// This file implements the cached reverse post-order traversal analysis.
+//
+//===----------------------------------------------------------------------===//
+
+#include "llvm/Analysis/CFGTraversal.h"
+#include "llvm/ADT/PostOrderIterator.h"
+#include "llvm/IR/CFG.h"
+#include "llvm/IR/Function.h"
+#include "llvm/IR/PassManager.h"
+#include "llvm/Support/raw_ostream.h"
+using namespace llvm;
+
+#define DEBUG_TYPE "cfg-traversal"
+
+char CFGTraversalWrapperPass::ID = 0;
+INITIALIZE_PASS(CFGTraversalWrapperPass, "cfg-traversal",
+                "CFG Traversal Order Construction", true, true)
+
+void CFGTraversal::recalculate(Function &F) {
+  RPO.clear();
+  RPONumbers.clear();
+
+  ReversePostOrderTraversal<Function *> RPOT(&F);
+  for (BasicBlock *BB : RPOT)
+    RPO.push_back(BB);
+
+  RPONumbers.reserve(RPO.size());
+  for (unsigned i = 0, e = RPO.size(); i != e; ++i)
+    RPONumbers[RPO[i]] = i;
+}
+
+void CFGTraversal::print(raw_ostream &OS) const {
+  OS << "Reverse post-order of " << RPO.size() << " reachable blocks:\n";
+  for (const BasicBlock *BB : RPO) {
+    OS << "  ";
+    BB->printAsOperand(OS, false);
+    OS << "\n";
+  }
+}
+
+bool CFGTraversal::invalidate(Function &F, const PreservedAnalyses &PA,
+                              FunctionAnalysisManager::Invalidator &) {
+  // Check whether the analysis, all analyses on functions, or the function's
+  // CFG have been preserved.
+  auto PAC = PA.getChecker<CFGTraversalAnalysis>();
+  return !(PAC.preserved() || PAC.preservedSet<AllAnalysesOn<Function>>() ||
+           PAC.preservedSet<CFGAnalyses>());
+}
+
+bool CFGTraversalWrapperPass::runOnFunction(Function &F) {
+  CT.recalculate(F);
+  return false;
+}
+
+void CFGTraversalWrapperPass::print(raw_ostream &OS, const Module *) const {
+  CT.print(OS);
+}
+
+AnalysisKey CFGTraversalAnalysis::Key;
+
+CFGTraversal CFGTraversalAnalysis::run(Function &F,
+                                       FunctionAnalysisManager &) {
+  CFGTraversal CT;
+  CT.recalculate(F);
+  return CT;
+}
+
+CFGTraversalPrinterPass::CFGTraversalPrinterPass(raw_ostream &OS) : OS(OS) {}
+
+PreservedAnalyses CFGTraversalPrinterPass::run(Function &F,
+                                               FunctionAnalysisManager &AM) {
+  OS << "CFGTraversal for function: " << F.getName() << "\n";
+  AM.getResult<CFGTraversalAnalysis>(F).print(OS);
+
+  return PreservedAnalyses::all();
+}
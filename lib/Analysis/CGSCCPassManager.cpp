@@ -327,6 +327,10 @@ LazyCallGraph::SCC &llvm::updateCGAndAnalysisManagerForFunctionPass(
   for (Edge &E : *N)
     if (!RetainedEdges.count(&E.getNode()))
       DeadTargets.push_back({&E.getNode(), E.getKind()});
+  // Dead ref edges within this RefSCC are collected and removed in a batch
+  // below so that we only re-form the RefSCC structure once rather than once
+  // per removed edge.
+  SmallVector<Node *, 4> DeadInternalRefTargets;
   for (auto DeadTarget : DeadTargets) {
     Node &TargetN = *DeadTarget.getPointer();
     bool IsCall = DeadTarget.getInt() == Edge::Call;
@@ -363,7 +367,13 @@ LazyCallGraph::SCC &llvm::updateCGAndAnalysisManagerForFunctionPass(
       }
     }
 
-    auto NewRefSCCs = RC->removeInternalRefEdge(N, TargetN);
+    // Defer the actual ref edge removal so that we can batch all of the
+    // removals originating from N into a single connectivity recomputation.
+    DeadInternalRefTargets.push_back(&TargetN);
+  }
+
+  if (!DeadInternalRefTargets.empty()) {
+    auto NewRefSCCs = RC->removeInternalRefEdges(N, DeadInternalRefTargets);
     if (!NewRefSCCs.empty()) {
       // Note that we don't bother to invalidate analyses as ref-edge
       // connectivity is not really observable in any way and is intended
@@ -371,8 +381,8 @@ LazyCallGraph::SCC &llvm::updateCGAndAnalysisManagerForFunctionPass(
       // analysis conclusions.
 
       // The RC worklist is in reverse postorder, so we first enqueue the
-      // current RefSCC as it will remain the parent of all split RefSCCs, then
-      // we enqueue the new ones in RPO except for the one which contains the
+      // current RefSCC as no RefSCC split out of it can reference it, then we
+      // enqueue the new ones in RPO except for the one which contains the
       // source node as that is the "bottom" we will continue processing in the
       // bottom-up walk.
       UR.RCWorklist.insert(RC);
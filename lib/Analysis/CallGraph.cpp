@@ -8,11 +8,17 @@
 //===----------------------------------------------------------------------===//
 
 #include "llvm/Analysis/CallGraph.h"
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/SmallString.h"
 #include "llvm/IR/CallSite.h"
 #include "llvm/IR/Instructions.h"
 #include "llvm/IR/IntrinsicInst.h"
 #include "llvm/IR/Module.h"
 #include "llvm/Support/Debug.h"
+#include "llvm/Support/FileSystem.h"
+#include "llvm/Support/LineIterator.h"
+#include "llvm/Support/MD5.h"
+#include "llvm/Support/MemoryBuffer.h"
 #include "llvm/Support/raw_ostream.h"
 using namespace llvm;
 
@@ -20,9 +26,14 @@ using namespace llvm;
 // Implementations of the CallGraph class methods.
 //
 
-CallGraph::CallGraph(Module &M)
+CallGraph::CallGraph(Module &M) : CallGraph(M, /*BuildFromModule=*/true) {}
+
+CallGraph::CallGraph(Module &M, bool BuildFromModule)
     : M(M), Root(nullptr), ExternalCallingNode(getOrInsertFunction(nullptr)),
       CallsExternalNode(llvm::make_unique<CallGraphNode>(nullptr)) {
+  if (!BuildFromModule)
+    return;
+
   // Add every function to the call graph.
   for (Function &F : M)
     addToCallGraph(&F);
@@ -56,7 +67,11 @@ CallGraph::~CallGraph() {
 
 void CallGraph::addToCallGraph(Function *F) {
   CallGraphNode *Node = getOrInsertFunction(F);
+  addStructuralEdges(F, Node);
+  scanFunctionBody(F, Node);
+}
 
+void CallGraph::addStructuralEdges(Function *F, CallGraphNode *Node) {
   // If this function has external linkage, anything could call it.
   if (!F->hasLocalLinkage()) {
     ExternalCallingNode->addCalledFunction(CallSite(), Node);
@@ -78,7 +93,9 @@ void CallGraph::addToCallGraph(Function *F) {
   // anything.
   if (F->isDeclaration() && !F->isIntrinsic())
     Node->addCalledFunction(CallSite(), CallsExternalNode.get());
+}
 
+void CallGraph::scanFunctionBody(Function *F, CallGraphNode *Node) {
   // Look for calls by this function.
   for (BasicBlock &BB : *F)
     for (Instruction &I : BB) {
@@ -173,6 +190,215 @@ CallGraphNode *CallGraph::getOrInsertFunction(const Function *F) {
   return CGN.get();
 }
 
+//===----------------------------------------------------------------------===//
+// Call graph cache.
+//
+// The cache is a line-oriented sidecar file. The first line holds a magic
+// string and the number of functions it was written for; every following line
+// describes one function, in module order:
+//
+//   <name-hash> <calls-hash> <num-edges> <edge>...
+//
+// where each edge is either the position of the callee in the module's
+// function list or 'x' for an edge to the calls-external node. Encoding
+// callees by position keeps the file free of symbol names (which may contain
+// arbitrary bytes); in exchange, any rename, insertion or removal changes a
+// name hash and invalidates the whole cache. The calls hash covers only the
+// callees at the function's call sites, since nothing else in a body affects
+// its edges, so verifying it on load is a plain instruction walk without the
+// node lookups and edge allocations of a full rebuild.
+//
+
+static const char CallGraphCacheMagic[] = "callgraph-cache-v1";
+
+static uint64_t hashString(StringRef S) {
+  MD5 Hash;
+  MD5::MD5Result Result;
+  Hash.update(S);
+  Hash.final(Result);
+  return Result.low();
+}
+
+/// Assign every function in \p M its position in the module's function list.
+static void buildFunctionIndex(const Module &M,
+                               DenseMap<const Function *, uint64_t> &Index) {
+  uint64_t I = 0;
+  for (const Function &F : M)
+    Index[&F] = I++;
+}
+
+/// Hash the callee at each of \p F's call sites, in order. Named callees are
+/// identified by name, unnamed ones by their position in the module (so a
+/// caller of an unnamed function is rescanned if the unnamed functions are
+/// shuffled), and indirect call sites by a marker of their own.
+static uint64_t
+hashFunctionCalls(const Function &F,
+                  const DenseMap<const Function *, uint64_t> &Index) {
+  MD5 Hash;
+  MD5::MD5Result Result;
+  for (const BasicBlock &BB : F)
+    for (const Instruction &I : BB)
+      if (auto CS = ImmutableCallSite(&I)) {
+        const Function *Callee = CS.getCalledFunction();
+        if (!Callee) {
+          Hash.update(StringRef("i"));
+        } else if (Callee->hasName()) {
+          Hash.update(StringRef("n"));
+          Hash.update(Callee->getName());
+          Hash.update(StringRef("\0", 1));
+        } else {
+          uint64_t CalleeIndex = Index.lookup(Callee);
+          Hash.update(StringRef("u"));
+          Hash.update(ArrayRef<uint8_t>(
+              reinterpret_cast<const uint8_t *>(&CalleeIndex),
+              sizeof(CalleeIndex)));
+        }
+      }
+  Hash.final(Result);
+  return Result.low();
+}
+
+std::error_code CallGraph::writeToCache(StringRef Path) const {
+  DenseMap<const Function *, uint64_t> FunctionIndex;
+  buildFunctionIndex(M, FunctionIndex);
+
+  SmallString<128> TempFilename(Path);
+  TempFilename += ".tmp%%%%%%";
+  int TempFD;
+  if (std::error_code EC =
+          sys::fs::createUniqueFile(TempFilename, TempFD, TempFilename))
+    return EC;
+
+  std::error_code WriteEC;
+  {
+    raw_fd_ostream OS(TempFD, /*shouldClose=*/true);
+    OS << CallGraphCacheMagic << ' ' << FunctionIndex.size() << '\n';
+    for (const Function &F : M) {
+      FunctionMapTy::const_iterator I = FunctionMap.find(&F);
+      if (I == FunctionMap.end()) {
+        WriteEC = std::make_error_code(std::errc::invalid_argument);
+        break;
+      }
+
+      OS << hashString(F.getName()) << ' '
+         << hashFunctionCalls(F, FunctionIndex);
+
+      // A declaration's only edge is the one to the calls-external node,
+      // which readFromCache recomputes along with the other structural edges,
+      // so its edge list is always empty.
+      if (F.isDeclaration()) {
+        OS << " 0\n";
+        continue;
+      }
+
+      const CallGraphNode &N = *I->second;
+      OS << ' ' << N.size();
+      for (const CallGraphNode::CallRecord &CR : N) {
+        if (Function *Callee = CR.second->getFunction())
+          OS << ' ' << FunctionIndex.lookup(Callee);
+        else
+          OS << " x";
+      }
+      OS << '\n';
+    }
+    OS.flush();
+    if (!WriteEC && OS.has_error()) {
+      WriteEC = std::make_error_code(std::errc::io_error);
+      OS.clear_error();
+    }
+  }
+
+  if (!WriteEC)
+    WriteEC = sys::fs::rename(TempFilename, Path);
+  if (WriteEC)
+    sys::fs::remove(TempFilename);
+  return WriteEC;
+}
+
+std::unique_ptr<CallGraph> CallGraph::readFromCache(Module &M,
+                                                    StringRef Path) {
+  ErrorOr<std::unique_ptr<MemoryBuffer>> BufferOrErr =
+      MemoryBuffer::getFile(Path);
+  if (!BufferOrErr)
+    return nullptr;
+
+  line_iterator LineIt(**BufferOrErr, /*SkipBlanks*/ true);
+  if (LineIt.is_at_eof())
+    return nullptr;
+
+  std::pair<StringRef, StringRef> Header = LineIt->split(' ');
+  uint64_t NumFunctions;
+  if (Header.first != CallGraphCacheMagic ||
+      Header.second.getAsInteger(10, NumFunctions))
+    return nullptr;
+  ++LineIt;
+
+  DenseMap<const Function *, uint64_t> FunctionIndex;
+  buildFunctionIndex(M, FunctionIndex);
+  if (NumFunctions != FunctionIndex.size())
+    return nullptr;
+
+  std::unique_ptr<CallGraph> CG(new CallGraph(M, /*BuildFromModule=*/false));
+
+  // Create every node up front so cached edges can be attached by position.
+  std::vector<CallGraphNode *> Nodes;
+  Nodes.reserve(FunctionIndex.size());
+  for (Function &F : M)
+    Nodes.push_back(CG->getOrInsertFunction(&F));
+
+  unsigned Position = 0;
+  SmallVector<StringRef, 16> Fields;
+  for (Function &F : M) {
+    if (LineIt.is_at_eof())
+      return nullptr;
+    Fields.clear();
+    LineIt->split(Fields, ' ');
+    ++LineIt;
+
+    uint64_t NameHash, CallsHash, NumEdges;
+    if (Fields.size() < 3 || Fields[0].getAsInteger(10, NameHash) ||
+        Fields[1].getAsInteger(10, CallsHash) ||
+        Fields[2].getAsInteger(10, NumEdges))
+      return nullptr;
+
+    // A renamed, inserted or removed function invalidates the positional
+    // edge encoding for the whole module.
+    if (NameHash != hashString(F.getName()))
+      return nullptr;
+
+    CallGraphNode *Node = Nodes[Position++];
+    CG->addStructuralEdges(&F, Node);
+    if (F.isDeclaration())
+      continue;
+
+    if (CallsHash != hashFunctionCalls(F, FunctionIndex)) {
+      // The function changed since the cache was written; rebuild its edges
+      // from the IR.
+      CG->scanFunctionBody(&F, Node);
+      continue;
+    }
+
+    if (Fields.size() != NumEdges + 3)
+      return nullptr;
+    for (uint64_t E = 0; E != NumEdges; ++E) {
+      StringRef Field = Fields[E + 3];
+      if (Field == "x") {
+        Node->addCalledFunction(CallSite(), CG->CallsExternalNode.get());
+        continue;
+      }
+      uint64_t CalleeIndex;
+      if (Field.getAsInteger(10, CalleeIndex) || CalleeIndex >= Nodes.size())
+        return nullptr;
+      Node->addCalledFunction(CallSite(), Nodes[CalleeIndex]);
+    }
+  }
+
+  // If we didn't find a main function, use the external call graph node
+  if (!CG->Root)
+    CG->Root = CG->ExternalCallingNode;
+  return CG;
+}
+
 //===----------------------------------------------------------------------===//
 // Implementations of the CallGraphNode class methods.
 //
@@ -1921,6 +1921,104 @@ Constant *ConstantFoldScalarCall(StringRef Name, unsigned IntrinsicID, Type *Ty,
   return nullptr;
 }
 
+void getVectorLanes(ConstantDataVector *CDV, SmallVectorImpl<float> &Lanes) {
+  for (unsigned I = 0, E = CDV->getNumElements(); I != E; ++I)
+    Lanes.push_back(CDV->getElementAsFloat(I));
+}
+
+void getVectorLanes(ConstantDataVector *CDV, SmallVectorImpl<double> &Lanes) {
+  for (unsigned I = 0, E = CDV->getNumElements(); I != E; ++I)
+    Lanes.push_back(CDV->getElementAsDouble(I));
+}
+
+/// Apply \p NativeOp to every lane of \p CDV in native host arithmetic and
+/// repack the results into a new ConstantDataVector.  NaN lanes are rejected
+/// because host arithmetic does not guarantee the payload and quiet-bit
+/// handling APFloat provides; with \p RequireFinite infinities are rejected
+/// too, for operations where the scalar folder refuses non-finite operands.
+/// Returning null sends the vector to the per-lane path.
+template <typename ElementTy>
+Constant *foldVectorLanesNative(ElementTy (*NativeOp)(ElementTy),
+                                ConstantDataVector *CDV, bool RequireFinite) {
+  SmallVector<ElementTy, 16> Lanes;
+  Lanes.reserve(CDV->getNumElements());
+  getVectorLanes(CDV, Lanes);
+  for (ElementTy &V : Lanes) {
+    if (std::isnan(V) || (RequireFinite && std::isinf(V)))
+      return nullptr;
+    V = NativeOp(V);
+  }
+  return ConstantDataVector::get(CDV->getContext(), Lanes);
+}
+
+/// Batch-fold an intrinsic call over a whole float or double constant vector
+/// with native host arithmetic, or return null to use the per-lane path.
+///
+/// The per-lane path materializes a uniqued ConstantFP for every element of
+/// every operand and re-dispatches the intrinsic per lane, which dominates
+/// the cost of folding wide constant vectors.  The operations handled here
+/// are exact in IEEE arithmetic, so on hosts where float and double are the
+/// IEEE single and double formats (the same assumption ConstantFoldFP and
+/// getValueAsDouble already make) the results are bit-identical to the
+/// APFloat path, and the tight loops over raw lane values are cheap enough
+/// for the host compiler to vectorize.  Transcendental calls are left to the
+/// per-lane path; they need the fenv checks in ConstantFoldFP per element.
+Constant *ConstantFoldVectorCallNativeLanes(unsigned IntrinsicID,
+                                            VectorType *VTy,
+                                            ArrayRef<Constant *> Operands) {
+  if (Operands.size() != 1)
+    return nullptr;
+  auto *CDV = dyn_cast<ConstantDataVector>(Operands[0]);
+  if (!CDV)
+    return nullptr;
+
+  Type *Ty = VTy->getElementType();
+  bool IsFloat = Ty->isFloatTy();
+  if (!IsFloat && !Ty->isDoubleTy())
+    return nullptr;
+
+  double (*DoubleOp)(double) = nullptr;
+  float (*FloatOp)(float) = nullptr;
+  bool RequireFinite = false;
+  switch (IntrinsicID) {
+  case Intrinsic::floor:
+    DoubleOp = floor;
+    FloatOp = floorf;
+    break;
+  case Intrinsic::ceil:
+    DoubleOp = ceil;
+    FloatOp = ceilf;
+    break;
+  case Intrinsic::trunc:
+    DoubleOp = trunc;
+    FloatOp = truncf;
+    break;
+  case Intrinsic::round:
+    DoubleOp = round;
+    FloatOp = roundf;
+    break;
+  case Intrinsic::rint:
+  case Intrinsic::nearbyint:
+    // Both fold as round-to-nearest-even; nearbyint does that in the default
+    // host rounding mode without raising inexact.
+    DoubleOp = nearbyint;
+    FloatOp = nearbyintf;
+    break;
+  case Intrinsic::fabs:
+    DoubleOp = fabs;
+    FloatOp = fabsf;
+    // The scalar folder refuses non-finite fabs operands; match it so this
+    // path never folds more than the per-lane path would.
+    RequireFinite = true;
+    break;
+  default:
+    return nullptr;
+  }
+
+  return IsFloat ? foldVectorLanesNative(FloatOp, CDV, RequireFinite)
+                 : foldVectorLanesNative(DoubleOp, CDV, RequireFinite);
+}
+
 Constant *ConstantFoldVectorCall(StringRef Name, unsigned IntrinsicID,
                                  VectorType *VTy, ArrayRef<Constant *> Operands,
                                  const DataLayout &DL,
@@ -1968,6 +2066,10 @@ Constant *ConstantFoldVectorCall(StringRef Name, unsigned IntrinsicID,
     return ConstantVector::get(NewElements);
   }
 
+  if (Constant *C = ConstantFoldVectorCallNativeLanes(IntrinsicID, VTy,
+                                                      Operands))
+    return C;
+
   for (unsigned I = 0, E = VTy->getNumElements(); I != E; ++I) {
     // Gather a column of constants.
     for (unsigned J = 0, JE = Operands.size(); J != JE; ++J) {
@@ -18,6 +18,7 @@
 //===----------------------------------------------------------------------===//
 
 #include "llvm/Analysis/InstructionSimplify.h"
+#include "llvm/ADT/Hashing.h"
 #include "llvm/ADT/SetVector.h"
 #include "llvm/ADT/Statistic.h"
 #include "llvm/Analysis/AliasAnalysis.h"
@@ -35,6 +36,7 @@
 #include "llvm/IR/Operator.h"
 #include "llvm/IR/PatternMatch.h"
 #include "llvm/IR/ValueHandle.h"
+#include "llvm/Support/CommandLine.h"
 #include "llvm/Support/KnownBits.h"
 #include <algorithm>
 using namespace llvm;
@@ -4447,8 +4449,76 @@ Value *llvm::SimplifyInstruction(Instruction *I, const DataLayout &DL,
   return SimplifyInstruction(I, {DL, TLI, DT, AC, I}, ORE);
 }
 
+// Off by default: the cache is keyed by instruction address and is not
+// notified of instruction deletion, so a freed instruction whose slot is
+// recycled can produce a false failure hit if the new neighbourhood happens
+// to fingerprint equal, making missed simplifications depend on allocator
+// addresses. Keep it opt-in until entries are invalidated through deletion
+// callbacks and scoped per function.
+static cl::opt<bool> EnableFailureCache(
+    "instsimplify-failure-cache", cl::Hidden, cl::init(false),
+    cl::desc("Remember instructions that failed to simplify and skip repeat "
+             "attempts while their operands are unchanged"));
+
+/// Bound on the number of values hashed into an instruction's fingerprint.
+/// Instructions with more reachable operands than this are never cached.
+static const unsigned FingerprintBudget = 64;
+
+/// Cap on cached entries. The cache is flushed wholesale when it fills,
+/// which also bounds how long entries for freed instructions can linger.
+static const unsigned FailureCacheSize = 65536;
+
+/// Hash everything the recursive simplification can inspect about \p V: the
+/// value itself and, for instructions, the opcode, flags and the values
+/// reachable through the operands down to the recursion limit. If a repeat
+/// query produces the same fingerprint, a previously failed simplification
+/// still fails for every rule that only looks at this neighbourhood. Rules
+/// keyed on dominating conditions or assumptions can in rare cases newly
+/// fire without the fingerprint changing; since only failures are cached, a
+/// stale hit costs at most the missed simplification, never a wrong one.
+static bool fingerprintValue(const Value *V, unsigned Depth, unsigned &Budget,
+                             hash_code &Hash) {
+  if (Budget == 0)
+    return false;
+  --Budget;
+  Hash = hash_combine(Hash, V);
+  const auto *I = dyn_cast<Instruction>(V);
+  if (!I || Depth == 0)
+    return true;
+  Hash = hash_combine(Hash, I->getOpcode(), I->getRawSubclassOptionalData());
+  for (const Use &Op : I->operands())
+    if (!fingerprintValue(Op.get(), Depth - 1, Budget, Hash))
+      return false;
+  return true;
+}
+
 Value *llvm::SimplifyInstruction(Instruction *I, const SimplifyQuery &Q,
                                  OptimizationRemarkEmitter *ORE) {
+  // Callers retry simplification of the same instructions over and over (the
+  // InstCombine worklist alone revisits most of a function), and most repeat
+  // attempts fail again because nothing the simplification can see has
+  // changed. Fingerprint the instruction's reachable neighbourhood and skip
+  // the whole walk when a failure with the same fingerprint is on record.
+  // The map is per thread and entries are validated by fingerprint, but keys
+  // are raw instruction addresses that can be recycled after deletion; see
+  // the comment on EnableFailureCache for why this is opt-in.
+  static LLVM_THREAD_LOCAL DenseMap<const Instruction *, hash_code>
+      *FailureCache = nullptr;
+  hash_code Fingerprint;
+  bool Cacheable = false;
+  if (EnableFailureCache) {
+    unsigned Budget = FingerprintBudget;
+    Fingerprint = hash_value(I->getType());
+    Cacheable = fingerprintValue(I, RecursionLimit, Budget, Fingerprint);
+    if (Cacheable) {
+      if (!FailureCache)
+        FailureCache = new DenseMap<const Instruction *, hash_code>();
+      auto It = FailureCache->find(I);
+      if (It != FailureCache->end() && It->second == Fingerprint)
+        return nullptr;
+    }
+  }
+
   Value *Result;
 
   switch (I->getOpcode()) {
@@ -4599,7 +4669,19 @@ Value *llvm::SimplifyInstruction(Instruction *I, const SimplifyQuery &Q,
   /// If called on unreachable code, the above logic may report that the
   /// instruction simplified to itself.  Make life easier for users by
   /// detecting that case here, returning a safe value instead.
-  return Result == I ? UndefValue::get(I->getType()) : Result;
+  if (Result == I)
+    Result = UndefValue::get(I->getType());
+
+  if (Cacheable) {
+    if (!Result) {
+      if (FailureCache->size() >= FailureCacheSize)
+        FailureCache->clear();
+      (*FailureCache)[I] = Fingerprint;
+    } else {
+      FailureCache->erase(I);
+    }
+  }
+  return Result;
 }
 
 /// \brief Implementation of recursive simplification through an instruction's
@@ -1436,6 +1436,268 @@ LazyCallGraph::RefSCC::removeInternalRefEdge(Node &SourceN, Node &TargetN) {
   return Result;
 }
 
+SmallVector<LazyCallGraph::RefSCC *, 1>
+LazyCallGraph::RefSCC::removeInternalRefEdges(Node &SourceN,
+                                              ArrayRef<Node *> TargetNs) {
+  // We return a list of the resulting *new* RefSCCs in post-order.
+  SmallVector<RefSCC *, 1> Result;
+
+#ifndef NDEBUG
+  // In a debug build, verify the RefSCC is valid to start with and when this
+  // routine finishes.
+  verify();
+  auto VerifyOnExit = make_scope_exit([&]() {
+    verify();
+    for (RefSCC *RC : Result)
+      RC->verify();
+  });
+#endif
+
+  // First remove all of the actual edges. Direct recursion doesn't impact the
+  // SCC graph at all, and a ref edge within an SCC leaves sufficient other
+  // edges to form the same cycle, so track whether removing any edge can
+  // actually change the structure.
+  SCC &SourceC = *G->lookupSCC(SourceN);
+  bool StructureMayChange = false;
+  for (Node *TargetN : TargetNs) {
+    assert(!(*SourceN)[*TargetN].isCall() &&
+           "Cannot remove a call edge, it must first be made a ref edge");
+
+    bool Removed = SourceN->removeEdgeInternal(*TargetN);
+    (void)Removed;
+    assert(Removed && "Target not in the edge set for this caller?");
+
+    if (&SourceN != TargetN && G->lookupSCC(*TargetN) != &SourceC)
+      StructureMayChange = true;
+  }
+  if (!StructureMayChange)
+    return Result;
+
+  // We build somewhat synthetic new RefSCCs by providing a postorder mapping
+  // for each inner SCC, exactly as in removeInternalRefEdge above. However,
+  // with several edges removed at once there is no single target SCC which is
+  // known to remain reachable from everything else, so we cannot pre-mark a
+  // root component and short-cut the walk. Instead we run the full DFS over
+  // all of the nodes, numbering every component in postorder, and keep the
+  // last component (which no other component references) in this RefSCC.
+  int PostOrderNumber = 0;
+  SmallDenseMap<Node *, int> PostOrderMapping;
+
+  // Reset all the nodes to prepare for a DFS over them, and add them to our
+  // worklist.
+  SmallVector<Node *, 8> Worklist;
+  for (SCC *C : SCCs) {
+    for (Node &N : *C)
+      N.DFSNumber = N.LowLink = 0;
+
+    Worklist.append(C->Nodes.begin(), C->Nodes.end());
+  }
+
+  auto MarkNodeForSCCNumber = [&PostOrderMapping](Node &N, int Number) {
+    N.DFSNumber = N.LowLink = -1;
+    PostOrderMapping[&N] = Number;
+  };
+
+  SmallVector<std::pair<Node *, EdgeSequence::iterator>, 4> DFSStack;
+  SmallVector<Node *, 4> PendingRefSCCStack;
+  do {
+    assert(DFSStack.empty() &&
+           "Cannot begin a new root with a non-empty DFS stack!");
+    assert(PendingRefSCCStack.empty() &&
+           "Cannot begin a new root with pending nodes for an SCC!");
+
+    Node *RootN = Worklist.pop_back_val();
+    // Skip any nodes we've already reached in the DFS.
+    if (RootN->DFSNumber != 0) {
+      assert(RootN->DFSNumber == -1 &&
+             "Shouldn't have any mid-DFS root nodes!");
+      continue;
+    }
+
+    RootN->DFSNumber = RootN->LowLink = 1;
+    int NextDFSNumber = 2;
+
+    DFSStack.push_back({RootN, (*RootN)->begin()});
+    do {
+      Node *N;
+      EdgeSequence::iterator I;
+      std::tie(N, I) = DFSStack.pop_back_val();
+      auto E = (*N)->end();
+
+      assert(N->DFSNumber != 0 && "We should always assign a DFS number "
+                                  "before processing a node.");
+
+      while (I != E) {
+        Node &ChildN = I->getNode();
+        if (ChildN.DFSNumber == 0) {
+          // Mark that we should start at this child when next this node is the
+          // top of the stack. We don't start at the next child to ensure this
+          // child's lowlink is reflected.
+          DFSStack.push_back({N, I});
+
+          // Continue, resetting to the child node.
+          ChildN.LowLink = ChildN.DFSNumber = NextDFSNumber++;
+          N = &ChildN;
+          I = ChildN->begin();
+          E = ChildN->end();
+          continue;
+        }
+        if (ChildN.DFSNumber == -1) {
+          // If this child isn't currently in this RefSCC, no need to process
+          // it other than removing this RefSCC from its RefSCC's parent set;
+          // we will re-add ourselves below as needed. Nodes which have
+          // already been assigned a postorder component take this path as
+          // well, where the lookup harmlessly finds this RefSCC.
+          RefSCC &ChildRC = *G->lookupRefSCC(ChildN);
+          ChildRC.Parents.erase(this);
+          ++I;
+          continue;
+        }
+
+        // Track the lowest link of the children, if any are still in the stack.
+        // Any child not on the stack will have a LowLink of -1.
+        assert(ChildN.LowLink != 0 &&
+               "Low-link must not be zero with a non-zero DFS number.");
+        if (ChildN.LowLink >= 0 && ChildN.LowLink < N->LowLink)
+          N->LowLink = ChildN.LowLink;
+        ++I;
+      }
+
+      // We've finished processing N and its descendents, put it on our pending
+      // stack to eventually get merged into a RefSCC.
+      PendingRefSCCStack.push_back(N);
+
+      // If this node is linked to some lower entry, continue walking up the
+      // stack.
+      if (N->LowLink != N->DFSNumber) {
+        assert(!DFSStack.empty() &&
+               "We never found a viable root for a RefSCC to pop off!");
+        continue;
+      }
+
+      // Otherwise, form a new RefSCC from the top of the pending node stack.
+      int RootDFSNumber = N->DFSNumber;
+      // Find the range of the node stack by walking down until we pass the
+      // root DFS number.
+      auto RefSCCNodes = make_range(
+          PendingRefSCCStack.rbegin(),
+          find_if(reverse(PendingRefSCCStack), [RootDFSNumber](const Node *N) {
+            return N->DFSNumber < RootDFSNumber;
+          }));
+
+      // Mark the postorder number for these nodes and clear them off the
+      // stack. We'll use the postorder number to pull them into RefSCCs at the
+      // end.
+      int RefSCCNumber = PostOrderNumber++;
+      for (Node *N : RefSCCNodes)
+        MarkNodeForSCCNumber(*N, RefSCCNumber);
+
+      PendingRefSCCStack.erase(RefSCCNodes.end().base(),
+                               PendingRefSCCStack.end());
+    } while (!DFSStack.empty());
+
+    assert(DFSStack.empty() && "Didn't flush the entire DFS stack!");
+    assert(PendingRefSCCStack.empty() && "Didn't flush all pending nodes!");
+  } while (!Worklist.empty());
+
+  if (PostOrderNumber > 1) {
+    // We now have a post-order numbering for RefSCCs and a mapping from each
+    // node in this RefSCC to its final RefSCC. Because the components are
+    // emitted in postorder, the last one is not referenced by any of the
+    // others and can keep using this RefSCC node and its position in the
+    // global postorder sequence; every other component becomes a new RefSCC.
+    for (int i = 0; i < PostOrderNumber - 1; ++i)
+      Result.push_back(G->createRefSCC(*G));
+
+    // Insert the resulting postorder sequence into the global graph postorder
+    // sequence before the current RefSCC in that sequence, as all of the new
+    // RefSCCs can only be referenced from this RefSCC's old position onwards.
+    int Idx = G->getRefSCCIndex(*this);
+    G->PostOrderRefSCCs.insert(G->PostOrderRefSCCs.begin() + Idx,
+                               Result.begin(), Result.end());
+    for (int i : seq<int>(Idx, G->PostOrderRefSCCs.size()))
+      G->RefSCCIndices[G->PostOrderRefSCCs[i]] = i;
+    assert(G->PostOrderRefSCCs[G->getRefSCCIndex(*this)] == this &&
+           "Failed to update this RefSCC's index after insertion!");
+
+    for (SCC *C : SCCs) {
+      auto PostOrderI = PostOrderMapping.find(&*C->begin());
+      assert(PostOrderI != PostOrderMapping.end() &&
+             "Cannot have missing mappings for nodes!");
+      int SCCNumber = PostOrderI->second;
+#ifndef NDEBUG
+      for (Node &N : *C)
+        assert(PostOrderMapping.find(&N)->second == SCCNumber &&
+               "Cannot have different numbers for nodes in the same SCC!");
+#endif
+      if (SCCNumber == PostOrderNumber - 1)
+        // The last component is handled separately by retaining its SCCs.
+        continue;
+
+      RefSCC &RC = *Result[SCCNumber];
+      int SCCIndex = RC.SCCs.size();
+      RC.SCCs.push_back(C);
+      RC.SCCIndices[C] = SCCIndex;
+      C->OuterRefSCC = &RC;
+    }
+
+    // Connect the new RefSCCs to the rest of the graph's parents lists.
+    for (RefSCC *RC : Result)
+      G->connectRefSCC(*RC);
+
+    // Now erase all but the last component's SCCs.
+    SCCs.erase(remove_if(SCCs,
+                         [&](SCC *C) {
+                           return PostOrderMapping.lookup(&*C->begin()) !=
+                                  PostOrderNumber - 1;
+                         }),
+               SCCs.end());
+    SCCIndices.clear();
+    for (int i = 0, Size = SCCs.size(); i < Size; ++i)
+      SCCIndices[SCCs[i]] = i;
+  }
+
+  // Now we need to reconnect the current (root) SCC to the graph as we may
+  // have removed ourselves from our children's parent sets during the DFS
+  // even if no splitting happened.
+  for (SCC *C : SCCs)
+    for (Node &N : *C)
+      for (Edge &E : *N) {
+        RefSCC &ChildRC = *G->lookupRefSCC(E.getNode());
+        if (&ChildRC == this)
+          continue;
+        ChildRC.Parents.insert(this);
+      }
+
+  if (!Result.empty()) {
+    // And connect both this RefSCC and all the new ones to the correct
+    // parents. The easiest way to do this is just to re-analyze the old
+    // parent set.
+    SmallVector<RefSCC *, 4> OldParents(Parents.begin(), Parents.end());
+    Parents.clear();
+    for (RefSCC *ParentRC : OldParents)
+      for (SCC &ParentC : *ParentRC)
+        for (Node &ParentN : ParentC)
+          for (Edge &E : *ParentN) {
+            RefSCC &RC = *G->lookupRefSCC(E.getNode());
+            if (&RC != ParentRC)
+              RC.Parents.insert(ParentRC);
+          }
+
+    // If this RefSCC stopped being a leaf through these edge removals, remove
+    // it from the leaf list. Note that this DTRT in the case where this was
+    // never a leaf.
+    // FIXME: As LeafRefSCCs could be very large, we might want to not walk the
+    // entire list if this RefSCC wasn't a leaf before the edge removal.
+    G->LeafRefSCCs.erase(
+        std::remove(G->LeafRefSCCs.begin(), G->LeafRefSCCs.end(), this),
+        G->LeafRefSCCs.end());
+  }
+
+  // Return the new list of SCCs.
+  return Result;
+}
+
 void LazyCallGraph::RefSCC::handleTrivialEdgeInsertion(Node &SourceN,
                                                        Node &TargetN) {
   // The only trivial case that requires any graph updates is when we add new
@@ -688,6 +688,11 @@ namespace {
     LVILatticeVal getValueOnEdge(Value *V, BasicBlock *FromBB,BasicBlock *ToBB,
                                  Instruction *CxtI = nullptr);
 
+    /// Compute and cache the block-end values of all of the given
+    /// (value, block) pairs with a single solver pass; subsequent queries
+    /// for them are answered from the cache.
+    void solveValues(ArrayRef<std::pair<Value *, BasicBlock *>> Queries);
+
     /// Complete flush all previously computed values
     void clear() {
       TheCache.clear();
@@ -729,7 +734,10 @@ void LazyValueInfoImpl::solve() {
     // the same overdefined result again and again.  Once something like
     // PredicateInfo is used in LVI or CVP, we should be able to make the
     // overdefined cache global, and remove this throttle.
-    if (processedCount > MaxProcessedPerValue) {
+    // The budget scales with the number of values seeded on the stack, so a
+    // batched query keeps the same per-value budget as a chain of individual
+    // queries would have had.
+    if (processedCount > MaxProcessedPerValue * StartingStack.size()) {
       DEBUG(dbgs() << "Giving up on stack because we are getting too deep\n");
       // Fill in the original values
       while (!StartingStack.empty()) {
@@ -1546,6 +1554,19 @@ getValueOnEdge(Value *V, BasicBlock *FromBB, BasicBlock *ToBB,
   return Result;
 }
 
+void LazyValueInfoImpl::solveValues(
+    ArrayRef<std::pair<Value *, BasicBlock *>> Queries) {
+  assert(BlockValueStack.empty() && BlockValueSet.empty());
+  for (const std::pair<Value *, BasicBlock *> &Q : Queries) {
+    DEBUG(dbgs() << "LVI Batching block end value " << *Q.first << " at '"
+                 << Q.second->getName() << "'\n");
+    if (!hasBlockValue(Q.first, Q.second))
+      pushBlockValue(std::make_pair(Q.second, Q.first));
+  }
+  if (!BlockValueStack.empty())
+    solve();
+}
+
 void LazyValueInfoImpl::threadEdge(BasicBlock *PredBB, BasicBlock *OldSucc,
                                    BasicBlock *NewSucc) {
   TheCache.threadEdgeImpl(OldSucc, NewSucc);
@@ -1693,6 +1714,16 @@ Constant *LazyValueInfo::getConstantOnEdge(Value *V, BasicBlock *FromBB,
   return nullptr;
 }
 
+void LazyValueInfo::batchQueryValues(
+    ArrayRef<std::pair<Value *, BasicBlock *>> Queries) {
+  if (Queries.empty())
+    return;
+
+  const DataLayout &DL =
+      Queries.front().second->getModule()->getDataLayout();
+  getImpl(PImpl, AC, &DL, DT).solveValues(Queries);
+}
+
 static LazyValueInfo::Tristate getPredicateResult(unsigned Pred, Constant *C,
                                                   LVILatticeVal &Result,
                                                   const DataLayout &DL,
@@ -10,6 +10,21 @@
 // This pass builds a ModuleSummaryIndex object for the module, to be written
 // to bitcode or LLVM assembly.
 //
+// The summary is the one analysis result that is serialized across pipeline
+// stages: it is computed once here at compile time, carried as dedicated
+// bitcode blocks next to the IR, and consumed by the thin link and the
+// distributed backends without re-deriving anything from the IR (the module
+// hash written alongside it keys cache validation). Requests come up
+// periodically to extend this channel to function analyses like
+// ScalarEvolution or LoopInfo. Those results do not survive serialization
+// usefully: they are graphs of pointers into a specific Module and
+// LLVMContext (SCEV nodes are context-uniqued, LoopInfo holds BasicBlock
+// pointers), so a consumer would have to re-map every edge against freshly
+// parsed IR, which costs as much as recomputing the analysis from scratch
+// and is invalidated by any upstream change to the function. Analyses
+// intended to cross a process boundary need to be designed like this one:
+// self-contained values keyed by stable IDs, not views into the IR.
+//
 //===----------------------------------------------------------------------===//
 
 #include "llvm/Analysis/ModuleSummaryAnalysis.h"
@@ -153,6 +153,22 @@ bool ProfileSummaryInfo::isFunctionEntryCold(const Function *F) {
   return FunctionCount && isColdCount(FunctionCount.getValue());
 }
 
+static cl::opt<bool> ColdFunctionOptGate(
+    "pgo-cold-function-opt-gate", cl::Hidden, cl::init(false), cl::ZeroOrMore,
+    cl::desc("Skip expensive optimization passes (GVN, SLP and loop "
+             "vectorization) on functions whose profile says they are cold."));
+
+bool ProfileSummaryInfo::shouldReduceColdFunctionPipeline(const Function *F) {
+  if (!ColdFunctionOptGate || !F)
+    return false;
+  // Only gate on real profile data; the cold attribute alone is too weak a
+  // signal to drop optimizations on.
+  if (!computeSummary())
+    return false;
+  auto FunctionCount = F->getEntryCount();
+  return FunctionCount && isColdCount(FunctionCount.getValue());
+}
+
 /// Compute the hot and cold thresholds.
 void ProfileSummaryInfo::computeThresholds() {
   if (!computeSummary())
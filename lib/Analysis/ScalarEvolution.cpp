@@ -157,6 +157,13 @@ static cl::opt<unsigned> MaxConstantEvolvingDepth(
     "scalar-evolution-max-constant-evolving-depth", cl::Hidden,
     cl::desc("Maximum depth of recursive constant evolving"), cl::init(32));
 
+static cl::opt<unsigned> SCEVMemoryBudgetMB(
+    "scev-memory-budget", cl::Hidden,
+    cl::desc("Soft limit, in MiB, on memory held by SCEV expressions; when "
+             "exceeded, cooperating passes drop all cached expressions at "
+             "their next safe point (0 = unlimited)"),
+    cl::init(0));
+
 //===----------------------------------------------------------------------===//
 //                           SCEV class definitions
 //===----------------------------------------------------------------------===//
@@ -9903,6 +9910,51 @@ ScalarEvolution::~ScalarEvolution() {
   assert(!ProvingSplitPredicate && "ProvingSplitPredicate garbage!");
 }
 
+void ScalarEvolution::forgetAllExpressions() {
+  // This mirrors the destructor: release the SCEVUnknowns' value handles,
+  // then drop every map that stores or is keyed by a SCEV before freeing the
+  // expressions themselves.
+  for (SCEVUnknown *U = FirstUnknown; U;) {
+    SCEVUnknown *Tmp = U;
+    U = U->Next;
+    Tmp->~SCEVUnknown();
+  }
+  FirstUnknown = nullptr;
+
+  ExprValueMap.clear();
+  ValueExprMap.clear();
+  HasRecMap.clear();
+  MinTrailingZerosCache.clear();
+
+  for (auto &BTCI : BackedgeTakenCounts)
+    BTCI.second.clear();
+  BackedgeTakenCounts.clear();
+  for (auto &BTCI : PredicatedBackedgeTakenCounts)
+    BTCI.second.clear();
+  PredicatedBackedgeTakenCounts.clear();
+
+  ConstantEvolutionLoopExitValue.clear();
+  ValuesAtScopes.clear();
+  LoopDispositions.clear();
+  LoopPropertiesCache.clear();
+  BlockDispositions.clear();
+  UnsignedRanges.clear();
+  SignedRanges.clear();
+
+  assert(PendingLoopPredicates.empty() && "isImpliedCond garbage");
+  UniqueSCEVs.clear();
+  UniquePreds.clear();
+  SCEVAllocator.Reset();
+}
+
+bool ScalarEvolution::forgetAllExpressionsIfOverBudget() {
+  if (!SCEVMemoryBudgetMB ||
+      getExpressionMemoryUsage() <= size_t(SCEVMemoryBudgetMB) * 1024 * 1024)
+    return false;
+  forgetAllExpressions();
+  return true;
+}
+
 bool ScalarEvolution::hasLoopInvariantBackedgeTakenCount(const Loop *L) {
   return !isa<SCEVCouldNotCompute>(getBackedgeTakenCount(L));
 }
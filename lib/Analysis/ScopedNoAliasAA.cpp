@@ -140,6 +140,10 @@ bool ScopedNoAliasAAResult::mayAliasInScopes(const MDNode *Scopes,
   if (!Scopes || !NoAlias)
     return true;
 
+  auto Cached = MayAliasCache.find(std::make_pair(Scopes, NoAlias));
+  if (Cached != MayAliasCache.end())
+    return Cached->second;
+
   // Collect the set of scope domains relevant to the noalias scopes.
   SmallPtrSet<const MDNode *, 16> Domains;
   for (const MDOperand &MDOp : NoAlias->operands())
@@ -166,10 +170,13 @@ bool ScopedNoAliasAAResult::mayAliasInScopes(const MDNode *Scopes,
         break;
       }
 
-    if (FoundAll)
+    if (FoundAll) {
+      MayAliasCache[std::make_pair(Scopes, NoAlias)] = false;
       return false;
+    }
   }
 
+  MayAliasCache[std::make_pair(Scopes, NoAlias)] = true;
   return true;
 }
 
@@ -471,23 +471,16 @@ MDNode *MDNode::getMostGenericTBAA(MDNode *A, MDNode *B) {
 }
 
 void Instruction::getAAMetadata(AAMDNodes &N, bool Merge) const {
-  if (Merge)
-    N.TBAA =
-        MDNode::getMostGenericTBAA(N.TBAA, getMetadata(LLVMContext::MD_tbaa));
-  else
-    N.TBAA = getMetadata(LLVMContext::MD_tbaa);
-
-  if (Merge)
-    N.Scope = MDNode::getMostGenericAliasScope(
-        N.Scope, getMetadata(LLVMContext::MD_alias_scope));
-  else
-    N.Scope = getMetadata(LLVMContext::MD_alias_scope);
-
-  if (Merge)
-    N.NoAlias =
-        MDNode::intersect(N.NoAlias, getMetadata(LLVMContext::MD_noalias));
-  else
-    N.NoAlias = getMetadata(LLVMContext::MD_noalias);
+  if (!Merge) {
+    getAAMetadataImpl(N);
+    return;
+  }
+
+  AAMDNodes Attached;
+  getAAMetadataImpl(Attached);
+  N.TBAA = MDNode::getMostGenericTBAA(N.TBAA, Attached.TBAA);
+  N.Scope = MDNode::getMostGenericAliasScope(N.Scope, Attached.Scope);
+  N.NoAlias = MDNode::intersect(N.NoAlias, Attached.NoAlias);
 }
 
 /// Aliases - Test whether the type represented by A may alias the
@@ -23,6 +23,7 @@
 #include "llvm/ADT/Triple.h"
 #include "llvm/ADT/Twine.h"
 #include "llvm/Bitcode/BitstreamReader.h"
+#include "llvm/Support/Compression.h"
 #include "llvm/Bitcode/LLVMBitCodes.h"
 #include "llvm/IR/Argument.h"
 #include "llvm/IR/Attributes.h"
@@ -93,6 +94,12 @@ static cl::opt<bool> PrintSummaryGUIDs(
     cl::desc(
         "Print the global id for each value when reading the module summary"));
 
+static cl::opt<bool> CompactUseListsOnLoad(
+    "compact-use-lists-on-load", cl::init(false), cl::Hidden,
+    cl::desc("After materializing a module, sort each function-local value's "
+             "use list into program order so that passes iterating users get "
+             "a sequential access pattern"));
+
 namespace {
 
 enum {
@@ -521,6 +528,7 @@ public:
   Error materializeForwardReferencedFunctions();
 
   Error materialize(GlobalValue *GV) override;
+  Error materialize(ArrayRef<GlobalValue *> GVs) override;
   Error materializeModule() override;
   std::vector<StructType *> getIdentifiedStructTypes() const override;
 
@@ -3211,6 +3219,7 @@ Error BitcodeReader::parseBitcodeInto(Module *M, bool ShouldLazyLoadMetadata,
                                       bool IsImporting) {
   TheModule = M;
   MDLoader = MetadataLoader(Stream, *M, ValueList, IsImporting,
+                            ShouldLazyLoadMetadata,
                             [&](unsigned ID) { return getTypeByID(ID); });
   return parseModule(0, ShouldLazyLoadMetadata);
 }
@@ -4607,6 +4616,69 @@ Error BitcodeReader::materialize(GlobalValue *GV) {
   return materializeForwardReferencedFunctions();
 }
 
+Error BitcodeReader::materialize(ArrayRef<GlobalValue *> GVs) {
+  // Decode the requested bodies in increasing bitstream offset order, so that
+  // a batch request (e.g. a ThinLTO import of hundreds of functions from one
+  // module) becomes a single forward sweep over the file instead of a random
+  // seek per function.
+  SmallVector<Function *, 16> Fns;
+  for (GlobalValue *GV : GVs)
+    if (auto *F = dyn_cast_or_null<Function>(GV))
+      if (F->isMaterializable())
+        Fns.push_back(F);
+
+  std::stable_sort(Fns.begin(), Fns.end(), [this](Function *L, Function *R) {
+    uint64_t LBit = DeferredFunctionInfo.lookup(L);
+    uint64_t RBit = DeferredFunctionInfo.lookup(R);
+    // A function whose body position is not known yet (offset 0) is found by
+    // scanning forward from the current stream position; keep those last and
+    // in their original relative order.
+    if (LBit == 0 || RBit == 0)
+      return LBit != 0 && RBit == 0;
+    return LBit < RBit;
+  });
+
+  for (Function *F : Fns)
+    if (Error Err = materialize(F))
+      return Err;
+  return Error::success();
+}
+
+/// Sort the use list of every value defined in \p F into program order.
+///
+/// The reader materializes instructions in program order, so after sorting, a
+/// pass walking Value::users() hops through memory in roughly the order it
+/// was laid down rather than in the reverse-creation order use lists
+/// naturally accumulate. Use lists of instructions, arguments and basic
+/// blocks only contain users inside \p F, so a per-function numbering is
+/// enough to order them; users that are not instructions (e.g. constant
+/// expressions holding a blockaddress) stay at the end in their old relative
+/// order.
+static void compactFunctionUseLists(Function &F) {
+  DenseMap<const Instruction *, unsigned> InstOrder;
+  unsigned Order = 0;
+  for (BasicBlock &BB : F)
+    for (Instruction &I : BB)
+      InstOrder[&I] = Order++;
+
+  auto GetOrder = [&InstOrder](const Use &U) -> unsigned {
+    if (auto *I = dyn_cast<Instruction>(U.getUser()))
+      return InstOrder.lookup(I);
+    return ~0u;
+  };
+  auto InProgramOrder = [&GetOrder](const Use &L, const Use &R) {
+    return GetOrder(L) < GetOrder(R);
+  };
+
+  for (Argument &A : F.args())
+    A.sortUseList(InProgramOrder);
+  for (BasicBlock &BB : F) {
+    BB.sortUseList(InProgramOrder);
+    for (Instruction &I : BB)
+      I.sortUseList(InProgramOrder);
+  }
+}
+
 Error BitcodeReader::materializeModule() {
   if (Error Err = materializeMetadata())
     return Err;
@@ -4614,12 +4686,12 @@ Error BitcodeReader::materializeModule() {
   // Promise to materialize all forward references.
   WillMaterializeAllForwardRefs = true;
 
-  // Iterate over the module, deserializing any functions that are still on
-  // disk.
-  for (Function &F : *TheModule) {
-    if (Error Err = materialize(&F))
-      return Err;
-  }
+  // Deserialize any functions that are still on disk, in stream order.
+  SmallVector<GlobalValue *, 32> DeferredFns;
+  for (Function &F : *TheModule)
+    DeferredFns.push_back(&F);
+  if (Error Err = materialize(DeferredFns))
+    return Err;
   // At this point, if there are any function bodies, parse the rest of
   // the bits in the module past the last function block we have recorded
   // through either lazy scanning or the VST.
@@ -4658,6 +4730,14 @@ Error BitcodeReader::materializeModule() {
   UpgradeDebugInfo(*TheModule);
 
   UpgradeModuleFlags(*TheModule);
+
+  // When asked to, rewrite each function's use lists into program order now
+  // that every user in the module has been materialized. This deliberately
+  // overrides any use-list order preserved in the bitcode.
+  if (CompactUseListsOnLoad)
+    for (Function &F : *TheModule)
+      compactFunctionUseLists(F);
+
   return Error::success();
 }
 
@@ -5610,3 +5690,40 @@ Expected<bool> llvm::hasGlobalValueSummary(MemoryBufferRef Buffer) {
 
   return BM->hasSummary();
 }
+
+Expected<std::unique_ptr<MemoryBuffer>>
+llvm::decompressBitcodeBuffer(MemoryBufferRef Buffer) {
+  const unsigned char *BufPtr = (const unsigned char *)Buffer.getBufferStart();
+  const unsigned char *BufEnd = BufPtr + Buffer.getBufferSize();
+  if (!isCompressedBitcode(BufPtr, BufEnd))
+    return error("Not a compressed bitcode container");
+  if (!zlib::isAvailable())
+    return error("Compressed bitcode requires an LLVM built with zlib");
+  // Layout after the 4 magic bytes: uncompressed size as a little-endian
+  // 64-bit integer, then one zlib stream covering the whole bitcode file.
+  if (Buffer.getBufferSize() < 12)
+    return error("Truncated compressed bitcode container");
+  uint64_t UncompressedSize = support::endian::read64le(BufPtr + 4);
+  // Cheap sanity bound so a corrupted size field can't trigger a huge
+  // allocation: zlib can't compress better than ~1000x.
+  if (UncompressedSize > (Buffer.getBufferSize() - 12) * 1024 + 64)
+    return error("Invalid compressed bitcode container size");
+  std::unique_ptr<MemoryBuffer> Result = MemoryBuffer::getNewUninitMemBuffer(
+      UncompressedSize, Buffer.getBufferIdentifier());
+  if (!Result)
+    return error("Out of memory expanding compressed bitcode");
+  StringRef CompressedData(Buffer.getBufferStart() + 12,
+                           Buffer.getBufferSize() - 12);
+  size_t Size = UncompressedSize;
+  if (Error E = zlib::uncompress(
+          CompressedData, const_cast<char *>(Result->getBufferStart()), Size)) {
+    consumeError(std::move(E));
+    return error("Malformed compressed bitcode container");
+  }
+  if (Size != UncompressedSize)
+    return error("Compressed bitcode container size mismatch");
+  const unsigned char *Data = (const unsigned char *)Result->getBufferStart();
+  if (!isBitcode(Data, Data + Size))
+    return error("Compressed bitcode container does not hold bitcode");
+  return std::move(Result);
+}
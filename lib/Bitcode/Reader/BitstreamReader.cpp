@@ -143,11 +143,13 @@ unsigned BitstreamCursor::skipRecord(unsigned AbbrevID) {
         assert((unsigned)EltEnc.getEncodingData() <= MaxChunkSize);
         JumpToBit(GetCurrentBitNo() + NumElts * EltEnc.getEncodingData());
         break;
-      case BitCodeAbbrevOp::VBR:
+      case BitCodeAbbrevOp::VBR: {
         assert((unsigned)EltEnc.getEncodingData() <= MaxChunkSize);
+        unsigned EltBits = (unsigned)EltEnc.getEncodingData();
         for (; NumElts; --NumElts)
-          ReadVBR64((unsigned)EltEnc.getEncodingData());
+          ReadVBR64(EltBits);
         break;
+      }
       case BitCodeAbbrevOp::Char6:
         JumpToBit(GetCurrentBitNo() + NumElts * 6);
         break;
@@ -231,14 +233,20 @@ unsigned BitstreamCursor::readRecord(unsigned AbbrevID,
       switch (EltEnc.getEncoding()) {
       default:
         report_fatal_error("Array element type can't be an Array or a Blob");
-      case BitCodeAbbrevOp::Fixed:
+      case BitCodeAbbrevOp::Fixed: {
+        // Hoist the element width out of the loop; the compiler cannot do it
+        // for us past the push_back.
+        unsigned EltBits = (unsigned)EltEnc.getEncodingData();
         for (; NumElts; --NumElts)
-          Vals.push_back(Read((unsigned)EltEnc.getEncodingData()));
+          Vals.push_back(Read(EltBits));
         break;
-      case BitCodeAbbrevOp::VBR:
+      }
+      case BitCodeAbbrevOp::VBR: {
+        unsigned EltBits = (unsigned)EltEnc.getEncodingData();
         for (; NumElts; --NumElts)
-          Vals.push_back(ReadVBR64((unsigned)EltEnc.getEncodingData()));
+          Vals.push_back(ReadVBR64(EltBits));
         break;
+      }
       case BitCodeAbbrevOp::Char6:
         for (; NumElts; --NumElts)
           Vals.push_back(BitCodeAbbrevOp::DecodeChar6(Read(6)));
@@ -104,7 +104,7 @@ static cl::opt<bool> ImportFullTypeDefinitions(
 static cl::opt<bool> DisableLazyLoading(
     "disable-ondemand-mds-loading", cl::init(false), cl::Hidden,
     cl::desc("Force disable the lazy-loading on-demand of metadata when "
-             "loading bitcode for importing."));
+             "lazy-loading bitcode, e.g. for importing."));
 
 namespace {
 
@@ -458,6 +458,12 @@ class MetadataLoader::MetadataLoaderImpl {
   /// True if metadata is being parsed for a module being ThinLTO imported.
   bool IsImporting = false;
 
+  /// True if the client asked for lazy metadata loading on this module
+  /// (getLazyBitcodeModule with ShouldLazyLoadMetadata). Like the importing
+  /// case, the module-level block is then only indexed and individual records
+  /// are loaded on-demand when a function referencing them is materialized.
+  bool ShouldLazyLoadMetadata = false;
+
   Error parseOneMetadata(SmallVectorImpl<uint64_t> &Record, unsigned Code,
                          PlaceholderQueue &Placeholders, StringRef Blob,
                          unsigned &NextMetadataNo);
@@ -542,10 +548,11 @@ public:
   MetadataLoaderImpl(BitstreamCursor &Stream, Module &TheModule,
                      BitcodeReaderValueList &ValueList,
                      std::function<Type *(unsigned)> getTypeByID,
-                     bool IsImporting)
+                     bool IsImporting, bool ShouldLazyLoadMetadata)
       : MetadataList(TheModule.getContext()), ValueList(ValueList),
         Stream(Stream), Context(TheModule.getContext()), TheModule(TheModule),
-        getTypeByID(std::move(getTypeByID)), IsImporting(IsImporting) {}
+        getTypeByID(std::move(getTypeByID)), IsImporting(IsImporting),
+        ShouldLazyLoadMetadata(ShouldLazyLoadMetadata) {}
 
   Error parseMetadata(bool ModuleLevel);
 
@@ -776,10 +783,14 @@ Error MetadataLoader::MetadataLoaderImpl::parseMetadata(bool ModuleLevel) {
   SmallVector<uint64_t, 64> Record;
   PlaceholderQueue Placeholders;
 
-  // We lazy-load module-level metadata: we build an index for each record, and
-  // then load individual record as needed, starting with the named metadata.
-  if (ModuleLevel && IsImporting && MetadataList.empty() &&
-      !DisableLazyLoading) {
+  // We lazy-load module-level metadata when importing for ThinLTO or when the
+  // client requested a lazy metadata loading: we build an index for each
+  // record, and then load individual record as needed, starting with the named
+  // metadata. Metadata never referenced from named metadata, a global object
+  // attachment, or a materialized function is not loaded at all, which is what
+  // keeps thin-link module opens cheap for debug-info heavy modules.
+  if (ModuleLevel && (IsImporting || ShouldLazyLoadMetadata) &&
+      MetadataList.empty() && !DisableLazyLoading) {
     auto SuccessOrErr = lazyLoadModuleMetadataBlock();
     if (!SuccessOrErr)
       return SuccessOrErr.takeError();
@@ -1861,10 +1872,11 @@ MetadataLoader::MetadataLoader(MetadataLoader &&RHS)
 MetadataLoader::~MetadataLoader() = default;
 MetadataLoader::MetadataLoader(BitstreamCursor &Stream, Module &TheModule,
                                BitcodeReaderValueList &ValueList,
-                               bool IsImporting,
+                               bool IsImporting, bool ShouldLazyLoadMetadata,
                                std::function<Type *(unsigned)> getTypeByID)
     : Pimpl(llvm::make_unique<MetadataLoaderImpl>(
-          Stream, TheModule, ValueList, std::move(getTypeByID), IsImporting)) {}
+          Stream, TheModule, ValueList, std::move(getTypeByID), IsImporting,
+          ShouldLazyLoadMetadata)) {}
 
 Error MetadataLoader::parseMetadata(bool ModuleLevel) {
   return Pimpl->parseMetadata(ModuleLevel);
@@ -29,6 +29,9 @@
 #include "llvm/IR/UseListOrder.h"
 #include "llvm/IR/ValueSymbolTable.h"
 #include "llvm/MC/StringTableBuilder.h"
+#include "llvm/Support/Compression.h"
+#include "llvm/Support/Endian.h"
+#include "llvm/Support/Error.h"
 #include "llvm/Support/ErrorHandling.h"
 #include "llvm/Support/MathExtras.h"
 #include "llvm/Support/Program.h"
@@ -3979,6 +3982,67 @@ void llvm::WriteBitcodeToFile(const Module *M, raw_ostream &Out,
   Out.write((char*)&Buffer.front(), Buffer.size());
 }
 
+/// WriteBitcodeToMemoryBuffer - Serialize the specified module into a
+/// self-contained memory buffer that can be consumed on another thread while
+/// IR building continues on the live module.
+std::unique_ptr<MemoryBuffer>
+llvm::WriteBitcodeToMemoryBuffer(const Module *M,
+                                 bool ShouldPreserveUseListOrder,
+                                 const ModuleSummaryIndex *Index,
+                                 bool GenerateHash, ModuleHash *ModHash) {
+  SmallVector<char, 0> Bitcode;
+  {
+    raw_svector_ostream BitcodeOS(Bitcode);
+    WriteBitcodeToFile(M, BitcodeOS, ShouldPreserveUseListOrder, Index,
+                       GenerateHash, ModHash);
+  }
+
+  std::unique_ptr<MemoryBuffer> Result = MemoryBuffer::getNewUninitMemBuffer(
+      Bitcode.size(), M->getModuleIdentifier());
+  if (Result)
+    memcpy(const_cast<char *>(Result->getBufferStart()), Bitcode.data(),
+           Bitcode.size());
+  return Result;
+}
+
+/// WriteCompressedBitcodeToFile - Write the specified module to the specified
+/// output stream as a compressed bitcode container: the magic bytes
+/// 'B' 'C' 'Z' 0x01, the little-endian 64-bit uncompressed size, and a single
+/// zlib stream holding ordinary bitcode.
+void llvm::WriteCompressedBitcodeToFile(const Module *M, raw_ostream &Out,
+                                        bool ShouldPreserveUseListOrder,
+                                        const ModuleSummaryIndex *Index,
+                                        bool GenerateHash, ModuleHash *ModHash) {
+  SmallVector<char, 0> Bitcode;
+  {
+    raw_svector_ostream BitcodeOS(Bitcode);
+    WriteBitcodeToFile(M, BitcodeOS, ShouldPreserveUseListOrder, Index,
+                       GenerateHash, ModHash);
+  }
+
+  SmallVector<char, 0> Compressed;
+  if (zlib::isAvailable()) {
+    if (Error E = zlib::compress(StringRef(Bitcode.data(), Bitcode.size()),
+                                 Compressed, zlib::DefaultCompression)) {
+      consumeError(std::move(E));
+      Compressed.clear();
+    }
+  }
+
+  // If zlib is unavailable, compression failed, or the compressed stream is
+  // not actually smaller than the bitcode, fall back to plain bitcode.
+  // Readers distinguish the two forms by their magic bytes.
+  if (Compressed.empty() || Compressed.size() + 12 >= Bitcode.size()) {
+    Out.write(Bitcode.data(), Bitcode.size());
+    return;
+  }
+
+  char Header[12] = {'B', 'C', 'Z', 0x01};
+  support::endian::write64le(Header + 4, Bitcode.size());
+  Out.write(Header, sizeof(Header));
+  Out.write(Compressed.data(), Compressed.size());
+}
+
 void IndexBitcodeWriter::write() {
   Stream.EnterSubblock(bitc::MODULE_BLOCK_ID, 3);
 
@@ -25,6 +25,16 @@ class StringRef;
 // Collection of strings for this unit and assorted symbols.
 // A String->Symbol mapping of strings used by indirect
 // references.
+//
+// Note on sharing across modules: a read-only pool pre-seeded from a previous
+// build's .debug_str has been proposed to stop parallel codegen partitions
+// from re-interning the same type names. It does not fit this design: every
+// entry carries a module-local offset and MCSymbol, DwarfStringPoolEntryRef
+// is a pointer into this map's StringMapEntry storage, and an offset into a
+// previous build's .debug_str is only meaningful if the final link reproduces
+// that exact section prefix, which nothing here can guarantee. Duplicate
+// bytes across partitions are instead deduplicated at link time via the
+// SHF_MERGE|SHF_STRINGS flags on .debug_str.
 class DwarfStringPool {
   typedef DwarfStringPoolEntry EntryTy;
   StringMap<EntryTy, BumpPtrAllocator &> Pool;
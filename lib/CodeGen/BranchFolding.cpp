@@ -68,6 +68,14 @@ TailMergeSize("tail-merge-size",
           cl::desc("Min number of instructions to consider tail merging"),
                               cl::init(3), cl::Hidden);
 
+// Depth of the per-block suffix fingerprints used to prune merge candidate
+// pairs before comparing their instructions. 0 disables the prefilter.
+static cl::opt<unsigned>
+TailMergeHashDepth("tail-merge-hash-depth",
+          cl::desc("Max number of tail instructions to fingerprint when "
+                   "pruning tail merge candidates"),
+          cl::init(16), cl::Hidden);
+
 namespace {
   /// BranchFolderPass - Wrap branch folder in a machine function pass.
   class BranchFolderPass : public MachineFunctionPass {
@@ -270,6 +278,39 @@ static unsigned HashEndOfMBB(const MachineBasicBlock &MBB) {
   return HashMachineInstr(*I);
 }
 
+/// HashTailSuffixes - Compute rolling fingerprints of the tail of MBB:
+/// Hashes[N-1] covers the last N non-debug instructions. Two blocks whose
+/// tails agree on their last N instructions agree on their first N
+/// fingerprints, so a fingerprint mismatch at depth N proves their common
+/// tail is shorter than N. At most Depth fingerprints are computed.
+static void HashTailSuffixes(const MachineBasicBlock &MBB, unsigned Depth,
+                             SmallVectorImpl<unsigned> &Hashes) {
+  unsigned Hash = 0;
+  for (MachineBasicBlock::const_reverse_iterator I = MBB.rbegin(),
+                                                 E = MBB.rend();
+       I != E && Hashes.size() < Depth; ++I) {
+    if (I->isDebugValue())
+      continue;
+    // ComputeCommonTailLength never matches across an inline asm, so ending
+    // the fingerprints here keeps the bound below conservative.
+    if (I->isInlineAsm())
+      break;
+    Hash = Hash * 31 + HashMachineInstr(*I);
+    Hashes.push_back(Hash);
+  }
+}
+
+/// CommonTailBound - Given the suffix fingerprints of two blocks, return an
+/// upper bound on the length of their common tail, or ~0U if the fingerprints
+/// agree to their full common depth and nothing can be concluded.
+static unsigned CommonTailBound(ArrayRef<unsigned> H1, ArrayRef<unsigned> H2) {
+  unsigned N = std::min(H1.size(), H2.size());
+  for (unsigned i = N; i != 0; --i)
+    if (H1[i - 1] == H2[i - 1])
+      return i == N ? ~0U : i;
+  return 0;
+}
+
 /// ComputeCommonTailLength - Given two machine basic blocks, compute the number
 /// of instructions they actually have in common together at their end.  Return
 /// iterators for the first shared instruction in each block.
@@ -647,14 +688,53 @@ unsigned BranchFolder::ComputeSameTails(unsigned CurHash,
                                         MachineBasicBlock *PredBB) {
   unsigned maxCommonTailLength = 0U;
   SameTails.clear();
+
+  // The pairwise loop below is quadratic in the number of blocks sharing
+  // CurHash, and that hash only covers the last instruction, so functions
+  // with many similar exit blocks pay for full instruction walks over pairs
+  // that share nothing but e.g. a return. Fingerprint a bounded suffix of
+  // each candidate once up front so such pairs can be rejected in constant
+  // time; only pairs whose fingerprints allow a long enough tail are
+  // verified with ProfitableToMerge.
+  DenseMap<const MachineBasicBlock *, SmallVector<unsigned, 16>> SuffixHashes;
+  if (TailMergeHashDepth)
+    for (MPIterator CurMPIter = std::prev(MergePotentials.end()),
+                    B = MergePotentials.begin();
+         CurMPIter->getHash() == CurHash; --CurMPIter) {
+      HashTailSuffixes(*CurMPIter->getBlock(), TailMergeHashDepth,
+                       SuffixHashes[CurMPIter->getBlock()]);
+      if (CurMPIter == B)
+        break;
+    }
+  bool OptForSize =
+      MergePotentials.back().getBlock()->getParent()->getFunction()
+          ->optForSize();
+
   MachineBasicBlock::iterator TrialBBI1, TrialBBI2;
   MPIterator HighestMPIter = std::prev(MergePotentials.end());
   for (MPIterator CurMPIter = std::prev(MergePotentials.end()),
                   B = MergePotentials.begin();
        CurMPIter != B && CurMPIter->getHash() == CurHash; --CurMPIter) {
     for (MPIterator I = std::prev(CurMPIter); I->getHash() == CurHash; --I) {
+      bool Plausible = true;
+      if (TailMergeHashDepth) {
+        unsigned Bound = CommonTailBound(SuffixHashes[CurMPIter->getBlock()],
+                                         SuffixHashes[I->getBlock()]);
+        if (Bound == 0)
+          // Even the last instructions differ; never profitable.
+          Plausible = false;
+        else if (Bound != ~0U && Bound + 1 < MinCommonTailLength &&
+                 CurMPIter->getBlock() != PredBB && I->getBlock() != PredBB &&
+                 !OptForSize)
+          // The +1 accounts for a temporarily stripped unconditional branch.
+          // Blocks that can fall through into the common successor merge
+          // tails of any length, and at optsize two common instructions can
+          // suffice, so only the general threshold is prechecked.
+          Plausible = false;
+      }
       unsigned CommonTailLen;
-      if (ProfitableToMerge(CurMPIter->getBlock(), I->getBlock(),
+      if (Plausible &&
+          ProfitableToMerge(CurMPIter->getBlock(), I->getBlock(),
                             MinCommonTailLength,
                             CommonTailLen, TrialBBI1, TrialBBI2,
                             SuccBB, PredBB,
@@ -84,6 +84,7 @@ class BranchRelaxation : public MachineFunctionPass {
   MachineBasicBlock *splitBlockBeforeInstr(MachineInstr &MI,
                                            MachineBasicBlock *DestBB);
   void adjustBlockOffsets(MachineBasicBlock &MBB);
+  void adjustSuccessorBlockOffset(MachineBasicBlock &MBB);
   bool isBlockInRange(const MachineInstr &MI, const MachineBasicBlock &BB) const;
 
   bool fixupConditionalBranch(MachineInstr &MI);
@@ -196,6 +197,19 @@ void BranchRelaxation::adjustBlockOffsets(MachineBasicBlock &Start) {
   }
 }
 
+/// Update the offset of just the layout successor of \p MBB after \p MBB's
+/// size changed. Relaxation only ever inserts code at the block being
+/// scanned, so this covers every block a fixup can re-examine in the same
+/// pass; the re-layout of the rest of the function is deferred to the
+/// running scan in relaxBranchInstructions, keeping each relaxation O(1)
+/// instead of walking to the end of the function.
+void BranchRelaxation::adjustSuccessorBlockOffset(MachineBasicBlock &MBB) {
+  MachineFunction::iterator Next = std::next(MachineFunction::iterator(MBB));
+  if (Next != MF->end())
+    BlockInfo[Next->getNumber()].Offset =
+        BlockInfo[MBB.getNumber()].postOffset(*Next);
+}
+
   /// Insert a new empty basic block and insert it after \BB
 MachineBasicBlock *BranchRelaxation::createNewBlockAfter(MachineBasicBlock &BB) {
   // Create a new MBB for the code after the OrigBB.
@@ -254,8 +268,9 @@ MachineBasicBlock *BranchRelaxation::splitBlockBeforeInstr(MachineInstr &MI,
   // block, it may contain a tablejump.
   BlockInfo[NewBB->getNumber()].Size = computeBlockSize(*NewBB);
 
-  // All BBOffsets following these blocks must be modified.
-  adjustBlockOffsets(*OrigBB);
+  // The offsets following these blocks are updated by the running scan in
+  // relaxBranchInstructions; only the new block needs fixing here.
+  adjustSuccessorBlockOffset(*OrigBB);
 
   // Need to fix live-in lists if we track liveness.
   if (TRI->trackLivenessAfterRegAlloc(*MF))
@@ -367,8 +382,9 @@ bool BranchRelaxation::fixupConditionalBranch(MachineInstr &MI) {
   TII->insertBranch(*MBB, &NextBB, TBB, Cond, DL, &AddedSize);
   MBBSize += AddedSize;
 
-  // Finally, keep the block offsets up to date.
-  adjustBlockOffsets(*MBB);
+  // Finally, keep the offset of the fall-through block up to date; blocks
+  // further out are re-laid out by the running scan.
+  adjustSuccessorBlockOffset(*MBB);
   return true;
 }
 
@@ -408,7 +424,7 @@ bool BranchRelaxation::fixupUnconditionalBranch(MachineInstr &MI) {
   BlockInfo[BranchBB->getNumber()].Size += TII->insertIndirectBranch(
     *BranchBB, *DestBB, DL, DestOffset - SrcOffset, RS.get());
 
-  adjustBlockOffsets(*MBB);
+  adjustSuccessorBlockOffset(*MBB);
   return true;
 }
 
@@ -417,9 +433,21 @@ bool BranchRelaxation::relaxBranchInstructions() {
 
   // Relaxing branches involves creating new basic blocks, so re-eval
   // end() for termination.
+  unsigned PrevNum = MF->begin()->getNumber();
   for (MachineFunction::iterator I = MF->begin(); I != MF->end(); ++I) {
     MachineBasicBlock &MBB = *I;
 
+    // Bring this block's offset up to date before examining its branches.
+    // Fixups earlier in this pass grew earlier blocks and only re-laid out
+    // their immediate layout successor; this running scan re-lays out each
+    // block as it is reached. Offsets of blocks ahead of the scan may
+    // therefore be stale (too small): a branch left alone because of a stale
+    // destination offset is caught on the next pass, and the pass that makes
+    // no changes sees every offset exact.
+    if (I != MF->begin())
+      BlockInfo[MBB.getNumber()].Offset = BlockInfo[PrevNum].postOffset(MBB);
+    PrevNum = MBB.getNumber();
+
     // Empty block?
     MachineBasicBlock::iterator Last = MBB.getLastNonDebugInstr();
     if (Last == MBB.end())
@@ -33,7 +33,8 @@ CriticalAntiDepBreaker::CriticalAntiDepBreaker(MachineFunction &MFi,
       TII(MF.getSubtarget().getInstrInfo()),
       TRI(MF.getSubtarget().getRegisterInfo()), RegClassInfo(RCI),
       Classes(TRI->getNumRegs(), nullptr), KillIndices(TRI->getNumRegs(), 0),
-      DefIndices(TRI->getNumRegs(), 0), KeepRegs(TRI->getNumRegs(), false) {}
+      DefIndices(TRI->getNumRegs(), 0), KeepRegs(TRI->getNumRegs(), false),
+      ClobberedRegs(TRI->getNumRegs(), false) {}
 
 CriticalAntiDepBreaker::~CriticalAntiDepBreaker() {
 }
@@ -248,15 +249,21 @@ void CriticalAntiDepBreaker::ScanInstruction(MachineInstr &MI, unsigned Count) {
     for (unsigned i = 0, e = MI.getNumOperands(); i != e; ++i) {
       MachineOperand &MO = MI.getOperand(i);
 
-      if (MO.isRegMask())
-        for (unsigned i = 0, e = TRI->getNumRegs(); i != e; ++i)
-          if (MO.clobbersPhysReg(i)) {
-            DefIndices[i] = Count;
-            KillIndices[i] = ~0u;
-            KeepRegs.reset(i);
-            Classes[i] = nullptr;
-            RegRefs.erase(i);
-          }
+      if (MO.isRegMask()) {
+        // Expand the mask word-parallel and then walk only the clobbered
+        // registers, rather than probing the mask once for each of the
+        // target's registers.
+        ClobberedRegs.reset();
+        ClobberedRegs.setBitsNotInMask(MO.getRegMask());
+        for (int i = ClobberedRegs.find_first(); i != -1;
+             i = ClobberedRegs.find_next(i)) {
+          DefIndices[i] = Count;
+          KillIndices[i] = ~0u;
+          KeepRegs.reset(i);
+          Classes[i] = nullptr;
+          RegRefs.erase(i);
+        }
+      }
 
       if (!MO.isReg()) continue;
       unsigned Reg = MO.getReg();
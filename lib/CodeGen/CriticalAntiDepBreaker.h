@@ -65,6 +65,10 @@ class LLVM_LIBRARY_VISIBILITY CriticalAntiDepBreaker : public AntiDepBreaker {
     /// break anti-dependencies.
     BitVector KeepRegs;
 
+    /// Scratch set used to expand a register mask operand into the registers
+    /// it clobbers without probing the mask once per register.
+    BitVector ClobberedRegs;
+
   public:
     CriticalAntiDepBreaker(MachineFunction& MFi, const RegisterClassInfo&);
     ~CriticalAntiDepBreaker() override;
@@ -13,6 +13,7 @@
 
 #include "InterferenceCache.h"
 #include "llvm/CodeGen/LiveIntervalAnalysis.h"
+#include "llvm/Support/CommandLine.h"
 #include "llvm/Support/ErrorHandling.h"
 #include "llvm/Target/TargetRegisterInfo.h"
 
@@ -20,6 +21,10 @@ using namespace llvm;
 
 #define DEBUG_TYPE "regalloc"
 
+static cl::opt<unsigned> InterferenceCacheBudget(
+    "interference-cache-budget", cl::Hidden, cl::init(8192),
+    cl::desc("Memory budget in KB for the per-block interference cache"));
+
 // Static member used for null interference cursors.
 const InterferenceCache::BlockInterference
     InterferenceCache::Cursor::NoInterference;
@@ -36,8 +41,8 @@ void InterferenceCache::reinitPhysRegEntries() {
   if (PhysRegEntriesCount == TRI->getNumRegs()) return;
   free(PhysRegEntries);
   PhysRegEntriesCount = TRI->getNumRegs();
-  PhysRegEntries = (unsigned char*)
-    calloc(PhysRegEntriesCount, sizeof(unsigned char));
+  PhysRegEntries = (uint16_t*)
+    calloc(PhysRegEntriesCount, sizeof(uint16_t));
 }
 
 void InterferenceCache::init(MachineFunction *mf,
@@ -49,25 +54,50 @@ void InterferenceCache::init(MachineFunction *mf,
   LIUArray = liuarray;
   TRI = tri;
   reinitPhysRegEntries();
-  for (unsigned i = 0; i != CacheEntries; ++i)
+
+  // Size the cache to the memory budget. Each entry keeps a BlockInterference
+  // per basic block, so entries get more expensive as functions grow: with
+  // more entries than the budget allows, a huge function would pay more in
+  // cache memory than it saves in recomputation. Small functions get an entry
+  // for every physreg instead of thrashing a fixed-size cache. Never go below
+  // the historical fixed size, so the guaranteed cursor count is unchanged,
+  // and never exceed what a PhysRegEntries index can address.
+  uint64_t EntryBytes =
+      sizeof(Entry) + uint64_t(MF->getNumBlockIDs()) * sizeof(BlockInterference);
+  uint64_t BudgetedEntries = uint64_t(InterferenceCacheBudget) * 1024 / EntryBytes;
+  unsigned MaxEntries =
+      std::min<unsigned>(std::max<unsigned>(MinCacheEntries, TRI->getNumRegs()),
+                         UINT16_MAX);
+  unsigned NewSize = std::max<uint64_t>(
+      MinCacheEntries, std::min<uint64_t>(BudgetedEntries, MaxEntries));
+  if (NewSize != Entries.size()) {
+    // No cursors are live between functions, so the entries can move. Stale
+    // PhysRegEntries indexes are rejected by the PhysReg check in get().
+    Entries.clear();
+    Entries.resize(NewSize);
+    RoundRobin = 0;
+  }
+
+  for (unsigned i = 0, e = Entries.size(); i != e; ++i)
     Entries[i].clear(mf, indexes, lis);
 }
 
 InterferenceCache::Entry *InterferenceCache::get(unsigned PhysReg) {
+  unsigned NumEntries = Entries.size();
   unsigned E = PhysRegEntries[PhysReg];
-  if (E < CacheEntries && Entries[E].getPhysReg() == PhysReg) {
+  if (E < NumEntries && Entries[E].getPhysReg() == PhysReg) {
     if (!Entries[E].valid(LIUArray, TRI))
       Entries[E].revalidate(LIUArray, TRI);
     return &Entries[E];
   }
   // No valid entry exists, pick the next round-robin entry.
   E = RoundRobin;
-  if (++RoundRobin == CacheEntries)
+  if (++RoundRobin == NumEntries)
     RoundRobin = 0;
-  for (unsigned i = 0; i != CacheEntries; ++i) {
+  for (unsigned i = 0; i != NumEntries; ++i) {
     // Skip entries that are in use.
     if (Entries[E].hasRefs()) {
-      if (++E == CacheEntries)
+      if (++E == NumEntries)
         E = 0;
       continue;
     }
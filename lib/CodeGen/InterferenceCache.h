@@ -16,6 +16,8 @@
 #define LLVM_LIB_CODEGEN_INTERFERENCECACHE_H
 
 #include "llvm/CodeGen/LiveIntervalUnion.h"
+#include <cstdint>
+#include <vector>
 
 namespace llvm {
 
@@ -129,21 +131,24 @@ class LLVM_LIBRARY_VISIBILITY InterferenceCache {
     }
   };
 
-  // We don't keep a cache entry for every physical register, that would use too
-  // much memory. Instead, a fixed number of cache entries are used in a round-
-  // robin manner.
-  enum { CacheEntries = 32 };
+  // We don't keep a cache entry for every physical register, that would use
+  // too much memory. Instead, a limited number of cache entries are used in a
+  // round-robin manner. The number of entries is sized per function from a
+  // memory budget, since each entry keeps a BlockInterference per basic block,
+  // but never drops below this minimum.
+  enum { MinCacheEntries = 32 };
 
   // Point to an entry for each physreg. The entry pointed to may not be up to
   // date, and it may have been reused for a different physreg.
-  unsigned char* PhysRegEntries;
+  uint16_t* PhysRegEntries;
   size_t PhysRegEntriesCount;
 
   // Next round-robin entry to be picked.
   unsigned RoundRobin;
 
-  // The actual cache entries.
-  Entry Entries[CacheEntries];
+  // The actual cache entries. Sized by init() for the current function; only
+  // resized when no cursors refer into the cache.
+  std::vector<Entry> Entries;
 
   // get - Get a valid entry for PhysReg.
   Entry *get(unsigned PhysReg);
@@ -165,7 +170,7 @@ public:
 
   /// getMaxCursors - Return the maximum number of concurrent cursors that can
   /// be supported.
-  unsigned getMaxCursors() const { return CacheEntries; }
+  unsigned getMaxCursors() const { return Entries.size(); }
 
   /// Cursor - The primary query interface for the block interference cache.
   class Cursor {
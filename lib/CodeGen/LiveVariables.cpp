@@ -27,6 +27,7 @@
 //===----------------------------------------------------------------------===//
 
 #include "llvm/CodeGen/LiveVariables.h"
+#include "llvm/ADT/BitVector.h"
 #include "llvm/ADT/DepthFirstIterator.h"
 #include "llvm/ADT/STLExtras.h"
 #include "llvm/ADT/SmallPtrSet.h"
@@ -420,6 +421,12 @@ bool LiveVariables::HandlePhysRegKill(unsigned Reg, MachineInstr *MI) {
 }
 
 void LiveVariables::HandleRegMask(const MachineOperand &MO) {
+  // Expand the mask to a bit per register up front, word-parallel, so the
+  // scan below (and its super-register walk) tests single bits instead of
+  // probing the mask for each register again.
+  BitVector Clobbered(TRI->getNumRegs());
+  Clobbered.setBitsNotInMask(MO.getRegMask());
+
   // Call HandlePhysRegKill() for all live registers clobbered by Mask.
   // Clobbered registers are always dead, sp there is no need to use
   // HandlePhysRegDef().
@@ -428,13 +435,13 @@ void LiveVariables::HandleRegMask(const MachineOperand &MO) {
     if (!PhysRegDef[Reg] && !PhysRegUse[Reg])
       continue;
     // Skip mask-preserved regs.
-    if (!MO.clobbersPhysReg(Reg))
+    if (!Clobbered.test(Reg))
       continue;
     // Kill the largest clobbered super-register.
     // This avoids needless implicit operands.
     unsigned Super = Reg;
     for (MCSuperRegIterator SR(Reg, TRI); SR.isValid(); ++SR)
-      if ((PhysRegDef[*SR] || PhysRegUse[*SR]) && MO.clobbersPhysReg(*SR))
+      if ((PhysRegDef[*SR] || PhysRegUse[*SR]) && Clobbered.test(*SR))
         Super = *SR;
     HandlePhysRegKill(Super, nullptr);
   }
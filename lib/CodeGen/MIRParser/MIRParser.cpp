@@ -20,6 +20,7 @@
 #include "llvm/ADT/StringRef.h"
 #include "llvm/AsmParser/Parser.h"
 #include "llvm/AsmParser/SlotMapping.h"
+#include "llvm/CodeGen/BinaryMIRFormat.h"
 #include "llvm/CodeGen/GlobalISel/RegisterBank.h"
 #include "llvm/CodeGen/GlobalISel/RegisterBankInfo.h"
 #include "llvm/CodeGen/MIRYamlMapping.h"
@@ -53,6 +54,10 @@ class MIRParserImpl {
   StringRef Filename;
   LLVMContext &Context;
   StringMap<std::unique_ptr<yaml::MachineFunction>> Functions;
+  /// Maps from function names to the still unparsed machine function bodies
+  /// of a binary MIR container. Entries migrate to \c Functions when the
+  /// corresponding machine function is materialized.
+  StringMap<StringRef> LazyBodies;
   SlotMapping IRSlots;
   /// Maps from register class names to register classes.
   Name2RegClassMap Names2RegClasses;
@@ -96,6 +101,21 @@ public:
   /// Return true if an error occurred.
   bool parseMachineFunction(yaml::Input &In, Module &M, bool NoLLVMIR);
 
+  /// Parse a binary MIR container in place.
+  ///
+  /// The embedded LLVM IR is parsed eagerly; machine function bodies are only
+  /// indexed here and stay unparsed until the corresponding function is
+  /// materialized.
+  ///
+  /// Return null if an error occurred.
+  std::unique_ptr<Module> parseBinary(StringRef Contents);
+
+  /// Parse a machine function body slice of a binary MIR container into
+  /// \c Functions.
+  ///
+  /// Return true if an error occurred.
+  bool parseLazyMachineFunction(StringRef Body);
+
   /// Initialize the machine function to the state that's described in the MIR
   /// file.
   ///
@@ -211,6 +231,11 @@ static void handleYAMLDiag(const SMDiagnostic &Diag, void *Context) {
 }
 
 std::unique_ptr<Module> MIRParserImpl::parse() {
+  StringRef Contents = SM.getMemoryBuffer(SM.getMainFileID())->getBuffer();
+  if (Contents.size() >= sizeof(bmir::Header) &&
+      Contents.startswith(StringRef(bmir::Magic, sizeof(bmir::Magic))))
+    return parseBinary(Contents);
+
   yaml::Input In(SM.getMemoryBuffer(SM.getMainFileID())->getBuffer(),
                  /*Ctxt=*/nullptr, handleYAMLDiag, this);
   In.setContext(&In);
@@ -274,6 +299,93 @@ bool MIRParserImpl::parseMachineFunction(yaml::Input &In, Module &M,
   return false;
 }
 
+std::unique_ptr<Module> MIRParserImpl::parseBinary(StringRef Contents) {
+  const auto *H = reinterpret_cast<const bmir::Header *>(Contents.data());
+  if (H->Version != bmir::CurrentVersion) {
+    error(Twine("unsupported binary MIR version ") +
+          Twine(uint32_t(H->Version)));
+    return nullptr;
+  }
+  auto InBounds = [&](uint64_t Offset, uint64_t Size) {
+    return Offset <= Contents.size() && Size <= Contents.size() - Offset;
+  };
+  if (!InBounds(H->IROffset, H->IRSize) ||
+      !InBounds(H->StrTabOffset, H->StrTabSize) ||
+      H->NumFunctions > Contents.size() / sizeof(bmir::FunctionRecord) ||
+      !InBounds(H->IndexOffset,
+                H->NumFunctions * sizeof(bmir::FunctionRecord))) {
+    error("truncated binary MIR file");
+    return nullptr;
+  }
+
+  std::unique_ptr<Module> M;
+  bool NoLLVMIR = false;
+  if (H->IRSize != 0) {
+    SMDiagnostic Error;
+    M = parseAssembly(
+        MemoryBufferRef(Contents.substr(H->IROffset, H->IRSize), Filename),
+        Error, Context, &IRSlots);
+    if (!M) {
+      reportDiagnostic(Error);
+      return nullptr;
+    }
+  } else {
+    M = llvm::make_unique<Module>(Filename, Context);
+    NoLLVMIR = true;
+  }
+
+  // Index the machine functions without parsing their bodies; the bodies are
+  // independent slices that initializeMachineFunction parses on demand.
+  StringRef StrTab = Contents.substr(H->StrTabOffset, H->StrTabSize);
+  const auto *Index =
+      reinterpret_cast<const bmir::FunctionRecord *>(Contents.data() +
+                                                     H->IndexOffset);
+  for (uint64_t I = 0, E = H->NumFunctions; I != E; ++I) {
+    const bmir::FunctionRecord &R = Index[I];
+    if (R.NameOffset > StrTab.size() ||
+        R.NameSize > StrTab.size() - R.NameOffset ||
+        !InBounds(R.BodyOffset, R.BodySize)) {
+      error("truncated binary MIR file");
+      return nullptr;
+    }
+    StringRef Name = StrTab.substr(R.NameOffset, R.NameSize);
+    if (!LazyBodies
+             .insert(std::make_pair(Name,
+                                    Contents.substr(R.BodyOffset, R.BodySize)))
+             .second) {
+      error(Twine("redefinition of machine function '") + Name + "'");
+      return nullptr;
+    }
+    if (NoLLVMIR)
+      createDummyFunction(Name, *M);
+    else if (!M->getFunction(Name)) {
+      error(Twine("function '") + Name +
+            "' isn't defined in the provided LLVM IR");
+      return nullptr;
+    }
+  }
+  return M;
+}
+
+bool MIRParserImpl::parseLazyMachineFunction(StringRef Body) {
+  yaml::Input In(Body, /*Ctxt=*/nullptr, handleYAMLDiag, this);
+  In.setContext(&In);
+  if (!In.setCurrentDocument())
+    return In.error() ? true
+                      : error("empty machine function body in binary MIR file");
+  auto MF = llvm::make_unique<yaml::MachineFunction>();
+  yaml::EmptyContext Ctx;
+  yaml::yamlize(In, *MF, false, Ctx);
+  if (In.error())
+    return true;
+  auto FunctionName = MF->Name;
+  if (Functions.find(FunctionName) != Functions.end())
+    return error(Twine("redefinition of machine function '") + FunctionName +
+                 "'");
+  Functions.insert(std::make_pair(FunctionName, std::move(MF)));
+  return false;
+}
+
 void MIRParserImpl::createDummyFunction(StringRef Name, Module &M) {
   auto &Context = M.getContext();
   Function *F = cast<Function>(M.getOrInsertFunction(
@@ -321,9 +433,18 @@ void MIRParserImpl::computeFunctionProperties(MachineFunction &MF) {
 
 bool MIRParserImpl::initializeMachineFunction(MachineFunction &MF) {
   auto It = Functions.find(MF.getName());
-  if (It == Functions.end())
-    return error(Twine("no machine function information for function '") +
-                 MF.getName() + "' in the MIR file");
+  if (It == Functions.end()) {
+    auto BodyIt = LazyBodies.find(MF.getName());
+    if (BodyIt == LazyBodies.end())
+      return error(Twine("no machine function information for function '") +
+                   MF.getName() + "' in the MIR file");
+    if (parseLazyMachineFunction(BodyIt->getValue()))
+      return true;
+    It = Functions.find(MF.getName());
+    if (It == Functions.end())
+      return error(Twine("machine function body for '") + MF.getName() +
+                   "' names a different function");
+  }
   // TODO: Recreate the machine function.
   initNames2RegClasses(MF);
   initNames2RegBanks(MF);
@@ -13,14 +13,26 @@
 //===----------------------------------------------------------------------===//
 
 #include "MIRPrinter.h"
+#include "llvm/CodeGen/BinaryMIRFormat.h"
 #include "llvm/CodeGen/Passes.h"
 #include "llvm/CodeGen/MachineFunctionPass.h"
 #include "llvm/CodeGen/MIRYamlMapping.h"
+#include "llvm/Support/CommandLine.h"
 #include "llvm/Support/Debug.h"
 #include "llvm/Support/raw_ostream.h"
+#include <cstring>
 
 using namespace llvm;
 
+/// Write the machine functions into the binary MIR container instead of a
+/// stream of YAML documents. The container fronts the same per-function
+/// serialization with a function index and a string table, so the parser can
+/// materialize single functions out of a memory mapped file without scanning
+/// the whole module.
+static cl::opt<bool>
+    BinaryMIR("binary-mir", cl::Hidden, cl::init(false),
+              cl::desc("Print machine functions into a binary MIR container"));
+
 namespace {
 
 /// This pass prints out the LLVM IR to an output stream using the MIR
@@ -29,6 +41,8 @@ struct MIRPrintingPass : public MachineFunctionPass {
   static char ID;
   raw_ostream &OS;
   std::string MachineFunctions;
+  /// The (name, serialized body) pairs collected for the binary container.
+  std::vector<std::pair<std::string, std::string>> BinaryFunctions;
 
   MIRPrintingPass() : MachineFunctionPass(ID), OS(dbgs()) {}
   MIRPrintingPass(raw_ostream &OS) : MachineFunctionPass(ID), OS(OS) {}
@@ -44,15 +58,68 @@ struct MIRPrintingPass : public MachineFunctionPass {
     std::string Str;
     raw_string_ostream StrOS(Str);
     printMIR(StrOS, MF);
-    MachineFunctions.append(StrOS.str());
+    if (BinaryMIR)
+      BinaryFunctions.emplace_back(MF.getName(), StrOS.str());
+    else
+      MachineFunctions.append(StrOS.str());
     return false;
   }
 
   bool doFinalization(Module &M) override {
+    if (BinaryMIR) {
+      writeBinaryMIR(M);
+      return false;
+    }
     printMIR(OS, M);
     OS << MachineFunctions;
     return false;
   }
+
+  /// Lay out and emit the binary MIR container: header, function index,
+  /// string table, textual LLVM IR, machine function bodies.
+  void writeBinaryMIR(Module &M) {
+    std::string IR;
+    raw_string_ostream IROS(IR);
+    M.print(IROS, /*AAW=*/nullptr);
+    IROS.flush();
+
+    std::string StrTab;
+    std::vector<bmir::FunctionRecord> Index(BinaryFunctions.size());
+    for (size_t I = 0, E = BinaryFunctions.size(); I != E; ++I) {
+      Index[I].NameOffset = StrTab.size();
+      Index[I].NameSize = BinaryFunctions[I].first.size();
+      StrTab += BinaryFunctions[I].first;
+    }
+
+    uint64_t IndexOffset = sizeof(bmir::Header);
+    uint64_t StrTabOffset =
+        IndexOffset + Index.size() * sizeof(bmir::FunctionRecord);
+    uint64_t IROffset = StrTabOffset + StrTab.size();
+    uint64_t BodyOffset = IROffset + IR.size();
+    for (size_t I = 0, E = BinaryFunctions.size(); I != E; ++I) {
+      Index[I].BodyOffset = BodyOffset;
+      Index[I].BodySize = BinaryFunctions[I].second.size();
+      BodyOffset += BinaryFunctions[I].second.size();
+    }
+
+    bmir::Header H;
+    std::memcpy(H.Magic, bmir::Magic, sizeof(H.Magic));
+    H.Version = bmir::CurrentVersion;
+    H.IROffset = IROffset;
+    H.IRSize = IR.size();
+    H.StrTabOffset = StrTabOffset;
+    H.StrTabSize = StrTab.size();
+    H.IndexOffset = IndexOffset;
+    H.NumFunctions = Index.size();
+
+    OS.write(reinterpret_cast<const char *>(&H), sizeof(H));
+    if (!Index.empty())
+      OS.write(reinterpret_cast<const char *>(Index.data()),
+               Index.size() * sizeof(bmir::FunctionRecord));
+    OS << StrTab << IR;
+    for (const auto &F : BinaryFunctions)
+      OS << F.second;
+  }
 };
 
 char MIRPrintingPass::ID = 0;
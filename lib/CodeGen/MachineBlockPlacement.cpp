@@ -60,6 +60,9 @@ STATISTIC(NumCondBranches, "Number of conditional branches");
 STATISTIC(NumUncondBranches, "Number of unconditional branches");
 STATISTIC(CondBranchTakenFreq,
           "Potential frequency of taking conditional branches");
+STATISTIC(NumHotInstrs, "Number of instructions in hot basic blocks");
+STATISTIC(NumHotSpanInstrs,
+          "Number of instructions spanned by the hot blocks in layout order");
 STATISTIC(UncondBranchTakenFreq,
           "Potential frequency of taking unconditional branches");
 
@@ -2764,8 +2767,32 @@ bool MachineBlockPlacementStats::runOnMachineFunction(MachineFunction &F) {
   MBPI = &getAnalysis<MachineBranchProbabilityInfo>();
   MBFI = &getAnalysis<MachineBlockFrequencyInfo>();
 
+  // Instruction-cache packing proxy: compare the instructions in hot blocks
+  // against the instructions spanned from the first to the last hot block in
+  // layout order. The closer the two counts, the fewer cold instructions sit
+  // inside the region the hot path has to page through. A block is counted
+  // hot when it runs at least 1/16th as often as the entry block; instruction
+  // counts stand in for byte sizes, which are not known at this stage.
+  uint64_t EntryFreq = MBFI->getEntryFreq();
+  bool SeenHotBlock = false;
+  unsigned PendingColdInstrs = 0;
+
   for (MachineBasicBlock &MBB : F) {
     BlockFrequency BlockFreq = MBFI->getBlockFreq(&MBB);
+
+    if (BlockFreq.getFrequency() * 16 >= EntryFreq) {
+      if (SeenHotBlock)
+        NumHotSpanInstrs += PendingColdInstrs;
+      PendingColdInstrs = 0;
+      NumHotInstrs += MBB.size();
+      NumHotSpanInstrs += MBB.size();
+      SeenHotBlock = true;
+    } else if (SeenHotBlock) {
+      // Only spans ending in another hot block count; trailing cold blocks
+      // are discarded when the function ends.
+      PendingColdInstrs += MBB.size();
+    }
+
     Statistic &NumBranches =
         (MBB.succ_size() > 1) ? NumCondBranches : NumUncondBranches;
     Statistic &BranchTakenFreq =
@@ -318,6 +318,16 @@ MachineMemOperand *MachineFunction::getMachineMemOperand(
 MachineMemOperand *
 MachineFunction::getMachineMemOperand(const MachineMemOperand *MMO,
                                       int64_t Offset, uint64_t Size) {
+  // An unadjusted copy describes exactly the same access as the original, so
+  // share the original instead of allocating a duplicate. MMOs are routinely
+  // shared between instructions (see extractLoadMemRefs), so callers may not
+  // assume unique ownership of the result. The copy below deliberately drops
+  // the AA metadata, which may no longer hold after the access is moved, so
+  // only reuse MMOs that don't carry any.
+  if (Offset == 0 && Size == MMO->getSize() && !MMO->getAAInfo() &&
+      !MMO->getRanges())
+    return const_cast<MachineMemOperand *>(MMO);
+
   if (MMO->getValue())
     return new (Allocator)
                MachineMemOperand(MachinePointerInfo(MMO->getValue(),
@@ -972,26 +972,35 @@ MachineInstr::mergeMemRefsWith(const MachineInstr& Other) {
   if (hasIdenticalMMOs(*this, Other))
     return std::make_pair(MemRefs, NumMemRefs);
 
-  // TODO: consider uniquing elements within the operand lists to reduce
-  // space usage and fall back to conservative information less often.
-  size_t CombinedNumMemRefs = NumMemRefs + Other.NumMemRefs;
+  // Merge the two lists, keeping a single copy of any MMOs that are
+  // structurally identical. Splitting and recombining memory operations
+  // produces many equal MMOs from separate allocations, so uniquing here
+  // keeps the merged list short and falls back to dropping memrefs less
+  // often.
+  SmallVector<MachineMemOperand *, 4> MergedMMOs(memoperands_begin(),
+                                                 memoperands_end());
+  for (MachineMemOperand *MMO : Other.memoperands()) {
+    bool Seen = false;
+    for (MachineMemOperand *Merged : MergedMMOs)
+      if (Merged == MMO || *Merged == *MMO) {
+        Seen = true;
+        break;
+      }
+    if (!Seen)
+      MergedMMOs.push_back(MMO);
+  }
 
   // If we don't have enough room to store this many memrefs, be conservative
   // and drop them.  Otherwise, we'd fail asserts when trying to add them to
   // the new instruction.
-  if (CombinedNumMemRefs != uint8_t(CombinedNumMemRefs))
+  if (MergedMMOs.size() != uint8_t(MergedMMOs.size()))
     return std::make_pair(nullptr, 0);
 
   MachineFunction *MF = getParent()->getParent();
-  mmo_iterator MemBegin = MF->allocateMemRefsArray(CombinedNumMemRefs);
-  mmo_iterator MemEnd = std::copy(memoperands_begin(), memoperands_end(),
-                                  MemBegin);
-  MemEnd = std::copy(Other.memoperands_begin(), Other.memoperands_end(),
-                     MemEnd);
-  assert(MemEnd - MemBegin == (ptrdiff_t)CombinedNumMemRefs &&
-         "missing memrefs");
-
-  return std::make_pair(MemBegin, CombinedNumMemRefs);
+  mmo_iterator MemBegin = MF->allocateMemRefsArray(MergedMMOs.size());
+  std::copy(MergedMMOs.begin(), MergedMMOs.end(), MemBegin);
+
+  return std::make_pair(MemBegin, MergedMMOs.size());
 }
 
 bool MachineInstr::hasPropertyInBundle(unsigned Mask, QueryType Type) const {
@@ -114,6 +114,11 @@ static cl::opt<bool> EnableRegPressure("misched-regpressure", cl::Hidden,
 static cl::opt<bool> EnableCyclicPath("misched-cyclicpath", cl::Hidden,
   cl::desc("Enable cyclic critical path analysis."), cl::init(true));
 
+static cl::opt<bool> EnableCachedPressureDeltas(
+  "misched-cache-pressure-deltas", cl::Hidden,
+  cl::desc("Reuse bottom-up pressure deltas across candidate queue scans."),
+  cl::init(true));
+
 static cl::opt<bool> EnableMemOpCluster("misched-cluster", cl::Hidden,
                                         cl::desc("Enable memop clustering."),
                                         cl::init(true));
@@ -2618,6 +2623,11 @@ void GenericScheduler::initialize(ScheduleDAGMI *dag) {
   }
   TopCand.SU = nullptr;
   BotCand.SU = nullptr;
+
+  // Invalidate the pressure delta cache for the new region. An empty pressure
+  // snapshot tells updateBotPressureEpochs() to stamp every set on first use.
+  BotDeltaCache.assign(DAG->SUnits.size(), CachedPressureDelta());
+  BotPressureSnapshot.clear();
 }
 
 /// Initialize the per-region scheduling policy.
@@ -2806,6 +2816,63 @@ static int biasPhysRegCopy(const SUnit *SU, bool isTop) {
   return 0;
 }
 
+/// Bring the per-pressure-set epochs up to date with the bottom tracker.
+///
+/// An upward pressure delta is a pure function of the candidate's
+/// PressureDiff and, for the sets named by that diff, of the tracker's
+/// current and max pressure, the region's critical set increments, and
+/// per-region constants. Rather than hooking every tracker mutation, diff the
+/// tracker state against a snapshot once per queue scan and stamp the sets
+/// that moved with a fresh epoch. A cached delta is then current as long as
+/// its PressureDiff generation is unchanged and none of the diff's sets has
+/// been stamped since the delta was computed.
+void GenericScheduler::updateBotPressureEpochs() {
+  const std::vector<unsigned> &CurrP =
+      DAG->getBotRPTracker().getRegSetPressureAtPos();
+  const std::vector<unsigned> &MaxP =
+      DAG->getBotRPTracker().getPressure().MaxSetPressure;
+  ArrayRef<PressureChange> CritPSets = DAG->getRegionCriticalPSets();
+
+  ++BotPressureEpoch;
+  if (BotPressureSnapshot.empty()) {
+    // First scan in this region: stamp everything.
+    BotPressureSnapshot = CurrP;
+    BotMaxSnapshot = MaxP;
+    CritUnitIncSnapshot.clear();
+    for (const PressureChange &C : CritPSets)
+      CritUnitIncSnapshot.push_back(C.getUnitInc());
+    PSetEpochs.assign(CurrP.size(), BotPressureEpoch);
+    return;
+  }
+  for (unsigned I = 0, E = CurrP.size(); I != E; ++I) {
+    if (CurrP[I] != BotPressureSnapshot[I] || MaxP[I] != BotMaxSnapshot[I]) {
+      PSetEpochs[I] = BotPressureEpoch;
+      BotPressureSnapshot[I] = CurrP[I];
+      BotMaxSnapshot[I] = MaxP[I];
+    }
+  }
+  // updateScheduledPressure() may raise a critical set's increment without
+  // moving the tracker's pressure for that set.
+  for (unsigned I = 0, E = CritPSets.size(); I != E; ++I) {
+    if (CritPSets[I].getUnitInc() != CritUnitIncSnapshot[I]) {
+      PSetEpochs[CritPSets[I].getPSet()] = BotPressureEpoch;
+      CritUnitIncSnapshot[I] = CritPSets[I].getUnitInc();
+    }
+  }
+}
+
+/// Return true if a cached delta still matches the state it was derived from.
+bool GenericScheduler::cachedDeltaCurrent(const CachedPressureDelta &Entry,
+                                          const PressureDiff &PDiff) const {
+  if (Entry.Epoch == 0 || Entry.PDiffGen != PDiff.getGeneration())
+    return false;
+  for (PressureDiff::const_iterator I = PDiff.begin(), E = PDiff.end();
+       I != E && I->isValid(); ++I)
+    if (PSetEpochs[I->getPSet()] > Entry.Epoch)
+      return false;
+  return true;
+}
+
 void GenericScheduler::initCandidate(SchedCandidate &Cand, SUnit *SU,
                                      bool AtTop,
                                      const RegPressureTracker &RPTracker,
@@ -2827,6 +2894,21 @@ void GenericScheduler::initCandidate(SchedCandidate &Cand, SUnit *SU,
           Cand.RPDelta,
           DAG->getRegionCriticalPSets(),
           DAG->getRegPressure().MaxSetPressure);
+      } else if (EnableCachedPressureDeltas && !BotDeltaCache.empty()) {
+        PressureDiff &PDiff = DAG->getPressureDiff(Cand.SU);
+        CachedPressureDelta &Entry = BotDeltaCache[SU->NodeNum];
+        if (!cachedDeltaCurrent(Entry, PDiff)) {
+          Entry.Delta = RegPressureDelta();
+          RPTracker.getUpwardPressureDelta(
+            Cand.SU->getInstr(),
+            PDiff,
+            Entry.Delta,
+            DAG->getRegionCriticalPSets(),
+            DAG->getRegPressure().MaxSetPressure);
+          Entry.PDiffGen = PDiff.getGeneration();
+          Entry.Epoch = BotPressureEpoch;
+        }
+        Cand.RPDelta = Entry.Delta;
       } else {
         RPTracker.getUpwardPressureDelta(
           Cand.SU->getInstr(),
@@ -2958,9 +3040,13 @@ void GenericScheduler::tryCandidate(SchedCandidate &Cand,
 
 /// Pick the best candidate from the queue.
 ///
-/// TODO: getMaxPressureDelta results can be mostly cached for each SUnit during
-/// DAG building. To adjust for the current scheduling location we need to
-/// maintain the number of vreg uses remaining to be top-scheduled.
+/// Bottom-up pressure deltas are memoized per node and reused while the
+/// tracker state they depend on is unchanged; see updateBotPressureEpochs().
+///
+/// TODO: getMaxDownwardPressureDelta results could be cached the same way,
+/// but they also depend on the current scheduling location through the
+/// tracker's last-use queries. To adjust for it we would need to maintain the
+/// number of vreg uses remaining to be top-scheduled.
 void GenericScheduler::pickNodeFromQueue(SchedBoundary &Zone,
                                          const CandPolicy &ZonePolicy,
                                          const RegPressureTracker &RPTracker,
@@ -2968,6 +3054,10 @@ void GenericScheduler::pickNodeFromQueue(SchedBoundary &Zone,
   // getMaxPressureDelta temporarily modifies the tracker.
   RegPressureTracker &TempTracker = const_cast<RegPressureTracker&>(RPTracker);
 
+  if (!Zone.isTop() && DAG->isTrackingPressure() && !VerifyScheduling &&
+      EnableCachedPressureDeltas)
+    updateBotPressureEpochs();
+
   ReadyQueue &Q = Zone.Available;
   for (ReadyQueue::iterator I = Q.begin(), E = Q.end(); I != E; ++I) {
 
@@ -73,6 +73,18 @@ EnableGlobalCopies("join-globalcopies",
   cl::desc("Coalesce copies that span blocks (default=subtarget)"),
   cl::init(cl::BOU_UNSET), cl::Hidden);
 
+/// On very large functions the fixed-point iteration over failed copies can
+/// revisit the whole failed tail once per copy that a later join unlocks.
+/// When more than this many copies survive the initial pass, settle for a
+/// single deterministic retry round instead, bounding coalescing at two
+/// passes over the copy list. Zero disables the cutoff.
+static cl::opt<unsigned> LargeFunctionCopies(
+    "coalescer-large-function-copies",
+    cl::desc("Number of unresolved copies above which the coalescer runs one "
+             "retry round instead of iterating to a fixed point (0 = always "
+             "iterate)"),
+    cl::init(10000), cl::Hidden);
+
 static cl::opt<bool>
 VerifyCoalescing("verify-coalescing",
          cl::desc("Verify machine instrs before and after register coalescing"),
@@ -3252,9 +3264,17 @@ void RegisterCoalescer::joinAllIntervals() {
   coalesceLocals();
 
   // Joining intervals can allow other intervals to be joined.  Iteratively join
-  // until we make no progress.
-  while (copyCoalesceWorkList(WorkList))
-    /* empty */ ;
+  // until we make no progress, unless a huge number of copies survived the
+  // initial pass; then a single retry round picks up the joins unlocked by
+  // the first pass and anything still conflicted is left for the allocator.
+  unsigned RemainingCopies =
+      WorkList.size() -
+      std::count(WorkList.begin(), WorkList.end(), (MachineInstr *)nullptr);
+  if (LargeFunctionCopies && RemainingCopies > LargeFunctionCopies)
+    copyCoalesceWorkList(WorkList);
+  else
+    while (copyCoalesceWorkList(WorkList))
+      /* empty */ ;
 }
 
 void RegisterCoalescer::releaseMemory() {
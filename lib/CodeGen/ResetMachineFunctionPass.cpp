@@ -24,6 +24,7 @@ using namespace llvm;
 #define DEBUG_TYPE "reset-machine-function"
 
 STATISTIC(NumFunctionsReset, "Number of functions reset");
+STATISTIC(NumFunctionsVisited, "Number of functions visited");
 
 namespace {
   class ResetMachineFunction : public MachineFunctionPass {
@@ -43,6 +44,10 @@ namespace {
     StringRef getPassName() const override { return "ResetMachineFunction"; }
 
     bool runOnMachineFunction(MachineFunction &MF) override {
+      // NumFunctionsVisited gives the denominator for the fallback rate:
+      // NumFunctionsReset / NumFunctionsVisited of the functions that went
+      // through GlobalISel needed the SelectionDAG fallback.
+      ++NumFunctionsVisited;
       if (MF.getProperties().hasProperty(
               MachineFunctionProperties::Property::FailedISel)) {
         if (AbortOnFailedISel)
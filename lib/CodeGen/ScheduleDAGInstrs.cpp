@@ -92,6 +92,8 @@ ScheduleDAGInstrs::ScheduleDAGInstrs(MachineFunction &mf,
     : ScheduleDAG(mf), MLI(mli), MFI(mf.getFrameInfo()),
       RemoveKillFlags(RemoveKillFlags), CanHandleTerminators(false),
       TrackLaneMasks(false), AAForDep(nullptr), BarrierChain(nullptr),
+      StoresMapHint(0), LoadsMapHint(0), NonAliasStoresMapHint(0),
+      NonAliasLoadsMapHint(0),
       UnknownValue(UndefValue::get(
                      Type::getVoidTy(mf.getFunction()->getContext()))),
       FirstDbgValue(nullptr) {
@@ -645,6 +647,10 @@ public:
 
   unsigned inline size() const { return NumNodes; }
 
+  /// Number of distinct values currently mapped (as opposed to size(),
+  /// which counts the SUs in all the lists).
+  unsigned numValues() const { return MapVector::size(); }
+
   /// Counts the number of SUs in this map after a reduction.
   void reComputeSize(void) {
     NumNodes = 0;
@@ -761,6 +767,13 @@ void ScheduleDAGInstrs::buildSchedGraph(AliasAnalysis *AA,
   // done.
   Value2SUsMap NonAliasStores, NonAliasLoads(1 /*TrueMemOrderLatency*/);
 
+  // Pre-size the maps from the previous region's statistics so that steady
+  // state DAG building does not grow them entry by entry.
+  Stores.reserve(StoresMapHint);
+  Loads.reserve(LoadsMapHint);
+  NonAliasStores.reserve(NonAliasStoresMapHint);
+  NonAliasLoads.reserve(NonAliasLoadsMapHint);
+
   // Remove any stale debug info; sometimes BuildSchedGraph is called again
   // without emitting the info from the previous call.
   DbgValues.clear();
@@ -977,6 +990,13 @@ void ScheduleDAGInstrs::buildSchedGraph(AliasAnalysis *AA,
   if (DbgMI)
     FirstDbgValue = DbgMI;
 
+  // Remember how many values the maps held for pre-sizing them in the next
+  // region.
+  StoresMapHint = Stores.numValues();
+  LoadsMapHint = Loads.numValues();
+  NonAliasStoresMapHint = NonAliasStores.numValues();
+  NonAliasLoadsMapHint = NonAliasLoads.numValues();
+
   Defs.clear();
   Uses.clear();
   CurrentVRegDefs.clear();
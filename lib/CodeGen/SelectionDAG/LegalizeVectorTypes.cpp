@@ -22,12 +22,18 @@
 
 #include "LegalizeTypes.h"
 #include "llvm/IR/DataLayout.h"
+#include "llvm/Support/CommandLine.h"
 #include "llvm/Support/ErrorHandling.h"
 #include "llvm/Support/raw_ostream.h"
 using namespace llvm;
 
 #define DEBUG_TYPE "legalize-types"
 
+static cl::opt<bool> EnableBulkVectorSplit(
+    "bulk-vector-split", cl::Hidden, cl::init(true),
+    cl::desc("Split very wide vector operations directly into legal-width "
+             "pieces instead of halving them one level at a time"));
+
 //===----------------------------------------------------------------------===//
 //  Result Vector Scalarization: <1 x ty> -> ty.
 //===----------------------------------------------------------------------===//
@@ -523,16 +529,16 @@ SDValue DAGTypeLegalizer::ScalarizeVecOp_CONCAT_VECTORS(SDNode *N) {
   return DAG.getBuildVector(N->getValueType(0), SDLoc(N), Ops);
 }
 
-/// If the input is a vector that needs to be scalarized, it must be <1 x ty>,
-/// so just return the element, ignoring the index.
-SDValue DAGTypeLegalizer::ScalarizeVecOp_EXTRACT_VECTOR_ELT(SDNode *N) {
-  EVT VT = N->getValueType(0);
-  SDValue Res = GetScalarizedVector(N->getOperand(0));
-  if (Res.getValueType() != VT)
-    Res = DAG.getNode(ISD::ANY_EXTEND, SDLoc(N), VT, Res);
-  return Res;
-}
-
+/// If the input is a vector that needs to be scalarized, it must be <1 x ty>,
+/// so just return the element, ignoring the index.
+SDValue DAGTypeLegalizer::ScalarizeVecOp_EXTRACT_VECTOR_ELT(SDNode *N) {
+  EVT VT = N->getValueType(0);
+  SDValue Res = GetScalarizedVector(N->getOperand(0));
+  if (Res.getValueType() != VT)
+    Res = DAG.getNode(ISD::ANY_EXTEND, SDLoc(N), VT, Res);
+  return Res;
+}
+
 
 /// If the input condition is a vector that needs to be scalarized, it must be
 /// <1 x i1>, so just convert to a normal ISD::SELECT
@@ -722,8 +728,72 @@ void DAGTypeLegalizer::SplitVectorResult(SDNode *N, unsigned ResNo) {
     SetSplitVector(SDValue(N, ResNo), Lo, Hi);
 }
 
+/// Try to split a very wide elementwise operation directly into legal-width
+/// pieces. The generic path halves the vector and revisits each half,
+/// materializing the operation at every intermediate width; for a
+/// 1024-element vector on a 4-element target that is eight rounds of nodes
+/// that exist only to be split again. When the legal intermediate type
+/// divides the source evenly, build the legal-width operations in one step
+/// and hand back the two halves as concatenations, which later rounds take
+/// apart without creating new operations. Returns false if the node does not
+/// qualify, in which case the caller proceeds with the generic split.
+bool DAGTypeLegalizer::SplitVecRes_BulkOp(SDNode *N, SDValue &Lo,
+                                          SDValue &Hi) {
+  if (!EnableBulkVectorSplit)
+    return false;
+
+  // Only handle nodes where every operand has the result's type; this keeps
+  // conversions (whose operands legalize on a different schedule) and mixed
+  // scalar operands like FP_ROUND's flag on the generic path.
+  EVT VT = N->getValueType(0);
+  for (const SDValue &Op : N->op_values())
+    if (Op.getValueType() != VT)
+      return false;
+
+  EVT IntermediateVT;
+  MVT RegisterVT;
+  unsigned NumIntermediates;
+  TLI.getVectorTypeBreakdown(*DAG.getContext(), VT, IntermediateVT,
+                             NumIntermediates, RegisterVT);
+
+  // The bulk path only pays off when the generic path would split more than
+  // once, and it needs whole same-element chunks that divide evenly into the
+  // two halves.
+  if (!IntermediateVT.isVector() ||
+      IntermediateVT.getVectorElementType() != VT.getVectorElementType() ||
+      NumIntermediates <= 2 || (NumIntermediates & 1) ||
+      NumIntermediates * IntermediateVT.getVectorNumElements() !=
+          VT.getVectorNumElements())
+    return false;
+
+  DEBUG(dbgs() << "Bulk split node result: "; N->dump(&DAG); dbgs() << "\n");
+
+  SDLoc dl(N);
+  EVT IdxTy = TLI.getVectorIdxTy(DAG.getDataLayout());
+  unsigned ChunkElts = IntermediateVT.getVectorNumElements();
+  const SDNodeFlags *Flags = N->getFlags();
+  SmallVector<SDValue, 16> LoPieces, HiPieces;
+  for (unsigned i = 0; i != NumIntermediates; ++i) {
+    SmallVector<SDValue, 3> Ops;
+    for (const SDValue &Op : N->op_values())
+      Ops.push_back(DAG.getNode(ISD::EXTRACT_SUBVECTOR, dl, IntermediateVT, Op,
+                                DAG.getConstant(i * ChunkElts, dl, IdxTy)));
+    SDValue Piece = DAG.getNode(N->getOpcode(), dl, IntermediateVT, Ops, Flags);
+    (i < NumIntermediates / 2 ? LoPieces : HiPieces).push_back(Piece);
+  }
+
+  EVT LoVT, HiVT;
+  std::tie(LoVT, HiVT) = DAG.GetSplitDestVTs(VT);
+  Lo = DAG.getNode(ISD::CONCAT_VECTORS, dl, LoVT, LoPieces);
+  Hi = DAG.getNode(ISD::CONCAT_VECTORS, dl, HiVT, HiPieces);
+  return true;
+}
+
 void DAGTypeLegalizer::SplitVecRes_BinOp(SDNode *N, SDValue &Lo,
                                          SDValue &Hi) {
+  if (SplitVecRes_BulkOp(N, Lo, Hi))
+    return;
+
   SDValue LHSLo, LHSHi;
   GetSplitVector(N->getOperand(0), LHSLo, LHSHi);
   SDValue RHSLo, RHSHi;
@@ -738,6 +808,9 @@ void DAGTypeLegalizer::SplitVecRes_BinOp(SDNode *N, SDValue &Lo,
 
 void DAGTypeLegalizer::SplitVecRes_TernaryOp(SDNode *N, SDValue &Lo,
                                              SDValue &Hi) {
+  if (SplitVecRes_BulkOp(N, Lo, Hi))
+    return;
+
   SDValue Op0Lo, Op0Hi;
   GetSplitVector(N->getOperand(0), Op0Lo, Op0Hi);
   SDValue Op1Lo, Op1Hi;
@@ -1246,6 +1319,12 @@ void DAGTypeLegalizer::SplitVecRes_SETCC(SDNode *N, SDValue &Lo, SDValue &Hi) {
 
 void DAGTypeLegalizer::SplitVecRes_UnaryOp(SDNode *N, SDValue &Lo,
                                            SDValue &Hi) {
+  // Same-type unary operations on very wide vectors can go straight to
+  // legal-width pieces; conversions fail the type check inside and fall
+  // through to the generic split below.
+  if (SplitVecRes_BulkOp(N, Lo, Hi))
+    return;
+
   // Get the dest types - they may not match the input types, e.g. int_to_fp.
   EVT LoVT, HiVT;
   SDLoc dl(N);
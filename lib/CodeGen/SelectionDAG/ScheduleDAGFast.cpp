@@ -118,8 +118,10 @@ void ScheduleDAGFast::Schedule() {
   DEBUG(dbgs() << "********** List Scheduling **********\n");
 
   NumLiveRegs = 0;
-  LiveRegDefs.resize(TRI->getNumRegs(), nullptr);
-  LiveRegCycles.resize(TRI->getNumRegs(), 0);
+  // assign() rather than resize(): the scheduler object is reused from block
+  // to block, and resize() would keep stale entries on the second run.
+  LiveRegDefs.assign(TRI->getNumRegs(), nullptr);
+  LiveRegCycles.assign(TRI->getNumRegs(), 0);
 
   // Build the scheduling graph.
   BuildSchedGraph(nullptr);
@@ -723,6 +725,11 @@ static SDNode *findGluedUser(SDNode *N) {
 void ScheduleDAGLinearize::Schedule() {
   DEBUG(dbgs() << "********** DAG Linearization **********\n");
 
+  // The scheduler object is reused from block to block; the previous
+  // block's sequence and glue map refer to nodes that no longer exist.
+  Sequence.clear();
+  GluedMap.clear();
+
   SmallVector<SDNode*, 8> Glues;
   unsigned DAGSize = 0;
   for (SDNode &Node : DAG->allnodes()) {
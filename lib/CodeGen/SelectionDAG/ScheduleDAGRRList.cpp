@@ -1651,6 +1651,15 @@ protected:
   /// class.
   std::vector<unsigned> RegLimit;
 
+  /// ClosestSuccCache - Cached closestSucc() comparison key for each node,
+  /// indexed by NodeNum. Only valid while the node is in Queue; it is
+  /// recomputed each time the node is pushed.
+  std::vector<unsigned> ClosestSuccCache;
+
+  /// MaxScratchesCache - Cached calcMaxScratches() comparison key for each
+  /// node, indexed by NodeNum. Same validity rules as ClosestSuccCache.
+  std::vector<unsigned> MaxScratchesCache;
+
 public:
   RegReductionPQBase(MachineFunction &mf,
                      bool hasReadyFilter,
@@ -1690,6 +1699,8 @@ public:
   void releaseState() override {
     SUnits = nullptr;
     SethiUllmanNumbers.clear();
+    ClosestSuccCache.clear();
+    MaxScratchesCache.clear();
     std::fill(RegPressure.begin(), RegPressure.end(), 0);
   }
 
@@ -1701,11 +1712,20 @@ public:
     return SU->getNode()->getIROrder();
   }
 
+  unsigned getClosestSucc(const SUnit *SU) const {
+    return ClosestSuccCache[SU->NodeNum];
+  }
+
+  unsigned getMaxScratches(const SUnit *SU) const {
+    return MaxScratchesCache[SU->NodeNum];
+  }
+
   bool empty() const override { return Queue.empty(); }
 
   void push(SUnit *U) override {
     assert(!U->NodeQueueId && "Node in the queue already");
     U->NodeQueueId = ++CurQueueId;
+    cachePriorityKeys(U);
     Queue.push_back(U);
   }
 
@@ -1738,6 +1758,7 @@ protected:
   void AddPseudoTwoAddrDeps();
   void PrescheduleNodesWithMultipleUses();
   void CalculateSethiUllmanNumbers();
+  void cachePriorityKeys(const SUnit *SU);
 };
 
 template<class SF>
@@ -1879,14 +1900,18 @@ void RegReductionPQBase::CalculateSethiUllmanNumbers() {
 
 void RegReductionPQBase::addNode(const SUnit *SU) {
   unsigned SUSize = SethiUllmanNumbers.size();
-  if (SUnits->size() > SUSize)
+  if (SUnits->size() > SUSize) {
     SethiUllmanNumbers.resize(SUSize*2, 0);
+    ClosestSuccCache.resize(SUSize*2, 0);
+    MaxScratchesCache.resize(SUSize*2, 0);
+  }
   CalcNodeSethiUllmanNumber(SU, SethiUllmanNumbers);
 }
 
 void RegReductionPQBase::updateNode(const SUnit *SU) {
   SethiUllmanNumbers[SU->NodeNum] = 0;
   CalcNodeSethiUllmanNumber(SU, SethiUllmanNumbers);
+  cachePriorityKeys(SU);
 }
 
 // Lower priority means schedule further down. For bottom-up scheduling, lower
@@ -2214,6 +2239,24 @@ static unsigned calcMaxScratches(const SUnit *SU) {
   return Scratches;
 }
 
+/// cachePriorityKeys - Precompute the comparison keys for SU that only depend
+/// on the graph around it. By the time a node is pushed all of its data
+/// successors have been scheduled and their heights are final, so
+/// closestSucc() cannot change while the node sits in the queue; caching it
+/// here turns every comparison in popFromQueueImpl from a walk over the
+/// successor graph into a pair of table lookups. Nodes whose edges are
+/// rewritten are re-cached through updateNode() or when they are re-pushed
+/// after backtracking.
+void RegReductionPQBase::cachePriorityKeys(const SUnit *SU) {
+  unsigned NodeNum = SU->NodeNum;
+  if (NodeNum >= ClosestSuccCache.size()) {
+    ClosestSuccCache.resize(NodeNum+1, 0);
+    MaxScratchesCache.resize(NodeNum+1, 0);
+  }
+  ClosestSuccCache[NodeNum] = closestSucc(SU);
+  MaxScratchesCache[NodeNum] = calcMaxScratches(SU);
+}
+
 /// hasOnlyLiveInOpers - Return true if SU has only value predecessors that are
 /// CopyFromReg from a virtual register.
 static bool hasOnlyLiveInOpers(const SUnit *SU) {
@@ -2449,14 +2492,14 @@ static bool BURRSort(SUnit *left, SUnit *right, RegReductionPQBase *SPQ) {
   // t3 = op t4, c2
   //
   // This creates more short live intervals.
-  unsigned LDist = closestSucc(left);
-  unsigned RDist = closestSucc(right);
+  unsigned LDist = SPQ->getClosestSucc(left);
+  unsigned RDist = SPQ->getClosestSucc(right);
   if (LDist != RDist)
     return LDist < RDist;
 
   // How many registers becomes live when the node is scheduled.
-  unsigned LScratch = calcMaxScratches(left);
-  unsigned RScratch = calcMaxScratches(right);
+  unsigned LScratch = SPQ->getMaxScratches(left);
+  unsigned RScratch = SPQ->getMaxScratches(right);
   if (LScratch != RScratch)
     return LScratch > RScratch;
 
@@ -2663,6 +2706,8 @@ void RegReductionPQBase::initNodes(std::vector<SUnit> &sunits) {
     PrescheduleNodesWithMultipleUses();
   // Calculate node priorities.
   CalculateSethiUllmanNumbers();
+  ClosestSuccCache.resize(SUnits->size(), 0);
+  MaxScratchesCache.resize(SUnits->size(), 0);
 
   // For single block loops, mark nodes that look like canonical IV increments.
   if (scheduleDAG->BB->isSuccessor(scheduleDAG->BB))
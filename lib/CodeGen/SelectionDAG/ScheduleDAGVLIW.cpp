@@ -97,6 +97,11 @@ void ScheduleDAGVLIW::Schedule() {
         << "********** List Scheduling BB#" << BB->getNumber()
         << " '" << BB->getName() << "' **********\n");
 
+  // The scheduler object is reused from block to block; drop any hazard
+  // state left over from the previous one.
+  HazardRec->Reset();
+  PendingQueue.clear();
+
   // Build the scheduling graph.
   BuildSchedGraph(AA);
 
@@ -965,9 +965,19 @@ SDNode *SelectionDAG::FindNodeOrInsertPos(const FoldingSetNodeID &ID,
 }
 
 void SelectionDAG::clear() {
+  // allnodes_clear() returns every node to NodeAllocator's free lists and
+  // every operand array to OperandRecycler's, so the next block's selection
+  // reuses this block's memory instead of growing fresh slabs.  Keep those
+  // free lists and the operand slabs alive rather than resetting the bump
+  // allocator: the arena only ever reaches the largest block's working set,
+  // and per-block Reset() was costing a slab free/realloc cycle plus cold
+  // memory on every block of big switch-heavy functions.  The memory is
+  // finally released in the destructor.
   allnodes_clear();
-  OperandRecycler.clear(OperandAllocator);
-  OperandAllocator.Reset();
+
+  // CSEMap.clear() deliberately preserves the bucket array, so the hash
+  // table stays sized for the previous block and does not rehash while the
+  // next block's nodes are inserted.
   CSEMap.clear();
 
   ExtendedValueTypeNodes.clear();
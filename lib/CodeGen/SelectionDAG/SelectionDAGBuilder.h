@@ -88,11 +88,13 @@ class SelectionDAGBuilder {
   /// CurInst - The current instruction being visited
   const Instruction *CurInst;
 
-  DenseMap<const Value*, SDValue> NodeMap;
+  DenseMap<const Value *, SDValue, GroupProbedDenseMapInfo<const Value *>>
+      NodeMap;
 
   /// UnusedArgNodeMap - Maps argument value for unused arguments. This is used
   /// to preserve debug information for incoming arguments.
-  DenseMap<const Value*, SDValue> UnusedArgNodeMap;
+  DenseMap<const Value *, SDValue, GroupProbedDenseMapInfo<const Value *>>
+      UnusedArgNodeMap;
 
   /// DanglingDebugInfo - Helper type for DanglingDebugInfoMap.
   class DanglingDebugInfo {
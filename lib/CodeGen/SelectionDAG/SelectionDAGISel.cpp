@@ -299,6 +299,7 @@ SelectionDAGISel::SelectionDAGISel(TargetMachine &tm,
   FuncInfo(new FunctionLoweringInfo()),
   CurDAG(new SelectionDAG(tm, OL)),
   SDB(new SelectionDAGBuilder(*CurDAG, *FuncInfo, OL)),
+  Scheduler(nullptr),
   GFI(),
   OptLevel(OL),
   DAGSize(0) {
@@ -311,6 +312,7 @@ SelectionDAGISel::SelectionDAGISel(TargetMachine &tm,
   }
 
 SelectionDAGISel::~SelectionDAGISel() {
+  delete Scheduler;
   delete SDB;
   delete CurDAG;
   delete FuncInfo;
@@ -394,6 +396,10 @@ bool SelectionDAGISel::runOnMachineFunction(MachineFunction &mf) {
   TII = MF->getSubtarget().getInstrInfo();
   TLI = MF->getSubtarget().getTargetLowering();
   RegInfo = &MF->getRegInfo();
+
+  // The subtarget and the per-function options the pattern predicates read
+  // are now in place; drop memoized results from the previous function.
+  PatternPredicateCache.clear();
   AA = &getAnalysis<AAResultsWrapperPass>().getAAResults();
   LibInfo = &getAnalysis<TargetLibraryInfoWrapperPass>().getTLI();
   GFI = Fn.hasGC() ? &getAnalysis<GCModuleInfo>().getFunctionInfo(Fn) : nullptr;
@@ -602,7 +608,10 @@ bool SelectionDAGISel::runOnMachineFunction(MachineFunction &mf) {
   MRI.freezeReservedRegs(*MF);
 
   // Release function-specific state. SDB and CurDAG are already cleared
-  // at this point.
+  // at this point. The scheduler is bound to this MachineFunction by its
+  // constructor and cannot outlive it.
+  delete Scheduler;
+  Scheduler = nullptr;
   FuncInfo->clear();
 
   DEBUG(dbgs() << "*** MachineFunction at end of ISel ***\n");
@@ -839,8 +848,12 @@ void SelectionDAGISel::CodeGenAndEmitDAG() {
   if (ViewSchedDAGs && MatchFilterBB)
     CurDAG->viewGraph("scheduler input for " + BlockName);
 
-  // Schedule machine code.
-  ScheduleDAGSDNodes *Scheduler = CreateScheduler();
+  // Schedule machine code. The scheduler is created for the first block of
+  // the function and reused for the remaining ones; Run() clears the
+  // per-block state, so the SUnit vectors and queues keep their storage
+  // across blocks.
+  if (!Scheduler)
+    Scheduler = CreateScheduler();
   {
     NamedRegionTimer T("sched", "Instruction Scheduling", GroupName,
                        GroupDescription, TimePassesIsEnabled);
@@ -867,13 +880,6 @@ void SelectionDAGISel::CodeGenAndEmitDAG() {
   if (FirstMBB != LastMBB)
     SDB->UpdateSplitBlock(FirstMBB, LastMBB);
 
-  // Free the scheduler state.
-  {
-    NamedRegionTimer T("cleanup", "Instruction Scheduling Cleanup", GroupName,
-                       GroupDescription, TimePassesIsEnabled);
-    delete Scheduler;
-  }
-
   // Free the SelectionDAG state, now that we're finished with it.
   CurDAG->clear();
 }
@@ -2531,7 +2537,15 @@ CheckChildSame(const unsigned char *MatcherTable, unsigned &MatcherIndex,
 LLVM_ATTRIBUTE_ALWAYS_INLINE static inline bool
 CheckPatternPredicate(const unsigned char *MatcherTable, unsigned &MatcherIndex,
                       const SelectionDAGISel &SDISel) {
-  return SDISel.CheckPatternPredicate(MatcherTable[MatcherIndex++]);
+  unsigned PredNo = MatcherTable[MatcherIndex++];
+  // Pattern predicates are constant over a function; see
+  // SelectionDAGISel::PatternPredicateCache.
+  if (PredNo >= SDISel.PatternPredicateCache.size())
+    SDISel.PatternPredicateCache.resize(PredNo + 1, 0);
+  uint8_t &CachedResult = SDISel.PatternPredicateCache[PredNo];
+  if (CachedResult == 0)
+    CachedResult = SDISel.CheckPatternPredicate(PredNo) ? 2 : 1;
+  return CachedResult == 2;
 }
 
 /// CheckNodePredicate - Implements OP_CheckNodePredicate.
@@ -2775,6 +2789,28 @@ public:
 
 } // end anonymous namespace
 
+// When the host compiler supports taking the address of a label (GCC and
+// Clang), the matcher interpreter below uses threaded dispatch: after each
+// operation it jumps through a table directly to the implementation of the
+// next opcode rather than branching back to a single shared switch. This
+// gives the branch predictor one indirect branch per opcode implementation
+// instead of one shared, essentially unpredictable branch for the whole
+// interpreter, which profiles show is a significant part of ISel time on
+// large matcher tables. The case labels are kept so that the plain switch
+// remains the fallback for other compilers.
+#ifdef __GNUC__
+#define DAGISEL_THREADED_DISPATCH 1
+#endif
+
+#if DAGISEL_THREADED_DISPATCH
+// Emit a computed-goto label alongside a switch case so the dispatch table
+// can jump straight to the case body. Grouped cases share the label of their
+// last member.
+#define MATCHER_CASE(OPC) case OPC: Lbl_##OPC
+#else
+#define MATCHER_CASE(OPC) case OPC
+#endif
+
 void SelectionDAGISel::SelectCodeCommon(SDNode *NodeToMatch,
                                         const unsigned char *MatcherTable,
                                         unsigned TableSize) {
@@ -2891,6 +2927,42 @@ void SelectionDAGISel::SelectCodeCommon(SDNode *NodeToMatch,
       if (Opc >= OpcodeOffset.size())
         OpcodeOffset.resize((Opc+1)*2);
       OpcodeOffset[Opc] = Idx;
+
+      // Build the second level of the index: if this opcode's state machine
+      // immediately switches on the node's type, record where each type's
+      // case starts so later selections can skip the linear case scan.
+      if (MatcherTable[Idx] == OPC_SwitchType) {
+        unsigned TIdx = Idx+1;
+        bool Indexable = true;
+        SmallVector<std::pair<unsigned, unsigned>, 8> TypeCases;
+        while (true) {
+          unsigned TCaseSize = MatcherTable[TIdx++];
+          if (TCaseSize & 128)
+            TCaseSize = GetVBR(TCaseSize, MatcherTable, TIdx);
+          if (TCaseSize == 0) break;
+
+          unsigned CaseVT = MatcherTable[TIdx++];
+          if (CaseVT == MVT::iPTR) {
+            // The pointer width isn't known until selection time; leave this
+            // switch to the interpreter.
+            Indexable = false;
+            break;
+          }
+          TypeCases.push_back(std::make_pair(CaseVT, TIdx));
+          TIdx += TCaseSize;
+        }
+        if (Indexable) {
+          // First case wins for any duplicated type, matching the
+          // interpreter's scan order.
+          for (unsigned i = 0, e = TypeCases.size(); i != e; ++i)
+            OpcodeTypeOffset.insert(std::make_pair(
+                ((unsigned)Opc << 8) | TypeCases[i].first, TypeCases[i].second));
+          // Mark this opcode's type switch as fully indexed. No simple value
+          // type uses index 0xff.
+          OpcodeTypeOffset[((unsigned)Opc << 8) | 0xff] = 1;
+        }
+      }
+
       Idx += CaseSize;
     }
 
@@ -2899,14 +2971,99 @@ void SelectionDAGISel::SelectCodeCommon(SDNode *NodeToMatch,
       MatcherIndex = OpcodeOffset[N.getOpcode()];
   }
 
+  // If the first-level table dropped us on a type switch, consult the second
+  // level of the index to skip straight to the matching type's patterns.
+  if (MatcherIndex != 0 && MatcherTable[MatcherIndex] == OPC_SwitchType &&
+      OpcodeTypeOffset.count((N.getOpcode() << 8) | 0xff)) {
+    DenseMap<unsigned, unsigned>::iterator TI = OpcodeTypeOffset.find(
+        (N.getOpcode() << 8) | N.getSimpleValueType().SimpleTy);
+    if (TI == OpcodeTypeOffset.end()) {
+      // No pattern produces this type for this opcode; the whole match would
+      // fail on the type switch.
+      CannotYetSelect(NodeToMatch);
+      return;
+    }
+    MatcherIndex = TI->second;
+    DEBUG(dbgs() << "  Initial type index to " << MatcherIndex << "\n");
+  }
+
+#if DAGISEL_THREADED_DISPATCH
+  // Table mapping each matcher opcode to the label of its implementation in
+  // the switch below, indexed by the BuiltinOpcodes value.
+  static const void *const DispatchTable[] = {
+      &&Lbl_OPC_Scope,
+      &&Lbl_OPC_RecordNode,
+      // OPC_RecordChild0 - OPC_RecordChild7
+      &&Lbl_OPC_RecordChild7, &&Lbl_OPC_RecordChild7, &&Lbl_OPC_RecordChild7,
+      &&Lbl_OPC_RecordChild7, &&Lbl_OPC_RecordChild7, &&Lbl_OPC_RecordChild7,
+      &&Lbl_OPC_RecordChild7, &&Lbl_OPC_RecordChild7,
+      &&Lbl_OPC_RecordMemRef,
+      &&Lbl_OPC_CaptureGlueInput,
+      &&Lbl_OPC_MoveChild,
+      // OPC_MoveChild0 - OPC_MoveChild7
+      &&Lbl_OPC_MoveChild7, &&Lbl_OPC_MoveChild7, &&Lbl_OPC_MoveChild7,
+      &&Lbl_OPC_MoveChild7, &&Lbl_OPC_MoveChild7, &&Lbl_OPC_MoveChild7,
+      &&Lbl_OPC_MoveChild7, &&Lbl_OPC_MoveChild7,
+      &&Lbl_OPC_MoveParent,
+      &&Lbl_OPC_CheckSame,
+      // OPC_CheckChild0Same - OPC_CheckChild3Same
+      &&Lbl_OPC_CheckChild3Same, &&Lbl_OPC_CheckChild3Same,
+      &&Lbl_OPC_CheckChild3Same, &&Lbl_OPC_CheckChild3Same,
+      &&Lbl_OPC_CheckPatternPredicate,
+      &&Lbl_OPC_CheckPredicate,
+      &&Lbl_OPC_CheckOpcode,
+      &&Lbl_OPC_SwitchOpcode,
+      &&Lbl_OPC_CheckType,
+      &&Lbl_OPC_SwitchType,
+      // OPC_CheckChild0Type - OPC_CheckChild7Type
+      &&Lbl_OPC_CheckChild7Type, &&Lbl_OPC_CheckChild7Type,
+      &&Lbl_OPC_CheckChild7Type, &&Lbl_OPC_CheckChild7Type,
+      &&Lbl_OPC_CheckChild7Type, &&Lbl_OPC_CheckChild7Type,
+      &&Lbl_OPC_CheckChild7Type, &&Lbl_OPC_CheckChild7Type,
+      &&Lbl_OPC_CheckInteger,
+      // OPC_CheckChild0Integer - OPC_CheckChild4Integer
+      &&Lbl_OPC_CheckChild4Integer, &&Lbl_OPC_CheckChild4Integer,
+      &&Lbl_OPC_CheckChild4Integer, &&Lbl_OPC_CheckChild4Integer,
+      &&Lbl_OPC_CheckChild4Integer,
+      &&Lbl_OPC_CheckCondCode,
+      &&Lbl_OPC_CheckValueType,
+      &&Lbl_OPC_CheckComplexPat,
+      &&Lbl_OPC_CheckAndImm,
+      &&Lbl_OPC_CheckOrImm,
+      &&Lbl_OPC_CheckFoldableChainNode,
+      &&Lbl_OPC_EmitInteger,
+      &&Lbl_OPC_EmitRegister,
+      &&Lbl_OPC_EmitRegister2,
+      &&Lbl_OPC_EmitConvertToTarget,
+      &&Lbl_OPC_EmitMergeInputChains,
+      // OPC_EmitMergeInputChains1_0 - OPC_EmitMergeInputChains1_2
+      &&Lbl_OPC_EmitMergeInputChains1_2, &&Lbl_OPC_EmitMergeInputChains1_2,
+      &&Lbl_OPC_EmitMergeInputChains1_2,
+      &&Lbl_OPC_EmitCopyToReg,
+      &&Lbl_OPC_EmitNodeXForm,
+      // OPC_EmitNode - OPC_MorphNodeTo2 share one implementation.
+      &&Lbl_OPC_MorphNodeTo2, &&Lbl_OPC_MorphNodeTo2, &&Lbl_OPC_MorphNodeTo2,
+      &&Lbl_OPC_MorphNodeTo2, &&Lbl_OPC_MorphNodeTo2, &&Lbl_OPC_MorphNodeTo2,
+      &&Lbl_OPC_MorphNodeTo2, &&Lbl_OPC_MorphNodeTo2,
+      &&Lbl_OPC_CompleteMatch,
+      &&Lbl_OPC_Coverage,
+  };
+  static_assert(array_lengthof(DispatchTable) == OPC_Coverage + 1,
+                "Dispatch table is out of sync with the matcher opcode list");
+#endif
+
   while (true) {
     assert(MatcherIndex < TableSize && "Invalid index");
 #ifndef NDEBUG
     unsigned CurrentOpcodeIndex = MatcherIndex;
 #endif
     BuiltinOpcodes Opcode = (BuiltinOpcodes)MatcherTable[MatcherIndex++];
+#if DAGISEL_THREADED_DISPATCH
+    assert(unsigned(Opcode) <= OPC_Coverage && "Invalid matcher opcode!");
+    goto *DispatchTable[Opcode];
+#endif
     switch (Opcode) {
-    case OPC_Scope: {
+    MATCHER_CASE(OPC_Scope): {
       // Okay, the semantics of this operation are that we should push a scope
       // then evaluate the first child.  However, pushing a scope only to have
       // the first check fail (which then pops it) is inefficient.  If we can
@@ -2964,7 +3121,7 @@ void SelectionDAGISel::SelectCodeCommon(SDNode *NodeToMatch,
       MatchScopes.push_back(NewEntry);
       continue;
     }
-    case OPC_RecordNode: {
+    MATCHER_CASE(OPC_RecordNode): {
       // Remember this node, it may end up being an operand in the pattern.
       SDNode *Parent = nullptr;
       if (NodeStack.size() > 1)
@@ -2976,7 +3133,7 @@ void SelectionDAGISel::SelectCodeCommon(SDNode *NodeToMatch,
     case OPC_RecordChild0: case OPC_RecordChild1:
     case OPC_RecordChild2: case OPC_RecordChild3:
     case OPC_RecordChild4: case OPC_RecordChild5:
-    case OPC_RecordChild6: case OPC_RecordChild7: {
+    case OPC_RecordChild6: MATCHER_CASE(OPC_RecordChild7): {
       unsigned ChildNo = Opcode-OPC_RecordChild0;
       if (ChildNo >= N.getNumOperands())
         break;  // Match fails if out of range child #.
@@ -2985,18 +3142,18 @@ void SelectionDAGISel::SelectCodeCommon(SDNode *NodeToMatch,
                                              N.getNode()));
       continue;
     }
-    case OPC_RecordMemRef:
+    MATCHER_CASE(OPC_RecordMemRef):
       MatchedMemRefs.push_back(cast<MemSDNode>(N)->getMemOperand());
       continue;
 
-    case OPC_CaptureGlueInput:
+    MATCHER_CASE(OPC_CaptureGlueInput):
       // If the current node has an input glue, capture it in InputGlue.
       if (N->getNumOperands() != 0 &&
           N->getOperand(N->getNumOperands()-1).getValueType() == MVT::Glue)
         InputGlue = N->getOperand(N->getNumOperands()-1);
       continue;
 
-    case OPC_MoveChild: {
+    MATCHER_CASE(OPC_MoveChild): {
       unsigned ChildNo = MatcherTable[MatcherIndex++];
       if (ChildNo >= N.getNumOperands())
         break;  // Match fails if out of range child #.
@@ -3008,7 +3165,7 @@ void SelectionDAGISel::SelectCodeCommon(SDNode *NodeToMatch,
     case OPC_MoveChild0: case OPC_MoveChild1:
     case OPC_MoveChild2: case OPC_MoveChild3:
     case OPC_MoveChild4: case OPC_MoveChild5:
-    case OPC_MoveChild6: case OPC_MoveChild7: {
+    case OPC_MoveChild6: MATCHER_CASE(OPC_MoveChild7): {
       unsigned ChildNo = Opcode-OPC_MoveChild0;
       if (ChildNo >= N.getNumOperands())
         break;  // Match fails if out of range child #.
@@ -3017,33 +3174,33 @@ void SelectionDAGISel::SelectCodeCommon(SDNode *NodeToMatch,
       continue;
     }
 
-    case OPC_MoveParent:
+    MATCHER_CASE(OPC_MoveParent):
       // Pop the current node off the NodeStack.
       NodeStack.pop_back();
       assert(!NodeStack.empty() && "Node stack imbalance!");
       N = NodeStack.back();
       continue;
 
-    case OPC_CheckSame:
+    MATCHER_CASE(OPC_CheckSame):
       if (!::CheckSame(MatcherTable, MatcherIndex, N, RecordedNodes)) break;
       continue;
 
     case OPC_CheckChild0Same: case OPC_CheckChild1Same:
-    case OPC_CheckChild2Same: case OPC_CheckChild3Same:
+    case OPC_CheckChild2Same: MATCHER_CASE(OPC_CheckChild3Same):
       if (!::CheckChildSame(MatcherTable, MatcherIndex, N, RecordedNodes,
                             Opcode-OPC_CheckChild0Same))
         break;
       continue;
 
-    case OPC_CheckPatternPredicate:
+    MATCHER_CASE(OPC_CheckPatternPredicate):
       if (!::CheckPatternPredicate(MatcherTable, MatcherIndex, *this)) break;
       continue;
-    case OPC_CheckPredicate:
+    MATCHER_CASE(OPC_CheckPredicate):
       if (!::CheckNodePredicate(MatcherTable, MatcherIndex, *this,
                                 N.getNode()))
         break;
       continue;
-    case OPC_CheckComplexPat: {
+    MATCHER_CASE(OPC_CheckComplexPat): {
       unsigned CPNum = MatcherTable[MatcherIndex++];
       unsigned RecNo = MatcherTable[MatcherIndex++];
       assert(RecNo < RecordedNodes.size() && "Invalid CheckComplexPat");
@@ -3061,17 +3218,17 @@ void SelectionDAGISel::SelectCodeCommon(SDNode *NodeToMatch,
         break;
       continue;
     }
-    case OPC_CheckOpcode:
+    MATCHER_CASE(OPC_CheckOpcode):
       if (!::CheckOpcode(MatcherTable, MatcherIndex, N.getNode())) break;
       continue;
 
-    case OPC_CheckType:
+    MATCHER_CASE(OPC_CheckType):
       if (!::CheckType(MatcherTable, MatcherIndex, N, TLI,
                        CurDAG->getDataLayout()))
         break;
       continue;
 
-    case OPC_SwitchOpcode: {
+    MATCHER_CASE(OPC_SwitchOpcode): {
       unsigned CurNodeOpcode = N.getOpcode();
       unsigned SwitchStart = MatcherIndex-1; (void)SwitchStart;
       unsigned CaseSize;
@@ -3102,7 +3259,7 @@ void SelectionDAGISel::SelectCodeCommon(SDNode *NodeToMatch,
       continue;
     }
 
-    case OPC_SwitchType: {
+    MATCHER_CASE(OPC_SwitchType): {
       MVT CurNodeVT = N.getSimpleValueType();
       unsigned SwitchStart = MatcherIndex-1; (void)SwitchStart;
       unsigned CaseSize;
@@ -3136,37 +3293,37 @@ void SelectionDAGISel::SelectCodeCommon(SDNode *NodeToMatch,
     case OPC_CheckChild0Type: case OPC_CheckChild1Type:
     case OPC_CheckChild2Type: case OPC_CheckChild3Type:
     case OPC_CheckChild4Type: case OPC_CheckChild5Type:
-    case OPC_CheckChild6Type: case OPC_CheckChild7Type:
+    case OPC_CheckChild6Type: MATCHER_CASE(OPC_CheckChild7Type):
       if (!::CheckChildType(MatcherTable, MatcherIndex, N, TLI,
                             CurDAG->getDataLayout(),
                             Opcode - OPC_CheckChild0Type))
         break;
       continue;
-    case OPC_CheckCondCode:
+    MATCHER_CASE(OPC_CheckCondCode):
       if (!::CheckCondCode(MatcherTable, MatcherIndex, N)) break;
       continue;
-    case OPC_CheckValueType:
+    MATCHER_CASE(OPC_CheckValueType):
       if (!::CheckValueType(MatcherTable, MatcherIndex, N, TLI,
                             CurDAG->getDataLayout()))
         break;
       continue;
-    case OPC_CheckInteger:
+    MATCHER_CASE(OPC_CheckInteger):
       if (!::CheckInteger(MatcherTable, MatcherIndex, N)) break;
       continue;
     case OPC_CheckChild0Integer: case OPC_CheckChild1Integer:
     case OPC_CheckChild2Integer: case OPC_CheckChild3Integer:
-    case OPC_CheckChild4Integer:
+    MATCHER_CASE(OPC_CheckChild4Integer):
       if (!::CheckChildInteger(MatcherTable, MatcherIndex, N,
                                Opcode-OPC_CheckChild0Integer)) break;
       continue;
-    case OPC_CheckAndImm:
+    MATCHER_CASE(OPC_CheckAndImm):
       if (!::CheckAndImm(MatcherTable, MatcherIndex, N, *this)) break;
       continue;
-    case OPC_CheckOrImm:
+    MATCHER_CASE(OPC_CheckOrImm):
       if (!::CheckOrImm(MatcherTable, MatcherIndex, N, *this)) break;
       continue;
 
-    case OPC_CheckFoldableChainNode: {
+    MATCHER_CASE(OPC_CheckFoldableChainNode): {
       assert(NodeStack.size() != 1 && "No parent node");
       // Verify that all intermediate nodes between the root and this one have
       // a single use.
@@ -3189,7 +3346,7 @@ void SelectionDAGISel::SelectCodeCommon(SDNode *NodeToMatch,
 
       continue;
     }
-    case OPC_EmitInteger: {
+    MATCHER_CASE(OPC_EmitInteger): {
       MVT::SimpleValueType VT =
         (MVT::SimpleValueType)MatcherTable[MatcherIndex++];
       int64_t Val = MatcherTable[MatcherIndex++];
@@ -3200,7 +3357,7 @@ void SelectionDAGISel::SelectCodeCommon(SDNode *NodeToMatch,
                                                         VT), nullptr));
       continue;
     }
-    case OPC_EmitRegister: {
+    MATCHER_CASE(OPC_EmitRegister): {
       MVT::SimpleValueType VT =
         (MVT::SimpleValueType)MatcherTable[MatcherIndex++];
       unsigned RegNo = MatcherTable[MatcherIndex++];
@@ -3208,7 +3365,7 @@ void SelectionDAGISel::SelectCodeCommon(SDNode *NodeToMatch,
                               CurDAG->getRegister(RegNo, VT), nullptr));
       continue;
     }
-    case OPC_EmitRegister2: {
+    MATCHER_CASE(OPC_EmitRegister2): {
       // For targets w/ more than 256 register names, the register enum
       // values are stored in two bytes in the matcher table (just like
       // opcodes).
@@ -3221,7 +3378,7 @@ void SelectionDAGISel::SelectCodeCommon(SDNode *NodeToMatch,
       continue;
     }
 
-    case OPC_EmitConvertToTarget:  {
+    MATCHER_CASE(OPC_EmitConvertToTarget):  {
       // Convert from IMM/FPIMM to target version.
       unsigned RecNo = MatcherTable[MatcherIndex++];
       assert(RecNo < RecordedNodes.size() && "Invalid EmitConvertToTarget");
@@ -3243,7 +3400,7 @@ void SelectionDAGISel::SelectCodeCommon(SDNode *NodeToMatch,
 
     case OPC_EmitMergeInputChains1_0:    // OPC_EmitMergeInputChains, 1, 0
     case OPC_EmitMergeInputChains1_1:    // OPC_EmitMergeInputChains, 1, 1
-    case OPC_EmitMergeInputChains1_2: {  // OPC_EmitMergeInputChains, 1, 2
+    MATCHER_CASE(OPC_EmitMergeInputChains1_2): {  // OPC_EmitMergeInputChains, 1, 2
       // These are space-optimized forms of OPC_EmitMergeInputChains.
       assert(!InputChain.getNode() &&
              "EmitMergeInputChains should be the first chain producing node");
@@ -3271,7 +3428,7 @@ void SelectionDAGISel::SelectCodeCommon(SDNode *NodeToMatch,
       continue;
     }
 
-    case OPC_EmitMergeInputChains: {
+    MATCHER_CASE(OPC_EmitMergeInputChains): {
       assert(!InputChain.getNode() &&
              "EmitMergeInputChains should be the first chain producing node");
       // This node gets a list of nodes we matched in the input that have
@@ -3314,7 +3471,7 @@ void SelectionDAGISel::SelectCodeCommon(SDNode *NodeToMatch,
       continue;
     }
 
-    case OPC_EmitCopyToReg: {
+    MATCHER_CASE(OPC_EmitCopyToReg): {
       unsigned RecNo = MatcherTable[MatcherIndex++];
       assert(RecNo < RecordedNodes.size() && "Invalid EmitCopyToReg");
       unsigned DestPhysReg = MatcherTable[MatcherIndex++];
@@ -3330,7 +3487,7 @@ void SelectionDAGISel::SelectCodeCommon(SDNode *NodeToMatch,
       continue;
     }
 
-    case OPC_EmitNodeXForm: {
+    MATCHER_CASE(OPC_EmitNodeXForm): {
       unsigned XFormNo = MatcherTable[MatcherIndex++];
       unsigned RecNo = MatcherTable[MatcherIndex++];
       assert(RecNo < RecordedNodes.size() && "Invalid EmitNodeXForm");
@@ -3338,7 +3495,7 @@ void SelectionDAGISel::SelectCodeCommon(SDNode *NodeToMatch,
       RecordedNodes.push_back(std::pair<SDValue,SDNode*>(Res, nullptr));
       continue;
     }
-    case OPC_Coverage: {
+    MATCHER_CASE(OPC_Coverage): {
       // This is emitted right before MorphNode/EmitNode.
       // So it should be safe to assume that this node has been selected
       unsigned index = MatcherTable[MatcherIndex++];
@@ -3350,7 +3507,7 @@ void SelectionDAGISel::SelectCodeCommon(SDNode *NodeToMatch,
 
     case OPC_EmitNode:     case OPC_MorphNodeTo:
     case OPC_EmitNode0:    case OPC_EmitNode1:    case OPC_EmitNode2:
-    case OPC_MorphNodeTo0: case OPC_MorphNodeTo1: case OPC_MorphNodeTo2: {
+    case OPC_MorphNodeTo0: case OPC_MorphNodeTo1: MATCHER_CASE(OPC_MorphNodeTo2): {
       uint16_t TargetOpc = MatcherTable[MatcherIndex++];
       TargetOpc |= (unsigned short)MatcherTable[MatcherIndex++] << 8;
       unsigned EmitNodeInfo = MatcherTable[MatcherIndex++];
@@ -3522,7 +3679,7 @@ void SelectionDAGISel::SelectCodeCommon(SDNode *NodeToMatch,
       continue;
     }
 
-    case OPC_CompleteMatch: {
+    MATCHER_CASE(OPC_CompleteMatch): {
       // The match has been completed, and any new nodes (if any) have been
       // created.  Patch up references to the matched dag to use the newly
       // created nodes.
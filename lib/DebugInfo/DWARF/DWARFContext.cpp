@@ -368,6 +368,27 @@ const DWARFDebugAranges *DWARFContext::getDebugAranges() {
   return Aranges.get();
 }
 
+void DWARFContext::parseDIEsParallel(unsigned NumThreads) {
+  if (Aranges)
+    return;
+
+  Aranges.reset(new DWARFDebugAranges());
+  Aranges->generateParallel(this, NumThreads);
+}
+
+bool DWARFContext::loadAddressIndex(StringRef Data) {
+  auto NewAranges = llvm::make_unique<DWARFDebugAranges>();
+  if (!NewAranges->deserialize(Data))
+    return false;
+  Aranges = std::move(NewAranges);
+  return true;
+}
+
+void DWARFContext::writeAddressIndex(raw_ostream &OS) {
+  getDebugAranges();
+  Aranges->serialize(OS);
+}
+
 const DWARFDebugFrame *DWARFContext::getDebugFrame() {
   if (DebugFrame)
     return DebugFrame.get();
@@ -12,10 +12,14 @@
 #include "llvm/DebugInfo/DWARF/DWARFContext.h"
 #include "llvm/DebugInfo/DWARF/DWARFDebugArangeSet.h"
 #include "llvm/Support/DataExtractor.h"
+#include "llvm/Support/EndianStream.h"
+#include "llvm/Support/ThreadPool.h"
 #include <algorithm>
 #include <cassert>
 #include <cstdint>
+#include <mutex>
 #include <set>
+#include <thread>
 #include <vector>
 
 using namespace llvm;
@@ -63,6 +67,45 @@ void DWARFDebugAranges::generate(DWARFContext *CTX) {
   construct();
 }
 
+void DWARFDebugAranges::generateParallel(DWARFContext *CTX,
+                                         unsigned NumThreads) {
+  clear();
+  if (!CTX)
+    return;
+
+  // Extract aranges from .debug_aranges section.
+  DataExtractor ArangesData(CTX->getARangeSection(), CTX->isLittleEndian(), 0);
+  extract(ArangesData);
+
+  // Parse the DIEs of the remaining compile units on a thread pool. The units
+  // are independent: iterating compile_units() parses all unit headers and
+  // resolves their abbreviation sets up front, so the workers only read
+  // shared state and append to this index under a lock. getNumDIEs() parses
+  // the unit's DIEs before collectAddressRanges so that the latter does not
+  // throw them away again; keeping them extracted is the point of warming up
+  // the context here.
+  ThreadPool Pool(NumThreads ? NumThreads
+                             : std::thread::hardware_concurrency());
+  std::mutex AppendMutex;
+  for (const auto &CU : CTX->compile_units()) {
+    uint32_t CUOffset = CU->getOffset();
+    if (!ParsedCUOffsets.insert(CUOffset).second)
+      continue;
+    DWARFCompileUnit *Unit = CU.get();
+    Pool.async([this, Unit, CUOffset, &AppendMutex] {
+      Unit->getNumDIEs();
+      DWARFAddressRangesVector CURanges;
+      Unit->collectAddressRanges(CURanges);
+      std::lock_guard<std::mutex> Guard(AppendMutex);
+      for (const auto &R : CURanges)
+        appendRange(CUOffset, R.first, R.second);
+    });
+  }
+  Pool.wait();
+
+  construct();
+}
+
 void DWARFDebugAranges::clear() {
   Endpoints.clear();
   Aranges.clear();
@@ -111,6 +154,53 @@ void DWARFDebugAranges::construct() {
   EmptyEndpoints.swap(Endpoints);
 }
 
+// On-disk format: "DWAI" magic, a format version, the entry count, and the
+// sorted Range entries, all fixed-width little-endian.
+static const uint32_t IndexMagic = 0x44574149; // "DWAI"
+static const uint32_t IndexVersion = 1;
+
+void DWARFDebugAranges::serialize(raw_ostream &OS) const {
+  assert(Endpoints.empty() && "Index has not been constructed yet");
+  support::endian::Writer<support::little> W(OS);
+  W.write(IndexMagic);
+  W.write(IndexVersion);
+  W.write(static_cast<uint64_t>(Aranges.size()));
+  for (const Range &R : Aranges) {
+    W.write(R.LowPC);
+    W.write(R.Length);
+    W.write(R.CUOffset);
+  }
+}
+
+bool DWARFDebugAranges::deserialize(StringRef Data) {
+  clear();
+  DataExtractor DE(Data, /*IsLittleEndian=*/true, /*AddressSize=*/0);
+  uint32_t Offset = 0;
+  if (DE.getU32(&Offset) != IndexMagic || DE.getU32(&Offset) != IndexVersion)
+    return false;
+  uint64_t Count = DE.getU64(&Offset);
+  const uint64_t EntrySize = 16; // LowPC, Length, CUOffset.
+  if (Count > (Data.size() - Offset) / EntrySize ||
+      Data.size() - Offset != Count * EntrySize)
+    return false;
+  Aranges.reserve(Count);
+  uint64_t PrevLowPC = 0;
+  for (uint64_t I = 0; I != Count; ++I) {
+    Range R;
+    R.LowPC = DE.getU64(&Offset);
+    R.Length = DE.getU32(&Offset);
+    R.CUOffset = DE.getU32(&Offset);
+    // findAddress relies on the ranges being sorted and non-empty.
+    if (R.Length == 0 || (I != 0 && R.LowPC < PrevLowPC)) {
+      clear();
+      return false;
+    }
+    PrevLowPC = R.LowPC;
+    Aranges.push_back(R);
+  }
+  return true;
+}
+
 uint32_t DWARFDebugAranges::findAddress(uint64_t Address) const {
   if (!Aranges.empty()) {
     Range range(Address);
@@ -228,6 +228,15 @@ size_t DWARFUnit::extractDIEsIfNeeded(bool CUDieOnly) {
       DieArray.size() > 1)
     return 0; // Already parsed.
 
+  // While this unit's DIEs are parsed, ask the OS to start faulting in the
+  // following unit's contribution: in cold-cache symbolization this is the
+  // first touch of the mapped debug section, and the readahead overlaps disk
+  // latency with parsing. The next unit's length isn't known before its
+  // header is read, so use this unit's size as the estimate.
+  if (!CUDieOnly)
+    getDebugInfoExtractor().prefetch(getNextUnitOffset(),
+                                     getNextUnitOffset() - getOffset());
+
   bool HasCUDie = !DieArray.empty();
   extractDIEsToVector(!HasCUDie, !CUDieOnly, DieArray);
 
@@ -117,7 +117,7 @@ Error MappedBlockStream::readBytes(uint32_t Offset, uint32_t Size,
       continue;
     // If the initial extent of the cached item is beyond the ending extent
     // of the request, there is no overlap.
-    if (CacheItem.first >= Offset + Size)
+    if (CacheItem.first >= RequestExtent.second)
       continue;
 
     // We really only have to check the last item in the list, since we append
@@ -130,7 +130,7 @@ Error MappedBlockStream::readBytes(uint32_t Offset, uint32_t Size,
     // the cached item, there is no overlap.
     Interval CachedExtent =
         std::make_pair(CacheItem.first, CacheItem.first + CachedAlloc.size());
-    if (RequestExtent.first >= CachedExtent.first + CachedExtent.second)
+    if (RequestExtent.first >= CachedExtent.second)
       continue;
 
     Interval Intersection = intersect(CachedExtent, RequestExtent);
@@ -274,7 +274,14 @@ uint32_t MappedBlockStream::getNumBytesCopied() const {
   return static_cast<uint32_t>(Pool.getBytesAllocated());
 }
 
-void MappedBlockStream::invalidateCache() { CacheMap.shrink_and_clear(); }
+void MappedBlockStream::invalidateCache() {
+  CacheMap.shrink_and_clear();
+  // Release the memory backing the cached copies as well.  Without this a
+  // long-running consumer that periodically invalidates (e.g. a dumper
+  // walking a large PDB stream by stream) retains every reassembled buffer
+  // it ever produced for the lifetime of the stream.
+  Pool.Reset();
+}
 
 void MappedBlockStream::fixCacheAfterWrite(uint32_t Offset,
                                            ArrayRef<uint8_t> Data) const {
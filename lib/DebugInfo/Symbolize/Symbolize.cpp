@@ -26,8 +26,11 @@
 #include "llvm/Object/MachOUniversal.h"
 #include "llvm/Support/COFF.h"
 #include "llvm/Support/Casting.h"
+#include "llvm/Support/Chrono.h"
 #include "llvm/Support/Compression.h"
 #include "llvm/Support/DataExtractor.h"
+#include "llvm/Support/Endian.h"
+#include "llvm/Support/EndianStream.h"
 #include "llvm/Support/Errc.h"
 #include "llvm/Support/FileSystem.h"
 #include "llvm/Support/MemoryBuffer.h"
@@ -361,6 +364,52 @@ LLVMSymbolizer::getOrCreateObject(const std::string &Path,
   return errorCodeToError(object_error::arch_not_found);
 }
 
+// Load the cached DWARF address index stored beside \p BinaryPath into
+// \p DICtx, or build the index and write the cache if it is missing or
+// stale. The cache is keyed on the binary's size and modification time;
+// any failure (unwritable directory, malformed cache, ...) just falls back
+// to building the index in memory on first use.
+static void loadOrCreateAddressIndex(DWARFContext &DICtx,
+                                     StringRef BinaryPath) {
+  sys::fs::file_status Stat;
+  if (sys::fs::status(BinaryPath, Stat))
+    return;
+  uint64_t BinarySize = Stat.getSize();
+  uint64_t BinaryMTime =
+      static_cast<uint64_t>(sys::toTimeT(Stat.getLastModificationTime()));
+
+  SmallString<128> CachePath(BinaryPath);
+  CachePath += ".llvm-addr-index";
+
+  // The cache is the binary's size and mtime followed by the serialized
+  // index; getFile maps large caches rather than reading them.
+  if (auto BufOrErr = MemoryBuffer::getFile(CachePath, /*FileSize=*/-1,
+                                            /*RequiresNullTerminator=*/false)) {
+    StringRef Data = (*BufOrErr)->getBuffer();
+    if (Data.size() > 16 &&
+        support::endian::read64le(Data.data()) == BinarySize &&
+        support::endian::read64le(Data.data() + 8) == BinaryMTime &&
+        DICtx.loadAddressIndex(Data.substr(16)))
+      return;
+  }
+
+  // Build the index and write the cache through a unique temporary file so
+  // that concurrent symbolizers never observe a half-written cache.
+  int FD;
+  SmallString<128> TmpPath;
+  if (sys::fs::createUniqueFile(CachePath + ".tmp%%%%%%", FD, TmpPath))
+    return;
+  {
+    raw_fd_ostream OS(FD, /*shouldClose=*/true);
+    support::endian::Writer<support::little> W(OS);
+    W.write(BinarySize);
+    W.write(BinaryMTime);
+    DICtx.writeAddressIndex(OS);
+  }
+  if (sys::fs::rename(TmpPath, CachePath))
+    sys::fs::remove(TmpPath);
+}
+
 Expected<SymbolizableModule *>
 LLVMSymbolizer::getOrCreateModuleInfo(const std::string &ModuleName) {
   const auto &I = Modules.find(ModuleName);
@@ -406,8 +455,12 @@ LLVMSymbolizer::getOrCreateModuleInfo(const std::string &ModuleName) {
       Context.reset(new PDBContext(*CoffObject, std::move(Session)));
     }
   }
-  if (!Context)
-    Context.reset(new DWARFContextInMemory(*Objects.second));
+  if (!Context) {
+    auto *DICtx = new DWARFContextInMemory(*Objects.second);
+    Context.reset(DICtx);
+    if (Opts.CacheDWARFIndex)
+      loadOrCreateAddressIndex(*DICtx, Objects.second->getFileName());
+  }
   assert(Context);
   auto InfoOrErr =
       SymbolizableObjectFile::create(Objects.first, std::move(Context));
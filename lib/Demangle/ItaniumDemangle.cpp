@@ -4248,18 +4248,34 @@ struct Db {
   bool try_to_parse_template_args = true;
 
   Db() : subs(0, names), template_param(0, subs) {}
+
+  // Return the state to that of a freshly constructed Db, but keep the
+  // storage the tables have already grown, so a Db can be reused across
+  // calls when demangling in bulk.
+  void reset() {
+    names.clear();
+    subs.clear();
+    template_param.clear();
+    cv = 0;
+    ref = 0;
+    encoding_depth = 0;
+    parsed_ctor_dtor_cv = false;
+    tag_templates = true;
+    fix_forward_references = false;
+    try_to_parse_template_args = true;
+  }
 };
 }
 
-char *llvm::itaniumDemangle(const char *mangled_name, char *buf, size_t *n,
-                            int *status) {
-  if (mangled_name == nullptr || (buf != nullptr && n == nullptr)) {
-    if (status)
-      *status = invalid_args;
-    return nullptr;
-  }
-  size_t internal_size = buf != nullptr ? *n : 0;
+namespace llvm {
+struct ItaniumDemangleContext {
   Db db;
+};
+}
+
+static char *itanium_demangle(Db &db, const char *mangled_name, char *buf,
+                              size_t *n, int *status) {
+  size_t internal_size = buf != nullptr ? *n : 0;
   db.template_param.emplace_back();
   int internal_status = success;
   size_t len = std::strlen(mangled_name);
@@ -4298,3 +4314,35 @@ char *llvm::itaniumDemangle(const char *mangled_name, char *buf, size_t *n,
     *status = internal_status;
   return buf;
 }
+
+char *llvm::itaniumDemangle(const char *mangled_name, char *buf, size_t *n,
+                            int *status) {
+  if (mangled_name == nullptr || (buf != nullptr && n == nullptr)) {
+    if (status)
+      *status = invalid_args;
+    return nullptr;
+  }
+  Db db;
+  return itanium_demangle(db, mangled_name, buf, n, status);
+}
+
+llvm::ItaniumDemangleContext *llvm::itaniumDemangleContextCreate() {
+  return new ItaniumDemangleContext();
+}
+
+void llvm::itaniumDemangleContextDestroy(ItaniumDemangleContext *Context) {
+  delete Context;
+}
+
+char *llvm::itaniumDemangle(ItaniumDemangleContext *Context,
+                            const char *mangled_name, char *buf, size_t *n,
+                            int *status) {
+  if (Context == nullptr || mangled_name == nullptr ||
+      (buf != nullptr && n == nullptr)) {
+    if (status)
+      *status = invalid_args;
+    return nullptr;
+  }
+  Context->db.reset();
+  return itanium_demangle(Context->db, mangled_name, buf, n, status);
+}
@@ -2054,15 +2054,15 @@ GenericValue Interpreter::getConstantExprValue (ConstantExpr *CE,
 }
 
 GenericValue Interpreter::getOperandValue(Value *V, ExecutionContext &SF) {
-  if (ConstantExpr *CE = dyn_cast<ConstantExpr>(V)) {
-    return getConstantExprValue(CE, SF);
-  } else if (Constant *CPV = dyn_cast<Constant>(V)) {
-    return getConstantValue(CPV);
-  } else if (GlobalValue *GV = dyn_cast<GlobalValue>(V)) {
-    return PTOGV(getPointerToGlobal(GV));
-  } else {
+  // Instruction results and arguments are by far the most common operands;
+  // test for them first so the typical read is a single hash lookup. Note
+  // that globals are Constants and have always been resolved through
+  // getConstantValue here.
+  if (!isa<Constant>(V))
     return SF.Values[V];
-  }
+  if (ConstantExpr *CE = dyn_cast<ConstantExpr>(V))
+    return getConstantExprValue(CE, SF);
+  return getConstantValue(cast<Constant>(V));
 }
 
 //===----------------------------------------------------------------------===//
@@ -28,6 +28,19 @@ JITSymbolFlags llvm::JITSymbolFlags::fromGlobalValue(const GlobalValue &GV) {
   return Flags;
 }
 
+std::vector<JITTargetAddress>
+JITSymbolResolver::findSymbols(ArrayRef<std::string> Names) {
+  std::vector<JITTargetAddress> Addrs;
+  Addrs.reserve(Names.size());
+  for (const std::string &Name : Names) {
+    JITTargetAddress Addr = findSymbolInLogicalDylib(Name).getAddress();
+    if (!Addr)
+      Addr = findSymbol(Name).getAddress();
+    Addrs.push_back(Addr);
+  }
+  return Addrs;
+}
+
 JITSymbolFlags
 llvm::JITSymbolFlags::fromObjectSymbol(const object::BasicSymbolRef &Symbol) {
   JITSymbolFlags Flags = JITSymbolFlags::None;
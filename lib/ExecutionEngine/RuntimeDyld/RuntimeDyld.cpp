@@ -948,60 +948,80 @@ void RuntimeDyldImpl::resolveRelocationList(const RelocationList &Relocs,
 }
 
 void RuntimeDyldImpl::resolveExternalSymbols() {
+  StringMap<JITTargetAddress> ResolvedSymbols;
+
   while (!ExternalSymbolRelocations.empty()) {
-    StringMap<RelocationList>::iterator i = ExternalSymbolRelocations.begin();
-
-    StringRef Name = i->first();
-    if (Name.size() == 0) {
-      // This is an absolute symbol, use an address of zero.
-      DEBUG(dbgs() << "Resolving absolute relocations."
-                   << "\n");
-      RelocationList &Relocs = i->second;
-      resolveRelocationList(Relocs, 0);
-    } else {
+    // Batch up every symbol in this round that has to go through the
+    // resolver. Absolute relocations and symbols defined by a previously
+    // loaded module are handled directly below.
+    std::vector<std::string> NewSymbols;
+    for (auto &RelocKV : ExternalSymbolRelocations) {
+      StringRef Name = RelocKV.first();
+      if (!Name.empty() && !GlobalSymbolTable.count(Name) &&
+          !ResolvedSymbols.count(Name))
+        NewSymbols.push_back(Name);
+    }
+
+    // Resolve the whole batch through a single resolver call. This may cause
+    // additional modules to be loaded, which may both add new entries to the
+    // ExternalSymbolRelocations map and append to the relocation lists of the
+    // symbols in this batch. The former are picked up by the next round of
+    // the outer loop, the latter by re-fetching each list below.
+    if (!NewSymbols.empty()) {
+      std::vector<JITTargetAddress> NewAddrs = Resolver.findSymbols(NewSymbols);
+      assert(NewAddrs.size() == NewSymbols.size() &&
+             "Resolver returned an unexpected number of addresses");
+      for (unsigned Idx = 0, End = NewSymbols.size(); Idx != End; ++Idx)
+        ResolvedSymbols[NewSymbols[Idx]] = NewAddrs[Idx];
+    }
+
+    // Apply and retire every relocation list whose symbol is now known.
+    // Symbols first referenced by modules the resolver call loaded stay in
+    // the map for the next round.
+    std::vector<std::string> Finished;
+    for (auto &RelocKV : ExternalSymbolRelocations) {
+      StringRef Name = RelocKV.first();
       uint64_t Addr = 0;
-      RTDyldSymbolTable::const_iterator Loc = GlobalSymbolTable.find(Name);
-      if (Loc == GlobalSymbolTable.end()) {
-        // This is an external symbol, try to get its address from the symbol
-        // resolver.
-        // First search for the symbol in this logical dylib.
-        Addr = Resolver.findSymbolInLogicalDylib(Name.data()).getAddress();
-        // If that fails, try searching for an external symbol.
-        if (!Addr)
-          Addr = Resolver.findSymbol(Name.data()).getAddress();
-        // The call to getSymbolAddress may have caused additional modules to
-        // be loaded, which may have added new entries to the
-        // ExternalSymbolRelocations map.  Consquently, we need to update our
-        // iterator.  This is also why retrieval of the relocation list
-        // associated with this symbol is deferred until below this point.
-        // New entries may have been added to the relocation list.
-        i = ExternalSymbolRelocations.find(Name);
+      if (Name.empty()) {
+        // This is an absolute symbol, use an address of zero.
+        DEBUG(dbgs() << "Resolving absolute relocations."
+                     << "\n");
       } else {
-        // We found the symbol in our global table.  It was probably in a
-        // Module that we loaded previously.
-        const auto &SymInfo = Loc->second;
-        Addr = getSectionLoadAddress(SymInfo.getSectionID()) +
-               SymInfo.getOffset();
-      }
+        RTDyldSymbolTable::const_iterator Loc = GlobalSymbolTable.find(Name);
+        if (Loc != GlobalSymbolTable.end()) {
+          // We found the symbol in our global table.  It was probably in a
+          // Module that we loaded previously.
+          const auto &SymInfo = Loc->second;
+          Addr = getSectionLoadAddress(SymInfo.getSectionID()) +
+                 SymInfo.getOffset();
+        } else {
+          StringMap<JITTargetAddress>::const_iterator RSI =
+              ResolvedSymbols.find(Name);
+          if (RSI == ResolvedSymbols.end())
+            continue;
+          Addr = RSI->second;
+        }
 
-      // FIXME: Implement error handling that doesn't kill the host program!
-      if (!Addr)
-        report_fatal_error("Program used external function '" + Name +
-                           "' which could not be resolved!");
+        // FIXME: Implement error handling that doesn't kill the host program!
+        if (!Addr)
+          report_fatal_error("Program used external function '" + Name +
+                             "' which could not be resolved!");
 
-      // If Resolver returned UINT64_MAX, the client wants to handle this symbol
-      // manually and we shouldn't resolve its relocations.
-      if (Addr != UINT64_MAX) {
+        // If the resolver returned UINT64_MAX, the client wants to handle
+        // this symbol manually and we shouldn't resolve its relocations.
+        if (Addr == UINT64_MAX) {
+          Finished.push_back(Name);
+          continue;
+        }
         DEBUG(dbgs() << "Resolving relocations Name: " << Name << "\t"
                      << format("0x%lx", Addr) << "\n");
-        // This list may have been updated when we called getSymbolAddress, so
-        // don't change this code to get the list earlier.
-        RelocationList &Relocs = i->second;
-        resolveRelocationList(Relocs, Addr);
       }
+      resolveRelocationList(RelocKV.second, Addr);
+      Finished.push_back(Name);
     }
 
-    ExternalSymbolRelocations.erase(i);
+    for (const std::string &Name : Finished)
+      ExternalSymbolRelocations.erase(Name);
   }
 }
 
@@ -15,6 +15,7 @@
 #include "FuzzerIO.h"
 #include "FuzzerMutate.h"
 #include "FuzzerRandom.h"
+#include "FuzzerSharedCoverage.h"
 #include "FuzzerShmem.h"
 #include "FuzzerTracePC.h"
 #include <algorithm>
@@ -202,12 +203,16 @@ static void PulseThread() {
 }
 
 static void WorkerThread(const std::string &Cmd, std::atomic<unsigned> *Counter,
-                         unsigned NumJobs, std::atomic<bool> *HasErrors) {
+                         unsigned NumJobs, unsigned BaseSeed,
+                         std::atomic<bool> *HasErrors) {
   while (true) {
     unsigned C = (*Counter)++;
     if (C >= NumJobs) break;
     std::string Log = "fuzz-" + std::to_string(C) + ".log";
-    std::string ToRun = Cmd + " > " + Log + " 2>&1\n";
+    // Hand each job its own seed so the workers don't replay the same
+    // mutation sequences.
+    std::string ToRun = Cmd + "-seed=" + std::to_string(BaseSeed + C + 1) +
+                        " > " + Log + " 2>&1\n";
     if (Flags.verbosity)
       Printf("%s", ToRun.c_str());
     int ExitCode = ExecuteCommand(ToRun);
@@ -235,14 +240,33 @@ static int RunInMultipleProcesses(const std::vector<std::string> &Args,
                                   unsigned NumWorkers, unsigned NumJobs) {
   std::atomic<unsigned> Counter(0);
   std::atomic<bool> HasErrors(false);
-  std::string Cmd = CloneArgsWithoutX(Args, "jobs", "workers");
+  // The seed is reissued per job (see WorkerThread), so drop any -seed the
+  // user passed from the command line we hand to the workers.
+  std::vector<std::string> ArgsNoSeed;
+  for (auto &S : Args)
+    if (!FlagValue(S.c_str(), "seed"))
+      ArgsNoSeed.push_back(S);
+  std::string Cmd = CloneArgsWithoutX(ArgsNoSeed, "jobs", "workers");
+  unsigned BaseSeed = Flags.seed;
+  if (BaseSeed == 0)
+    BaseSeed =
+        std::chrono::system_clock::now().time_since_epoch().count() + GetPid();
+  // Coordinate the workers through a shared feature bitmap so that they fuzz
+  // disjoint frontiers instead of re-discovering each other's coverage. If
+  // the region can't be created the workers simply run uncoordinated, as
+  // before.
+  std::string ShmemName = "FuzzerSharedCov" + std::to_string(GetPid());
+  if (SharedCov.Create(ShmemName.c_str()))
+    Cmd += "-shared_coverage=" + ShmemName + " ";
   std::vector<std::thread> V;
   std::thread Pulse(PulseThread);
   Pulse.detach();
   for (unsigned i = 0; i < NumWorkers; i++)
-    V.push_back(std::thread(WorkerThread, Cmd, &Counter, NumJobs, &HasErrors));
+    V.push_back(std::thread(WorkerThread, Cmd, &Counter, NumJobs, BaseSeed,
+                            &HasErrors));
   for (auto &T : V)
     T.join();
+  SharedCov.Destroy();
   return HasErrors ? 1 : 0;
 }
 
@@ -670,6 +694,15 @@ int FuzzerDriver(int *argc, char ***argv, UserCallback Callback) {
     Printf("INFO: EQUIVALENCE CLIENT UP\n");
   }
 
+  if (auto Name = Flags.shared_coverage) {
+    if (!SharedCov.Open(Name)) {
+      Printf("ERROR: can't open shared coverage bitmap %s\n", Name);
+      return 1;
+    }
+    if (Flags.verbosity)
+      Printf("INFO: sharing coverage through %s\n", Name);
+  }
+
   if (DoPlainRun) {
     Options.SaveArtifacts = false;
     int Runs = std::max(1, Flags.runs);
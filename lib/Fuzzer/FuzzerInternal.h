@@ -124,6 +124,9 @@ private:
 
   size_t TotalNumberOfRuns = 0;
   size_t NumberOfNewUnitsAdded = 0;
+  // Features the most recent RunOne was the first to claim in the shared
+  // coverage bitmap; 0 unless coverage sharing is active.
+  size_t LastRunNewSharedFeatures = 0;
 
   bool HasMoreMallocsThanFrees = false;
   size_t NumberOfLeakDetectionAttempts = 0;
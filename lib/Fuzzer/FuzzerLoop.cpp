@@ -14,6 +14,7 @@
 #include "FuzzerIO.h"
 #include "FuzzerMutate.h"
 #include "FuzzerRandom.h"
+#include "FuzzerSharedCoverage.h"
 #include "FuzzerShmem.h"
 #include "FuzzerTracePC.h"
 #include <algorithm>
@@ -397,7 +398,11 @@ size_t Fuzzer::RunOne(const uint8_t *Data, size_t Size) {
   ExecuteCallback(Data, Size);
 
   size_t NumUpdatesBefore = Corpus.NumFeatureUpdates();
+  bool ShareCoverage = SharedCov.IsActive();
+  LastRunNewSharedFeatures = 0;
   TPC.CollectFeatures([&](size_t Feature) {
+    if (ShareCoverage && SharedCov.ClaimFeature(Feature))
+      LastRunNewSharedFeatures++;
     Corpus.AddFeature(Feature, Size, Options.Shrink);
   });
   size_t NumUpdatesAfter = Corpus.NumFeatureUpdates();
@@ -574,10 +579,15 @@ void Fuzzer::MutateAndTestOne() {
       StartTraceRecording();
     II.NumExecutedMutations++;
     if (size_t NumFeatures = RunOne(CurrentUnitData, Size)) {
-      Corpus.AddToCorpus({CurrentUnitData, CurrentUnitData + Size}, NumFeatures,
-                         /*MayDeleteFile=*/true);
-      ReportNewCoverage(&II, {CurrentUnitData, CurrentUnitData + Size});
-      CheckExitOnSrcPosOrItem();
+      // When coverage is shared between -jobs workers, leave inputs whose
+      // features have all been claimed by other workers to those workers;
+      // keeping them here would just duplicate their exploration.
+      if (!SharedCov.IsActive() || LastRunNewSharedFeatures) {
+        Corpus.AddToCorpus({CurrentUnitData, CurrentUnitData + Size},
+                           NumFeatures, /*MayDeleteFile=*/true);
+        ReportNewCoverage(&II, {CurrentUnitData, CurrentUnitData + Size});
+        CheckExitOnSrcPosOrItem();
+      }
     }
     StopTraceRecording();
     TryDetectingAMemoryLeak(CurrentUnitData, Size,
@@ -0,0 +1,46 @@
+//===- FuzzerSharedCoverage.cpp - shared feature bitmap ---------*- C++ -* ===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+// SharedFeatureBitmap
+//===----------------------------------------------------------------------===//
+
+#include "FuzzerSharedCoverage.h"
+
+#include <cstring>
+
+namespace fuzzer {
+
+SharedFeatureBitmap SharedCov;
+
+bool SharedFeatureBitmap::Create(const char *Name) {
+  // Remove any stale region left behind by a crashed run.
+  Shmem.Destroy(Name);
+  if (!Shmem.Create(Name))
+    return false;
+  memset(Shmem.GetData(), 0, kNumFeatures / 8);
+  Map = reinterpret_cast<std::atomic<uint8_t> *>(Shmem.GetData());
+  CreatedName = Name;
+  return true;
+}
+
+bool SharedFeatureBitmap::Open(const char *Name) {
+  if (!Shmem.Open(Name))
+    return false;
+  Map = reinterpret_cast<std::atomic<uint8_t> *>(Shmem.GetData());
+  return true;
+}
+
+void SharedFeatureBitmap::Destroy() {
+  if (CreatedName.empty())
+    return;
+  Shmem.Destroy(CreatedName.c_str());
+  CreatedName.clear();
+  Map = nullptr;
+}
+
+}  // namespace fuzzer
@@ -0,0 +1,65 @@
+//===- FuzzerSharedCoverage.h - shared feature bitmap -----------*- C++ -* ===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+// SharedFeatureBitmap
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_FUZZER_SHARED_COVERAGE_H
+#define LLVM_FUZZER_SHARED_COVERAGE_H
+
+#include "FuzzerShmem.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace fuzzer {
+
+// A feature bitmap in shared memory used to coordinate -jobs workers.
+// The parent process creates the region and passes its name to every worker
+// via -shared_coverage. Workers atomically claim every feature they observe;
+// only the first worker to claim a feature keeps the input that produced it,
+// so the workers spread out over disjoint parts of the search space instead
+// of all re-discovering the same coverage.
+class SharedFeatureBitmap {
+ public:
+  // Number of feature bits tracked; matches InputCorpus::kFeatureSetSize so
+  // that the global and the per-process feature sets alias the same way.
+  static const size_t kNumFeatures = 1 << 21;
+
+  // Create the region (parent process). Returns false on failure, in which
+  // case the workers simply run uncoordinated.
+  bool Create(const char *Name);
+  // Attach to an existing region (worker process).
+  bool Open(const char *Name);
+  // Remove the region; only meaningful in the process that created it.
+  void Destroy();
+
+  bool IsActive() const { return Map != nullptr; }
+
+  // Atomically set the bit for Feature. Returns true if this call was the
+  // first, across all participating processes, to observe the feature.
+  bool ClaimFeature(size_t Feature) {
+    Feature %= kNumFeatures;
+    uint8_t Mask = 1 << (Feature % 8);
+    uint8_t Old = Map[Feature / 8].fetch_or(Mask, std::memory_order_relaxed);
+    return !(Old & Mask);
+  }
+
+ private:
+  SharedMemoryRegion Shmem;
+  std::atomic<uint8_t> *Map = nullptr;
+  std::string CreatedName;
+};
+
+extern SharedFeatureBitmap SharedCov;
+
+}  // namespace fuzzer
+
+#endif  // LLVM_FUZZER_SHARED_COVERAGE_H
@@ -218,6 +218,10 @@ private:
   unsigned NumSlots; ///< Number of entries in this set.
   /// Bitset with a bit for each available attribute Attribute::AttrKind.
   uint64_t AvailableFunctionAttrs;
+  /// Like AvailableFunctionAttrs, but summarizing the enum attributes of
+  /// every slot, so negative hasAttrSomewhere/hasAttribute queries do not
+  /// have to search the slots at all.
+  uint64_t AvailableSomewhereAttrs;
 
   // Helper fn for TrailingObjects class.
   size_t numTrailingObjects(OverloadToken<IndexAttrPair>) { return NumSlots; }
@@ -265,6 +269,12 @@ public:
     return AvailableFunctionAttrs & ((uint64_t)1) << Kind;
   }
 
+  /// \brief Return true if any slot has an enum attribute of the given kind.
+  /// This is a summary bit test; it never walks the slots.
+  bool hasAttrSomewhere(Attribute::AttrKind Kind) const {
+    return AvailableSomewhereAttrs & ((uint64_t)1) << Kind;
+  }
+
   typedef AttributeSet::iterator iterator;
   iterator begin(unsigned Slot) const {
     return getSlotAttributes(Slot).begin();
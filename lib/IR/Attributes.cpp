@@ -720,7 +720,8 @@ std::string AttributeSetNode::getAsString(bool InAttrGrp) const {
 
 AttributeListImpl::AttributeListImpl(
     LLVMContext &C, ArrayRef<std::pair<unsigned, AttributeSet>> Slots)
-    : Context(C), NumSlots(Slots.size()), AvailableFunctionAttrs(0) {
+    : Context(C), NumSlots(Slots.size()), AvailableFunctionAttrs(0),
+      AvailableSomewhereAttrs(0) {
 #ifndef NDEBUG
   assert(!Slots.empty() && "pointless AttributeListImpl");
   if (Slots.size() >= 2) {
@@ -748,6 +749,12 @@ AttributeListImpl::AttributeListImpl(
         AvailableFunctionAttrs |= ((uint64_t)1) << I.getKindAsEnum();
     }
   }
+
+  // Initialize the AvailableSomewhereAttrs summary bitset over every slot.
+  for (const auto &Pair : Slots)
+    for (Attribute I : Pair.second)
+      if (!I.isStringAttribute())
+        AvailableSomewhereAttrs |= ((uint64_t)1) << I.getKindAsEnum();
 }
 
 void AttributeListImpl::Profile(FoldingSetNodeID &ID) const {
@@ -1141,6 +1148,10 @@ AttributeSet AttributeList::getFnAttributes() const {
 
 bool AttributeList::hasAttribute(unsigned Index,
                                  Attribute::AttrKind Kind) const {
+  // The common answer is "no": reject with a bit test on the summary mask
+  // before paying for the slot search.
+  if (!pImpl || !pImpl->hasAttrSomewhere(Kind))
+    return false;
   return getAttributes(Index).hasAttribute(Kind);
 }
 
@@ -1167,8 +1178,11 @@ bool AttributeList::hasParamAttribute(unsigned ArgNo,
 
 bool AttributeList::hasAttrSomewhere(Attribute::AttrKind Attr,
                                      unsigned *Index) const {
-  if (!pImpl) return false;
+  if (!pImpl || !pImpl->hasAttrSomewhere(Attr))
+    return false;
 
+  // The summary bit says the attribute is present; walk the slots only to
+  // find which index carries it.
   for (unsigned I = 0, E = pImpl->getNumSlots(); I != E; ++I)
     for (AttributeListImpl::iterator II = pImpl->begin(I), IE = pImpl->end(I);
          II != IE; ++II)
@@ -537,7 +537,10 @@ Constant *ConstantInt::getFalse(Type *Ty) {
 ConstantInt *ConstantInt::get(LLVMContext &Context, const APInt &V) {
   // get an existing value or the insertion position
   LLVMContextImpl *pImpl = Context.pImpl;
-  std::unique_ptr<ConstantInt> &Slot = pImpl->IntConstants[V];
+  unsigned Shard = pImpl->IntConstants.getShard(V);
+  LLVMContextImpl::OptionalShardLock Lock(pImpl->IntConstants.ShardLocks[Shard],
+                                          pImpl->ConcurrentConstantUniquing);
+  std::unique_ptr<ConstantInt> &Slot = pImpl->IntConstants.Shards[Shard][V];
   if (!Slot) {
     // Get the corresponding integer type for the bit width of the value.
     IntegerType *ITy = IntegerType::get(Context, V.getBitWidth());
@@ -677,7 +680,10 @@ Constant *ConstantFP::getZeroValueForNegation(Type *Ty) {
 ConstantFP* ConstantFP::get(LLVMContext &Context, const APFloat& V) {
   LLVMContextImpl* pImpl = Context.pImpl;
 
-  std::unique_ptr<ConstantFP> &Slot = pImpl->FPConstants[V];
+  unsigned Shard = pImpl->FPConstants.getShard(V);
+  LLVMContextImpl::OptionalShardLock Lock(pImpl->FPConstants.ShardLocks[Shard],
+                                          pImpl->ConcurrentConstantUniquing);
+  std::unique_ptr<ConstantFP> &Slot = pImpl->FPConstants.Shards[Shard][V];
 
   if (!Slot) {
     Type *Ty;
@@ -47,10 +47,18 @@ DILocation *DILocation::getImpl(LLVMContext &Context, unsigned Line,
   adjustColumn(Column);
 
   if (Storage == Uniqued) {
+    // Locations are requested in long runs repeating the same key, so check
+    // the last uniqued node before hashing into the store.
+    if (auto *L = Context.pImpl->LastDILocation)
+      if (L->getLine() == Line && L->getColumn() == Column &&
+          L->getRawScope() == Scope && L->getRawInlinedAt() == InlinedAt)
+        return L;
     if (auto *N =
             getUniqued(Context.pImpl->DILocations,
-                       DILocationInfo::KeyTy(Line, Column, Scope, InlinedAt)))
+                       DILocationInfo::KeyTy(Line, Column, Scope, InlinedAt))) {
+      Context.pImpl->LastDILocation = N;
       return N;
+    }
     if (!ShouldCreate)
       return nullptr;
   } else {
@@ -61,9 +69,12 @@ DILocation *DILocation::getImpl(LLVMContext &Context, unsigned Line,
   Ops.push_back(Scope);
   if (InlinedAt)
     Ops.push_back(InlinedAt);
-  return storeImpl(new (Ops.size())
-                       DILocation(Context, Storage, Line, Column, Ops),
-                   Storage, Context.pImpl->DILocations);
+  auto *N = storeImpl(new (Ops.size())
+                          DILocation(Context, Storage, Line, Column, Ops),
+                      Storage, Context.pImpl->DILocations);
+  if (Storage == Uniqued)
+    Context.pImpl->LastDILocation = N;
+  return N;
 }
 
 DINode::DIFlags DINode::getFlag(StringRef Flag) {
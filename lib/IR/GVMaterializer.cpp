@@ -13,6 +13,14 @@
 //===----------------------------------------------------------------------===//
 
 #include "llvm/IR/GVMaterializer.h"
+#include "llvm/Support/Error.h"
 using namespace llvm;
 
 GVMaterializer::~GVMaterializer() {}
+
+Error GVMaterializer::materialize(ArrayRef<GlobalValue *> GVs) {
+  for (GlobalValue *GV : GVs)
+    if (Error Err = materialize(GV))
+      return Err;
+  return Error::success();
+}
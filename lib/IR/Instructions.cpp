@@ -103,6 +103,9 @@ PHINode::PHINode(const PHINode &PN)
 Value *PHINode::removeIncomingValue(unsigned Idx, bool DeletePHIIfEmpty) {
   Value *Removed = getIncomingValue(Idx);
 
+  // Every block past Idx changes position.
+  invalidateBlockIndexCache();
+
   // Move everything after this operand down.
   //
   // FIXME: we could just swap with the end of the list, then erase.  However,
@@ -124,6 +127,15 @@ Value *PHINode::removeIncomingValue(unsigned Idx, bool DeletePHIIfEmpty) {
   return Removed;
 }
 
+void PHINode::buildBlockIndexCache() const {
+  BlockIndexCache = new DenseMap<const BasicBlock *, unsigned>();
+  BlockIndexCache->reserve(getNumOperands());
+  // insert() keeps the first entry for a block listed more than once,
+  // matching the answer the linear scan would give.
+  for (unsigned i = 0, e = getNumOperands(); i != e; ++i)
+    BlockIndexCache->insert(std::make_pair(block_begin()[i], i));
+}
+
 /// growOperands - grow operands - This grows the operand list in response
 /// to a push_back style of operation.  This grows the number of ops by 1.5
 /// times.
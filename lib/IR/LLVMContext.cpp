@@ -285,6 +285,22 @@ void LLVMContext::setDiscardValueNames(bool Discard) {
   pImpl->DiscardValueNames = Discard;
 }
 
+bool LLVMContext::hasConcurrentConstantUniquing() const {
+  return pImpl->ConcurrentConstantUniquing;
+}
+
+void LLVMContext::setConcurrentConstantUniquing(bool Enable) {
+  pImpl->ConcurrentConstantUniquing = Enable;
+}
+
+bool LLVMContext::hasConcurrentTypeUniquing() const {
+  return pImpl->ConcurrentTypeUniquing;
+}
+
+void LLVMContext::setConcurrentTypeUniquing(bool Enable) {
+  pImpl->ConcurrentTypeUniquing = Enable;
+}
+
 OptBisect &LLVMContext::getOptBisect() {
   return pImpl->getOptBisect();
 }
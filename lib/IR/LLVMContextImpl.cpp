@@ -22,7 +22,8 @@
 using namespace llvm;
 
 LLVMContextImpl::LLVMContextImpl(LLVMContext &C)
-  : TheTrueVal(nullptr), TheFalseVal(nullptr),
+  : LastDILocation(nullptr),
+    TheTrueVal(nullptr), TheFalseVal(nullptr),
     VoidTy(C, Type::VoidTyID),
     LabelTy(C, Type::LabelTyID),
     HalfTy(C, Type::HalfTyID),
@@ -48,6 +49,8 @@ LLVMContextImpl::LLVMContextImpl(LLVMContext &C)
   DiagnosticHotnessRequested = false;
   YieldCallback = nullptr;
   YieldOpaqueHandle = nullptr;
+  ConcurrentConstantUniquing = false;
+  ConcurrentTypeUniquing = false;
   NamedStructTypesUniqueID = 0;
 }
 
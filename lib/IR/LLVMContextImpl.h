@@ -34,6 +34,8 @@
 #include "llvm/IR/Metadata.h"
 #include "llvm/IR/ValueHandle.h"
 #include "llvm/Support/Dwarf.h"
+#include "llvm/Support/Mutex.h"
+#include "llvm/Support/RWMutex.h"
 #include "llvm/Support/YAMLTraits.h"
 #include <vector>
 
@@ -1114,13 +1116,100 @@ public:
   LLVMContext::YieldCallbackTy YieldCallback;
   void *YieldOpaqueHandle;
 
+  /// A sharded uniquing table for scalar constants.
+  ///
+  /// During parallel ThinLTO importing several threads materialize constants
+  /// into a single context.  Sharding the ConstantInt/ConstantFP tables by
+  /// key hash lets those threads proceed mostly without contention.  The
+  /// per-shard locks are only taken when the context has concurrent constant
+  /// uniquing enabled, so the default single-threaded path pays nothing.
+  template <typename MapTy, typename KeyTy> struct ShardedConstantMap {
+    enum { NumShards = 16 };
+    MapTy Shards[NumShards];
+    sys::SmartMutex<true> ShardLocks[NumShards];
+
+    static unsigned getShard(const KeyTy &Key) {
+      return static_cast<unsigned>(hash_value(Key)) & (NumShards - 1);
+    }
+
+    void clear() {
+      for (MapTy &Shard : Shards)
+        Shard.clear();
+    }
+  };
+
+  /// Lock guard for a constant shard that only engages when the context is
+  /// in concurrent uniquing mode.
+  class OptionalShardLock {
+    sys::SmartMutex<true> *M;
+
+  public:
+    OptionalShardLock(sys::SmartMutex<true> &M, bool Enable)
+        : M(Enable ? &M : nullptr) {
+      if (this->M)
+        this->M->lock();
+    }
+    ~OptionalShardLock() {
+      if (M)
+        M->unlock();
+    }
+  };
+
+  /// When true, lookups in the scalar constant tables take their shard lock
+  /// so that several threads may materialize constants into this context
+  /// concurrently.  Set via LLVMContext::setConcurrentConstantUniquing().
+  bool ConcurrentConstantUniquing;
+
+  /// Reader/writer guards for the type uniquing tables that only engage when
+  /// the context is in concurrent type uniquing mode.  Type lookups vastly
+  /// outnumber type creation, so a hit only shares the lock; a miss releases
+  /// it, retakes it exclusively and re-checks before creating the type.
+  class OptionalTypeReader {
+    sys::SmartRWMutex<true> *M;
+
+  public:
+    OptionalTypeReader(sys::SmartRWMutex<true> &M, bool Enable)
+        : M(Enable ? &M : nullptr) {
+      if (this->M)
+        this->M->lock_shared();
+    }
+    ~OptionalTypeReader() {
+      if (M)
+        M->unlock_shared();
+    }
+  };
+
+  class OptionalTypeWriter {
+    sys::SmartRWMutex<true> *M;
+
+  public:
+    OptionalTypeWriter(sys::SmartRWMutex<true> &M, bool Enable)
+        : M(Enable ? &M : nullptr) {
+      if (this->M)
+        this->M->lock();
+    }
+    ~OptionalTypeWriter() {
+      if (M)
+        M->unlock();
+    }
+  };
+
+  /// When true, lookups in the type uniquing tables take TypeTableLock so
+  /// that several threads may materialize types into this context
+  /// concurrently.  Set via LLVMContext::setConcurrentTypeUniquing().
+  bool ConcurrentTypeUniquing;
+
+  /// Guards the type uniquing tables and the type allocator in concurrent
+  /// type uniquing mode.
+  sys::SmartRWMutex<true> TypeTableLock;
+
   typedef DenseMap<APInt, std::unique_ptr<ConstantInt>, DenseMapAPIntKeyInfo>
       IntMapTy;
-  IntMapTy IntConstants;
+  ShardedConstantMap<IntMapTy, APInt> IntConstants;
 
   typedef DenseMap<APFloat, std::unique_ptr<ConstantFP>, DenseMapAPFloatKeyInfo>
       FPMapTy;
-  FPMapTy FPConstants;
+  ShardedConstantMap<FPMapTy, APFloat> FPConstants;
 
   FoldingSet<AttributeImpl> AttrsSet;
   FoldingSet<AttributeListImpl> AttrsLists;
@@ -1136,6 +1225,12 @@ public:
   DenseSet<CLASS *, CLASS##Info> CLASS##s;
 #include "llvm/IR/Metadata.def"
 
+  // The most recently uniqued DILocation. On -g builds locations are queried
+  // in long runs that repeat the same (line, column, scope) key, so
+  // remembering the last hit answers most queries before they reach the
+  // uniquing set. Cleared when the node is erased from the store.
+  DILocation *LastDILocation;
+
   // Optional map for looking up composite types by identifier.
   Optional<DenseMap<const MDString *, DICompositeType *>> DITypeMap;
 
@@ -18,8 +18,10 @@
 #include "llvm/IR/LegacyPassNameParser.h"
 #include "llvm/IR/Module.h"
 #include "llvm/Support/Chrono.h"
+#include "llvm/ADT/StringMap.h"
 #include "llvm/Support/CommandLine.h"
 #include "llvm/Support/Debug.h"
+#include "llvm/Support/Format.h"
 #include "llvm/Support/Error.h"
 #include "llvm/Support/ErrorHandling.h"
 #include "llvm/Support/ManagedStatic.h"
@@ -27,8 +29,16 @@
 #include "llvm/Support/Timer.h"
 #include "llvm/Support/raw_ostream.h"
 #include <algorithm>
+#include <cstring>
 #include <map>
 #include <unordered_set>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
 using namespace llvm;
 using namespace llvm::legacy;
 
@@ -480,9 +490,170 @@ public:
   }
 };
 
+/// PerfCounterInfo Class - This class accumulates hardware performance
+/// counters (instructions retired, L1d misses, last-level cache misses and
+/// branch mispredictions) for each pass, in the same way TimingInfo
+/// accumulates wall time.  Counters are read around the same pass boundaries
+/// that -time-passes uses and a per-pass report is printed on exit.  The
+/// counters are opened with perf_event_open, so the facility is only
+/// functional on Linux; elsewhere, or when the events cannot be opened (for
+/// example under a restrictive perf_event_paranoid setting), it stays inert.
+class PerfCounterInfo {
+public:
+  enum { NumCounters = 4 };
+
+private:
+  struct CounterTotals {
+    uint64_t Values[NumCounters];
+    CounterTotals() { memset(Values, 0, sizeof(Values)); }
+  };
+
+  /// One file descriptor per hardware event, or -1 if the event could not be
+  /// opened.  Events that fail to open simply report zero.
+  int FDs[NumCounters];
+
+  /// Per-pass-name accumulated counter deltas, guarded by TimingInfoMutex.
+  StringMap<CounterTotals> PassTotals;
+
+public:
+  // Use 'create' member to get this.
+  PerfCounterInfo() {
+    for (int &FD : FDs)
+      FD = -1;
+#if defined(__linux__)
+    static const struct {
+      uint32_t Type;
+      uint64_t Config;
+    } Events[NumCounters] = {
+        {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+        {PERF_TYPE_HW_CACHE,
+         PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+             (PERF_COUNT_HW_CACHE_RESULT_MISS << 16)},
+        {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES},
+        {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES}};
+    for (unsigned i = 0; i != NumCounters; ++i) {
+      struct perf_event_attr Attr;
+      memset(&Attr, 0, sizeof(Attr));
+      Attr.size = sizeof(Attr);
+      Attr.type = Events[i].Type;
+      Attr.config = Events[i].Config;
+      Attr.exclude_kernel = 1;
+      Attr.exclude_hv = 1;
+      // Count the calling thread on any CPU; the pass managers run the passes
+      // on the thread that owns them.
+      FDs[i] = syscall(SYS_perf_event_open, &Attr, 0, -1, -1, 0);
+    }
+    if (FDs[0] == -1)
+      errs() << "warning: -time-passes-perf-counters: unable to open hardware "
+                "performance counters (check perf_event_paranoid)\n";
+#else
+    errs() << "warning: -time-passes-perf-counters is only supported on "
+              "Linux\n";
+#endif
+  }
+
+  // PerfCounterInfo dtor - Print the per-pass counter report and release the
+  // counter file descriptors.
+  ~PerfCounterInfo() {
+    print();
+#if defined(__linux__)
+    for (int FD : FDs)
+      if (FD != -1)
+        close(FD);
+#endif
+  }
+
+  // createThePerfCounterInfo - This method either initializes the
+  // ThePerfCounterInfo pointer to a non-null value (if the
+  // -time-passes-perf-counters option is enabled) or it leaves it null.  It
+  // may be called multiple times.
+  static void createThePerfCounterInfo();
+
+  /// sample - Read the current value of every counter into \p Values.
+  /// Unavailable counters read as zero, so their deltas stay zero.
+  void sample(uint64_t Values[NumCounters]) {
+    for (unsigned i = 0; i != NumCounters; ++i) {
+      Values[i] = 0;
+#if defined(__linux__)
+      if (FDs[i] != -1)
+        if (read(FDs[i], &Values[i], sizeof(uint64_t)) != sizeof(uint64_t))
+          Values[i] = 0;
+#endif
+    }
+  }
+
+  /// accumulate - Credit the deltas between two samples to the given pass.
+  void accumulate(Pass *P, const uint64_t Before[NumCounters],
+                  const uint64_t After[NumCounters]) {
+    if (P->getAsPMDataManager())
+      return;
+
+    sys::SmartScopedLock<true> Lock(*TimingInfoMutex);
+    CounterTotals &Totals = PassTotals[P->getPassName()];
+    for (unsigned i = 0; i != NumCounters; ++i)
+      if (After[i] > Before[i])
+        Totals.Values[i] += After[i] - Before[i];
+  }
+
+  /// print - Emit the per-pass counter report, sorted by instruction count.
+  void print() {
+    if (PassTotals.empty())
+      return;
+
+    std::vector<const StringMapEntry<CounterTotals> *> Entries;
+    Entries.reserve(PassTotals.size());
+    for (const auto &Entry : PassTotals)
+      Entries.push_back(&Entry);
+    std::sort(Entries.begin(), Entries.end(),
+              [](const StringMapEntry<CounterTotals> *LHS,
+                 const StringMapEntry<CounterTotals> *RHS) {
+                return LHS->getValue().Values[0] > RHS->getValue().Values[0];
+              });
+
+    raw_ostream &OS = errs();
+    OS << "===" << std::string(73, '-') << "===\n"
+       << "             ... Pass hardware performance counter report ...\n"
+       << "===" << std::string(73, '-') << "===\n";
+    OS << "  Instructions    L1d-misses    LLC-misses  Branch-misses  "
+          "Pass name\n";
+    for (const StringMapEntry<CounterTotals> *Entry : Entries) {
+      for (uint64_t Value : Entry->getValue().Values)
+        OS << format("%14llu", (unsigned long long)Value);
+      OS << "  " << Entry->getKey() << '\n';
+    }
+  }
+};
+
 } // End of anon namespace
 
 static TimingInfo *TheTimeInfo;
+static PerfCounterInfo *ThePerfCounterInfo;
+
+namespace {
+
+/// PassPerfRegion - RAII helper that samples the hardware counters on entry
+/// and credits the deltas to a pass on exit.  A no-op unless
+/// -time-passes-perf-counters created ThePerfCounterInfo.
+class PassPerfRegion {
+  Pass *P;
+  uint64_t Before[PerfCounterInfo::NumCounters];
+
+public:
+  explicit PassPerfRegion(Pass *P) : P(P) {
+    if (ThePerfCounterInfo)
+      ThePerfCounterInfo->sample(Before);
+  }
+
+  ~PassPerfRegion() {
+    if (!ThePerfCounterInfo)
+      return;
+    uint64_t After[PerfCounterInfo::NumCounters];
+    ThePerfCounterInfo->sample(After);
+    ThePerfCounterInfo->accumulate(P, Before, After);
+  }
+};
+
+} // End of anon namespace
 
 //===----------------------------------------------------------------------===//
 // PMTopLevelManager implementation
@@ -854,6 +1025,7 @@ void PMDataManager::verifyPreservedAnalysis(Pass *P) {
   for (AnalysisID AID : PreservedSet) {
     if (Pass *AP = findAnalysisPass(AID, true)) {
       TimeRegion PassTimer(getPassTimer(AP));
+      PassPerfRegion PerfRegion(AP);
       AP->verifyAnalysis();
     }
   }
@@ -936,6 +1108,7 @@ void PMDataManager::freePass(Pass *P, StringRef Msg,
     // If the pass crashes releasing memory, remember this.
     PassManagerPrettyStackEntry X(P);
     TimeRegion PassTimer(getPassTimer(P));
+    PassPerfRegion PerfRegion(P);
 
     P->releaseMemory();
   }
@@ -1292,6 +1465,7 @@ bool BBPassManager::runOnFunction(Function &F) {
         // If the pass crashes, remember this.
         PassManagerPrettyStackEntry X(BP, *I);
         TimeRegion PassTimer(getPassTimer(BP));
+        PassPerfRegion PerfRegion(BP);
 
         LocalChanged |= BP->runOnBasicBlock(*I);
       }
@@ -1456,6 +1630,7 @@ void FunctionPassManagerImpl::releaseMemoryOnTheFly() {
 bool FunctionPassManagerImpl::run(Function &F) {
   bool Changed = false;
   TimingInfo::createTheTimeInfo();
+  PerfCounterInfo::createThePerfCounterInfo();
 
   initializeAllAnalysisInfo();
   for (unsigned Index = 0; Index < getNumContainedManagers(); ++Index) {
@@ -1492,6 +1667,11 @@ bool FPPassManager::runOnFunction(Function &F) {
   if (F.isDeclaration())
     return false;
 
+  // Attribute the pass timers below to this function in the trace, so
+  // -time-trace-json shows per-pass-per-function events.
+  if (TimePassesIsEnabled)
+    setTimeTraceDetail(F.getName());
+
   bool Changed = false;
 
   // Collect inherited analysis from Module level pass manager.
@@ -1509,6 +1689,7 @@ bool FPPassManager::runOnFunction(Function &F) {
     {
       PassManagerPrettyStackEntry X(FP, F);
       TimeRegion PassTimer(getPassTimer(FP));
+      PassPerfRegion PerfRegion(FP);
 
       LocalChanged |= FP->runOnFunction(F);
     }
@@ -1524,6 +1705,10 @@ bool FPPassManager::runOnFunction(Function &F) {
     recordAvailableAnalysis(FP);
     removeDeadPasses(FP, F.getName(), ON_FUNCTION_MSG);
   }
+
+  if (TimePassesIsEnabled)
+    setTimeTraceDetail(StringRef());
+
   return Changed;
 }
 
@@ -1586,6 +1771,7 @@ MPPassManager::runOnModule(Module &M) {
     {
       PassManagerPrettyStackEntry X(MP, M);
       TimeRegion PassTimer(getPassTimer(MP));
+      PassPerfRegion PerfRegion(MP);
 
       LocalChanged |= MP->runOnModule(M);
     }
@@ -1681,6 +1867,7 @@ Pass* MPPassManager::getOnTheFlyPass(Pass *MP, AnalysisID PI, Function &F){
 bool PassManagerImpl::run(Module &M) {
   bool Changed = false;
   TimingInfo::createTheTimeInfo();
+  PerfCounterInfo::createThePerfCounterInfo();
 
   dumpArguments();
   dumpPasses();
@@ -1732,6 +1919,12 @@ static cl::opt<bool,true>
 EnableTiming("time-passes", cl::location(TimePassesIsEnabled),
             cl::desc("Time each pass, printing elapsed time for each on exit"));
 
+static cl::opt<bool> EnablePerfCounters(
+    "time-passes-perf-counters",
+    cl::desc("Capture hardware performance counters (instructions, cache and "
+             "branch misses) for each pass, printing totals for each on exit "
+             "(Linux only)"));
+
 // createTheTimeInfo - This method either initializes the TheTimeInfo pointer to
 // a non-null value (if the -time-passes option is enabled) or it leaves it
 // null.  It may be called multiple times.
@@ -1745,6 +1938,20 @@ void TimingInfo::createTheTimeInfo() {
   TheTimeInfo = &*TTI;
 }
 
+// createThePerfCounterInfo - This method either initializes the
+// ThePerfCounterInfo pointer to a non-null value (if the
+// -time-passes-perf-counters option is enabled) or it leaves it null.  It may
+// be called multiple times.
+void PerfCounterInfo::createThePerfCounterInfo() {
+  if (!EnablePerfCounters || ThePerfCounterInfo) return;
+
+  // Constructed the first time this is called, iff the option is enabled.
+  // This guarantees that the object will be constructed before static globals,
+  // thus it will be destroyed before them.
+  static ManagedStatic<PerfCounterInfo> TPCI;
+  ThePerfCounterInfo = &*TPCI;
+}
+
 /// If TimingInfo is enabled then start pass timer.
 Timer *llvm::getPassTimer(Pass *P) {
   if (TheTimeInfo)
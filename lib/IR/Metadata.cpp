@@ -789,6 +789,10 @@ MDNode *MDNode::uniquify() {
 }
 
 void MDNode::eraseFromStore() {
+  // The node is about to leave the uniquing store (and possibly be mutated or
+  // deleted); drop it from the last-location cache.
+  if (getContext().pImpl->LastDILocation == this)
+    getContext().pImpl->LastDILocation = nullptr;
   switch (getMetadataID()) {
   default:
     llvm_unreachable("Invalid or non-uniquable subclass of MDNode");
@@ -914,6 +918,24 @@ MDNode *MDNode::getMostGenericAliasScope(MDNode *A, MDNode *B) {
   if (!A || !B)
     return nullptr;
 
+  if (A == B)
+    return A;
+
+  // Deep inlining repeatedly merges overlapping scope lists, and every
+  // concatenation of lists that only differ in operand order allocates
+  // another node. If either list already covers the other, reuse it instead;
+  // repeated merges then converge on one node per scope set rather than one
+  // per merge order.
+  SmallPtrSet<Metadata *, 16> ASet(A->op_begin(), A->op_end());
+  if (std::all_of(B->op_begin(), B->op_end(),
+                  [&](const MDOperand &Op) { return ASet.count(Op.get()); }))
+    return A;
+
+  SmallPtrSet<Metadata *, 16> BSet(B->op_begin(), B->op_end());
+  if (std::all_of(A->op_begin(), A->op_end(),
+                  [&](const MDOperand &Op) { return BSet.count(Op.get()); }))
+    return B;
+
   return concatenate(A, B);
 }
 
@@ -1267,6 +1289,21 @@ MDNode *Instruction::getMetadataImpl(unsigned KindID) const {
   return Info.lookup(KindID);
 }
 
+void Instruction::getAAMetadataImpl(AAMDNodes &N) const {
+  N = AAMDNodes();
+  if (!hasMetadataHashEntry())
+    return;
+
+  // Look the instruction up in the attachment table once and pull all three
+  // kinds out of the attachment list, rather than paying a hash lookup per
+  // kind.
+  auto &Info = getContext().pImpl->InstructionMetadata[this];
+  assert(!Info.empty() && "bit out of sync with hash table");
+  N.TBAA = Info.lookup(LLVMContext::MD_tbaa);
+  N.Scope = Info.lookup(LLVMContext::MD_alias_scope);
+  N.NoAlias = Info.lookup(LLVMContext::MD_noalias);
+}
+
 void Instruction::getAllMetadataImpl(
     SmallVectorImpl<std::pair<unsigned, MDNode *>> &Result) const {
   Result.clear();
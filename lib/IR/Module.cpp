@@ -371,6 +371,13 @@ Error Module::materialize(GlobalValue *GV) {
   return Materializer->materialize(GV);
 }
 
+Error Module::materialize(ArrayRef<GlobalValue *> GVs) {
+  if (!Materializer)
+    return Error::success();
+
+  return Materializer->materialize(GVs);
+}
+
 Error Module::materializeAll() {
   if (!Materializer)
     return Error::success();
@@ -0,0 +1,243 @@
+//===- ModuleSummaryIndexFlat.cpp - Flat summary index format -------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+//
+// This file implements the writer and the in-place reader for the flat
+// module summary index format described in ModuleSummaryIndexFlat.h.
+//
+//===----------------------------------------------------------------------===//
+
+#include "llvm/IR/ModuleSummaryIndexFlat.h"
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/STLExtras.h"
+#include "llvm/ADT/StringMap.h"
+#include "llvm/Support/EndianStream.h"
+#include <algorithm>
+#include <vector>
+
+using namespace llvm;
+using namespace llvm::support;
+
+namespace {
+
+// Reads "LLVMFSI1" when interpreted as bytes in memory.
+const uint64_t FlatIndexMagic = 0x314953464d564c4cULL;
+const uint32_t FlatIndexVersion = 1;
+
+const uint64_t HeaderSize = 56;
+const uint64_t ModuleEntrySize = 48;
+const uint64_t GUIDEntrySize = 16;
+
+// Fixed part of a summary record; refs (8 bytes each) and call edges
+// (16 bytes each) follow. Keep in sync with the accessors in
+// FlatSummaryIndex::Summary.
+const uint64_t SummaryRecordSize = 40;
+
+uint64_t getRecordSize(const GlobalValueSummary &S) {
+  uint64_t NumCalls = 0;
+  if (const auto *FS = dyn_cast<FunctionSummary>(&S))
+    NumCalls = FS->calls().size();
+  return SummaryRecordSize + 8 * S.refs().size() + 16 * NumCalls;
+}
+
+Error malformedError(const Twine &Msg) {
+  return make_error<StringError>("Invalid flat summary index: " + Msg,
+                                 inconvertibleErrorCode());
+}
+
+} // end anonymous namespace
+
+Error llvm::writeFlatSummaryIndex(const ModuleSummaryIndex &Index,
+                                  raw_ostream &OS) {
+  // Lay out the module table in sorted path order so the output does not
+  // depend on StringMap iteration order.
+  std::vector<StringRef> ModulePaths;
+  ModulePaths.reserve(Index.modulePaths().size());
+  for (const auto &ModPath : Index.modulePaths())
+    ModulePaths.push_back(ModPath.first());
+  std::sort(ModulePaths.begin(), ModulePaths.end());
+
+  StringMap<uint32_t> ModuleIndexMap;
+  std::vector<uint64_t> ModulePathOffsets;
+  uint64_t StringTableSize = 0;
+  for (unsigned I = 0, E = ModulePaths.size(); I != E; ++I) {
+    ModuleIndexMap[ModulePaths[I]] = I;
+    ModulePathOffsets.push_back(StringTableSize);
+    StringTableSize += ModulePaths[I].size();
+  }
+
+  // Map each summary object back to its GUID so alias records can name
+  // their aliasee.
+  DenseMap<const GlobalValueSummary *, GlobalValue::GUID> SummaryGUIDs;
+  for (const auto &GlobalList : Index)
+    for (const auto &Summary : GlobalList.second)
+      SummaryGUIDs[Summary.get()] = GlobalList.first;
+
+  const uint64_t NumGUIDs = Index.size();
+  const uint64_t ModuleTableOffset = HeaderSize;
+  const uint64_t GUIDTableOffset =
+      ModuleTableOffset + ModuleEntrySize * ModulePaths.size();
+  const uint64_t BlocksOffset = GUIDTableOffset + GUIDEntrySize * NumGUIDs;
+
+  uint64_t BlocksSize = 0;
+  for (const auto &GlobalList : Index) {
+    BlocksSize += 8; // Summary count.
+    for (const auto &Summary : GlobalList.second)
+      BlocksSize += getRecordSize(*Summary);
+  }
+  const uint64_t StringTableOffset = BlocksOffset + BlocksSize;
+
+  endian::Writer<little> LE(OS);
+  LE.write<uint64_t>(FlatIndexMagic);
+  LE.write<uint32_t>(FlatIndexVersion);
+  LE.write<uint32_t>(ModulePaths.size());
+  LE.write<uint64_t>(NumGUIDs);
+  LE.write<uint64_t>(ModuleTableOffset);
+  LE.write<uint64_t>(GUIDTableOffset);
+  LE.write<uint64_t>(StringTableOffset);
+  LE.write<uint64_t>(StringTableSize);
+
+  for (unsigned I = 0, E = ModulePaths.size(); I != E; ++I) {
+    LE.write<uint64_t>(ModulePathOffsets[I]);
+    LE.write<uint64_t>(ModulePaths[I].size());
+    LE.write<uint64_t>(Index.getModuleId(ModulePaths[I]));
+    for (uint32_t Word : Index.getModuleHash(ModulePaths[I]))
+      LE.write<uint32_t>(Word);
+    LE.write<uint32_t>(0); // Padding to keep entries 8-byte aligned.
+  }
+
+  // The index map is sorted by GUID, so emitting the table in iteration
+  // order makes it binary searchable.
+  uint64_t BlockOffset = BlocksOffset;
+  for (const auto &GlobalList : Index) {
+    LE.write<uint64_t>(GlobalList.first);
+    LE.write<uint64_t>(BlockOffset);
+    BlockOffset += 8;
+    for (const auto &Summary : GlobalList.second)
+      BlockOffset += getRecordSize(*Summary);
+  }
+
+  for (const auto &GlobalList : Index) {
+    LE.write<uint64_t>(GlobalList.second.size());
+    for (const auto &SummaryPtr : GlobalList.second) {
+      const GlobalValueSummary &Summary = *SummaryPtr;
+      auto ModIt = ModuleIndexMap.find(Summary.modulePath());
+      if (ModIt == ModuleIndexMap.end())
+        return malformedError("summary module path not in module table; "
+                              "writing requires a combined index");
+
+      uint32_t Flags = Summary.linkage() & 0xf;
+      if (Summary.notEligibleToImport())
+        Flags |= 0x10;
+      if (Summary.liveRoot())
+        Flags |= 0x20;
+
+      const auto *FS = dyn_cast<FunctionSummary>(&Summary);
+      GlobalValue::GUID AliaseeGUID = 0;
+      if (const auto *AS = dyn_cast<AliasSummary>(&Summary))
+        AliaseeGUID = SummaryGUIDs.lookup(&AS->getAliasee());
+
+      LE.write<uint32_t>(Summary.getSummaryKind());
+      LE.write<uint32_t>(Flags);
+      LE.write<uint32_t>(ModIt->second);
+      LE.write<uint32_t>(FS ? FS->instCount() : 0);
+      LE.write<uint64_t>(Summary.getOriginalName());
+      LE.write<uint64_t>(AliaseeGUID);
+      LE.write<uint32_t>(Summary.refs().size());
+      LE.write<uint32_t>(FS ? FS->calls().size() : 0);
+
+      for (const ValueInfo &Ref : Summary.refs()) {
+        if (!Ref.isGUID())
+          return malformedError("non-GUID reference; "
+                                "writing requires a combined index");
+        LE.write<uint64_t>(Ref.getGUID());
+      }
+      if (FS)
+        for (const FunctionSummary::EdgeTy &Edge : FS->calls()) {
+          if (!Edge.first.isGUID())
+            return malformedError("non-GUID call edge; "
+                                  "writing requires a combined index");
+          LE.write<uint64_t>(Edge.first.getGUID());
+          LE.write<uint64_t>(static_cast<uint64_t>(Edge.second.Hotness));
+        }
+    }
+  }
+
+  for (StringRef Path : ModulePaths)
+    OS << Path;
+
+  return Error::success();
+}
+
+Expected<std::unique_ptr<FlatSummaryIndex>>
+FlatSummaryIndex::create(MemoryBufferRef Buffer) {
+  const uint64_t Size = Buffer.getBufferSize();
+  if (Size < HeaderSize)
+    return malformedError("buffer too small for header");
+
+  std::unique_ptr<FlatSummaryIndex> Index(new FlatSummaryIndex());
+  Index->Base = reinterpret_cast<const unsigned char *>(Buffer.getBufferStart());
+
+  if (Index->read<uint64_t>(0) != FlatIndexMagic)
+    return malformedError("bad magic");
+  if (Index->read<uint32_t>(8) != FlatIndexVersion)
+    return malformedError("unsupported version");
+
+  Index->NumModules = Index->read<uint32_t>(12);
+  Index->NumGUIDs = Index->read<uint64_t>(16);
+  Index->ModuleTableOffset = Index->read<uint64_t>(24);
+  Index->GUIDTableOffset = Index->read<uint64_t>(32);
+  Index->StringTableOffset = Index->read<uint64_t>(40);
+  const uint64_t StringTableSize = Index->read<uint64_t>(48);
+
+  if (Index->ModuleTableOffset + ModuleEntrySize * Index->NumModules > Size ||
+      Index->GUIDTableOffset + GUIDEntrySize * Index->NumGUIDs > Size ||
+      Index->StringTableOffset + StringTableSize > Size)
+    return malformedError("table extends past end of buffer");
+
+  return std::move(Index);
+}
+
+FlatSummaryIndex::SummaryList
+FlatSummaryIndex::findSummaries(GlobalValue::GUID GUID) const {
+  uint64_t Lo = 0, Hi = NumGUIDs;
+  while (Lo < Hi) {
+    const uint64_t Mid = Lo + (Hi - Lo) / 2;
+    const uint64_t MidGUID = read<uint64_t>(GUIDTableOffset + GUIDEntrySize * Mid);
+    if (MidGUID == GUID)
+      return SummaryList(
+          this, read<uint64_t>(GUIDTableOffset + GUIDEntrySize * Mid + 8));
+    if (MidGUID < GUID)
+      Lo = Mid + 1;
+    else
+      Hi = Mid;
+  }
+  return SummaryList(nullptr, 0);
+}
+
+StringRef FlatSummaryIndex::getModulePath(uint32_t ModuleIndex) const {
+  assert(ModuleIndex < NumModules && "Module index out of range");
+  const uint64_t Entry = ModuleTableOffset + ModuleEntrySize * ModuleIndex;
+  return StringRef(reinterpret_cast<const char *>(Base) + StringTableOffset +
+                       read<uint64_t>(Entry),
+                   read<uint64_t>(Entry + 8));
+}
+
+uint64_t FlatSummaryIndex::getModuleId(uint32_t ModuleIndex) const {
+  assert(ModuleIndex < NumModules && "Module index out of range");
+  return read<uint64_t>(ModuleTableOffset + ModuleEntrySize * ModuleIndex + 16);
+}
+
+ModuleHash FlatSummaryIndex::getModuleHash(uint32_t ModuleIndex) const {
+  assert(ModuleIndex < NumModules && "Module index out of range");
+  const uint64_t Entry = ModuleTableOffset + ModuleEntrySize * ModuleIndex;
+  ModuleHash Hash;
+  for (unsigned I = 0; I != 5; ++I)
+    Hash[I] = read<uint32_t>(Entry + 24 + 4 * I);
+  return Hash;
+}
@@ -241,11 +241,21 @@ IntegerType *IntegerType::get(LLVMContext &C, unsigned NumBits) {
     break;
   }
   
-  IntegerType *&Entry = C.pImpl->IntegerTypes[NumBits];
+  LLVMContextImpl *pImpl = C.pImpl;
+  {
+    LLVMContextImpl::OptionalTypeReader Reader(pImpl->TypeTableLock,
+                                               pImpl->ConcurrentTypeUniquing);
+    if (IntegerType *Entry = pImpl->IntegerTypes.lookup(NumBits))
+      return Entry;
+  }
+
+  LLVMContextImpl::OptionalTypeWriter Writer(pImpl->TypeTableLock,
+                                             pImpl->ConcurrentTypeUniquing);
+  IntegerType *&Entry = pImpl->IntegerTypes[NumBits];
 
   if (!Entry)
-    Entry = new (C.pImpl->TypeAllocator) IntegerType(C, NumBits);
-  
+    Entry = new (pImpl->TypeAllocator) IntegerType(C, NumBits);
+
   return Entry;
 }
 
@@ -286,19 +296,29 @@ FunctionType *FunctionType::get(Type *ReturnType,
                                 ArrayRef<Type*> Params, bool isVarArg) {
   LLVMContextImpl *pImpl = ReturnType->getContext().pImpl;
   FunctionTypeKeyInfo::KeyTy Key(ReturnType, Params, isVarArg);
-  auto I = pImpl->FunctionTypes.find_as(Key);
-  FunctionType *FT;
-
-  if (I == pImpl->FunctionTypes.end()) {
-    FT = (FunctionType *)pImpl->TypeAllocator.Allocate(
-        sizeof(FunctionType) + sizeof(Type *) * (Params.size() + 1),
-        alignof(FunctionType));
-    new (FT) FunctionType(ReturnType, Params, isVarArg);
-    pImpl->FunctionTypes.insert(FT);
-  } else {
-    FT = *I;
+
+  {
+    LLVMContextImpl::OptionalTypeReader Reader(pImpl->TypeTableLock,
+                                               pImpl->ConcurrentTypeUniquing);
+    auto I = pImpl->FunctionTypes.find_as(Key);
+    if (I != pImpl->FunctionTypes.end())
+      return *I;
   }
 
+  // Not found; re-check under the exclusive lock before creating the type,
+  // since another thread may have beaten us here.
+  LLVMContextImpl::OptionalTypeWriter Writer(pImpl->TypeTableLock,
+                                             pImpl->ConcurrentTypeUniquing);
+  auto I = pImpl->FunctionTypes.find_as(Key);
+  if (I != pImpl->FunctionTypes.end())
+    return *I;
+
+  FunctionType *FT = (FunctionType *)pImpl->TypeAllocator.Allocate(
+      sizeof(FunctionType) + sizeof(Type *) * (Params.size() + 1),
+      alignof(FunctionType));
+  new (FT) FunctionType(ReturnType, Params, isVarArg);
+  pImpl->FunctionTypes.insert(FT);
+
   return FT;
 }
 
@@ -325,19 +345,29 @@ StructType *StructType::get(LLVMContext &Context, ArrayRef<Type*> ETypes,
                             bool isPacked) {
   LLVMContextImpl *pImpl = Context.pImpl;
   AnonStructTypeKeyInfo::KeyTy Key(ETypes, isPacked);
-  auto I = pImpl->AnonStructTypes.find_as(Key);
-  StructType *ST;
-
-  if (I == pImpl->AnonStructTypes.end()) {
-    // Value not found.  Create a new type!
-    ST = new (Context.pImpl->TypeAllocator) StructType(Context);
-    ST->setSubclassData(SCDB_IsLiteral);  // Literal struct.
-    ST->setBody(ETypes, isPacked);
-    Context.pImpl->AnonStructTypes.insert(ST);
-  } else {
-    ST = *I;
+
+  {
+    LLVMContextImpl::OptionalTypeReader Reader(pImpl->TypeTableLock,
+                                               pImpl->ConcurrentTypeUniquing);
+    auto I = pImpl->AnonStructTypes.find_as(Key);
+    if (I != pImpl->AnonStructTypes.end())
+      return *I;
   }
 
+  // Not found; re-check under the exclusive lock before creating the type,
+  // since another thread may have beaten us here.
+  LLVMContextImpl::OptionalTypeWriter Writer(pImpl->TypeTableLock,
+                                             pImpl->ConcurrentTypeUniquing);
+  auto I = pImpl->AnonStructTypes.find_as(Key);
+  if (I != pImpl->AnonStructTypes.end())
+    return *I;
+
+  // Value not found.  Create a new type!
+  StructType *ST = new (pImpl->TypeAllocator) StructType(Context);
+  ST->setSubclassData(SCDB_IsLiteral);  // Literal struct.
+  ST->setBody(ETypes, isPacked);
+  pImpl->AnonStructTypes.insert(ST);
+
   return ST;
 }
 
@@ -361,6 +391,12 @@ void StructType::setBody(ArrayRef<Type*> Elements, bool isPacked) {
 void StructType::setName(StringRef Name) {
   if (Name == getName()) return;
 
+  // Naming and renaming mutates the symbol table, so it always takes the
+  // exclusive lock in concurrent type uniquing mode.
+  LLVMContextImpl::OptionalTypeWriter Writer(
+      getContext().pImpl->TypeTableLock,
+      getContext().pImpl->ConcurrentTypeUniquing);
+
   StringMap<StructType *> &SymbolTable = getContext().pImpl->NamedStructTypes;
   typedef StringMap<StructType *>::MapEntryTy EntryTy;
 
@@ -537,6 +573,9 @@ bool StructType::isLayoutIdentical(StructType *Other) const {
 }
 
 StructType *Module::getTypeByName(StringRef Name) const {
+  LLVMContextImpl::OptionalTypeReader Reader(
+      getContext().pImpl->TypeTableLock,
+      getContext().pImpl->ConcurrentTypeUniquing);
   return getContext().pImpl->NamedStructTypes.lookup(Name);
 }
 
@@ -601,7 +640,17 @@ ArrayType *ArrayType::get(Type *ElementType, uint64_t NumElements) {
   assert(isValidElementType(ElementType) && "Invalid type for array element!");
 
   LLVMContextImpl *pImpl = ElementType->getContext().pImpl;
-  ArrayType *&Entry = 
+  {
+    LLVMContextImpl::OptionalTypeReader Reader(pImpl->TypeTableLock,
+                                               pImpl->ConcurrentTypeUniquing);
+    if (ArrayType *Entry =
+            pImpl->ArrayTypes.lookup(std::make_pair(ElementType, NumElements)))
+      return Entry;
+  }
+
+  LLVMContextImpl::OptionalTypeWriter Writer(pImpl->TypeTableLock,
+                                             pImpl->ConcurrentTypeUniquing);
+  ArrayType *&Entry =
     pImpl->ArrayTypes[std::make_pair(ElementType, NumElements)];
 
   if (!Entry)
@@ -629,8 +678,18 @@ VectorType *VectorType::get(Type *ElementType, unsigned NumElements) {
                                             "pointer type.");
 
   LLVMContextImpl *pImpl = ElementType->getContext().pImpl;
-  VectorType *&Entry = ElementType->getContext().pImpl
-    ->VectorTypes[std::make_pair(ElementType, NumElements)];
+  {
+    LLVMContextImpl::OptionalTypeReader Reader(pImpl->TypeTableLock,
+                                               pImpl->ConcurrentTypeUniquing);
+    if (VectorType *Entry =
+            pImpl->VectorTypes.lookup(std::make_pair(ElementType, NumElements)))
+      return Entry;
+  }
+
+  LLVMContextImpl::OptionalTypeWriter Writer(pImpl->TypeTableLock,
+                                             pImpl->ConcurrentTypeUniquing);
+  VectorType *&Entry =
+    pImpl->VectorTypes[std::make_pair(ElementType, NumElements)];
 
   if (!Entry)
     Entry = new (pImpl->TypeAllocator) VectorType(ElementType, NumElements);
@@ -651,8 +710,21 @@ PointerType *PointerType::get(Type *EltTy, unsigned AddressSpace) {
   assert(isValidElementType(EltTy) && "Invalid type for pointer element!");
   
   LLVMContextImpl *CImpl = EltTy->getContext().pImpl;
-  
-  // Since AddressSpace #0 is the common case, we special case it.
+
+  {
+    LLVMContextImpl::OptionalTypeReader Reader(CImpl->TypeTableLock,
+                                               CImpl->ConcurrentTypeUniquing);
+    // Since AddressSpace #0 is the common case, we special case it.
+    PointerType *Entry =
+        AddressSpace == 0
+            ? CImpl->PointerTypes.lookup(EltTy)
+            : CImpl->ASPointerTypes.lookup(std::make_pair(EltTy, AddressSpace));
+    if (Entry)
+      return Entry;
+  }
+
+  LLVMContextImpl::OptionalTypeWriter Writer(CImpl->TypeTableLock,
+                                             CImpl->ConcurrentTypeUniquing);
   PointerType *&Entry = AddressSpace == 0 ? CImpl->PointerTypes[EltTy]
      : CImpl->ASPointerTypes[std::make_pair(EltTy, AddressSpace)];
 
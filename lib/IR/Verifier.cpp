@@ -105,8 +105,11 @@
 #include "llvm/Support/Dwarf.h"
 #include "llvm/Support/ErrorHandling.h"
 #include "llvm/Support/MathExtras.h"
+#include "llvm/Support/ThreadPool.h"
+#include "llvm/Support/Threading.h"
 #include "llvm/Support/raw_ostream.h"
 #include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <cstdint>
 #include <memory>
@@ -117,6 +120,15 @@ using namespace llvm;
 
 static cl::opt<bool> VerifyDebugInfo("verify-debug-info", cl::init(true));
 
+/// Shard the per-function checks in verifyModule across a thread pool. The
+/// function-level checks are independent of each other; the module-level
+/// checks still run single-threaded after the workers have been joined and
+/// their cross-function state has been merged.
+static cl::opt<bool> VerifyModuleParallel(
+    "verify-module-parallel", cl::Hidden, cl::init(false),
+    cl::desc("Verify functions on a thread pool before the single-threaded "
+             "module-level verification phase"));
+
 namespace llvm {
 
 struct VerifierSupport {
@@ -317,6 +329,21 @@ public:
 
   bool hasBrokenDebugInfo() const { return BrokenDebugInfo; }
 
+  /// Fold the function-level state accumulated by \p Other into this
+  /// verifier. The parallel driver in \c verifyModule shards functions across
+  /// worker verifiers, and the module-level phase run on this instance needs
+  /// their cross-function state: frame escape information, the compile units
+  /// they visited, and whether they found broken debug info.
+  void mergeFunctionState(const Verifier &Other) {
+    BrokenDebugInfo |= Other.BrokenDebugInfo;
+    CUVisited.insert(Other.CUVisited.begin(), Other.CUVisited.end());
+    for (const auto &I : Other.FrameEscapeInfo) {
+      auto &Counts = FrameEscapeInfo[I.first];
+      Counts.first = std::max(Counts.first, I.second.first);
+      Counts.second = std::max(Counts.second, I.second.second);
+    }
+  }
+
   bool verify(const Function &F) {
     assert(F.getParent() == &M &&
            "An instance of this class only works with a specific module!");
@@ -4504,8 +4531,53 @@ bool llvm::verifyModule(const Module &M, raw_ostream *OS,
   Verifier V(OS, /*ShouldTreatBrokenDebugInfoAsError=*/!BrokenDebugInfo, M);
 
   bool Broken = false;
-  for (const Function &F : M)
-    Broken |= !V.verify(F);
+  unsigned NumShards = heavyweight_hardware_concurrency();
+  if (VerifyModuleParallel && NumShards > 1) {
+    // Deal the functions round-robin onto one shard per thread. Each worker
+    // verifies its shard with a private Verifier writing to a private buffer
+    // so that diagnostics from different threads do not interleave.
+    std::vector<std::vector<const Function *>> Shards(NumShards);
+    unsigned I = 0;
+    for (const Function &F : M)
+      Shards[I++ % NumShards].push_back(&F);
+
+    std::vector<std::string> Logs(NumShards);
+    std::vector<std::unique_ptr<raw_string_ostream>> LogStreams(NumShards);
+    std::vector<std::unique_ptr<Verifier>> Workers(NumShards);
+    for (unsigned S = 0; S != NumShards; ++S) {
+      if (OS)
+        LogStreams[S] = make_unique<raw_string_ostream>(Logs[S]);
+      Workers[S] = make_unique<Verifier>(
+          LogStreams[S].get(),
+          /*ShouldTreatBrokenDebugInfoAsError=*/!BrokenDebugInfo, M);
+    }
+
+    std::atomic<bool> AnyBroken(false);
+    {
+      ThreadPool Pool(NumShards);
+      for (unsigned S = 0; S != NumShards; ++S)
+        Pool.async([&, S] {
+          for (const Function *F : Shards[S])
+            if (!Workers[S]->verify(*F))
+              AnyBroken = true;
+        });
+      Pool.wait();
+    }
+    Broken = AnyBroken;
+
+    // Merge the workers' cross-function state into the verifier that runs the
+    // module-level phase, and replay their diagnostics in shard order.
+    for (unsigned S = 0; S != NumShards; ++S) {
+      V.mergeFunctionState(*Workers[S]);
+      if (OS) {
+        LogStreams[S]->flush();
+        *OS << Logs[S];
+      }
+    }
+  } else {
+    for (const Function &F : M)
+      Broken |= !V.verify(F);
+  }
 
   Broken |= !V.verify();
   if (BrokenDebugInfo)
@@ -18,6 +18,7 @@
 #include "llvm/Support/MemoryBuffer.h"
 #include "llvm/Support/Path.h"
 #include "llvm/Support/raw_ostream.h"
+#include "llvm/Support/xxhash.h"
 
 using namespace llvm;
 using namespace llvm::lto;
@@ -65,10 +66,47 @@ Expected<NativeObjectCache> lto::localCache(StringRef CacheDirectoryPath,
 
         // Make sure the file is closed before committing it.
         OS.reset();
-        // This is atomic on POSIX systems.
-        if (auto EC = sys::fs::rename(TempFilename, EntryPath))
-          report_fatal_error(Twine("Failed to rename temporary file ") +
-                             TempFilename + ": " + EC.message() + "\n");
+
+        // Deduplicate identical outputs: the bytes are stored once under a
+        // content-addressed name and every cache entry that produced the same
+        // output is a hard link to it.  Identical backend outputs are common
+        // across incremental links (only the key, not the content, changes
+        // when e.g. an irrelevant module hash moves), and the links make
+        // those entries free.  The content file keeps the llvmcache- prefix
+        // so the pruner treats it like any other entry; its data survives
+        // until the last link to it is pruned.
+        {
+          ErrorOr<std::unique_ptr<MemoryBuffer>> TempOrErr =
+              MemoryBuffer::getFile(TempFilename);
+          if (!TempOrErr)
+            report_fatal_error(Twine("Failed to open temporary file ") +
+                               TempFilename + ": " +
+                               TempOrErr.getError().message() + "\n");
+
+          SmallString<64> ContentPath(sys::path::parent_path(EntryPath));
+          sys::path::append(ContentPath,
+                            "llvmcache-content-" +
+                                utohexstr(xxHash64((*TempOrErr)->getBuffer())));
+
+          // Publish the content file unless the same bytes are already
+          // present.  rename() is atomic on POSIX, and racing producers of
+          // the same content hash are benign since they write identical
+          // bytes.
+          if (sys::fs::exists(ContentPath))
+            sys::fs::remove(TempFilename);
+          else if (auto EC = sys::fs::rename(TempFilename, ContentPath))
+            report_fatal_error(Twine("Failed to rename temporary file ") +
+                               TempFilename + ": " + EC.message() + "\n");
+
+          if (auto EC = sys::fs::create_hard_link(ContentPath, EntryPath)) {
+            // A racing producer may have created the entry already, and some
+            // file systems do not support hard links; fall back to a copy.
+            if (EC != errc::file_exists)
+              if (auto CopyEC = sys::fs::copy_file(ContentPath, EntryPath))
+                report_fatal_error(Twine("Failed to create cache entry ") +
+                                   EntryPath + ": " + CopyEC.message() + "\n");
+          }
+        }
 
         ErrorOr<std::unique_ptr<MemoryBuffer>> MBOrErr =
             MemoryBuffer::getFile(EntryPath);
@@ -26,6 +26,7 @@
 #include "llvm/Linker/IRMover.h"
 #include "llvm/Object/IRObjectFile.h"
 #include "llvm/Object/ModuleSummaryIndexObjectFile.h"
+#include "llvm/Support/CommandLine.h"
 #include "llvm/Support/Error.h"
 #include "llvm/Support/ManagedStatic.h"
 #include "llvm/Support/MemoryBuffer.h"
@@ -43,6 +44,7 @@
 #include "llvm/Transforms/IPO/PassManagerBuilder.h"
 #include "llvm/Transforms/Utils/SplitModule.h"
 
+#include <numeric>
 #include <set>
 
 using namespace llvm;
@@ -51,6 +53,17 @@ using namespace object;
 
 #define DEBUG_TYPE "lto"
 
+static cl::opt<bool> ThinLTOAsyncSummaries(
+    "thinlto-async-summaries", cl::init(true), cl::Hidden,
+    cl::desc("Parse ThinLTO module summaries on a thread pool while inputs "
+             "are still being added"));
+
+static cl::opt<unsigned> ThinLTOMemoryBudgetMB(
+    "thinlto-memory-budget",
+    cl::desc("Approximate memory budget in MiB shared by concurrent "
+             "in-process ThinLTO backends (0 = unlimited)"),
+    cl::init(0), cl::Hidden);
+
 // The values are (type identifier, summary) pairs.
 typedef DenseMap<
     GlobalValue::GUID,
@@ -592,11 +605,40 @@ Error LTO::addThinLTO(BitcodeModule BM,
                       ArrayRef<InputFile::Symbol> Syms,
                       const SymbolResolution *&ResI,
                       const SymbolResolution *ResE) {
-  Expected<std::unique_ptr<ModuleSummaryIndex>> SummaryOrErr = BM.getSummary();
-  if (!SummaryOrErr)
-    return SummaryOrErr.takeError();
-  ThinLTO.CombinedIndex.mergeFrom(std::move(*SummaryOrErr),
-                                  ThinLTO.ModuleMap.size());
+  if (ThinLTOAsyncSummaries) {
+    // Hand the summary parse to the pool and return to the linker, which
+    // continues resolving symbols for the remaining inputs. Summary parsing
+    // only reads the module's own bitcode buffer, so the tasks are
+    // independent; the parsed summaries are merged into the combined index,
+    // in the order the modules were added, by waitForSummaries() at the
+    // start of run(). Malformed summaries are therefore reported from run()
+    // rather than from here.
+    if (!ThinLTO.SummaryPool)
+      ThinLTO.SummaryPool = llvm::make_unique<ThreadPool>();
+    ThinLTO.PendingSummaries.emplace_back(ThinLTO.ModuleMap.size(), nullptr);
+    auto *Slot = &ThinLTO.PendingSummaries.back();
+    ThinLTO.SummaryPool->async([this, Slot, BM]() mutable {
+      Expected<std::unique_ptr<ModuleSummaryIndex>> SummaryOrErr =
+          BM.getSummary();
+      if (!SummaryOrErr) {
+        std::unique_lock<std::mutex> L(ThinLTO.SummaryMu);
+        if (ThinLTO.SummaryErr)
+          ThinLTO.SummaryErr = joinErrors(std::move(*ThinLTO.SummaryErr),
+                                          SummaryOrErr.takeError());
+        else
+          ThinLTO.SummaryErr = SummaryOrErr.takeError();
+        return;
+      }
+      Slot->second = std::move(*SummaryOrErr);
+    });
+  } else {
+    Expected<std::unique_ptr<ModuleSummaryIndex>> SummaryOrErr =
+        BM.getSummary();
+    if (!SummaryOrErr)
+      return SummaryOrErr.takeError();
+    ThinLTO.CombinedIndex.mergeFrom(std::move(*SummaryOrErr),
+                                    ThinLTO.ModuleMap.size());
+  }
 
   for (const InputFile::Symbol &Sym : Syms) {
     assert(ResI != ResE);
@@ -625,7 +667,30 @@ unsigned LTO::getMaxTasks() const {
   return RegularLTO.ParallelCodeGenParallelismLevel + ThinLTO.ModuleMap.size();
 }
 
+Error LTO::waitForSummaries() {
+  if (!ThinLTO.SummaryPool)
+    return Error::success();
+  ThinLTO.SummaryPool->wait();
+  ThinLTO.SummaryPool.reset();
+
+  if (ThinLTO.SummaryErr)
+    return std::move(*ThinLTO.SummaryErr);
+
+  // The pending entries are in the order the modules were added and carry the
+  // module position recorded at that point, so this produces the same
+  // combined index as parsing each summary synchronously in addThinLTO.
+  for (auto &PS : ThinLTO.PendingSummaries)
+    ThinLTO.CombinedIndex.mergeFrom(std::move(PS.second), PS.first);
+  ThinLTO.PendingSummaries.clear();
+  return Error::success();
+}
+
 Error LTO::run(AddStreamFn AddStream, NativeObjectCache Cache) {
+  // Finish any summary parses still in flight before making decisions based
+  // on the combined index.
+  if (Error E = waitForSummaries())
+    return E;
+
   // Save the status of having a regularLTO combined module, as
   // this is needed for generating the ThinLTO Task ID, and
   // the CombinedModule will be moved at the end of runRegularLTO.
@@ -722,6 +787,46 @@ public:
 };
 
 namespace {
+
+/// Admission control for in-process ThinLTO backends.
+///
+/// Each backend task declares an estimate of its peak memory before running;
+/// a task whose estimate does not fit into the remaining budget blocks its
+/// pool thread until enough running tasks retire. A task is always admitted
+/// when nothing else is running, so an estimate larger than the whole budget
+/// degrades to serial execution instead of deadlocking. A budget of zero
+/// disables the governor.
+class BackendMemoryGovernor {
+  std::mutex Mu;
+  std::condition_variable CV;
+  const uint64_t Budget;
+  uint64_t Used = 0;
+  unsigned InFlight = 0;
+
+public:
+  BackendMemoryGovernor(uint64_t Budget) : Budget(Budget) {}
+
+  void acquire(uint64_t Cost) {
+    if (!Budget)
+      return;
+    std::unique_lock<std::mutex> L(Mu);
+    CV.wait(L, [&] { return InFlight == 0 || Used + Cost <= Budget; });
+    Used += Cost;
+    ++InFlight;
+  }
+
+  void release(uint64_t Cost) {
+    if (!Budget)
+      return;
+    {
+      std::unique_lock<std::mutex> L(Mu);
+      Used -= Cost;
+      --InFlight;
+    }
+    CV.notify_all();
+  }
+};
+
 class InProcessThinBackend : public ThinBackendProc {
   ThreadPool BackendThreadPool;
   AddStreamFn AddStream;
@@ -731,6 +836,25 @@ class InProcessThinBackend : public ThinBackendProc {
   Optional<Error> Err;
   std::mutex ErrMu;
 
+  BackendMemoryGovernor MemGovernor;
+
+  /// Estimate the peak memory of a backend task. The dominant terms are the
+  /// in-memory IR, which expands roughly tenfold from bitcode, and the
+  /// function bodies imported from other modules. Bitcode sizes are the only
+  /// signal available before the task runs; the imported modules are counted
+  /// at their bitcode size since only a subset of each is materialized.
+  uint64_t estimateTaskCost(BitcodeModule BM,
+                            const FunctionImporter::ImportMapTy &ImportList,
+                            MapVector<StringRef, BitcodeModule> &ModuleMap) {
+    uint64_t Cost = uint64_t(BM.getBuffer().size()) * 10;
+    for (const auto &I : ImportList) {
+      auto MI = ModuleMap.find(I.first());
+      if (MI != ModuleMap.end())
+        Cost += MI->second.getBuffer().size();
+    }
+    return Cost;
+  }
+
 public:
   InProcessThinBackend(
       Config &Conf, ModuleSummaryIndex &CombinedIndex,
@@ -739,7 +863,8 @@ public:
       AddStreamFn AddStream, NativeObjectCache Cache)
       : ThinBackendProc(Conf, CombinedIndex, ModuleToDefinedGVSummaries),
         BackendThreadPool(ThinLTOParallelismLevel),
-        AddStream(std::move(AddStream)), Cache(std::move(Cache)) {
+        AddStream(std::move(AddStream)), Cache(std::move(Cache)),
+        MemGovernor(uint64_t(ThinLTOMemoryBudgetMB) * 1024 * 1024) {
     // Create a mapping from type identifier GUIDs to type identifier summaries.
     // This allows backends to use the type identifier GUIDs stored in the
     // function summaries to determine which type identifier summaries affect
@@ -796,6 +921,22 @@ public:
     assert(ModuleToDefinedGVSummaries.count(ModulePath));
     const GVSummaryMapTy &DefinedGlobals =
         ModuleToDefinedGVSummaries.find(ModulePath)->second;
+    uint64_t Cost = estimateTaskCost(BM, ImportList, ModuleMap);
+
+    // Issue asynchronous readahead for the bitcode this task will touch: its
+    // own module and the modules it imports from. start() runs on the link
+    // thread while earlier tasks are in their CPU-bound opt/codegen phases,
+    // so the page-in I/O of task N+1's import stage overlaps task N's
+    // computation instead of stalling the pool thread when it reaches
+    // parseModule and cross-module importing.
+    MemoryBuffer::prefetch(BM.getBuffer().data(), BM.getBuffer().size());
+    for (const auto &I : ImportList) {
+      auto MI = ModuleMap.find(I.first());
+      if (MI != ModuleMap.end())
+        MemoryBuffer::prefetch(MI->second.getBuffer().data(),
+                               MI->second.getBuffer().size());
+    }
+
     BackendThreadPool.async(
         [=](BitcodeModule BM, ModuleSummaryIndex &CombinedIndex,
             const FunctionImporter::ImportMapTy &ImportList,
@@ -805,9 +946,13 @@ public:
             const GVSummaryMapTy &DefinedGlobals,
             MapVector<StringRef, BitcodeModule> &ModuleMap,
             const TypeIdSummariesByGuidTy &TypeIdSummariesByGuid) {
+          // Block this pool thread until the task's memory estimate fits in
+          // the global budget; see BackendMemoryGovernor.
+          MemGovernor.acquire(Cost);
           Error E = runThinLTOBackendThread(
               AddStream, Cache, Task, BM, CombinedIndex, ImportList, ExportList,
               ResolvedODR, DefinedGlobals, ModuleMap, TypeIdSummariesByGuid);
+          MemGovernor.release(Cost);
           if (E) {
             std::unique_lock<std::mutex> L(ErrMu);
             if (Err)
@@ -943,6 +1088,10 @@ Error LTO::runThinLTO(AddStreamFn AddStream, NativeObjectCache Cache,
   if (Conf.CombinedIndexHook && !Conf.CombinedIndexHook(ThinLTO.CombinedIndex))
     return Error::success();
 
+  // All modules have been added, so the combined index is complete; switch
+  // it to the flat lookup table for the read-mostly thin-link below.
+  ThinLTO.CombinedIndex.finalizeForReadOnlyUse();
+
   // Collect for each module the list of function it defines (GUID ->
   // Summary).
   StringMap<std::map<GlobalValue::GUID, GlobalValueSummary *>>
@@ -1030,14 +1179,31 @@ Error LTO::runThinLTO(AddStreamFn AddStream, NativeObjectCache Cache,
   // Task numbers start at ParallelCodeGenParallelismLevel if an LTO
   // module is present, as tasks 0 through ParallelCodeGenParallelismLevel-1
   // are reserved for parallel code generation partitions.
-  unsigned Task =
+  unsigned BaseTask =
       HasRegularLTO ? RegularLTO.ParallelCodeGenParallelismLevel : 0;
-  for (auto &Mod : ThinLTO.ModuleMap) {
-    if (Error E = BackendProc->start(Task, Mod.second, ImportLists[Mod.first],
-                                     ExportLists[Mod.first],
-                                     ResolvedODR[Mod.first], ThinLTO.ModuleMap))
+
+  // Submit the tasks with the largest modules first: the pool runs tasks in
+  // submission order, and queueing a big module last leaves most of the pool
+  // idle while it finishes. Task numbers stay tied to the module's position
+  // in the module map so output naming and caching are unaffected.
+  std::vector<unsigned> ModulesOrdering(ThinLTO.ModuleMap.size());
+  std::iota(ModulesOrdering.begin(), ModulesOrdering.end(), 0);
+  std::stable_sort(ModulesOrdering.begin(), ModulesOrdering.end(),
+                   [&](unsigned LHS, unsigned RHS) {
+                     auto ModuleSize = [&](unsigned I) {
+                       return ThinLTO.ModuleMap.begin()[I]
+                           .second.getBuffer()
+                           .size();
+                     };
+                     return ModuleSize(LHS) > ModuleSize(RHS);
+                   });
+
+  for (unsigned I : ModulesOrdering) {
+    auto &Mod = ThinLTO.ModuleMap.begin()[I];
+    if (Error E = BackendProc->start(
+            BaseTask + I, Mod.second, ImportLists[Mod.first],
+            ExportLists[Mod.first], ResolvedODR[Mod.first], ThinLTO.ModuleMap))
       return E;
-    ++Task;
   }
 
   return BackendProc->wait();
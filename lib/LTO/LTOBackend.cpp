@@ -129,27 +129,42 @@ createTargetMachine(Config &Conf, StringRef TheTriple,
       Conf.CodeModel, Conf.CGOptLevel));
 }
 
+/// Register \p AA and the usual analyses with per-backend-task managers.
+///
+/// Each backend task needs its own managers and pass objects: passes and
+/// cached analyses carry per-run state, so a pipeline built once cannot be
+/// shared between the concurrently running backend threads.
+static void registerAnalyses(PassBuilder &PB, AAManager &AA,
+                             LoopAnalysisManager &LAM,
+                             FunctionAnalysisManager &FAM,
+                             CGSCCAnalysisManager &CGAM,
+                             ModuleAnalysisManager &MAM) {
+  // Register the AA manager first so that our version is the one used.
+  FAM.registerPass([&] { return std::move(AA); });
+
+  // Register all the basic analyses with the managers.
+  PB.registerModuleAnalyses(MAM);
+  PB.registerCGSCCAnalyses(CGAM);
+  PB.registerFunctionAnalyses(FAM);
+  PB.registerLoopAnalyses(LAM);
+  PB.crossRegisterProxies(LAM, FAM, CGAM, MAM);
+}
+
 static void runNewPMPasses(Module &Mod, TargetMachine *TM, unsigned OptLevel) {
   PassBuilder PB(TM);
   AAManager AA;
 
-  // Parse a custom AA pipeline if asked to.
-  assert(PB.parseAAPipeline(AA, "default"));
+  // Parse the default AA pipeline. This must not live inside an assert, or
+  // release builds would register a default-constructed (empty) AA manager.
+  if (!PB.parseAAPipeline(AA, "default"))
+    report_fatal_error("Error parsing default AA pipeline");
 
   LoopAnalysisManager LAM;
   FunctionAnalysisManager FAM;
   CGSCCAnalysisManager CGAM;
   ModuleAnalysisManager MAM;
 
-  // Register the AA manager first so that our version is the one used.
-  FAM.registerPass([&] { return std::move(AA); });
-
-  // Register all the basic analyses with the managers.
-  PB.registerModuleAnalyses(MAM);
-  PB.registerCGSCCAnalyses(CGAM);
-  PB.registerFunctionAnalyses(FAM);
-  PB.registerLoopAnalyses(LAM);
-  PB.crossRegisterProxies(LAM, FAM, CGAM, MAM);
+  registerAnalyses(PB, AA, LAM, FAM, CGAM, MAM);
 
   ModulePassManager MPM;
   // FIXME (davide): verify the input.
@@ -197,15 +212,7 @@ static void runNewPMCustomPasses(Module &Mod, TargetMachine *TM,
   CGSCCAnalysisManager CGAM;
   ModuleAnalysisManager MAM;
 
-  // Register the AA manager first so that our version is the one used.
-  FAM.registerPass([&] { return std::move(AA); });
-
-  // Register all the basic analyses with the managers.
-  PB.registerModuleAnalyses(MAM);
-  PB.registerCGSCCAnalyses(CGAM);
-  PB.registerFunctionAnalyses(FAM);
-  PB.registerLoopAnalyses(LAM);
-  PB.crossRegisterProxies(LAM, FAM, CGAM, MAM);
+  registerAnalyses(PB, AA, LAM, FAM, CGAM, MAM);
 
   ModulePassManager MPM;
 
@@ -117,8 +117,11 @@ std::string LTOModule::getProducerString(MemoryBuffer *Buffer) {
 ErrorOr<std::unique_ptr<LTOModule>>
 LTOModule::createFromFile(LLVMContext &Context, StringRef path,
                           const TargetOptions &options) {
+  // The whole module is about to be parsed eagerly, so ask for the bulk
+  // mapping mode (huge pages plus immediate readahead where supported).
   ErrorOr<std::unique_ptr<MemoryBuffer>> BufferOrErr =
-      MemoryBuffer::getFile(path);
+      MemoryBuffer::getFile(path, -1, true, false,
+                            MemoryBuffer::AccessHint_Bulk);
   if (std::error_code EC = BufferOrErr.getError()) {
     Context.emitError(EC.message());
     return EC;
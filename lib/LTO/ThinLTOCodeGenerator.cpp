@@ -14,6 +14,7 @@
 
 #include "llvm/LTO/legacy/ThinLTOCodeGenerator.h"
 
+#include "llvm/ADT/ScopeExit.h"
 #include "llvm/ADT/Statistic.h"
 #include "llvm/ADT/StringExtras.h"
 #include "llvm/Analysis/ModuleSummaryAnalysis.h"
@@ -37,11 +38,13 @@
 #include "llvm/Support/CachePruning.h"
 #include "llvm/Support/Debug.h"
 #include "llvm/Support/Error.h"
+#include "llvm/Support/LineIterator.h"
 #include "llvm/Support/Path.h"
 #include "llvm/Support/SHA1.h"
 #include "llvm/Support/TargetRegistry.h"
 #include "llvm/Support/ThreadPool.h"
 #include "llvm/Support/Threading.h"
+#include "llvm/Support/thread.h"
 #include "llvm/Support/ToolOutputFile.h"
 #include "llvm/Support/VCSRevision.h"
 #include "llvm/Target/TargetMachine.h"
@@ -52,6 +55,7 @@
 #include "llvm/Transforms/ObjCARC.h"
 #include "llvm/Transforms/Utils/FunctionImportUtils.h"
 
+#include <chrono>
 #include <numeric>
 
 using namespace llvm;
@@ -70,6 +74,11 @@ namespace {
 static cl::opt<int>
     ThreadCount("threads", cl::init(llvm::heavyweight_hardware_concurrency()));
 
+static cl::opt<unsigned> PrefetchThreads(
+    "thinlto-prefetch-threads", cl::init(2), cl::Hidden,
+    cl::desc("Number of I/O threads used to fault in module buffers ahead of "
+             "the ThinLTO backend threads (0 disables prefetching)"));
+
 // Simple helper to save temporary files for debug.
 static void saveTempBitcode(const Module &TheModule, StringRef TempDir,
                             unsigned count, StringRef Suffix) {
@@ -137,6 +146,59 @@ generateModuleMap(const std::vector<ThinLTOBuffer> &Modules) {
   return ModuleMap;
 }
 
+// Touch one byte per page of the buffer so that a cold, mmapped input is
+// faulted into the page cache before the backend thread parses it. The reads
+// go through a volatile so they are not optimized away.
+static void prefetchBuffer(MemoryBufferRef Buffer) {
+  volatile char Sink = 0;
+  const char *Data = Buffer.getBufferStart();
+  for (size_t I = 0, E = Buffer.getBufferSize(); I < E; I += 4096)
+    Sink ^= Data[I];
+  (void)Sink;
+}
+
+// Name of the file, relative to the cache directory, holding the backend wall
+// time observed for each module in previous links. Each line is
+// "<milliseconds> <module identifier>". The file is purely an accelerator for
+// scheduling: if it is missing, stale, or pruned along with the cache, the
+// ordering falls back to the buffer-size heuristic.
+static const char *ModuleCostsFilename = "llvmcache-module-costs";
+
+static void loadModuleCosts(StringRef CachePath,
+                            StringMap<uint64_t> &ModuleCosts) {
+  SmallString<128> CostsPath(CachePath);
+  sys::path::append(CostsPath, ModuleCostsFilename);
+  auto BufferOrErr = MemoryBuffer::getFile(CostsPath);
+  if (!BufferOrErr)
+    return;
+  for (line_iterator LineIt(**BufferOrErr, /*SkipBlanks*/ true); !LineIt.is_at_eof();
+       ++LineIt) {
+    auto Split = LineIt->split(' ');
+    uint64_t Millis;
+    if (!Split.first.getAsInteger(10, Millis) && !Split.second.empty())
+      ModuleCosts[Split.second] = Millis;
+  }
+}
+
+static void saveModuleCosts(StringRef CachePath,
+                            const StringMap<uint64_t> &ModuleCosts) {
+  // Write to a temporary and rename, as for cache entries, so that concurrent
+  // links never observe a half-written file.
+  SmallString<128> TempFilename;
+  int TempFD;
+  if (sys::fs::createTemporaryFile("Thin", "costs.tmp", TempFD, TempFilename))
+    return;
+  {
+    raw_fd_ostream OS(TempFD, /* ShouldClose */ true);
+    for (const auto &Cost : ModuleCosts)
+      OS << Cost.second << ' ' << Cost.first() << '\n';
+  }
+  SmallString<128> CostsPath(CachePath);
+  sys::path::append(CostsPath, ModuleCostsFilename);
+  if (sys::fs::rename(TempFilename, CostsPath))
+    sys::fs::remove(TempFilename);
+}
+
 static void promoteModule(Module &TheModule, const ModuleSummaryIndex &Index) {
   if (renameModuleForThinLTO(TheModule, Index))
     report_fatal_error("renameModuleForThinLTO failed");
@@ -812,6 +874,17 @@ static std::string writeGeneratedObject(int count, StringRef CacheEntryPath,
 
 // Main entry point for the ThinLTO processing
 void ThinLTOCodeGenerator::run() {
+  // Kick off cache pruning on a helper thread right away: the directory walk
+  // and stat storm run concurrently with the link instead of stalling it at
+  // the end, and the thread is joined before we return.  Newly written
+  // entries are safe from the pruner since their timestamps are fresh.
+  llvm::thread PruneThread(
+      [](std::string Path, CachePruningPolicy Policy) {
+        pruneCache(Path, Policy);
+      },
+      std::string(CacheOptions.Path), CacheOptions.Policy);
+  auto PruneGuard = make_scope_exit([&] { PruneThread.join(); });
+
   // Prepare the resulting object vector
   assert(ProducedBinaries.empty() && "The generator should not be reused");
   if (SavedObjectsDirectoryPath.empty())
@@ -867,6 +940,10 @@ void ThinLTOCodeGenerator::run() {
   }
 
 
+  // The combined index is fully built; switch it to the flat lookup table
+  // for the read-mostly thin-link phases below.
+  Index->finalizeForReadOnlyUse();
+
   // Prepare the module map.
   auto ModuleMap = generateModuleMap(Modules);
   auto ModuleCount = Modules.size();
@@ -919,21 +996,63 @@ void ThinLTOCodeGenerator::run() {
     ResolvedODR[DefinedGVSummaries.first()];
   }
 
-  // Compute the ordering we will process the inputs: the rough heuristic here
-  // is to sort them per size so that the largest module get schedule as soon as
-  // possible. This is purely a compile-time optimization.
+  // Compute the ordering we will process the inputs: schedule the
+  // longest-expected module first so it never becomes the tail that the whole
+  // link waits on. The expected cost is the backend wall time recorded for
+  // the module by a previous link (kept alongside the cache entries); modules
+  // never seen before have unknown cost and are scheduled ahead of known
+  // ones since they may be arbitrarily expensive. Among themselves, and when
+  // no costs are recorded at all, modules fall back to the old
+  // largest-buffer-first heuristic. This is purely a compile-time
+  // optimization.
+  StringMap<uint64_t> ModuleCosts;
+  if (!CacheOptions.Path.empty())
+    loadModuleCosts(CacheOptions.Path, ModuleCosts);
   std::vector<int> ModulesOrdering;
   ModulesOrdering.resize(Modules.size());
   std::iota(ModulesOrdering.begin(), ModulesOrdering.end(), 0);
   std::sort(ModulesOrdering.begin(), ModulesOrdering.end(),
             [&](int LeftIndex, int RightIndex) {
+              auto LCost =
+                  ModuleCosts.lookup(Modules[LeftIndex].getBufferIdentifier());
+              auto RCost =
+                  ModuleCosts.lookup(Modules[RightIndex].getBufferIdentifier());
+              if (LCost && RCost && LCost != RCost)
+                return LCost > RCost;
+              if ((LCost == 0) != (RCost == 0))
+                return LCost == 0;
               auto LSize = Modules[LeftIndex].getBuffer().size();
               auto RSize = Modules[RightIndex].getBuffer().size();
               return LSize > RSize;
             });
 
+  // Backend wall time per task, in milliseconds, for modules compiled in this
+  // link (cache hits keep their previously recorded cost). Indexed by task
+  // number, so the backend threads write to it without synchronization.
+  std::vector<uint64_t> BackendWallTimes(Modules.size(), 0);
+
   // Parallel optimizer + codegen
   {
+    // The inputs are typically mmapped by the linker, so a cold backend
+    // thread stalls on major faults while parsing its module and the import
+    // sources. The import lists are known at this point: walk the modules in
+    // scheduling order on dedicated I/O threads and fault each buffer in
+    // once, overlapping the file I/O with optimization of earlier modules.
+    // The pool is declared before the compute pool so it is joined after it.
+    std::unique_ptr<ThreadPool> PrefetchPool;
+    if (PrefetchThreads > 0) {
+      PrefetchPool.reset(new ThreadPool(PrefetchThreads));
+      StringSet<> EnqueuedBuffers;
+      for (auto IndexCount : ModulesOrdering) {
+        auto ModuleIdentifier = Modules[IndexCount].getBufferIdentifier();
+        if (EnqueuedBuffers.insert(ModuleIdentifier).second)
+          PrefetchPool->async(prefetchBuffer, ModuleMap[ModuleIdentifier]);
+        for (auto &Src : ImportLists[ModuleIdentifier])
+          if (EnqueuedBuffers.insert(Src.first()).second)
+            PrefetchPool->async(prefetchBuffer, ModuleMap[Src.first()]);
+      }
+    }
+
     ThreadPool Pool(ThreadCount);
     for (auto IndexCount : ModulesOrdering) {
       auto &ModuleBuffer = Modules[IndexCount];
@@ -969,6 +1088,8 @@ void ThinLTOCodeGenerator::run() {
           }
         }
 
+        auto BackendStart = std::chrono::steady_clock::now();
+
         LLVMContext Context;
         Context.setDiscardValueNames(LTODiscardValueNames);
         Context.enableDebugTypeODRUniquing();
@@ -999,6 +1120,11 @@ void ThinLTOCodeGenerator::run() {
         // Commit to the cache (if enabled)
         CacheEntry.write(*OutputBuffer);
 
+        BackendWallTimes[count] =
+            std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::steady_clock::now() - BackendStart)
+                .count();
+
         if (SavedObjectsDirectoryPath.empty()) {
           // We need to generated a memory buffer for the linker.
           if (!CacheEntryPath.empty()) {
@@ -1026,7 +1152,16 @@ void ThinLTOCodeGenerator::run() {
     }
   }
 
-  pruneCache(CacheOptions.Path, CacheOptions.Policy);
+  // Record the observed backend times for the next link to schedule by.
+  // Modules served from the cache keep their previously recorded cost.
+  if (!CacheOptions.Path.empty()) {
+    for (size_t I = 0, E = Modules.size(); I != E; ++I)
+      if (BackendWallTimes[I])
+        ModuleCosts[Modules[I].getBufferIdentifier()] = BackendWallTimes[I];
+    saveModuleCosts(CacheOptions.Path, ModuleCosts);
+  }
+
+  // Cache pruning runs on the helper thread started at the top of run().
 
   // If statistics were requested, print them out now.
   if (llvm::AreStatisticsEnabled())
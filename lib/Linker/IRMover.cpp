@@ -701,6 +701,18 @@ void IRLinker::computeTypeMapping() {
   // At this point, the destination module may have a type "%foo = { i32 }" for
   // example.  When the source module got loaded into the same LLVMContext, if
   // it had the same type, it would have been renamed to "%foo.42 = { i32 }".
+  //
+  // Skip this when importing for ThinLTO: getIdentifiedStructTypes() walks
+  // every type reachable from the lazily loaded source module, which is far
+  // more of the type graph than the few imported bodies will reference. The
+  // mapping recovered here only merges renamed structs with their originals,
+  // which is a naming nicety rather than a correctness requirement; types the
+  // import actually uses are mapped on demand.
+  if (IsPerformingImport) {
+    TypeMap.linkDefinedTypeBodies();
+    return;
+  }
+
   std::vector<StructType *> Types = SrcM->getIdentifiedStructTypes();
   for (StructType *ST : Types) {
     if (!ST->hasName())
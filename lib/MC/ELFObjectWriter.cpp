@@ -35,6 +35,7 @@
 #include "llvm/MC/StringTableBuilder.h"
 #include "llvm/Support/Allocator.h"
 #include "llvm/Support/Casting.h"
+#include "llvm/Support/CommandLine.h"
 #include "llvm/Support/Compression.h"
 #include "llvm/Support/ELF.h"
 #include "llvm/Support/Endian.h"
@@ -45,6 +46,7 @@
 #include "llvm/Support/SMLoc.h"
 #include "llvm/Support/StringSaver.h"
 #include "llvm/Support/SwapByteOrder.h"
+#include "llvm/Support/ThreadPool.h"
 #include "llvm/Support/raw_ostream.h"
 #include <algorithm>
 #include <cassert>
@@ -61,12 +63,43 @@ using namespace llvm;
 #undef  DEBUG_TYPE
 #define DEBUG_TYPE "reloc-info"
 
+static cl::opt<bool> ParallelSectionWrite(
+    "mc-parallel-section-write", cl::Hidden, cl::init(false),
+    cl::desc("Render ELF section contents on a thread pool before writing "
+             "them out"));
+
 namespace {
 
 using SectionIndexMapTy = DenseMap<const MCSectionELF *, uint32_t>;
 
 class ELFObjectWriter;
 
+/// A minimal object writer used to render one section's contents into a
+/// memory buffer. By the time it runs, layout and relaxation are complete and
+/// all fixups have been applied, so only the streaming half of the
+/// MCObjectWriter interface is ever exercised.
+class ELFSectionDataWriter : public MCObjectWriter {
+public:
+  ELFSectionDataWriter(raw_pwrite_stream &OS, bool IsLittleEndian)
+      : MCObjectWriter(OS, IsLittleEndian) {}
+
+  void executePostLayoutBinding(MCAssembler &Asm,
+                                const MCAsmLayout &Layout) override {
+    llvm_unreachable("section data writers only stream fragment contents");
+  }
+
+  void recordRelocation(MCAssembler &Asm, const MCAsmLayout &Layout,
+                        const MCFragment *Fragment, const MCFixup &Fixup,
+                        MCValue Target, bool &IsPCRel,
+                        uint64_t &FixedValue) override {
+    llvm_unreachable("section data writers only stream fragment contents");
+  }
+
+  void writeObject(MCAssembler &Asm, const MCAsmLayout &Layout) override {
+    llvm_unreachable("section data writers only stream fragment contents");
+  }
+};
+
 class SymbolTableWriter {
   ELFObjectWriter &EWriter;
   bool Is64Bit;
@@ -1234,9 +1267,39 @@ void ELFObjectWriter::writeObject(MCAssembler &Asm,
   writeHeader(Asm);
 
   // ... then the sections ...
+
+  // When requested, render each section's contents into a memory buffer on a
+  // thread pool first. Section contents are independent of one another once
+  // layout is done and all fixups have been applied, so for large objects
+  // this makes emission memory-bandwidth bound instead of serialized on the
+  // output stream. Compressed debug sections take a separate path through
+  // writeSectionData that swaps the stream in place, so they keep the serial
+  // path.
+  std::vector<SmallVector<char, 0>> SectionContents;
+  bool PreRenderedSections = false;
+  if (ParallelSectionWrite && Asm.size() > 1 &&
+      Ctx.getAsmInfo()->compressDebugSections() ==
+          DebugCompressionType::DCT_None) {
+    SectionContents.resize(Asm.size());
+    ThreadPool Pool;
+    unsigned Idx = 0;
+    for (MCSection &Sec : Asm) {
+      const MCSection *SecPtr = &Sec;
+      SmallVector<char, 0> *Buffer = &SectionContents[Idx++];
+      Pool.async([this, &Asm, &Layout, SecPtr, Buffer] {
+        raw_svector_ostream VecOS(*Buffer);
+        ELFSectionDataWriter SDW(VecOS, isLittleEndian());
+        Asm.writeSectionData(SDW, SecPtr, Layout);
+      });
+    }
+    Pool.wait();
+    PreRenderedSections = true;
+  }
+
   SectionOffsetsTy SectionOffsets;
   std::vector<MCSectionELF *> Groups;
   std::vector<MCSectionELF *> Relocations;
+  unsigned SectionIdx = 0;
   for (MCSection &Sec : Asm) {
     MCSectionELF &Section = static_cast<MCSectionELF &>(Sec);
 
@@ -1246,7 +1309,12 @@ void ELFObjectWriter::writeObject(MCAssembler &Asm,
     uint64_t SecStart = getStream().tell();
 
     const MCSymbolELF *SignatureSymbol = Section.getGroup();
-    writeSectionData(Asm, Section, Layout);
+    if (PreRenderedSections) {
+      const SmallVector<char, 0> &Buffer = SectionContents[SectionIdx++];
+      writeBytes(StringRef(Buffer.data(), Buffer.size()));
+    } else {
+      writeSectionData(Asm, Section, Layout);
+    }
 
     uint64_t SecEnd = getStream().tell();
     SectionOffsets[&Section] = std::make_pair(SecStart, SecEnd);
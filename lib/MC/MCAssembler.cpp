@@ -442,11 +442,9 @@ void MCAssembler::writeFragmentPadding(const MCFragment &F, uint64_t FSize,
   }
 }
 
-/// \brief Write the fragment \p F to the output file.
+/// \brief Write the fragment \p F to \p OW.
 static void writeFragment(const MCAssembler &Asm, const MCAsmLayout &Layout,
-                          const MCFragment &F) {
-  MCObjectWriter *OW = &Asm.getWriter();
-
+                          const MCFragment &F, MCObjectWriter *OW) {
   // FIXME: Embed in fragments instead?
   uint64_t FragmentSize = Asm.computeFragmentSize(Layout, F);
 
@@ -585,7 +583,7 @@ static void writeFragment(const MCAssembler &Asm, const MCAsmLayout &Layout,
          "The stream should advance by fragment size");
 }
 
-void MCAssembler::writeSectionData(const MCSection *Sec,
+void MCAssembler::writeSectionData(MCObjectWriter &OW, const MCSection *Sec,
                                    const MCAsmLayout &Layout) const {
   // Ignore virtual sections.
   if (Sec->isVirtualSection()) {
@@ -629,13 +627,13 @@ void MCAssembler::writeSectionData(const MCSection *Sec,
     return;
   }
 
-  uint64_t Start = getWriter().getStream().tell();
+  uint64_t Start = OW.getStream().tell();
   (void)Start;
 
   for (const MCFragment &F : *Sec)
-    writeFragment(*this, Layout, F);
+    writeFragment(*this, Layout, F, &OW);
 
-  assert(getWriter().getStream().tell() - Start ==
+  assert(OW.getStream().tell() - Start ==
          Layout.getSectionAddressSize(Sec));
 }
 
@@ -668,7 +666,7 @@ void MCAssembler::layout(MCAsmLayout &Layout) {
     // Create dummy fragments to eliminate any empty sections, this simplifies
     // layout.
     if (Sec.getFragmentList().empty())
-      new MCDataFragment(&Sec);
+      new (getContext()) MCDataFragment(&Sec);
 
     Sec.setOrdinal(SectionIndex++);
   }
@@ -684,7 +682,8 @@ void MCAssembler::layout(MCAsmLayout &Layout) {
   }
 
   // Layout until everything fits.
-  while (layoutOnce(Layout))
+  RelaxDirtyState Dirty;
+  while (layoutOnce(Layout, Dirty))
     if (getContext().hadError())
       return;
 
@@ -877,7 +876,108 @@ bool MCAssembler::relaxCVDefRange(MCAsmLayout &Layout,
   return OldSize != F.getContents().size();
 }
 
-bool MCAssembler::layoutSectionOnce(MCAsmLayout &Layout, MCSection &Sec) {
+/// Collect the same-section layout-order bound of every fragment the given
+/// expression reads.  Returns false if the expression depends on anything
+/// that cannot be summarized this way (other sections, undefined or variable
+/// symbols, target-specific nodes); such fragments are re-examined on every
+/// scan.
+static bool collectRelaxDeps(const MCExpr *Expr, const MCSection *Sec,
+                             unsigned &MaxOrder) {
+  switch (Expr->getKind()) {
+  case MCExpr::Constant:
+    return true;
+
+  case MCExpr::SymbolRef: {
+    const MCSymbol &Sym = cast<MCSymbolRefExpr>(Expr)->getSymbol();
+    if (Sym.isVariable())
+      return false;
+    const MCFragment *F = Sym.getFragment();
+    if (!F || F->getParent() != Sec)
+      return false;
+    MaxOrder = std::max(MaxOrder, F->getLayoutOrder());
+    return true;
+  }
+
+  case MCExpr::Unary:
+    return collectRelaxDeps(cast<MCUnaryExpr>(Expr)->getSubExpr(), Sec,
+                            MaxOrder);
+
+  case MCExpr::Binary: {
+    const MCBinaryExpr *BE = cast<MCBinaryExpr>(Expr);
+    return collectRelaxDeps(BE->getLHS(), Sec, MaxOrder) &&
+           collectRelaxDeps(BE->getRHS(), Sec, MaxOrder);
+  }
+
+  case MCExpr::Target:
+    return false;
+  }
+  llvm_unreachable("Invalid expression kind!");
+}
+
+/// Summarize the relaxation dependencies of \p F as the highest same-section
+/// layout order it reads (including its own position, for PC-relative
+/// fixups) and whether it has dependencies the bound does not cover.
+static std::pair<unsigned, bool> computeRelaxDeps(const MCFragment &F) {
+  const MCSection *Sec = F.getParent();
+  unsigned MaxOrder = F.getLayoutOrder();
+  bool External = false;
+  auto AddExpr = [&](const MCExpr *E) {
+    if (!collectRelaxDeps(E, Sec, MaxOrder))
+      External = true;
+  };
+
+  switch (F.getKind()) {
+  case MCFragment::FT_Relaxable:
+    for (const MCFixup &Fixup : cast<MCRelaxableFragment>(F).getFixups())
+      AddExpr(Fixup.getValue());
+    break;
+  case MCFragment::FT_Dwarf:
+    AddExpr(&cast<MCDwarfLineAddrFragment>(F).getAddrDelta());
+    break;
+  case MCFragment::FT_DwarfFrame:
+    AddExpr(&cast<MCDwarfCallFrameFragment>(F).getAddrDelta());
+    break;
+  case MCFragment::FT_LEB:
+    AddExpr(&cast<MCLEBFragment>(F).getValue());
+    break;
+  default:
+    // No cheap dependency summary for the codeview fragments.
+    External = true;
+    break;
+  }
+  return std::make_pair(MaxOrder, External);
+}
+
+/// Return true if \p F's relaxation decision may have changed since the
+/// previous scan of its section, whose first relaxed fragment had layout
+/// order \p PrevMinRelaxed.  Offsets of fragments laid out strictly before
+/// that point are unchanged, so a fragment whose dependencies all lie there
+/// must make the same decision it made before.
+static bool fragmentRelaxInputsDirty(MCAssembler::RelaxDirtyState &Dirty,
+                                     const MCFragment &F,
+                                     unsigned PrevMinRelaxed) {
+  switch (F.getKind()) {
+  case MCFragment::FT_Relaxable:
+  case MCFragment::FT_Dwarf:
+  case MCFragment::FT_DwarfFrame:
+  case MCFragment::FT_LEB:
+    break;
+  default:
+    return true;
+  }
+
+  auto It = Dirty.Deps.find(&F);
+  if (It == Dirty.Deps.end())
+    It = Dirty.Deps.insert(std::make_pair(&F, computeRelaxDeps(F))).first;
+  return It->second.second || It->second.first >= PrevMinRelaxed;
+}
+
+bool MCAssembler::layoutSectionOnce(MCAsmLayout &Layout, MCSection &Sec,
+                                    RelaxDirtyState &Dirty) {
+  // The layout order of the first fragment the previous scan of this section
+  // relaxed, or 0 if this is the first scan and everything must be examined.
+  unsigned PrevMinRelaxed = Dirty.PrevMinRelaxed.lookup(&Sec);
+
   // Holds the first fragment which needed relaxing during this layout. It will
   // remain NULL if none were relaxed.
   // When a fragment is relaxed, all the fragments following it should get
@@ -886,6 +986,13 @@ bool MCAssembler::layoutSectionOnce(MCAsmLayout &Layout, MCSection &Sec) {
 
   // Attempt to relax all the fragments in the section.
   for (MCSection::iterator I = Sec.begin(), IE = Sec.end(); I != IE; ++I) {
+    // Skip fragments whose relaxation inputs cannot have moved since the
+    // previous scan; re-evaluating their fixups would reach the same
+    // decision.  This makes convergence cost proportional to what actually
+    // changed instead of scans times fragments.
+    if (PrevMinRelaxed && !fragmentRelaxInputsDirty(Dirty, *I, PrevMinRelaxed))
+      continue;
+
     // Check if this is a fragment that needs relaxation.
     bool RelaxedFrag = false;
     switch(I->getKind()) {
@@ -916,9 +1023,20 @@ bool MCAssembler::layoutSectionOnce(MCAsmLayout &Layout, MCSection &Sec) {
       RelaxedFrag = relaxCVDefRange(Layout, *cast<MCCVDefRangeFragment>(I));
       break;
     }
-    if (RelaxedFrag && !FirstRelaxedFragment)
-      FirstRelaxedFragment = &*I;
+    if (RelaxedFrag) {
+      // Relaxing regenerates the fragment's fixups; recompute its
+      // dependency summary on the next scan.
+      Dirty.Deps.erase(&*I);
+      if (!FirstRelaxedFragment)
+        FirstRelaxedFragment = &*I;
+    }
   }
+
+  // Record where this scan started changing offsets so that the next scan
+  // can skip everything laid out before that point.
+  Dirty.PrevMinRelaxed[&Sec] =
+      FirstRelaxedFragment ? FirstRelaxedFragment->getLayoutOrder() : UINT_MAX;
+
   if (FirstRelaxedFragment) {
     Layout.invalidateFragmentsFrom(FirstRelaxedFragment);
     return true;
@@ -926,13 +1044,13 @@ bool MCAssembler::layoutSectionOnce(MCAsmLayout &Layout, MCSection &Sec) {
   return false;
 }
 
-bool MCAssembler::layoutOnce(MCAsmLayout &Layout) {
+bool MCAssembler::layoutOnce(MCAsmLayout &Layout, RelaxDirtyState &Dirty) {
   ++stats::RelaxationSteps;
 
   bool WasRelaxed = false;
   for (iterator it = begin(), ie = end(); it != ie; ++it) {
     MCSection &Sec = *it;
-    while (layoutSectionOnce(Layout, Sec))
+    while (layoutSectionOnce(Layout, Sec, Dirty))
       WasRelaxed = true;
   }
 
@@ -26,13 +26,14 @@
 using namespace llvm;
 using namespace llvm::codeview;
 
-CodeViewContext::CodeViewContext() {}
+CodeViewContext::CodeViewContext(MCContext &MCCtx) : MCCtx(MCCtx) {}
 
 CodeViewContext::~CodeViewContext() {
   // If someone inserted strings into the string table but never actually
-  // emitted them somewhere, clean up the fragment.
-  if (!InsertedStrTabFragment)
-    delete StrTabFragment;
+  // emitted them somewhere, clean up the fragment. It lives in the context's
+  // arena, so destroying it just runs the destructor.
+  if (!InsertedStrTabFragment && StrTabFragment)
+    StrTabFragment->destroy();
 }
 
 /// This is a valid number for use with .cv_loc if we've already seen a .cv_file
@@ -111,7 +112,7 @@ bool CodeViewContext::recordInlinedCallSiteId(unsigned FuncId, unsigned IAFunc,
 
 MCDataFragment *CodeViewContext::getStringTableFragment() {
   if (!StrTabFragment) {
-    StrTabFragment = new MCDataFragment();
+    StrTabFragment = new (MCCtx) MCDataFragment();
     // Start a new string table out with a null byte.
     StrTabFragment->getContents().push_back('\0');
   }
@@ -289,9 +290,9 @@ void CodeViewContext::emitInlineLineTableForFunction(MCObjectStreamer &OS,
                                                      const MCSymbol *FnEndSym) {
   // Create and insert a fragment into the current section that will be encoded
   // later.
-  new MCCVInlineLineTableFragment(PrimaryFunctionId, SourceFileId,
-                                  SourceLineNum, FnStartSym, FnEndSym,
-                                  OS.getCurrentSectionOnly());
+  new (MCCtx) MCCVInlineLineTableFragment(PrimaryFunctionId, SourceFileId,
+                                          SourceLineNum, FnStartSym, FnEndSym,
+                                          OS.getCurrentSectionOnly());
 }
 
 void CodeViewContext::emitDefRange(
@@ -300,8 +301,8 @@ void CodeViewContext::emitDefRange(
     StringRef FixedSizePortion) {
   // Create and insert a fragment into the current section that will be encoded
   // later.
-  new MCCVDefRangeFragment(Ranges, FixedSizePortion,
-                           OS.getCurrentSectionOnly());
+  new (MCCtx) MCCVDefRangeFragment(Ranges, FixedSizePortion,
+                                   OS.getCurrentSectionOnly());
 }
 
 static unsigned computeLabelDiff(MCAsmLayout &Layout, const MCSymbol *Begin,
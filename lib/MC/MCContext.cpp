@@ -57,7 +57,7 @@ MCContext::MCContext(const MCAsmInfo *mai, const MCRegisterInfo *mri,
                      const MCObjectFileInfo *mofi, const SourceMgr *mgr,
                      bool DoAutoReset)
     : SrcMgr(mgr), InlineSrcMgr(nullptr), MAI(mai), MRI(mri), MOFI(mofi),
-      Symbols(Allocator), UsedNames(Allocator),
+      ConcurrentSymbolCreation(false),
       CurrentDwarfLoc(0, 0, 0, DWARF2_FLAG_IS_STMT, 0, 0),
       AutoReset(DoAutoReset) {
   SecureLogFile = AsSecureLogFileName;
@@ -80,14 +80,25 @@ MCContext::~MCContext() {
 //===----------------------------------------------------------------------===//
 
 void MCContext::reset() {
+  // The CodeView context may own a fragment that was never inserted into a
+  // section; destroy it before the arena holding the fragments is reset.
+  CVContext.reset();
+
   // Call the destructors so the fragments are freed
   COFFAllocator.DestroyAll();
   ELFAllocator.DestroyAll();
   MachOAllocator.DestroyAll();
+  WasmAllocator.DestroyAll();
 
   MCSubtargetAllocator.DestroyAll();
-  UsedNames.clear();
-  Symbols.clear();
+  for (UsedNamesShard &Shard : UsedNameShards) {
+    Shard.UsedNames.clear();
+    Shard.Allocator.Reset();
+  }
+  for (SymbolTableShard &Shard : SymbolShards) {
+    Shard.Symbols.clear();
+    Shard.Allocator.Reset();
+  }
   Allocator.Reset();
   Instances.clear();
   CompilationDir.clear();
@@ -99,8 +110,6 @@ void MCContext::reset() {
   DwarfCompileUnitID = 0;
   CurrentDwarfLoc = MCDwarfLoc(0, 0, 0, DWARF2_FLAG_IS_STMT, 0, 0);
 
-  CVContext.reset();
-
   MachOUniquingMap.clear();
   ELFUniquingMap.clear();
   COFFUniquingMap.clear();
@@ -124,7 +133,9 @@ MCSymbol *MCContext::getOrCreateSymbol(const Twine &Name) {
 
   assert(!NameRef.empty() && "Normal symbols cannot be unnamed!");
 
-  MCSymbol *&Sym = Symbols[NameRef];
+  SymbolTableShard &Shard = SymbolShards[getSymbolShard(NameRef)];
+  OptionalShardLock Lock(Shard.Lock, ConcurrentSymbolCreation);
+  MCSymbol *&Sym = Shard.Symbols[NameRef];
   if (!Sym)
     Sym = createSymbol(NameRef, false, false);
 
@@ -148,27 +159,38 @@ MCSymbol *MCContext::getOrCreateLSDASymbol(StringRef FuncName) {
 }
 
 MCSymbol *MCContext::createSymbolImpl(const StringMapEntry<bool> *Name,
-                                      bool IsTemporary) {
+                                      bool IsTemporary,
+                                      BumpPtrAllocator &Alloc) {
   if (MOFI) {
     switch (MOFI->getObjectFileType()) {
     case MCObjectFileInfo::IsCOFF:
-      return new (Name, *this) MCSymbolCOFF(Name, IsTemporary);
+      return new (Name, Alloc) MCSymbolCOFF(Name, IsTemporary);
     case MCObjectFileInfo::IsELF:
-      return new (Name, *this) MCSymbolELF(Name, IsTemporary);
+      return new (Name, Alloc) MCSymbolELF(Name, IsTemporary);
     case MCObjectFileInfo::IsMachO:
-      return new (Name, *this) MCSymbolMachO(Name, IsTemporary);
+      return new (Name, Alloc) MCSymbolMachO(Name, IsTemporary);
     case MCObjectFileInfo::IsWasm:
-      return new (Name, *this) MCSymbolWasm(Name, IsTemporary);
+      return new (Name, Alloc) MCSymbolWasm(Name, IsTemporary);
     }
   }
-  return new (Name, *this) MCSymbol(MCSymbol::SymbolKindUnset, Name,
+  return new (Name, Alloc) MCSymbol(MCSymbol::SymbolKindUnset, Name,
                                     IsTemporary);
 }
 
+unsigned MCContext::getNextUniqueID(StringRef Name) {
+  OptionalShardLock Lock(NextIDLock, ConcurrentSymbolCreation);
+  return NextID[Name]++;
+}
+
 MCSymbol *MCContext::createSymbol(StringRef Name, bool AlwaysAddSuffix,
                                   bool CanBeUnnamed) {
-  if (CanBeUnnamed && !UseNamesOnTempLabels)
-    return createSymbolImpl(nullptr, true);
+  if (CanBeUnnamed && !UseNamesOnTempLabels) {
+    // Unnamed symbols have no name to select a shard with; allocate them
+    // from the first shard's arena.
+    UsedNamesShard &Shard = UsedNameShards[0];
+    OptionalShardLock Lock(Shard.Lock, ConcurrentSymbolCreation);
+    return createSymbolImpl(nullptr, true, Shard.Allocator);
+  }
 
   // Determine whether this is a user written assembler temporary or normal
   // label, if used.
@@ -178,20 +200,21 @@ MCSymbol *MCContext::createSymbol(StringRef Name, bool AlwaysAddSuffix,
 
   SmallString<128> NewName = Name;
   bool AddSuffix = AlwaysAddSuffix;
-  unsigned &NextUniqueID = NextID[Name];
   while (true) {
     if (AddSuffix) {
       NewName.resize(Name.size());
-      raw_svector_ostream(NewName) << NextUniqueID++;
+      raw_svector_ostream(NewName) << getNextUniqueID(Name);
     }
-    auto NameEntry = UsedNames.insert(std::make_pair(NewName, true));
+    UsedNamesShard &Shard = UsedNameShards[getSymbolShard(NewName)];
+    OptionalShardLock Lock(Shard.Lock, ConcurrentSymbolCreation);
+    auto NameEntry = Shard.UsedNames.insert(std::make_pair(NewName, true));
     if (NameEntry.second || !NameEntry.first->second) {
       // Ok, we found a name.
       // Mark it as used for a non-section symbol.
       NameEntry.first->second = true;
       // Have the MCSymbol object itself refer to the copy of the string that is
       // embedded in the UsedNames entry.
-      return createSymbolImpl(&*NameEntry.first, IsTemporary);
+      return createSymbolImpl(&*NameEntry.first, IsTemporary, Shard.Allocator);
     }
     assert(IsTemporary && "Cannot rename non-temporary symbols");
     AddSuffix = true;
@@ -254,7 +277,9 @@ MCSymbol *MCContext::getDirectionalLocalSymbol(unsigned LocalLabelVal,
 MCSymbol *MCContext::lookupSymbol(const Twine &Name) const {
   SmallString<128> NameSV;
   StringRef NameRef = Name.toStringRef(NameSV);
-  return Symbols.lookup(NameRef);
+  const SymbolTableShard &Shard = SymbolShards[getSymbolShard(NameRef)];
+  OptionalShardLock Lock(Shard.Lock, ConcurrentSymbolCreation);
+  return Shard.Symbols.lookup(NameRef);
 }
 
 void MCContext::setSymbolValue(MCStreamer &Streamer,
@@ -319,7 +344,9 @@ MCSectionELF *MCContext::createELFSectionImpl(StringRef Section, unsigned Type,
                                               unsigned UniqueID,
                                               const MCSymbolELF *Associated) {
   MCSymbolELF *R;
-  MCSymbol *&Sym = Symbols[Section];
+  SymbolTableShard &SymShard = SymbolShards[getSymbolShard(Section)];
+  OptionalShardLock SymLock(SymShard.Lock, ConcurrentSymbolCreation);
+  MCSymbol *&Sym = SymShard.Symbols[Section];
   // A section symbol can not redefine regular symbols. There may be multiple
   // sections with the same name, in which case the first such section wins.
   if (Sym && Sym->isDefined() &&
@@ -328,8 +355,12 @@ MCSectionELF *MCContext::createELFSectionImpl(StringRef Section, unsigned Type,
   if (Sym && Sym->isUndefined()) {
     R = cast<MCSymbolELF>(Sym);
   } else {
-    auto NameIter = UsedNames.insert(std::make_pair(Section, false)).first;
-    R = new (&*NameIter, *this) MCSymbolELF(&*NameIter, /*isTemporary*/ false);
+    UsedNamesShard &NameShard = UsedNameShards[getSymbolShard(Section)];
+    OptionalShardLock NameLock(NameShard.Lock, ConcurrentSymbolCreation);
+    auto NameIter =
+        NameShard.UsedNames.insert(std::make_pair(Section, false)).first;
+    R = new (&*NameIter, NameShard.Allocator)
+        MCSymbolELF(&*NameIter, /*isTemporary*/ false);
     if (!Sym)
       Sym = R;
   }
@@ -339,7 +370,7 @@ MCSectionELF *MCContext::createELFSectionImpl(StringRef Section, unsigned Type,
   auto *Ret = new (ELFAllocator.Allocate()) MCSectionELF(
       Section, Type, Flags, K, EntrySize, Group, UniqueID, R, Associated);
 
-  auto *F = new MCDataFragment();
+  auto *F = new (*this) MCDataFragment();
   Ret->getFragmentList().insert(Ret->begin(), F);
   F->setParent(Ret);
   R->setFragment(F);
@@ -597,7 +628,7 @@ void MCContext::finalizeDwarfSections(MCStreamer &MCOS) {
 
 CodeViewContext &MCContext::getCVContext() {
   if (!CVContext.get())
-    CVContext.reset(new CodeViewContext);
+    CVContext.reset(new CodeViewContext(*this));
   return *CVContext.get();
 }
 
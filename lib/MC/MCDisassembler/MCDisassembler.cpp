@@ -8,6 +8,7 @@
 //===----------------------------------------------------------------------===//
 
 #include "llvm/MC/MCDisassembler/MCDisassembler.h"
+#include "llvm/ADT/ArrayRef.h"
 #include "llvm/Support/raw_ostream.h"
 #include <algorithm>
 
@@ -15,6 +16,31 @@ using namespace llvm;
 
 MCDisassembler::~MCDisassembler() = default;
 
+size_t MCDisassembler::getInstructions(std::vector<DecodedInst> &Insts,
+                                       SmallVectorImpl<char> &Comments,
+                                       ArrayRef<uint8_t> Bytes,
+                                       uint64_t Address,
+                                       raw_ostream &VStream) const {
+  raw_svector_ostream CStream(Comments);
+  size_t NumAppended = 0;
+  uint64_t Index = 0;
+  while (Index < Bytes.size()) {
+    Insts.emplace_back();
+    DecodedInst &DI = Insts.back();
+    DI.CommentOffset = Comments.size();
+    DI.Size = 0;
+    DI.Status = getInstruction(DI.Inst, DI.Size, Bytes.slice(Index),
+                               Address + Index, VStream, CStream);
+    // Ensure forward progress past undecodable bytes.
+    if (DI.Size == 0)
+      DI.Size = 1;
+    DI.CommentSize = Comments.size() - DI.CommentOffset;
+    Index += DI.Size;
+    ++NumAppended;
+  }
+  return NumAppended;
+}
+
 bool MCDisassembler::tryAddingSymbolicOperand(MCInst &Inst, int64_t Value,
                                               uint64_t Address, bool IsBranch,
                                               uint64_t Offset,
@@ -122,44 +122,56 @@ EmitDwarfLineTable(MCObjectStreamer *MCOS, MCSection *Section,
   unsigned Discriminator = 0;
   MCSymbol *LastLabel = nullptr;
 
+  // Batch the standard opcodes for each row into a local buffer and hand it
+  // to the streamer in one piece, rather than paying a streamer call per
+  // opcode. The address advance still goes through the streamer since it may
+  // need a relaxable fragment for a not-yet-absolute label difference.
+  SmallString<128> Row;
+  raw_svector_ostream RowOS(Row);
+
   // Loop through each MCDwarfLineEntry and encode the dwarf line number table.
   for (const MCDwarfLineEntry &LineEntry : LineEntries) {
     int64_t LineDelta = static_cast<int64_t>(LineEntry.getLine()) - LastLine;
 
     if (FileNum != LineEntry.getFileNum()) {
       FileNum = LineEntry.getFileNum();
-      MCOS->EmitIntValue(dwarf::DW_LNS_set_file, 1);
-      MCOS->EmitULEB128IntValue(FileNum);
+      Row.push_back(dwarf::DW_LNS_set_file);
+      encodeULEB128(FileNum, RowOS);
     }
     if (Column != LineEntry.getColumn()) {
       Column = LineEntry.getColumn();
-      MCOS->EmitIntValue(dwarf::DW_LNS_set_column, 1);
-      MCOS->EmitULEB128IntValue(Column);
+      Row.push_back(dwarf::DW_LNS_set_column);
+      encodeULEB128(Column, RowOS);
     }
     if (Discriminator != LineEntry.getDiscriminator() &&
         MCOS->getContext().getDwarfVersion() >= 4) {
       Discriminator = LineEntry.getDiscriminator();
       unsigned Size = getULEB128Size(Discriminator);
-      MCOS->EmitIntValue(dwarf::DW_LNS_extended_op, 1);
-      MCOS->EmitULEB128IntValue(Size + 1);
-      MCOS->EmitIntValue(dwarf::DW_LNE_set_discriminator, 1);
-      MCOS->EmitULEB128IntValue(Discriminator);
+      Row.push_back(dwarf::DW_LNS_extended_op);
+      encodeULEB128(Size + 1, RowOS);
+      Row.push_back(dwarf::DW_LNE_set_discriminator);
+      encodeULEB128(Discriminator, RowOS);
     }
     if (Isa != LineEntry.getIsa()) {
       Isa = LineEntry.getIsa();
-      MCOS->EmitIntValue(dwarf::DW_LNS_set_isa, 1);
-      MCOS->EmitULEB128IntValue(Isa);
+      Row.push_back(dwarf::DW_LNS_set_isa);
+      encodeULEB128(Isa, RowOS);
     }
     if ((LineEntry.getFlags() ^ Flags) & DWARF2_FLAG_IS_STMT) {
       Flags = LineEntry.getFlags();
-      MCOS->EmitIntValue(dwarf::DW_LNS_negate_stmt, 1);
+      Row.push_back(dwarf::DW_LNS_negate_stmt);
     }
     if (LineEntry.getFlags() & DWARF2_FLAG_BASIC_BLOCK)
-      MCOS->EmitIntValue(dwarf::DW_LNS_set_basic_block, 1);
+      Row.push_back(dwarf::DW_LNS_set_basic_block);
     if (LineEntry.getFlags() & DWARF2_FLAG_PROLOGUE_END)
-      MCOS->EmitIntValue(dwarf::DW_LNS_set_prologue_end, 1);
+      Row.push_back(dwarf::DW_LNS_set_prologue_end);
     if (LineEntry.getFlags() & DWARF2_FLAG_EPILOGUE_BEGIN)
-      MCOS->EmitIntValue(dwarf::DW_LNS_set_epilogue_begin, 1);
+      Row.push_back(dwarf::DW_LNS_set_epilogue_begin);
+
+    if (!Row.empty()) {
+      MCOS->EmitBytes(Row);
+      Row.clear();
+    }
 
     MCSymbol *Label = LineEntry.getLabel();
 
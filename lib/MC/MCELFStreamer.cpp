@@ -497,7 +497,7 @@ void MCELFStreamer::EmitInstToData(const MCInst &Inst,
       // When not in a bundle-locked group and the -mc-relax-all flag is used,
       // we create a new temporary fragment which will be later merged into
       // the current fragment.
-      DF = new MCDataFragment();
+      DF = new (getContext()) MCDataFragment();
     else if (isBundleLocked() && !Sec.isBundleGroupBeforeFirstInst())
       // If we are bundle-locked, we re-use the current fragment.
       // The bundle-locking directive ensures this is a new data fragment.
@@ -506,12 +506,13 @@ void MCELFStreamer::EmitInstToData(const MCInst &Inst,
       // Optimize memory usage by emitting the instruction to a
       // MCCompactEncodedInstFragment when not in a bundle-locked group and
       // there are no fixups registered.
-      MCCompactEncodedInstFragment *CEIF = new MCCompactEncodedInstFragment();
+      MCCompactEncodedInstFragment *CEIF =
+          new (getContext()) MCCompactEncodedInstFragment();
       insert(CEIF);
       CEIF->getContents().append(Code.begin(), Code.end());
       return;
     } else {
-      DF = new MCDataFragment();
+      DF = new (getContext()) MCDataFragment();
       insert(DF);
     }
     if (Sec.getBundleLockState() == MCSection::BundleLockedAlignToEnd) {
@@ -568,7 +569,7 @@ void MCELFStreamer::EmitBundleLock(bool AlignToEnd) {
 
   if (getAssembler().getRelaxAll() && !isBundleLocked()) {
     // TODO: drop the lock state and set directly in the fragment
-    MCDataFragment *DF = new MCDataFragment();
+    MCDataFragment *DF = new (getContext()) MCDataFragment();
     BundleGroups.push_back(DF);
   }
 
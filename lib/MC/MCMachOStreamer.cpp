@@ -175,7 +175,7 @@ void MCMachOStreamer::EmitLabel(MCSymbol *Symbol, SMLoc Loc) {
   // We have to create a new fragment if this is an atom defining symbol,
   // fragments cannot span atoms.
   if (getAssembler().isSymbolLinkerVisible(*Symbol))
-    insert(new MCDataFragment());
+    insert(new (getContext()) MCDataFragment());
 
   MCObjectStreamer::EmitLabel(Symbol, Loc);
 
@@ -416,9 +416,10 @@ void MCMachOStreamer::EmitZerofill(MCSection *Section, MCSymbol *Symbol,
 
   // Emit an align fragment if necessary.
   if (ByteAlignment != 1)
-    new MCAlignFragment(ByteAlignment, 0, 0, ByteAlignment, Section);
+    new (getContext()) MCAlignFragment(ByteAlignment, 0, 0, ByteAlignment,
+                                       Section);
 
-  MCFragment *F = new MCFillFragment(0, Size, Section);
+  MCFragment *F = new (getContext()) MCFillFragment(0, Size, Section);
   Symbol->setFragment(F);
 
   // Update the maximum alignment on the zero fill section if necessary.
@@ -18,13 +18,23 @@
 #include "llvm/MC/MCDwarf.h"
 #include "llvm/MC/MCExpr.h"
 #include "llvm/MC/MCObjectWriter.h"
+#include "llvm/MC/MCFixupKindInfo.h"
 #include "llvm/MC/MCSection.h"
 #include "llvm/MC/MCSymbol.h"
+#include "llvm/MC/MCValue.h"
+#include "llvm/Support/CommandLine.h"
 #include "llvm/Support/ErrorHandling.h"
+#include "llvm/Support/MathExtras.h"
 #include "llvm/Support/SourceMgr.h"
 #include "llvm/Support/TargetRegistry.h"
 using namespace llvm;
 
+static cl::opt<bool> MCEarlyRelax(
+    "mc-early-relax", cl::Hidden, cl::init(false),
+    cl::desc("Resolve backward PC-relative fixups while streaming and emit "
+             "the short form of instructions that reach their target, instead "
+             "of keeping a relaxable fragment per instruction until layout"));
+
 MCObjectStreamer::MCObjectStreamer(MCContext &Context, MCAsmBackend &TAB,
                                    raw_pwrite_stream &OS,
                                    MCCodeEmitter *Emitter_)
@@ -44,10 +54,11 @@ void MCObjectStreamer::flushPendingLabels(MCFragment *F, uint64_t FOffset) {
   if (PendingLabels.empty())
     return;
   if (!F) {
-    F = new MCDataFragment();
+    F = new (getContext()) MCDataFragment();
     MCSection *CurSection = getCurrentSectionOnly();
     CurSection->getFragmentList().insert(CurInsertionPoint, F);
     F->setParent(CurSection);
+    trackInsertedFragment(F);
   }
   for (MCSymbol *Sym : PendingLabels) {
     Sym->setFragment(F);
@@ -76,9 +87,145 @@ void MCObjectStreamer::reset() {
   EmitEHFrame = true;
   EmitDebugFrame = false;
   PendingLabels.clear();
+  ExactOffsets.clear();
+  ExactFragmentStarts.clear();
   MCStreamer::reset();
 }
 
+uint64_t MCObjectStreamer::exactTailSize(const ExactOffsetInfo &Info) {
+  switch (Info.Tail->getKind()) {
+  case MCFragment::FT_Data:
+    return cast<MCDataFragment>(Info.Tail)->getContents().size();
+  case MCFragment::FT_Fill:
+    return cast<MCFillFragment>(Info.Tail)->getSize();
+  case MCFragment::FT_Align: {
+    // Mirrors MCAssembler::computeFragmentSize, with the exact streaming
+    // offset standing in for the layout offset.
+    const MCAlignFragment &AF = cast<MCAlignFragment>(*Info.Tail);
+    uint64_t Size = OffsetToAlignment(Info.TailOffset, AF.getAlignment());
+    if (Size > 0 && AF.hasEmitNops())
+      while (Size % getAssembler().getBackend().getMinimumNopSize())
+        Size += AF.getAlignment();
+    if (Size > AF.getMaxBytesToEmit())
+      return 0;
+    return Size;
+  }
+  default:
+    llvm_unreachable("Tail fragment kind has no exact size");
+  }
+}
+
+void MCObjectStreamer::trackInsertedFragment(MCFragment *F) {
+  if (!MCEarlyRelax)
+    return;
+
+  MCSection *Sec = F->getParent();
+  ExactOffsetInfo &Info = ExactOffsets[Sec];
+  if (!Info.Exact)
+    return;
+
+  // Fragments that didn't come through here (subsection insertions, or
+  // fragments a subclass appended directly) make the offsets unknown.
+  MCSection::iterator I = F->getIterator();
+  MCFragment *Prev =
+      I == Sec->getFragmentList().begin() ? nullptr : &*std::prev(I);
+  if (Prev != Info.Tail) {
+    Info.Exact = false;
+    return;
+  }
+
+  if (Info.Tail)
+    Info.TailOffset += exactTailSize(Info);
+  Info.Tail = F;
+
+  switch (F->getKind()) {
+  case MCFragment::FT_Data:
+    // Remember data fragment starts so that the addresses of the symbols
+    // attached to them can be computed.
+    ExactFragmentStarts[F] = Info.TailOffset;
+    break;
+  case MCFragment::FT_Fill:
+  case MCFragment::FT_Align:
+    // Sizes computable from the current offset alone; nothing to record.
+    break;
+  default:
+    // Everything else (relaxable, org, LEB, ...) has a layout-dependent size.
+    Info.Exact = false;
+    break;
+  }
+}
+
+bool MCObjectStreamer::maybeEmitResolvedInstToData(const MCInst &Inst,
+                                                   const MCSubtargetInfo &STI) {
+  MCAssembler &Assembler = getAssembler();
+  if (Assembler.isBundlingEnabled())
+    return false;
+
+  MCSection *Sec = getCurrentSectionOnly();
+  auto InfoIt = ExactOffsets.find(Sec);
+  if (InfoIt == ExactOffsets.end() || !InfoIt->second.Exact)
+    return false;
+
+  // The instruction will be appended to the current data fragment; create it
+  // now so that the instruction's exact start offset is known.
+  MCDataFragment *DF = getOrCreateDataFragment();
+  ExactOffsetInfo &Info = InfoIt->second;
+  if (!Info.Exact || Info.Tail != DF) {
+    // A fragment was appended without going through insert().
+    Info.Exact = false;
+    return false;
+  }
+  uint64_t InstStart = Info.TailOffset + DF->getContents().size();
+
+  SmallVector<MCFixup, 4> Fixups;
+  SmallString<256> Code;
+  raw_svector_ostream VecOS(Code);
+  Assembler.getEmitter().encodeInstruction(Inst, VecOS, Fixups, STI);
+
+  MCAsmBackend &Backend = Assembler.getBackend();
+  for (const MCFixup &Fixup : Fixups) {
+    const MCFixupKindInfo &FKI = Backend.getFixupKindInfo(Fixup.getKind());
+    if (!(FKI.Flags & MCFixupKindInfo::FKF_IsPCRel))
+      return false;
+
+    MCValue Target;
+    if (!Fixup.getValue()->evaluateAsRelocatable(Target, nullptr, nullptr))
+      return false;
+    if (Target.getSymB() || Target.getRefKind() != 0)
+      return false;
+    const MCSymbolRefExpr *A = Target.getSymA();
+    if (!A || A->getKind() != MCSymbolRefExpr::VK_None)
+      return false;
+
+    // Only symbols already attached to a fragment with a known exact start
+    // in this section can be resolved; in particular this rules out forward
+    // references.
+    const MCSymbol &Sym = A->getSymbol();
+    if (Sym.isVariable())
+      return false;
+    const MCFragment *SymFrag = Sym.getFragment();
+    if (!SymFrag || SymFrag->getParent() != Sec)
+      return false;
+    auto StartIt = ExactFragmentStarts.find(SymFrag);
+    if (StartIt == ExactFragmentStarts.end())
+      return false;
+
+    // Same computation MCAssembler::evaluateFixup performs at layout time.
+    // The offsets it depends on all precede the fixup, so they cannot change
+    // when later fragments relax.
+    uint64_t Value = StartIt->second + Sym.getOffset() + Target.getConstant() -
+                     (InstStart + Fixup.getOffset());
+    if (Backend.fixupValueNeedsRelaxation(Fixup, Value))
+      return false;
+  }
+
+  // Every fixup reaches its target in the unrelaxed form, so the instruction
+  // can be emitted as plain data; layout will resolve the fixups to the same
+  // values computed above.
+  EmitInstToData(Inst, STI);
+  return true;
+}
+
 void MCObjectStreamer::EmitFrames(MCAsmBackend *MAB) {
   if (!getNumFrameInfos())
     return;
@@ -105,7 +252,7 @@ MCDataFragment *MCObjectStreamer::getOrCreateDataFragment() {
   // already has instructions (see MCELFStreamer::EmitInstToData for details)
   if (!F || (Assembler->isBundlingEnabled() && !Assembler->getRelaxAll() &&
              F->hasInstructions())) {
-    F = new MCDataFragment();
+    F = new (getContext()) MCDataFragment();
     insert(F);
   }
   return F;
@@ -187,7 +334,7 @@ void MCObjectStreamer::EmitULEB128Value(const MCExpr *Value) {
     EmitULEB128IntValue(IntValue);
     return;
   }
-  insert(new MCLEBFragment(*Value, false));
+  insert(new (getContext()) MCLEBFragment(*Value, false));
 }
 
 void MCObjectStreamer::EmitSLEB128Value(const MCExpr *Value) {
@@ -196,7 +343,7 @@ void MCObjectStreamer::EmitSLEB128Value(const MCExpr *Value) {
     EmitSLEB128IntValue(IntValue);
     return;
   }
-  insert(new MCLEBFragment(*Value, true));
+  insert(new (getContext()) MCLEBFragment(*Value, true));
 }
 
 void MCObjectStreamer::EmitWeakReference(MCSymbol *Alias,
@@ -223,8 +370,8 @@ bool MCObjectStreamer::changeSectionImpl(MCSection *Section,
     report_fatal_error("Cannot evaluate subsection number");
   if (IntSubsection < 0 || IntSubsection > 8192)
     report_fatal_error("Subsection number out of range");
-  CurInsertionPoint =
-      Section->getSubsectionInsertionPoint(unsigned(IntSubsection));
+  CurInsertionPoint = Section->getSubsectionInsertionPoint(
+      getContext(), unsigned(IntSubsection));
   return Created;
 }
 
@@ -271,6 +418,12 @@ void MCObjectStreamer::EmitInstruction(const MCInst &Inst,
     return;
   }
 
+  // With -mc-early-relax, try to resolve the instruction's fixups against
+  // the offsets known so far; backward branches whose short form reaches the
+  // target are then emitted as data instead of a relaxable fragment.
+  if (MCEarlyRelax && maybeEmitResolvedInstToData(Inst, STI))
+    return;
+
   // Otherwise emit to a separate fragment.
   EmitInstToFragment(Inst, STI);
 }
@@ -282,7 +435,7 @@ void MCObjectStreamer::EmitInstToFragment(const MCInst &Inst,
 
   // Always create a new, separate fragment here, because its size can change
   // during relaxation.
-  MCRelaxableFragment *IF = new MCRelaxableFragment(Inst, STI);
+  MCRelaxableFragment *IF = new (getContext()) MCRelaxableFragment(Inst, STI);
   insert(IF);
 
   SmallString<128> Code;
@@ -363,7 +516,7 @@ void MCObjectStreamer::EmitDwarfAdvanceLineAddr(int64_t LineDelta,
                           Res);
     return;
   }
-  insert(new MCDwarfLineAddrFragment(LineDelta, *AddrDelta));
+  insert(new (getContext()) MCDwarfLineAddrFragment(LineDelta, *AddrDelta));
 }
 
 void MCObjectStreamer::EmitDwarfAdvanceFrameAddr(const MCSymbol *LastLabel,
@@ -374,7 +527,7 @@ void MCObjectStreamer::EmitDwarfAdvanceFrameAddr(const MCSymbol *LastLabel,
     MCDwarfFrameEmitter::EmitAdvanceLoc(*this, Res);
     return;
   }
-  insert(new MCDwarfCallFrameFragment(*AddrDelta));
+  insert(new (getContext()) MCDwarfCallFrameFragment(*AddrDelta));
 }
 
 void MCObjectStreamer::EmitCVLocDirective(unsigned FunctionId, unsigned FileNo,
@@ -436,7 +589,8 @@ void MCObjectStreamer::EmitValueToAlignment(unsigned ByteAlignment,
                                             unsigned MaxBytesToEmit) {
   if (MaxBytesToEmit == 0)
     MaxBytesToEmit = ByteAlignment;
-  insert(new MCAlignFragment(ByteAlignment, Value, ValueSize, MaxBytesToEmit));
+  insert(new (getContext())
+             MCAlignFragment(ByteAlignment, Value, ValueSize, MaxBytesToEmit));
 
   // Update the maximum alignment on the current section if necessary.
   MCSection *CurSec = getCurrentSectionOnly();
@@ -453,7 +607,7 @@ void MCObjectStreamer::EmitCodeAlignment(unsigned ByteAlignment,
 void MCObjectStreamer::emitValueToOffset(const MCExpr *Offset,
                                          unsigned char Value,
                                          SMLoc Loc) {
-  insert(new MCOrgFragment(*Offset, Value, Loc));
+  insert(new (getContext()) MCOrgFragment(*Offset, Value, Loc));
 }
 
 // Associate DTPRel32 fixup with data and resize data area
@@ -543,7 +697,7 @@ bool MCObjectStreamer::EmitRelocDirective(const MCExpr &Offset, StringRef Name,
 
 void MCObjectStreamer::emitFill(uint64_t NumBytes, uint8_t FillValue) {
   assert(getCurrentSectionOnly() && "need a section");
-  insert(new MCFillFragment(FillValue, NumBytes));
+  insert(new (getContext()) MCFillFragment(FillValue, NumBytes));
 }
 
 void MCObjectStreamer::emitFill(const MCExpr &NumBytes, uint64_t FillValue,
@@ -803,18 +803,21 @@ bool AsmParser::Run(bool NoInitialTextSection, bool NoFinalize) {
   // as otherwise we won't necessarilly have seen everything yet.
   if (!NoFinalize) {
     if (MAI.hasSubsectionsViaSymbols()) {
-      for (const auto &TableEntry : getContext().getSymbols()) {
-        MCSymbol *Sym = TableEntry.getValue();
-        // Variable symbols may not be marked as defined, so check those
-        // explicitly. If we know it's a variable, we have a definition for
-        // the purposes of this check.
-        if (Sym->isTemporary() && !Sym->isVariable() && !Sym->isDefined())
-          // FIXME: We would really like to refer back to where the symbol was
-          // first referenced for a source location. We need to add something
-          // to track that. Currently, we just point to the end of the file.
-          printError(getTok().getLoc(), "assembler local symbol '" +
-                                            Sym->getName() + "' not defined");
-      }
+      for (const MCContext::SymbolTableShard &Shard :
+           getContext().getSymbols())
+        for (const auto &TableEntry : Shard.Symbols) {
+          MCSymbol *Sym = TableEntry.getValue();
+          // Variable symbols may not be marked as defined, so check those
+          // explicitly. If we know it's a variable, we have a definition for
+          // the purposes of this check.
+          if (Sym->isTemporary() && !Sym->isVariable() && !Sym->isDefined())
+            // FIXME: We would really like to refer back to where the symbol
+            // was first referenced for a source location. We need to add
+            // something to track that. Currently, we just point to the end of
+            // the file.
+            printError(getTok().getLoc(), "assembler local symbol '" +
+                                              Sym->getName() + "' not defined");
+        }
     }
 
     // Temporary symbols like the ones for directional jumps don't go in the
@@ -29,7 +29,7 @@ static MCDummyFragment SentinelFragment(nullptr);
 MCFragment *MCSymbol::AbsolutePseudoFragment = &SentinelFragment;
 
 void *MCSymbol::operator new(size_t s, const StringMapEntry<bool> *Name,
-                             MCContext &Ctx) {
+                             BumpPtrAllocator &Alloc) {
   // We may need more space for a Name to account for alignment.  So allocate
   // space for the storage type and not the name pointer.
   size_t Size = s + (Name ? sizeof(NameEntryStorageTy) : 0);
@@ -39,7 +39,7 @@ void *MCSymbol::operator new(size_t s, const StringMapEntry<bool> *Name,
   // symbol.
   static_assert((unsigned)alignof(MCSymbol) <= alignof(NameEntryStorageTy),
                 "Bad alignment of MCSymbol");
-  void *Storage = Ctx.allocate(Size, alignof(NameEntryStorageTy));
+  void *Storage = Alloc.Allocate(Size, alignof(NameEntryStorageTy));
   NameEntryStorageTy *Start = static_cast<NameEntryStorageTy*>(Storage);
   NameEntryStorageTy *End = Start + (Name ? 1 : 0);
   return End;
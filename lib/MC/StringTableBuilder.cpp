@@ -14,6 +14,7 @@
 #include "llvm/Support/COFF.h"
 #include "llvm/Support/Endian.h"
 #include "llvm/Support/MathExtras.h"
+#include "llvm/Support/ThreadPool.h"
 #include "llvm/Support/raw_ostream.h"
 #include <cassert>
 #include <cstddef>
@@ -113,6 +114,55 @@ tailcall:
   }
 }
 
+// Sort strings in the order multikey_qsort produces, using multiple threads
+// for large inputs.  The first partition level of the radix sort is the last
+// character, so sharding the strings by last character and sorting the
+// shards independently yields exactly the same order; distinct strings never
+// compare equal, so the result does not depend on how the work is split.
+static void sortByTail(std::vector<StringPair *> &Strings) {
+  // Small tables are not worth the sharding pass and thread wakeups.
+  if (Strings.size() < 4096) {
+    multikey_qsort(Strings.data(), Strings.data() + Strings.size(), 0);
+    return;
+  }
+
+  // Shard by last character, in the descending order the sort uses: shard 0
+  // holds strings ending in 0xff and shard 256 holds empty strings.
+  const size_t NumShards = 257;
+  auto shardOf = [](StringPair *P) -> size_t {
+    int C = charTailAt(P, 0);
+    return C < 0 ? NumShards - 1 : 255 - C;
+  };
+
+  std::vector<size_t> Begin(NumShards + 1, 0);
+  for (StringPair *P : Strings)
+    ++Begin[shardOf(P) + 1];
+  for (size_t I = 1; I <= NumShards; ++I)
+    Begin[I] += Begin[I - 1];
+
+  std::vector<StringPair *> Sharded(Strings.size());
+  std::vector<size_t> Next(Begin.begin(), Begin.begin() + NumShards);
+  for (StringPair *P : Strings)
+    Sharded[Next[shardOf(P)]++] = P;
+
+  {
+    ThreadPool Pool;
+    // All strings in a shard share their last character, so each shard is
+    // sorted from position 1.  The empty-string shard holds at most one
+    // string and needs no sorting.
+    for (size_t I = 0; I + 1 < NumShards; ++I) {
+      size_t B = Begin[I], E = Begin[I + 1];
+      if (E - B > 1)
+        Pool.async([&Sharded, B, E] {
+          multikey_qsort(Sharded.data() + B, Sharded.data() + E, 1);
+        });
+    }
+    Pool.wait();
+  }
+
+  Strings = std::move(Sharded);
+}
+
 void StringTableBuilder::finalize() {
   finalizeStringTable(/*Optimize=*/true);
 }
@@ -130,11 +180,8 @@ void StringTableBuilder::finalizeStringTable(bool Optimize) {
     for (StringPair &P : StringIndexMap)
       Strings.push_back(&P);
 
-    if (!Strings.empty()) {
-      // If we're optimizing, sort by name. If not, sort by previously assigned
-      // offset.
-      multikey_qsort(&Strings[0], &Strings[0] + Strings.size(), 0);
-    }
+    if (!Strings.empty())
+      sortByTail(Strings);
 
     initSize();
 
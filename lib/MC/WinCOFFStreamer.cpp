@@ -179,7 +179,7 @@ void MCWinCOFFStreamer::EmitCOFFSafeSEH(MCSymbol const *Symbol) {
   if (SXData->getAlignment() < 4)
     SXData->setAlignment(4);
 
-  new MCSafeSEHFragment(Symbol, SXData);
+  new (getContext()) MCSafeSEHFragment(Symbol, SXData);
 
   getAssembler().registerSymbol(*Symbol);
   CSymbol->setIsSafeSEH();
@@ -260,11 +260,11 @@ void MCWinCOFFStreamer::EmitLocalCommonSymbol(MCSymbol *S, uint64_t Size,
   Symbol->setExternal(false);
 
   if (ByteAlignment != 1)
-    new MCAlignFragment(ByteAlignment, /*Value=*/0, /*ValueSize=*/0,
-                        ByteAlignment, Section);
+    new (getContext()) MCAlignFragment(ByteAlignment, /*Value=*/0,
+                                       /*ValueSize=*/0, ByteAlignment, Section);
 
-  MCFillFragment *Fragment = new MCFillFragment(
-      /*Value=*/0, Size, Section);
+  MCFillFragment *Fragment =
+      new (getContext()) MCFillFragment(/*Value=*/0, Size, Section);
   Symbol->setFragment(Fragment);
 }
 
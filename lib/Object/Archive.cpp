@@ -14,6 +14,7 @@
 #include "llvm/ADT/Optional.h"
 #include "llvm/ADT/SmallString.h"
 #include "llvm/ADT/StringRef.h"
+#include "llvm/ADT/StringSet.h"
 #include "llvm/ADT/Twine.h"
 #include "llvm/Object/Archive.h"
 #include "llvm/Object/Binary.h"
@@ -25,6 +26,7 @@
 #include "llvm/Support/FileSystem.h"
 #include "llvm/Support/MemoryBuffer.h"
 #include "llvm/Support/Path.h"
+#include "llvm/Support/ThreadPool.h"
 #include "llvm/Support/raw_ostream.h"
 #include <algorithm>
 #include <cassert>
@@ -32,8 +34,10 @@
 #include <cstdint>
 #include <cstring>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <system_error>
+#include <thread>
 
 using namespace llvm;
 using namespace object;
@@ -443,11 +447,63 @@ Expected<StringRef> Archive::Child::getBuffer() const {
   if (!FullNameOrErr)
     return FullNameOrErr.takeError();
   const std::string &FullName = *FullNameOrErr;
-  ErrorOr<std::unique_ptr<MemoryBuffer>> Buf = MemoryBuffer::getFile(FullName);
-  if (std::error_code EC = Buf.getError())
-    return errorCodeToError(EC);
-  Parent->ThinBuffers.push_back(std::move(*Buf));
-  return Parent->ThinBuffers.back()->getBuffer();
+  // Each referenced file is opened at most once, no matter how many members
+  // resolve to it or how often its contents are requested.
+  auto It = Parent->ThinBuffers.find(FullName);
+  if (It == Parent->ThinBuffers.end()) {
+    ErrorOr<std::unique_ptr<MemoryBuffer>> Buf = MemoryBuffer::getFile(FullName);
+    if (std::error_code EC = Buf.getError())
+      return errorCodeToError(EC);
+    It = Parent->ThinBuffers.try_emplace(FullName, std::move(*Buf)).first;
+  }
+  return It->second->getBuffer();
+}
+
+Error Archive::preloadThinBuffers(unsigned NumThreads) {
+  if (!IsThin)
+    return Error::success();
+
+  // Collect the paths of the members that are not in the cache yet.
+  std::vector<std::string> Paths;
+  StringSet<> SeenPaths;
+  Error Err = Error::success();
+  for (const Child &C : children(Err)) {
+    Expected<bool> IsThinOrErr = C.isThinMember();
+    if (!IsThinOrErr)
+      return joinErrors(std::move(Err), IsThinOrErr.takeError());
+    if (!*IsThinOrErr)
+      continue;
+    Expected<std::string> FullNameOrErr = C.getFullName();
+    if (!FullNameOrErr)
+      return joinErrors(std::move(Err), FullNameOrErr.takeError());
+    if (ThinBuffers.count(*FullNameOrErr) ||
+        !SeenPaths.insert(*FullNameOrErr).second)
+      continue;
+    Paths.push_back(std::move(*FullNameOrErr));
+  }
+  if (Err)
+    return Err;
+
+  // Open and map the files in parallel. Open failures are deliberately not
+  // reported from here; a member that fails to open stays uncached and
+  // getBuffer() produces the error if its contents are ever requested.
+  ThreadPool Pool(NumThreads ? NumThreads
+                             : std::max(1U, std::thread::hardware_concurrency()));
+  std::mutex CacheMutex;
+  for (std::string &P : Paths)
+    Pool.async(
+        [this, &CacheMutex](std::string Path) {
+          ErrorOr<std::unique_ptr<MemoryBuffer>> Buf =
+              MemoryBuffer::getFile(Path);
+          if (!Buf)
+            return;
+          std::lock_guard<std::mutex> Guard(CacheMutex);
+          ThinBuffers.try_emplace(Path, std::move(*Buf));
+        },
+        std::move(P));
+  Pool.wait();
+
+  return Error::success();
 }
 
 Expected<Archive::Child> Archive::Child::getNext() const {
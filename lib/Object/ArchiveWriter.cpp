@@ -23,6 +23,7 @@
 #include "llvm/Support/ErrorHandling.h"
 #include "llvm/Support/Format.h"
 #include "llvm/Support/Path.h"
+#include "llvm/Support/ThreadPool.h"
 #include "llvm/Support/ToolOutputFile.h"
 #include "llvm/Support/raw_ostream.h"
 
@@ -276,27 +277,91 @@ static sys::TimePoint<std::chrono::seconds> now(bool Deterministic) {
   return sys::TimePoint<seconds>();
 }
 
+namespace {
+/// The symbols gathered from one prospective archive member.
+struct MemberSymbolData {
+  /// The symbol names, each terminated by a nul, in the order they appear in
+  /// the member.
+  SmallString<64> SymbolNames;
+  /// The number of names in SymbolNames.
+  unsigned NumSymbols = 0;
+  /// Whether the member parsed as a symbolic file at all.
+  bool IsObject = false;
+  /// The first error hit while reading the member's symbols.
+  std::error_code EC;
+};
+} // end anonymous namespace
+
+/// Read the symbol-table-worthy symbols of \p MemberBuffer into \p Data.
+static void getMemberSymbols(MemoryBufferRef MemberBuffer,
+                             MemberSymbolData &Data) {
+  LLVMContext Context;
+  Expected<std::unique_ptr<object::SymbolicFile>> ObjOrErr =
+      object::SymbolicFile::createSymbolicFile(
+          MemberBuffer, sys::fs::file_magic::unknown, &Context);
+  if (!ObjOrErr) {
+    // FIXME: check only for "not an object file" errors.
+    consumeError(ObjOrErr.takeError());
+    return;
+  }
+  object::SymbolicFile &Obj = *ObjOrErr.get();
+  Data.IsObject = true;
+
+  raw_svector_ostream NameOS(Data.SymbolNames);
+  for (const object::BasicSymbolRef &S : Obj.symbols()) {
+    uint32_t Symflags = S.getFlags();
+    if (Symflags & object::SymbolRef::SF_FormatSpecific)
+      continue;
+    if (!(Symflags & object::SymbolRef::SF_Global))
+      continue;
+    if (Symflags & object::SymbolRef::SF_Undefined)
+      continue;
+
+    if (auto EC = S.printName(NameOS)) {
+      Data.EC = EC;
+      return;
+    }
+    NameOS << '\0';
+    ++Data.NumSymbols;
+  }
+}
+
 // Returns the offset of the first reference to a member offset.
 static ErrorOr<unsigned>
 writeSymbolTable(raw_fd_ostream &Out, object::Archive::Kind Kind,
                  ArrayRef<NewArchiveMember> Members,
                  std::vector<unsigned> &MemberOffsetRefs, bool Deterministic) {
+  // Read each member's symbols up front. The members are independent, so
+  // with threads available this is where the bulk of the work scales with
+  // cores; each task gets its own LLVMContext since contexts must not be
+  // shared across threads.
+  std::vector<MemberSymbolData> MemberSymbols(Members.size());
+#if LLVM_ENABLE_THREADS
+  if (Members.size() > 1) {
+    ThreadPool Pool;
+    for (unsigned I = 0, N = Members.size(); I != N; ++I) {
+      MemberSymbolData *Data = &MemberSymbols[I];
+      MemoryBufferRef Buf = Members[I].Buf->getMemBufferRef();
+      Pool.async([Buf, Data] { getMemberSymbols(Buf, *Data); });
+    }
+    Pool.wait();
+  } else
+#endif
+    for (unsigned I = 0, N = Members.size(); I != N; ++I)
+      getMemberSymbols(Members[I].Buf->getMemBufferRef(), MemberSymbols[I]);
+
+  // Merge the per-member results in member order; the output is identical to
+  // what a serial scan produces.
   unsigned HeaderStartOffset = 0;
   unsigned BodyStartOffset = 0;
   SmallString<128> NameBuf;
   raw_svector_ostream NameOS(NameBuf);
-  LLVMContext Context;
   for (unsigned MemberNum = 0, N = Members.size(); MemberNum < N; ++MemberNum) {
-    MemoryBufferRef MemberBuffer = Members[MemberNum].Buf->getMemBufferRef();
-    Expected<std::unique_ptr<object::SymbolicFile>> ObjOrErr =
-        object::SymbolicFile::createSymbolicFile(
-            MemberBuffer, sys::fs::file_magic::unknown, &Context);
-    if (!ObjOrErr) {
-      // FIXME: check only for "not an object file" errors.
-      consumeError(ObjOrErr.takeError());
+    MemberSymbolData &Data = MemberSymbols[MemberNum];
+    if (Data.EC)
+      return Data.EC;
+    if (!Data.IsObject)
       continue;
-    }
-    object::SymbolicFile &Obj = *ObjOrErr.get();
 
     if (!HeaderStartOffset) {
       HeaderStartOffset = Out.tell();
@@ -308,19 +373,12 @@ writeSymbolTable(raw_fd_ostream &Out, object::Archive::Kind Kind,
       print32(Out, Kind, 0); // number of entries or bytes
     }
 
-    for (const object::BasicSymbolRef &S : Obj.symbols()) {
-      uint32_t Symflags = S.getFlags();
-      if (Symflags & object::SymbolRef::SF_FormatSpecific)
-        continue;
-      if (!(Symflags & object::SymbolRef::SF_Global))
-        continue;
-      if (Symflags & object::SymbolRef::SF_Undefined)
-        continue;
-
+    StringRef Names(Data.SymbolNames.data(), Data.SymbolNames.size());
+    for (unsigned I = 0; I != Data.NumSymbols; ++I) {
       unsigned NameOffset = NameOS.tell();
-      if (auto EC = S.printName(NameOS))
-        return EC;
-      NameOS << '\0';
+      std::pair<StringRef, StringRef> Split = Names.split('\0');
+      NameOS << Split.first << '\0';
+      Names = Split.second;
       MemberOffsetRefs.push_back(MemberNum);
       if (isBSDLike(Kind))
         print32(Out, Kind, NameOffset);
@@ -29,6 +29,7 @@
 #include "llvm/Support/Allocator.h"
 #include "llvm/Support/Casting.h"
 #include "llvm/Support/Error.h"
+#include "llvm/Support/Parallel.h"
 #include "llvm/Support/raw_ostream.h"
 #include "llvm/Support/StringSaver.h"
 #include <cassert>
@@ -79,7 +80,8 @@ struct Builder {
                   reinterpret_cast<const char *>(Objs.data() + Objs.size()));
   }
 
-  Error addModule(Module *M);
+  Error addModule(Module *M, const SmallPtrSet<GlobalValue *, 8> &Used,
+                  const ModuleSymbolTable &Msymtab);
   Error addSymbol(const ModuleSymbolTable &Msymtab,
                   const SmallPtrSet<GlobalValue *, 8> &Used,
                   ModuleSymbolTable::Symbol Sym);
@@ -87,13 +89,8 @@ struct Builder {
   Error build(ArrayRef<Module *> Mods);
 };
 
-Error Builder::addModule(Module *M) {
-  SmallPtrSet<GlobalValue *, 8> Used;
-  collectUsedGlobalVariables(*M, Used, /*CompilerUsed*/ false);
-
-  ModuleSymbolTable Msymtab;
-  Msymtab.addModule(M);
-
+Error Builder::addModule(Module *M, const SmallPtrSet<GlobalValue *, 8> &Used,
+                         const ModuleSymbolTable &Msymtab) {
   storage::Module Mod;
   Mod.Begin = Syms.size();
   Mod.End = Syms.size() + Msymtab.symbols().size();
@@ -229,8 +226,21 @@ Error Builder::build(ArrayRef<Module *> IRMods) {
   setStr(Hdr.SourceFileName, IRMods[0]->getSourceFileName());
   TT = Triple(IRMods[0]->getTargetTriple());
 
-  for (auto *M : IRMods)
-    if (Error Err = addModule(M))
+  // Visit each module's globals up front, concurrently when there are
+  // several modules. Building a ModuleSymbolTable only reads the IR (the
+  // expensive part is parsing any module-level inline assembly), so the
+  // per-module shards are independent; the table and string-table writes
+  // below stay single-threaded and in input order.
+  std::vector<SmallPtrSet<GlobalValue *, 8>> UsedSets(IRMods.size());
+  std::vector<ModuleSymbolTable> Msymtabs(IRMods.size());
+  parallel::parallel_for(0, IRMods.size(), [&](size_t Idx) {
+    collectUsedGlobalVariables(*IRMods[Idx], UsedSets[Idx],
+                               /*CompilerUsed*/ false);
+    Msymtabs[Idx].addModule(IRMods[Idx]);
+  });
+
+  for (size_t I = 0, E = IRMods.size(); I != E; ++I)
+    if (Error Err = addModule(IRMods[I], UsedSets[I], Msymtabs[I]))
       return Err;
 
   COFFLinkerOptsOS.flush();
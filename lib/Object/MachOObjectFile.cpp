@@ -1146,15 +1146,32 @@ static bool isLoadCommandObsolete(uint32_t cmd) {
   return false;
 }
 
+// Index the sections of a segment load command for a scan-only object,
+// checking only that the section headers lie within the load command.
+template <typename SegmentCmd, typename Section>
+static void scanSegmentLoadCommand(const MachOObjectFile &Obj,
+                                   const MachOObjectFile::LoadCommandInfo &Load,
+                                   SmallVectorImpl<const char *> &Sections) {
+  if (Load.C.cmdsize < sizeof(SegmentCmd))
+    return;
+  SegmentCmd S = getStruct<SegmentCmd>(Obj, Load.Ptr);
+  uint64_t SectionsSpace = Load.C.cmdsize - sizeof(SegmentCmd);
+  if ((uint64_t)S.nsects * sizeof(Section) > SectionsSpace)
+    return;
+  const char *Sec = Load.Ptr + sizeof(SegmentCmd);
+  for (unsigned J = 0; J < S.nsects; ++J, Sec += sizeof(Section))
+    Sections.push_back(Sec);
+}
+
 Expected<std::unique_ptr<MachOObjectFile>>
 MachOObjectFile::create(MemoryBufferRef Object, bool IsLittleEndian,
                         bool Is64Bits, uint32_t UniversalCputype,
-                        uint32_t UniversalIndex) {
+                        uint32_t UniversalIndex, bool ScanOnly) {
   Error Err = Error::success();
   std::unique_ptr<MachOObjectFile> Obj(
       new MachOObjectFile(std::move(Object), IsLittleEndian,
                           Is64Bits, Err, UniversalCputype,
-                          UniversalIndex));
+                          UniversalIndex, ScanOnly));
   if (Err)
     return std::move(Err);
   return std::move(Obj);
@@ -1163,7 +1180,7 @@ MachOObjectFile::create(MemoryBufferRef Object, bool IsLittleEndian,
 MachOObjectFile::MachOObjectFile(MemoryBufferRef Object, bool IsLittleEndian,
                                  bool Is64bits, Error &Err,
                                  uint32_t UniversalCputype,
-                                 uint32_t UniversalIndex)
+                                 uint32_t UniversalIndex, bool ScanOnly)
     : ObjectFile(getMachOType(IsLittleEndian, Is64bits), Object) {
   ErrorAsOutParameter ErrAsOutParam(&Err);
   uint64_t SizeOfHeaders;
@@ -1204,6 +1221,111 @@ MachOObjectFile::MachOObjectFile(MemoryBufferRef Object, bool IsLittleEndian,
     }
   }
 
+  if (ScanOnly) {
+    // Scan-style workloads open many binaries just to read one table or
+    // section, so record only the load command pointers the accessors
+    // consult, with the bounds checks needed to keep those accessors from
+    // reading outside the buffer.  Commands that fail the bounds checks are
+    // treated as absent rather than reported, and no cross-command
+    // validation is done.
+    uint64_t FileSize = getData().size();
+    auto FitsInFile = [FileSize](uint64_t Offset, uint64_t Count,
+                                 uint64_t EntrySize) {
+      return Offset + Count * EntrySize <= FileSize;
+    };
+    for (unsigned I = 0; I < LoadCommandCount; ++I) {
+      LoadCommands.push_back(Load);
+      switch (Load.C.cmd) {
+      case MachO::LC_SYMTAB:
+        if (Load.C.cmdsize == sizeof(MachO::symtab_command) &&
+            !SymtabLoadCmd) {
+          MachO::symtab_command S =
+              getStruct<MachO::symtab_command>(*this, Load.Ptr);
+          uint64_t EntrySize =
+              is64Bit() ? sizeof(MachO::nlist_64) : sizeof(MachO::nlist);
+          if (FitsInFile(S.symoff, S.nsyms, EntrySize) &&
+              FitsInFile(S.stroff, S.strsize, 1))
+            SymtabLoadCmd = Load.Ptr;
+        }
+        break;
+      case MachO::LC_DYSYMTAB:
+        if (Load.C.cmdsize == sizeof(MachO::dysymtab_command) &&
+            !DysymtabLoadCmd) {
+          MachO::dysymtab_command D =
+              getStruct<MachO::dysymtab_command>(*this, Load.Ptr);
+          if (FitsInFile(D.indirectsymoff, D.nindirectsyms,
+                         sizeof(uint32_t)))
+            DysymtabLoadCmd = Load.Ptr;
+        }
+        break;
+      case MachO::LC_DATA_IN_CODE:
+      case MachO::LC_LINKER_OPTIMIZATION_HINT:
+        if (Load.C.cmdsize == sizeof(MachO::linkedit_data_command)) {
+          MachO::linkedit_data_command L =
+              getStruct<MachO::linkedit_data_command>(*this, Load.Ptr);
+          if (FitsInFile(L.dataoff, L.datasize, 1)) {
+            if (Load.C.cmd == MachO::LC_DATA_IN_CODE && !DataInCodeLoadCmd)
+              DataInCodeLoadCmd = Load.Ptr;
+            else if (Load.C.cmd == MachO::LC_LINKER_OPTIMIZATION_HINT &&
+                     !LinkOptHintsLoadCmd)
+              LinkOptHintsLoadCmd = Load.Ptr;
+          }
+        }
+        break;
+      case MachO::LC_DYLD_INFO:
+      case MachO::LC_DYLD_INFO_ONLY:
+        if (Load.C.cmdsize == sizeof(MachO::dyld_info_command) &&
+            !DyldInfoLoadCmd) {
+          MachO::dyld_info_command D =
+              getStruct<MachO::dyld_info_command>(*this, Load.Ptr);
+          if (FitsInFile(D.rebase_off, D.rebase_size, 1) &&
+              FitsInFile(D.bind_off, D.bind_size, 1) &&
+              FitsInFile(D.weak_bind_off, D.weak_bind_size, 1) &&
+              FitsInFile(D.lazy_bind_off, D.lazy_bind_size, 1) &&
+              FitsInFile(D.export_off, D.export_size, 1))
+            DyldInfoLoadCmd = Load.Ptr;
+        }
+        break;
+      case MachO::LC_UUID:
+        if (Load.C.cmdsize == sizeof(MachO::uuid_command) && !UuidLoadCmd)
+          UuidLoadCmd = Load.Ptr;
+        break;
+      case MachO::LC_LOAD_DYLIB:
+      case MachO::LC_LOAD_WEAK_DYLIB:
+      case MachO::LC_LAZY_LOAD_DYLIB:
+      case MachO::LC_REEXPORT_DYLIB:
+      case MachO::LC_LOAD_UPWARD_DYLIB:
+        if (Load.C.cmdsize >= sizeof(MachO::dylib_command)) {
+          MachO::dylib_command D =
+              getStruct<MachO::dylib_command>(*this, Load.Ptr);
+          if (D.dylib.name < Load.C.cmdsize)
+            Libraries.push_back(Load.Ptr);
+        }
+        break;
+      case MachO::LC_SEGMENT_64:
+        scanSegmentLoadCommand<MachO::segment_command_64, MachO::section_64>(
+            *this, Load, Sections);
+        break;
+      case MachO::LC_SEGMENT:
+        scanSegmentLoadCommand<MachO::segment_command, MachO::section>(
+            *this, Load, Sections);
+        break;
+      default:
+        break;
+      }
+      if (I < LoadCommandCount - 1) {
+        if (auto LoadOrErr = getNextLoadCommandInfo(*this, I, Load))
+          Load = *LoadOrErr;
+        else {
+          Err = LoadOrErr.takeError();
+          return;
+        }
+      }
+    }
+    Err = Error::success();
+    return;
+  }
+
   const char *DyldIdLoadCmd = nullptr;
   const char *FuncStartsLoadCmd = nullptr;
   const char *SplitInfoLoadCmd = nullptr;
@@ -4293,20 +4415,21 @@ bool MachOObjectFile::isRelocatableObject() const {
 Expected<std::unique_ptr<MachOObjectFile>>
 ObjectFile::createMachOObjectFile(MemoryBufferRef Buffer,
                                   uint32_t UniversalCputype,
-                                  uint32_t UniversalIndex) {
+                                  uint32_t UniversalIndex,
+                                  bool ScanOnly) {
   StringRef Magic = Buffer.getBuffer().slice(0, 4);
   if (Magic == "\xFE\xED\xFA\xCE")
     return MachOObjectFile::create(Buffer, false, false,
-                                   UniversalCputype, UniversalIndex);
+                                   UniversalCputype, UniversalIndex, ScanOnly);
   if (Magic == "\xCE\xFA\xED\xFE")
     return MachOObjectFile::create(Buffer, true, false,
-                                   UniversalCputype, UniversalIndex);
+                                   UniversalCputype, UniversalIndex, ScanOnly);
   if (Magic == "\xFE\xED\xFA\xCF")
     return MachOObjectFile::create(Buffer, false, true,
-                                   UniversalCputype, UniversalIndex);
+                                   UniversalCputype, UniversalIndex, ScanOnly);
   if (Magic == "\xCF\xFA\xED\xFE")
     return MachOObjectFile::create(Buffer, true, true,
-                                   UniversalCputype, UniversalIndex);
+                                   UniversalCputype, UniversalIndex, ScanOnly);
   return make_error<GenericBinaryError>("Unrecognized MachO magic number",
                                         object_error::invalid_file_type);
 }
@@ -61,7 +61,7 @@ MachOUniversalBinary::ObjectForArch::ObjectForArch(
 }
 
 Expected<std::unique_ptr<MachOObjectFile>>
-MachOUniversalBinary::ObjectForArch::getAsObjectFile() const {
+MachOUniversalBinary::ObjectForArch::getAsObjectFile(bool ScanOnly) const {
   if (!Parent)
     report_fatal_error("MachOUniversalBinary::ObjectForArch::getAsObjectFile() "
                        "called when Parent is a nullptr");
@@ -78,7 +78,7 @@ MachOUniversalBinary::ObjectForArch::getAsObjectFile() const {
   }
   StringRef ObjectName = Parent->getFileName();
   MemoryBufferRef ObjBuffer(ObjectData, ObjectName);
-  return ObjectFile::createMachOObjectFile(ObjBuffer, cputype, Index);
+  return ObjectFile::createMachOObjectFile(ObjBuffer, cputype, Index, ScanOnly);
 }
 
 Expected<std::unique_ptr<Archive>>
@@ -198,7 +198,7 @@ void FunctionRecordIterator::skipOtherFiles() {
 
 Error CoverageMapping::loadFunctionRecord(
     const CoverageMappingRecord &Record,
-    IndexedInstrProfReader &ProfileReader) {
+    IndexedInstrProfReader &ProfileReader) const {
   StringRef OrigFuncName = Record.FunctionName;
   if (Record.Filenames.empty())
     OrigFuncName = getFuncNameWithoutPrefix(OrigFuncName);
@@ -244,6 +244,50 @@ Error CoverageMapping::loadFunctionRecord(
   return Error::success();
 }
 
+void CoverageMapping::registerFunctionRecord(
+    const CoverageMappingRecord &Record) {
+  RawFunctionRecord Raw;
+  Raw.FunctionName = Record.FunctionName;
+  Raw.FunctionHash = Record.FunctionHash;
+  Raw.Filenames = Record.Filenames;
+  Raw.Expressions = Record.Expressions;
+  Raw.MappingRegions = Record.MappingRegions;
+  PendingRecords.push_back(Raw);
+}
+
+void CoverageMapping::materializeForFile(StringRef Filename) const {
+  if (PendingRecords.empty())
+    return;
+
+  // Reserve space for every record we could ever expand, so FunctionRecord
+  // pointers handed out by earlier queries stay valid as later queries
+  // materialize more functions.
+  Functions.reserve(Functions.size() + PendingRecords.size());
+
+  std::vector<RawFunctionRecord> Remaining;
+  for (const RawFunctionRecord &Raw : PendingRecords) {
+    if (!Filename.empty() && !llvm::is_contained(Raw.Filenames, Filename)) {
+      Remaining.push_back(Raw);
+      continue;
+    }
+    CoverageMappingRecord Record;
+    Record.FunctionName = Raw.FunctionName;
+    Record.FunctionHash = Raw.FunctionHash;
+    Record.Filenames = Raw.Filenames;
+    Record.Expressions = Raw.Expressions;
+    Record.MappingRegions = Raw.MappingRegions;
+    if (Error E = loadFunctionRecord(Record, *OwnedProfileReader)) {
+      // The query interface has no error channel; treat a failure like a
+      // profile mismatch and drop the record.
+      consumeError(std::move(E));
+      ++MismatchedFunctionCount;
+    }
+  }
+  PendingRecords = std::move(Remaining);
+}
+
+CoverageMapping::~CoverageMapping() = default;
+
 Expected<std::unique_ptr<CoverageMapping>>
 CoverageMapping::load(CoverageMappingReader &CoverageReader,
                       IndexedInstrProfReader &ProfileReader) {
@@ -275,10 +319,14 @@ CoverageMapping::load(ArrayRef<StringRef> ObjectFilenames,
   auto ProfileReaderOrErr = IndexedInstrProfReader::create(ProfileFilename);
   if (Error E = ProfileReaderOrErr.takeError())
     return std::move(E);
-  auto ProfileReader = std::move(ProfileReaderOrErr.get());
 
-  SmallVector<std::unique_ptr<CoverageMappingReader>, 4> Readers;
-  SmallVector<std::unique_ptr<MemoryBuffer>, 4> Buffers;
+  // This overload owns its readers and profile, so the records can stay
+  // delta-encoded inside the readers until a query touches their file.
+  // Memory use then tracks the files actually rendered rather than the
+  // whole corpus.
+  auto Coverage = std::unique_ptr<CoverageMapping>(new CoverageMapping());
+  Coverage->OwnedProfileReader = std::move(ProfileReaderOrErr.get());
+
   for (StringRef ObjectFilename : ObjectFilenames) {
     auto CovMappingBufOrErr = MemoryBuffer::getFileOrSTDIN(ObjectFilename);
     if (std::error_code EC = CovMappingBufOrErr.getError())
@@ -287,10 +335,12 @@ CoverageMapping::load(ArrayRef<StringRef> ObjectFilenames,
         BinaryCoverageReader::create(CovMappingBufOrErr.get(), Arch);
     if (Error E = CoverageReaderOrErr.takeError())
       return std::move(E);
-    Readers.push_back(std::move(CoverageReaderOrErr.get()));
-    Buffers.push_back(std::move(CovMappingBufOrErr.get()));
+    Coverage->OwnedReaders.push_back(std::move(CoverageReaderOrErr.get()));
+    Coverage->OwnedBuffers.push_back(std::move(CovMappingBufOrErr.get()));
+    for (const auto &Record : *Coverage->OwnedReaders.back())
+      Coverage->registerFunctionRecord(Record);
   }
-  return load(Readers, *ProfileReader);
+  return std::move(Coverage);
 }
 
 namespace {
@@ -456,9 +506,13 @@ public:
 
 std::vector<StringRef> CoverageMapping::getUniqueSourceFiles() const {
   std::vector<StringRef> Filenames;
-  for (const auto &Function : getCoveredFunctions())
+  for (const auto &Function : Functions)
     Filenames.insert(Filenames.end(), Function.Filenames.begin(),
                      Function.Filenames.end());
+  // Pending records know their filenames without being expanded.
+  for (const auto &Raw : PendingRecords)
+    Filenames.insert(Filenames.end(), Raw.Filenames.begin(),
+                     Raw.Filenames.end());
   std::sort(Filenames.begin(), Filenames.end());
   auto Last = std::unique(Filenames.begin(), Filenames.end());
   Filenames.erase(Last, Filenames.end());
@@ -501,6 +555,8 @@ static bool isExpansion(const CountedRegion &R, unsigned FileID) {
 }
 
 CoverageData CoverageMapping::getCoverageForFile(StringRef Filename) const {
+  materializeForFile(Filename);
+
   CoverageData FileCoverage(Filename);
   std::vector<CountedRegion> Regions;
 
@@ -523,6 +579,8 @@ CoverageData CoverageMapping::getCoverageForFile(StringRef Filename) const {
 
 std::vector<const FunctionRecord *>
 CoverageMapping::getInstantiations(StringRef Filename) const {
+  materializeForFile(Filename);
+
   FunctionInstantiationSetCollector InstantiationSetCollector;
   for (const auto &Function : Functions) {
     auto MainFileID = findMainViewFileID(Filename, Function);
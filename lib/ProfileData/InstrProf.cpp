@@ -461,22 +461,35 @@ void InstrProfValueSiteRecord::merge(SoftInstrProfErrors &SIPE,
                                      uint64_t Weight) {
   this->sortByTargetValues();
   Input.sortByTargetValues();
+  // Both sides are sorted by target value: merge linearly into a flat array
+  // instead of inserting into the middle of this one, which would be
+  // quadratic for large sites.
+  std::vector<InstrProfValueData> Merged;
+  Merged.reserve(ValueData.size() + Input.ValueData.size());
   auto I = ValueData.begin();
   auto IE = ValueData.end();
-  for (auto J = Input.ValueData.begin(), JE = Input.ValueData.end(); J != JE;
-       ++J) {
-    while (I != IE && I->Value < J->Value)
+  auto J = Input.ValueData.begin();
+  auto JE = Input.ValueData.end();
+  while (I != IE || J != JE) {
+    if (J == JE || (I != IE && I->Value < J->Value)) {
+      Merged.push_back(*I);
       ++I;
+      continue;
+    }
     if (I != IE && I->Value == J->Value) {
       bool Overflowed;
       I->Count = SaturatingMultiplyAdd(J->Count, Weight, I->Count, &Overflowed);
       if (Overflowed)
         SIPE.addError(instrprof_error::counter_overflow);
+      Merged.push_back(*I);
       ++I;
+      ++J;
       continue;
     }
-    ValueData.insert(I, *J);
+    Merged.push_back(*J);
+    ++J;
   }
+  ValueData = std::move(Merged);
 }
 
 void InstrProfValueSiteRecord::scale(SoftInstrProfErrors &SIPE,
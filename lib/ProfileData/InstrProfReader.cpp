@@ -546,6 +546,68 @@ data_type InstrProfLookupTrait::ReadData(StringRef K, const unsigned char *D,
   return DataBuffer;
 }
 
+instrprof_error InstrProfLookupTrait::ReadCounts(const unsigned char *D,
+                                                 offset_type N,
+                                                 uint64_t FuncHash,
+                                                 ArrayRef<uint64_t> &Counts) {
+  using namespace support;
+
+  // Check if the data is corrupt. If so, don't try to read it.
+  if (N % sizeof(uint64_t))
+    return instrprof_error::malformed;
+
+  const unsigned char *End = D + N;
+  while (D < End) {
+    // Read hash.
+    if (D + sizeof(uint64_t) >= End)
+      return instrprof_error::malformed;
+    uint64_t Hash = endian::readNext<uint64_t, little, unaligned>(D);
+
+    // Initialize number of counters for GET_VERSION(FormatVersion) == 1.
+    uint64_t CountsSize = N / sizeof(uint64_t) - 1;
+    // If format version is different then read the number of counters.
+    if (GET_VERSION(FormatVersion) != IndexedInstrProf::ProfVersion::Version1) {
+      if (D + sizeof(uint64_t) > End)
+        return instrprof_error::malformed;
+      CountsSize = endian::readNext<uint64_t, little, unaligned>(D);
+    }
+    if (D + CountsSize * sizeof(uint64_t) > End)
+      return instrprof_error::malformed;
+
+    if (Hash == FuncHash) {
+      if (endian::system_endianness() == little) {
+        // The counters are little-endian 64-bit words, so on a little-endian
+        // host they can be handed out as a view of the profile mapping. The
+        // existing summary and value profile readers access the mapping the
+        // same way, so no extra alignment guarantee is needed here.
+        Counts = makeArrayRef(reinterpret_cast<const uint64_t *>(D),
+                              CountsSize);
+      } else {
+        CountsScratch.clear();
+        CountsScratch.reserve(CountsSize);
+        for (uint64_t J = 0; J < CountsSize; ++J)
+          CountsScratch.push_back(
+              endian::readNext<uint64_t, little, unaligned>(D));
+        Counts = CountsScratch;
+      }
+      return instrprof_error::success;
+    }
+
+    // Skip the counters and the value profiling data of a non-matching
+    // record without deserializing them.
+    D += CountsSize * sizeof(uint64_t);
+    if (GET_VERSION(FormatVersion) > IndexedInstrProf::ProfVersion::Version2) {
+      if (D + sizeof(uint32_t) > End)
+        return instrprof_error::malformed;
+      uint32_t TotalSize = endian::read<uint32_t>(D, ValueProfDataEndianness);
+      if (TotalSize < sizeof(uint32_t) || D + TotalSize > End)
+        return instrprof_error::malformed;
+      D += TotalSize;
+    }
+  }
+  return instrprof_error::hash_mismatch;
+}
+
 template <typename HashTableImpl>
 Error InstrProfReaderIndex<HashTableImpl>::getRecords(
     StringRef FuncName, ArrayRef<InstrProfRecord> &Data) {
@@ -560,6 +622,21 @@ Error InstrProfReaderIndex<HashTableImpl>::getRecords(
   return Error::success();
 }
 
+template <typename HashTableImpl>
+Error InstrProfReaderIndex<HashTableImpl>::getFunctionCounts(
+    StringRef FuncName, uint64_t FuncHash, ArrayRef<uint64_t> &Counts) {
+  auto Iter = HashTable->find(FuncName);
+  if (Iter == HashTable->end())
+    return make_error<InstrProfError>(instrprof_error::unknown_function);
+
+  instrprof_error Err = HashTable->getInfoObj().ReadCounts(
+      Iter.getDataPtr(), Iter.getDataLen(), FuncHash, Counts);
+  if (Err != instrprof_error::success)
+    return make_error<InstrProfError>(Err);
+
+  return Error::success();
+}
+
 template <typename HashTableImpl>
 Error InstrProfReaderIndex<HashTableImpl>::getRecords(
     ArrayRef<InstrProfRecord> &Data) {
@@ -720,14 +797,20 @@ IndexedInstrProfReader::getInstrProfRecord(StringRef FuncName,
 Error IndexedInstrProfReader::getFunctionCounts(StringRef FuncName,
                                                 uint64_t FuncHash,
                                                 std::vector<uint64_t> &Counts) {
-  Expected<InstrProfRecord> Record = getInstrProfRecord(FuncName, FuncHash);
-  if (Error E = Record.takeError())
+  ArrayRef<uint64_t> CountsView;
+  if (Error E = getFunctionCountsView(FuncName, FuncHash, CountsView))
     return error(std::move(E));
 
-  Counts = Record.get().Counts;
+  Counts.assign(CountsView.begin(), CountsView.end());
   return success();
 }
 
+Error IndexedInstrProfReader::getFunctionCountsView(StringRef FuncName,
+                                                    uint64_t FuncHash,
+                                                    ArrayRef<uint64_t> &Counts) {
+  return Index->getFunctionCounts(FuncName, FuncHash, Counts);
+}
+
 Error IndexedInstrProfReader::readNextRecord(InstrProfRecord &Record) {
   static unsigned RecordIndex = 0;
 
@@ -8,7 +8,7 @@
 //===----------------------------------------------------------------------===//
 //
 // This file implements the class that reads LLVM sample profiles. It
-// supports three file formats: text, binary and gcov.
+// supports four file formats: text, binary, indexed binary and gcov.
 //
 // The textual representation is useful for debugging and testing purposes. The
 // binary representation is more compact, resulting in smaller file sizes.
@@ -16,7 +16,8 @@
 // The gcov encoding is the one generated by GCC's AutoFDO profile creation
 // tool (https://github.com/google/autofdo)
 //
-// All three encodings can be used interchangeably as an input sample profile.
+// All of these encodings can be used interchangeably as an input sample
+// profile.
 //
 //===----------------------------------------------------------------------===//
 
@@ -24,6 +25,7 @@
 #include "llvm/ADT/DenseMap.h"
 #include "llvm/ADT/STLExtras.h"
 #include "llvm/ADT/StringRef.h"
+#include "llvm/IR/Module.h"
 #include "llvm/IR/ProfileSummary.h"
 #include "llvm/ProfileData/ProfileCommon.h"
 #include "llvm/ProfileData/SampleProf.h"
@@ -373,39 +375,45 @@ SampleProfileReaderBinary::readProfile(FunctionSamples &FProfile) {
   return sampleprof_error::success;
 }
 
-std::error_code SampleProfileReaderBinary::read() {
-  while (!at_eof()) {
-    auto NumHeadSamples = readNumber<uint64_t>();
-    if (std::error_code EC = NumHeadSamples.getError())
-      return EC;
+std::error_code SampleProfileReaderBinary::readFunProfile() {
+  auto NumHeadSamples = readNumber<uint64_t>();
+  if (std::error_code EC = NumHeadSamples.getError())
+    return EC;
 
-    auto FName(readStringFromTable());
-    if (std::error_code EC = FName.getError())
-      return EC;
+  auto FName(readStringFromTable());
+  if (std::error_code EC = FName.getError())
+    return EC;
 
-    Profiles[*FName] = FunctionSamples();
-    FunctionSamples &FProfile = Profiles[*FName];
-    FProfile.setName(*FName);
+  Profiles[*FName] = FunctionSamples();
+  FunctionSamples &FProfile = Profiles[*FName];
+  FProfile.setName(*FName);
 
-    FProfile.addHeadSamples(*NumHeadSamples);
+  FProfile.addHeadSamples(*NumHeadSamples);
+
+  return readProfile(FProfile);
+}
 
-    if (std::error_code EC = readProfile(FProfile))
+std::error_code SampleProfileReaderBinary::read() {
+  while (!at_eof())
+    if (std::error_code EC = readFunProfile())
       return EC;
-  }
 
   return sampleprof_error::success;
 }
 
-std::error_code SampleProfileReaderBinary::readHeader() {
-  Data = reinterpret_cast<const uint8_t *>(Buffer->getBufferStart());
-  End = Data + Buffer->getBufferSize();
+std::error_code SampleProfileReaderBinary::verifySPMagic(uint64_t Magic) {
+  if (Magic == SPMagic())
+    return sampleprof_error::success;
+  return sampleprof_error::bad_magic;
+}
 
+std::error_code SampleProfileReaderBinary::readMagicIdent() {
   // Read and check the magic identifier.
   auto Magic = readNumber<uint64_t>();
   if (std::error_code EC = Magic.getError())
     return EC;
-  else if (*Magic != SPMagic())
-    return sampleprof_error::bad_magic;
+  else if (std::error_code EC = verifySPMagic(*Magic))
+    return EC;
 
   // Read the version number.
   auto Version = readNumber<uint64_t>();
@@ -414,10 +422,10 @@ std::error_code SampleProfileReaderBinary::readHeader() {
   else if (*Version != SPVersion())
     return sampleprof_error::unsupported_version;
 
-  if (std::error_code EC = readSummary())
-    return EC;
+  return sampleprof_error::success;
+}
 
-  // Read the name table.
+std::error_code SampleProfileReaderBinary::readNameTable() {
   auto Size = readNumber<uint32_t>();
   if (std::error_code EC = Size.getError())
     return EC;
@@ -432,6 +440,90 @@ std::error_code SampleProfileReaderBinary::readHeader() {
   return sampleprof_error::success;
 }
 
+std::error_code SampleProfileReaderBinary::readHeader() {
+  Data = reinterpret_cast<const uint8_t *>(Buffer->getBufferStart());
+  End = Data + Buffer->getBufferSize();
+
+  if (std::error_code EC = readMagicIdent())
+    return EC;
+
+  if (std::error_code EC = readSummary())
+    return EC;
+
+  return readNameTable();
+}
+
+std::error_code
+SampleProfileReaderIndexedBinary::verifySPMagic(uint64_t Magic) {
+  if (Magic == SPIndexedMagic())
+    return sampleprof_error::success;
+  return sampleprof_error::bad_magic;
+}
+
+std::error_code SampleProfileReaderIndexedBinary::readFuncOffsetTable() {
+  auto Size = readNumber<uint32_t>();
+  if (std::error_code EC = Size.getError())
+    return EC;
+
+  for (uint32_t I = 0; I < *Size; ++I) {
+    auto FName(readStringFromTable());
+    if (std::error_code EC = FName.getError())
+      return EC;
+
+    auto Offset = readNumber<uint64_t>();
+    if (std::error_code EC = Offset.getError())
+      return EC;
+
+    FuncOffsetTable[*FName] = *Offset;
+  }
+
+  // The function records start right after the table.
+  Records = Data;
+  return sampleprof_error::success;
+}
+
+std::error_code SampleProfileReaderIndexedBinary::readHeader() {
+  if (std::error_code EC = SampleProfileReaderBinary::readHeader())
+    return EC;
+  return readFuncOffsetTable();
+}
+
+void SampleProfileReaderIndexedBinary::collectFunctionsFrom(const Module &M) {
+  FuncsToUse.clear();
+  for (const Function &F : M)
+    FuncsToUse.insert(F.getName().split('.').first);
+}
+
+std::error_code SampleProfileReaderIndexedBinary::read() {
+  for (const auto &Entry : FuncOffsetTable) {
+    if (!FuncsToUse.empty() && FuncsToUse.count(Entry.first()) == 0)
+      continue;
+    if (Profiles.count(Entry.first()))
+      continue;
+    Data = Records + Entry.second;
+    if (std::error_code EC = readFunProfile())
+      return EC;
+  }
+
+  return sampleprof_error::success;
+}
+
+FunctionSamples *
+SampleProfileReaderIndexedBinary::getSamplesFor(const Function &F) {
+  StringRef Fname = F.getName().split('.').first;
+  if (Profiles.count(Fname))
+    return &Profiles[Fname];
+
+  auto Entry = FuncOffsetTable.find(Fname);
+  if (Entry == FuncOffsetTable.end())
+    return nullptr;
+
+  Data = Records + Entry->second;
+  if (readFunProfile())
+    return nullptr;
+  return &Profiles[Fname];
+}
+
 std::error_code SampleProfileReaderBinary::readSummaryEntry(
     std::vector<ProfileSummaryEntry> &Entries) {
   auto Cutoff = readNumber<uint64_t>();
@@ -495,6 +587,13 @@ bool SampleProfileReaderBinary::hasFormat(const MemoryBuffer &Buffer) {
   return Magic == SPMagic();
 }
 
+bool SampleProfileReaderIndexedBinary::hasFormat(const MemoryBuffer &Buffer) {
+  const uint8_t *Data =
+      reinterpret_cast<const uint8_t *>(Buffer.getBufferStart());
+  uint64_t Magic = decodeULEB128(Data);
+  return Magic == SPIndexedMagic();
+}
+
 std::error_code SampleProfileReaderGCC::skipNextWord() {
   uint32_t dummy;
   if (!GcovBuffer.readInt(dummy))
@@ -786,6 +885,8 @@ SampleProfileReader::create(std::unique_ptr<MemoryBuffer> &B, LLVMContext &C) {
   std::unique_ptr<SampleProfileReader> Reader;
   if (SampleProfileReaderBinary::hasFormat(*B))
     Reader.reset(new SampleProfileReaderBinary(std::move(B), C));
+  else if (SampleProfileReaderIndexedBinary::hasFormat(*B))
+    Reader.reset(new SampleProfileReaderIndexedBinary(std::move(B), C));
   else if (SampleProfileReaderGCC::hasFormat(*B))
     Reader.reset(new SampleProfileReaderGCC(std::move(B), C));
   else if (SampleProfileReaderText::hasFormat(*B))
@@ -8,16 +8,17 @@
 //===----------------------------------------------------------------------===//
 //
 // This file implements the class that writes LLVM sample profiles. It
-// supports two file formats: text and binary. The textual representation
-// is useful for debugging and testing purposes. The binary representation
-// is more compact, resulting in smaller file sizes. However, they can
-// both be used interchangeably.
+// supports three file formats: text, binary and indexed binary. The
+// textual representation is useful for debugging and testing purposes. The
+// binary representations are more compact, resulting in smaller file
+// sizes. However, they can all be used interchangeably.
 //
 // See lib/ProfileData/SampleProfReader.cpp for documentation on each of the
 // supported formats.
 //
 //===----------------------------------------------------------------------===//
 
+#include "llvm/ADT/SmallString.h"
 #include "llvm/ADT/StringRef.h"
 #include "llvm/ProfileData/ProfileCommon.h"
 #include "llvm/ProfileData/SampleProf.h"
@@ -118,13 +119,29 @@ void SampleProfileWriterBinary::addNames(const FunctionSamples &S) {
     }
 }
 
-std::error_code SampleProfileWriterBinary::writeHeader(
-    const StringMap<FunctionSamples> &ProfileMap) {
+std::error_code SampleProfileWriterBinary::writeMagicIdent() {
   auto &OS = *OutputStream;
 
   // Write file magic identifier.
   encodeULEB128(SPMagic(), OS);
   encodeULEB128(SPVersion(), OS);
+  return sampleprof_error::success;
+}
+
+std::error_code SampleProfileWriterIndexedBinary::writeMagicIdent() {
+  auto &OS = *OutputStream;
+
+  encodeULEB128(SPIndexedMagic(), OS);
+  encodeULEB128(SPVersion(), OS);
+  return sampleprof_error::success;
+}
+
+std::error_code SampleProfileWriterBinary::writeHeader(
+    const StringMap<FunctionSamples> &ProfileMap) {
+  auto &OS = *OutputStream;
+
+  if (std::error_code EC = writeMagicIdent())
+    return EC;
 
   computeSummary(ProfileMap);
   if (auto EC = writeSummary())
@@ -210,6 +227,44 @@ std::error_code SampleProfileWriterBinary::write(const FunctionSamples &S) {
   return writeBody(S);
 }
 
+std::error_code SampleProfileWriterIndexedBinary::write(
+    const StringMap<FunctionSamples> &ProfileMap) {
+  if (std::error_code EC = writeHeader(ProfileMap))
+    return EC;
+
+  // The offset table precedes the function records in the file, but its
+  // entries hold the offset of each record. Serialize the records into a
+  // staging buffer first so the offsets are known when the table is emitted.
+  // Offsets are relative to the first byte after the table, so the table's
+  // own (variable) encoded size does not matter.
+  SmallString<512> RecordData;
+  std::vector<std::pair<StringRef, uint64_t>> FuncOffsets;
+  FuncOffsets.reserve(ProfileMap.size());
+
+  std::unique_ptr<raw_ostream> FileStream = std::move(OutputStream);
+  OutputStream.reset(new raw_svector_ostream(RecordData));
+  std::error_code Result = sampleprof_error::success;
+  for (const auto &I : ProfileMap) {
+    FuncOffsets.push_back(std::make_pair(I.first(), OutputStream->tell()));
+    if ((Result = write(I.second)))
+      break;
+  }
+  OutputStream = std::move(FileStream);
+  if (Result)
+    return Result;
+
+  auto &OS = *OutputStream;
+  encodeULEB128(FuncOffsets.size(), OS);
+  for (const auto &Entry : FuncOffsets) {
+    if (std::error_code EC = writeNameIdx(Entry.first))
+      return EC;
+    encodeULEB128(Entry.second, OS);
+  }
+  OS << RecordData;
+
+  return sampleprof_error::success;
+}
+
 /// \brief Create a sample profile file writer based on the specified format.
 ///
 /// \param Filename The file to create.
@@ -223,7 +278,7 @@ ErrorOr<std::unique_ptr<SampleProfileWriter>>
 SampleProfileWriter::create(StringRef Filename, SampleProfileFormat Format) {
   std::error_code EC;
   std::unique_ptr<raw_ostream> OS;
-  if (Format == SPF_Binary)
+  if (Format == SPF_Binary || Format == SPF_Indexed_Binary)
     OS.reset(new raw_fd_ostream(Filename, EC, sys::fs::F_None));
   else
     OS.reset(new raw_fd_ostream(Filename, EC, sys::fs::F_Text));
@@ -250,6 +305,8 @@ SampleProfileWriter::create(std::unique_ptr<raw_ostream> &OS,
 
   if (Format == SPF_Binary)
     Writer.reset(new SampleProfileWriterBinary(OS));
+  else if (Format == SPF_Indexed_Binary)
+    Writer.reset(new SampleProfileWriterIndexedBinary(OS));
   else if (Format == SPF_Text)
     Writer.reset(new SampleProfileWriterText(OS));
   else if (Format == SPF_GCC)
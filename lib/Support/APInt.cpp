@@ -2257,15 +2257,17 @@ APInt::WordType APInt::tcAdd(WordType *dst, const WordType *rhs,
                              WordType c, unsigned parts) {
   assert(c <= 1);
 
+  // The carry chain is kept branchless so the loop body compiles down to a
+  // short dependent sequence of adds and compares; a conditional carry makes
+  // wide (256/512-bit) additions branch-mispredict bound.
   for (unsigned i = 0; i < parts; i++) {
     WordType l = dst[i];
-    if (c) {
-      dst[i] += rhs[i] + 1;
-      c = (dst[i] <= l);
-    } else {
-      dst[i] += rhs[i];
-      c = (dst[i] < l);
-    }
+    WordType r = rhs[i] + c;
+    // At most one of the two carries can be set: if the first add wrapped
+    // then r is zero and the second cannot wrap.
+    c = (r < c);
+    dst[i] = l + r;
+    c |= (dst[i] < l);
   }
 
   return c;
@@ -2292,15 +2294,14 @@ APInt::WordType APInt::tcSubtract(WordType *dst, const WordType *rhs,
                                   WordType c, unsigned parts) {
   assert(c <= 1);
 
+  // Branchless borrow chain; see the comment in tcAdd. If rhs[i] + c wraps
+  // the subtrahend is 2^64, which always borrows and leaves dst[i] intact.
   for (unsigned i = 0; i < parts; i++) {
     WordType l = dst[i];
-    if (c) {
-      dst[i] -= rhs[i] + 1;
-      c = (dst[i] >= l);
-    } else {
-      dst[i] -= rhs[i];
-      c = (dst[i] > l);
-    }
+    WordType r = rhs[i] + c;
+    c = (r < c);
+    dst[i] = l - r;
+    c |= (l < r);
   }
 
   return c;
@@ -2356,7 +2357,11 @@ int APInt::tcMultiplyPart(WordType *dst, const WordType *src,
 
   unsigned i;
   for (i = 0; i < n; i++) {
+#ifdef __SIZEOF_INT128__
+    WordType low, high, srcPart;
+#else
     WordType low, mid, high, srcPart;
+#endif
 
       /* [ LOW, HIGH ] = MULTIPLIER * SRC[i] + DST[i] + CARRY.
 
@@ -2371,6 +2376,16 @@ int APInt::tcMultiplyPart(WordType *dst, const WordType *src,
     if (multiplier == 0 || srcPart == 0) {
       low = carry;
       high = 0;
+#ifdef __SIZEOF_INT128__
+    } else {
+      /* One hardware 64 x 64 -> 128 multiply replaces the four half-word
+         partial products below.  Adding the carry cannot overflow:
+         (n - 1)^2 + (n - 1) < n^2.  */
+      __uint128_t p = (__uint128_t)srcPart * multiplier + carry;
+      low = (WordType)p;
+      high = (WordType)(p >> APINT_BITS_PER_WORD);
+    }
+#else
     } else {
       low = lowHalf(srcPart) * lowHalf(multiplier);
       high = highHalf(srcPart) * highHalf(multiplier);
@@ -2394,6 +2409,7 @@ int APInt::tcMultiplyPart(WordType *dst, const WordType *src,
         high++;
       low += carry;
     }
+#endif
 
     if (add) {
       /* And now DST[i], and store the new low part there.  */
@@ -0,0 +1,130 @@
+//===- AllocProfile.cpp - Allocation growth instrumentation ---------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+//
+// This file implements the per-callsite histograms behind the allocation
+// growth hooks.  See llvm/Support/AllocProfile.h for the user-facing story.
+//
+//===----------------------------------------------------------------------===//
+
+#include "llvm/Support/AllocProfile.h"
+
+#ifdef LLVM_ENABLE_ALLOC_PROFILE
+
+#include "llvm/Support/Format.h"
+#include "llvm/Support/raw_ostream.h"
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <map>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+using namespace llvm;
+using namespace llvm::allocprof;
+
+namespace {
+
+struct SiteStats {
+  uint64_t Count = 0;
+  uint64_t TotalBytes = 0;
+  uint64_t MaxBytes = 0;
+};
+
+/// Histograms keyed by (event kind, call site).  This is deliberately a
+/// std::map: recording an event must never reenter the instrumented
+/// containers, and the report runs during process shutdown.
+using SiteMap = std::map<std::pair<int, void *>, SiteStats>;
+
+/// Set while the exit report runs so that growth inside the printing code
+/// does not deadlock on the histogram lock.
+std::atomic<bool> Reporting(false);
+
+/// Intentionally leaked so the atexit report never races with static
+/// destructors.
+std::mutex &getLock() {
+  static std::mutex *Lock = new std::mutex;
+  return *Lock;
+}
+
+SiteMap &getSites() {
+  static SiteMap *Sites = new SiteMap;
+  return *Sites;
+}
+
+const char *kindName(int Kind) {
+  switch (Kind) {
+  case SmallVectorGrow:
+    return "smallvector-grow";
+  case DenseMapGrow:
+    return "densemap-grow";
+  case BumpPtrSlab:
+    return "bumpptr-slab";
+  }
+  return "unknown";
+}
+
+void report() {
+  Reporting = true;
+
+  std::vector<std::pair<std::pair<int, void *>, SiteStats>> Sites;
+  {
+    std::lock_guard<std::mutex> Guard(getLock());
+    Sites.assign(getSites().begin(), getSites().end());
+  }
+  std::sort(Sites.begin(), Sites.end(),
+            [](const std::pair<std::pair<int, void *>, SiteStats> &L,
+               const std::pair<std::pair<int, void *>, SiteStats> &R) {
+              return L.second.TotalBytes > R.second.TotalBytes;
+            });
+
+  raw_ostream &OS = errs();
+  OS << "=== Allocation growth profile ===\n"
+     << "Resolve call sites with llvm-symbolizer or addr2line against the "
+        "instrumented binary.\n";
+  OS << "kind               callsite                  count      total-bytes"
+        "    max-bytes\n";
+  for (const auto &Site : Sites)
+    OS << format("%-18s %-18p %12llu %16llu %12llu\n",
+                 kindName(Site.first.first), Site.first.second,
+                 (unsigned long long)Site.second.Count,
+                 (unsigned long long)Site.second.TotalBytes,
+                 (unsigned long long)Site.second.MaxBytes);
+}
+
+bool isEnabled() {
+  static bool Enabled = [] {
+    if (!std::getenv("LLVM_ALLOC_PROFILE"))
+      return false;
+    // Touch the leaked singletons before registering the report so it can
+    // never observe them uninitialized.
+    getLock();
+    getSites();
+    std::atexit(report);
+    return true;
+  }();
+  return Enabled;
+}
+
+} // end anonymous namespace
+
+void allocprof::recordGrow(AllocKind Kind, size_t Size, void *ReturnAddress) {
+  if (!isEnabled() || Reporting.load(std::memory_order_relaxed))
+    return;
+
+  std::lock_guard<std::mutex> Guard(getLock());
+  SiteStats &S = getSites()[std::make_pair(int(Kind), ReturnAddress)];
+  ++S.Count;
+  S.TotalBytes += Size;
+  if (Size > S.MaxBytes)
+    S.MaxBytes = Size;
+}
+
+#endif // LLVM_ENABLE_ALLOC_PROFILE
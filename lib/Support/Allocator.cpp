@@ -13,9 +13,180 @@
 
 #include "llvm/Support/Allocator.h"
 #include "llvm/Support/raw_ostream.h"
+#include <atomic>
+#include <cstdlib>
 
 namespace llvm {
 
+namespace {
+
+/// Intrusive freelist header imposed on pooled slabs. Pooled slabs are large
+/// enough and malloc-aligned, so reusing their leading bytes as a link is
+/// always safe.
+struct PoolSlab {
+  PoolSlab *Next;
+};
+
+/// How many slabs an allocator instance may cache locally before spilling
+/// them to the process-wide pool.
+const unsigned MaxLocalCacheSlabs = 8;
+
+/// How many slabs the process-wide pool may hold before returned slabs go
+/// back to malloc. This bounds the RSS retained across arena churn.
+const unsigned MaxGlobalPoolSlabs = 256;
+
+} // End anonymous namespace.
+
+/// The process-wide freelist of pooled slabs, kept as an intrusive stack.
+/// Pushes prepend a chain with a CAS loop; consumers detach the entire list
+/// with an exchange, which side-steps the classic ABA hazard of popping
+/// individual nodes.
+static std::atomic<PoolSlab *> GlobalPool;
+
+/// The number of slabs in the process-wide pool. This deliberately remains
+/// approximate while a consumer temporarily holds the detached list; it is
+/// only used to bound the pool's size.
+static std::atomic<unsigned> GlobalPoolSize;
+
+// Statistics for the pool as a whole.
+static std::atomic<size_t> NumPoolHits;
+static std::atomic<size_t> NumPoolMisses;
+static std::atomic<size_t> NumSlabsRecycled;
+
+/// Prepend the chain from \p First to \p Last (inclusive, holding \p Count
+/// slabs) onto the process-wide pool.
+static void pushGlobalSlabs(PoolSlab *First, PoolSlab *Last, unsigned Count) {
+  Last->Next = GlobalPool.load(std::memory_order_relaxed);
+  while (!GlobalPool.compare_exchange_weak(Last->Next, First,
+                                           std::memory_order_release,
+                                           std::memory_order_relaxed))
+    ;
+  GlobalPoolSize.fetch_add(Count, std::memory_order_relaxed);
+}
+
+/// Spill an instance's entire local cache, either into the process-wide pool
+/// or, if that is at capacity, back to malloc.
+static void spillLocalCache(PoolSlab *Head, unsigned Size) {
+  if (!Head)
+    return;
+
+  if (GlobalPoolSize.load(std::memory_order_relaxed) + Size <=
+      MaxGlobalPoolSlabs) {
+    PoolSlab *Last = Head;
+    while (Last->Next)
+      Last = Last->Next;
+    pushGlobalSlabs(Head, Last, Size);
+    NumSlabsRecycled.fetch_add(Size, std::memory_order_relaxed);
+    return;
+  }
+
+  while (Head) {
+    PoolSlab *Next = Head->Next;
+    free(Head);
+    Head = Next;
+  }
+}
+
+PooledMallocAllocator::~PooledMallocAllocator() {
+  spillLocalCache(static_cast<PoolSlab *>(LocalCache), LocalCacheSize);
+}
+
+PooledMallocAllocator &PooledMallocAllocator::
+operator=(PooledMallocAllocator &&RHS) {
+  spillLocalCache(static_cast<PoolSlab *>(LocalCache), LocalCacheSize);
+  LocalCache = RHS.LocalCache;
+  LocalCacheSize = RHS.LocalCacheSize;
+  RHS.LocalCache = nullptr;
+  RHS.LocalCacheSize = 0;
+  return *this;
+}
+
+void *PooledMallocAllocator::Allocate(size_t Size, size_t /*Alignment*/) {
+  if (Size != PoolableSize)
+    return malloc(Size);
+
+  // Serve from the local cache when possible.
+  if (PoolSlab *S = static_cast<PoolSlab *>(LocalCache)) {
+    LocalCache = S->Next;
+    --LocalCacheSize;
+    NumPoolHits.fetch_add(1, std::memory_order_relaxed);
+    return S;
+  }
+
+  // Refill from the process-wide pool: detach the whole freelist, keep a
+  // batch locally, and push the remainder back. Briefly holding the entire
+  // list merely makes concurrent refills fall through to malloc.
+  if (PoolSlab *S = GlobalPool.exchange(nullptr, std::memory_order_acquire)) {
+    unsigned Taken = 1;
+    PoolSlab *Last = S;
+    while (Last->Next && Taken <= MaxLocalCacheSlabs) {
+      Last = Last->Next;
+      ++Taken;
+    }
+    PoolSlab *Rest = Last->Next;
+    Last->Next = nullptr;
+    GlobalPoolSize.fetch_sub(Taken, std::memory_order_relaxed);
+    if (Rest) {
+      unsigned RestSize = 0;
+      PoolSlab *RestLast = Rest;
+      for (PoolSlab *I = Rest; I; I = I->Next) {
+        RestLast = I;
+        ++RestSize;
+      }
+      GlobalPoolSize.fetch_sub(RestSize, std::memory_order_relaxed);
+      pushGlobalSlabs(Rest, RestLast, RestSize);
+    }
+
+    LocalCache = S->Next;
+    LocalCacheSize = Taken - 1;
+    NumPoolHits.fetch_add(1, std::memory_order_relaxed);
+    return S;
+  }
+
+  NumPoolMisses.fetch_add(1, std::memory_order_relaxed);
+  return malloc(Size);
+}
+
+void PooledMallocAllocator::Deallocate(const void *Ptr, size_t Size) {
+  if (Size != PoolableSize) {
+    free(const_cast<void *>(Ptr));
+    return;
+  }
+
+  PoolSlab *S = static_cast<PoolSlab *>(const_cast<void *>(Ptr));
+  S->Next = static_cast<PoolSlab *>(LocalCache);
+  LocalCache = S;
+  if (++LocalCacheSize <= MaxLocalCacheSlabs)
+    return;
+
+  spillLocalCache(S, LocalCacheSize);
+  LocalCache = nullptr;
+  LocalCacheSize = 0;
+}
+
+void PooledMallocAllocator::ReleasePooledMemory() {
+  PoolSlab *Head = GlobalPool.exchange(nullptr, std::memory_order_acquire);
+  unsigned Released = 0;
+  while (Head) {
+    PoolSlab *Next = Head->Next;
+    free(Head);
+    Head = Next;
+    ++Released;
+  }
+  GlobalPoolSize.fetch_sub(Released, std::memory_order_relaxed);
+}
+
+void PooledMallocAllocator::PrintStats() const {
+  errs() << "\nSlab pool hits: "
+         << NumPoolHits.load(std::memory_order_relaxed) << '\n'
+         << "Slab pool misses: "
+         << NumPoolMisses.load(std::memory_order_relaxed) << '\n'
+         << "Slabs recycled through the pool: "
+         << NumSlabsRecycled.load(std::memory_order_relaxed) << '\n'
+         << "Slabs currently pooled: "
+         << GlobalPoolSize.load(std::memory_order_relaxed) << '\n';
+}
+
 namespace detail {
 
 void printBumpPtrAllocatorStats(unsigned NumSlabs, size_t BytesAllocated,
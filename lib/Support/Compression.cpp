@@ -18,6 +18,8 @@
 #include "llvm/Support/Compiler.h"
 #include "llvm/Support/Error.h"
 #include "llvm/Support/ErrorHandling.h"
+#include "llvm/Support/ThreadPool.h"
+#include <thread>
 #if LLVM_ENABLE_ZLIB == 1 && HAVE_ZLIB_H
 #include <zlib.h>
 #endif
@@ -57,12 +59,113 @@ static StringRef convertZlibCodeToString(int Code) {
 
 bool zlib::isAvailable() { return true; }
 
+/// Compress one chunk of a larger input with raw deflate and compute its
+/// Adler-32 checksum.  Every chunk but the last is terminated with a sync
+/// flush, which ends the chunk's output on a byte boundary, so the
+/// concatenation of the chunks is itself a valid deflate stream.
+static int compressChunk(StringRef Chunk, bool Last, int CLevel,
+                         SmallVectorImpl<char> &Out, uLong &ChunkAdler) {
+  z_stream Strm = {};
+  // Negative window bits select a raw deflate stream; the zlib header and
+  // checksum are emitted once around the whole output.
+  int Res =
+      ::deflateInit2(&Strm, CLevel, Z_DEFLATED, -15, 8, Z_DEFAULT_STRATEGY);
+  if (Res != Z_OK)
+    return Res;
+
+  Out.resize(::deflateBound(&Strm, Chunk.size()) + 16);
+  Strm.next_in = (Bytef *)const_cast<char *>(Chunk.data());
+  Strm.avail_in = Chunk.size();
+  Strm.next_out = (Bytef *)Out.data();
+  Strm.avail_out = Out.size();
+  Res = ::deflate(&Strm, Last ? Z_FINISH : Z_SYNC_FLUSH);
+  // The output buffer is sized to hold everything, so one call consumes the
+  // whole chunk.
+  if (Last ? Res != Z_STREAM_END : (Res != Z_OK || Strm.avail_in != 0)) {
+    ::deflateEnd(&Strm);
+    return Res == Z_OK ? Z_BUF_ERROR : Res;
+  }
+  // Tell MemorySanitizer that zlib output buffer is fully initialized.
+  // This avoids a false report when running LLVM with uninstrumented ZLib.
+  __msan_unpoison(Out.data(), Out.size() - Strm.avail_out);
+  Out.resize(Out.size() - Strm.avail_out);
+  ::deflateEnd(&Strm);
+
+  ChunkAdler = ::adler32(::adler32(0L, Z_NULL, 0), (const Bytef *)Chunk.data(),
+                         Chunk.size());
+  return Z_OK;
+}
+
+/// Compress a large input on multiple threads, producing a standard zlib
+/// stream that any inflate implementation can read.  The input is deflated
+/// as independent chunks joined on byte boundaries, wrapped in a single
+/// zlib header and trailing combined Adler-32 checksum.  The only cost
+/// relative to single-shot compression is the lost cross-chunk dictionary,
+/// a fraction of a percent of output size at this chunk size.
+static Error compressParallel(StringRef InputBuffer,
+                              SmallVectorImpl<char> &CompressedBuffer,
+                              int CLevel, size_t ChunkSize) {
+  size_t NumChunks = (InputBuffer.size() + ChunkSize - 1) / ChunkSize;
+  std::vector<SmallVector<char, 0>> Chunks(NumChunks);
+  std::vector<uLong> Adlers(NumChunks);
+  std::vector<int> Results(NumChunks, Z_OK);
+  {
+    ThreadPool Pool;
+    for (size_t I = 0; I != NumChunks; ++I) {
+      StringRef Chunk = InputBuffer.substr(I * ChunkSize, ChunkSize);
+      bool Last = I + 1 == NumChunks;
+      Pool.async([=, &Chunks, &Adlers, &Results] {
+        Results[I] = compressChunk(Chunk, Last, CLevel, Chunks[I], Adlers[I]);
+      });
+    }
+    Pool.wait();
+  }
+  for (int Res : Results)
+    if (Res != Z_OK)
+      return createError(convertZlibCodeToString(Res));
+
+  size_t CompressedSize = 6;
+  for (const SmallVector<char, 0> &C : Chunks)
+    CompressedSize += C.size();
+  CompressedBuffer.clear();
+  CompressedBuffer.reserve(CompressedSize);
+
+  // Standard zlib header: deflate with a 32K window, plus check bits making
+  // the header value a multiple of 31.
+  unsigned char CMF = 0x78;
+  unsigned char FLG =
+      (CLevel >= 6 || CLevel == Z_DEFAULT_COMPRESSION ? 3 : 0) << 6;
+  FLG += 31 - ((unsigned(CMF) * 256 + FLG) % 31);
+  CompressedBuffer.push_back(char(CMF));
+  CompressedBuffer.push_back(char(FLG));
+  for (const SmallVector<char, 0> &C : Chunks)
+    CompressedBuffer.append(C.begin(), C.end());
+
+  uLong Adler = ::adler32(0L, Z_NULL, 0);
+  for (size_t I = 0; I != NumChunks; ++I) {
+    size_t Len = std::min(ChunkSize, InputBuffer.size() - I * ChunkSize);
+    Adler = ::adler32_combine(Adler, Adlers[I], Len);
+  }
+  for (int Shift = 24; Shift >= 0; Shift -= 8)
+    CompressedBuffer.push_back(char((Adler >> Shift) & 0xff));
+  return Error::success();
+}
+
 Error zlib::compress(StringRef InputBuffer,
                      SmallVectorImpl<char> &CompressedBuffer,
                      CompressionLevel Level) {
+  int CLevel = encodeZlibCompressionLevel(Level);
+
+  // Compress large inputs in parallel chunks; the result is still one
+  // ordinary zlib stream.  Small inputs and uncompressed output stay on the
+  // single-shot path.
+  const size_t ChunkSize = 1 << 20;
+  if (CLevel != 0 && InputBuffer.size() >= 4 * ChunkSize &&
+      std::thread::hardware_concurrency() > 1)
+    return compressParallel(InputBuffer, CompressedBuffer, CLevel, ChunkSize);
+
   unsigned long CompressedSize = ::compressBound(InputBuffer.size());
   CompressedBuffer.resize(CompressedSize);
-  int CLevel = encodeZlibCompressionLevel(Level);
   int Res = ::compress2((Bytef *)CompressedBuffer.data(), &CompressedSize,
                         (const Bytef *)InputBuffer.data(), InputBuffer.size(),
                         CLevel);
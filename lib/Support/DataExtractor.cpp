@@ -10,7 +10,9 @@
 #include "llvm/Support/DataExtractor.h"
 #include "llvm/Support/ErrorHandling.h"
 #include "llvm/Support/Host.h"
+#include "llvm/Support/MemoryBuffer.h"
 #include "llvm/Support/SwapByteOrder.h"
+#include <algorithm>
 using namespace llvm;
 
 template <typename T>
@@ -173,3 +175,10 @@ int64_t DataExtractor::getSLEB128(uint32_t *offset_ptr) const {
   *offset_ptr = offset;
   return result;
 }
+
+void DataExtractor::prefetch(uint32_t offset, uint32_t length) const {
+  if (!isValidOffset(offset) || length == 0)
+    return;
+  length = std::min<uint64_t>(length, Data.size() - offset);
+  MemoryBuffer::prefetch(Data.data() + offset, length);
+}
@@ -67,39 +67,57 @@ DeltaAlgorithm::Delta(const changeset_ty &Changes,
   return Delta(Changes, SplitSets);
 }
 
+size_t
+DeltaAlgorithm::FindFirstPassingTest(const changesetlist_ty &Candidates) {
+  for (size_t i = 0, e = Candidates.size(); i != e; ++i)
+    if (GetTestResult(Candidates[i]))
+      return i;
+  return Candidates.size();
+}
+
 bool DeltaAlgorithm::Search(const changeset_ty &Changes,
                             const changesetlist_ty &Sets,
                             changeset_ty &Res) {
-  // FIXME: Parallelize.
+  // Build the list of candidate sets to test: each subset, followed by its
+  // complement when there are more than two sets. The candidates are
+  // independent of one another, which allows subclasses to test them
+  // concurrently by overriding FindFirstPassingTest.
+  changesetlist_ty Candidates;
   for (changesetlist_ty::const_iterator it = Sets.begin(),
          ie = Sets.end(); it != ie; ++it) {
-    // If the test passes on this subset alone, recurse.
-    if (GetTestResult(*it)) {
-      changesetlist_ty Sets;
-      Split(*it, Sets);
-      Res = Delta(*it, Sets);
-      return true;
-    }
+    Candidates.push_back(*it);
 
-    // Otherwise, if we have more than two sets, see if test passes on the
-    // complement.
     if (Sets.size() > 2) {
       // FIXME: This is really slow.
       changeset_ty Complement;
       std::set_difference(
         Changes.begin(), Changes.end(), it->begin(), it->end(),
         std::insert_iterator<changeset_ty>(Complement, Complement.begin()));
-      if (GetTestResult(Complement)) {
-        changesetlist_ty ComplementSets;
-        ComplementSets.insert(ComplementSets.end(), Sets.begin(), it);
-        ComplementSets.insert(ComplementSets.end(), it + 1, Sets.end());
-        Res = Delta(Complement, ComplementSets);
-        return true;
-      }
+      Candidates.push_back(Complement);
     }
   }
 
-  return false;
+  size_t Winner = FindFirstPassingTest(Candidates);
+  if (Winner == Candidates.size())
+    return false;
+
+  // When complements are being tested an even index is a subset and an odd
+  // index is the complement of the preceding subset; otherwise every
+  // candidate is a subset.
+  if (Sets.size() > 2 && (Winner & 1)) {
+    changesetlist_ty::const_iterator it = Sets.begin() + Winner / 2;
+    changesetlist_ty ComplementSets;
+    ComplementSets.insert(ComplementSets.end(), Sets.begin(), it);
+    ComplementSets.insert(ComplementSets.end(), it + 1, Sets.end());
+    Res = Delta(Candidates[Winner], ComplementSets);
+    return true;
+  }
+
+  const changeset_ty &Subset = Candidates[Winner];
+  changesetlist_ty SplitSets;
+  Split(Subset, SplitSets);
+  Res = Delta(Subset, SplitSets);
+  return true;
 }
 
 DeltaAlgorithm::changeset_ty DeltaAlgorithm::Run(const changeset_ty &Changes) {
@@ -9,6 +9,7 @@
 
 #include "llvm/Support/LineIterator.h"
 #include "llvm/Support/MemoryBuffer.h"
+#include <cstring>
 
 using namespace llvm;
 
@@ -84,11 +85,18 @@ void line_iterator::advance() {
     return;
   }
 
-  // Measure the line.
-  size_t Length = 0;
-  while (Pos[Length] != '\0' && !isAtLineEnd(&Pos[Length])) {
-    ++Length;
-  }
+  // Measure the line. Scan for the newline in bulk; memchr is much faster
+  // than testing each byte for the two line-end characters. A '\r' only
+  // terminates the line as part of "\r\n", so it is enough to find the next
+  // '\n' (or nul) and back up over a preceding '\r'.
+  const char *Nul = static_cast<const char *>(
+      ::memchr(Pos, '\0', Buffer->getBufferEnd() - Pos + 1));
+  const char *EOL =
+      static_cast<const char *>(::memchr(Pos, '\n', Nul - Pos));
+  if (!EOL)
+    EOL = Nul;
+  else if (EOL != Pos && EOL[-1] == '\r')
+    --EOL;
 
-  CurrentLine = StringRef(Pos, Length);
+  CurrentLine = StringRef(Pos, EOL - Pos);
 }
@@ -20,6 +20,7 @@
 using namespace llvm;
 
 static const ManagedStaticBase *StaticList = nullptr;
+static std::atomic<bool> ShutdownDisabled(false);
 static sys::Mutex *ManagedStaticMutex = nullptr;
 static llvm::once_flag mutex_init_flag;
 
@@ -81,8 +82,19 @@ void ManagedStaticBase::destroy() const {
 
 /// llvm_shutdown - Deallocate and destroy all ManagedStatic variables.
 void llvm::llvm_shutdown() {
+  // Leaking the statics to the OS is deliberate in fast-exit mode; every
+  // ManagedStatic still points at its object, so leak checkers see the
+  // memory as reachable.
+  if (ShutdownDisabled.load(std::memory_order_relaxed))
+    return;
+
   MutexGuard Lock(*getManagedStaticMutex());
 
   while (StaticList)
     StaticList->destroy();
 }
+
+/// llvm_disable_shutdown - Make subsequent llvm_shutdown() calls no-ops.
+void llvm::llvm_disable_shutdown() {
+  ShutdownDisabled.store(true, std::memory_order_relaxed);
+}
@@ -21,10 +21,12 @@
 #include "llvm/Support/Path.h"
 #include "llvm/Support/Process.h"
 #include "llvm/Support/Program.h"
+#include "llvm/Support/ThreadPool.h"
 #include <cassert>
 #include <cerrno>
 #include <cstring>
 #include <new>
+#include <thread>
 #include <sys/types.h>
 #include <system_error>
 #if !defined(_MSC_VER) && !defined(__MINGW32__)
@@ -32,8 +34,62 @@
 #else
 #include <io.h>
 #endif
+#ifdef HAVE_SYS_MMAN_H
+#include <sys/mman.h>
+#endif
 using namespace llvm;
 
+/// Forward an AccessHint for a successfully mapped region to the kernel.
+///
+/// This is purely advisory; failures are ignored since the mapping is usable
+/// either way.  On systems without madvise the function is a no-op.
+static void applyAccessHint(const void *Addr, size_t Size,
+                            MemoryBuffer::AccessHint Hint) {
+#if defined(HAVE_SYS_MMAN_H) && defined(MADV_NORMAL)
+  if (Hint == MemoryBuffer::AccessHint_None || Size == 0)
+    return;
+  void *P = const_cast<void *>(Addr);
+  switch (Hint) {
+  case MemoryBuffer::AccessHint_None:
+    break;
+  case MemoryBuffer::AccessHint_Sequential:
+    ::madvise(P, Size, MADV_SEQUENTIAL);
+    break;
+  case MemoryBuffer::AccessHint_WillNeed:
+    ::madvise(P, Size, MADV_WILLNEED);
+    break;
+  case MemoryBuffer::AccessHint_Bulk:
+    // Request transparent huge pages first: the kernel only honors the
+    // request for ranges that are not already populated, so it has to come
+    // before the readahead kicked off by MADV_WILLNEED.
+#ifdef MADV_HUGEPAGE
+    ::madvise(P, Size, MADV_HUGEPAGE);
+#endif
+    ::madvise(P, Size, MADV_WILLNEED);
+    break;
+  }
+#else
+  (void)Addr;
+  (void)Size;
+  (void)Hint;
+#endif
+}
+
+void MemoryBuffer::prefetch(const void *Addr, size_t Size) {
+#if defined(HAVE_SYS_MMAN_H) && defined(MADV_WILLNEED)
+  if (Size == 0)
+    return;
+  // madvise requires a page-aligned address; widen the range to page bounds.
+  static const uintptr_t PageSize = sys::Process::getPageSize();
+  uintptr_t Start = reinterpret_cast<uintptr_t>(Addr) & ~(PageSize - 1);
+  uintptr_t End = reinterpret_cast<uintptr_t>(Addr) + Size;
+  ::madvise(reinterpret_cast<void *>(Start), End - Start, MADV_WILLNEED);
+#else
+  (void)Addr;
+  (void)Size;
+#endif
+}
+
 //===----------------------------------------------------------------------===//
 // MemoryBuffer implementation itself.
 //===----------------------------------------------------------------------===//
@@ -102,8 +158,9 @@ public:
 }
 
 static ErrorOr<std::unique_ptr<MemoryBuffer>>
-getFileAux(const Twine &Filename, int64_t FileSize, uint64_t MapSize, 
-           uint64_t Offset, bool RequiresNullTerminator, bool IsVolatile);
+getFileAux(const Twine &Filename, int64_t FileSize, uint64_t MapSize,
+           uint64_t Offset, bool RequiresNullTerminator, bool IsVolatile,
+           MemoryBuffer::AccessHint Hint);
 
 std::unique_ptr<MemoryBuffer>
 MemoryBuffer::getMemBuffer(StringRef InputData, StringRef BufferName,
@@ -177,9 +234,10 @@ MemoryBuffer::getFileOrSTDIN(const Twine &Filename, int64_t FileSize,
 }
 
 ErrorOr<std::unique_ptr<MemoryBuffer>>
-MemoryBuffer::getFileSlice(const Twine &FilePath, uint64_t MapSize, 
+MemoryBuffer::getFileSlice(const Twine &FilePath, uint64_t MapSize,
                            uint64_t Offset, bool IsVolatile) {
-  return getFileAux(FilePath, -1, MapSize, Offset, false, IsVolatile);
+  return getFileAux(FilePath, -1, MapSize, Offset, false, IsVolatile,
+                    AccessHint_None);
 }
 
 
@@ -208,10 +266,15 @@ class MemoryBufferMMapFile : public MemoryBuffer {
 
 public:
   MemoryBufferMMapFile(bool RequiresNullTerminator, int FD, uint64_t Len,
-                       uint64_t Offset, std::error_code &EC)
+                       uint64_t Offset, std::error_code &EC,
+                       AccessHint Hint = AccessHint_None)
       : MFR(FD, sys::fs::mapped_file_region::readonly,
             getLegalMapSize(Len, Offset), getLegalMapOffset(Offset), EC) {
     if (!EC) {
+      // Advise on the whole mapping rather than the requested slice, since
+      // madvise wants page-aligned addresses and the mapping is aligned by
+      // construction.
+      applyAccessHint(MFR.const_data(), MFR.size(), Hint);
       const char *Start = getStart(Len, Offset);
       init(Start, Start + Len, RequiresNullTerminator);
     }
@@ -254,19 +317,21 @@ getMemoryBufferForStream(int FD, const Twine &BufferName) {
 
 ErrorOr<std::unique_ptr<MemoryBuffer>>
 MemoryBuffer::getFile(const Twine &Filename, int64_t FileSize,
-                      bool RequiresNullTerminator, bool IsVolatile) {
+                      bool RequiresNullTerminator, bool IsVolatile,
+                      AccessHint Hint) {
   return getFileAux(Filename, FileSize, FileSize, 0,
-                    RequiresNullTerminator, IsVolatile);
+                    RequiresNullTerminator, IsVolatile, Hint);
 }
 
 static ErrorOr<std::unique_ptr<MemoryBuffer>>
 getOpenFileImpl(int FD, const Twine &Filename, uint64_t FileSize,
                 uint64_t MapSize, int64_t Offset, bool RequiresNullTerminator,
-                bool IsVolatile);
+                bool IsVolatile, MemoryBuffer::AccessHint Hint);
 
 static ErrorOr<std::unique_ptr<MemoryBuffer>>
 getFileAux(const Twine &Filename, int64_t FileSize, uint64_t MapSize,
-           uint64_t Offset, bool RequiresNullTerminator, bool IsVolatile) {
+           uint64_t Offset, bool RequiresNullTerminator, bool IsVolatile,
+           MemoryBuffer::AccessHint Hint) {
   int FD;
   std::error_code EC = sys::fs::openFileForRead(Filename, FD);
   if (EC)
@@ -274,7 +339,7 @@ getFileAux(const Twine &Filename, int64_t FileSize, uint64_t MapSize,
 
   ErrorOr<std::unique_ptr<MemoryBuffer>> Ret =
       getOpenFileImpl(FD, Filename, FileSize, MapSize, Offset,
-                      RequiresNullTerminator, IsVolatile);
+                      RequiresNullTerminator, IsVolatile, Hint);
   close(FD);
   return Ret;
 }
@@ -337,7 +402,7 @@ static bool shouldUseMmap(int FD,
 static ErrorOr<std::unique_ptr<MemoryBuffer>>
 getOpenFileImpl(int FD, const Twine &Filename, uint64_t FileSize,
                 uint64_t MapSize, int64_t Offset, bool RequiresNullTerminator,
-                bool IsVolatile) {
+                bool IsVolatile, MemoryBuffer::AccessHint Hint) {
   static int PageSize = sys::Process::getPageSize();
 
   // Default is to map the full file.
@@ -368,7 +433,8 @@ getOpenFileImpl(int FD, const Twine &Filename, uint64_t FileSize,
     std::error_code EC;
     std::unique_ptr<MemoryBuffer> Result(
         new (NamedBufferAlloc(Filename))
-        MemoryBufferMMapFile(RequiresNullTerminator, FD, MapSize, Offset, EC));
+        MemoryBufferMMapFile(RequiresNullTerminator, FD, MapSize, Offset, EC,
+                             Hint));
     if (!EC)
       return std::move(Result);
   }
@@ -414,16 +480,19 @@ getOpenFileImpl(int FD, const Twine &Filename, uint64_t FileSize,
 
 ErrorOr<std::unique_ptr<MemoryBuffer>>
 MemoryBuffer::getOpenFile(int FD, const Twine &Filename, uint64_t FileSize,
-                          bool RequiresNullTerminator, bool IsVolatile) {
+                          bool RequiresNullTerminator, bool IsVolatile,
+                          AccessHint Hint) {
   return getOpenFileImpl(FD, Filename, FileSize, FileSize, 0,
-                         RequiresNullTerminator, IsVolatile);
+                         RequiresNullTerminator, IsVolatile, Hint);
 }
 
 ErrorOr<std::unique_ptr<MemoryBuffer>>
 MemoryBuffer::getOpenFileSlice(int FD, const Twine &Filename, uint64_t MapSize,
-                               int64_t Offset, bool IsVolatile) {
+                               int64_t Offset, bool IsVolatile,
+                               AccessHint Hint) {
   assert(MapSize != uint64_t(-1));
-  return getOpenFileImpl(FD, Filename, -1, MapSize, Offset, false, IsVolatile);
+  return getOpenFileImpl(FD, Filename, -1, MapSize, Offset, false, IsVolatile,
+                         Hint);
 }
 
 ErrorOr<std::unique_ptr<MemoryBuffer>> MemoryBuffer::getSTDIN() {
@@ -448,6 +517,37 @@ MemoryBuffer::getFileAsStream(const Twine &Filename) {
   return Ret;
 }
 
+void MemoryBuffer::getFiles(
+    ArrayRef<std::string> Paths,
+    SmallVectorImpl<ErrorOr<std::unique_ptr<MemoryBuffer>>> &Buffers,
+    unsigned NumThreads) {
+  Buffers.clear();
+  Buffers.reserve(Paths.size());
+  for (size_t I = 0, E = Paths.size(); I != E; ++I)
+    Buffers.push_back(make_error_code(errc::interrupted));
+
+  if (NumThreads == 0)
+    NumThreads = std::max(1U, std::thread::hardware_concurrency());
+
+  // Not worth spinning up a pool for a couple of files.
+  if (NumThreads == 1 || Paths.size() <= 1) {
+    for (size_t I = 0, E = Paths.size(); I != E; ++I)
+      Buffers[I] = getFile(Paths[I]);
+    return;
+  }
+
+  // Each task writes only its own pre-allocated slot, so no locking is
+  // needed around the result vector.
+  ThreadPool Pool(std::min<unsigned>(NumThreads, Paths.size()));
+  for (size_t I = 0, E = Paths.size(); I != E; ++I)
+    Pool.async(
+        [&Buffers](const std::string &Path, size_t Idx) {
+          Buffers[Idx] = getFile(Path);
+        },
+        Paths[I], I);
+  Pool.wait();
+}
+
 MemoryBufferRef MemoryBuffer::getMemBufferRef() const {
   StringRef Data = getBuffer();
   StringRef Identifier = getBufferIdentifier();
@@ -0,0 +1,64 @@
+//===- Parallel.cpp - Parallel loop primitives ----------------------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "llvm/Support/Parallel.h"
+#include "llvm/Support/Compiler.h"
+#include "llvm/Support/ManagedStatic.h"
+#include "llvm/Support/ThreadPool.h"
+#include "llvm/Support/Threading.h"
+#include <algorithm>
+#include <future>
+#include <thread>
+
+using namespace llvm;
+
+// All parallel loops share one lazily created pool so that concurrent and
+// back-to-back loops reuse the same worker threads instead of paying thread
+// creation costs per loop. The pool is torn down by llvm_shutdown().
+static ManagedStatic<ThreadPool> LoopPool;
+
+// Set while a thread is executing chunks of a parallel loop. A nested
+// parallel loop must not block on the pool from inside a pool worker, since
+// every worker could end up waiting for tasks that no thread is left to run;
+// nested loops degrade to serial execution instead.
+static LLVM_THREAD_LOCAL bool InParallelLoop = false;
+
+void parallel::detail::parallelForImpl(size_t Begin, size_t End, size_t Grain,
+                                       function_ref<void(size_t, size_t)> Fn) {
+  if (Begin >= End)
+    return;
+  if (Grain == 0)
+    Grain = 1;
+
+  size_t Size = End - Begin;
+  unsigned NumThreads = std::max(1U, std::thread::hardware_concurrency());
+  if (InParallelLoop || !llvm_is_multithreaded() || NumThreads == 1 ||
+      Size <= Grain) {
+    Fn(Begin, End);
+    return;
+  }
+
+  // Aim for several chunks per worker so that uneven iteration costs load
+  // balance across the pool, but never split below the caller's grain size.
+  size_t ChunkSize = std::max(Grain, Size / (NumThreads * 4));
+  std::vector<std::shared_future<ThreadPool::VoidTy>> Chunks;
+  Chunks.reserve((Size + ChunkSize - 1) / ChunkSize);
+  for (size_t B = Begin; B < End; B += ChunkSize) {
+    size_t E = std::min(End, B + ChunkSize);
+    Chunks.push_back(LoopPool->async([Fn, B, E] {
+      InParallelLoop = true;
+      Fn(B, E);
+      InParallelLoop = false;
+    }));
+  }
+  // Wait on this loop's own futures rather than draining the whole pool, so
+  // that unrelated loops submitting concurrently do not extend our wait.
+  for (auto &Chunk : Chunks)
+    Chunk.wait();
+}
@@ -12,6 +12,7 @@
 //===----------------------------------------------------------------------===//
 
 #include "llvm/ADT/SmallVector.h"
+#include "llvm/Support/AllocProfile.h"
 using namespace llvm;
 
 /// grow_pod - This is an implementation of the grow() method which only works
@@ -22,6 +23,7 @@ void SmallVectorBase::grow_pod(void *FirstEl, size_t MinSizeInBytes,
   size_t NewCapacityInBytes = 2 * capacity_in_bytes() + TSize; // Always grow.
   if (NewCapacityInBytes < MinSizeInBytes)
     NewCapacityInBytes = MinSizeInBytes;
+  LLVM_RECORD_ALLOC_GROW(SmallVectorGrow, NewCapacityInBytes);
 
   void *NewElts;
   if (BeginX == FirstEl) {
@@ -16,11 +16,13 @@
 
 #include "llvm/Support/SpecialCaseList.h"
 #include "llvm/Support/TrigramIndex.h"
+#include "llvm/ADT/ArrayRef.h"
 #include "llvm/ADT/SmallVector.h"
 #include "llvm/ADT/StringExtras.h"
 #include "llvm/ADT/StringSet.h"
 #include "llvm/Support/MemoryBuffer.h"
 #include "llvm/Support/Regex.h"
+#include <algorithm>
 #include <string>
 #include <system_error>
 #include <utility>
@@ -28,20 +30,259 @@
 namespace llvm {
 
 /// Represents a set of regular expressions.  Regular expressions which are
-/// "literal" (i.e. no regex metacharacters) are stored in Strings, while all
-/// others are represented as a single pipe-separated regex in RegEx.  The
-/// reason for doing so is efficiency; StringSet is much faster at matching
-/// literal strings than Regex.
+/// "literal" (i.e. no regex metacharacters) are stored in Strings.  Patterns
+/// whose only metacharacter is '*' are compiled into the glob matchers below,
+/// which match in time proportional to the query length rather than the
+/// number of patterns.  Everything else is represented as a single
+/// pipe-separated regex in RegEx.
 struct SpecialCaseList::Entry {
+  /// A byte-labelled trie over literal strings.  Lookup walks one node per
+  /// query character, so the match time is independent of how many patterns
+  /// the trie holds.
+  class Trie {
+    struct Node {
+      SmallVector<std::pair<char, unsigned>, 2> Edges;
+      bool Terminal = false;
+    };
+    // Node 0 is the root; it only exists once a string has been inserted.
+    std::vector<Node> Nodes;
+
+    unsigned stepFrom(unsigned N, char C) const {
+      for (const auto &E : Nodes[N].Edges)
+        if (E.first == C)
+          return E.second;
+      return 0;
+    }
+
+  public:
+    void insert(StringRef S) {
+      if (Nodes.empty())
+        Nodes.emplace_back();
+      unsigned N = 0;
+      for (char C : S) {
+        unsigned Next = stepFrom(N, C);
+        if (!Next) {
+          Next = Nodes.size();
+          Nodes[N].Edges.push_back(std::make_pair(C, Next));
+          Nodes.emplace_back();
+        }
+        N = Next;
+      }
+      Nodes[N].Terminal = true;
+    }
+
+    /// Return true if any inserted string is a prefix of \p Query.
+    bool matchesPrefixOf(StringRef Query) const {
+      if (Nodes.empty())
+        return false;
+      unsigned N = 0;
+      for (char C : Query) {
+        N = stepFrom(N, C);
+        if (!N)
+          return false;
+        if (Nodes[N].Terminal)
+          return true;
+      }
+      return false;
+    }
+
+    /// Return true if the reversal of any inserted string is a suffix of
+    /// \p Query.  Suffix patterns are inserted reversed so this walk can run
+    /// from the back of the query without copying it.
+    bool matchesSuffixOf(StringRef Query) const {
+      if (Nodes.empty())
+        return false;
+      unsigned N = 0;
+      for (size_t I = Query.size(); I != 0; --I) {
+        N = stepFrom(N, Query[I - 1]);
+        if (!N)
+          return false;
+        if (Nodes[N].Terminal)
+          return true;
+      }
+      return false;
+    }
+  };
+
+  /// An Aho-Corasick automaton over the "*text*" patterns.  It is compiled
+  /// once after parsing; a query is then matched against every pattern at
+  /// once in a single linear scan.
+  class SubstringMatcher {
+    struct Node {
+      SmallVector<std::pair<char, unsigned>, 2> Edges;
+      unsigned Fail = 0;
+      bool Accepts = false;
+    };
+    std::vector<Node> Nodes;
+
+    unsigned stepFrom(unsigned N, char C) const {
+      while (true) {
+        for (const auto &E : Nodes[N].Edges)
+          if (E.first == C)
+            return E.second;
+        if (N == 0)
+          return 0;
+        N = Nodes[N].Fail;
+      }
+    }
+
+  public:
+    void insert(StringRef S) {
+      if (Nodes.empty())
+        Nodes.emplace_back();
+      unsigned N = 0;
+      for (char C : S) {
+        unsigned Next = 0;
+        for (const auto &E : Nodes[N].Edges)
+          if (E.first == C) {
+            Next = E.second;
+            break;
+          }
+        if (!Next) {
+          Next = Nodes.size();
+          Nodes[N].Edges.push_back(std::make_pair(C, Next));
+          Nodes.emplace_back();
+        }
+        N = Next;
+      }
+      Nodes[N].Accepts = true;
+    }
+
+    /// Compute the failure links.  Must be called after the last insert()
+    /// and before the first match.
+    void compile() {
+      if (Nodes.empty())
+        return;
+      // Breadth-first over the trie: a node's failure link only depends on
+      // links of shallower nodes.
+      std::vector<unsigned> WorkList;
+      for (const auto &E : Nodes[0].Edges)
+        WorkList.push_back(E.second);
+      for (unsigned I = 0; I != WorkList.size(); ++I) {
+        unsigned N = WorkList[I];
+        for (const auto &E : Nodes[N].Edges) {
+          Nodes[E.second].Fail = stepFrom(Nodes[N].Fail, E.first);
+          WorkList.push_back(E.second);
+        }
+        // Accept when any suffix of the path accepts.
+        if (Nodes[Nodes[N].Fail].Accepts)
+          Nodes[N].Accepts = true;
+      }
+    }
+
+    /// Return true if any inserted string occurs in \p Query.
+    bool matchesSubstringOf(StringRef Query) const {
+      if (Nodes.empty())
+        return false;
+      unsigned N = 0;
+      for (char C : Query) {
+        N = stepFrom(N, C);
+        if (Nodes[N].Accepts)
+          return true;
+      }
+      return false;
+    }
+  };
+
+  /// A general glob with '*' in arbitrary positions, e.g. "a*b*c".  These are
+  /// rare in practice; each one is matched with a greedy linear scan.
+  struct Glob {
+    bool AnchorFront;
+    bool AnchorBack;
+    std::vector<std::string> Segments;
+
+    bool match(StringRef Query) const {
+      ArrayRef<std::string> Segs = Segments;
+      if (AnchorFront) {
+        if (!Query.startswith(Segs.front()))
+          return false;
+        Query = Query.drop_front(Segs.front().size());
+        Segs = Segs.drop_front();
+      }
+      if (AnchorBack && !Segs.empty()) {
+        const std::string &S = Segs.back();
+        if (Query.size() < S.size() || !Query.endswith(S))
+          return false;
+        Query = Query.drop_back(S.size());
+        Segs = Segs.drop_back();
+      }
+      // Greedily locate the remaining segments left to right; for '*'-only
+      // patterns the greedy choice is always safe.
+      for (const std::string &S : Segs) {
+        size_t Pos = Query.find(S);
+        if (Pos == StringRef::npos)
+          return false;
+        Query = Query.drop_front(Pos + S.size());
+      }
+      return true;
+    }
+  };
+
   StringSet<> Strings;
   TrigramIndex Trigrams;
+  bool MatchesEverything = false;
+  Trie Prefixes;
+  Trie Suffixes;
+  SubstringMatcher Substrings;
+  std::vector<Glob> Globs;
   std::unique_ptr<Regex> RegEx;
 
+  /// Try to compile \p Pattern into one of the glob matchers.  Returns false
+  /// if the pattern uses regex features beyond '*' and has to be handled by
+  /// the fallback regex.
+  bool addSimpleGlob(StringRef Pattern) {
+    std::string Stripped;
+    Stripped.reserve(Pattern.size());
+    for (char C : Pattern)
+      if (C != '*')
+        Stripped += C;
+    if (!Regex::isLiteralERE(Stripped))
+      return false;
+
+    bool AnchorFront = !Pattern.empty() && Pattern.front() != '*';
+    bool AnchorBack = !Pattern.empty() && Pattern.back() != '*';
+    SmallVector<StringRef, 4> Segs;
+    Pattern.split(Segs, '*', -1, /*KeepEmpty=*/false);
+
+    if (Segs.empty()) {
+      MatchesEverything = true;
+      return true;
+    }
+    if (Segs.size() == 1 && AnchorFront && !AnchorBack) {
+      Prefixes.insert(Segs.front());
+      return true;
+    }
+    if (Segs.size() == 1 && !AnchorFront && AnchorBack) {
+      std::string Reversed = Segs.front().str();
+      std::reverse(Reversed.begin(), Reversed.end());
+      Suffixes.insert(Reversed);
+      return true;
+    }
+    if (Segs.size() == 1 && !AnchorFront && !AnchorBack) {
+      Substrings.insert(Segs.front());
+      return true;
+    }
+
+    Glob G;
+    G.AnchorFront = AnchorFront;
+    G.AnchorBack = AnchorBack;
+    for (StringRef S : Segs)
+      G.Segments.push_back(S.str());
+    Globs.push_back(std::move(G));
+    return true;
+  }
+
   bool match(StringRef Query) const {
-    if (Strings.count(Query))
+    if (MatchesEverything || Strings.count(Query))
       return true;
     if (Trigrams.isDefinitelyOut(Query))
       return false;
+    if (Prefixes.matchesPrefixOf(Query) || Suffixes.matchesSuffixOf(Query) ||
+        Substrings.matchesSubstringOf(Query))
+      return true;
+    for (const Glob &G : Globs)
+      if (G.match(Query))
+        return true;
     return RegEx && RegEx->match(Query);
   }
 };
@@ -117,6 +358,11 @@ bool SpecialCaseList::parse(const MemoryBuffer *MB, std::string &Error) {
     }
     Entry.Trigrams.insert(Regexp);
 
+    // Patterns whose only metacharacter is '*' are compiled into the glob
+    // matchers and bypass the alternation regex entirely.
+    if (Entry.addSimpleGlob(Regexp))
+      continue;
+
     // Replace * with .*
     for (size_t pos = 0; (pos = Regexp.find('*', pos)) != std::string::npos;
          pos += strlen(".*")) {
@@ -152,6 +398,10 @@ void SpecialCaseList::compile() {
       Entries[I->getKey()][II->getKey()].RegEx.reset(new Regex(II->getValue()));
     }
   }
+  // Finalize the substring automata now that the last pattern is in.
+  for (auto &SectionEntry : Entries)
+    for (auto &CategoryEntry : SectionEntry.second)
+      CategoryEntry.second.Substrings.compile();
   Regexps.clear();
   IsCompiled = true;
 }
@@ -12,13 +12,55 @@
 //===----------------------------------------------------------------------===//
 
 #include "llvm/ADT/StringMap.h"
-#include "llvm/ADT/StringExtras.h"
 #include "llvm/Support/Compiler.h"
 #include "llvm/Support/MathExtras.h"
+#include "llvm/Support/xxhash.h"
 #include <cassert>
+#include <cstring>
+
+#ifdef __SSE4_2__
+#include <nmmintrin.h>
+#endif
 
 using namespace llvm;
 
+/// Hash a string key for bucket selection.
+///
+/// StringMap historically used the byte-at-a-time HashString from
+/// StringExtras, which shows up prominently in profiles of clients that
+/// intern many long strings (MCContext symbol tables, the ThinLTO global
+/// symbol table, LLVMContext named types).  Instead we hash eight bytes per
+/// step: on targets compiled with SSE4.2 we use the crc32 instruction, and
+/// everywhere else we fall back to xxHash64, which is itself a wide scalar
+/// hash.  The value is only used in-memory for bucket selection, so it does
+/// not need to be stable across hosts or build configurations.
+static inline unsigned hashKey(StringRef Key) {
+#ifdef __SSE4_2__
+  const char *P = Key.data();
+  size_t Size = Key.size();
+  uint64_t H = 0xFFFFFFFFu ^ Size;
+  while (Size >= 8) {
+    uint64_t Chunk;
+    memcpy(&Chunk, P, 8);
+    H = _mm_crc32_u64(H, Chunk);
+    P += 8;
+    Size -= 8;
+  }
+  while (Size) {
+    H = _mm_crc32_u8((unsigned)H, (unsigned char)*P);
+    ++P;
+    --Size;
+  }
+  // crc32 only fills 32 bits and distributes the low bits poorly for short
+  // keys; run a cheap finalizer so that masking with the bucket count sees
+  // well-mixed low bits.
+  H *= 0x9E3779B97F4A7C15ull;
+  return unsigned(H >> 32);
+#else
+  return unsigned(xxHash64(Key));
+#endif
+}
+
 /// Returns the number of buckets to allocate to ensure that the DenseMap can
 /// accommodate \p NumEntries without need to grow().
 static unsigned getMinBucketToReserveForEntries(unsigned NumEntries) {
@@ -76,7 +118,7 @@ unsigned StringMapImpl::LookupBucketFor(StringRef Name) {
     init(16);
     HTSize = NumBuckets;
   }
-  unsigned FullHashValue = HashString(Name);
+  unsigned FullHashValue = hashKey(Name);
   unsigned BucketNo = FullHashValue & (HTSize-1);
   unsigned *HashTable = (unsigned *)(TheTable + NumBuckets + 1);
 
@@ -130,7 +172,7 @@ unsigned StringMapImpl::LookupBucketFor(StringRef Name) {
 int StringMapImpl::FindKey(StringRef Key) const {
   unsigned HTSize = NumBuckets;
   if (HTSize == 0) return -1;  // Really empty table?
-  unsigned FullHashValue = HashString(Key);
+  unsigned FullHashValue = hashKey(Key);
   unsigned BucketNo = FullHashValue & (HTSize-1);
   unsigned *HashTable = (unsigned *)(TheTable + NumBuckets + 1);
 
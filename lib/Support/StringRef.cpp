@@ -250,6 +250,9 @@ size_t StringRef::rfind_lower(StringRef Str) const {
 /// Note: O(size() + Chars.size())
 StringRef::size_type StringRef::find_first_of(StringRef Chars,
                                               size_t From) const {
+  if (Chars.size() == 1)
+    return find(Chars.front(), From);
+
   std::bitset<1 << CHAR_BIT> CharBits;
   for (size_type i = 0; i != Chars.size(); ++i)
     CharBits.set((unsigned char)Chars[i]);
@@ -388,11 +391,12 @@ void StringRef::split(SmallVectorImpl<StringRef> &A, char Separator,
 size_t StringRef::count(StringRef Str) const {
   size_t Count = 0;
   size_t N = Str.size();
-  if (N > Length)
+  if (!N || N > Length)
     return 0;
-  for (size_t i = 0, e = Length - N + 1; i != e; ++i)
-    if (substr(i, N).equals(Str))
-      ++Count;
+  // Lean on find(), which uses memchr and a skip table, instead of checking
+  // every offset with memcmp.
+  for (size_t Pos = 0; (Pos = find(Str, Pos)) != npos; Pos += N)
+    ++Count;
   return Count;
 }
 
@@ -7,7 +7,7 @@
 //
 //===----------------------------------------------------------------------===//
 //
-// This file implements a crude C++11 based thread pool.
+// This file implements a work-stealing C++11 based thread pool.
 //
 //===----------------------------------------------------------------------===//
 
@@ -24,34 +24,36 @@ using namespace llvm;
 ThreadPool::ThreadPool() : ThreadPool(std::thread::hardware_concurrency()) {}
 
 ThreadPool::ThreadPool(unsigned ThreadCount)
-    : ActiveThreads(0), EnableFlag(true) {
+    : SubmissionCursor(0), PendingTaskCount(0), ActiveThreads(0),
+      EnableFlag(true) {
+  // One deque per worker. Guarantee at least one deque so that submission has
+  // somewhere to go even if hardware_concurrency() reported zero.
+  unsigned QueueCount = ThreadCount ? ThreadCount : 1;
+  Queues.reserve(QueueCount);
+  for (unsigned I = 0; I < QueueCount; ++I)
+    Queues.emplace_back(new TaskQueue());
+
   // Create ThreadCount threads that will loop forever, wait on QueueCondition
   // for tasks to be queued or the Pool to be destroyed.
   Threads.reserve(ThreadCount);
   for (unsigned ThreadID = 0; ThreadID < ThreadCount; ++ThreadID) {
-    Threads.emplace_back([&] {
+    Threads.emplace_back([this, ThreadID] {
       while (true) {
         PackagedTaskTy Task;
-        {
+        // Service our own deque first, then go stealing. Both can fail even
+        // with PendingTaskCount non-zero if another worker raced us to the
+        // task, in which case we simply go back to waiting.
+        if (!popLocalTask(ThreadID, Task) && !stealTask(ThreadID, Task)) {
           std::unique_lock<std::mutex> LockGuard(QueueLock);
-          // Wait for tasks to be pushed in the queue
-          QueueCondition.wait(LockGuard,
-                              [&] { return !EnableFlag || !Tasks.empty(); });
+          // Wait for tasks to be pushed in some queue
+          QueueCondition.wait(
+              LockGuard, [&] { return !EnableFlag || PendingTaskCount != 0; });
           // Exit condition
-          if (!EnableFlag && Tasks.empty())
+          if (!EnableFlag && PendingTaskCount == 0)
             return;
-          // Yeah, we have a task, grab it and release the lock on the queue
-
-          // We first need to signal that we are active before popping the queue
-          // in order for wait() to properly detect that even if the queue is
-          // empty, there is still a task in flight.
-          {
-            ++ActiveThreads;
-            std::unique_lock<std::mutex> LockGuard(CompletionLock);
-          }
-          Task = std::move(Tasks.front());
-          Tasks.pop();
+          continue;
         }
+
         // Run the task we just grabbed
 #ifndef _MSC_VER
         Task();
@@ -72,28 +74,84 @@ ThreadPool::ThreadPool(unsigned ThreadCount)
   }
 }
 
+bool ThreadPool::popLocalTask(unsigned QueueID, PackagedTaskTy &Task) {
+  TaskQueue &Queue = *Queues[QueueID];
+  std::unique_lock<std::mutex> LockGuard(Queue.Lock);
+  if (Queue.Tasks.empty())
+    return false;
+
+  // We first need to signal that we are active before unqueueing in order
+  // for wait() to properly detect that even if the queues are empty, there
+  // is still a task in flight.
+  {
+    ++ActiveThreads;
+    std::unique_lock<std::mutex> CompletionGuard(CompletionLock);
+  }
+  Task = std::move(Queue.Tasks.back());
+  Queue.Tasks.pop_back();
+  --PendingTaskCount;
+  return true;
+}
+
+bool ThreadPool::stealTask(unsigned QueueID, PackagedTaskTy &Task) {
+  // Scan the other deques starting from our neighbor so that thieves spread
+  // out instead of all hammering queue zero.
+  for (unsigned I = 1, E = Queues.size(); I < E; ++I) {
+    TaskQueue &Queue = *Queues[(QueueID + I) % E];
+    std::unique_lock<std::mutex> LockGuard(Queue.Lock);
+    if (Queue.Tasks.empty())
+      continue;
+
+    // Same active-before-unqueue dance as popLocalTask(), see above.
+    {
+      ++ActiveThreads;
+      std::unique_lock<std::mutex> CompletionGuard(CompletionLock);
+    }
+    // Steal from the front: the oldest task is the one the owner would get
+    // to last, so contention with the owner's own pop_back is minimized.
+    Task = std::move(Queue.Tasks.front());
+    Queue.Tasks.pop_front();
+    --PendingTaskCount;
+    return true;
+  }
+  return false;
+}
+
 void ThreadPool::wait() {
-  // Wait for all threads to complete and the queue to be empty
+  // Wait for all threads to complete and the queues to be empty
   std::unique_lock<std::mutex> LockGuard(CompletionLock);
-  // The order of the checks for ActiveThreads and Tasks.empty() matters because
-  // any active threads might be modifying the Tasks queue, and this would be a
-  // race.
-  CompletionCondition.wait(LockGuard,
-                           [&] { return !ActiveThreads && Tasks.empty(); });
+  // The order of the checks for ActiveThreads and PendingTaskCount matters
+  // because a worker signals itself active (synchronizing on CompletionLock)
+  // strictly before decrementing PendingTaskCount, so a task can never be
+  // missed by reading in this order.
+  CompletionCondition.wait(
+      LockGuard, [&] { return !ActiveThreads && PendingTaskCount == 0; });
 }
 
 std::shared_future<ThreadPool::VoidTy> ThreadPool::asyncImpl(TaskTy Task) {
   /// Wrap the Task in a packaged_task to return a future object.
   PackagedTaskTy PackagedTask(std::move(Task));
   auto Future = PackagedTask.get_future();
-  {
-    // Lock the queue and push the new task
-    std::unique_lock<std::mutex> LockGuard(QueueLock);
 
-    // Don't allow enqueueing after disabling the pool
-    assert(EnableFlag && "Queuing a thread during ThreadPool destruction");
+  // Don't allow enqueueing after disabling the pool
+  assert(EnableFlag && "Queuing a thread during ThreadPool destruction");
 
-    Tasks.push(std::move(PackagedTask));
+  // Round-robin over the per-worker deques; relaxed is fine, the cursor only
+  // needs to spread load, not order anything.
+  unsigned QueueID = SubmissionCursor.fetch_add(1, std::memory_order_relaxed) %
+                     Queues.size();
+  {
+    TaskQueue &Queue = *Queues[QueueID];
+    std::unique_lock<std::mutex> LockGuard(Queue.Lock);
+    Queue.Tasks.push_back(std::move(PackagedTask));
+  }
+  {
+    // Publish the new task under QueueLock, the mutex the workers' condition
+    // wait uses. Without this a worker that has just found every deque empty
+    // but has not yet blocked on QueueCondition would miss the notify and the
+    // task could sit stranded until the next submission.
+    std::unique_lock<std::mutex> LockGuard(QueueLock);
+    ++PendingTaskCount;
   }
   QueueCondition.notify_one();
   return Future.share();
@@ -116,18 +174,20 @@ ThreadPool::ThreadPool() : ThreadPool(0) {}
 
 // No threads are launched, issue a warning if ThreadCount is not 0
 ThreadPool::ThreadPool(unsigned ThreadCount)
-    : ActiveThreads(0) {
+    : SubmissionCursor(0), PendingTaskCount(0), ActiveThreads(0) {
   if (ThreadCount) {
     errs() << "Warning: request a ThreadPool with " << ThreadCount
            << " threads, but LLVM_ENABLE_THREADS has been turned off\n";
   }
+  Queues.emplace_back(new TaskQueue());
 }
 
 void ThreadPool::wait() {
   // Sequential implementation running the tasks
+  auto &Tasks = Queues[0]->Tasks;
   while (!Tasks.empty()) {
     auto Task = std::move(Tasks.front());
-    Tasks.pop();
+    Tasks.pop_front();
 #ifndef _MSC_VER
         Task();
 #else
@@ -147,7 +207,7 @@ std::shared_future<ThreadPool::VoidTy> ThreadPool::asyncImpl(TaskTy Task) {
   auto Future = std::async(std::launch::deferred, std::move(Task), false).share();
   PackagedTaskTy PackagedTask([Future](bool) -> bool { Future.get(); return false; });
 #endif
-  Tasks.push(std::move(PackagedTask));
+  Queues[0]->Tasks.push_back(std::move(PackagedTask));
   return Future;
 }
 
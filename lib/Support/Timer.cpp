@@ -12,6 +12,7 @@
 //===----------------------------------------------------------------------===//
 
 #include "llvm/Support/Timer.h"
+#include "llvm/ADT/SmallString.h"
 #include "llvm/ADT/Statistic.h"
 #include "llvm/ADT/StringMap.h"
 #include "llvm/Support/CommandLine.h"
@@ -20,6 +21,7 @@
 #include "llvm/Support/ManagedStatic.h"
 #include "llvm/Support/Mutex.h"
 #include "llvm/Support/Process.h"
+#include "llvm/Support/Threading.h"
 #include "llvm/Support/raw_ostream.h"
 #include "llvm/Support/YAMLTraits.h"
 using namespace llvm;
@@ -48,6 +50,13 @@ namespace {
   InfoOutputFilename("info-output-file", cl::value_desc("filename"),
                      cl::desc("File to append -stats and -timer output to"),
                    cl::Hidden, cl::location(getLibSupportInfoOutputFilename()));
+
+  static cl::opt<std::string>
+  TimeTraceJSONFilename("time-trace-json", cl::value_desc("filename"),
+                        cl::desc("Emit every timer start/stop as a Chrome "
+                                 "trace-event JSON file for flame-graph "
+                                 "tooling"),
+                        cl::Hidden);
 }
 
 std::unique_ptr<raw_fd_ostream> llvm::CreateInfoOutputFile() {
@@ -77,6 +86,115 @@ static TimerGroup *getDefaultTimerGroup() {
   return &DefaultTimerGroup;
 }
 
+//===----------------------------------------------------------------------===//
+// Chrome trace-event capture (-time-trace-json)
+//===----------------------------------------------------------------------===//
+
+namespace {
+
+struct TimeTraceEvent {
+  std::string Name;     ///< Timer description, e.g. the pass name.
+  std::string Category; ///< Owning timer group name.
+  std::string Detail;   ///< Transient note, e.g. the function name.
+  uint64_t Tid;
+  double StartWall;     ///< Absolute wall clock of startTimer(), in seconds.
+  double DurWall;       ///< Wall clock duration, in seconds.
+};
+
+/// All trace events recorded so far plus the transient detail note.  The
+/// trace file is written when the ManagedStatic is torn down during
+/// llvm_shutdown, so it covers the whole run.
+struct TimeTraceState {
+  std::vector<TimeTraceEvent> Events;
+  std::string Detail;
+
+  ~TimeTraceState() { write(); }
+  void write();
+};
+
+} // end anonymous namespace
+
+static ManagedStatic<TimeTraceState> TimeTrace;
+
+bool llvm::timeTraceEnabled() { return !TimeTraceJSONFilename.empty(); }
+
+void llvm::setTimeTraceDetail(StringRef Detail) {
+  if (!timeTraceEnabled())
+    return;
+  sys::SmartScopedLock<true> L(*TimerLock);
+  TimeTrace->Detail = Detail;
+}
+
+static void recordTimeTraceEvent(StringRef Name, StringRef Category,
+                                 const TimeRecord &Start,
+                                 const TimeRecord &End) {
+  sys::SmartScopedLock<true> L(*TimerLock);
+  TimeTraceEvent Ev;
+  Ev.Name = Name;
+  Ev.Category = Category;
+  Ev.Detail = TimeTrace->Detail;
+  Ev.Tid = get_threadid();
+  Ev.StartWall = Start.getWallTime();
+  Ev.DurWall = End.getWallTime() - Start.getWallTime();
+  TimeTrace->Events.push_back(std::move(Ev));
+}
+
+static void writeJSONString(raw_ostream &OS, StringRef S) {
+  OS << '"';
+  for (unsigned char C : S) {
+    if (C == '"' || C == '\\')
+      OS << '\\' << (char)C;
+    else if (C < 0x20)
+      OS << format("\\u%04x", (unsigned)C);
+    else
+      OS << (char)C;
+  }
+  OS << '"';
+}
+
+void TimeTraceState::write() {
+  if (Events.empty() || TimeTraceJSONFilename.empty())
+    return;
+
+  std::error_code EC;
+  raw_fd_ostream OS(TimeTraceJSONFilename, EC, sys::fs::F_Text);
+  if (EC) {
+    errs() << "Error opening time-trace-json file '" << TimeTraceJSONFilename
+           << "': " << EC.message() << "\n";
+    return;
+  }
+
+  // Offset the timestamps so the trace starts at zero.
+  double Origin = Events.front().StartWall;
+  for (const TimeTraceEvent &Ev : Events)
+    if (Ev.StartWall < Origin)
+      Origin = Ev.StartWall;
+
+  // Emit complete ("ph":"X") events with microsecond timestamps, one per
+  // line.  Trace viewers reconstruct the flame-graph nesting from the
+  // timestamps.
+  OS << "{\"traceEvents\":[\n";
+  const char *delim = "";
+  for (const TimeTraceEvent &Ev : Events) {
+    OS << delim;
+    delim = ",\n";
+    OS << "{\"ph\":\"X\",\"pid\":1,\"tid\":" << Ev.Tid << ','
+       << format("\"ts\":%.3f,\"dur\":%.3f,", (Ev.StartWall - Origin) * 1e6,
+                 Ev.DurWall * 1e6)
+       << "\"name\":";
+    writeJSONString(OS, Ev.Name);
+    OS << ",\"cat\":";
+    writeJSONString(OS, Ev.Category);
+    if (!Ev.Detail.empty()) {
+      OS << ",\"args\":{\"detail\":";
+      writeJSONString(OS, Ev.Detail);
+      OS << '}';
+    }
+    OS << '}';
+  }
+  OS << "\n]}\n";
+}
+
 //===----------------------------------------------------------------------===//
 // Timer Implementation
 //===----------------------------------------------------------------------===//
@@ -133,8 +251,11 @@ void Timer::startTimer() {
 void Timer::stopTimer() {
   assert(Running && "Cannot stop a paused timer");
   Running = false;
-  Time += TimeRecord::getCurrentTime(false);
+  TimeRecord Now = TimeRecord::getCurrentTime(false);
+  Time += Now;
   Time -= StartTime;
+  if (timeTraceEnabled())
+    recordTimeTraceEvent(Description, TG->Name, StartTime, Now);
 }
 
 void Timer::clear() {
@@ -191,7 +312,14 @@ public:
     if (!GroupEntry.first)
       GroupEntry.first = new TimerGroup(GroupName, GroupDescription);
 
-    Timer &T = GroupEntry.second[Name];
+    // Timers are not internally synchronized, so a shared instance would race
+    // when parallel backends time the same region.  Give each thread its own
+    // instance instead: it accumulates without synchronization, and the
+    // instances are merged by name when the group is printed.
+    SmallString<64> Key(Name);
+    raw_svector_ostream(Key) << '#' << get_threadid();
+
+    Timer &T = GroupEntry.second[Key];
     if (!T.isInitialized())
       T.init(Name, Description, *GroupEntry.first);
     return T;
@@ -277,7 +405,30 @@ void TimerGroup::addTimer(Timer &T) {
   FirstTimer = &T;
 }
 
+/// Fold the records of per-thread timer instances together: all records with
+/// the same name are reported as a single entry.
+void TimerGroup::mergePrintRecords() {
+  if (TimersToPrint.empty())
+    return;
+
+  std::stable_sort(TimersToPrint.begin(), TimersToPrint.end(),
+                   [](const PrintRecord &LHS, const PrintRecord &RHS) {
+                     return LHS.Name < RHS.Name;
+                   });
+
+  auto Out = TimersToPrint.begin();
+  for (auto I = Out + 1, E = TimersToPrint.end(); I != E; ++I) {
+    if (I->Name == Out->Name)
+      Out->Time += I->Time;
+    else
+      *++Out = std::move(*I);
+  }
+  TimersToPrint.erase(Out + 1, TimersToPrint.end());
+}
+
 void TimerGroup::PrintQueuedTimers(raw_ostream &OS) {
+  mergePrintRecords();
+
   // Sort the timers in descending order by amount of time taken.
   std::sort(TimersToPrint.begin(), TimersToPrint.end());
 
@@ -364,6 +515,7 @@ void TimerGroup::printJSONValue(raw_ostream &OS, const PrintRecord &R,
 
 const char *TimerGroup::printJSONValues(raw_ostream &OS, const char *delim) {
   prepareToPrintList();
+  mergePrintRecords();
   for (const PrintRecord &R : TimersToPrint) {
     OS << delim;
     delim = ",\n";
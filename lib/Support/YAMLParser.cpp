@@ -785,7 +785,10 @@ Token &Scanner::peekNext() {
 }
 
 Token Scanner::getNext() {
-  Token Ret = peekNext();
+  // Tokens are consumed exactly once, so take the value out of the queue
+  // rather than copying it; this matters for block scalars, whose value can
+  // be arbitrarily large.
+  Token Ret = std::move(peekNext());
   // TokenQueue can be empty if there was an error getting the next token.
   if (!TokenQueue.empty())
     TokenQueue.pop_front();
@@ -1612,7 +1615,7 @@ bool Scanner::scanBlockScalar(bool IsLiteral) {
   T.Kind = Token::TK_BlockScalar;
   T.Range = StringRef(Start, Current - Start);
   T.Value = Str.str().str();
-  TokenQueue.push_back(T);
+  TokenQueue.push_back(std::move(T));
   return true;
 }
 
@@ -345,8 +345,9 @@ std::unique_ptr<Input::HNode> Input::createHNodes(Node *N) {
     }
     return llvm::make_unique<ScalarHNode>(N, KeyStr);
   } else if (BlockScalarNode *BSN = dyn_cast<BlockScalarNode>(N)) {
-    StringRef ValueCopy = BSN->getValue().copy(StringAllocator);
-    return llvm::make_unique<ScalarHNode>(N, ValueCopy);
+    // The value already lives in the document's allocator, which outlives
+    // the HNodes, so there is no need to copy it again.
+    return llvm::make_unique<ScalarHNode>(N, BSN->getValue());
   } else if (SequenceNode *SQ = dyn_cast<SequenceNode>(N)) {
     auto SQHNode = llvm::make_unique<SequenceHNode>(N);
     for (Node &SN : *SQ) {
@@ -0,0 +1,147 @@
+//===- raw_async_fd_ostream.cpp - Write-behind file stream ----------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+//
+// This implements the write-behind file stream. The producer fills pooled
+// buffers and hands them to a worker thread that performs the actual write(2)
+// calls through an unbuffered raw_fd_ostream.
+//
+//===----------------------------------------------------------------------===//
+
+#include "llvm/Support/raw_async_fd_ostream.h"
+#include "llvm/Config/llvm-config.h"
+
+using namespace llvm;
+
+// With one buffer being filled, one being written and a little slack, four
+// buffers are enough to keep both the producer and the disk busy.
+static const unsigned MaxBuffers = 4;
+
+// Large enough that the worker spends its time in write(2) rather than in
+// synchronization with the producer.
+static const size_t AsyncBufferSize = 1 << 20;
+
+raw_async_fd_ostream::raw_async_fd_ostream(StringRef Filename,
+                                           std::error_code &EC,
+                                           sys::fs::OpenFlags Flags)
+    : FDS(Filename, EC, Flags) {
+  FDS.SetUnbuffered();
+#if LLVM_ENABLE_THREADS
+  if (!EC)
+    Writer = std::thread(&raw_async_fd_ostream::writerLoop, this);
+#endif
+}
+
+raw_async_fd_ostream::raw_async_fd_ostream(int fd, bool shouldClose)
+    : FDS(fd, shouldClose, /*unbuffered=*/true) {
+#if LLVM_ENABLE_THREADS
+  Writer = std::thread(&raw_async_fd_ostream::writerLoop, this);
+#endif
+}
+
+raw_async_fd_ostream::~raw_async_fd_ostream() {
+  flush();
+  shutdownWriter();
+  // ~raw_fd_ostream closes the descriptor and reports any pending error.
+}
+
+void raw_async_fd_ostream::writerLoop() {
+  std::unique_lock<std::mutex> Lock(Mutex);
+  while (true) {
+    WorkAvailable.wait(Lock,
+                       [this] { return ShuttingDown || !Queue.empty(); });
+    if (Queue.empty())
+      return; // Only reachable on shutdown with a drained queue.
+
+    std::unique_ptr<std::vector<char>> Buf = std::move(Queue.front());
+    Queue.pop_front();
+    Lock.unlock();
+
+    FDS.write(Buf->data(), Buf->size());
+
+    Lock.lock();
+    FreeBuffers.push_back(std::move(Buf));
+    --PendingWrites;
+    WriteRetired.notify_all();
+  }
+}
+
+void raw_async_fd_ostream::write_impl(const char *Ptr, size_t Size) {
+  pos += Size;
+
+  // Threading disabled, or the stream failed to open: write synchronously.
+  if (!Writer.joinable()) {
+    FDS.write(Ptr, Size);
+    return;
+  }
+
+  std::unique_ptr<std::vector<char>> Buf;
+  {
+    std::unique_lock<std::mutex> Lock(Mutex);
+    // Back-pressure: once the pool is exhausted, block until the worker
+    // retires a write and returns its buffer.
+    WriteRetired.wait(Lock, [this] {
+      return !FreeBuffers.empty() || NumBuffers < MaxBuffers;
+    });
+    if (!FreeBuffers.empty()) {
+      Buf = std::move(FreeBuffers.back());
+      FreeBuffers.pop_back();
+    } else {
+      ++NumBuffers;
+    }
+  }
+  if (!Buf) {
+    Buf.reset(new std::vector<char>());
+    Buf->reserve(AsyncBufferSize);
+  }
+  Buf->assign(Ptr, Ptr + Size);
+
+  {
+    std::lock_guard<std::mutex> Lock(Mutex);
+    Queue.push_back(std::move(Buf));
+    ++PendingWrites;
+  }
+  WorkAvailable.notify_one();
+}
+
+void raw_async_fd_ostream::pwrite_impl(const char *Ptr, size_t Size,
+                                       uint64_t Offset) {
+  // The region being patched may still be sitting in our buffer or in the
+  // queue; push everything to the descriptor before seeking backwards.
+  flush();
+  drain();
+  FDS.pwrite(Ptr, Size, Offset);
+}
+
+size_t raw_async_fd_ostream::preferred_buffer_size() const {
+  return AsyncBufferSize;
+}
+
+void raw_async_fd_ostream::drain() {
+  if (!Writer.joinable())
+    return;
+  std::unique_lock<std::mutex> Lock(Mutex);
+  WriteRetired.wait(Lock, [this] { return PendingWrites == 0; });
+}
+
+void raw_async_fd_ostream::shutdownWriter() {
+  if (!Writer.joinable())
+    return;
+  {
+    std::lock_guard<std::mutex> Lock(Mutex);
+    ShuttingDown = true;
+  }
+  WorkAvailable.notify_one();
+  Writer.join();
+}
+
+void raw_async_fd_ostream::close() {
+  flush();
+  shutdownWriter();
+  FDS.close();
+}
@@ -132,6 +132,13 @@ public:
                             const MCRelaxableFragment *DF,
                             const MCAsmLayout &Layout) const override;
 
+  bool fixupValueNeedsRelaxation(const MCFixup &Fixup,
+                                 uint64_t Value) const override {
+    // Same criterion as fixupNeedsRelaxation, which doesn't look at the
+    // fragment or layout either.
+    return int64_t(Value) != int64_t(int8_t(Value));
+  }
+
   void relaxInstruction(const MCInst &Inst, const MCSubtargetInfo &STI,
                         MCInst &Res) const override;
 
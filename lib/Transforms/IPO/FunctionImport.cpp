@@ -28,10 +28,17 @@
 #include "llvm/Object/ModuleSummaryIndexObjectFile.h"
 #include "llvm/Support/CommandLine.h"
 #include "llvm/Support/Debug.h"
+#include "llvm/Support/FileSystem.h"
+#include "llvm/Support/Format.h"
+#include "llvm/Support/MemoryBuffer.h"
 #include "llvm/Support/SourceMgr.h"
+#include "llvm/Support/ThreadPool.h"
 #include "llvm/Transforms/IPO/Internalize.h"
 #include "llvm/Transforms/Utils/FunctionImportUtils.h"
 
+#include <mutex>
+#include <thread>
+
 #define DEBUG_TYPE "function-import"
 
 using namespace llvm;
@@ -75,6 +82,11 @@ static cl::opt<bool> PrintImports("print-imports", cl::init(false), cl::Hidden,
 static cl::opt<bool> ComputeDead("compute-dead", cl::init(true), cl::Hidden,
                                  cl::desc("Compute dead symbols"));
 
+static cl::opt<unsigned> ComputeDeadParallelThreshold(
+    "compute-dead-parallel-threshold", cl::init(1 << 16), cl::Hidden,
+    cl::desc("Propagate liveness over the combined index on parallel workers "
+             "when it has at least this many entries (0 disables)"));
+
 static cl::opt<bool> EnableImportMetadata(
     "enable-import-metadata", cl::init(
 #if !defined(NDEBUG)
@@ -85,6 +97,12 @@ static cl::opt<bool> EnableImportMetadata(
                                   ),
     cl::Hidden, cl::desc("Enable import metadata like 'thinlto_src_module'"));
 
+static cl::opt<std::string> ImportCacheFile(
+    "import-cache-file", cl::init(""), cl::Hidden, cl::value_desc("filename"),
+    cl::desc("Persist import decisions keyed on module hashes, and reuse them "
+             "on the next link for modules whose import neighborhood did not "
+             "change"));
+
 // Load lazily a module from \p FileName in \p Context.
 static std::unique_ptr<Module> loadFile(const std::string &FileName,
                                         LLVMContext &Context) {
@@ -346,6 +364,140 @@ static void ComputeImportForModule(
   }
 }
 
+/// In-memory form of one module's entry in the import-decision cache.
+struct ImportCacheEntry {
+  ModuleHash Hash;
+  FunctionImporter::ImportMapTy ImportList;
+};
+
+typedef StringMap<ImportCacheEntry> ImportCacheTy;
+
+/// Parse a module hash in the fixed-width hex form used by the cache file.
+static bool parseImportCacheHash(StringRef Str, ModuleHash &Hash) {
+  if (Str.size() != 40)
+    return false;
+  for (unsigned I = 0; I != 5; ++I)
+    if (Str.substr(I * 8, 8).getAsInteger(16, Hash[I]))
+      return false;
+  return true;
+}
+
+/// Parse the import-decision cache from \p Buffer. The format is
+/// line-oriented:
+///
+///   ThinLTO-Import-Cache-v1
+///   module <hash> <path>
+///   from <path>
+///   <guid> <threshold>
+///
+/// A malformed or wrong-version buffer leaves \p Cache empty: a stale cache
+/// merely disables reuse.
+static bool parseImportCache(StringRef Buffer, ImportCacheTy &Cache) {
+  SmallVector<StringRef, 64> Lines;
+  Buffer.split(Lines, '\n');
+  auto Fail = [&Cache]() -> bool {
+    Cache.clear();
+    return false;
+  };
+  if (Lines.empty() || Lines[0] != "ThinLTO-Import-Cache-v1")
+    return Fail();
+  ImportCacheEntry *CurModule = nullptr;
+  FunctionImporter::FunctionsToImportTy *CurImports = nullptr;
+  for (StringRef Line : makeArrayRef(Lines).slice(1)) {
+    if (Line.empty())
+      continue;
+    if (Line.startswith("module ")) {
+      StringRef Rest = Line.drop_front(strlen("module "));
+      StringRef HashStr;
+      std::tie(HashStr, Rest) = Rest.split(' ');
+      ModuleHash Hash;
+      if (!parseImportCacheHash(HashStr, Hash) || Rest.empty())
+        return Fail();
+      CurModule = &Cache[Rest];
+      CurModule->Hash = Hash;
+      CurImports = nullptr;
+      continue;
+    }
+    if (Line.startswith("from ")) {
+      StringRef Path = Line.drop_front(strlen("from "));
+      if (!CurModule || Path.empty())
+        return Fail();
+      CurImports = &CurModule->ImportList[Path];
+      continue;
+    }
+    StringRef GUIDStr, ThresholdStr;
+    std::tie(GUIDStr, ThresholdStr) = Line.split(' ');
+    GlobalValue::GUID GUID;
+    unsigned Threshold;
+    if (!CurImports || GUIDStr.getAsInteger(10, GUID) ||
+        ThresholdStr.getAsInteger(10, Threshold) || !Threshold)
+      return Fail();
+    (*CurImports)[GUID] = Threshold;
+  }
+  return true;
+}
+
+/// Write the current import decisions to the cache file, keyed on the modules'
+/// hashes from the summary index.
+static void
+writeImportCache(const ModuleSummaryIndex &Index,
+                 const StringMap<FunctionImporter::ImportMapTy> &ImportLists) {
+  std::error_code EC;
+  raw_fd_ostream OS(ImportCacheFile, EC, sys::fs::F_Text);
+  if (EC) {
+    errs() << "function-import: cannot write import cache file '"
+           << ImportCacheFile << "': " << EC.message() << "\n";
+    return;
+  }
+  OS << "ThinLTO-Import-Cache-v1\n";
+  for (auto &ModuleImports : ImportLists) {
+    auto MPI = Index.modulePaths().find(ModuleImports.first());
+    if (MPI == Index.modulePaths().end())
+      continue;
+    OS << "module ";
+    for (uint32_t V : MPI->second.second)
+      OS << format_hex_no_prefix(V, 8);
+    OS << ' ' << ModuleImports.first() << '\n';
+    for (auto &Src : ModuleImports.second) {
+      OS << "from " << Src.first() << '\n';
+      for (auto &F : Src.second)
+        OS << F.first << ' ' << F.second << '\n';
+    }
+  }
+}
+
+/// Reconstruct the contributions a cached import list \p Imports makes to the
+/// export list of its source module \p ExportModulePath, mirroring what
+/// computeImportForFunction records when the decisions are computed from
+/// scratch. The list is over-approximate in the same way: referenced GUIDs
+/// not defined in the source module are pruned by the caller in one pass.
+static void
+addCachedExports(const ModuleSummaryIndex &Index, StringRef ExportModulePath,
+                 const FunctionImporter::FunctionsToImportTy &Imports,
+                 FunctionImporter::ExportSetTy &ExportList) {
+  for (auto &ImportedGV : Imports) {
+    GlobalValue::GUID GUID = ImportedGV.first;
+    ExportList.insert(GUID);
+    auto SummaryList = Index.findGlobalValueSummaryList(GUID);
+    if (SummaryList == Index.end())
+      continue;
+    for (auto &SummaryPtr : SummaryList->second) {
+      auto *GVSummary = SummaryPtr.get();
+      if (auto *AS = dyn_cast<AliasSummary>(GVSummary))
+        GVSummary = &AS->getAliasee();
+      if (GVSummary->modulePath() != ExportModulePath)
+        continue;
+      if (auto *FS = dyn_cast<FunctionSummary>(GVSummary)) {
+        for (auto &Edge : FS->calls())
+          ExportList.insert(Edge.first.getGUID());
+        for (auto &Ref : FS->refs())
+          ExportList.insert(Ref.getGUID());
+      }
+      break;
+    }
+  }
+}
+
 } // anonymous namespace
 
 /// Compute all the import and export for every module using the Index.
@@ -355,15 +507,64 @@ void llvm::ComputeCrossModuleImport(
     StringMap<FunctionImporter::ImportMapTy> &ImportLists,
     StringMap<FunctionImporter::ExportSetTy> &ExportLists,
     const DenseSet<GlobalValue::GUID> *DeadSymbols) {
+  // When incremental linking, load the decisions persisted by the previous
+  // link so that modules whose import neighborhood did not change can skip
+  // the (expensive) recomputation below.
+  ImportCacheTy Cache;
+  if (!ImportCacheFile.empty())
+    if (auto BufferOrErr = MemoryBuffer::getFile(ImportCacheFile))
+      parseImportCache((*BufferOrErr)->getBuffer(), Cache);
+
+  // Whether \p Path has a cache entry recorded under the same (non-null) hash
+  // the summary index has for it now.
+  auto IsUnchangedModule = [&](StringRef Path) -> bool {
+    auto CacheIt = Cache.find(Path);
+    if (CacheIt == Cache.end())
+      return false;
+    auto PathIt = Index.modulePaths().find(Path);
+    const ModuleHash NullHash = {{0}};
+    return PathIt != Index.modulePaths().end() &&
+           PathIt->second.second != NullHash &&
+           PathIt->second.second == CacheIt->second.Hash;
+  };
+
   // For each module that has function defined, compute the import/export lists.
   for (auto &DefinedGVSummaries : ModuleToDefinedGVSummaries) {
-    auto &ImportList = ImportLists[DefinedGVSummaries.first()];
-    DEBUG(dbgs() << "Computing import for Module '"
-                 << DefinedGVSummaries.first() << "'\n");
+    StringRef ModName = DefinedGVSummaries.first();
+    auto &ImportList = ImportLists[ModName];
+    // A module's import decisions depend only on its own summaries and on
+    // those of the modules it (transitively) imports from, which the import
+    // list already closes over. If none of them changed, reuse the cached
+    // decisions and reconstruct their export-list contributions; the cached
+    // decisions stay valid (though a changed module elsewhere could have made
+    // additional symbols importable, missing those only costs optimization).
+    if (IsUnchangedModule(ModName)) {
+      ImportCacheEntry &Cached = Cache[ModName];
+      bool Reusable = true;
+      for (auto &Src : Cached.ImportList)
+        if (!IsUnchangedModule(Src.first())) {
+          Reusable = false;
+          break;
+        }
+      if (Reusable) {
+        DEBUG(dbgs() << "Reusing cached import for Module '" << ModName
+                     << "'\n");
+        ImportList = Cached.ImportList;
+        for (auto &Src : ImportList)
+          addCachedExports(Index, Src.first(), Src.second,
+                           ExportLists[Src.first()]);
+        continue;
+      }
+    }
+    DEBUG(dbgs() << "Computing import for Module '" << ModName << "'\n");
     ComputeImportForModule(DefinedGVSummaries.second, Index, ImportList,
                            &ExportLists, DeadSymbols);
   }
 
+  // Persist the (possibly partially reused) decisions for the next link.
+  if (!ImportCacheFile.empty())
+    writeImportCache(Index, ImportLists);
+
   // When computing imports we added all GUIDs referenced by anything
   // imported from the module to its ExportList. Now we prune each ExportList
   // of any not defined in that module. This is more efficient than checking
@@ -423,6 +624,104 @@ void llvm::ComputeCrossModuleImportForModule(
 #endif
 }
 
+/// Invoke \p Mark on the GUID of every symbol referenced, called or aliased
+/// by the summaries for \p GUID.
+template <typename CallbackTy>
+static void forEachSummaryEdge(const ModuleSummaryIndex &Index,
+                               GlobalValue::GUID GUID, CallbackTy Mark) {
+  auto It = Index.findGlobalValueSummaryList(GUID);
+  if (It == Index.end()) {
+    DEBUG(dbgs() << "Not in index: " << GUID << "\n");
+    return;
+  }
+
+  // FIXME: we should only make the prevailing copy live here
+  for (auto &Summary : It->second) {
+    for (auto Ref : Summary->refs())
+      Mark(Ref.getGUID());
+    if (auto *FS = dyn_cast<FunctionSummary>(Summary.get()))
+      for (auto Call : FS->calls())
+        Mark(Call.first.getGUID());
+    if (auto *AS = dyn_cast<AliasSummary>(Summary.get()))
+      Mark(AS->getAliasee().getOriginalName());
+  }
+}
+
+namespace {
+
+/// Set of live GUIDs sharded by their low bits, so that parallel liveness
+/// workers contend on one shard at a time rather than on the whole set.
+/// GUIDs are MD5-based, so the low bits shard evenly.
+class ShardedGUIDSet {
+  enum { NumShards = 256 };
+
+  struct Shard {
+    std::mutex Lock;
+    DenseSet<GlobalValue::GUID> Set;
+  };
+  std::unique_ptr<Shard[]> Shards;
+
+public:
+  ShardedGUIDSet() : Shards(new Shard[NumShards]) {}
+
+  /// Thread safe; returns true if \p GUID was not yet in the set.
+  bool insert(GlobalValue::GUID GUID) {
+    Shard &S = Shards[GUID & (NumShards - 1)];
+    std::lock_guard<std::mutex> Guard(S.Lock);
+    return S.Set.insert(GUID).second;
+  }
+
+  /// Unsynchronized; only valid once the workers have been joined.
+  bool count(GlobalValue::GUID GUID) const {
+    return Shards[GUID & (NumShards - 1)].Set.count(GUID);
+  }
+
+  size_t size() const {
+    size_t Size = 0;
+    for (unsigned I = 0; I != NumShards; ++I)
+      Size += Shards[I].Set.size();
+    return Size;
+  }
+};
+
+} // anonymous namespace
+
+/// Propagate liveness from \p Frontier over the whole index on a thread
+/// pool, level-synchronously: each round the current frontier is split into
+/// chunks whose edges are marked in parallel, and the newly live symbols
+/// form the next frontier.
+static void propagateLivenessParallel(const ModuleSummaryIndex &Index,
+                                      ShardedGUIDSet &LiveSymbols,
+                                      std::vector<GlobalValue::GUID> Frontier) {
+  ThreadPool Pool;
+  while (!Frontier.empty()) {
+    size_t ChunkSize = std::max<size_t>(
+        1024,
+        Frontier.size() / (4 * std::thread::hardware_concurrency() + 1));
+    size_t NumChunks = (Frontier.size() + ChunkSize - 1) / ChunkSize;
+    std::vector<std::vector<GlobalValue::GUID>> NextChunks(NumChunks);
+
+    for (size_t I = 0; I != NumChunks; ++I) {
+      GlobalValue::GUID *Begin = Frontier.data() + I * ChunkSize;
+      GlobalValue::GUID *End =
+          Frontier.data() + std::min(Frontier.size(), (I + 1) * ChunkSize);
+      std::vector<GlobalValue::GUID> &Next = NextChunks[I];
+      Pool.async([&Index, &LiveSymbols, &Next, Begin, End] {
+        for (GlobalValue::GUID *GUID = Begin; GUID != End; ++GUID)
+          forEachSummaryEdge(Index, *GUID, [&](GlobalValue::GUID EdgeGUID) {
+            if (LiveSymbols.insert(EdgeGUID))
+              Next.push_back(EdgeGUID);
+          });
+      });
+    }
+    Pool.wait();
+
+    Frontier.clear();
+    for (std::vector<GlobalValue::GUID> &Next : NextChunks)
+      Frontier.insert(Frontier.end(), Next.begin(), Next.end());
+  }
+}
+
 DenseSet<GlobalValue::GUID> llvm::computeDeadSymbols(
     const ModuleSummaryIndex &Index,
     const DenseSet<GlobalValue::GUID> &GUIDPreservedSymbols) {
@@ -451,55 +750,49 @@ DenseSet<GlobalValue::GUID> llvm::computeDeadSymbols(
     Worklist.push_back(Entry.first);
   }
 
-  while (!Worklist.empty()) {
-    auto GUID = Worklist.pop_back_val();
-    auto It = Index.findGlobalValueSummaryList(GUID);
-    if (It == Index.end()) {
-      DEBUG(dbgs() << "Not in index: " << GUID << "\n");
-      continue;
-    }
-
-    // FIXME: we should only make the prevailing copy live here
-    for (auto &Summary : It->second) {
-      for (auto Ref : Summary->refs()) {
-        auto RefGUID = Ref.getGUID();
-        if (LiveSymbols.insert(RefGUID).second) {
-          DEBUG(dbgs() << "Marking live (ref): " << RefGUID << "\n");
-          Worklist.push_back(RefGUID);
-        }
-      }
-      if (auto *FS = dyn_cast<FunctionSummary>(Summary.get())) {
-        for (auto Call : FS->calls()) {
-          auto CallGUID = Call.first.getGUID();
-          if (LiveSymbols.insert(CallGUID).second) {
-            DEBUG(dbgs() << "Marking live (call): " << CallGUID << "\n");
-            Worklist.push_back(CallGUID);
-          }
+  // Large indexes propagate liveness on a thread pool; the reachable set is
+  // identical either way.
+  const bool Parallel = ComputeDeadParallelThreshold &&
+                        Index.size() >= ComputeDeadParallelThreshold &&
+                        std::thread::hardware_concurrency() > 1;
+  ShardedGUIDSet ShardedLiveSymbols;
+  if (Parallel) {
+    for (auto GUID : LiveSymbols)
+      ShardedLiveSymbols.insert(GUID);
+    propagateLivenessParallel(
+        Index, ShardedLiveSymbols,
+        std::vector<GlobalValue::GUID>(Worklist.begin(), Worklist.end()));
+  } else {
+    while (!Worklist.empty()) {
+      auto GUID = Worklist.pop_back_val();
+      forEachSummaryEdge(Index, GUID, [&](GlobalValue::GUID EdgeGUID) {
+        if (LiveSymbols.insert(EdgeGUID).second) {
+          DEBUG(dbgs() << "Marking live: " << EdgeGUID << "\n");
+          Worklist.push_back(EdgeGUID);
         }
-      }
-      if (auto *AS = dyn_cast<AliasSummary>(Summary.get())) {
-        auto AliaseeGUID = AS->getAliasee().getOriginalName();
-        if (LiveSymbols.insert(AliaseeGUID).second) {
-          DEBUG(dbgs() << "Marking live (alias): " << AliaseeGUID << "\n");
-          Worklist.push_back(AliaseeGUID);
-        }
-      }
+      });
     }
   }
+
+  auto IsLive = [&](GlobalValue::GUID GUID) {
+    return Parallel ? ShardedLiveSymbols.count(GUID) != 0
+                    : LiveSymbols.count(GUID) != 0;
+  };
+  size_t NumLive = Parallel ? ShardedLiveSymbols.size() : LiveSymbols.size();
+
   DenseSet<GlobalValue::GUID> DeadSymbols;
-  DeadSymbols.reserve(
-      std::min(Index.size(), Index.size() - LiveSymbols.size()));
+  DeadSymbols.reserve(std::min(Index.size(), Index.size() - NumLive));
   for (auto &Entry : Index) {
     auto GUID = Entry.first;
-    if (!LiveSymbols.count(GUID)) {
+    if (!IsLive(GUID)) {
       DEBUG(dbgs() << "Marking dead: " << GUID << "\n");
       DeadSymbols.insert(GUID);
     }
   }
-  DEBUG(dbgs() << LiveSymbols.size() << " symbols Live, and "
-               << DeadSymbols.size() << " symbols Dead \n");
+  DEBUG(dbgs() << NumLive << " symbols Live, and " << DeadSymbols.size()
+               << " symbols Dead \n");
   NumDeadSymbols += DeadSymbols.size();
-  NumLiveSymbols += LiveSymbols.size();
+  NumLiveSymbols += NumLive;
   return DeadSymbols;
 }
 
@@ -668,11 +961,15 @@ Expected<bool> FunctionImporter::importFunctions(
   unsigned ImportedCount = 0;
 
   IRMover Mover(DestModule);
-  // Do the actual import of functions now, one Module at a time
-  std::set<StringRef> ModuleNameOrderedList;
-  for (auto &FunctionsToImportPerModule : ImportList) {
-    ModuleNameOrderedList.insert(FunctionsToImportPerModule.first());
-  }
+  // Do the actual import of functions now, one Module at a time. The source
+  // module count is known from the import list, so gather the names into a
+  // pre-sized vector and sort it rather than paying a node allocation per
+  // module for an ordered set.
+  SmallVector<StringRef, 8> ModuleNameOrderedList;
+  ModuleNameOrderedList.reserve(ImportList.size());
+  for (auto &FunctionsToImportPerModule : ImportList)
+    ModuleNameOrderedList.push_back(FunctionsToImportPerModule.first());
+  std::sort(ModuleNameOrderedList.begin(), ModuleNameOrderedList.end());
   for (auto &Name : ModuleNameOrderedList) {
     // Get the module for the import
     const auto &FunctionsToImportPerModule = ImportList.find(Name);
@@ -690,8 +987,11 @@ Expected<bool> FunctionImporter::importFunctions(
       return std::move(Err);
 
     auto &ImportGUIDs = FunctionsToImportPerModule->second;
-    // Find the globals to import
+    // Find the globals to import. The import list bounds the result size
+    // (aliases can pull in their aliasee on top of it), so size the set once
+    // up front instead of growing it a doubling at a time.
     SetVector<GlobalValue *> GlobalsToImport;
+    GlobalsToImport.reserve(ImportGUIDs.size());
     for (Function &F : *SrcModule) {
       if (!F.hasName())
         continue;
@@ -504,6 +504,19 @@ inlineCallsImpl(CallGraphSCC &SCC, CallGraph &CG,
   InlinedArrayAllocasTy InlinedArrayAllocas;
   InlineFunctionInfo InlineInfo(&CG, &GetAssumptionCache);
 
+  // The cost analysis for a call site depends only on the bodies of its
+  // caller and callee and on the set of calls to the caller (through the
+  // deferred-inlining heuristic).  Each round of the loop below typically
+  // modifies only a few functions, so record a generation per function,
+  // bumped whenever its body or user set changes, and remember when each
+  // rejected call site was last analyzed.  A call site whose dependencies
+  // are unchanged since it was last rejected cannot become inlinable and is
+  // skipped without re-running the analysis.
+  unsigned CurrentGen = 1;
+  DenseMap<Function *, unsigned> FunctionGen;
+  DenseMap<Instruction *, unsigned> LastAnalyzedGen;
+  auto MarkModified = [&](Function *F) { FunctionGen[F] = ++CurrentGen; };
+
   // Now that we have all of the call sites, loop over them and inline them if
   // it looks profitable to do so.
   bool Changed = false;
@@ -526,6 +539,11 @@ inlineCallsImpl(CallGraphSCC &SCC, CallGraph &CG,
       if (isInstructionTriviallyDead(CS.getInstruction(), &TLI)) {
         DEBUG(dbgs() << "    -> Deleting dead call: " << *CS.getInstruction()
                      << "\n");
+        // The caller's body changes and the called function loses a user.
+        MarkModified(Caller);
+        if (Function *DeadCallee = CS.getCalledFunction())
+          MarkModified(DeadCallee);
+        LastAnalyzedGen.erase(CS.getInstruction());
         // Update the call graph by deleting the edge from Callee to Caller.
         CG[Caller]->removeCallEdgeFor(CS);
         CS.getInstruction()->eraseFromParent();
@@ -545,8 +563,16 @@ inlineCallsImpl(CallGraphSCC &SCC, CallGraph &CG,
             InlineHistoryIncludes(Callee, InlineHistoryID, InlineHistory))
           continue;
 
+        // If nothing this call site's analysis depends on has changed since
+        // the analysis last rejected it, it cannot have become inlinable.
+        Instruction *Call = CS.getInstruction();
+        unsigned LastGen = LastAnalyzedGen.lookup(Call);
+        if (LastGen && FunctionGen.lookup(Caller) <= LastGen &&
+            FunctionGen.lookup(Callee) <= LastGen)
+          continue;
+
         // Get DebugLoc to report. CS will be invalid after Inliner.
-        DebugLoc DLoc = CS.getInstruction()->getDebugLoc();
+        DebugLoc DLoc = Call->getDebugLoc();
         BasicBlock *Block = CS.getParent();
         // FIXME for new PM: because of the old PM we currently generate ORE and
         // in turn BFI on demand.  With the new PM, the ORE dependency should
@@ -555,8 +581,10 @@ inlineCallsImpl(CallGraphSCC &SCC, CallGraph &CG,
 
         // If the policy determines that we should inline this function,
         // try to do so.
-        if (!shouldInline(CS, GetInlineCost, ORE))
+        if (!shouldInline(CS, GetInlineCost, ORE)) {
+          LastAnalyzedGen[Call] = CurrentGen;
           continue;
+        }
 
         // Attempt to inline the function.
         using namespace ore;
@@ -567,10 +595,17 @@ inlineCallsImpl(CallGraphSCC &SCC, CallGraph &CG,
               OptimizationRemarkMissed(DEBUG_TYPE, "NotInlined", DLoc, Block)
               << NV("Callee", Callee) << " will not be inlined into "
               << NV("Caller", Caller));
+          // Nothing was changed, so do not retry until something is.
+          LastAnalyzedGen[Call] = CurrentGen;
           continue;
         }
         ++NumInlined;
 
+        // The caller gained the callee's body and the callee lost a user.
+        MarkModified(Caller);
+        MarkModified(Callee);
+        LastAnalyzedGen.erase(Call);
+
         // Report the inline decision.
         ORE.emit(OptimizationRemark(DEBUG_TYPE, "Inlined", DLoc, Block)
                  << NV("Callee", Callee) << " inlined into "
@@ -584,8 +619,13 @@ inlineCallsImpl(CallGraphSCC &SCC, CallGraph &CG,
           int NewHistoryID = InlineHistory.size();
           InlineHistory.push_back(std::make_pair(Callee, InlineHistoryID));
 
-          for (Value *Ptr : InlineInfo.InlinedCalls)
-            CallSites.push_back(std::make_pair(CallSite(Ptr), NewHistoryID));
+          for (Value *Ptr : InlineInfo.InlinedCalls) {
+            CallSite NewCS(Ptr);
+            // The cloned call gives its called function a new user.
+            if (Function *NewCallee = NewCS.getCalledFunction())
+              MarkModified(NewCallee);
+            CallSites.push_back(std::make_pair(NewCS, NewHistoryID));
+          }
         }
       }
 
@@ -603,6 +643,12 @@ inlineCallsImpl(CallGraphSCC &SCC, CallGraph &CG,
                      << "\n");
         CallGraphNode *CalleeNode = CG[Callee];
 
+        // Deleting the body removes its calls, so every function it called
+        // loses users.
+        for (const auto &CallRecord : *CalleeNode)
+          if (Function *DeadCallee = CallRecord.second->getFunction())
+            MarkModified(DeadCallee);
+
         // Remove any call graph edges from the callee to its callees.
         CalleeNode->removeAllCalledFunctions();
 
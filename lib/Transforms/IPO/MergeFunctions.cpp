@@ -155,9 +155,8 @@ class FunctionNode {
   mutable AssertingVH<Function> F;
   FunctionComparator::FunctionHash Hash;
 public:
-  // Note the hash is recalculated potentially multiple times, but it is cheap.
-  FunctionNode(Function *F)
-    : F(F), Hash(FunctionComparator::functionHash(*F))  {}
+  FunctionNode(Function *F, FunctionComparator::FunctionHash Hash)
+    : F(F), Hash(Hash) {}
   Function *getFunc() const { return F; }
   FunctionComparator::FunctionHash getHash() const { return Hash; }
 
@@ -214,7 +213,8 @@ private:
   bool doSanityCheck(std::vector<WeakVH> &Worklist);
 
   /// Insert a ComparableFunction into the FnTree, or merge it away if it's
-  /// equal to one that's already present.
+  /// equal to one that's already present. The structural hash of NewFunction
+  /// is reused from PrecomputedHashes if it is still known to be valid.
   bool insert(Function *NewFunction);
 
   /// Remove a Function from the FnTree and queue it up for a second sweep of
@@ -270,6 +270,13 @@ private:
   // there is exactly one mapping F -> FN for each FunctionNode FN in FnTree.
   ValueMap<Function*, FnTreeType::iterator> FNodesInTree;
 
+  // Structural hashes computed by the bucketing pass in runOnModule, reused
+  // by insert() so each candidate body is only walked once. Merging rewrites
+  // call operands in the remaining candidates, which the hash is insensitive
+  // to, so the entries stay valid for the initial worklist; they are dropped
+  // before deferred (modified) functions are reprocessed.
+  DenseMap<Function *, FunctionComparator::FunctionHash> PrecomputedHashes;
+
   /// Whether or not the target supports global aliases.
   bool HasGlobalAliases;
 };
@@ -382,9 +389,10 @@ bool MergeFunctions::runOnModule(Module &M) {
     if ((I != S && std::prev(I)->first == I->first) ||
         (std::next(I) != IE && std::next(I)->first == I->first) ) {
       Deferred.push_back(WeakVH(I->second));
+      PrecomputedHashes.insert({I->second, I->first});
     }
   }
-  
+
   do {
     std::vector<WeakVH> Worklist;
     Deferred.swap(Worklist);
@@ -404,6 +412,9 @@ bool MergeFunctions::runOnModule(Module &M) {
       }
     }
     DEBUG(dbgs() << "size of FnTree: " << FnTree.size() << '\n');
+    // Anything deferred past this point has been modified since it was
+    // hashed, so its precomputed hash no longer describes its body.
+    PrecomputedHashes.clear();
   } while (!Deferred.empty());
 
   FnTree.clear();
@@ -798,8 +809,13 @@ void MergeFunctions::replaceFunctionInTree(const FunctionNode &FN,
 // Insert a ComparableFunction into the FnTree, or merge it away if equal to one
 // that was already inserted.
 bool MergeFunctions::insert(Function *NewFunction) {
+  auto HashI = PrecomputedHashes.find(NewFunction);
+  FunctionComparator::FunctionHash Hash =
+      HashI != PrecomputedHashes.end()
+          ? HashI->second
+          : FunctionComparator::functionHash(*NewFunction);
   std::pair<FnTreeType::iterator, bool> Result =
-      FnTree.insert(FunctionNode(NewFunction));
+      FnTree.insert(FunctionNode(NewFunction, Hash));
 
   if (Result.second) {
     assert(FNodesInTree.count(NewFunction) == 0);
@@ -1406,6 +1406,9 @@ bool SampleProfileLoader::doInitialization(Module &M) {
     return false;
   }
   Reader = std::move(ReaderOrErr.get());
+  // Readers that can load profiles on demand only need the profiles for the
+  // functions defined in this module.
+  Reader->collectFunctionsFrom(M);
   ProfileIsValid = (Reader->read() == sampleprof_error::success);
   return true;
 }
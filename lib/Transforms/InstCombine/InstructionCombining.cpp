@@ -87,6 +87,17 @@ static cl::opt<unsigned>
 MaxArraySize("instcombine-maxarray-size", cl::init(1024),
              cl::desc("Maximum array size considered when doing a combine"));
 
+// Off by default: the outer fixpoint loop exists because worklist change
+// propagation is known to be leaky (visitors that mutate in place and return
+// null, pre-scan folding, preconditions that look more than one use-edge
+// away), and the memo turns each leak from "caught on the next full sweep"
+// into a permanently missed combine. Keep it opt-in until the lit suite has
+// validated it.
+static cl::opt<bool>
+EnableNoChangeMemo("instcombine-no-change-memo", cl::init(false), cl::Hidden,
+                   cl::desc("Skip re-testing instructions that did not "
+                            "combine and have not changed since"));
+
 Value *InstCombiner::EmitGEPOffset(User *GEP) {
   return llvm::EmitGEPOffset(Builder, DL, GEP);
 }
@@ -2918,6 +2929,15 @@ bool InstCombiner::run() {
       }
     }
 
+    // If the instruction was already tested without finding a combine and
+    // neither it nor anything that re-adds it to the worklist has changed
+    // since, don't run it through the visitors again. This keeps repeated
+    // fixpoint iterations from re-testing the whole function against the
+    // full pattern set; the checks above still run so instructions that
+    // became dead or constant are caught.
+    if (EnableNoChangeMemo && Worklist.IsKnownNoChange(I))
+      continue;
+
     // Now that we have an instruction, try combining it to simplify it.
     Builder->SetInsertPoint(I);
     Builder->SetCurrentDebugLocation(I->getDebugLoc());
@@ -2973,6 +2993,8 @@ bool InstCombiner::run() {
         }
       }
       MadeIRChange = true;
+    } else {
+      Worklist.MarkNoChange(I);
     }
   }
 
@@ -3014,6 +3036,7 @@ static bool AddReachableCodeToWorklist(BasicBlock *BB, const DataLayout &DL,
       if (isInstructionTriviallyDead(Inst, TLI)) {
         ++NumDeadInst;
         DEBUG(dbgs() << "IC: DCE: " << *Inst << '\n');
+        ICWorklist.Remove(Inst);
         Inst->eraseFromParent();
         continue;
       }
@@ -3024,10 +3047,14 @@ static bool AddReachableCodeToWorklist(BasicBlock *BB, const DataLayout &DL,
         if (Constant *C = ConstantFoldInstruction(Inst, DL, TLI)) {
           DEBUG(dbgs() << "IC: ConstFold to: " << *C << " from: "
                        << *Inst << '\n');
+          for (User *U : Inst->users())
+            ICWorklist.InvalidateNoChange(cast<Instruction>(U));
           Inst->replaceAllUsesWith(C);
           ++NumConstProp;
-          if (isInstructionTriviallyDead(Inst, TLI))
+          if (isInstructionTriviallyDead(Inst, TLI)) {
+            ICWorklist.Remove(Inst);
             Inst->eraseFromParent();
+          }
           continue;
         }
 
@@ -3048,6 +3075,7 @@ static bool AddReachableCodeToWorklist(BasicBlock *BB, const DataLayout &DL,
                        << "\n    Old = " << *C
                        << "\n    New = " << *FoldRes << '\n');
           U = FoldRes;
+          ICWorklist.InvalidateNoChange(Inst);
           MadeIRChange = true;
         }
       }
@@ -3127,6 +3155,10 @@ combineInstructionsOverFunction(Function &F, InstCombineWorklist &Worklist,
   auto &DL = F.getParent()->getDataLayout();
   ExpensiveCombines |= EnableExpensiveCombines;
 
+  // The worklist outlives this function's fixpoint loop and the no-change
+  // memo is keyed on instruction addresses, so start it from scratch here.
+  Worklist.ResetNoChangeMemo();
+
   /// Builder - This is an IRBuilder that automatically inserts new
   /// instructions into the worklist when they are created.
   IRBuilder<TargetFolder, IRBuilderCallbackInserter> Builder(
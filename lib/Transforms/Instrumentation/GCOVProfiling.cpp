@@ -341,16 +341,13 @@ namespace {
       return ReturnBlock;
     }
 
-    std::string getEdgeDestinations() {
-      std::string EdgeDestinations;
-      raw_string_ostream EDOS(EdgeDestinations);
+    void getEdgeDestinations(raw_ostream &EDOS) {
       Function *F = Blocks.begin()->first->getParent();
       for (BasicBlock &I : *F) {
         GCOVBlock &Block = getBlock(&I);
         for (int i = 0, e = Block.OutEdges.size(); i != e; ++i)
           EDOS << Block.OutEdges[i]->Number;
       }
-      return EdgeDestinations;
     }
 
     uint32_t getFuncChecksum() {
@@ -517,9 +514,16 @@ void GCOVProfiler::emitProfileNotes() {
     if (CU->getDWOId())
       continue;
 
-    std::error_code EC;
-    raw_fd_ostream out(mangleName(CU, GCovFileType::GCNO), EC, sys::fs::F_None);
-    std::string EdgeDestinations;
+    // Build the .gcno contents in memory: the emitters below write the file
+    // four bytes at a time, and going through a file stream that way shows up
+    // in coverage-build profiles. The buffer is written out in a single call
+    // once the compile unit is complete.
+    SmallString<128> NotesBuffer;
+    NotesBuffer.reserve(64 * 1024);
+    raw_svector_ostream out(NotesBuffer);
+
+    SmallString<128> EdgeDestinations;
+    raw_svector_ostream EDOS(EdgeDestinations);
 
     unsigned FunctionIdent = 0;
     for (auto &F : M->functions()) {
@@ -573,10 +577,10 @@ void GCOVProfiler::emitProfileNotes() {
           Lines.addLine(Loc.getLine());
         }
       }
-      EdgeDestinations += Func.getEdgeDestinations();
+      Func.getEdgeDestinations(EDOS);
     }
 
-    FileChecksums.push_back(hash_value(EdgeDestinations));
+    FileChecksums.push_back(hash_value(EdgeDestinations.str()));
     out.write("oncg", 4);
     out.write(ReversedVersion, 4);
     out.write(reinterpret_cast<char*>(&FileChecksums.back()), 4);
@@ -587,7 +591,12 @@ void GCOVProfiler::emitProfileNotes() {
     }
 
     out.write("\0\0\0\0\0\0\0\0", 8);  // EOF
-    out.close();
+
+    std::error_code EC;
+    raw_fd_ostream NotesFile(mangleName(CU, GCovFileType::GCNO), EC,
+                             sys::fs::F_None);
+    NotesFile.write(NotesBuffer.data(), NotesBuffer.size());
+    NotesFile.close();
   }
 }
 
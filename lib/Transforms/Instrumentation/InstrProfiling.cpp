@@ -72,6 +72,13 @@ cl::opt<bool> DoNameCompression("enable-name-compression",
                                 cl::desc("Enable name string compression"),
                                 cl::init(true));
 
+cl::opt<bool> CacheLineAlignCounters(
+    "instrprof-cacheline-align-counters",
+    cl::desc("Align each function's counter array to a cache line so "
+             "counters of different functions never share a line under "
+             "concurrent updates"),
+    cl::init(false));
+
 cl::opt<bool> DoHashBasedCounterSplit(
     "hash-based-counter-split",
     cl::desc("Rename counter variable of a comdat function based on cfg hash"),
@@ -421,7 +428,10 @@ InstrProfiling::getOrCreateRegionCounters(InstrProfIncrementInst *Inc) {
   CounterPtr->setVisibility(NamePtr->getVisibility());
   CounterPtr->setSection(
       getInstrProfSectionName(IPSK_cnts, TT.getObjectFormat()));
-  CounterPtr->setAlignment(8);
+  // The raw profile reader reaches each counter array through the pointer in
+  // the function's data record, so padding introduced between arrays by a
+  // larger alignment is tolerated.
+  CounterPtr->setAlignment(CacheLineAlignCounters ? 64 : 8);
   CounterPtr->setComdat(ProfileVarsComdat);
 
   auto *Int8PtrTy = Type::getInt8PtrTy(Ctx);
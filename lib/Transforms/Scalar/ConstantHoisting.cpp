@@ -280,21 +280,32 @@ SmallPtrSet<Instruction *, 8> ConstantHoistingPass::findConstantInsertionPoint(
     return InsertPts;
   }
 
-  while (BBs.size() >= 2) {
-    BasicBlock *BB, *BB1, *BB2;
-    BB1 = *BBs.begin();
-    BB2 = *std::next(BBs.begin());
-    BB = DT->findNearestCommonDominator(BB1, BB2);
-    if (BB == Entry) {
-      InsertPts.insert(&Entry->front());
-      return InsertPts;
+  // The nearest common dominator of a set of blocks is the nearest common
+  // dominator of the blocks with the minimum and maximum DFS-in numbers, so
+  // once the tree carries DFS numbers (computed once per function in
+  // runImpl) a single query covers the whole use set instead of one
+  // tree walk per use.
+  BasicBlock *MinBB = nullptr, *MaxBB = nullptr;
+  unsigned MinNum = 0, MaxNum = 0;
+  for (BasicBlock *BB : BBs) {
+    unsigned Num = DT->getNode(BB)->getDFSNumIn();
+    if (!MinBB || Num < MinNum) {
+      MinBB = BB;
+      MinNum = Num;
     }
-    BBs.erase(BB1);
-    BBs.erase(BB2);
-    BBs.insert(BB);
+    if (!MaxBB || Num > MaxNum) {
+      MaxBB = BB;
+      MaxNum = Num;
+    }
+  }
+
+  BasicBlock *BB =
+      MinBB == MaxBB ? MinBB : DT->findNearestCommonDominator(MinBB, MaxBB);
+  if (BB == Entry) {
+    InsertPts.insert(&Entry->front());
+    return InsertPts;
   }
-  assert((BBs.size() == 1) && "Expected only one element.");
-  Instruction &FirstInst = (*BBs.begin())->front();
+  Instruction &FirstInst = BB->front();
   InsertPts.insert(findMatInsertPt(&FirstInst));
   return InsertPts;
 }
@@ -755,6 +766,11 @@ bool ConstantHoistingPass::runImpl(Function &Fn, TargetTransformInfo &TTI,
   if (ConstCandVec.empty())
     return false;
 
+  // findConstantInsertionPoint uses the tree's DFS numbers to answer
+  // common-dominator queries over whole use sets with a single walk. Number
+  // the tree once; the pass never changes the CFG, so the numbers stay valid.
+  DT.updateDFSNumbers();
+
   // Combine constants that can be easily materialized with an add from a common
   // base constant.
   findBaseConstants();
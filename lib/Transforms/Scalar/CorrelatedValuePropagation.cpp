@@ -12,6 +12,7 @@
 //===----------------------------------------------------------------------===//
 
 #include "llvm/Transforms/Scalar/CorrelatedValuePropagation.h"
+#include "llvm/ADT/SmallVector.h"
 #include "llvm/ADT/Statistic.h"
 #include "llvm/Analysis/AssumptionCache.h"
 #include "llvm/Analysis/GlobalsModRef.h"
@@ -101,6 +102,17 @@ static bool processPHI(PHINode *P, LazyValueInfo *LVI,
   bool Changed = false;
 
   BasicBlock *BB = P->getParent();
+
+  // Batch the block-end solves for all of the incoming values so LVI shares
+  // one solver pass across the edges instead of walking once per query.
+  SmallVector<std::pair<Value *, BasicBlock *>, 8> EdgeQueries;
+  for (unsigned i = 0, e = P->getNumIncomingValues(); i < e; ++i) {
+    Value *Incoming = P->getIncomingValue(i);
+    if (!isa<Constant>(Incoming))
+      EdgeQueries.push_back(std::make_pair(Incoming, P->getIncomingBlock(i)));
+  }
+  LVI->batchQueryValues(EdgeQueries);
+
   for (unsigned i = 0, e = P->getNumIncomingValues(); i < e; ++i) {
     Value *Incoming = P->getIncomingValue(i);
     if (isa<Constant>(Incoming)) continue;
@@ -25,6 +25,8 @@
 #include "llvm/Analysis/GlobalsModRef.h"
 #include "llvm/Analysis/MemoryBuiltins.h"
 #include "llvm/Analysis/MemoryDependenceAnalysis.h"
+#include "llvm/Analysis/MemorySSA.h"
+#include "llvm/Analysis/MemorySSAUpdater.h"
 #include "llvm/Analysis/TargetLibraryInfo.h"
 #include "llvm/Analysis/ValueTracking.h"
 #include "llvm/IR/Constants.h"
@@ -34,6 +36,7 @@
 #include "llvm/IR/GlobalVariable.h"
 #include "llvm/IR/Instructions.h"
 #include "llvm/IR/IntrinsicInst.h"
+#include "llvm/IR/ValueHandle.h"
 #include "llvm/Pass.h"
 #include "llvm/Support/CommandLine.h"
 #include "llvm/Support/Debug.h"
@@ -55,6 +58,11 @@ EnablePartialOverwriteTracking("enable-dse-partial-overwrite-tracking",
   cl::init(true), cl::Hidden,
   cl::desc("Enable partial-overwrite tracking in DSE"));
 
+static cl::opt<bool>
+EnableMemorySSA("enable-dse-memoryssa", cl::init(false), cl::Hidden,
+  cl::desc("Use MemorySSA instead of MemoryDependenceAnalysis to drive "
+           "dead store elimination"));
+
 
 //===----------------------------------------------------------------------===//
 // Helper functions
@@ -1170,14 +1178,176 @@ static bool eliminateDeadStores(Function &F, AliasAnalysis *AA,
   return MadeChange;
 }
 
+//===----------------------------------------------------------------------===//
+// MemorySSA-backed DSE
+//===----------------------------------------------------------------------===//
+
+/// Return true if it is safe to conclude that nothing observes the bytes
+/// written by \p Earlier given that \p Later completely overwrites them and
+/// is the only user of Earlier's MemoryDef.
+///
+/// The use list already guarantees no memory access between the two stores
+/// reads or clobbers the location (any such access would be a user of the
+/// def).  What remains is the possibility of leaving the function between
+/// them: either by unwinding, or by a path to the exit that bypasses the
+/// killing store.
+static bool isObservableOnUnwindOrExit(StoreInst *Earlier, StoreInst *Later,
+                                       const DataLayout &DL,
+                                       const TargetLibraryInfo *TLI) {
+  if (Earlier->getParent() == Later->getParent()) {
+    // Same block: the only way out between the two stores is a non-memory
+    // instruction that may throw (throwing calls are MemoryDefs and would
+    // show up as users of the def).
+    for (BasicBlock::iterator I = std::next(Earlier->getIterator());
+         &*I != Later; ++I)
+      if (I->mayThrow())
+        return true;
+    return false;
+  }
+
+  // Cross block: some path from Earlier may reach the function exit without
+  // executing Later, so the store is only dead if the memory it writes dies
+  // with the function: an alloca, or a noalias allocation that has not
+  // escaped (in-function reads would be users of the def).
+  const Value *Underlying =
+      GetUnderlyingObject(Earlier->getPointerOperand(), DL);
+  if (isa<AllocaInst>(Underlying))
+    return false;
+  if (isAllocLikeFn(Underlying, TLI) &&
+      !PointerMayBeCaptured(Underlying, /*ReturnCaptures=*/false,
+                            /*StoreCaptures=*/true))
+    return false;
+  return true;
+}
+
+/// Recursively delete the trivially dead instruction \p I and any operands
+/// that become dead with it, removing each deleted instruction's MemorySSA
+/// access first.  The operand chain of a dead store can contain dead
+/// non-volatile loads, which are MemoryUses, so deleting it with the plain
+/// RecursivelyDeleteTriviallyDeadInstructions would leave MemorySSA stale
+/// while the pass declares it preserved.
+static void deleteDeadInstructionMemorySSA(Instruction *I, MemorySSA *MSSA,
+                                           MemorySSAUpdater &Updater,
+                                           const TargetLibraryInfo *TLI) {
+  if (!isInstructionTriviallyDead(I, TLI))
+    return;
+
+  SmallVector<Instruction *, 16> DeadInsts;
+  DeadInsts.push_back(I);
+  do {
+    Instruction *Dead = DeadInsts.pop_back_val();
+
+    // Null out all of the instruction's operands to see if any operand
+    // becomes dead as we go.
+    for (unsigned i = 0, e = Dead->getNumOperands(); i != e; ++i) {
+      Value *OpV = Dead->getOperand(i);
+      Dead->setOperand(i, nullptr);
+      if (!OpV->use_empty())
+        continue;
+      if (Instruction *OpI = dyn_cast<Instruction>(OpV))
+        if (isInstructionTriviallyDead(OpI, TLI))
+          DeadInsts.push_back(OpI);
+    }
+
+    if (MemoryAccess *MA = MSSA->getMemoryAccess(Dead))
+      Updater.removeMemoryAccess(MA);
+    Dead->eraseFromParent();
+  } while (!DeadInsts.empty());
+}
+
+/// Eliminate dead stores using MemorySSA instead of MemoryDependenceAnalysis.
+///
+/// A store is dead when its MemoryDef has exactly one user and that user is
+/// another store that completely overwrites the location.  Because every
+/// intervening load, store, call or fence that could touch the location is a
+/// user of the def, the single-user test subsumes the capped block scans
+/// MemoryDependenceAnalysis performs, and it naturally works across basic
+/// blocks.  The number of queries scales with the number of stores rather
+/// than blocks times memory instructions.
+static bool eliminateDeadStoresMemorySSA(Function &F, AliasAnalysis *AA,
+                                         MemorySSA *MSSA,
+                                         const TargetLibraryInfo *TLI) {
+  const DataLayout &DL = F.getParent()->getDataLayout();
+  MemorySSAUpdater Updater(MSSA);
+  bool MadeChange = false;
+
+  // Visit blocks in reverse and instructions bottom-up so that chains of
+  // dead stores (A killed by B killed by C) are collected in one sweep.
+  SmallVector<StoreInst *, 16> DeadStores;
+  for (BasicBlock &BB : reverse(F)) {
+    for (Instruction &I : reverse(BB)) {
+      auto *SI = dyn_cast<StoreInst>(&I);
+      if (!SI || !SI->isUnordered())
+        continue;
+
+      MemoryUseOrDef *Def = MSSA->getMemoryAccess(SI);
+      if (!Def || !Def->hasOneUse())
+        continue;
+
+      // The sole user must be a later store that completely shadows us.
+      // MemoryPhi or MemoryUse users mean the location may be read.
+      auto *KillingDef = dyn_cast<MemoryDef>(Def->user_back());
+      if (!KillingDef)
+        continue;
+      auto *Later = dyn_cast_or_null<StoreInst>(KillingDef->getMemoryInst());
+      if (!Later || !Later->isUnordered())
+        continue;
+
+      int64_t EarlierOff = 0, LaterOff = 0;
+      InstOverlapIntervalsTy IOL;
+      if (isOverwrite(MemoryLocation::get(Later), MemoryLocation::get(SI), DL,
+                      *TLI, EarlierOff, LaterOff, SI, IOL) != OW_Complete)
+        continue;
+
+      if (isObservableOnUnwindOrExit(SI, Later, DL, TLI))
+        continue;
+
+      DeadStores.push_back(SI);
+    }
+  }
+
+  for (StoreInst *SI : DeadStores) {
+    DEBUG(dbgs() << "DSE: Remove Dead Store (MemorySSA):\n  DEAD: " << *SI
+                 << '\n');
+    Updater.removeMemoryAccess(MSSA->getMemoryAccess(SI));
+    // Use weak handles for the operands: deleting the dead tree under one
+    // of them can erase the other.
+    SmallVector<WeakVH, 4> Operands(SI->op_begin(), SI->op_end());
+    SI->eraseFromParent();
+    // Clean up any value or address computation that just became dead.  The
+    // chain can include dead loads, which are MemoryUses, so every deleted
+    // instruction's access has to be dropped to keep MemorySSA preserved.
+    for (WeakVH &Op : Operands)
+      if (auto *OpI = dyn_cast_or_null<Instruction>((Value *)Op))
+        deleteDeadInstructionMemorySSA(OpI, MSSA, Updater, TLI);
+    ++NumFastStores;
+    MadeChange = true;
+  }
+
+  return MadeChange;
+}
+
 //===----------------------------------------------------------------------===//
 // DSE Pass
 //===----------------------------------------------------------------------===//
 PreservedAnalyses DSEPass::run(Function &F, FunctionAnalysisManager &AM) {
   AliasAnalysis *AA = &AM.getResult<AAManager>(F);
+  const TargetLibraryInfo *TLI = &AM.getResult<TargetLibraryAnalysis>(F);
+
+  if (EnableMemorySSA) {
+    MemorySSA *MSSA = &AM.getResult<MemorySSAAnalysis>(F).getMSSA();
+    if (!eliminateDeadStoresMemorySSA(F, AA, MSSA, TLI))
+      return PreservedAnalyses::all();
+
+    PreservedAnalyses PA;
+    PA.preserveSet<CFGAnalyses>();
+    PA.preserve<GlobalsAA>();
+    PA.preserve<MemorySSAAnalysis>();
+    return PA;
+  }
+
   DominatorTree *DT = &AM.getResult<DominatorTreeAnalysis>(F);
   MemoryDependenceResults *MD = &AM.getResult<MemoryDependenceAnalysis>(F);
-  const TargetLibraryInfo *TLI = &AM.getResult<TargetLibraryAnalysis>(F);
 
   if (!eliminateDeadStores(F, AA, MD, DT, TLI))
     return PreservedAnalyses::all();
@@ -1201,13 +1371,19 @@ public:
     if (skipFunction(F))
       return false;
 
-    DominatorTree *DT = &getAnalysis<DominatorTreeWrapperPass>().getDomTree();
     AliasAnalysis *AA = &getAnalysis<AAResultsWrapperPass>().getAAResults();
-    MemoryDependenceResults *MD =
-        &getAnalysis<MemoryDependenceWrapperPass>().getMemDep();
     const TargetLibraryInfo *TLI =
         &getAnalysis<TargetLibraryInfoWrapperPass>().getTLI();
 
+    if (EnableMemorySSA) {
+      MemorySSA *MSSA = &getAnalysis<MemorySSAWrapperPass>().getMSSA();
+      return eliminateDeadStoresMemorySSA(F, AA, MSSA, TLI);
+    }
+
+    DominatorTree *DT = &getAnalysis<DominatorTreeWrapperPass>().getDomTree();
+    MemoryDependenceResults *MD =
+        &getAnalysis<MemoryDependenceWrapperPass>().getMemDep();
+
     return eliminateDeadStores(F, AA, MD, DT, TLI);
   }
 
@@ -1215,11 +1391,16 @@ public:
     AU.setPreservesCFG();
     AU.addRequired<DominatorTreeWrapperPass>();
     AU.addRequired<AAResultsWrapperPass>();
-    AU.addRequired<MemoryDependenceWrapperPass>();
     AU.addRequired<TargetLibraryInfoWrapperPass>();
     AU.addPreserved<DominatorTreeWrapperPass>();
     AU.addPreserved<GlobalsAAWrapperPass>();
-    AU.addPreserved<MemoryDependenceWrapperPass>();
+    if (EnableMemorySSA) {
+      AU.addRequired<MemorySSAWrapperPass>();
+      AU.addPreserved<MemorySSAWrapperPass>();
+    } else {
+      AU.addRequired<MemoryDependenceWrapperPass>();
+      AU.addPreserved<MemoryDependenceWrapperPass>();
+    }
   }
 
   static char ID; // Pass identification, replacement for typeid
@@ -1233,6 +1414,7 @@ INITIALIZE_PASS_DEPENDENCY(DominatorTreeWrapperPass)
 INITIALIZE_PASS_DEPENDENCY(AAResultsWrapperPass)
 INITIALIZE_PASS_DEPENDENCY(GlobalsAAWrapperPass)
 INITIALIZE_PASS_DEPENDENCY(MemoryDependenceWrapperPass)
+INITIALIZE_PASS_DEPENDENCY(MemorySSAWrapperPass)
 INITIALIZE_PASS_DEPENDENCY(TargetLibraryInfoWrapperPass)
 INITIALIZE_PASS_END(DSELegacyPass, "dse", "Dead Store Elimination", false,
                     false)
@@ -56,8 +56,18 @@ namespace {
 struct SimpleValue {
   Instruction *Inst;
 
-  SimpleValue(Instruction *I) : Inst(I) {
+  /// Hash of the instruction, computed once on construction.  The scoped
+  /// hash table rehashes its keys whenever it grows, and the hash here walks
+  /// all operands, so recomputing it from scratch dominates EarlyCSE on huge
+  /// functions.  Caching it is safe because an instruction's operands must
+  /// not change while it is table-resident anyway (growth would already
+  /// mis-rehash it today if they did).
+  unsigned Hash;
+
+  SimpleValue(Instruction *I) : Inst(I), Hash(0) {
     assert((isSentinel() || canHandle(I)) && "Inst can't be handled!");
+    if (!isSentinel())
+      Hash = hashInstruction(I);
   }
 
   bool isSentinel() const {
@@ -75,6 +85,8 @@ struct SimpleValue {
            isa<InsertElementInst>(Inst) || isa<ShuffleVectorInst>(Inst) ||
            isa<ExtractValueInst>(Inst) || isa<InsertValueInst>(Inst);
   }
+
+  static unsigned hashInstruction(Instruction *Inst);
 };
 }
 
@@ -92,7 +104,10 @@ template <> struct DenseMapInfo<SimpleValue> {
 }
 
 unsigned DenseMapInfo<SimpleValue>::getHashValue(SimpleValue Val) {
-  Instruction *Inst = Val.Inst;
+  return Val.Hash;
+}
+
+unsigned SimpleValue::hashInstruction(Instruction *Inst) {
   // Hash in all of the operands as pointers.
   if (BinaryOperator *BinOp = dyn_cast<BinaryOperator>(Inst)) {
     Value *LHS = BinOp->getOperand(0);
@@ -185,8 +200,14 @@ namespace {
 struct CallValue {
   Instruction *Inst;
 
-  CallValue(Instruction *I) : Inst(I) {
+  /// Hash of the call, computed once on construction.  See the comment on
+  /// SimpleValue::Hash.
+  unsigned Hash;
+
+  CallValue(Instruction *I) : Inst(I), Hash(0) {
     assert((isSentinel() || canHandle(I)) && "Inst can't be handled!");
+    if (!isSentinel())
+      Hash = hashInstruction(I);
   }
 
   bool isSentinel() const {
@@ -204,6 +225,8 @@ struct CallValue {
       return false;
     return true;
   }
+
+  static unsigned hashInstruction(Instruction *Inst);
 };
 }
 
@@ -221,7 +244,10 @@ template <> struct DenseMapInfo<CallValue> {
 }
 
 unsigned DenseMapInfo<CallValue>::getHashValue(CallValue Val) {
-  Instruction *Inst = Val.Inst;
+  return Val.Hash;
+}
+
+unsigned CallValue::hashInstruction(Instruction *Inst) {
   // Hash all of the operands as pointers and mix in the opcode.
   return hash_combine(
       Inst->getOpcode(),
@@ -34,6 +34,7 @@
 #include "llvm/Analysis/MemoryBuiltins.h"
 #include "llvm/Analysis/MemoryDependenceAnalysis.h"
 #include "llvm/Analysis/OptimizationDiagnosticInfo.h"
+#include "llvm/Analysis/ProfileSummaryInfo.h"
 #include "llvm/Analysis/PHITransAddr.h"
 #include "llvm/Analysis/TargetLibraryInfo.h"
 #include "llvm/IR/DataLayout.h"
@@ -72,6 +73,15 @@ static cl::opt<bool> EnablePRE("enable-pre",
                                cl::init(true), cl::Hidden);
 static cl::opt<bool> EnableLoadPRE("enable-load-pre", cl::init(true));
 
+// Scalability mode for huge (typically machine-generated) functions: leader
+// lookups probe a per-block map along the dominator chain instead of
+// scanning leader chains, and repeat iterations only revisit the dominator
+// subtrees of blocks that changed, instead of the whole function.
+static cl::opt<bool> GVNScalability(
+    "gvn-scalability", cl::init(false), cl::Hidden,
+    cl::desc("Use per-block leader lookups and worklist-driven iteration "
+             "in GVN (helps very large functions)"));
+
 // Maximum allowed recursion depth.
 static cl::opt<uint32_t>
 MaxRecurseDepth("max-recurse-depth", cl::Hidden, cl::init(1000), cl::ZeroOrMore,
@@ -580,6 +590,13 @@ void GVN::ValueTable::verifyRemoved(const Value *V) const {
 //===----------------------------------------------------------------------===//
 
 PreservedAnalyses GVN::run(Function &F, FunctionAnalysisManager &AM) {
+  const ModuleAnalysisManager &MAM =
+      AM.getResult<ModuleAnalysisManagerFunctionProxy>(F).getManager();
+  if (ProfileSummaryInfo *PSI =
+          MAM.getCachedResult<ProfileSummaryAnalysis>(*F.getParent()))
+    if (PSI->shouldReduceColdFunctionPipeline(&F))
+      return PreservedAnalyses::all();
+
   // FIXME: The order of evaluation of these 'getResult' calls is very
   // significant! Re-ordering these variables will cause GVN when run alone to
   // be less effective! We should fix memdep and basic-aa to not exhibit this
@@ -1457,6 +1474,25 @@ bool GVN::processLoad(LoadInst *L) {
 // question.  This is fast because dominator tree queries consist of only
 // a few comparisons of DFS numbers.
 Value *GVN::findLeader(const BasicBlock *BB, uint32_t num) {
+  if (ScalabilityMode) {
+    // Instead of scanning every value recorded for this number, probe the
+    // per-block leader cache for each dominator of BB. This bounds the
+    // lookup by the depth of the dominator tree rather than by the length
+    // of the leader chain.
+    Value *Val = nullptr;
+    for (const DomTreeNode *DN = DT->getNode(const_cast<BasicBlock *>(BB));
+         DN; DN = DN->getIDom()) {
+      auto It = BlockLeaders.find(std::make_pair(num, DN->getBlock()));
+      if (It == BlockLeaders.end())
+        continue;
+      if (isa<Constant>(It->second))
+        return It->second;
+      if (!Val)
+        Val = It->second;
+    }
+    return Val;
+  }
+
   LeaderTableEntry Vals = LeaderTable[num];
   if (!Vals.Val) return nullptr;
 
@@ -1828,6 +1864,7 @@ bool GVN::runImpl(Function &F, AssumptionCache &RunAC, DominatorTree &RunDT,
   MD = RunMD;
   VN.setMemDep(MD);
   ORE = RunORE;
+  ScalabilityMode = GVNScalability;
 
   bool Changed = false;
   bool ShouldContinue = true;
@@ -1847,6 +1884,9 @@ bool GVN::runImpl(Function &F, AssumptionCache &RunAC, DominatorTree &RunDT,
   unsigned Iteration = 0;
   while (ShouldContinue) {
     DEBUG(dbgs() << "GVN iteration: " << Iteration << "\n");
+    // After the first full pass, scalability mode only revisits the parts
+    // of the function that the previous iteration changed.
+    RestrictToChangedBlocks = ScalabilityMode && Iteration != 0;
     ShouldContinue = iterateOnFunction(F);
     Changed |= ShouldContinue;
     ++Iteration;
@@ -2151,6 +2191,17 @@ bool GVN::splitCriticalEdges() {
 
 /// Executes one iteration of GVN
 bool GVN::iterateOnFunction(Function &F) {
+  // When restricted, collect the dominator subtrees of the blocks changed
+  // by the previous iteration before cleanupGlobalSets discards them.
+  // Redundancy elimination only rewrites uses dominated by the changed
+  // block, so new opportunities can only appear in its subtree.
+  SmallPtrSet<const BasicBlock *, 32> Work;
+  if (RestrictToChangedBlocks)
+    for (BasicBlock *BB : ChangedBlocks)
+      if (DomTreeNode *DN = DT->getNode(BB))
+        for (DomTreeNode *N : depth_first(DN))
+          Work.insert(N->getBlock());
+
   cleanupGlobalSets();
 
   // Top-down walk of the dominator tree
@@ -2159,15 +2210,37 @@ bool GVN::iterateOnFunction(Function &F) {
   // RPOT walks the graph in its constructor and will not be invalidated during
   // processBlock.
   ReversePostOrderTraversal<Function *> RPOT(&F);
-  for (BasicBlock *BB : RPOT)
-    Changed |= processBlock(BB);
+  for (BasicBlock *BB : RPOT) {
+    if (RestrictToChangedBlocks && !Work.count(BB)) {
+      // Record value numbers and leaders so lookups from revisited blocks
+      // still see this block's values, but skip the elimination work.
+      renumberBlock(BB);
+      continue;
+    }
+    bool BlockChanged = processBlock(BB);
+    if (ScalabilityMode && BlockChanged)
+      ChangedBlocks.insert(BB);
+    Changed |= BlockChanged;
+  }
 
   return Changed;
 }
 
+/// Assign value numbers to all instructions in BB and record them as
+/// leaders, without attempting any elimination. Used by scalability mode
+/// for blocks that do not need to be revisited.
+void GVN::renumberBlock(BasicBlock *BB) {
+  for (Instruction &Inst : *BB) {
+    unsigned ValNum = VN.lookupOrAdd(&Inst);
+    addToLeaderTable(ValNum, &Inst, BB);
+  }
+}
+
 void GVN::cleanupGlobalSets() {
   VN.clear();
   LeaderTable.clear();
+  BlockLeaders.clear();
+  ChangedBlocks.clear();
   TableAllocator.Reset();
 }
 
@@ -2188,6 +2261,11 @@ void GVN::verifyRemoved(const Instruction *Inst) const {
       assert(Node->Val != Inst && "Inst still in value numbering scope!");
     }
   }
+
+  for (const auto &Entry : BlockLeaders) {
+    (void)Entry;
+    assert(Entry.second != Inst && "Inst still in block leader cache!");
+  }
 }
 
 /// BB is declared dead, which implied other blocks become dead as well. This
@@ -2325,6 +2403,11 @@ public:
     if (skipFunction(F))
       return false;
 
+    if (getAnalysis<ProfileSummaryInfoWrapperPass>()
+            .getPSI()
+            ->shouldReduceColdFunctionPipeline(&F))
+      return false;
+
     auto *LIWP = getAnalysisIfAvailable<LoopInfoWrapperPass>();
 
     return Impl.runImpl(
@@ -2340,6 +2423,7 @@ public:
 
   void getAnalysisUsage(AnalysisUsage &AU) const override {
     AU.addRequired<AssumptionCacheTracker>();
+    AU.addRequired<ProfileSummaryInfoWrapperPass>();
     AU.addRequired<DominatorTreeWrapperPass>();
     AU.addRequired<TargetLibraryInfoWrapperPass>();
     if (!NoLoads)
@@ -2372,4 +2456,5 @@ INITIALIZE_PASS_DEPENDENCY(TargetLibraryInfoWrapperPass)
 INITIALIZE_PASS_DEPENDENCY(AAResultsWrapperPass)
 INITIALIZE_PASS_DEPENDENCY(GlobalsAAWrapperPass)
 INITIALIZE_PASS_DEPENDENCY(OptimizationRemarkEmitterWrapperPass)
+INITIALIZE_PASS_DEPENDENCY(ProfileSummaryInfoWrapperPass)
 INITIALIZE_PASS_END(GVNLegacyPass, "gvn", "Global Value Numbering", false, false)
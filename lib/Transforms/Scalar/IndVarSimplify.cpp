@@ -2371,6 +2371,10 @@ bool IndVarSimplify::run(Loop *L) {
   assert(L->isRecursivelyLCSSAForm(*DT, *LI) &&
          "LCSSA required to run indvars!");
 
+  // No SCEV pointers are live for this loop yet, so this is a safe point to
+  // enforce the (opt-in) expression memory budget.
+  SE->forgetAllExpressionsIfOverBudget();
+
   // If LoopSimplify form is not available, stay out of trouble. Some notes:
   //  - LSR currently only supports LoopSimplify-form loops. Indvars'
   //    canonicalization can be a pessimization without LSR to "clean up"
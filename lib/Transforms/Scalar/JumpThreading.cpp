@@ -220,6 +220,7 @@ bool JumpThreadingPass::runImpl(Function &F, TargetLibraryInfo *TLI_,
               << "' with terminator: " << *BB->getTerminator() << '\n');
         LoopHeaders.erase(BB);
         LVI->eraseBlock(BB);
+        DupCostCache.erase(BB);
         DeleteDeadBlock(BB);
         Changed = true;
         continue;
@@ -242,6 +243,7 @@ bool JumpThreadingPass::runImpl(Function &F, TargetLibraryInfo *TLI_,
         // awesome, but it allows us to use AssertingVH to prevent nasty
         // dangling pointer issues within LazyValueInfo.
         LVI->eraseBlock(BB);
+        DupCostCache.erase(BB);
         if (TryToSimplifyUncondBranchFromEmptyBlock(BB))
           Changed = true;
       }
@@ -250,6 +252,7 @@ bool JumpThreadingPass::runImpl(Function &F, TargetLibraryInfo *TLI_,
   } while (Changed);
 
   LoopHeaders.clear();
+  DupCostCache.clear();
   return EverChanged;
 }
 
@@ -326,6 +329,23 @@ static unsigned getJumpThreadDuplicationCost(BasicBlock *BB,
   return Size > Bonus ? Size - Bonus : 0;
 }
 
+/// Return the memoized duplication cost of \p BB up to its terminator,
+/// recomputing it if the block's instruction count has changed since it was
+/// cached. Walking the instruction list to count is much cheaper than the
+/// full cost scan, and the count changes whenever threading clones into or
+/// simplifies a block, so stale entries are refreshed transparently.
+unsigned JumpThreadingPass::getCachedDuplicationCost(BasicBlock *BB) {
+  unsigned NumInsts = std::distance(BB->begin(), BB->end());
+  auto It = DupCostCache.find(BB);
+  if (It != DupCostCache.end() && It->second.first == NumInsts)
+    return It->second.second;
+
+  unsigned Cost =
+      getJumpThreadDuplicationCost(BB, BB->getTerminator(), BBDupThreshold);
+  DupCostCache[BB] = std::make_pair(NumInsts, Cost);
+  return Cost;
+}
+
 /// FindLoopHeaders - We do not want jump threading to turn proper loop
 /// structures into irreducible loops.  Doing this breaks up the loop nesting
 /// hierarchy and pessimizes later transformations.  To prevent this from
@@ -415,6 +435,13 @@ bool JumpThreadingPass::ComputeValueKnownInPredecessors(
     // "X < 4" and "X < 3" is known true but "X < 4" itself is not available.
     // Perhaps getConstantOnEdge should be smart enough to do this?
 
+    // Solve for the value at the end of every predecessor in one batch so
+    // LVI shares its block walks across the edges.
+    SmallVector<std::pair<Value *, BasicBlock *>, 8> EdgeQueries;
+    for (BasicBlock *P : predecessors(BB))
+      EdgeQueries.push_back(std::make_pair(V, P));
+    LVI->batchQueryValues(EdgeQueries);
+
     for (BasicBlock *P : predecessors(BB)) {
       // If the value is known by LazyValueInfo to be a constant in a
       // predecessor, use that information to try to thread this block.
@@ -585,6 +612,13 @@ bool JumpThreadingPass::ComputeValueKnownInPredecessors(
           cast<Instruction>(Cmp->getOperand(0))->getParent() != BB) {
         Constant *RHSCst = cast<Constant>(Cmp->getOperand(1));
 
+        // As above, batch the block-end solves for all predecessor edges
+        // before asking about them one at a time.
+        SmallVector<std::pair<Value *, BasicBlock *>, 8> CmpQueries;
+        for (BasicBlock *P : predecessors(BB))
+          CmpQueries.push_back(std::make_pair(Cmp->getOperand(0), P));
+        LVI->batchQueryValues(CmpQueries);
+
         for (BasicBlock *P : predecessors(BB)) {
           // If the value is known by LazyValueInfo to be a constant in a
           // predecessor, use that information to try to thread this block.
@@ -723,6 +757,7 @@ bool JumpThreadingPass::ProcessBlock(BasicBlock *BB) {
         LoopHeaders.insert(BB);
 
       LVI->eraseBlock(SinglePred);
+      DupCostCache.erase(SinglePred);
       MergeBasicBlockIntoOnlyPred(BB);
 
       return true;
@@ -1538,8 +1573,7 @@ bool JumpThreadingPass::ThreadEdge(BasicBlock *BB,
     return false;
   }
 
-  unsigned JumpThreadCost =
-      getJumpThreadDuplicationCost(BB, BB->getTerminator(), BBDupThreshold);
+  unsigned JumpThreadCost = getCachedDuplicationCost(BB);
   if (JumpThreadCost > BBDupThreshold) {
     DEBUG(dbgs() << "  Not threading BB '" << BB->getName()
           << "' - Cost is too high: " << JumpThreadCost << "\n");
@@ -1827,8 +1861,7 @@ bool JumpThreadingPass::DuplicateCondBranchOnPHIIntoPred(
     return false;
   }
 
-  unsigned DuplicationCost =
-      getJumpThreadDuplicationCost(BB, BB->getTerminator(), BBDupThreshold);
+  unsigned DuplicationCost = getCachedDuplicationCost(BB);
   if (DuplicationCost > BBDupThreshold) {
     DEBUG(dbgs() << "  Not duplicating BB '" << BB->getName()
           << "' - Cost is too high: " << DuplicationCost << "\n");
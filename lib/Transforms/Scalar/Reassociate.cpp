@@ -22,10 +22,10 @@
 
 #include "llvm/Transforms/Scalar/Reassociate.h"
 #include "llvm/ADT/DenseMap.h"
-#include "llvm/ADT/PostOrderIterator.h"
 #include "llvm/ADT/STLExtras.h"
 #include "llvm/ADT/SetVector.h"
 #include "llvm/ADT/Statistic.h"
+#include "llvm/Analysis/CFGTraversal.h"
 #include "llvm/Analysis/GlobalsModRef.h"
 #include "llvm/Analysis/ValueTracking.h"
 #include "llvm/IR/CFG.h"
@@ -145,8 +145,7 @@ static BinaryOperator *isReassociableOp(Value *V, unsigned Opcode1,
   return nullptr;
 }
 
-void ReassociatePass::BuildRankMap(Function &F,
-                                   ReversePostOrderTraversal<Function*> &RPOT) {
+void ReassociatePass::BuildRankMap(Function &F, ArrayRef<BasicBlock *> RPO) {
   unsigned i = 2;
 
   // Assign distinct ranks to function arguments.
@@ -156,7 +155,7 @@ void ReassociatePass::BuildRankMap(Function &F,
   }
 
   // Traverse basic blocks in ReversePostOrder
-  for (BasicBlock *BB : RPOT) {
+  for (BasicBlock *BB : RPO) {
     unsigned BBRank = RankMap[BB] = ++i << 16;
 
     // Walk the basic block, adding precomputed ranks for any instructions that
@@ -2180,19 +2179,24 @@ void ReassociatePass::ReassociateExpression(BinaryOperator *I) {
   RewriteExprTree(I, Ops);
 }
 
-PreservedAnalyses ReassociatePass::run(Function &F, FunctionAnalysisManager &) {
-  // Get the functions basic blocks in Reverse Post Order. This order is used by
-  // BuildRankMap to pre calculate ranks correctly. It also excludes dead basic
-  // blocks (it has been seen that the analysis in this pass could hang when
-  // analysing dead basic blocks).
-  ReversePostOrderTraversal<Function *> RPOT(&F);
+PreservedAnalyses ReassociatePass::run(Function &F,
+                                       FunctionAnalysisManager &AM) {
+  // Get the functions basic blocks in Reverse Post Order from the cached
+  // traversal analysis. This order is used by BuildRankMap to pre calculate
+  // ranks correctly. It also excludes dead basic blocks (it has been seen
+  // that the analysis in this pass could hang when analysing dead basic
+  // blocks).
+  return runImpl(F, AM.getResult<CFGTraversalAnalysis>(F).getRPO());
+}
 
+PreservedAnalyses ReassociatePass::runImpl(Function &F,
+                                           ArrayRef<BasicBlock *> RPO) {
   // Calculate the rank map for F.
-  BuildRankMap(F, RPOT);
+  BuildRankMap(F, RPO);
 
   MadeChange = false;
   // Traverse the same blocks that was analysed by BuildRankMap.
-  for (BasicBlock *BI : RPOT) {
+  for (BasicBlock *BI : RPO) {
     assert(RankMap.count(&*BI) && "BB should be ranked.");
     // Optimize every instruction in the basic block.
     for (BasicBlock::iterator II = BI->begin(), IE = BI->end(); II != IE;)
@@ -2257,12 +2261,14 @@ namespace {
       if (skipFunction(F))
         return false;
 
-      FunctionAnalysisManager DummyFAM;
-      auto PA = Impl.run(F, DummyFAM);
+      const CFGTraversal &CT =
+          getAnalysis<CFGTraversalWrapperPass>().getCFGTraversal();
+      auto PA = Impl.runImpl(F, CT.getRPO());
       return !PA.areAllPreserved();
     }
 
     void getAnalysisUsage(AnalysisUsage &AU) const override {
+      AU.addRequired<CFGTraversalWrapperPass>();
       AU.setPreservesCFG();
       AU.addPreserved<GlobalsAAWrapperPass>();
     }
@@ -2270,8 +2276,11 @@ namespace {
 }
 
 char ReassociateLegacyPass::ID = 0;
-INITIALIZE_PASS(ReassociateLegacyPass, "reassociate",
-                "Reassociate expressions", false, false)
+INITIALIZE_PASS_BEGIN(ReassociateLegacyPass, "reassociate",
+                      "Reassociate expressions", false, false)
+INITIALIZE_PASS_DEPENDENCY(CFGTraversalWrapperPass)
+INITIALIZE_PASS_END(ReassociateLegacyPass, "reassociate",
+                    "Reassociate expressions", false, false)
 
 // Public interface to the Reassociate pass
 FunctionPass *llvm::createReassociatePass() {
@@ -42,6 +42,7 @@
 #include "llvm/Transforms/Scalar/SCCP.h"
 #include "llvm/Transforms/Utils/Local.h"
 #include <algorithm>
+#include <deque>
 using namespace llvm;
 
 #define DEBUG_TYPE "sccp"
@@ -170,6 +171,18 @@ class SCCPSolver : public InstVisitor<SCCPSolver> {
   SmallPtrSet<BasicBlock*, 8> BBExecutable; // The BBs that are executable.
   DenseMap<Value*, LatticeVal> ValueState;  // The state each value is in.
 
+  /// Lattice state for arguments and instructions, stored densely. When the
+  /// solver first touches a function, every argument and instruction is
+  /// assigned an index into LocalState in one shot, so the number table never
+  /// grows (and rehashes) while the function is being solved and hot state
+  /// access is a find in a fixed table plus an array index. ValueState above
+  /// keeps only what the numbering does not cover: constants and other
+  /// module-level values. LocalState is a deque so references handed out
+  /// stay valid when entering another function grows it mid-solve.
+  DenseMap<const Value *, unsigned> LocalNumbers;
+  std::deque<LatticeVal> LocalState;
+  SmallPtrSet<Function *, 16> NumberedFunctions;
+
   /// StructValueState - This maintains ValueState for values that have
   /// StructType, for example for formal arguments, calls, insertelement, etc.
   ///
@@ -291,6 +304,11 @@ public:
   }
 
   LatticeVal getLatticeValueFor(Value *V) const {
+    if (isa<Argument>(V) || isa<Instruction>(V)) {
+      auto It = LocalNumbers.find(V);
+      assert(It != LocalNumbers.end() && "V is not in valuemap!");
+      return LocalState[It->second];
+    }
     DenseMap<Value*, LatticeVal>::const_iterator I = ValueState.find(V);
     assert(I != ValueState.end() && "V is not in valuemap!");
     return I->second;
@@ -321,7 +339,7 @@ public:
       for (unsigned i = 0, e = STy->getNumElements(); i != e; ++i)
         markOverdefined(getStructValueState(V, i), V);
     else
-      markOverdefined(ValueState[V], V);
+      markOverdefined(getValueState(V), V);
   }
 
   // isStructLatticeConstant - Return true if all the lattice values
@@ -358,12 +376,12 @@ private:
 
   void markConstant(Value *V, Constant *C) {
     assert(!V->getType()->isStructTy() && "structs should use mergeInValue");
-    markConstant(ValueState[V], V, C);
+    markConstant(getValueState(V), V, C);
   }
 
   void markForcedConstant(Value *V, Constant *C) {
     assert(!V->getType()->isStructTy() && "structs should use mergeInValue");
-    LatticeVal &IV = ValueState[V];
+    LatticeVal &IV = getValueState(V);
     IV.markForcedConstant(C);
     DEBUG(dbgs() << "markForcedConstant: " << *C << ": " << *V << '\n');
     pushToWorkList(IV, V);
@@ -399,16 +417,46 @@ private:
   void mergeInValue(Value *V, LatticeVal MergeWithV) {
     assert(!V->getType()->isStructTy() &&
            "non-structs should use markConstant");
-    mergeInValue(ValueState[V], V, MergeWithV);
+    mergeInValue(getValueState(V), V, MergeWithV);
   }
 
 
   /// getValueState - Return the LatticeVal object that corresponds to the
   /// value.  This function handles the case when the value hasn't been seen yet
   /// by properly seeding constants etc.
+  /// Assign dense indices to every argument and instruction of \p F.
+  void numberFunction(Function *F) {
+    if (!NumberedFunctions.insert(F).second)
+      return;
+    unsigned Count = F->arg_size();
+    for (BasicBlock &BB : *F)
+      Count += BB.size();
+    LocalNumbers.reserve(LocalNumbers.size() + Count);
+    unsigned Next = LocalState.size();
+    for (Argument &A : F->args())
+      LocalNumbers[&A] = Next++;
+    for (BasicBlock &BB : *F)
+      for (Instruction &I : BB)
+        LocalNumbers[&I] = Next++;
+    LocalState.resize(Next);
+  }
+
   LatticeVal &getValueState(Value *V) {
     assert(!V->getType()->isStructTy() && "Should use getStructValueState");
 
+    // Arguments and instructions live in the dense per-function state; they
+    // start out unknown, so there is nothing to seed.
+    if (isa<Argument>(V) || isa<Instruction>(V)) {
+      auto It = LocalNumbers.find(V);
+      if (It == LocalNumbers.end()) {
+        numberFunction(isa<Argument>(V) ? cast<Argument>(V)->getParent()
+                                        : cast<Instruction>(V)->getFunction());
+        It = LocalNumbers.find(V);
+        assert(It != LocalNumbers.end() && "Local value not numbered!");
+      }
+      return LocalState[It->second];
+    }
+
     std::pair<DenseMap<Value*, LatticeVal>::iterator, bool> I =
       ValueState.insert(std::make_pair(V, LatticeVal()));
     LatticeVal &LV = I.first->second;
@@ -924,7 +972,7 @@ void SCCPSolver::visitBinaryOperator(Instruction &I) {
   LatticeVal V1State = getValueState(I.getOperand(0));
   LatticeVal V2State = getValueState(I.getOperand(1));
 
-  LatticeVal &IV = ValueState[&I];
+  LatticeVal &IV = getValueState(&I);
   if (IV.isOverdefined()) return;
 
   if (V1State.isConstant() && V2State.isConstant()) {
@@ -988,7 +1036,7 @@ void SCCPSolver::visitCmpInst(CmpInst &I) {
   LatticeVal V1State = getValueState(I.getOperand(0));
   LatticeVal V2State = getValueState(I.getOperand(1));
 
-  LatticeVal &IV = ValueState[&I];
+  LatticeVal &IV = getValueState(&I);
   if (IV.isOverdefined()) return;
 
   if (V1State.isConstant() && V2State.isConstant()) {
@@ -1010,7 +1058,7 @@ void SCCPSolver::visitCmpInst(CmpInst &I) {
 // can turn this into a getelementptr ConstantExpr.
 //
 void SCCPSolver::visitGetElementPtrInst(GetElementPtrInst &I) {
-  if (ValueState[&I].isOverdefined()) return;
+  if (getValueState(&I).isOverdefined()) return;
 
   SmallVector<Constant*, 8> Operands;
   Operands.reserve(I.getNumOperands());
@@ -1065,7 +1113,7 @@ void SCCPSolver::visitLoadInst(LoadInst &I) {
   LatticeVal PtrVal = getValueState(I.getOperand(0));
   if (PtrVal.isUnknown()) return;   // The pointer is not resolved yet!
 
-  LatticeVal &IV = ValueState[&I];
+  LatticeVal &IV = getValueState(&I);
   if (IV.isOverdefined()) return;
 
   if (!PtrVal.isConstant() || I.isVolatile())
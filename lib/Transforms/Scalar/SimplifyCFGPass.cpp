@@ -35,6 +35,7 @@
 #include "llvm/IR/Instructions.h"
 #include "llvm/IR/IntrinsicInst.h"
 #include "llvm/IR/Module.h"
+#include "llvm/IR/ValueHandle.h"
 #include "llvm/Pass.h"
 #include "llvm/Support/CommandLine.h"
 #include "llvm/Transforms/Scalar.h"
@@ -49,6 +50,11 @@ static cl::opt<unsigned>
 UserBonusInstThreshold("bonus-inst-threshold", cl::Hidden, cl::init(1),
    cl::desc("Control the number of bonus instructions (default = 1)"));
 
+static cl::opt<bool> EnableDirtySetIteration(
+    "simplifycfg-dirty-set", cl::Hidden, cl::init(false),
+    cl::desc("On iterative SimplifyCFG rounds, revisit only blocks near a "
+             "change instead of rescanning the whole function"));
+
 STATISTIC(NumSimpl, "Number of blocks simplified");
 
 /// If we have more than one empty (other than phi node) return blocks,
@@ -141,16 +147,57 @@ static bool iterativelySimplifyCFG(Function &F, const TargetTransformInfo &TTI,
   for (unsigned i = 0, e = Edges.size(); i != e; ++i)
     LoopHeaders.insert(const_cast<BasicBlock *>(Edges[i].second));
 
+  // With -simplifycfg-dirty-set, the first round visits every block and
+  // later rounds revisit only blocks near a change instead of rescanning the
+  // whole function. A change can expose an opportunity up to two CFG edges
+  // away (e.g. rewriting a diamond's head can make FoldTwoEntryPHINode fire
+  // at its tail), so the whole two-hop neighborhood is marked dirty. Deleted
+  // blocks are tracked with WeakVHs so they drop out of the dirty set
+  // instead of being touched.
+  SmallPtrSet<BasicBlock *, 32> Dirty;
+  bool FirstRound = true;
+
   while (LocalChange) {
     LocalChange = false;
+    SmallPtrSet<BasicBlock *, 32> NextDirty;
 
     // Loop over all of the basic blocks and remove them if they are unneeded.
     for (Function::iterator BBIt = F.begin(); BBIt != F.end(); ) {
-      if (SimplifyCFG(&*BBIt++, TTI, BonusInstThreshold, AC, &LoopHeaders, LateSimplifyCFG)) {
+      BasicBlock *BB = &*BBIt++;
+      if (EnableDirtySetIteration && !FirstRound && !Dirty.count(BB))
+        continue;
+
+      // Snapshot the one-hop neighborhood first; SimplifyCFG may delete BB
+      // or any block next to it.
+      SmallVector<WeakVH, 8> Neighborhood;
+      if (EnableDirtySetIteration) {
+        Neighborhood.append(pred_begin(BB), pred_end(BB));
+        Neighborhood.append(succ_begin(BB), succ_end(BB));
+        Neighborhood.push_back(BB);
+      }
+
+      if (SimplifyCFG(BB, TTI, BonusInstThreshold, AC, &LoopHeaders, LateSimplifyCFG)) {
         LocalChange = true;
         ++NumSimpl;
+
+        // Mark each surviving one-hop neighbor and its own live predecessors
+        // and successors dirty. Expanding through the live edges also picks
+        // up successors BB gained during the rewrite (e.g. blocks created
+        // while forming a lookup table).
+        if (EnableDirtySetIteration) {
+          auto MarkWithNeighbors = [&NextDirty](BasicBlock *B) {
+            NextDirty.insert(B);
+            NextDirty.insert(pred_begin(B), pred_end(B));
+            NextDirty.insert(succ_begin(B), succ_end(B));
+          };
+          for (WeakVH &VH : Neighborhood)
+            if (Value *V = VH)
+              MarkWithNeighbors(cast<BasicBlock>(V));
+        }
       }
     }
+    Dirty = std::move(NextDirty);
+    FirstRound = false;
     Changed |= LocalChange;
   }
   return Changed;
@@ -212,7 +212,83 @@ Function *llvm::CloneFunction(Function *F, ValueToValueMapTy &VMap,
   return NewF;
 }
 
+FunctionCloneTemplate::FunctionCloneTemplate(Function &F) : F(F) {
+  unsigned InstIdx = 0;
+  for (const BasicBlock &BB : F) {
+    for (const Instruction &I : BB) {
+      // Phis also remap their incoming blocks, which are not ordinary
+      // operand slots; blockaddresses and locals wrapped in metadata are
+      // rewritten inside constants the slots cannot reach.
+      bool NeedsFullRemap = isa<PHINode>(I);
+      for (const Use &Op : I.operands())
+        if (isa<BlockAddress>(Op) || isa<MetadataAsValue>(Op))
+          NeedsFullRemap = true;
+
+      if (NeedsFullRemap) {
+        FullRemapInsts.push_back(InstIdx);
+      } else {
+        for (unsigned OpIdx = 0, E = I.getNumOperands(); OpIdx != E; ++OpIdx) {
+          const Value *Op = I.getOperand(OpIdx);
+          if (isa<Instruction>(Op) || isa<Argument>(Op) || isa<BasicBlock>(Op))
+            PatchPoints.push_back(std::make_pair(InstIdx, OpIdx));
+        }
+      }
+      ++InstIdx;
+    }
+  }
+}
+
+Function *FunctionCloneTemplate::cloneFunction(ValueToValueMapTy &VMap,
+                                               const Twine &NameSuffix) const {
+  Function *NewF = Function::Create(F.getFunctionType(), F.getLinkage(),
+                                    F.getName() + NameSuffix, F.getParent());
+  // The signature is unchanged, so the attribute list, including parameter
+  // attributes, carries over verbatim; so do function-level metadata and the
+  // personality, prefix and prologue data, which are all module-level.
+  NewF->copyAttributesFrom(&F);
+  NewF->copyMetadata(&F, 0);
+
+  Function::arg_iterator DestI = NewF->arg_begin();
+  for (const Argument &A : F.args()) {
+    DestI->setName(A.getName());
+    VMap[&A] = &*DestI++;
+  }
 
+  // First pass: copy the blocks and instructions without touching operands.
+  for (BasicBlock &BB : F) {
+    BasicBlock *NewBB = CloneBasicBlock(&BB, VMap, NameSuffix, NewF);
+    VMap[&BB] = NewBB;
+    if (BB.hasAddressTaken()) {
+      Constant *OldBBAddr = BlockAddress::get(&F, &BB);
+      VMap[OldBBAddr] = BlockAddress::get(NewF, NewBB);
+    }
+  }
+
+  // Second pass: rewrite the recorded operand slots through the now-complete
+  // VMap, and hand the instructions the patch list cannot describe to the
+  // value mapper.
+  auto PP = PatchPoints.begin(), PPEnd = PatchPoints.end();
+  auto FR = FullRemapInsts.begin(), FREnd = FullRemapInsts.end();
+  unsigned InstIdx = 0;
+  Function::iterator NewBB = NewF->begin();
+  for (const BasicBlock &BB : F) {
+    BasicBlock::iterator NewI = NewBB->begin();
+    for (const Instruction &I : BB) {
+      Instruction *Cloned = &*NewI++;
+      for (; PP != PPEnd && PP->first == InstIdx; ++PP)
+        Cloned->setOperand(PP->second, VMap.lookup(I.getOperand(PP->second)));
+      if (FR != FREnd && *FR == InstIdx) {
+        RemapInstruction(Cloned, VMap,
+                         RF_NoModuleLevelChanges | RF_IgnoreMissingLocals);
+        ++FR;
+      }
+      ++InstIdx;
+    }
+    ++NewBB;
+  }
+
+  return NewF;
+}
 
 namespace {
   /// This is a private class used to implement CloneAndPruneFunctionInto.
@@ -0,0 +1,115 @@
+//===- IRTransaction.cpp - Speculative IR mutation with rollback ----------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+//
+// This file implements the IRTransaction journal. See the header for the
+// usage contract.
+//
+//===----------------------------------------------------------------------===//
+
+#include "llvm/Transforms/Utils/IRTransaction.h"
+#include "llvm/IR/BasicBlock.h"
+#include "llvm/IR/Instruction.h"
+
+using namespace llvm;
+
+IRTransaction::~IRTransaction() {
+  if (isOpen())
+    rollback();
+}
+
+void IRTransaction::createdInstruction(Instruction *I) {
+  Created.push_back(I);
+}
+
+void IRTransaction::aboutToChange(Instruction *I) {
+  auto It = OperandSnapshots.find(I);
+  if (It != OperandSnapshots.end())
+    return;
+  SmallVector<Value *, 4> &Snapshot = OperandSnapshots[I];
+  Snapshot.reserve(I->getNumOperands());
+  for (Value *Op : I->operands())
+    Snapshot.push_back(Op);
+}
+
+void IRTransaction::deleteInstruction(Instruction *I) {
+  assert(I->use_empty() &&
+         "deleted instruction must have its uses replaced first");
+  assert(I->getParent() && "instruction is not linked into a block");
+  DeletedInstInfo Info;
+  Info.I = I;
+  Info.BB = I->getParent();
+  Instruction *Next = I->getNextNode();
+  Info.NextInst = Next;
+  // Unlink but keep the instruction (and its operand uses) alive so rollback
+  // can splice it back unmodified.
+  I->removeFromParent();
+  Deleted.push_back(Info);
+}
+
+void IRTransaction::replaceAllUsesWith(Value *From, Value *To) {
+  // Snapshot every user whose operands the replacement is about to rewrite.
+  // Users may appear multiple times in the use list; aboutToChange only
+  // snapshots the first occurrence.
+  for (User *U : From->users())
+    if (Instruction *I = dyn_cast<Instruction>(U))
+      aboutToChange(I);
+  From->replaceAllUsesWith(To);
+}
+
+void IRTransaction::commit() {
+  // Nothing records the created or rewritten instructions; they are simply
+  // accepted. Deleted instructions were parked unlinked and can now be freed.
+  for (DeletedInstInfo &Info : Deleted) {
+    assert(Info.I->use_empty() && "committed deletion still has uses");
+    Info.I->dropAllReferences();
+    delete Info.I;
+  }
+  Created.clear();
+  Deleted.clear();
+  OperandSnapshots.clear();
+}
+
+void IRTransaction::rollback() {
+  // Restore rewritten operand lists first. This also removes any uses of
+  // created instructions that the rewrites introduced.
+  for (auto &Snapshot : OperandSnapshots) {
+    Instruction *I = Snapshot.first;
+    assert(I->getNumOperands() == Snapshot.second.size() &&
+           "operand count changed; not restorable (see header)");
+    for (unsigned Idx = 0, E = Snapshot.second.size(); Idx != E; ++Idx)
+      if (I->getOperand(Idx) != Snapshot.second[Idx])
+        I->setOperand(Idx, Snapshot.second[Idx]);
+  }
+
+  // Splice deleted instructions back in reverse deletion order, so that by
+  // the time an instruction is re-inserted, the successor recording its
+  // position is back in the block if it was deleted after it. A null handle
+  // means the instruction was (or has become) the last one in its block.
+  for (DeletedInstInfo &Info : make_range(Deleted.rbegin(), Deleted.rend())) {
+    if (Instruction *Next = cast_or_null<Instruction>(Info.NextInst))
+      Info.I->insertBefore(Next);
+    else
+      Info.BB->getInstList().push_back(Info.I);
+  }
+
+  // Finally erase created instructions in reverse creation order. Drop their
+  // references first so mutual references between them don't trip the
+  // use-count assertions during erase.
+  for (Instruction *I : make_range(Created.rbegin(), Created.rend()))
+    I->dropAllReferences();
+  for (Instruction *I : make_range(Created.rbegin(), Created.rend())) {
+    assert(I->use_empty() &&
+           "rolled-back instruction still used by unrecorded IR");
+    I->eraseFromParent();
+  }
+
+  Created.clear();
+  Deleted.clear();
+  OperandSnapshots.clear();
+}
@@ -40,6 +40,7 @@
 #include "llvm/Transforms/Utils/Local.h"
 #include "llvm/Transforms/Utils/PromoteMemToReg.h"
 #include <algorithm>
+#include <map>
 using namespace llvm;
 
 #define DEBUG_TYPE "mem2reg"
@@ -540,6 +541,17 @@ void PromoteMem2Reg::run() {
   LargeBlockInfo LBI;
   ForwardIDFCalculator IDF(DT);
 
+  // Allocas that share a set of defining blocks share an iterated dominance
+  // frontier; generated code in particular tends to produce many allocas all
+  // stored in the same handful of blocks. Cache the unpruned IDF per
+  // def-block set, keyed by the sorted block list. The unpruned frontier
+  // costs more to compute than one liveness-pruned query, so it is only
+  // computed once a def-block set is seen a second time; the per-alloca
+  // result is then the cached frontier filtered by that alloca's live-in
+  // blocks, which yields the same blocks pruning would.
+  std::map<std::vector<BasicBlock *>, std::unique_ptr<std::vector<BasicBlock *>>>
+      SharedIDFCache;
+
   for (unsigned AllocaNum = 0; AllocaNum != Allocas.size(); ++AllocaNum) {
     AllocaInst *AI = Allocas[AllocaNum];
 
@@ -617,15 +629,44 @@ void PromoteMem2Reg::run() {
     // the standard SSA construction algorithm.  Determine which blocks need phi
     // nodes and see if we can optimize out some work by avoiding insertion of
     // dead phi nodes.
-    IDF.setLiveInBlocks(LiveInBlocks);
-    IDF.setDefiningBlocks(DefBlocks);
+    std::vector<BasicBlock *> DefKey(DefBlocks.begin(), DefBlocks.end());
+    std::sort(DefKey.begin(), DefKey.end());
+    auto CacheIt = SharedIDFCache.emplace(std::move(DefKey), nullptr);
+
     SmallVector<BasicBlock *, 32> PHIBlocks;
-    IDF.calculate(PHIBlocks);
-    if (PHIBlocks.size() > 1)
-      std::sort(PHIBlocks.begin(), PHIBlocks.end(),
-                [this](BasicBlock *A, BasicBlock *B) {
-                  return BBNumbers.lookup(A) < BBNumbers.lookup(B);
-                });
+    if (CacheIt.second) {
+      // First alloca with this def-block set: do the pruned query directly.
+      IDF.setLiveInBlocks(LiveInBlocks);
+      IDF.setDefiningBlocks(DefBlocks);
+      IDF.calculate(PHIBlocks);
+      if (PHIBlocks.size() > 1)
+        std::sort(PHIBlocks.begin(), PHIBlocks.end(),
+                  [this](BasicBlock *A, BasicBlock *B) {
+                    return BBNumbers.lookup(A) < BBNumbers.lookup(B);
+                  });
+    } else {
+      std::unique_ptr<std::vector<BasicBlock *>> &Shared =
+          CacheIt.first->second;
+      if (!Shared) {
+        // Second occurrence: compute and keep the unpruned frontier, sorted
+        // once by block number.
+        IDF.resetLiveInBlocks();
+        IDF.setDefiningBlocks(DefBlocks);
+        SmallVector<BasicBlock *, 32> Unpruned;
+        IDF.calculate(Unpruned);
+        Shared.reset(new std::vector<BasicBlock *>(Unpruned.begin(),
+                                                   Unpruned.end()));
+        std::sort(Shared->begin(), Shared->end(),
+                  [this](BasicBlock *A, BasicBlock *B) {
+                    return BBNumbers.lookup(A) < BBNumbers.lookup(B);
+                  });
+      }
+      // A phi is needed exactly at the frontier blocks where the value is
+      // live on entry; filtering keeps the block-number order.
+      for (BasicBlock *BB : *Shared)
+        if (LiveInBlocks.count(BB))
+          PHIBlocks.push_back(BB);
+    }
 
     unsigned CurrentVersion = 0;
     for (unsigned i = 0, e = PHIBlocks.size(); i != e; ++i)
@@ -73,10 +73,27 @@ static void addAllGlobalValueUsers(ClusterMapType &GVtoClusterMap,
   }
 }
 
+// Returns an estimate of the relative cost of generating code for GV. The
+// absolute numbers are meaningless; all that matters is that the cost of a
+// cluster roughly tracks how long the backend will spend on it, so that
+// partitions end up with comparable amounts of work rather than comparable
+// numbers of globals.
+static unsigned getCodeGenCost(const GlobalValue &GV) {
+  if (const Function *F = dyn_cast<Function>(&GV)) {
+    unsigned Cost = 1;
+    for (const BasicBlock &BB : *F)
+      Cost += BB.size();
+    return Cost;
+  }
+  // Variables and aliases only cost their emission.
+  return 1;
+}
+
 // Find partitions for module in the way that no locals need to be
 // globalized.
-// Try to balance pack those partitions into N files since this roughly equals
-// thread balancing for the backend codegen step.
+// Try to balance the estimated codegen cost of those partitions across N
+// files since this roughly equals thread balancing for the backend codegen
+// step.
 static void findPartitions(Module *M, ClusterIDMapType &ClusterIDMap,
                            unsigned N) {
   // At this point module should have the proper mix of globals and locals.
@@ -93,10 +110,13 @@ static void findPartitions(Module *M, ClusterIDMapType &ClusterIDMap,
     if (!GV.hasName())
       GV.setName("__llvmsplit_unnamed");
 
-    // Comdat groups must not be partitioned. For comdat groups that contain
-    // locals, record all their members here so we can keep them together.
-    // Comdat groups that only contain external globals are already handled by
-    // the MD5-based partitioning.
+    // Record every definition, so that globals with no partitioning
+    // constraints still go through the cost-balanced cluster assignment below
+    // rather than being scattered by name hash.
+    GVtoClusterMap.insert(&GV);
+
+    // Comdat groups must not be partitioned. Record all their members here so
+    // we can keep them together.
     if (const Comdat *C = GV.getComdat()) {
       auto &Member = ComdatMembers[C];
       if (Member)
@@ -129,8 +149,8 @@ static void findPartitions(Module *M, ClusterIDMapType &ClusterIDMap,
   std::for_each(M->global_begin(), M->global_end(), recordGVSet);
   std::for_each(M->alias_begin(), M->alias_end(), recordGVSet);
 
-  // Assigned all GVs to merged clusters while balancing number of objects in
-  // each.
+  // Assigned all GVs to merged clusters while balancing the estimated codegen
+  // cost in each.
   auto CompareClusters = [](const std::pair<unsigned, unsigned> &a,
                             const std::pair<unsigned, unsigned> &b) {
     if (a.second || b.second)
@@ -151,14 +171,18 @@ static void findPartitions(Module *M, ClusterIDMapType &ClusterIDMap,
   SmallVector<SortType, 64> Sets;
   SmallPtrSet<const GlobalValue *, 32> Visited;
 
-  // To guarantee determinism, we have to sort SCC according to size.
-  // When size is the same, use leader's name.
+  // To guarantee determinism, we have to sort SCC according to cost.
+  // When the cost is the same, use leader's name.
   for (ClusterMapType::iterator I = GVtoClusterMap.begin(),
                                 E = GVtoClusterMap.end(); I != E; ++I)
-    if (I->isLeader())
-      Sets.push_back(
-          std::make_pair(std::distance(GVtoClusterMap.member_begin(I),
-                                       GVtoClusterMap.member_end()), I));
+    if (I->isLeader()) {
+      unsigned Cost = 0;
+      for (ClusterMapType::member_iterator MI = GVtoClusterMap.member_begin(I),
+                                           ME = GVtoClusterMap.member_end();
+           MI != ME; ++MI)
+        Cost += getCodeGenCost(**MI);
+      Sets.push_back(std::make_pair(Cost, I));
+    }
 
   std::sort(Sets.begin(), Sets.end(), [](const SortType &a, const SortType &b) {
     if (a.first == b.first)
@@ -169,10 +193,10 @@ static void findPartitions(Module *M, ClusterIDMapType &ClusterIDMap,
 
   for (auto &I : Sets) {
     unsigned CurrentClusterID = BalancinQueue.top().first;
-    unsigned CurrentClusterSize = BalancinQueue.top().second;
+    unsigned CurrentClusterCost = BalancinQueue.top().second;
     BalancinQueue.pop();
 
-    DEBUG(dbgs() << "Root[" << CurrentClusterID << "] cluster_size(" << I.first
+    DEBUG(dbgs() << "Root[" << CurrentClusterID << "] cluster_cost(" << I.first
                  << ") ----> " << I.second->getData()->getName() << "\n");
 
     for (ClusterMapType::member_iterator MI =
@@ -184,10 +208,10 @@ static void findPartitions(Module *M, ClusterIDMapType &ClusterIDMap,
                    << ((*MI)->hasLocalLinkage() ? " l " : " e ") << "\n");
       Visited.insert(*MI);
       ClusterIDMap[*MI] = CurrentClusterID;
-      CurrentClusterSize++;
+      CurrentClusterCost += getCodeGenCost(**MI);
     }
-    // Add this set size to the number of entries in this cluster.
-    BalancinQueue.push(std::make_pair(CurrentClusterID, CurrentClusterSize));
+    // Add this set's cost to the cost of entries in this cluster.
+    BalancinQueue.push(std::make_pair(CurrentClusterID, CurrentClusterCost));
   }
 }
 
@@ -63,6 +63,7 @@
 #include "llvm/Analysis/LoopInfo.h"
 #include "llvm/Analysis/LoopIterator.h"
 #include "llvm/Analysis/LoopPass.h"
+#include "llvm/Analysis/ProfileSummaryInfo.h"
 #include "llvm/Analysis/ScalarEvolutionExpander.h"
 #include "llvm/Analysis/ScalarEvolutionExpressions.h"
 #include "llvm/Analysis/ValueTracking.h"
@@ -2102,6 +2103,18 @@ private:
   /// The data is collected per VF.
   DenseMap<unsigned, SmallPtrSet<Instruction *, 4>> Scalars;
 
+  /// Scalar (VF = 1) instruction costs, memoized across the candidate
+  /// vectorization factors. Uniform-after-vectorization instructions fall
+  /// back to their scalar cost at every VF, and the predication discount
+  /// logic re-queries scalar costs once per VF, so these values are
+  /// requested many times over for loops with several candidate widths.
+  DenseMap<Instruction *, VectorizationCostTy> ScalarInstCosts;
+
+  /// Memoized results of expectedCost, keyed by vectorization factor.
+  /// Interleave count selection re-evaluates the cost of the chosen VF
+  /// after factor selection has already walked the loop for it.
+  SmallDenseMap<unsigned, VectorizationCostTy, 8> CachedLoopCosts;
+
   /// Returns the expected difference in cost from scalarizing the expression
   /// feeding a predicated instruction \p PredInst. The instructions to
   /// scalarize and their scalar costs are collected in \p ScalarCosts. A
@@ -2291,6 +2304,11 @@ struct LoopVectorize : public FunctionPass {
     if (skipFunction(F))
       return false;
 
+    if (getAnalysis<ProfileSummaryInfoWrapperPass>()
+            .getPSI()
+            ->shouldReduceColdFunctionPipeline(&F))
+      return false;
+
     auto *SE = &getAnalysis<ScalarEvolutionWrapperPass>().getSE();
     auto *LI = &getAnalysis<LoopInfoWrapperPass>().getLoopInfo();
     auto *TTI = &getAnalysis<TargetTransformInfoWrapperPass>().getTTI(F);
@@ -2322,6 +2340,7 @@ struct LoopVectorize : public FunctionPass {
     AU.addRequired<LoopAccessLegacyAnalysis>();
     AU.addRequired<DemandedBitsWrapperPass>();
     AU.addRequired<OptimizationRemarkEmitterWrapperPass>();
+    AU.addRequired<ProfileSummaryInfoWrapperPass>();
     AU.addPreserved<LoopInfoWrapperPass>();
     AU.addPreserved<DominatorTreeWrapperPass>();
     AU.addPreserved<BasicAAWrapperPass>();
@@ -6972,6 +6991,13 @@ int LoopVectorizationCostModel::computePredInstDiscount(
 
 LoopVectorizationCostModel::VectorizationCostTy
 LoopVectorizationCostModel::expectedCost(unsigned VF) {
+  // The per-VF collections below are themselves memoized, so a repeated
+  // query (e.g. from interleave count selection) would redo an identical
+  // walk of the loop body; reuse the previous answer instead.
+  auto Cached = CachedLoopCosts.find(VF);
+  if (Cached != CachedLoopCosts.end())
+    return Cached->second;
+
   VectorizationCostTy Cost;
 
   // Collect Uniform and Scalar instructions after vectorization with VF.
@@ -7020,6 +7046,7 @@ LoopVectorizationCostModel::expectedCost(unsigned VF) {
     Cost.second |= BlockCost.second;
   }
 
+  CachedLoopCosts[VF] = Cost;
   return Cost;
 }
 
@@ -7196,12 +7223,23 @@ LoopVectorizationCostModel::getInstructionCost(Instruction *I, unsigned VF) {
   if (VF > 1 && isProfitableToScalarize(I, VF))
     return VectorizationCostTy(InstsToScalarize[VF][I], false);
 
+  // Scalar costs do not depend on the candidate VF, so share them across
+  // all of the widths we evaluate.
+  if (VF == 1) {
+    auto Cached = ScalarInstCosts.find(I);
+    if (Cached != ScalarInstCosts.end())
+      return Cached->second;
+  }
+
   Type *VectorTy;
   unsigned C = getInstructionCost(I, VF, VectorTy);
 
   bool TypeNotScalarized =
       VF > 1 && !VectorTy->isVoidTy() && TTI.getNumberOfParts(VectorTy) < VF;
-  return VectorizationCostTy(C, TypeNotScalarized);
+  VectorizationCostTy Cost(C, TypeNotScalarized);
+  if (VF == 1)
+    ScalarInstCosts[I] = Cost;
+  return Cost;
 }
 
 void LoopVectorizationCostModel::setCostBasedWideningDecision(unsigned VF) {
@@ -7519,6 +7557,7 @@ INITIALIZE_PASS_DEPENDENCY(LoopInfoWrapperPass)
 INITIALIZE_PASS_DEPENDENCY(LoopAccessLegacyAnalysis)
 INITIALIZE_PASS_DEPENDENCY(DemandedBitsWrapperPass)
 INITIALIZE_PASS_DEPENDENCY(OptimizationRemarkEmitterWrapperPass)
+INITIALIZE_PASS_DEPENDENCY(ProfileSummaryInfoWrapperPass)
 INITIALIZE_PASS_END(LoopVectorize, LV_NAME, lv_name, false, false)
 
 namespace llvm {
@@ -7960,6 +7999,13 @@ bool LoopVectorizePass::runImpl(
 
 PreservedAnalyses LoopVectorizePass::run(Function &F,
                                          FunctionAnalysisManager &AM) {
+    const ModuleAnalysisManager &MAM =
+        AM.getResult<ModuleAnalysisManagerFunctionProxy>(F).getManager();
+    if (ProfileSummaryInfo *PSI =
+            MAM.getCachedResult<ProfileSummaryAnalysis>(*F.getParent()))
+      if (PSI->shouldReduceColdFunctionPipeline(&F))
+        return PreservedAnalyses::all();
+
     auto &SE = AM.getResult<ScalarEvolutionAnalysis>(F);
     auto &LI = AM.getResult<LoopAnalysis>(F);
     auto &TTI = AM.getResult<TargetIRAnalysis>(F);
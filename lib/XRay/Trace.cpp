@@ -55,7 +55,7 @@ Error readBinaryFormatHeader(StringRef Data, XRayFileHeader &FileHeader) {
 }
 
 Error loadNaiveFormatLog(StringRef Data, XRayFileHeader &FileHeader,
-                         std::vector<XRayRecord> &Records) {
+                         function_ref<Error(const XRayRecord &)> RecordVisitor) {
   // Check that there is at least a header
   if (Data.size() < 32)
     return make_error<StringError>(
@@ -82,8 +82,7 @@ Error loadNaiveFormatLog(StringRef Data, XRayFileHeader &FileHeader,
   for (auto S = Data.drop_front(32); !S.empty(); S = S.drop_front(32)) {
     DataExtractor RecordExtractor(S, true, 8);
     uint32_t OffsetPtr = 0;
-    Records.emplace_back();
-    auto &Record = Records.back();
+    XRayRecord Record;
     Record.RecordType = RecordExtractor.getU16(&OffsetPtr);
     Record.CPU = RecordExtractor.getU8(&OffsetPtr);
     auto Type = RecordExtractor.getU8(&OffsetPtr);
@@ -102,6 +101,8 @@ Error loadNaiveFormatLog(StringRef Data, XRayFileHeader &FileHeader,
     Record.FuncId = RecordExtractor.getSigned(&OffsetPtr, sizeof(int32_t));
     Record.TSC = RecordExtractor.getU64(&OffsetPtr);
     Record.TId = RecordExtractor.getU32(&OffsetPtr);
+    if (auto E = RecordVisitor(Record))
+      return E;
   }
   return Error::success();
 }
@@ -257,16 +258,17 @@ Error processFDRMetadataRecord(FDRState &State, uint8_t RecordFirstByte,
   return Error::success();
 }
 
-/// Reads a function record from an FDR format log, appending a new XRayRecord
-/// to the vector being populated and updating the State with a new value
-/// reference value to interpret TSC deltas.
+/// Reads a function record from an FDR format log, handing a new XRayRecord
+/// to the visitor and updating the State with a new value reference value to
+/// interpret TSC deltas.
 ///
 /// The XRayRecord constructed includes information from the function record
 /// processed here as well as Thread ID and CPU ID formerly extracted into
 /// State.
 Error processFDRFunctionRecord(FDRState &State, uint8_t RecordFirstByte,
                                DataExtractor &RecordExtractor,
-                               std::vector<XRayRecord> &Records) {
+                               function_ref<Error(const XRayRecord &)>
+                                   RecordVisitor) {
   switch (State.Expects) {
   case FDRState::Token::NEW_BUFFER_RECORD_OR_EOF:
     return make_error<StringError>(
@@ -281,8 +283,7 @@ Error processFDRFunctionRecord(FDRState &State, uint8_t RecordFirstByte,
         "Malformed log. Received Function Record before first CPU record.",
         std::make_error_code(std::errc::executable_format_error));
   default:
-    Records.emplace_back();
-    auto &Record = Records.back();
+    XRayRecord Record;
     Record.RecordType = 0; // Record is type NORMAL.
     // Strip off record type bit and use the next three bits.
     uint8_t RecordType = (RecordFirstByte >> 1) & 0x07;
@@ -320,6 +321,7 @@ Error processFDRFunctionRecord(FDRState &State, uint8_t RecordFirstByte,
     uint64_t new_tsc = State.BaseTSC + RecordExtractor.getU32(&OffsetPtr);
     State.BaseTSC = new_tsc;
     Record.TSC = new_tsc;
+    return RecordVisitor(Record);
   }
   return Error::success();
 }
@@ -351,7 +353,7 @@ Error processFDRFunctionRecord(FDRState &State, uint8_t RecordFirstByte,
 /// TSCWrap: 16 byte metadata record with a full 64 bit TSC reading.
 /// FunctionRecord: 8 byte record with FunctionId, entry/exit, and TSC delta.
 Error loadFDRLog(StringRef Data, XRayFileHeader &FileHeader,
-                 std::vector<XRayRecord> &Records) {
+                 function_ref<Error(const XRayRecord &)> RecordVisitor) {
   if (Data.size() < 32)
     return make_error<StringError>(
         "Not enough bytes for an XRay log.",
@@ -406,7 +408,7 @@ Error loadFDRLog(StringRef Data, XRayFileHeader &FileHeader,
     } else { // Process Function Record
       RecordSize = 8;
       if (auto E = processFDRFunctionRecord(State, BitField, RecordExtractor,
-                                            Records))
+                                            RecordVisitor))
         return E;
       State.CurrentBufferConsumed += RecordSize;
     }
@@ -426,7 +428,7 @@ Error loadFDRLog(StringRef Data, XRayFileHeader &FileHeader,
 }
 
 Error loadYAMLLog(StringRef Data, XRayFileHeader &FileHeader,
-                  std::vector<XRayRecord> &Records) {
+                  function_ref<Error(const XRayRecord &)> RecordVisitor) {
   // Load the documents from the MappedFile.
   YAMLXRayTrace Trace;
   Input In(Data);
@@ -445,16 +447,18 @@ Error loadYAMLLog(StringRef Data, XRayFileHeader &FileHeader,
         Twine("Unsupported XRay file version: ") + Twine(FileHeader.Version),
         std::make_error_code(std::errc::invalid_argument));
 
-  Records.clear();
-  std::transform(Trace.Records.begin(), Trace.Records.end(),
-                 std::back_inserter(Records), [&](const YAMLXRayRecord &R) {
-                   return XRayRecord{R.RecordType, R.CPU, R.Type,
-                                     R.FuncId,     R.TSC, R.TId};
-                 });
+  for (const YAMLXRayRecord &R : Trace.Records) {
+    XRayRecord Record{R.RecordType, R.CPU, R.Type, R.FuncId, R.TSC, R.TId};
+    if (auto E = RecordVisitor(Record))
+      return E;
+  }
   return Error::success();
 }
 
-Expected<Trace> llvm::xray::loadTraceFile(StringRef Filename, bool Sort) {
+/// Map the log in \p Filename and hand the mapped contents to \p Fn. The
+/// mapping only lives for the duration of the call.
+static Error withMappedTraceFile(StringRef Filename,
+                                 function_ref<Error(StringRef)> Fn) {
   int Fd;
   if (auto EC = sys::fs::openFileForRead(Filename, Fd)) {
     return make_error<StringError>(
@@ -482,6 +486,14 @@ Expected<Trace> llvm::xray::loadTraceFile(StringRef Filename, bool Sort) {
         Twine("Cannot read log from '") + Filename + "'", EC);
   }
 
+  return Fn(StringRef(MappedFile.data(), MappedFile.size()));
+}
+
+/// Decode the log in \p Data, filling in \p FileHeader and handing each
+/// decoded record to \p RecordVisitor as it is reached, without buffering.
+static Error visitTraceData(StringRef Data, XRayFileHeader &FileHeader,
+                            function_ref<Error(const XRayRecord &)>
+                                RecordVisitor) {
   // Attempt to detect the file type using file magic. We have a slight bias
   // towards the binary format, and we do this by making sure that the first 4
   // bytes of the binary file is some combination of the following byte
@@ -495,7 +507,7 @@ Expected<Trace> llvm::xray::loadTraceFile(StringRef Filename, bool Sort) {
   //
   // Only if we can't load either the binary or the YAML format will we yield an
   // error.
-  StringRef Magic(MappedFile.data(), 4);
+  StringRef Magic(Data.data(), 4);
   DataExtractor HeaderExtractor(Magic, true, 8);
   uint32_t OffsetPtr = 0;
   uint16_t Version = HeaderExtractor.getU16(&OffsetPtr);
@@ -503,21 +515,23 @@ Expected<Trace> llvm::xray::loadTraceFile(StringRef Filename, bool Sort) {
 
   enum BinaryFormatType { NAIVE_FORMAT = 0, FLIGHT_DATA_RECORDER_FORMAT = 1 };
 
+  if (Version == 1 && Type == NAIVE_FORMAT)
+    return loadNaiveFormatLog(Data, FileHeader, RecordVisitor);
+  if (Version == 1 && Type == FLIGHT_DATA_RECORDER_FORMAT)
+    return loadFDRLog(Data, FileHeader, RecordVisitor);
+  return loadYAMLLog(Data, FileHeader, RecordVisitor);
+}
+
+Expected<Trace> llvm::xray::loadTraceFile(StringRef Filename, bool Sort) {
   Trace T;
-  if (Version == 1 && Type == NAIVE_FORMAT) {
-    if (auto E =
-            loadNaiveFormatLog(StringRef(MappedFile.data(), MappedFile.size()),
-                               T.FileHeader, T.Records))
-      return std::move(E);
-  } else if (Version == 1 && Type == FLIGHT_DATA_RECORDER_FORMAT) {
-    if (auto E = loadFDRLog(StringRef(MappedFile.data(), MappedFile.size()),
-                            T.FileHeader, T.Records))
-      return std::move(E);
-  } else {
-    if (auto E = loadYAMLLog(StringRef(MappedFile.data(), MappedFile.size()),
-                             T.FileHeader, T.Records))
-      return std::move(E);
-  }
+  if (auto E = withMappedTraceFile(Filename, [&](StringRef Data) {
+        return visitTraceData(Data, T.FileHeader,
+                              [&](const XRayRecord &Record) {
+                                T.Records.push_back(Record);
+                                return Error::success();
+                              });
+      }))
+    return std::move(E);
 
   if (Sort)
     std::sort(T.Records.begin(), T.Records.end(),
@@ -527,3 +541,29 @@ Expected<Trace> llvm::xray::loadTraceFile(StringRef Filename, bool Sort) {
 
   return std::move(T);
 }
+
+Error llvm::xray::visitTraceFile(
+    StringRef Filename, function_ref<Error(const XRayFileHeader &)>
+                            HeaderVisitor,
+    function_ref<Error(const XRayRecord &)> RecordVisitor) {
+  return withMappedTraceFile(Filename, [&](StringRef Data) -> Error {
+    XRayFileHeader Header;
+    // The loaders fill in the header before they reach the first record, so
+    // defer the header visit until then; that way the header visitor sees
+    // the complete header, and still runs before any record visit.
+    bool HeaderVisited = false;
+    auto VisitRecord = [&](const XRayRecord &Record) -> Error {
+      if (!HeaderVisited) {
+        HeaderVisited = true;
+        if (auto E = HeaderVisitor(Header))
+          return E;
+      }
+      return RecordVisitor(Record);
+    };
+    if (auto E = visitTraceData(Data, Header, VisitRecord))
+      return E;
+    if (!HeaderVisited)
+      return HeaderVisitor(Header);
+    return Error::success();
+  });
+}
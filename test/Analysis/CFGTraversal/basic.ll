@@ -0,0 +1,24 @@
+; RUN: opt < %s -cfg-traversal -analyze | FileCheck %s
+; RUN: opt < %s -passes='print<cfg-traversal>' 2>&1 | FileCheck %s
+
+; The traversal covers the reachable blocks in reverse post-order; the
+; unreachable block %dead is not visited.
+
+define void @foo(i1 %x) {
+; CHECK: 4 reachable blocks
+; CHECK-NEXT: %entry
+; CHECK-NEXT: %b
+; CHECK-NEXT: %a
+; CHECK-NEXT: %exit
+; CHECK-NOT: %dead
+entry:
+  br i1 %x, label %a, label %b
+a:
+  br label %exit
+b:
+  br label %a
+dead:
+  br label %exit
+exit:
+  ret void
+}
@@ -0,0 +1,28 @@
+; RUN: llc < %s -mtriple=x86_64-unknown-unknown -mattr=+sse2 | FileCheck %s
+
+; Very wide elementwise operations are split straight to legal-width chunks
+; instead of cascading through every intermediate width; the generated code
+; is the same 16 <4 x i32> adds either way.
+
+define <64 x i32> @add64(<64 x i32> %a, <64 x i32> %b) {
+; CHECK-LABEL: add64:
+; CHECK: paddd
+; CHECK: paddd
+; CHECK: paddd
+; CHECK: paddd
+; CHECK: paddd
+; CHECK: paddd
+; CHECK: paddd
+; CHECK: paddd
+; CHECK: paddd
+; CHECK: paddd
+; CHECK: paddd
+; CHECK: paddd
+; CHECK: paddd
+; CHECK: paddd
+; CHECK: paddd
+; CHECK: paddd
+; CHECK: retq
+  %r = add <64 x i32> %a, %b
+  ret <64 x i32> %r
+}
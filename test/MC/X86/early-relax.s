@@ -0,0 +1,30 @@
+// RUN: llvm-mc -filetype=obj -triple x86_64-pc-linux-gnu -mc-early-relax %s -o %t
+// RUN: llvm-objdump -d %t | FileCheck %s
+
+// Backward branches whose target is in reach are emitted in their short form
+// while streaming; everything else must still relax to the same encodings as
+// the default (layout-time) relaxation.
+
+foo:
+	xorl	%eax, %eax
+loop:
+	incl	%eax
+	cmpl	$10, %eax
+// CHECK: 75 f9 {{.*}}jne
+	jne	loop
+// Alignment padding has a computable size and doesn't stop early resolution.
+	.p2align 4
+bar:
+	decl	%eax
+// CHECK: 75 fe {{.*}}jne
+	jne	bar
+// A backward branch out of rel8 range still gets the long form.
+	.fill 130, 1, 0x90
+// CHECK: 0f 85 {{.*}}jne
+	jne	loop
+// Forward branches can't be resolved while streaming and relax as usual.
+// CHECK: 75 {{..}} {{.*}}jne
+	jne	end
+	.fill 10, 1, 0x90
+end:
+	retq
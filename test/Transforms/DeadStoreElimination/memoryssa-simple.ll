@@ -0,0 +1,79 @@
+; RUN: opt < %s -basicaa -dse -enable-dse-memoryssa -S | FileCheck %s
+; RUN: opt < %s -aa-pipeline=basic-aa -passes=dse -enable-dse-memoryssa -S | FileCheck %s
+target datalayout = "e-m:e-i64:64-f80:128-n8:16:32:64-S128"
+
+; A store that is completely shadowed by a later store in the same block is
+; removed.
+define void @same_block(i32* %P) {
+; CHECK-LABEL: @same_block(
+; CHECK-NEXT: store i32 1, i32* %P
+; CHECK-NEXT: ret void
+  store i32 0, i32* %P
+  store i32 1, i32* %P
+  ret void
+}
+
+; Cross-block shadowing is only safe when the memory dies with the function.
+define i32 @cross_block_alloca(i1 %c) {
+; CHECK-LABEL: @cross_block_alloca(
+; CHECK-NOT: store i32 0
+entry:
+  %a = alloca i32
+  store i32 0, i32* %a
+  br i1 %c, label %then, label %join
+
+then:
+  br label %join
+
+join:
+  store i32 1, i32* %a
+  %v = load i32, i32* %a
+  ret i32 %v
+}
+
+; An escaping pointer may be observed on the path that bypasses the second
+; store, so the first one must stay.
+define void @cross_block_escaped(i32* %P, i1 %c) {
+; CHECK-LABEL: @cross_block_escaped(
+; CHECK: store i32 0, i32* %P
+entry:
+  store i32 0, i32* %P
+  br i1 %c, label %then, label %exit
+
+then:
+  store i32 1, i32* %P
+  br label %exit
+
+exit:
+  ret void
+}
+
+; A load of the location between the stores keeps the first store alive.
+define i32 @intervening_load(i32* %P) {
+; CHECK-LABEL: @intervening_load(
+; CHECK: store i32 0, i32* %P
+; CHECK: store i32 1, i32* %P
+  store i32 0, i32* %P
+  %v = load i32, i32* %P
+  store i32 1, i32* %P
+  ret i32 %v
+}
+
+; A narrower later store does not make the wider earlier one dead.
+define void @partial_overwrite(i64* %P) {
+; CHECK-LABEL: @partial_overwrite(
+; CHECK: store i64 0, i64* %P
+  store i64 0, i64* %P
+  %p32 = bitcast i64* %P to i32*
+  store i32 1, i32* %p32
+  ret void
+}
+
+; Volatile stores are never candidates.
+define void @volatile_store(i32* %P) {
+; CHECK-LABEL: @volatile_store(
+; CHECK: store volatile i32 0, i32* %P
+  store volatile i32 0, i32* %P
+  store i32 1, i32* %P
+  ret void
+}
@@ -0,0 +1,56 @@
+; RUN: opt < %s -gvn -gvn-scalability -S | FileCheck %s
+; Check that the scalability mode (per-block leader lookups, restricted
+; repeat iterations) still performs the usual eliminations.
+
+; Fully redundant expression in a dominated block.
+define i32 @test1(i32 %a, i32 %b, i1 %c) {
+; CHECK-LABEL: @test1(
+; CHECK: %add = add i32 %a, %b
+; CHECK-NOT: add i32 %a, %b
+entry:
+  %add = add i32 %a, %b
+  br i1 %c, label %then, label %else
+
+then:
+  %add2 = add i32 %a, %b
+  br label %merge
+
+else:
+  br label %merge
+
+merge:
+  %phi = phi i32 [ %add2, %then ], [ 0, %else ]
+  ret i32 %phi
+}
+
+; Redundant load with no intervening store: the second load is replaced by
+; the first, the sub of equal values folds to zero, and both loads go dead.
+define i32 @test2(i32* %p) {
+; CHECK-LABEL: @test2(
+; CHECK-NOT: load
+; CHECK: ret i32 0
+entry:
+  %l1 = load i32, i32* %p
+  br label %next
+
+next:
+  %l2 = load i32, i32* %p
+  %sub = sub i32 %l1, %l2
+  ret i32 %sub
+}
+
+; Equality propagated from a conditional branch.
+define i32 @test3(i32 %x) {
+; CHECK-LABEL: @test3(
+; CHECK: then:
+; CHECK-NEXT: ret i32 42
+entry:
+  %cmp = icmp eq i32 %x, 42
+  br i1 %cmp, label %then, label %else
+
+then:
+  ret i32 %x
+
+else:
+  ret i32 0
+}
@@ -2,12 +2,12 @@
 ; RUN: llvm-dis -o - %t0 | FileCheck --check-prefix=CHECK0 %s
 ; RUN: llvm-dis -o - %t1 | FileCheck --check-prefix=CHECK1 %s
 
-; CHECK0-DAG: @afoo = alias [2 x i8*], [2 x i8*]* @foo
-; CHECK1-DAG: @afoo = external global [2 x i8*]
+; CHECK1-DAG: @afoo = alias [2 x i8*], [2 x i8*]* @foo
+; CHECK0-DAG: @afoo = external global [2 x i8*]
 @afoo = alias [2 x i8*], [2 x i8*]* @foo
 
-; CHECK0-DAG: declare void @abar()
-; CHECK1-DAG: @abar = alias void (), void ()* @bar
+; CHECK1-DAG: declare void @abar()
+; CHECK0-DAG: @abar = alias void (), void ()* @bar
 @abar = alias void (), void ()* @bar
 
 @foo = global [2 x i8*] [i8* bitcast (void ()* @bar to i8*), i8* bitcast (void ()* @abar to i8*)]
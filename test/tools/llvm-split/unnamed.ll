@@ -2,10 +2,10 @@
 ; RUN: llvm-dis -o - %t0 | FileCheck --check-prefix=CHECK0 %s
 ; RUN: llvm-dis -o - %t1 | FileCheck --check-prefix=CHECK1 %s
 
-; CHECK0: declare hidden void @__llvmsplit_unnamed()
-; CHECK1: define hidden void @__llvmsplit_unnamed()
+; CHECK0: define hidden void @__llvmsplit_unnamed()
+; CHECK1: declare hidden void @__llvmsplit_unnamed()
 define internal void @0() {
-  ; CHECK1: call void @foo()
+  ; CHECK0: call void @foo()
   call void @foo()
   ret void
 }
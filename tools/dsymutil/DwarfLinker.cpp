@@ -38,8 +38,12 @@
 #include "llvm/Support/TargetRegistry.h"
 #include "llvm/Target/TargetMachine.h"
 #include "llvm/Target/TargetOptions.h"
+#include <condition_variable>
+#include <deque>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <tuple>
 
 namespace llvm {
@@ -3416,25 +3420,86 @@ bool DwarfLinker::link(const DebugMap &Map) {
   UnitID = 0;
   DebugMap ModuleMap(Map.getTriple(), Map.getBinaryPath());
 
+  // A debug map object prefetched by the loader thread along with everything
+  // needed to process it. The BinaryHolder keeps the underlying memory
+  // mapping alive until the main thread is done with the object.
+  struct PrefetchedObject {
+    std::unique_ptr<BinaryHolder> Holder;
+    const object::ObjectFile *ObjFile = nullptr;
+    std::unique_ptr<DWARFContextInMemory> DwarfContext;
+  };
+
+  // Loading an object and extracting its DWARF sections is independent of the
+  // link state, so a loader thread prefetches the objects a couple of entries
+  // ahead of the analysis and cloning done on this thread, hiding most of the
+  // I/O and Mach-O parsing latency. Verbose mode stays sequential to keep the
+  // log ordered, and load failures are replayed on the main thread so their
+  // diagnostics come out with the usual context.
+  bool UseLoaderThread = Options.Threads > 1 && !Options.Verbose;
+  std::deque<PrefetchedObject> LoadedObjects;
+  std::mutex LoadedObjectsMutex;
+  std::condition_variable LoadedObjectsCV;
+  const size_t MaxLoadAhead = 2;
+  std::thread LoaderThread;
+  if (UseLoaderThread)
+    LoaderThread = std::thread([&] {
+      for (const auto &Obj : Map.objects()) {
+        PrefetchedObject PO;
+        PO.Holder = llvm::make_unique<BinaryHolder>(/*Verbose=*/false);
+        auto ErrOrObjs = PO.Holder->GetObjectFiles(Obj->getObjectFilename(),
+                                                   Obj->getTimestamp());
+        if (!ErrOrObjs.getError()) {
+          auto ErrOrObj = PO.Holder->Get(Map.getTriple());
+          if (!ErrOrObj.getError()) {
+            PO.ObjFile = &*ErrOrObj;
+            PO.DwarfContext =
+                llvm::make_unique<DWARFContextInMemory>(*PO.ObjFile);
+          }
+        }
+        std::unique_lock<std::mutex> Lock(LoadedObjectsMutex);
+        LoadedObjectsCV.wait(
+            Lock, [&] { return LoadedObjects.size() < MaxLoadAhead; });
+        LoadedObjects.push_back(std::move(PO));
+        LoadedObjectsCV.notify_all();
+      }
+    });
+
   for (const auto &Obj : Map.objects()) {
     CurrentDebugObject = Obj.get();
 
     if (Options.Verbose)
       outs() << "DEBUG MAP OBJECT: " << Obj->getObjectFilename() << "\n";
-    auto ErrOrObj = loadObject(BinHolder, *Obj, Map);
-    if (!ErrOrObj)
-      continue;
+
+    PrefetchedObject PO;
+    if (UseLoaderThread) {
+      std::unique_lock<std::mutex> Lock(LoadedObjectsMutex);
+      LoadedObjectsCV.wait(Lock, [&] { return !LoadedObjects.empty(); });
+      PO = std::move(LoadedObjects.front());
+      LoadedObjects.pop_front();
+      LoadedObjectsCV.notify_all();
+    }
+    if (!PO.ObjFile) {
+      // Either we are single threaded, or the prefetch failed and we reload
+      // here to report the error the usual way. The member BinHolder keeps
+      // caching the enclosing archive across objects in the sequential case.
+      auto ErrOrObj =
+          loadObject(UseLoaderThread ? *PO.Holder : BinHolder, *Obj, Map);
+      if (!ErrOrObj)
+        continue;
+      PO.ObjFile = &*ErrOrObj;
+      PO.DwarfContext = llvm::make_unique<DWARFContextInMemory>(*PO.ObjFile);
+    }
 
     // Look for relocations that correspond to debug map entries.
     RelocationManager RelocMgr(*this);
-    if (!RelocMgr.findValidRelocsInDebugInfo(*ErrOrObj, *Obj)) {
+    if (!RelocMgr.findValidRelocsInDebugInfo(*PO.ObjFile, *Obj)) {
       if (Options.Verbose)
         outs() << "No valid relocations found. Skipping.\n";
       continue;
     }
 
     // Setup access to the debug info.
-    DWARFContextInMemory DwarfContext(*ErrOrObj);
+    DWARFContextInMemory &DwarfContext = *PO.DwarfContext;
     startDebugObject(DwarfContext, *Obj);
 
     // In a first phase, just read in the debug info and load all clang modules.
@@ -3481,6 +3546,9 @@ bool DwarfLinker::link(const DebugMap &Map) {
     endDebugObject();
   }
 
+  if (LoaderThread.joinable())
+    LoaderThread.join();
+
   // Emit everything that's global.
   if (!Options.NoOutput) {
     Streamer->emitAbbrevs(Abbreviations, MaxDwarfVersion);
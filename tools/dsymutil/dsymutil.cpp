@@ -22,10 +22,14 @@
 #include "llvm/Support/Options.h"
 #include "llvm/Support/PrettyStackTrace.h"
 #include "llvm/Support/Signals.h"
+#include "llvm/Support/ThreadPool.h"
 #include "llvm/Support/raw_ostream.h"
 #include "llvm/Support/TargetSelect.h"
+#include <algorithm>
+#include <atomic>
 #include <cstdint>
 #include <string>
+#include <thread>
 
 using namespace llvm::dsymutil;
 
@@ -91,6 +95,14 @@ static opt<bool> DumpDebugMap(
 static opt<bool> InputIsYAMLDebugMap(
     "y", desc("Treat the input file is a YAML debug map rather than a binary."),
     init(false), cat(DsymCategory));
+
+static opt<unsigned> NumThreads(
+    "num-threads",
+    desc("Specifies the maximum number (n) of simultaneous threads to use\n"
+         "when linking multiple architectures."),
+    value_desc("n"), init(0), cat(DsymCategory));
+static alias NumThreadsA("j", desc("Alias for --num-threads"),
+                         aliasopt(NumThreads));
 }
 
 static bool createPlistFile(llvm::StringRef BundleRoot) {
@@ -265,6 +277,9 @@ int main(int argc, char **argv) {
   Options.NoOutput = NoOutput;
   Options.NoODR = NoODR;
   Options.PrependPath = OsoPrependPath;
+  Options.Threads = NumThreads;
+  if (Options.Threads == 0)
+    Options.Threads = std::max(1u, std::thread::hardware_concurrency());
 
   llvm::InitializeAllTargetInfos();
   llvm::InitializeAllTargetMCs();
@@ -314,26 +329,47 @@ int main(int argc, char **argv) {
     // temporary files.
     bool NeedsTempFiles = !DumpDebugMap && (*DebugMapPtrsOrErr).size() != 1;
     llvm::SmallVector<MachOUtils::ArchAndFilename, 4> TempFiles;
-    for (auto &Map : *DebugMapPtrsOrErr) {
-      if (Verbose || DumpDebugMap)
-        Map->print(llvm::outs());
-
-      if (DumpDebugMap)
-        continue;
-
-      if (Map->begin() == Map->end())
-        llvm::errs() << "warning: no debug symbols in executable (-arch "
-                     << MachOUtils::getArchName(Map->getTriple().getArchName())
-                     << ")\n";
-
-      std::string OutputFile = getOutputFileName(InputFile, NeedsTempFiles);
-      if (OutputFile.empty() || !linkDwarf(OutputFile, *Map, Options))
-        exitDsymutil(1);
-
-      if (NeedsTempFiles)
-        TempFiles.emplace_back(Map->getTriple().getArchName().str(),
-                               OutputFile);
+    std::atomic<bool> AllOK(true);
+    {
+      // Each architecture is linked by an independent DwarfLinker writing to
+      // its own output file, so fat binaries can be processed in parallel.
+      // Verbose mode stays on a single thread to keep the log ordered.
+      unsigned ThreadCount = Verbose ? 1 : Options.Threads;
+      ThreadCount = std::min<unsigned>(
+          std::max(1u, ThreadCount), (*DebugMapPtrsOrErr).size());
+      llvm::ThreadPool Pool(ThreadCount);
+
+      for (auto &Map : *DebugMapPtrsOrErr) {
+        if (Verbose || DumpDebugMap)
+          Map->print(llvm::outs());
+
+        if (DumpDebugMap)
+          continue;
+
+        if (Map->begin() == Map->end())
+          llvm::errs()
+              << "warning: no debug symbols in executable (-arch "
+              << MachOUtils::getArchName(Map->getTriple().getArchName())
+              << ")\n";
+
+        std::string OutputFile = getOutputFileName(InputFile, NeedsTempFiles);
+        if (OutputFile.empty())
+          exitDsymutil(1);
+
+        const DebugMap *MapPtr = Map.get();
+        Pool.async([=, &AllOK, &Options] {
+          if (!linkDwarf(OutputFile, *MapPtr, Options))
+            AllOK = false;
+        });
+
+        if (NeedsTempFiles)
+          TempFiles.emplace_back(Map->getTriple().getArchName().str(),
+                                 OutputFile);
+      }
+      Pool.wait();
     }
+    if (!AllOK)
+      exitDsymutil(1);
 
     if (NeedsTempFiles &&
         !MachOUtils::generateUniversalBinary(
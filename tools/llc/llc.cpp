@@ -15,9 +15,11 @@
 
 
 #include "llvm/ADT/STLExtras.h"
+#include "llvm/ADT/StringExtras.h"
 #include "llvm/ADT/Triple.h"
 #include "llvm/Analysis/TargetLibraryInfo.h"
 #include "llvm/CodeGen/CommandFlags.h"
+#include "llvm/CodeGen/ParallelCG.h"
 #include "llvm/CodeGen/LinkAllAsmWriterComponents.h"
 #include "llvm/CodeGen/LinkAllCodegenComponents.h"
 #include "llvm/CodeGen/MIRParser/MIRParser.h"
@@ -33,6 +35,9 @@
 #include "llvm/IR/Module.h"
 #include "llvm/IR/Verifier.h"
 #include "llvm/IRReader/IRReader.h"
+#include "llvm/ADT/StringExtras.h"
+#include "llvm/Bitcode/BitcodeWriter.h"
+#include "llvm/LTO/Caching.h"
 #include "llvm/MC/SubtargetFeature.h"
 #include "llvm/Pass.h"
 #include "llvm/Support/CommandLine.h"
@@ -43,6 +48,7 @@
 #include "llvm/Support/ManagedStatic.h"
 #include "llvm/Support/PluginLoader.h"
 #include "llvm/Support/PrettyStackTrace.h"
+#include "llvm/Support/SHA1.h"
 #include "llvm/Support/Signals.h"
 #include "llvm/Support/SourceMgr.h"
 #include "llvm/Support/TargetRegistry.h"
@@ -51,7 +57,17 @@
 #include "llvm/Target/TargetMachine.h"
 #include "llvm/Target/TargetSubtargetInfo.h"
 #include "llvm/Transforms/Utils/Cloning.h"
+#include "llvm/Config/llvm-config.h"
+#include <cstring>
 #include <memory>
+
+#ifdef LLVM_ON_UNIX
+#include <cerrno>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
 using namespace llvm;
 
 // General options for llc.  Other pass-specific options are specified
@@ -69,6 +85,11 @@ TimeCompilations("time-compilations", cl::Hidden, cl::init(1u),
                  cl::value_desc("N"),
                  cl::desc("Repeat compilation N times for timing"));
 
+static cl::opt<std::string> CompileServerPath(
+    "compile-server", cl::value_desc("socket-path"),
+    cl::desc("Run as a persistent compile server on the given Unix socket, "
+             "keeping target and pass setup warm across requests"));
+
 static cl::opt<bool>
 NoIntegratedAssembler("no-integrated-as", cl::Hidden,
                       cl::desc("Disable integrated assembler"));
@@ -123,6 +144,22 @@ static cl::opt<bool> DiscardValueNames(
     cl::desc("Discard names from Value (other than GlobalValue)."),
     cl::init(false), cl::Hidden);
 
+static cl::opt<unsigned> SplitCodeGenJobs(
+    "split-codegen",
+    cl::desc("Split the module and run this many codegen pipelines in "
+             "parallel. Partition 0 is written to the main output file, "
+             "partition I to <output>.I; linking all of them together is "
+             "equivalent to compiling the module in one piece."),
+    cl::value_desc("N"), cl::init(1));
+
+static cl::opt<std::string> ObjectCacheDir(
+    "object-cache-dir",
+    cl::desc("Cache emitted object files in this directory, keyed on a hash "
+             "of the module's bitcode and the codegen configuration. Warm "
+             "runs replay the cached object instead of re-running the "
+             "backend. Requires -filetype=obj."),
+    cl::value_desc("directory"));
+
 static cl::opt<std::string> StopBefore("stop-before",
     cl::desc("Stop compilation before a specific pass"),
     cl::value_desc("pass-name"), cl::init(""));
@@ -189,6 +226,8 @@ GetOutputStream(const char *TargetName, Triple::OSType OS,
         OutputFilename = IFN.drop_back(3);
       else if (IFN.endswith(".mir"))
         OutputFilename = IFN.drop_back(4);
+      else if (IFN.endswith(".bmir"))
+        OutputFilename = IFN.drop_back(5);
       else
         OutputFilename = IFN;
 
@@ -271,6 +310,110 @@ static void InlineAsmDiagHandler(const SMDiagnostic &SMD, void *Context,
     errs() << "note: !srcloc = " << LocCookie << "\n";
 }
 
+#ifdef LLVM_ON_UNIX
+/// Read a single '\n'-terminated line from FD.  Returns false on EOF or
+/// error.
+static bool readLine(int FD, std::string &Line) {
+  Line.clear();
+  char C;
+  while (true) {
+    ssize_t N = read(FD, &C, 1);
+    if (N <= 0)
+      return false;
+    if (C == '\n')
+      return true;
+    Line.push_back(C);
+  }
+}
+
+static void writeAll(int FD, StringRef S) {
+  while (!S.empty()) {
+    ssize_t N = write(FD, S.data(), S.size());
+    if (N <= 0)
+      return;
+    S = S.drop_front(N);
+  }
+}
+#endif
+
+/// Serve compile requests over a Unix socket until a client asks us to shut
+/// down.  A request is two lines, the input path and the output path; the
+/// reply is "ok\n" or "error\n".  The single line "shutdown" stops the
+/// server.  All remaining options are taken from this server's command line,
+/// so one server handles one flag configuration, which is how build systems
+/// invoke llc anyway.  The expensive per-process state -- target
+/// registration, the pass registry, the TargetMachine and the context's
+/// uniquing tables -- stays warm across requests.
+static int runCompileServer(char **argv, LLVMContext &Context) {
+#ifndef LLVM_ON_UNIX
+  errs() << argv[0] << ": -compile-server is only supported on Unix hosts.\n";
+  return 1;
+#else
+  if (CompileServerPath.size() >= sizeof(sockaddr_un().sun_path)) {
+    errs() << argv[0] << ": -compile-server socket path is too long.\n";
+    return 1;
+  }
+
+  int ServerFD = socket(AF_UNIX, SOCK_STREAM, 0);
+  if (ServerFD < 0) {
+    errs() << argv[0] << ": cannot create server socket.\n";
+    return 1;
+  }
+
+  struct sockaddr_un Addr;
+  std::memset(&Addr, 0, sizeof(Addr));
+  Addr.sun_family = AF_UNIX;
+  std::memcpy(Addr.sun_path, CompileServerPath.c_str(),
+              CompileServerPath.size());
+  // Remove a stale socket left behind by a previous server instance.
+  ::unlink(CompileServerPath.c_str());
+  if (bind(ServerFD, reinterpret_cast<struct sockaddr *>(&Addr),
+           sizeof(Addr)) < 0 ||
+      listen(ServerFD, 16) < 0) {
+    errs() << argv[0] << ": cannot listen on '" << CompileServerPath << "'.\n";
+    close(ServerFD);
+    return 1;
+  }
+
+  while (true) {
+    int ClientFD = accept(ServerFD, nullptr, nullptr);
+    if (ClientFD < 0) {
+      if (errno == EINTR)
+        continue;
+      errs() << argv[0] << ": accept failed, shutting down.\n";
+      break;
+    }
+
+    std::string Input, Output;
+    if (!readLine(ClientFD, Input)) {
+      close(ClientFD);
+      continue;
+    }
+    if (Input == "shutdown") {
+      writeAll(ClientFD, "ok\n");
+      close(ClientFD);
+      break;
+    }
+    if (!readLine(ClientFD, Output)) {
+      writeAll(ClientFD, "error\n");
+      close(ClientFD);
+      continue;
+    }
+
+    InputFilename = Input;
+    OutputFilename = Output;
+    // A failed request must not poison later ones.
+    *static_cast<bool *>(Context.getDiagnosticContext()) = false;
+    writeAll(ClientFD, compileModule(argv, Context) ? "error\n" : "ok\n");
+    close(ClientFD);
+  }
+
+  close(ServerFD);
+  ::unlink(CompileServerPath.c_str());
+  return 0;
+#endif
+}
+
 // main - Entry point for the llc compiler.
 //
 int main(int argc, char **argv) {
@@ -330,6 +473,14 @@ int main(int argc, char **argv) {
         llvm::make_unique<yaml::Output>(YamlFile->os()));
   }
 
+  // In server mode, loop on requests instead of compiling a single module.
+  if (!CompileServerPath.empty()) {
+    int RetVal = runCompileServer(argv, Context);
+    if (YamlFile)
+      YamlFile->keep();
+    return RetVal;
+  }
+
   // Compile the module TimeCompilations times to give better compile time
   // metrics.
   for (unsigned I = TimeCompilations; I; --I)
@@ -395,7 +546,8 @@ static int compileModule(char **argv, LLVMContext &Context) {
 
   // If user just wants to list available options, skip module loading
   if (!SkipModule) {
-    if (StringRef(InputFilename).endswith_lower(".mir")) {
+    if (StringRef(InputFilename).endswith_lower(".mir") ||
+        StringRef(InputFilename).endswith_lower(".bmir")) {
       MIR = createMIRParserFromFile(InputFilename, Err, Context);
       if (MIR)
         M = MIR->parseLLVMModule();
@@ -457,9 +609,21 @@ static int compileModule(char **argv, LLVMContext &Context) {
   Options.MCOptions.IASSearchPaths = IncludeDirs;
   Options.MCOptions.SplitDwarfFile = SplitDwarfFile;
 
-  std::unique_ptr<TargetMachine> Target(
-      TheTarget->createTargetMachine(TheTriple.getTriple(), CPUStr, FeaturesStr,
-                                     Options, getRelocModel(), CMModel, OLvl));
+  // In compile-server mode consecutive requests almost always share the same
+  // target configuration; keep the last TargetMachine alive and reuse it when
+  // the configuration matches.  All other inputs to the construction below
+  // come from command line flags, which are fixed for the process lifetime.
+  static std::unique_ptr<TargetMachine> CachedTarget;
+  static std::string CachedTargetKey;
+  std::string TargetKey =
+      TheTriple.getTriple() + "\n" + CPUStr + "\n" + FeaturesStr;
+  if (!CachedTarget || CachedTargetKey != TargetKey) {
+    CachedTarget.reset(TheTarget->createTargetMachine(
+        TheTriple.getTriple(), CPUStr, FeaturesStr, Options, getRelocModel(),
+        CMModel, OLvl));
+    CachedTargetKey = std::move(TargetKey);
+  }
+  TargetMachine *Target = CachedTarget.get();
 
   assert(Target && "Could not allocate target machine!");
 
@@ -501,16 +665,126 @@ static int compileModule(char **argv, LLVMContext &Context) {
     errs() << argv[0]
              << ": warning: ignoring -mc-relax-all because filetype != obj";
 
+  // Parallel codegen: partition the module with SplitModule and run one
+  // backend pipeline per partition on its own thread.
+  if (SplitCodeGenJobs > 1) {
+    if (MIR || CompileTwice || !RunPassNames->empty() || !StartBefore.empty() ||
+        !StartAfter.empty() || !StopBefore.empty() || !StopAfter.empty()) {
+      errs() << argv[0] << ": -split-codegen is incompatible with -run-pass, "
+                           "-compile-twice and the start/stop-pass options.\n";
+      return 1;
+    }
+    if (StringRef(OutputFilename) == "-") {
+      errs() << argv[0]
+             << ": -split-codegen cannot write to standard output; use -o.\n";
+      return 1;
+    }
+
+    // Partition 0 reuses the main output file; partition I goes to
+    // <output>.I.
+    std::vector<std::unique_ptr<tool_output_file>> ExtraOut;
+    std::vector<raw_pwrite_stream *> OSs;
+    OSs.push_back(&Out->os());
+    for (unsigned I = 1; I != SplitCodeGenJobs; ++I) {
+      std::error_code EC;
+      auto PartOut = llvm::make_unique<tool_output_file>(
+          OutputFilename + "." + utostr(I), EC, sys::fs::F_None);
+      if (EC) {
+        errs() << argv[0] << ": " << EC.message() << '\n';
+        return 1;
+      }
+      OSs.push_back(&PartOut->os());
+      ExtraOut.push_back(std::move(PartOut));
+    }
+
+    // Before running, print the final values of the LLVM options.
+    cl::PrintOptionValues();
+
+    std::string TripleStr = TheTriple.getTriple();
+    splitCodeGen(std::move(M), OSs, {},
+                 [&]() {
+                   return std::unique_ptr<TargetMachine>(
+                       TheTarget->createTargetMachine(TripleStr, CPUStr,
+                                                      FeaturesStr, Options,
+                                                      getRelocModel(), CMModel,
+                                                      OLvl));
+                 },
+                 FileType);
+
+    Out->keep();
+    for (std::unique_ptr<tool_output_file> &PartOut : ExtraOut)
+      PartOut->keep();
+    return 0;
+  }
+
+  // Optional object cache: key the emitted object on the module's bitcode
+  // and the codegen configuration, and replay the cached bytes on a hit.
+  // The backend never runs on a hit, so options that change the pipeline
+  // after this point are refused rather than silently mis-keyed. The cache
+  // entry is only created after codegen succeeds, keeping failed runs out of
+  // the cache.
+  lto::NativeObjectCache Cache;
+  lto::AddStreamFn AddCacheStream;
+  if (!ObjectCacheDir.empty()) {
+    if (FileType != TargetMachine::CGFT_ObjectFile || MIR || CompileTwice ||
+        !RunPassNames->empty() || !StartBefore.empty() || !StartAfter.empty() ||
+        !StopBefore.empty() || !StopAfter.empty()) {
+      errs() << argv[0] << ": -object-cache-dir requires -filetype=obj and is "
+                           "incompatible with MIR input, -compile-twice and "
+                           "the run/start/stop-pass options.\n";
+      return 1;
+    }
+
+    SmallVector<char, 0> BCBuffer;
+    {
+      raw_svector_ostream BCOS(BCBuffer);
+      WriteBitcodeToFile(M.get(), BCOS);
+    }
+    SHA1 Hasher;
+    Hasher.update(StringRef(BCBuffer.data(), BCBuffer.size()));
+    SmallString<128> Conf;
+    {
+      raw_svector_ostream ConfOS(Conf);
+      ConfOS << TheTriple.getTriple() << '\n' << CPUStr << '\n' << FeaturesStr
+             << '\n' << static_cast<int>(OLvl) << '\n'
+             << static_cast<int>(CMModel) << '\n';
+      if (Optional<Reloc::Model> RM = getRelocModel())
+        ConfOS << static_cast<int>(*RM);
+    }
+    Hasher.update(Conf);
+    std::string Key = toHex(Hasher.result());
+
+    Expected<lto::NativeObjectCache> CacheOrErr = lto::localCache(
+        ObjectCacheDir, [&Out](unsigned Task, std::unique_ptr<MemoryBuffer> MB) {
+          Out->os() << MB->getBuffer();
+        });
+    if (!CacheOrErr) {
+      errs() << argv[0] << ": " << toString(CacheOrErr.takeError()) << '\n';
+      return 1;
+    }
+    Cache = std::move(*CacheOrErr);
+
+    AddCacheStream = Cache(0, Key);
+    if (!AddCacheStream) {
+      // Cache hit: the buffer callback above has already replayed the cached
+      // object into the output file.
+      Out->keep();
+      return 0;
+    }
+  }
+
   {
     raw_pwrite_stream *OS = &Out->os();
 
     // Manually do the buffering rather than using buffer_ostream,
-    // so we can memcmp the contents in CompileTwice mode
+    // so we can memcmp the contents in CompileTwice mode.  A cache miss also
+    // buffers, so the emitted object can be written to the cache entry once
+    // codegen has succeeded.
     SmallVector<char, 0> Buffer;
     std::unique_ptr<raw_svector_ostream> BOS;
     if ((FileType != TargetMachine::CGFT_AssemblyFile &&
          !Out->os().supportsSeeking()) ||
-        CompileTwice) {
+        CompileTwice || AddCacheStream) {
       BOS = make_unique<raw_svector_ostream>(Buffer);
       OS = BOS.get();
     }
@@ -523,7 +797,7 @@ static int compileModule(char **argv, LLVMContext &Context) {
         return 1;
       }
       if (!MIR) {
-        errs() << argv[0] << ": run-pass needs a .mir input.\n";
+        errs() << argv[0] << ": run-pass needs a .mir or .bmir input.\n";
         return 1;
       }
       LLVMTargetMachine &LLVMTM = static_cast<LLVMTargetMachine&>(*Target);
@@ -602,7 +876,12 @@ static int compileModule(char **argv, LLVMContext &Context) {
       }
     }
 
-    if (BOS) {
+    if (AddCacheStream) {
+      // Commit the entry; replaying it through the buffer callback writes
+      // the object to the real output file.
+      std::unique_ptr<lto::NativeObjectStream> CacheStream = AddCacheStream(0);
+      *CacheStream->OS << StringRef(Buffer.data(), Buffer.size());
+    } else if (BOS) {
       Out->os() << Buffer;
     }
   }
@@ -9,6 +9,7 @@
 
 #include "OrcLazyJIT.h"
 #include "llvm/ExecutionEngine/Orc/OrcABISupport.h"
+#include "llvm/IR/CallSite.h"
 #include "llvm/Support/Debug.h"
 #include "llvm/Support/DynamicLibrary.h"
 #include <cstdio>
@@ -43,6 +44,45 @@ namespace {
   cl::opt<bool> OrcInlineStubs("orc-lazy-inline-stubs",
                                cl::desc("Try to inline stubs"),
                                cl::init(true), cl::Hidden);
+
+  cl::opt<unsigned> OrcSpeculateDepth(
+      "orc-lazy-speculate-depth",
+      cl::desc("When lazily compiling a function, speculatively compile its "
+               "statically known callees to this call-graph depth as part of "
+               "the same partition (0 = compile strictly on demand)."),
+      cl::init(0), cl::Hidden);
+}
+
+std::set<Function*> OrcLazyJIT::extractPartition(Function &F) {
+  std::set<Function*> Partition;
+  Partition.insert(&F);
+
+  // Walk the statically known call graph breadth-first, adding callees with
+  // bodies to the partition until the speculation depth is exhausted.
+  // Partitions for different roots may overlap; the compile-on-demand layer
+  // repoints the stub of every partition member, so at worst an already
+  // compiled callee is compiled again, never called at a stale address.
+  SmallVector<std::pair<Function*, unsigned>, 8> Worklist;
+  Worklist.push_back(std::make_pair(&F, 0U));
+  while (!Worklist.empty()) {
+    auto Item = Worklist.pop_back_val();
+    if (Item.second >= OrcSpeculateDepth)
+      continue;
+    for (auto &BB : *Item.first)
+      for (auto &I : BB) {
+        CallSite CS(&I);
+        if (!CS)
+          continue;
+        auto *Callee =
+            dyn_cast<Function>(CS.getCalledValue()->stripPointerCasts());
+        if (!Callee || Callee->isDeclaration())
+          continue;
+        if (Partition.insert(Callee).second)
+          Worklist.push_back(std::make_pair(Callee, Item.second + 1));
+      }
+  }
+
+  return Partition;
 }
 
 OrcLazyJIT::TransformFtor OrcLazyJIT::createDebugDumper() {
@@ -49,7 +49,7 @@ public:
 	ObjectLayer(),
         CompileLayer(ObjectLayer, orc::SimpleCompiler(*this->TM)),
         IRDumpLayer(CompileLayer, createDebugDumper()),
-        CODLayer(IRDumpLayer, extractSingleFunction, *this->CCMgr,
+        CODLayer(IRDumpLayer, extractPartition, *this->CCMgr,
                  std::move(IndirectStubsMgrBuilder), InlineStubs),
         CXXRuntimeOverrides(
             [this](const std::string &S) { return mangle(S); }) {}
@@ -145,11 +145,12 @@ private:
     return MangledName;
   }
 
-  static std::set<Function*> extractSingleFunction(Function &F) {
-    std::set<Function*> Partition;
-    Partition.insert(&F);
-    return Partition;
-  }
+  /// Compute the set of functions to extract and compile when F is first
+  /// called. By default this is F alone; with -orc-lazy-speculate-depth it
+  /// also pulls in F's statically known callees up to the requested
+  /// call-graph depth, so they are already compiled when execution reaches
+  /// them.
+  static std::set<Function*> extractPartition(Function &F);
 
   static TransformFtor createDebugDumper();
 
@@ -59,6 +59,11 @@ static cl::opt<bool> PreserveBitcodeUseListOrder(
     cl::desc("Preserve use-list order when writing LLVM bitcode."),
     cl::init(true), cl::Hidden);
 
+static cl::opt<bool>
+    Compress("compress",
+             cl::desc("Write a compressed bitcode container (requires zlib)"),
+             cl::init(false));
+
 static void WriteOutputFile(const Module *M) {
   // Infer the output filename if needed.
   if (OutputFilename.empty()) {
@@ -79,9 +84,14 @@ static void WriteOutputFile(const Module *M) {
     exit(1);
   }
 
-  if (Force || !CheckBitcodeOutputToConsole(Out->os(), true))
-    WriteBitcodeToFile(M, Out->os(), PreserveBitcodeUseListOrder, nullptr,
-                       EmitModuleHash);
+  if (Force || !CheckBitcodeOutputToConsole(Out->os(), true)) {
+    if (Compress)
+      WriteCompressedBitcodeToFile(M, Out->os(), PreserveBitcodeUseListOrder,
+                                   nullptr, EmitModuleHash);
+    else
+      WriteBitcodeToFile(M, Out->os(), PreserveBitcodeUseListOrder, nullptr,
+                         EmitModuleHash);
+  }
 
   // Declare success.
   Out->keep();
@@ -735,9 +735,13 @@ static bool openBitcodeFile(StringRef Path,
                             std::unique_ptr<MemoryBuffer> &MemBuf,
                             BitstreamCursor &Stream,
                             CurStreamTypeType &CurStreamType) {
-  // Read the input file.
+  // Read the input file. The analysis never looks for a null terminator, so
+  // don't ask for one; requiring it forces a copy of the whole file onto the
+  // heap whenever the file size is a multiple of the page size, which defeats
+  // mmap for exactly the large, page-aligned files where it matters most.
   ErrorOr<std::unique_ptr<MemoryBuffer>> MemBufOrErr =
-      MemoryBuffer::getFileOrSTDIN(Path);
+      MemoryBuffer::getFileOrSTDIN(Path, /*FileSize=*/-1,
+                                   /*RequiresNullTerminator=*/false);
   if (std::error_code EC = MemBufOrErr.getError())
     return ReportError(Twine("ReportError reading '") + Path + "': " + EC.message());
   MemBuf = std::move(MemBufOrErr.get());
@@ -17,6 +17,7 @@
 #include "llvm/Support/FileSystem.h"
 #include "llvm/Support/Format.h"
 #include "llvm/Support/Path.h"
+#include "llvm/Support/ThreadPool.h"
 #include <numeric>
 
 using namespace llvm;
@@ -307,6 +308,29 @@ void CoverageReport::renderFunctionReports(ArrayRef<std::string> Files,
   }
 }
 
+/// Compute the coverage summary for a single file. This only reads \p
+/// Coverage, so it's safe to run for several files concurrently.
+static void prepareSingleFileReport(StringRef Filename,
+                                    const coverage::CoverageMapping *Coverage,
+                                    FileCoverageSummary *Summary) {
+  // Map source locations to aggregate function coverage summaries.
+  DenseMap<std::pair<unsigned, unsigned>, FunctionCoverageSummary> Summaries;
+
+  for (const auto &F : Coverage->getCoveredFunctions(Filename)) {
+    FunctionCoverageSummary Function = FunctionCoverageSummary::get(F);
+    auto StartLoc = F.CountedRegions[0].startLoc();
+
+    auto UniquedSummary = Summaries.insert({StartLoc, Function});
+    if (!UniquedSummary.second)
+      UniquedSummary.first->second.update(Function);
+
+    Summary->addInstantiation(Function);
+  }
+
+  for (const auto &UniquedSummary : Summaries)
+    Summary->addFunction(UniquedSummary.second);
+}
+
 std::vector<FileCoverageSummary>
 CoverageReport::prepareFileReports(const coverage::CoverageMapping &Coverage,
                                    FileCoverageSummary &Totals,
@@ -314,33 +338,26 @@ CoverageReport::prepareFileReports(const coverage::CoverageMapping &Coverage,
   std::vector<FileCoverageSummary> FileReports;
   unsigned LCP = getRedundantPrefixLen(Files);
 
-  for (StringRef Filename : Files) {
-    FileCoverageSummary Summary(Filename.drop_front(LCP));
-
-    // Map source locations to aggregate function coverage summaries.
-    DenseMap<std::pair<unsigned, unsigned>, FunctionCoverageSummary> Summaries;
-
-    for (const auto &F : Coverage.getCoveredFunctions(Filename)) {
-      FunctionCoverageSummary Function = FunctionCoverageSummary::get(F);
-      auto StartLoc = F.CountedRegions[0].startLoc();
-
-      auto UniquedSummary = Summaries.insert({StartLoc, Function});
-      if (!UniquedSummary.second)
-        UniquedSummary.first->second.update(Function);
-
-      Summary.addInstantiation(Function);
-      Totals.addInstantiation(Function);
-    }
-
-    for (const auto &UniquedSummary : Summaries) {
-      const FunctionCoverageSummary &FCS = UniquedSummary.second;
-      Summary.addFunction(FCS);
-      Totals.addFunction(FCS);
-    }
-
-    FileReports.push_back(Summary);
+  // The file summaries are independent of each other: prepare them in
+  // parallel, with each task writing into its own slot.
+  FileReports.reserve(Files.size());
+  for (StringRef Filename : Files)
+    FileReports.emplace_back(Filename.drop_front(LCP));
+
+  {
+    ThreadPool Pool;
+    for (unsigned I = 0, E = Files.size(); I != E; ++I)
+      Pool.async(prepareSingleFileReport, StringRef(Files[I]), &Coverage,
+                 &FileReports[I]);
+    Pool.wait();
   }
 
+  // The totals are the fold of the per-file summaries, since each file
+  // summary accumulates exactly the contributions the totals used to receive
+  // directly.
+  for (const FileCoverageSummary &FCS : FileReports)
+    Totals += FCS;
+
   return FileReports;
 }
 
@@ -7,13 +7,15 @@
 //
 //===----------------------------------------------------------------------===//
 
+#include "llvm/ADT/SmallString.h"
+#include "llvm/ADT/StringRef.h"
 #include "llvm/Demangle/Demangle.h"
 #include "llvm/Support/CommandLine.h"
+#include "llvm/Support/MemoryBuffer.h"
 #include "llvm/Support/PrettyStackTrace.h"
 #include "llvm/Support/Signals.h"
 #include "llvm/Support/raw_ostream.h"
 #include <cstdlib>
-#include <iostream>
 
 using namespace llvm;
 
@@ -53,30 +55,48 @@ static cl::alias TypesShort("t", cl::desc("alias for --types"),
 static cl::list<std::string>
 Decorated(cl::Positional, cl::desc("<mangled>"), cl::ZeroOrMore);
 
-static void demangle(llvm::raw_ostream &OS, const std::string &Mangled) {
+// State reused across symbols so bulk demangling settles into a steady
+// state with no per-symbol allocation: the demangler's context keeps its
+// intermediate tables and the output buffer grows to the largest demangled
+// name seen so far.
+static ItaniumDemangleContext *Context;
+static char *OutputBuf = nullptr;
+static size_t OutputBufSize = 0;
+
+static char *demangleWithContext(const char *MangledName) {
   int Status;
+  char *Undecorated =
+      itaniumDemangle(Context, MangledName, OutputBuf, &OutputBufSize, &Status);
+  if (Undecorated)
+    OutputBuf = Undecorated;
+  return Undecorated;
+}
 
-  const char *Decorated = Mangled.c_str();
+static void demangle(llvm::raw_ostream &OS, StringRef Mangled,
+                     SmallVectorImpl<char> &Scratch) {
+  StringRef Decorated = Mangled;
   if (StripUnderscore)
-    if (Decorated[0] == '_')
-      ++Decorated;
-  size_t DecoratedLength = strlen(Decorated);
+    if (Decorated.startswith("_"))
+      Decorated = Decorated.drop_front();
+
+  // The demangler wants a NUL-terminated string and lines coming out of the
+  // bulk reader are not; copy into a scratch buffer reused across lines.
+  Scratch.clear();
+  Scratch.append(Decorated.begin(), Decorated.end());
+  Scratch.push_back('\0');
+  const char *DecoratedCStr = Scratch.data();
 
   char *Undecorated = nullptr;
 
-  if (Types || ((DecoratedLength >= 2 && strncmp(Decorated, "_Z", 2) == 0) ||
-                (DecoratedLength >= 4 && strncmp(Decorated, "___Z", 4) == 0)))
-    Undecorated = itaniumDemangle(Decorated, nullptr, nullptr, &Status);
+  if (Types || Decorated.startswith("_Z") || Decorated.startswith("___Z"))
+    Undecorated = demangleWithContext(DecoratedCStr);
 
-  if (!Undecorated &&
-      (DecoratedLength > 6 && strncmp(Decorated, "__imp_", 6) == 0)) {
+  if (!Undecorated && Decorated.size() > 6 && Decorated.startswith("__imp_")) {
     OS << "import thunk for ";
-    Undecorated = itaniumDemangle(Decorated + 6, nullptr, nullptr, &Status);
+    Undecorated = demangleWithContext(DecoratedCStr + 6);
   }
 
-  OS << (Undecorated ? Undecorated : Mangled) << '\n';
-
-  free(Undecorated);
+  OS << (Undecorated ? StringRef(Undecorated) : Mangled) << '\n';
 }
 
 int main(int argc, char **argv) {
@@ -85,12 +105,31 @@ int main(int argc, char **argv) {
 
   cl::ParseCommandLineOptions(argc, argv, "llvm symbol undecoration tool\n");
 
-  if (Decorated.empty())
-    for (std::string Mangled; std::getline(std::cin, Mangled);)
-      demangle(llvm::outs(), Mangled);
-  else
+  Context = itaniumDemangleContextCreate();
+  SmallString<256> Scratch;
+
+  if (Decorated.empty()) {
+    // Read all of stdin up front and scan for line breaks ourselves rather
+    // than paying a getline allocation per symbol; nm dumps run to millions
+    // of lines.
+    ErrorOr<std::unique_ptr<MemoryBuffer>> BufOrErr = MemoryBuffer::getSTDIN();
+    if (std::error_code EC = BufOrErr.getError()) {
+      errs() << "error: " << EC.message() << '\n';
+      return EXIT_FAILURE;
+    }
+    StringRef Rest = (*BufOrErr)->getBuffer();
+    while (!Rest.empty()) {
+      std::pair<StringRef, StringRef> Split = Rest.split('\n');
+      demangle(llvm::outs(), Split.first, Scratch);
+      Rest = Split.second;
+    }
+  } else {
     for (const auto &Symbol : Decorated)
-      demangle(llvm::outs(), Symbol);
+      demangle(llvm::outs(), Symbol, Scratch);
+  }
+
+  free(OutputBuf);
+  itaniumDemangleContextDestroy(Context);
 
   return EXIT_SUCCESS;
 }
@@ -142,6 +142,9 @@ static ExitOnError ExitOnErr;
 static std::unique_ptr<Module> openInputFile(LLVMContext &Context) {
   std::unique_ptr<MemoryBuffer> MB =
       ExitOnErr(errorOrToExpected(MemoryBuffer::getFileOrSTDIN(InputFilename)));
+  const unsigned char *BufPtr = (const unsigned char *)MB->getBufferStart();
+  if (isCompressedBitcode(BufPtr, BufPtr + MB->getBufferSize()))
+    MB = ExitOnErr(decompressBitcodeBuffer(*MB));
   std::unique_ptr<Module> M =
       ExitOnErr(getOwningLazyBitcodeModule(std::move(MB), Context,
                                            /*ShouldLazyLoadMetadata=*/true));
@@ -161,6 +164,9 @@ int main(int argc, char **argv) {
 
   LLVMContext Context;
   llvm_shutdown_obj Y;  // Call llvm_shutdown() on exit.
+  // Invocations are short-lived; let the OS reclaim the managed statics
+  // rather than tearing them down one by one.
+  llvm_disable_shutdown();
 
   Context.setDiagnosticHandler(diagnosticHandler, argv[0]);
 
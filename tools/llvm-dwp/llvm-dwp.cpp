@@ -38,6 +38,7 @@
 #include "llvm/Support/Options.h"
 #include "llvm/Support/TargetRegistry.h"
 #include "llvm/Support/TargetSelect.h"
+#include "llvm/Support/ThreadPool.h"
 #include "llvm/Support/raw_ostream.h"
 #include "llvm/Target/TargetMachine.h"
 #include <deque>
@@ -57,6 +58,11 @@ static opt<std::string> OutputFilename(Required, "o",
                                        value_desc("filename"),
                                        cat(DwpCategory));
 
+static opt<unsigned>
+    NumThreads("j", desc("Number of threads used to read the input files "
+                         "(0 means hardware concurrency)"),
+               init(0), value_desc("N"), cat(DwpCategory));
+
 static void writeStringsAndOffsets(MCStreamer &Out, DWPStringPool &Strings,
                                    MCSection *StrOffsetSection,
                                    StringRef CurStrSection,
@@ -493,11 +499,40 @@ static Error write(MCStreamer &Out, ArrayRef<std::string> Inputs) {
 
   std::deque<SmallString<32>> UncompressedSections;
 
-  for (const auto &Input : Inputs) {
-    auto ErrOrObj = object::ObjectFile::createObjectFile(Input);
-    if (!ErrOrObj)
-      return ErrOrObj.takeError();
+  // Reading and parsing the input files is independent per input, so farm it
+  // out to a thread pool. The sections are still merged serially below, in
+  // input order, since that phase updates shared output state.
+  std::vector<std::unique_ptr<Expected<OwningBinary<object::ObjectFile>>>>
+      ErrOrObjs(Inputs.size());
+  {
+    ThreadPool Pool(NumThreads ? NumThreads
+                               : std::thread::hardware_concurrency());
+    for (unsigned I = 0, E = Inputs.size(); I != E; ++I)
+      Pool.async(
+          [&](unsigned Idx) {
+            ErrOrObjs[Idx] =
+                llvm::make_unique<Expected<OwningBinary<object::ObjectFile>>>(
+                    object::ObjectFile::createObjectFile(Inputs[Idx]));
+          },
+          I);
+  }
+
+  // Report the first failure in input order; any others still have to be
+  // consumed.
+  Error FirstErr = Error::success();
+  for (auto &ErrOrObj : ErrOrObjs)
+    if (!*ErrOrObj) {
+      if (FirstErr)
+        consumeError(ErrOrObj->takeError());
+      else
+        FirstErr = ErrOrObj->takeError();
+    }
+  if (FirstErr)
+    return FirstErr;
 
+  for (unsigned I = 0, E = Inputs.size(); I != E; ++I) {
+    const std::string &Input = Inputs[I];
+    auto &ErrOrObj = *ErrOrObjs[I];
     auto &Obj = *ErrOrObj->getBinary();
     Objects.push_back(std::move(*ErrOrObj));
 
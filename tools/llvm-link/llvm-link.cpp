@@ -13,6 +13,7 @@
 //===----------------------------------------------------------------------===//
 
 #include "llvm/ADT/STLExtras.h"
+#include "llvm/ADT/StringSet.h"
 #include "llvm/Bitcode/BitcodeWriter.h"
 #include "llvm/IR/AutoUpgrade.h"
 #include "llvm/IR/DiagnosticInfo.h"
@@ -23,6 +24,7 @@
 #include "llvm/IR/Verifier.h"
 #include "llvm/IRReader/IRReader.h"
 #include "llvm/Linker/Linker.h"
+#include "llvm/Object/IRSymtab.h"
 #include "llvm/Object/ModuleSummaryIndexObjectFile.h"
 #include "llvm/Support/CommandLine.h"
 #include "llvm/Support/FileSystem.h"
@@ -80,6 +82,11 @@ static cl::opt<bool>
 static cl::opt<bool>
 OnlyNeeded("only-needed", cl::desc("Link only needed symbols"));
 
+static cl::opt<bool> SymtabResolution(
+    "symtab-resolution",
+    cl::desc("Resolve inputs from their IR symbol tables and skip inputs "
+             "that define no needed symbol"));
+
 static cl::opt<bool>
 Force("f", cl::desc("Enable binary output on terminals"));
 
@@ -268,18 +275,124 @@ static bool importFunctions(const char *argv0, Module &DestModule) {
   return true;
 }
 
+/// Scan the symbol tables of \p Files and decide which of them take part in
+/// the link. The first file is always linked; a later file is pulled in only
+/// if it defines a symbol that is still undefined in the files kept so far,
+/// mirroring how a linker selects members from a static archive. Modules are
+/// loaded lazily and only their global value declarations are read, so no
+/// function body is materialized during resolution. On success the (still
+/// lazy) modules for the kept files are left in \p Mods, with a null entry
+/// for every file that was pruned.
+static bool resolveNeededInputs(const char *argv0, LLVMContext &Context,
+                                const cl::list<std::string> &Files,
+                                std::vector<std::unique_ptr<Module>> &Mods) {
+  std::vector<StringSet<>> DefinedSyms(Files.size());
+  std::vector<StringSet<>> UndefinedSyms(Files.size());
+
+  for (unsigned I = 0, E = Files.size(); I != E; ++I) {
+    std::unique_ptr<Module> M =
+        loadFile(argv0, Files[I], Context, /*MaterializeMetadata=*/false);
+    if (!M.get()) {
+      errs() << argv0 << ": error loading file '" << Files[I] << "'\n";
+      return false;
+    }
+
+    SmallVector<char, 0> Symtab, Strtab;
+    Module *Ms[] = {M.get()};
+    ExitOnErr(irsymtab::build(Ms, Symtab, Strtab));
+    irsymtab::Reader Symbols(StringRef(Symtab.data(), Symtab.size()),
+                             StringRef(Strtab.data(), Strtab.size()));
+    for (const irsymtab::Symbol &Sym : Symbols.symbols()) {
+      if (!Sym.isGlobal() || Sym.isFormatSpecific())
+        continue;
+      (Sym.isUndefined() ? UndefinedSyms : DefinedSyms)[I].insert(
+          Sym.getName());
+    }
+    Mods.push_back(std::move(M));
+  }
+
+  // Resolve the remaining files against the first one in rounds until no new
+  // file is pulled in. Needed holds the symbols that are still undefined,
+  // Provided the symbols defined by some file already kept.
+  std::vector<bool> Kept(Files.size(), false);
+  Kept[0] = true;
+  StringSet<> Needed, Provided;
+  for (const auto &S : DefinedSyms[0])
+    Provided.insert(S.getKey());
+  for (const auto &S : UndefinedSyms[0])
+    if (!Provided.count(S.getKey()))
+      Needed.insert(S.getKey());
+
+  bool Changed = true;
+  while (Changed) {
+    Changed = false;
+    for (unsigned I = 1, E = Files.size(); I != E; ++I) {
+      if (Kept[I])
+        continue;
+      bool DefinesNeeded = false;
+      for (const auto &S : DefinedSyms[I])
+        if (Needed.count(S.getKey())) {
+          DefinesNeeded = true;
+          break;
+        }
+      if (!DefinesNeeded)
+        continue;
+      Kept[I] = true;
+      Changed = true;
+      for (const auto &S : DefinedSyms[I]) {
+        Provided.insert(S.getKey());
+        Needed.erase(S.getKey());
+      }
+      for (const auto &S : UndefinedSyms[I])
+        if (!Provided.count(S.getKey()))
+          Needed.insert(S.getKey());
+    }
+  }
+
+  for (unsigned I = 0, E = Files.size(); I != E; ++I) {
+    if (Kept[I])
+      continue;
+    if (Verbose)
+      errs() << "Pruning '" << Files[I] << "': defines no needed symbol\n";
+    Mods[I].reset();
+  }
+
+  return true;
+}
+
 static bool linkFiles(const char *argv0, LLVMContext &Context, Linker &L,
                       const cl::list<std::string> &Files,
                       unsigned Flags) {
+  // With -symtab-resolution, decide up front which files take part in the
+  // link. Overriding inputs are roots in their own right and are never
+  // pruned.
+  std::vector<std::unique_ptr<Module>> ResolvedMods;
+  bool UseResolution = SymtabResolution && !Files.empty() &&
+                       !(Flags & Linker::Flags::OverrideFromSrc);
+  if (UseResolution && !resolveNeededInputs(argv0, Context, Files, ResolvedMods))
+    return false;
+
   // Filter out flags that don't apply to the first file we load.
   unsigned ApplicableFlags = Flags & Linker::Flags::OverrideFromSrc;
   // Similar to some flags, internalization doesn't apply to the first file.
   bool InternalizeLinkedSymbols = false;
-  for (const auto &File : Files) {
-    std::unique_ptr<Module> M = loadFile(argv0, File, Context);
-    if (!M.get()) {
-      errs() << argv0 << ": error loading file '" << File << "'\n";
-      return false;
+  for (unsigned I = 0, E = Files.size(); I != E; ++I) {
+    const std::string &File = Files[I];
+    std::unique_ptr<Module> M;
+    if (UseResolution) {
+      M = std::move(ResolvedMods[I]);
+      if (!M)
+        continue; // Pruned during symbol resolution.
+      // Resolution deferred the metadata work that loadFile would normally
+      // have done; catch up now that we know the file is linked.
+      ExitOnErr(M->materializeMetadata());
+      UpgradeDebugInfo(*M);
+    } else {
+      M = loadFile(argv0, File, Context);
+      if (!M.get()) {
+        errs() << argv0 << ": error loading file '" << File << "'\n";
+        return false;
+      }
     }
 
     // Note that when ODR merging types cannot verify input files in here When
@@ -40,6 +40,7 @@
 #include "llvm/Support/Program.h"
 #include "llvm/Support/Signals.h"
 #include "llvm/Support/TargetSelect.h"
+#include "llvm/Support/ThreadPool.h"
 #include "llvm/Support/raw_ostream.h"
 #include <algorithm>
 #include <cctype>
@@ -980,23 +981,43 @@ static unsigned getNsectInMachO(MachOObjectFile &Obj, BasicSymbolRef Sym) {
   return (STE.n_type & MachO::N_TYPE) == MachO::N_SECT ? STE.n_sect : 0;
 }
 
-static void
-dumpSymbolNamesFromObject(SymbolicFile &Obj, bool printName,
-                          const std::string &ArchiveName = std::string(),
-                          const std::string &ArchitectureName = std::string()) {
+namespace {
+/// The symbols collected from one symbolic file, together with the storage
+/// that keeps their names alive and any diagnostics that were deferred so
+/// they can be reported in input order.
+struct CollectedSymbols {
+  SymbolListT Symbols;
+  /// Backing store for names that are not slices of the input file: IR and
+  /// COFF import symbols materialize their names through printName().
+  /// Object file symbol names reference the file's string tables in place.
+  std::string NameBuffer;
+  /// The first error hit while reading a symbol name, if any.
+  std::error_code NameEC;
+  /// True when -dynamic was given but the file has no dynamic symbol table.
+  bool MissingDynamicSymtab = false;
+};
+} // anonymous namespace
+
+/// Gather the symbols of \p Obj into \p CS without printing anything, so the
+/// caller can run the collection on a worker thread and emit the output in
+/// input order afterwards. Returns false when there is nothing to print for
+/// this file.
+static bool collectSymbolsFromObject(SymbolicFile &Obj, CollectedSymbols &CS) {
   auto Symbols = Obj.symbols();
   if (DynamicSyms) {
     const auto *E = dyn_cast<ELFObjectFileBase>(&Obj);
     if (!E) {
-      error("File format has no dynamic symbol table", Obj.getFileName());
-      return;
+      CS.MissingDynamicSymtab = true;
+      return false;
     }
     auto DynSymbols = E->getDynamicSymbolIterators();
     Symbols =
         make_range<basic_symbol_iterator>(DynSymbols.begin(), DynSymbols.end());
   }
-  std::string NameBuffer;
-  raw_string_ostream OS(NameBuffer);
+  // Indexes into CS.Symbols of the records whose names live in CS.NameBuffer;
+  // those StringRefs can only be formed once the buffer stops growing.
+  std::vector<size_t> BufferedNames;
+  raw_string_ostream OS(CS.NameBuffer);
   // If a "-s segname sectname" option was specified and this is a Mach-O
   // file get the section number for that section in this object file.
   unsigned int Nsect = 0;
@@ -1005,7 +1026,7 @@ dumpSymbolNamesFromObject(SymbolicFile &Obj, bool printName,
     Nsect = getNsectForSegSect(MachO);
     // If this section is not in the object file no symbols are printed.
     if (Nsect == 0)
-      return;
+      return false;
   }
   for (BasicSymbolRef Sym : Symbols) {
     uint32_t SymFlags = Sym.getFlags();
@@ -1035,23 +1056,60 @@ dumpSymbolNamesFromObject(SymbolicFile &Obj, bool printName,
       S.Address = *AddressOrErr;
     }
     S.TypeChar = getNMTypeChar(Obj, Sym);
-    std::error_code EC = Sym.printName(OS);
-    if (EC && MachO)
-      OS << "bad string index";
-    else
-      error(EC);
-    OS << '\0';
+    if (isa<ObjectFile>(Obj)) {
+      // Object file symbol names are slices of the file's string tables;
+      // point at them in place instead of copying them out.
+      Expected<StringRef> NameOrErr = SymbolRef(Sym).getName();
+      if (NameOrErr)
+        S.Name = *NameOrErr;
+      else {
+        std::error_code EC = errorToErrorCode(NameOrErr.takeError());
+        if (MachO)
+          S.Name = "bad string index";
+        else if (!CS.NameEC)
+          CS.NameEC = EC;
+      }
+    } else {
+      std::error_code EC = Sym.printName(OS);
+      if (EC && !CS.NameEC)
+        CS.NameEC = EC;
+      OS << '\0';
+      BufferedNames.push_back(CS.Symbols.size());
+    }
     S.Sym = Sym;
-    SymbolList.push_back(S);
+    CS.Symbols.push_back(S);
   }
 
   OS.flush();
-  const char *P = NameBuffer.c_str();
-  for (unsigned I = 0; I < SymbolList.size(); ++I) {
-    SymbolList[I].Name = P;
+  const char *P = CS.NameBuffer.c_str();
+  for (size_t SymIndex : BufferedNames) {
+    CS.Symbols[SymIndex].Name = P;
     P += strlen(P) + 1;
   }
+  return true;
+}
 
+/// Report the diagnostics deferred into \p CS at the point the serial code
+/// would have emitted them.
+static void reportCollectedDiagnostics(const CollectedSymbols &CS,
+                                       StringRef Filename) {
+  if (CS.MissingDynamicSymtab)
+    error("File format has no dynamic symbol table", Filename);
+  if (CS.NameEC)
+    error(CS.NameEC);
+}
+
+static void
+dumpSymbolNamesFromObject(SymbolicFile &Obj, bool printName,
+                          const std::string &ArchiveName = std::string(),
+                          const std::string &ArchitectureName = std::string()) {
+  CollectedSymbols CS;
+  bool ShouldPrint = collectSymbolsFromObject(Obj, CS);
+  reportCollectedDiagnostics(CS, Obj.getFileName());
+  if (!ShouldPrint)
+    return;
+
+  SymbolList = std::move(CS.Symbols);
   CurrentFilename = Obj.getFileName();
   sortAndPrintSymbolList(Obj, printName, ArchiveName, ArchitectureName);
 }
@@ -1090,6 +1148,37 @@ static bool checkMachOAndArchFlags(SymbolicFile *O, std::string &Filename) {
   return true;
 }
 
+namespace {
+/// One archive member's symbols, together with the state that keeps the
+/// NMSymbol records valid: the parsed binary and the LLVMContext any bitcode
+/// member is parsed into. Each member gets its own context since contexts
+/// must not be shared across threads.
+struct ArchiveMemberSymbols {
+  std::unique_ptr<LLVMContext> Context;
+  std::unique_ptr<Binary> Bin;
+  CollectedSymbols CS;
+  bool ShouldPrint = false;
+  /// Set when the member could not be opened as a binary.
+  Error Err = Error::success();
+};
+} // anonymous namespace
+
+/// Parse one archive member and gather its symbols. This may run on a worker
+/// thread, so all diagnostics are deferred into \p Member.
+static void collectArchiveMemberSymbols(const Archive::Child &C,
+                                        ArchiveMemberSymbols &Member) {
+  Member.Context.reset(new LLVMContext);
+  Expected<std::unique_ptr<Binary>> ChildOrErr =
+      C.getAsBinary(Member.Context.get());
+  if (!ChildOrErr) {
+    Member.Err = ChildOrErr.takeError();
+    return;
+  }
+  Member.Bin = std::move(*ChildOrErr);
+  if (SymbolicFile *O = dyn_cast<SymbolicFile>(Member.Bin.get()))
+    Member.ShouldPrint = collectSymbolsFromObject(*O, Member.CS);
+}
+
 static void dumpSymbolNamesFromFile(std::string &Filename) {
   ErrorOr<std::unique_ptr<MemoryBuffer>> BufferOrErr =
       MemoryBuffer::getFileOrSTDIN(Filename);
@@ -1128,35 +1217,71 @@ static void dumpSymbolNamesFromFile(std::string &Filename) {
     }
 
     {
+      // Walk the archive headers up front so the per-member work can run in
+      // parallel; parsing the members and reading their symbols is the
+      // CPU-bound part of dumping a large archive. The results are printed
+      // serially in member order afterwards, so the output is identical to
+      // what a serial run produces.
       Error Err = Error::success();
-      for (auto &C : A->children(Err)) {
-        Expected<std::unique_ptr<Binary>> ChildOrErr = C.getAsBinary(&Context);
-        if (!ChildOrErr) {
-          if (auto E = isNotObjectErrorInvalidFileType(ChildOrErr.takeError()))
-            error(std::move(E), Filename, C);
+      std::vector<Archive::Child> Children;
+      for (auto &C : A->children(Err))
+        Children.push_back(C);
+      if (Err) {
+        error(std::move(Err), A->getFileName());
+        return;
+      }
+
+      std::vector<ArchiveMemberSymbols> Members(Children.size());
+#if LLVM_ENABLE_THREADS
+      if (Children.size() > 1) {
+        ThreadPool Pool;
+        for (unsigned I = 0, N = Children.size(); I != N; ++I) {
+          const Archive::Child *C = &Children[I];
+          ArchiveMemberSymbols *Member = &Members[I];
+          Pool.async([C, Member] { collectArchiveMemberSymbols(*C, *Member); });
+        }
+        Pool.wait();
+      } else
+#endif
+        for (unsigned I = 0, N = Children.size(); I != N; ++I)
+          collectArchiveMemberSymbols(Children[I], Members[I]);
+
+      for (unsigned I = 0, N = Children.size(); I != N; ++I) {
+        ArchiveMemberSymbols &Member = Members[I];
+        if (Member.Err) {
+          if (auto E = isNotObjectErrorInvalidFileType(std::move(Member.Err)))
+            error(std::move(E), Filename, Children[I]);
           continue;
         }
-        if (SymbolicFile *O = dyn_cast<SymbolicFile>(&*ChildOrErr.get())) {
-          if (!MachOPrintSizeWarning && PrintSize &&  isa<MachOObjectFile>(O)) {
-            errs() << ToolName << ": warning sizes with -print-size for Mach-O "
-                      "files are always zero.\n";
-            MachOPrintSizeWarning = true;
-          }
-          if (!checkMachOAndArchFlags(O, Filename))
-            return;
-          if (!PrintFileName) {
-            outs() << "\n";
-            if (isa<MachOObjectFile>(O)) {
-              outs() << Filename << "(" << O->getFileName() << ")";
-            } else
-              outs() << O->getFileName();
-            outs() << ":\n";
-          }
-          dumpSymbolNamesFromObject(*O, false, Filename);
+        SymbolicFile *O = dyn_cast_or_null<SymbolicFile>(Member.Bin.get());
+        if (!O)
+          continue;
+        if (!MachOPrintSizeWarning && PrintSize &&  isa<MachOObjectFile>(O)) {
+          errs() << ToolName << ": warning sizes with -print-size for Mach-O "
+                    "files are always zero.\n";
+          MachOPrintSizeWarning = true;
         }
+        if (!checkMachOAndArchFlags(O, Filename)) {
+          // Consume the deferred errors of the members we will not reach.
+          for (unsigned J = I + 1; J != N; ++J)
+            consumeError(std::move(Members[J].Err));
+          return;
+        }
+        if (!PrintFileName) {
+          outs() << "\n";
+          if (isa<MachOObjectFile>(O)) {
+            outs() << Filename << "(" << O->getFileName() << ")";
+          } else
+            outs() << O->getFileName();
+          outs() << ":\n";
+        }
+        reportCollectedDiagnostics(Member.CS, O->getFileName());
+        if (!Member.ShouldPrint)
+          continue;
+        SymbolList = std::move(Member.CS.Symbols);
+        CurrentFilename = O->getFileName();
+        sortAndPrintSymbolList(*O, false, Filename, std::string());
       }
-      if (Err)
-        error(std::move(Err), A->getFileName());
     }
     return;
   }
@@ -1396,6 +1521,9 @@ int main(int argc, char **argv) {
   PrettyStackTraceProgram X(argc, argv);
 
   llvm_shutdown_obj Y; // Call llvm_shutdown() on exit.
+  // Invocations are short-lived; let the OS reclaim the managed statics
+  // rather than tearing them down one by one.
+  llvm_disable_shutdown();
   cl::ParseCommandLineOptions(argc, argv, "llvm symbol table dumper\n");
 
   // llvm-nm only reads binary files.
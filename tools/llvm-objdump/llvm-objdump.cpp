@@ -56,11 +56,13 @@
 #include "llvm/Support/SourceMgr.h"
 #include "llvm/Support/TargetRegistry.h"
 #include "llvm/Support/TargetSelect.h"
+#include "llvm/Support/ThreadPool.h"
 #include "llvm/Support/raw_ostream.h"
 #include <algorithm>
 #include <cctype>
 #include <cstring>
 #include <system_error>
+#include <thread>
 #include <utility>
 #include <unordered_map>
 
@@ -213,6 +215,11 @@ cl::opt<unsigned long long>
 cl::opt<unsigned long long>
     StopAddress("stop-address", cl::desc("Stop disassembly at address"),
                 cl::value_desc("address"), cl::init(UINT64_MAX));
+static cl::opt<unsigned> ParallelDisassembly(
+    "parallel-disassembly",
+    cl::desc("Number of threads used to disassemble sections "
+             "(0 = all hardware threads, default 1)"),
+    cl::value_desc("threads"), cl::init(1));
 static StringRef ToolName;
 
 typedef std::vector<std::tuple<uint64_t, StringRef, uint8_t>> SectionSymbolsTy;
@@ -1167,61 +1174,85 @@ addDynamicElfSymbols(const ObjectFile *Obj,
     llvm_unreachable("Unsupported binary format");
 }
 
-static void DisassembleObject(const ObjectFile *Obj, bool InlineRelocs) {
-  if (StartAddress > StopAddress)
-    error("Start address should be less than stop address");
-
-  const Target *TheTarget = getTarget(Obj);
+namespace {
+// The MC objects needed to disassemble and print one range of a section.
+// Parallel disassembly gives every worker its own set, since disassemblers,
+// instruction printers and MC contexts are not thread safe.
+struct DisassemblerComponents {
+  std::unique_ptr<const MCRegisterInfo> MRI;
+  std::unique_ptr<const MCAsmInfo> AsmInfo;
+  std::unique_ptr<const MCSubtargetInfo> STI;
+  std::unique_ptr<const MCInstrInfo> MII;
+  MCObjectFileInfo MOFI;
+  std::unique_ptr<MCContext> Ctx;
+  std::unique_ptr<MCDisassembler> DisAsm;
+  std::unique_ptr<const MCInstrAnalysis> MIA;
+  std::unique_ptr<MCInstPrinter> IP;
+};
+} // namespace
 
-  // Package up features to be passed to target/subtarget
-  SubtargetFeatures Features = Obj->getFeatures();
-  if (MAttrs.size()) {
-    for (unsigned i = 0; i != MAttrs.size(); ++i)
-      Features.AddFeature(MAttrs[i]);
-  }
+static std::unique_ptr<DisassemblerComponents>
+createDisassemblerComponents(const ObjectFile *Obj, const Target *TheTarget,
+                             const SubtargetFeatures &Features) {
+  auto C = llvm::make_unique<DisassemblerComponents>();
 
-  std::unique_ptr<const MCRegisterInfo> MRI(
-      TheTarget->createMCRegInfo(TripleName));
-  if (!MRI)
+  C->MRI.reset(TheTarget->createMCRegInfo(TripleName));
+  if (!C->MRI)
     report_error(Obj->getFileName(), "no register info for target " +
                  TripleName);
 
   // Set up disassembler.
-  std::unique_ptr<const MCAsmInfo> AsmInfo(
-      TheTarget->createMCAsmInfo(*MRI, TripleName));
-  if (!AsmInfo)
+  C->AsmInfo.reset(TheTarget->createMCAsmInfo(*C->MRI, TripleName));
+  if (!C->AsmInfo)
     report_error(Obj->getFileName(), "no assembly info for target " +
                  TripleName);
-  std::unique_ptr<const MCSubtargetInfo> STI(
+  C->STI.reset(
       TheTarget->createMCSubtargetInfo(TripleName, MCPU, Features.getString()));
-  if (!STI)
+  if (!C->STI)
     report_error(Obj->getFileName(), "no subtarget info for target " +
                  TripleName);
-  std::unique_ptr<const MCInstrInfo> MII(TheTarget->createMCInstrInfo());
-  if (!MII)
+  C->MII.reset(TheTarget->createMCInstrInfo());
+  if (!C->MII)
     report_error(Obj->getFileName(), "no instruction info for target " +
                  TripleName);
-  MCObjectFileInfo MOFI;
-  MCContext Ctx(AsmInfo.get(), MRI.get(), &MOFI);
+  C->Ctx.reset(new MCContext(C->AsmInfo.get(), C->MRI.get(), &C->MOFI));
   // FIXME: for now initialize MCObjectFileInfo with default values
-  MOFI.InitMCObjectFileInfo(Triple(TripleName), false, CodeModel::Default, Ctx);
+  C->MOFI.InitMCObjectFileInfo(Triple(TripleName), false, CodeModel::Default,
+                               *C->Ctx);
 
-  std::unique_ptr<MCDisassembler> DisAsm(
-    TheTarget->createMCDisassembler(*STI, Ctx));
-  if (!DisAsm)
+  C->DisAsm.reset(TheTarget->createMCDisassembler(*C->STI, *C->Ctx));
+  if (!C->DisAsm)
     report_error(Obj->getFileName(), "no disassembler for target " +
                  TripleName);
 
-  std::unique_ptr<const MCInstrAnalysis> MIA(
-      TheTarget->createMCInstrAnalysis(MII.get()));
+  C->MIA.reset(TheTarget->createMCInstrAnalysis(C->MII.get()));
 
-  int AsmPrinterVariant = AsmInfo->getAssemblerDialect();
-  std::unique_ptr<MCInstPrinter> IP(TheTarget->createMCInstPrinter(
-      Triple(TripleName), AsmPrinterVariant, *AsmInfo, *MII, *MRI));
-  if (!IP)
+  int AsmPrinterVariant = C->AsmInfo->getAssemblerDialect();
+  C->IP.reset(TheTarget->createMCInstPrinter(
+      Triple(TripleName), AsmPrinterVariant, *C->AsmInfo, *C->MII, *C->MRI));
+  if (!C->IP)
     report_error(Obj->getFileName(), "no instruction printer for target " +
                  TripleName);
-  IP->setPrintImmHex(PrintImmHex);
+  C->IP->setPrintImmHex(PrintImmHex);
+
+  return C;
+}
+
+static void DisassembleObject(const ObjectFile *Obj, bool InlineRelocs) {
+  if (StartAddress > StopAddress)
+    error("Start address should be less than stop address");
+
+  const Target *TheTarget = getTarget(Obj);
+
+  // Package up features to be passed to target/subtarget
+  SubtargetFeatures Features = Obj->getFeatures();
+  if (MAttrs.size()) {
+    for (unsigned i = 0; i != MAttrs.size(); ++i)
+      Features.AddFeature(MAttrs[i]);
+  }
+
+  std::unique_ptr<DisassemblerComponents> MainC =
+      createDisassemblerComponents(Obj, TheTarget, Features);
   PrettyPrinter &PIP = selectPrettyPrinter(Triple(TripleName));
 
   StringRef Fmt = Obj->getBytesInAddress() > 4 ? "\t\t%016" PRIx64 ":  " :
@@ -1343,12 +1374,13 @@ static void DisassembleObject(const ObjectFile *Obj, bool InlineRelocs) {
     if (Obj->isELF() && Obj->getArch() == Triple::amdgcn) {
       // AMDGPU disassembler uses symbolizer for printing labels
       std::unique_ptr<MCRelocationInfo> RelInfo(
-        TheTarget->createMCRelocationInfo(TripleName, Ctx));
+        TheTarget->createMCRelocationInfo(TripleName, *MainC->Ctx));
       if (RelInfo) {
         std::unique_ptr<MCSymbolizer> Symbolizer(
           TheTarget->createMCSymbolizer(
-            TripleName, nullptr, nullptr, &Symbols, &Ctx, std::move(RelInfo)));
-        DisAsm->setSymbolizer(std::move(Symbolizer));
+            TripleName, nullptr, nullptr, &Symbols, MainC->Ctx.get(),
+            std::move(RelInfo)));
+        MainC->DisAsm->setSymbolizer(std::move(Symbolizer));
       }
     }
 
@@ -1389,278 +1421,370 @@ static void DisassembleObject(const ObjectFile *Obj, bool InlineRelocs) {
                                                             : ELF::STT_OBJECT));
     }
 
-    SmallString<40> Comments;
-    raw_svector_ostream CommentStream(Comments);
-
     StringRef BytesStr;
     error(Section.getContents(BytesStr));
     ArrayRef<uint8_t> Bytes(reinterpret_cast<const uint8_t *>(BytesStr.data()),
                             BytesStr.size());
 
-    uint64_t Size;
-    uint64_t Index;
-
-    std::vector<RelocationRef>::const_iterator rel_cur = Rels.begin();
-    std::vector<RelocationRef>::const_iterator rel_end = Rels.end();
-    // Disassemble symbol by symbol.
-    for (unsigned si = 0, se = Symbols.size(); si != se; ++si) {
-      uint64_t Start = std::get<0>(Symbols[si]) - SectionAddr;
-      // The end is either the section end or the beginning of the next
-      // symbol.
-      uint64_t End =
-          (si == se - 1) ? SectSize : std::get<0>(Symbols[si + 1]) - SectionAddr;
-      // Don't try to disassemble beyond the end of section contents.
-      if (End > SectSize)
-        End = SectSize;
-      // If this symbol has the same address as the next symbol, then skip it.
-      if (Start >= End)
-        continue;
-
-      // Check if we need to skip symbol
-      // Skip if the symbol's data is not between StartAddress and StopAddress
-      if (End + SectionAddr < StartAddress ||
-          Start + SectionAddr > StopAddress) {
-        continue;
+    // Disassemble and print one contiguous range of symbols. All output goes
+    // through OS and the passed-in MC objects so parallel callers can use
+    // private copies.
+    auto DisassembleSymbolRange = [&](unsigned SiBegin, unsigned SiEnd,
+                                      MCDisassembler *DisAsm,
+                                      MCInstPrinter *IP,
+                                      const MCSubtargetInfo *STI,
+                                      const MCInstrAnalysis *MIA,
+                                      SourcePrinter &SP, raw_ostream &OS) {
+      SmallString<40> Comments;
+      raw_svector_ostream CommentStream(Comments);
+
+      uint64_t Size;
+      uint64_t Index;
+
+      std::vector<MCDisassembler::DecodedInst> Batch;
+      SmallString<160> BatchComments;
+
+      std::vector<RelocationRef>::const_iterator rel_cur = Rels.begin();
+      std::vector<RelocationRef>::const_iterator rel_end = Rels.end();
+      // Skip to the first relocation at or past this range; earlier ones
+      // belong to the ranges before it.
+      if (SiBegin != 0) {
+        uint64_t RangeStart = std::get<0>(Symbols[SiBegin]) - SectionAddr;
+        while (rel_cur != rel_end && rel_cur->getOffset() < RangeStart)
+          ++rel_cur;
       }
+      // Disassemble symbol by symbol.
+      for (unsigned si = SiBegin, se = SiEnd; si != se; ++si) {
+        uint64_t Start = std::get<0>(Symbols[si]) - SectionAddr;
+        // The end is either the section end or the beginning of the next
+        // symbol.
+        uint64_t End =
+            (si == se - 1) ? SectSize : std::get<0>(Symbols[si + 1]) - SectionAddr;
+        // Don't try to disassemble beyond the end of section contents.
+        if (End > SectSize)
+          End = SectSize;
+        // If this symbol has the same address as the next symbol, then skip it.
+        if (Start >= End)
+          continue;
 
-      // Stop disassembly at the stop address specified
-      if (End + SectionAddr > StopAddress)
-        End = StopAddress - SectionAddr;
-
-      if (Obj->isELF() && Obj->getArch() == Triple::amdgcn) {
-        // make size 4 bytes folded
-        End = Start + ((End - Start) & ~0x3ull);
-        if (std::get<2>(Symbols[si]) == ELF::STT_AMDGPU_HSA_KERNEL) {
-          // skip amd_kernel_code_t at the begining of kernel symbol (256 bytes)
-          Start += 256;
+        // Check if we need to skip symbol
+        // Skip if the symbol's data is not between StartAddress and StopAddress
+        if (End + SectionAddr < StartAddress ||
+            Start + SectionAddr > StopAddress) {
+          continue;
         }
-        if (si == se - 1 ||
-            std::get<2>(Symbols[si + 1]) == ELF::STT_AMDGPU_HSA_KERNEL) {
-          // cut trailing zeroes at the end of kernel
-          // cut up to 256 bytes
-          const uint64_t EndAlign = 256;
-          const auto Limit = End - (std::min)(EndAlign, End - Start);
-          while (End > Limit &&
-            *reinterpret_cast<const support::ulittle32_t*>(&Bytes[End - 4]) == 0)
-            End -= 4;
+
+        // Stop disassembly at the stop address specified
+        if (End + SectionAddr > StopAddress)
+          End = StopAddress - SectionAddr;
+
+        if (Obj->isELF() && Obj->getArch() == Triple::amdgcn) {
+          // make size 4 bytes folded
+          End = Start + ((End - Start) & ~0x3ull);
+          if (std::get<2>(Symbols[si]) == ELF::STT_AMDGPU_HSA_KERNEL) {
+            // skip amd_kernel_code_t at the begining of kernel symbol (256 bytes)
+            Start += 256;
+          }
+          if (si == se - 1 ||
+              std::get<2>(Symbols[si + 1]) == ELF::STT_AMDGPU_HSA_KERNEL) {
+            // cut trailing zeroes at the end of kernel
+            // cut up to 256 bytes
+            const uint64_t EndAlign = 256;
+            const auto Limit = End - (std::min)(EndAlign, End - Start);
+            while (End > Limit &&
+              *reinterpret_cast<const support::ulittle32_t*>(&Bytes[End - 4]) == 0)
+              End -= 4;
+          }
         }
-      }
 
-      outs() << '\n' << std::get<1>(Symbols[si]) << ":\n";
+        OS << '\n' << std::get<1>(Symbols[si]) << ":\n";
 
 #ifndef NDEBUG
-      raw_ostream &DebugOut = DebugFlag ? dbgs() : nulls();
+        raw_ostream &DebugOut = DebugFlag ? dbgs() : nulls();
 #else
-      raw_ostream &DebugOut = nulls();
+        raw_ostream &DebugOut = nulls();
 #endif
 
-      for (Index = Start; Index < End; Index += Size) {
-        MCInst Inst;
-
-        if (Index + SectionAddr < StartAddress ||
-            Index + SectionAddr > StopAddress) {
-          // skip byte by byte till StartAddress is reached
-          Size = 1;
-          continue;
+        // Ranges without interleaved data can be decoded in one batch up
+        // front, which is cheaper than going through the disassembler's
+        // virtual interface once per instruction.
+        bool UseBatch = !isArmElf(Obj) &&
+                        !(Obj->isELF() &&
+                          std::get<2>(Symbols[si]) == ELF::STT_OBJECT &&
+                          !DisassembleAll && Section.isText()) &&
+                        StartAddress == 0 && StopAddress == UINT64_MAX;
+        size_t BatchIdx = 0;
+        if (UseBatch) {
+          Batch.clear();
+          BatchComments.clear();
+          DisAsm->getInstructions(Batch, BatchComments,
+                                  Bytes.slice(Start, End - Start),
+                                  SectionAddr + Start, DebugOut);
         }
-        // AArch64 ELF binaries can interleave data and text in the
-        // same section. We rely on the markers introduced to
-        // understand what we need to dump. If the data marker is within a
-        // function, it is denoted as a word/short etc
-        if (isArmElf(Obj) && std::get<2>(Symbols[si]) != ELF::STT_OBJECT &&
-            !DisassembleAll) {
-          uint64_t Stride = 0;
-
-          auto DAI = std::lower_bound(DataMappingSymsAddr.begin(),
-                                      DataMappingSymsAddr.end(), Index);
-          if (DAI != DataMappingSymsAddr.end() && *DAI == Index) {
-            // Switch to data.
-            while (Index < End) {
-              outs() << format("%8" PRIx64 ":", SectionAddr + Index);
-              outs() << "\t";
-              if (Index + 4 <= End) {
-                Stride = 4;
-                dumpBytes(Bytes.slice(Index, 4), outs());
-                outs() << "\t.word\t";
-                uint32_t Data = 0;
-                if (Obj->isLittleEndian()) {
-                  const auto Word =
-                      reinterpret_cast<const support::ulittle32_t *>(
-                          Bytes.data() + Index);
-                  Data = *Word;
-                } else {
-                  const auto Word = reinterpret_cast<const support::ubig32_t *>(
-                      Bytes.data() + Index);
-                  Data = *Word;
-                }
-                outs() << "0x" << format("%08" PRIx32, Data);
-              } else if (Index + 2 <= End) {
-                Stride = 2;
-                dumpBytes(Bytes.slice(Index, 2), outs());
-                outs() << "\t\t.short\t";
-                uint16_t Data = 0;
-                if (Obj->isLittleEndian()) {
-                  const auto Short =
-                      reinterpret_cast<const support::ulittle16_t *>(
-                          Bytes.data() + Index);
-                  Data = *Short;
+
+        for (Index = Start; Index < End; Index += Size) {
+          MCInst Inst;
+
+          if (Index + SectionAddr < StartAddress ||
+              Index + SectionAddr > StopAddress) {
+            // skip byte by byte till StartAddress is reached
+            Size = 1;
+            continue;
+          }
+          // AArch64 ELF binaries can interleave data and text in the
+          // same section. We rely on the markers introduced to
+          // understand what we need to dump. If the data marker is within a
+          // function, it is denoted as a word/short etc
+          if (isArmElf(Obj) && std::get<2>(Symbols[si]) != ELF::STT_OBJECT &&
+              !DisassembleAll) {
+            uint64_t Stride = 0;
+
+            auto DAI = std::lower_bound(DataMappingSymsAddr.begin(),
+                                        DataMappingSymsAddr.end(), Index);
+            if (DAI != DataMappingSymsAddr.end() && *DAI == Index) {
+              // Switch to data.
+              while (Index < End) {
+                OS << format("%8" PRIx64 ":", SectionAddr + Index);
+                OS << "\t";
+                if (Index + 4 <= End) {
+                  Stride = 4;
+                  dumpBytes(Bytes.slice(Index, 4), OS);
+                  OS << "\t.word\t";
+                  uint32_t Data = 0;
+                  if (Obj->isLittleEndian()) {
+                    const auto Word =
+                        reinterpret_cast<const support::ulittle32_t *>(
+                            Bytes.data() + Index);
+                    Data = *Word;
+                  } else {
+                    const auto Word = reinterpret_cast<const support::ubig32_t *>(
+                        Bytes.data() + Index);
+                    Data = *Word;
+                  }
+                  OS << "0x" << format("%08" PRIx32, Data);
+                } else if (Index + 2 <= End) {
+                  Stride = 2;
+                  dumpBytes(Bytes.slice(Index, 2), OS);
+                  OS << "\t\t.short\t";
+                  uint16_t Data = 0;
+                  if (Obj->isLittleEndian()) {
+                    const auto Short =
+                        reinterpret_cast<const support::ulittle16_t *>(
+                            Bytes.data() + Index);
+                    Data = *Short;
+                  } else {
+                    const auto Short =
+                        reinterpret_cast<const support::ubig16_t *>(Bytes.data() +
+                                                                    Index);
+                    Data = *Short;
+                  }
+                  OS << "0x" << format("%04" PRIx16, Data);
                 } else {
-                  const auto Short =
-                      reinterpret_cast<const support::ubig16_t *>(Bytes.data() +
-                                                                  Index);
-                  Data = *Short;
+                  Stride = 1;
+                  dumpBytes(Bytes.slice(Index, 1), OS);
+                  OS << "\t\t.byte\t";
+                  OS << "0x" << format("%02" PRIx8, Bytes.slice(Index, 1)[0]);
                 }
-                outs() << "0x" << format("%04" PRIx16, Data);
-              } else {
-                Stride = 1;
-                dumpBytes(Bytes.slice(Index, 1), outs());
-                outs() << "\t\t.byte\t";
-                outs() << "0x" << format("%02" PRIx8, Bytes.slice(Index, 1)[0]);
+                Index += Stride;
+                OS << "\n";
+                auto TAI = std::lower_bound(TextMappingSymsAddr.begin(),
+                                            TextMappingSymsAddr.end(), Index);
+                if (TAI != TextMappingSymsAddr.end() && *TAI == Index)
+                  break;
               }
-              Index += Stride;
-              outs() << "\n";
-              auto TAI = std::lower_bound(TextMappingSymsAddr.begin(),
-                                          TextMappingSymsAddr.end(), Index);
-              if (TAI != TextMappingSymsAddr.end() && *TAI == Index)
-                break;
             }
           }
-        }
 
-        // If there is a data symbol inside an ELF text section and we are only
-        // disassembling text (applicable all architectures),
-        // we are in a situation where we must print the data and not
-        // disassemble it.
-        if (Obj->isELF() && std::get<2>(Symbols[si]) == ELF::STT_OBJECT &&
-            !DisassembleAll && Section.isText()) {
-          // print out data up to 8 bytes at a time in hex and ascii
-          uint8_t AsciiData[9] = {'\0'};
-          uint8_t Byte;
-          int NumBytes = 0;
-
-          for (Index = Start; Index < End; Index += 1) {
-            if (((SectionAddr + Index) < StartAddress) ||
-                ((SectionAddr + Index) > StopAddress))
-              continue;
-            if (NumBytes == 0) {
-              outs() << format("%8" PRIx64 ":", SectionAddr + Index);
-              outs() << "\t";
-            }
-            Byte = Bytes.slice(Index)[0];
-            outs() << format(" %02x", Byte);
-            AsciiData[NumBytes] = isprint(Byte) ? Byte : '.';
-
-            uint8_t IndentOffset = 0;
-            NumBytes++;
-            if (Index == End - 1 || NumBytes > 8) {
-              // Indent the space for less than 8 bytes data.
-              // 2 spaces for byte and one for space between bytes
-              IndentOffset = 3 * (8 - NumBytes);
-              for (int Excess = 8 - NumBytes; Excess < 8; Excess++)
-                AsciiData[Excess] = '\0';
-              NumBytes = 8;
-            }
-            if (NumBytes == 8) {
-              AsciiData[8] = '\0';
-              outs() << std::string(IndentOffset, ' ') << "         ";
-              outs() << reinterpret_cast<char *>(AsciiData);
-              outs() << '\n';
-              NumBytes = 0;
+          // If there is a data symbol inside an ELF text section and we are only
+          // disassembling text (applicable all architectures),
+          // we are in a situation where we must print the data and not
+          // disassemble it.
+          if (Obj->isELF() && std::get<2>(Symbols[si]) == ELF::STT_OBJECT &&
+              !DisassembleAll && Section.isText()) {
+            // print out data up to 8 bytes at a time in hex and ascii
+            uint8_t AsciiData[9] = {'\0'};
+            uint8_t Byte;
+            int NumBytes = 0;
+
+            for (Index = Start; Index < End; Index += 1) {
+              if (((SectionAddr + Index) < StartAddress) ||
+                  ((SectionAddr + Index) > StopAddress))
+                continue;
+              if (NumBytes == 0) {
+                OS << format("%8" PRIx64 ":", SectionAddr + Index);
+                OS << "\t";
+              }
+              Byte = Bytes.slice(Index)[0];
+              OS << format(" %02x", Byte);
+              AsciiData[NumBytes] = isprint(Byte) ? Byte : '.';
+
+              uint8_t IndentOffset = 0;
+              NumBytes++;
+              if (Index == End - 1 || NumBytes > 8) {
+                // Indent the space for less than 8 bytes data.
+                // 2 spaces for byte and one for space between bytes
+                IndentOffset = 3 * (8 - NumBytes);
+                for (int Excess = 8 - NumBytes; Excess < 8; Excess++)
+                  AsciiData[Excess] = '\0';
+                NumBytes = 8;
+              }
+              if (NumBytes == 8) {
+                AsciiData[8] = '\0';
+                OS << std::string(IndentOffset, ' ') << "         ";
+                OS << reinterpret_cast<char *>(AsciiData);
+                OS << '\n';
+                NumBytes = 0;
+              }
             }
           }
-        }
-        if (Index >= End)
-          break;
-
-        // Disassemble a real instruction or a data when disassemble all is
-        // provided
-        bool Disassembled = DisAsm->getInstruction(Inst, Size, Bytes.slice(Index),
-                                                   SectionAddr + Index, DebugOut,
-                                                   CommentStream);
-        if (Size == 0)
-          Size = 1;
-
-        PIP.printInst(*IP, Disassembled ? &Inst : nullptr,
-                      Bytes.slice(Index, Size), SectionAddr + Index, outs(), "",
-                      *STI, &SP);
-        outs() << CommentStream.str();
-        Comments.clear();
-
-        // Try to resolve the target of a call, tail call, etc. to a specific
-        // symbol.
-        if (MIA && (MIA->isCall(Inst) || MIA->isUnconditionalBranch(Inst) ||
-                    MIA->isConditionalBranch(Inst))) {
-          uint64_t Target;
-          if (MIA->evaluateBranch(Inst, SectionAddr + Index, Size, Target)) {
-            // In a relocatable object, the target's section must reside in
-            // the same section as the call instruction or it is accessed
-            // through a relocation.
-            //
-            // In a non-relocatable object, the target may be in any section.
-            //
-            // N.B. We don't walk the relocations in the relocatable case yet.
-            auto *TargetSectionSymbols = &Symbols;
-            if (!Obj->isRelocatableObject()) {
-              auto SectionAddress = std::upper_bound(
-                  SectionAddresses.begin(), SectionAddresses.end(), Target,
-                  [](uint64_t LHS,
-                      const std::pair<uint64_t, SectionRef> &RHS) {
-                    return LHS < RHS.first;
-                  });
-              if (SectionAddress != SectionAddresses.begin()) {
-                --SectionAddress;
-                TargetSectionSymbols = &AllSymbols[SectionAddress->second];
-              } else {
-                TargetSectionSymbols = nullptr;
+          if (Index >= End)
+            break;
+
+          // Disassemble a real instruction or a data when disassemble all is
+          // provided
+          bool Disassembled;
+          StringRef BatchComment;
+          if (UseBatch) {
+            const MCDisassembler::DecodedInst &DI = Batch[BatchIdx++];
+            Inst = DI.Inst;
+            Size = DI.Size;
+            Disassembled = DI.Status != MCDisassembler::Fail;
+            BatchComment = StringRef(BatchComments.data() + DI.CommentOffset,
+                                     DI.CommentSize);
+          } else {
+            Disassembled = DisAsm->getInstruction(Inst, Size, Bytes.slice(Index),
+                                                  SectionAddr + Index, DebugOut,
+                                                  CommentStream);
+            if (Size == 0)
+              Size = 1;
+          }
+
+          PIP.printInst(*IP, Disassembled ? &Inst : nullptr,
+                        Bytes.slice(Index, Size), SectionAddr + Index, OS, "",
+                        *STI, &SP);
+          if (UseBatch) {
+            OS << BatchComment;
+          } else {
+            OS << CommentStream.str();
+            Comments.clear();
+          }
+
+          // Try to resolve the target of a call, tail call, etc. to a specific
+          // symbol.
+          if (MIA && (MIA->isCall(Inst) || MIA->isUnconditionalBranch(Inst) ||
+                      MIA->isConditionalBranch(Inst))) {
+            uint64_t Target;
+            if (MIA->evaluateBranch(Inst, SectionAddr + Index, Size, Target)) {
+              // In a relocatable object, the target's section must reside in
+              // the same section as the call instruction or it is accessed
+              // through a relocation.
+              //
+              // In a non-relocatable object, the target may be in any section.
+              //
+              // N.B. We don't walk the relocations in the relocatable case yet.
+              auto *TargetSectionSymbols = &Symbols;
+              if (!Obj->isRelocatableObject()) {
+                auto SectionAddress = std::upper_bound(
+                    SectionAddresses.begin(), SectionAddresses.end(), Target,
+                    [](uint64_t LHS,
+                        const std::pair<uint64_t, SectionRef> &RHS) {
+                      return LHS < RHS.first;
+                    });
+                if (SectionAddress != SectionAddresses.begin()) {
+                  --SectionAddress;
+                  TargetSectionSymbols = &AllSymbols[SectionAddress->second];
+                } else {
+                  TargetSectionSymbols = nullptr;
+                }
               }
-            }
 
-            // Find the first symbol in the section whose offset is less than
-            // or equal to the target.
-            if (TargetSectionSymbols) {
-              auto TargetSym = std::upper_bound(
-                  TargetSectionSymbols->begin(), TargetSectionSymbols->end(),
-                  Target, [](uint64_t LHS,
-                             const std::tuple<uint64_t, StringRef, uint8_t> &RHS) {
-                    return LHS < std::get<0>(RHS);
-                  });
-              if (TargetSym != TargetSectionSymbols->begin()) {
-                --TargetSym;
-                uint64_t TargetAddress = std::get<0>(*TargetSym);
-                StringRef TargetName = std::get<1>(*TargetSym);
-                outs() << " <" << TargetName;
-                uint64_t Disp = Target - TargetAddress;
-                if (Disp)
-                  outs() << "+0x" << utohexstr(Disp);
-                outs() << '>';
+              // Find the first symbol in the section whose offset is less than
+              // or equal to the target.
+              if (TargetSectionSymbols) {
+                auto TargetSym = std::upper_bound(
+                    TargetSectionSymbols->begin(), TargetSectionSymbols->end(),
+                    Target, [](uint64_t LHS,
+                               const std::tuple<uint64_t, StringRef, uint8_t> &RHS) {
+                      return LHS < std::get<0>(RHS);
+                    });
+                if (TargetSym != TargetSectionSymbols->begin()) {
+                  --TargetSym;
+                  uint64_t TargetAddress = std::get<0>(*TargetSym);
+                  StringRef TargetName = std::get<1>(*TargetSym);
+                  OS << " <" << TargetName;
+                  uint64_t Disp = Target - TargetAddress;
+                  if (Disp)
+                    OS << "+0x" << utohexstr(Disp);
+                  OS << '>';
+                }
               }
             }
           }
-        }
-        outs() << "\n";
-
-        // Print relocation for instruction.
-        while (rel_cur != rel_end) {
-          bool hidden = getHidden(*rel_cur);
-          uint64_t addr = rel_cur->getOffset();
-          SmallString<16> name;
-          SmallString<32> val;
+          OS << "\n";
+
+          // Print relocation for instruction.
+          while (rel_cur != rel_end) {
+            bool hidden = getHidden(*rel_cur);
+            uint64_t addr = rel_cur->getOffset();
+            SmallString<16> name;
+            SmallString<32> val;
+
+            // If this relocation is hidden, skip it.
+            if (hidden || ((SectionAddr + addr) < StartAddress)) {
+              ++rel_cur;
+              continue;
+            }
 
-          // If this relocation is hidden, skip it.
-          if (hidden || ((SectionAddr + addr) < StartAddress)) {
+            // Stop when rel_cur's address is past the current instruction.
+            if (addr >= Index + Size) break;
+            rel_cur->getTypeName(name);
+            error(getRelocationValueString(*rel_cur, val));
+            OS << format(Fmt.data(), SectionAddr + addr) << name
+                   << "\t" << val << "\n";
             ++rel_cur;
-            continue;
           }
-
-          // Stop when rel_cur's address is past the current instruction.
-          if (addr >= Index + Size) break;
-          rel_cur->getTypeName(name);
-          error(getRelocationValueString(*rel_cur, val));
-          outs() << format(Fmt.data(), SectionAddr + addr) << name
-                 << "\t" << val << "\n";
-          ++rel_cur;
         }
       }
+    };
+
+    unsigned ThreadCount = ParallelDisassembly
+                               ? static_cast<unsigned>(ParallelDisassembly)
+                               : std::thread::hardware_concurrency();
+    unsigned NumRanges = Symbols.size();
+    // The AMDGPU symbolizer above configures the shared disassembler, so
+    // that combination stays on one thread.
+    if (ThreadCount == 1 || NumRanges < 2 ||
+        (Obj->isELF() && Obj->getArch() == Triple::amdgcn)) {
+      DisassembleSymbolRange(0, NumRanges, MainC->DisAsm.get(),
+                             MainC->IP.get(), MainC->STI.get(),
+                             MainC->MIA.get(), SP, outs());
+    } else {
+      // Carve the section into contiguous symbol ranges, render each range
+      // on a worker with its own MC objects, and splice the results back
+      // together in order.
+      unsigned NumChunks = std::min(NumRanges, ThreadCount * 4);
+      unsigned ChunkSize = (NumRanges + NumChunks - 1) / NumChunks;
+      std::vector<std::string> ChunkOutput(NumChunks);
+      ThreadPool Pool(ThreadCount);
+      for (unsigned CI = 0; CI != NumChunks; ++CI) {
+        unsigned SiBegin = CI * ChunkSize;
+        unsigned SiEnd = std::min(NumRanges, SiBegin + ChunkSize);
+        if (SiBegin >= SiEnd)
+          continue;
+        std::string *Out = &ChunkOutput[CI];
+        Pool.async([&, SiBegin, SiEnd, Out] {
+          std::unique_ptr<DisassemblerComponents> C =
+              createDisassemblerComponents(Obj, TheTarget, Features);
+          SourcePrinter ChunkSP(Obj, TheTarget->getName());
+          raw_string_ostream ChunkOS(*Out);
+          DisassembleSymbolRange(SiBegin, SiEnd, C->DisAsm.get(), C->IP.get(),
+                                 C->STI.get(), C->MIA.get(), ChunkSP, ChunkOS);
+          ChunkOS.flush();
+        });
+      }
+      Pool.wait();
+      for (const std::string &Chunk : ChunkOutput)
+        outs() << Chunk;
     }
   }
 }
@@ -35,7 +35,7 @@
 
 using namespace llvm;
 
-enum ProfileFormat { PF_None = 0, PF_Text, PF_Binary, PF_GCC };
+enum ProfileFormat { PF_None = 0, PF_Text, PF_Binary, PF_GCC, PF_Indexed_Binary };
 
 static void exitWithError(const Twine &Message, StringRef Whence = "",
                           StringRef Hint = "") {
@@ -129,10 +129,8 @@ struct WriterContext {
         ErrLock(ErrLock), WriterErrorCodes(WriterErrorCodes) {}
 };
 
-/// Load an input into a writer context.
-static void loadInput(const WeightedFile &Input, WriterContext *WC) {
-  std::unique_lock<std::mutex> CtxGuard{WC->Lock};
-
+/// Load an input into a writer context. The caller must hold WC->Lock.
+static void doLoadInput(const WeightedFile &Input, WriterContext *WC) {
   // If there's a pending hard error, don't do more work.
   if (WC->Err)
     return;
@@ -172,6 +170,12 @@ static void loadInput(const WeightedFile &Input, WriterContext *WC) {
     WC->Err = Reader->getError();
 }
 
+/// Load an input into a writer context.
+static void loadInput(const WeightedFile &Input, WriterContext *WC) {
+  std::unique_lock<std::mutex> CtxGuard{WC->Lock};
+  doLoadInput(Input, WC);
+}
+
 /// Merge the \p Src writer context into \p Dst.
 static void mergeWriterContexts(WriterContext *Dst, WriterContext *Src) {
   if (Error E = Dst->Writer.mergeRecordsFromWriter(std::move(Src->Writer)))
@@ -213,11 +217,25 @@ static void mergeInstrProfile(const WeightedFileVector &Inputs,
   } else {
     ThreadPool Pool(NumThreads);
 
-    // Load the inputs in parallel (N/NumThreads serial steps).
-    unsigned Ctx = 0;
+    // Load the inputs in parallel. Each task claims whichever writer context
+    // happens to be free when it runs instead of being bound to one up front,
+    // so a few oversized inputs don't stall a fixed partition while the other
+    // threads sit idle.
     for (const auto &Input : Inputs) {
-      Pool.async(loadInput, Input, Contexts[Ctx].get());
-      Ctx = (Ctx + 1) % NumThreads;
+      Pool.async([&Contexts, Input] {
+        for (;;) {
+          for (std::unique_ptr<WriterContext> &WC : Contexts) {
+            std::unique_lock<std::mutex> CtxGuard(WC->Lock, std::try_to_lock);
+            if (CtxGuard.owns_lock()) {
+              doLoadInput(Input, WC.get());
+              return;
+            }
+          }
+          // There is one context per pool thread, so a context is either free
+          // or about to be released by the task that precedes us.
+          std::this_thread::yield();
+        }
+      });
     }
     Pool.wait();
 
@@ -254,7 +272,7 @@ static void mergeInstrProfile(const WeightedFileVector &Inputs,
 
 static sampleprof::SampleProfileFormat FormatMap[] = {
     sampleprof::SPF_None, sampleprof::SPF_Text, sampleprof::SPF_Binary,
-    sampleprof::SPF_GCC};
+    sampleprof::SPF_GCC, sampleprof::SPF_Indexed_Binary};
 
 static void mergeSampleProfile(const WeightedFileVector &Inputs,
                                StringRef OutputFilename,
@@ -405,7 +423,10 @@ static int merge_main(int argc, const char *argv[]) {
       cl::values(clEnumValN(PF_Binary, "binary", "Binary encoding (default)"),
                  clEnumValN(PF_Text, "text", "Text encoding"),
                  clEnumValN(PF_GCC, "gcc",
-                            "GCC encoding (only meaningful for -sample)")));
+                            "GCC encoding (only meaningful for -sample)"),
+                 clEnumValN(PF_Indexed_Binary, "indexed-binary",
+                            "Indexed binary encoding (only meaningful for "
+                            "-sample)")));
   cl::opt<bool> OutputSparse("sparse", cl::init(false),
       cl::desc("Generate a sparse profile (only meaningful for -instr)"));
   cl::opt<unsigned> NumThreads(
@@ -1568,10 +1568,10 @@ void COFFDumper::printStackMap() const {
 
   if (Obj->isLittleEndian())
     prettyPrintStackMap(
-                      llvm::outs(),
+                      W.getOStream(),
                       StackMapV2Parser<support::little>(StackMapContentsArray));
   else
-    prettyPrintStackMap(llvm::outs(),
+    prettyPrintStackMap(W.getOStream(),
                         StackMapV2Parser<support::big>(StackMapContentsArray));
 }
 
@@ -1827,7 +1827,7 @@ void ELFDumper<ELFT>::printNeededLibraries() {
   std::stable_sort(Libs.begin(), Libs.end());
 
   for (const auto &L : Libs) {
-    outs() << "  " << L << "\n";
+    W.getOStream() << "  " << L << "\n";
   }
 }
 
@@ -1862,7 +1862,7 @@ void ELFDumper<ELFT>::printGnuHashTable() {
 }
 
 template <typename ELFT> void ELFDumper<ELFT>::printLoadName() {
-  outs() << "LoadName: " << SOName << '\n';
+  W.getOStream() << "LoadName: " << SOName << '\n';
 }
 
 template <class ELFT>
@@ -2404,8 +2404,8 @@ template <class ELFT> void ELFDumper<ELFT>::printStackMap() const {
   ArrayRef<uint8_t> StackMapContentsArray =
       unwrapOrError(Obj->getSectionContents(StackMapSection));
 
-  prettyPrintStackMap(llvm::outs(), StackMapV2Parser<ELFT::TargetEndianness>(
-                                        StackMapContentsArray));
+  prettyPrintStackMap(W.getOStream(), StackMapV2Parser<ELFT::TargetEndianness>(
+                                          StackMapContentsArray));
 }
 
 template <class ELFT> void ELFDumper<ELFT>::printGroupSections() {
@@ -668,10 +668,10 @@ void MachODumper::printStackMap() const {
 
   if (Obj->isLittleEndian())
      prettyPrintStackMap(
-                      llvm::outs(),
+                      W.getOStream(),
                       StackMapV2Parser<support::little>(StackMapContentsArray));
   else
-     prettyPrintStackMap(llvm::outs(),
+     prettyPrintStackMap(W.getOStream(),
                          StackMapV2Parser<support::big>(StackMapContentsArray));
 }
 
@@ -39,8 +39,10 @@
 #include "llvm/Support/Signals.h"
 #include "llvm/Support/TargetRegistry.h"
 #include "llvm/Support/TargetSelect.h"
+#include "llvm/Support/ThreadPool.h"
 #include <string>
 #include <system_error>
+#include <thread>
 
 using namespace llvm;
 using namespace llvm::object;
@@ -275,6 +277,15 @@ namespace opts {
              cl::values(clEnumVal(LLVM, "LLVM default style"),
                         clEnumVal(GNU, "GNU readelf style")),
              cl::init(LLVM));
+
+  // -num-threads
+  cl::opt<unsigned>
+      NumThreads("num-threads", cl::init(1),
+                 cl::desc("Number of input files to dump in parallel; output "
+                          "is buffered and emitted in command-line order "
+                          "(0 = one thread per core, 1 = serial)"));
+  cl::alias NumThreadsShort("j", cl::desc("Alias for --num-threads"),
+                            cl::aliasopt(NumThreads));
 } // namespace opts
 
 namespace llvm {
@@ -372,19 +383,19 @@ static std::error_code createDumper(const ObjectFile *Obj,
 }
 
 /// @brief Dumps the specified object file.
-static void dumpObject(const ObjectFile *Obj) {
-  ScopedPrinter Writer(outs());
+static void dumpObject(const ObjectFile *Obj, ScopedPrinter &Writer) {
   std::unique_ptr<ObjDumper> Dumper;
   if (std::error_code EC = createDumper(Obj, Writer, Dumper))
     reportError(Obj->getFileName(), EC);
 
   if (opts::Output == opts::LLVM) {
-    outs() << '\n';
-    outs() << "File: " << Obj->getFileName() << "\n";
-    outs() << "Format: " << Obj->getFileFormatName() << "\n";
-    outs() << "Arch: " << Triple::getArchTypeName(
-                              (llvm::Triple::ArchType)Obj->getArch()) << "\n";
-    outs() << "AddressSize: " << (8 * Obj->getBytesInAddress()) << "bit\n";
+    raw_ostream &OS = Writer.getOStream();
+    OS << '\n';
+    OS << "File: " << Obj->getFileName() << "\n";
+    OS << "Format: " << Obj->getFileFormatName() << "\n";
+    OS << "Arch: " << Triple::getArchTypeName(
+                          (llvm::Triple::ArchType)Obj->getArch()) << "\n";
+    OS << "AddressSize: " << (8 * Obj->getBytesInAddress()) << "bit\n";
     Dumper->printLoadName();
   }
 
@@ -475,7 +486,7 @@ static void dumpObject(const ObjectFile *Obj) {
 }
 
 /// @brief Dumps each object file in \a Arc;
-static void dumpArchive(const Archive *Arc) {
+static void dumpArchive(const Archive *Arc, ScopedPrinter &Writer) {
   Error Err = Error::success();
   for (auto &Child : Arc->children(Err)) {
     Expected<std::unique_ptr<Binary>> ChildOrErr = Child.getAsBinary();
@@ -490,9 +501,9 @@ static void dumpArchive(const Archive *Arc) {
       continue;
     }
     if (ObjectFile *Obj = dyn_cast<ObjectFile>(&*ChildOrErr.get()))
-      dumpObject(Obj);
+      dumpObject(Obj, Writer);
     else if (COFFImportFile *Imp = dyn_cast<COFFImportFile>(&*ChildOrErr.get()))
-      dumpCOFFImportFile(Imp);
+      dumpCOFFImportFile(Imp, Writer);
     else
       reportError(Arc->getFileName(), readobj_error::unrecognized_file_format);
   }
@@ -501,11 +512,12 @@ static void dumpArchive(const Archive *Arc) {
 }
 
 /// @brief Dumps each object file in \a MachO Universal Binary;
-static void dumpMachOUniversalBinary(const MachOUniversalBinary *UBinary) {
+static void dumpMachOUniversalBinary(const MachOUniversalBinary *UBinary,
+                                     ScopedPrinter &Writer) {
   for (const MachOUniversalBinary::ObjectForArch &Obj : UBinary->objects()) {
     Expected<std::unique_ptr<MachOObjectFile>> ObjOrErr = Obj.getAsObjectFile();
     if (ObjOrErr)
-      dumpObject(&*ObjOrErr.get());
+      dumpObject(&*ObjOrErr.get(), Writer);
     else if (auto E = isNotObjectErrorInvalidFileType(ObjOrErr.takeError())) {
       std::string Buf;
       raw_string_ostream OS(Buf);
@@ -514,12 +526,12 @@ static void dumpMachOUniversalBinary(const MachOUniversalBinary *UBinary) {
       reportError(UBinary->getFileName(), Buf);
     }
     else if (Expected<std::unique_ptr<Archive>> AOrErr = Obj.getAsArchive())
-      dumpArchive(&*AOrErr.get());
+      dumpArchive(&*AOrErr.get(), Writer);
   }
 }
 
 /// @brief Opens \a File and dumps it.
-static void dumpInput(StringRef File) {
+static void dumpInput(StringRef File, ScopedPrinter &Writer) {
 
   // Attempt to open the binary.
   Expected<OwningBinary<Binary>> BinaryOrErr = createBinary(File);
@@ -528,14 +540,14 @@ static void dumpInput(StringRef File) {
   Binary &Binary = *BinaryOrErr.get().getBinary();
 
   if (Archive *Arc = dyn_cast<Archive>(&Binary))
-    dumpArchive(Arc);
+    dumpArchive(Arc, Writer);
   else if (MachOUniversalBinary *UBinary =
                dyn_cast<MachOUniversalBinary>(&Binary))
-    dumpMachOUniversalBinary(UBinary);
+    dumpMachOUniversalBinary(UBinary, Writer);
   else if (ObjectFile *Obj = dyn_cast<ObjectFile>(&Binary))
-    dumpObject(Obj);
+    dumpObject(Obj, Writer);
   else if (COFFImportFile *Import = dyn_cast<COFFImportFile>(&Binary))
-    dumpCOFFImportFile(Import);
+    dumpCOFFImportFile(Import, Writer);
   else
     reportError(File, readobj_error::unrecognized_file_format);
 }
@@ -554,8 +566,40 @@ int main(int argc, const char *argv[]) {
   if (opts::InputFilenames.size() == 0)
     opts::InputFilenames.push_back("-");
 
-  std::for_each(opts::InputFilenames.begin(), opts::InputFilenames.end(),
-                dumpInput);
+  unsigned NumThreads = opts::NumThreads;
+  if (NumThreads == 0)
+    NumThreads = std::max(1U, std::thread::hardware_concurrency());
+  // Merging CodeView types folds each input into shared tables in input
+  // order; keep that path serial.
+  if (opts::CodeViewMergedTypes)
+    NumThreads = 1;
+
+  if (NumThreads == 1 || opts::InputFilenames.size() < 2) {
+    ScopedPrinter Writer(outs());
+    for (const std::string &File : opts::InputFilenames)
+      dumpInput(File, Writer);
+  } else {
+    // Dump each input into its own buffer on a pool thread, then emit the
+    // buffers in command-line order so parallel runs produce the same bytes
+    // as serial ones. An error in any input still exits the process, just as
+    // it does when dumping serially.
+    std::vector<std::string> Buffers(opts::InputFilenames.size());
+    {
+      ThreadPool Pool(NumThreads);
+      for (unsigned I = 0, E = opts::InputFilenames.size(); I != E; ++I)
+        Pool.async(
+            [&](unsigned Idx) {
+              raw_string_ostream OS(Buffers[Idx]);
+              ScopedPrinter Writer(OS);
+              dumpInput(opts::InputFilenames[Idx], Writer);
+              OS.flush();
+            },
+            I);
+      Pool.wait();
+    }
+    for (const std::string &Buffer : Buffers)
+      outs() << Buffer;
+  }
 
   if (opts::CodeViewMergedTypes) {
     ScopedPrinter W(outs());
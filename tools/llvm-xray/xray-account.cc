@@ -433,37 +433,46 @@ static CommandRegistration Unused(&Account, []() -> Error {
   llvm::xray::FuncIdConversionHelper FuncIdHelper(AccountInstrMap, Symbolizer,
                                                   FunctionAddresses);
   xray::LatencyAccountant FCA(FuncIdHelper, AccountDeduceSiblingCalls);
-  auto TraceOrErr = loadTraceFile(AccountInput);
-  if (!TraceOrErr)
+
+  // Account each record as it is decoded, so that arbitrarily large traces
+  // are processed in constant memory; only the per-function aggregates are
+  // kept. The header is retained for the exporters below.
+  XRayFileHeader Header;
+  if (auto Err = visitTraceFile(
+          AccountInput,
+          [&](const XRayFileHeader &H) {
+            Header = H;
+            return Error::success();
+          },
+          [&](const XRayRecord &Record) -> Error {
+            if (FCA.accountRecord(Record))
+              return Error::success();
+            for (const auto &ThreadStack : FCA.getPerThreadFunctionStack()) {
+              errs() << "Thread ID: " << ThreadStack.first << "\n";
+              auto Level = ThreadStack.second.size();
+              for (const auto &Entry : llvm::reverse(ThreadStack.second))
+                errs() << "#" << Level-- << "\t"
+                       << FuncIdHelper.SymbolOrNumber(Entry.first) << '\n';
+            }
+            if (!AccountKeepGoing)
+              return make_error<StringError>(
+                  Twine("Failed accounting function calls in file '") +
+                      AccountInput + "'.",
+                  std::make_error_code(std::errc::executable_format_error));
+            return Error::success();
+          }))
     return joinErrors(
         make_error<StringError>(
-            Twine("Failed loading input file '") + AccountInput + "'",
+            Twine("Failed processing input file '") + AccountInput + "'",
             std::make_error_code(std::errc::executable_format_error)),
-        TraceOrErr.takeError());
-
-  auto &T = *TraceOrErr;
-  for (const auto &Record : T) {
-    if (FCA.accountRecord(Record))
-      continue;
-    for (const auto &ThreadStack : FCA.getPerThreadFunctionStack()) {
-      errs() << "Thread ID: " << ThreadStack.first << "\n";
-      auto Level = ThreadStack.second.size();
-      for (const auto &Entry : llvm::reverse(ThreadStack.second))
-        errs() << "#" << Level-- << "\t"
-               << FuncIdHelper.SymbolOrNumber(Entry.first) << '\n';
-    }
-    if (!AccountKeepGoing)
-      return make_error<StringError>(
-          Twine("Failed accounting function calls in file '") + AccountInput +
-              "'.",
-          std::make_error_code(std::errc::executable_format_error));
-  }
+        std::move(Err));
+
   switch (AccountOutputFormat) {
   case AccountOutputFormats::TEXT:
-    FCA.exportStatsAsText(OS, T.getFileHeader());
+    FCA.exportStatsAsText(OS, Header);
     break;
   case AccountOutputFormats::CSV:
-    FCA.exportStatsAsCSV(OS, T.getFileHeader());
+    FCA.exportStatsAsCSV(OS, Header);
     break;
   }
 
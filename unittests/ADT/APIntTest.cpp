@@ -1282,6 +1282,36 @@ TEST(APIntTest, mul_clear) {
   EXPECT_EQ(ValA.toString(10, false), ValC.toString(10, false));
 }
 
+TEST(APIntTest, multiwordCarryChains) {
+  // All-ones words force the add and subtract carry chains to ripple across
+  // every word of a multi-word value.
+  APInt AllOnes = APInt::getAllOnesValue(512);
+  APInt One(512, 1);
+  APInt Zero(512, 0);
+
+  EXPECT_EQ(Zero, AllOnes + One);
+  EXPECT_EQ(AllOnes, Zero - One);
+  EXPECT_EQ(AllOnes, AllOnes - One + One);
+
+  // A carry that starts mid-number: 2^200 - 1 plus one flips bit 200.
+  APInt A = APInt::getLowBitsSet(512, 200);
+  APInt B = A + One;
+  EXPECT_EQ(APInt::getOneBitSet(512, 200), B);
+  EXPECT_EQ(A, B - One);
+
+  // (2^256 - 1)^2 = 2^512 - 2^257 + 1 exercises the word-by-word multiply
+  // with carries out of every partial product.
+  APInt C = APInt::getLowBitsSet(512, 256);
+  EXPECT_EQ(APInt::getBitsSet(512, 257, 512) | One, C * C);
+
+  // Multiply against the shift-add identity on a pattern that fills all
+  // words: X * 3 == (X << 1) + X.
+  APInt X(512, 0);
+  for (unsigned i = 0; i < 512; i += 3)
+    X.setBit(i);
+  EXPECT_EQ(X.shl(1) + X, X * APInt(512, 3));
+}
+
 TEST(APIntTest, Rotate) {
   EXPECT_EQ(APInt(8, 1),  APInt(8, 1).rotl(0));
   EXPECT_EQ(APInt(8, 2),  APInt(8, 1).rotl(1));
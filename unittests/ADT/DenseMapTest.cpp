@@ -101,6 +101,11 @@ typename T::mapped_type *const DenseMapTest<T>::dummy_value_ptr = nullptr;
 typedef ::testing::Types<DenseMap<uint32_t, uint32_t>,
                          DenseMap<uint32_t *, uint32_t *>,
                          DenseMap<CtorTester, CtorTester, CtorTesterMapInfo>,
+                         DenseMap<uint32_t, uint32_t,
+                                  GroupProbedDenseMapInfo<uint32_t>>,
+                         DenseMap<CtorTester, CtorTester,
+                                  GroupProbedDenseMapInfo<CtorTester,
+                                                          CtorTesterMapInfo>>,
                          SmallDenseMap<uint32_t, uint32_t>,
                          SmallDenseMap<uint32_t *, uint32_t *>,
                          SmallDenseMap<CtorTester, CtorTester, 4,
@@ -570,6 +575,24 @@ TEST(DenseMapCustomTest, SmallDenseMapGrowTest) {
   EXPECT_TRUE(map.find(32) == map.end());
 }
 
+// Stress the group-probed bucket layout across several growths, with enough
+// erases to exercise tombstone handling in the control bytes.
+TEST(DenseMapCustomTest, GroupProbedGrowTest) {
+  DenseMap<unsigned, unsigned, GroupProbedDenseMapInfo<unsigned>> map;
+  for (unsigned i = 0; i < 1000; ++i)
+    map[i] = i + 1;
+  for (unsigned i = 0; i < 1000; i += 2)
+    map.erase(i);
+  for (unsigned i = 1000; i < 1100; ++i)
+    map[i] = i + 1;
+
+  EXPECT_EQ(600u, map.size());
+  for (unsigned i = 0; i < 1100; ++i) {
+    bool ShouldBePresent = (i >= 1000) || (i < 1000 && (i & 1));
+    EXPECT_EQ(ShouldBePresent ? i + 1 : 0u, map.lookup(i));
+  }
+}
+
 TEST(DenseMapCustomTest, TryEmplaceTest) {
   DenseMap<int, std::unique_ptr<int>> Map;
   std::unique_ptr<int> P(new int(2));
@@ -191,3 +191,48 @@ TEST(FoldingSetTest, SmallReserveChangesNothing) {
 
 }
 
+
+namespace {
+struct HashedPair : HashedFoldingSetNode {
+  unsigned Key, Value;
+  mutable unsigned Profiles = 0;
+
+  HashedPair(unsigned K, unsigned V) : Key(K), Value(V) {}
+
+  void Profile(FoldingSetNodeID &ID) const {
+    ++Profiles;
+    ID.AddInteger(Key);
+    ID.AddInteger(Value);
+  }
+};
+} // end anonymous namespace
+
+namespace llvm {
+template <>
+struct FoldingSetTrait<HashedPair> : HashedFoldingSetTrait<HashedPair> {};
+} // end namespace llvm
+
+namespace {
+TEST(FoldingSetTest, HashedNodeCachesHash) {
+  FoldingSet<HashedPair> Set;
+  HashedPair A(1, 2), B(3, 4);
+  Set.InsertNode(&A);
+  Set.InsertNode(&B);
+
+  // Insertion computes and caches each node's profile hash.
+  EXPECT_TRUE(A.hasCachedProfileHash());
+  EXPECT_TRUE(B.hasCachedProfileHash());
+
+  // Growing the table reuses the cached hashes instead of re-profiling.
+  unsigned ProfilesBefore = A.Profiles + B.Profiles;
+  Set.reserve(1024);
+  EXPECT_EQ(ProfilesBefore, A.Profiles + B.Profiles);
+
+  // The nodes are still found under their cached hashes.
+  FoldingSetNodeID ID;
+  ID.AddInteger(1u);
+  ID.AddInteger(2u);
+  void *InsertPos = nullptr;
+  EXPECT_EQ(&A, Set.FindNodeOrInsertPos(ID, InsertPos));
+}
+} // end anonymous namespace
@@ -8,8 +8,11 @@
 //===----------------------------------------------------------------------===//
 
 #include "llvm/Analysis/CallGraph.h"
+#include "llvm/AsmParser/Parser.h"
 #include "llvm/IR/LLVMContext.h"
 #include "llvm/IR/Module.h"
+#include "llvm/Support/FileSystem.h"
+#include "llvm/Support/SourceMgr.h"
 #include "gtest/gtest.h"
 
 using namespace llvm;
@@ -58,4 +61,70 @@ TEST(CallGraphTest, GraphTraitsConstSpecialization) {
 
   canSpecializeGraphTraitsIterators(const_cast<const CallGraph *>(&CG));
 }
+
+static std::unique_ptr<Module> parseIR(LLVMContext &C, const char *IR) {
+  SMDiagnostic Err;
+  return parseAssemblyString(IR, Err, C);
+}
+
+TEST(CallGraphTest, ReadFromCache) {
+  LLVMContext Context;
+  std::unique_ptr<Module> M = parseIR(Context, "define void @foo() {\n"
+                                               "  call void @bar()\n"
+                                               "  call void @ext()\n"
+                                               "  ret void\n"
+                                               "}\n"
+                                               "define internal void @bar() {\n"
+                                               "  ret void\n"
+                                               "}\n"
+                                               "declare void @ext()\n");
+  ASSERT_TRUE(M);
+  CallGraph CG(*M);
+
+  SmallString<128> CachePath;
+  ASSERT_FALSE(sys::fs::createTemporaryFile("callgraph", "cache", CachePath));
+  ASSERT_FALSE(CG.writeToCache(CachePath));
+
+  // An unchanged module gets its edges back from the cache.
+  std::unique_ptr<CallGraph> Cached = CallGraph::readFromCache(*M, CachePath);
+  ASSERT_TRUE(Cached);
+  CallGraphNode *FooNode = (*Cached)[M->getFunction("foo")];
+  ASSERT_EQ(2U, FooNode->size());
+  EXPECT_EQ((*Cached)[M->getFunction("bar")], (*FooNode)[0]);
+  EXPECT_EQ((*Cached)[M->getFunction("ext")], (*FooNode)[1]);
+  CallGraphNode *ExtNode = (*Cached)[M->getFunction("ext")];
+  ASSERT_EQ(1U, ExtNode->size());
+  EXPECT_EQ(Cached->getCallsExternalNode(), (*ExtNode)[0]);
+
+  // A function whose body changed is rescanned rather than trusted.
+  std::unique_ptr<Module> M2 = parseIR(Context, "define void @foo() {\n"
+                                                "  call void @bar()\n"
+                                                "  call void @bar()\n"
+                                                "  call void @ext()\n"
+                                                "  ret void\n"
+                                                "}\n"
+                                                "define internal void @bar() {\n"
+                                                "  ret void\n"
+                                                "}\n"
+                                                "declare void @ext()\n");
+  ASSERT_TRUE(M2);
+  std::unique_ptr<CallGraph> Patched = CallGraph::readFromCache(*M2, CachePath);
+  ASSERT_TRUE(Patched);
+  EXPECT_EQ(3U, (*Patched)[M2->getFunction("foo")]->size());
+
+  // A renamed function invalidates the whole cache.
+  std::unique_ptr<Module> M3 = parseIR(Context, "define void @foo() {\n"
+                                                "  call void @baz()\n"
+                                                "  call void @ext()\n"
+                                                "  ret void\n"
+                                                "}\n"
+                                                "define internal void @baz() {\n"
+                                                "  ret void\n"
+                                                "}\n"
+                                                "declare void @ext()\n");
+  ASSERT_TRUE(M3);
+  EXPECT_FALSE(CallGraph::readFromCache(*M3, CachePath));
+
+  sys::fs::remove(CachePath);
+}
 }
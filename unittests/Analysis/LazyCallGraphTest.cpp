@@ -1442,6 +1442,124 @@ TEST(LazyCallGraphTest, InternalNoOpEdgeRemoval) {
   EXPECT_EQ(E, std::next(J));
 }
 
+TEST(LazyCallGraphTest, InternalMultiEdgeRemoval) {
+  LLVMContext Context;
+  // A nice fully connected (including self-edges) RefSCC.
+  std::unique_ptr<Module> M = parseAssembly(
+      Context, "define void @a(i8** %ptr) {\n"
+               "entry:\n"
+               "  store i8* bitcast (void(i8**)* @a to i8*), i8** %ptr\n"
+               "  store i8* bitcast (void(i8**)* @b to i8*), i8** %ptr\n"
+               "  store i8* bitcast (void(i8**)* @c to i8*), i8** %ptr\n"
+               "  ret void\n"
+               "}\n"
+               "define void @b(i8** %ptr) {\n"
+               "entry:\n"
+               "  store i8* bitcast (void(i8**)* @a to i8*), i8** %ptr\n"
+               "  store i8* bitcast (void(i8**)* @b to i8*), i8** %ptr\n"
+               "  store i8* bitcast (void(i8**)* @c to i8*), i8** %ptr\n"
+               "  ret void\n"
+               "}\n"
+               "define void @c(i8** %ptr) {\n"
+               "entry:\n"
+               "  store i8* bitcast (void(i8**)* @a to i8*), i8** %ptr\n"
+               "  store i8* bitcast (void(i8**)* @b to i8*), i8** %ptr\n"
+               "  store i8* bitcast (void(i8**)* @c to i8*), i8** %ptr\n"
+               "  ret void\n"
+               "}\n");
+  LazyCallGraph CG(*M);
+
+  // Force the graph to be fully expanded.
+  CG.buildRefSCCs();
+  auto I = CG.postorder_ref_scc_begin(), E = CG.postorder_ref_scc_end();
+  LazyCallGraph::RefSCC &RC = *I;
+  EXPECT_EQ(E, std::next(I));
+
+  LazyCallGraph::Node &A = *CG.lookup(lookupFunction(*M, "a"));
+  LazyCallGraph::Node &B = *CG.lookup(lookupFunction(*M, "b"));
+  LazyCallGraph::Node &C = *CG.lookup(lookupFunction(*M, "c"));
+  EXPECT_EQ(&RC, CG.lookupRefSCC(A));
+  EXPECT_EQ(&RC, CG.lookupRefSCC(B));
+  EXPECT_EQ(&RC, CG.lookupRefSCC(C));
+
+  // Remove the edges from b -> a and b -> c in a single batch, leaving b
+  // behind in its own RefSCC while 'a' and 'c' remain mutually connected.
+  SmallVector<LazyCallGraph::Node *, 2> Targets = {&A, &C};
+  SmallVector<LazyCallGraph::RefSCC *, 1> NewRCs =
+      RC.removeInternalRefEdges(B, Targets);
+  ASSERT_EQ(1u, NewRCs.size());
+  EXPECT_EQ(NewRCs[0], CG.lookupRefSCC(B));
+  EXPECT_EQ(1, std::distance(NewRCs[0]->begin(), NewRCs[0]->end()));
+  EXPECT_EQ(&RC, CG.lookupRefSCC(A));
+  EXPECT_EQ(&RC, CG.lookupRefSCC(C));
+  auto J = CG.postorder_ref_scc_begin();
+  EXPECT_NE(I, J);
+  EXPECT_EQ(NewRCs[0], &*J);
+  ++J;
+  EXPECT_EQ(I, J);
+  EXPECT_EQ(&RC, &*J);
+  EXPECT_EQ(E, std::next(J));
+}
+
+TEST(LazyCallGraphTest, InternalMultiEdgeRemovalSplitsApart) {
+  LLVMContext Context;
+  // Reference edges: s -> t1, s -> t2, t1 -> s, t2 -> s. Removing both of
+  // s's edges in one batch severs the RefSCC into three pieces where neither
+  // 't1' nor 't2' can reach the other.
+  std::unique_ptr<Module> M = parseAssembly(
+      Context, "define void @s(i8** %ptr) {\n"
+               "entry:\n"
+               "  store i8* bitcast (void(i8**)* @t1 to i8*), i8** %ptr\n"
+               "  store i8* bitcast (void(i8**)* @t2 to i8*), i8** %ptr\n"
+               "  ret void\n"
+               "}\n"
+               "define void @t1(i8** %ptr) {\n"
+               "entry:\n"
+               "  store i8* bitcast (void(i8**)* @s to i8*), i8** %ptr\n"
+               "  ret void\n"
+               "}\n"
+               "define void @t2(i8** %ptr) {\n"
+               "entry:\n"
+               "  store i8* bitcast (void(i8**)* @s to i8*), i8** %ptr\n"
+               "  ret void\n"
+               "}\n");
+  LazyCallGraph CG(*M);
+
+  // Force the graph to be fully expanded.
+  CG.buildRefSCCs();
+  auto I = CG.postorder_ref_scc_begin(), E = CG.postorder_ref_scc_end();
+  LazyCallGraph::RefSCC &RC = *I;
+  EXPECT_EQ(E, std::next(I));
+
+  LazyCallGraph::Node &S = *CG.lookup(lookupFunction(*M, "s"));
+  LazyCallGraph::Node &T1 = *CG.lookup(lookupFunction(*M, "t1"));
+  LazyCallGraph::Node &T2 = *CG.lookup(lookupFunction(*M, "t2"));
+  EXPECT_EQ(&RC, CG.lookupRefSCC(S));
+  EXPECT_EQ(&RC, CG.lookupRefSCC(T1));
+  EXPECT_EQ(&RC, CG.lookupRefSCC(T2));
+
+  SmallVector<LazyCallGraph::Node *, 2> Targets = {&T1, &T2};
+  SmallVector<LazyCallGraph::RefSCC *, 1> NewRCs =
+      RC.removeInternalRefEdges(S, Targets);
+  ASSERT_EQ(2u, NewRCs.size());
+  // The RefSCC containing the source always comes first in the returned
+  // postorder sequence; one of the targets re-uses the original RefSCC.
+  EXPECT_EQ(NewRCs[0], CG.lookupRefSCC(S));
+  EXPECT_NE(CG.lookupRefSCC(T1), CG.lookupRefSCC(T2));
+  EXPECT_TRUE(CG.lookupRefSCC(T1) == &RC || CG.lookupRefSCC(T1) == NewRCs[1]);
+  EXPECT_TRUE(CG.lookupRefSCC(T2) == &RC || CG.lookupRefSCC(T2) == NewRCs[1]);
+
+  // The source's RefSCC is now the leaf and comes first in the postorder
+  // sequence, with the original RefSCC still last.
+  auto J = CG.postorder_ref_scc_begin();
+  EXPECT_EQ(NewRCs[0], &*J);
+  ++J;
+  EXPECT_EQ(NewRCs[1], &*J);
+  ++J;
+  EXPECT_EQ(&RC, &*J);
+  EXPECT_EQ(E, std::next(J));
+}
+
 TEST(LazyCallGraphTest, InternalCallEdgeToRef) {
   LLVMContext Context;
   // A nice fully connected (including self-edges) SCC (and RefSCC)
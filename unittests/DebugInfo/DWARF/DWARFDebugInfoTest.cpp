@@ -1667,4 +1667,53 @@ TEST(DWARFDebugInfo, TestImplicitConstAbbrevs) {
   EXPECT_EQ(DIEs.find(Val2)->second, AbbrevPtrVal2);
 }
 
+TEST(DWARFDebugInfo, TestParallelDIEParsing) {
+  // Build several compile units with distinct address ranges, parse their
+  // DIEs in parallel and verify that the concurrently built address range
+  // index resolves addresses into the right unit.
+  uint16_t Version = 4;
+
+  const uint8_t AddrSize = sizeof(void *);
+  initLLVMIfNeeded();
+  Triple Triple = getHostTripleForAddrSize(AddrSize);
+  auto ExpectedDG = dwarfgen::Generator::create(Triple, Version);
+  if (HandleExpectedError(ExpectedDG))
+    return;
+  dwarfgen::Generator *DG = ExpectedDG.get().get();
+
+  const char *FuncNames[] = {"func0", "func1", "func2", "func3"};
+  const unsigned NumCUs = 4;
+  const uint64_t FuncSize = 0x100;
+  for (unsigned I = 0; I != NumCUs; ++I) {
+    dwarfgen::CompileUnit &CU = DG->addCompileUnit();
+    auto CUDie = CU.getUnitDIE();
+    const uint64_t LowPC = 0x1000 * (I + 1);
+    auto SubprogramDie = CUDie.addChild(DW_TAG_subprogram);
+    SubprogramDie.addAttribute(DW_AT_name, DW_FORM_strp, FuncNames[I]);
+    SubprogramDie.addAttribute(DW_AT_low_pc, DW_FORM_addr, LowPC);
+    SubprogramDie.addAttribute(DW_AT_high_pc, DW_FORM_addr,
+                               LowPC + FuncSize);
+  }
+
+  MemoryBufferRef FileBuffer(DG->generate(), "dwarf");
+  auto Obj = object::ObjectFile::createObjectFile(FileBuffer);
+  EXPECT_TRUE((bool)Obj);
+  DWARFContextInMemory DwarfContext(*Obj.get());
+
+  DwarfContext.parseDIEsParallel(2);
+
+  // All units must have their DIEs extracted after warming up.
+  EXPECT_EQ(NumCUs, DwarfContext.getNumCompileUnits());
+  for (unsigned I = 0; I != NumCUs; ++I)
+    EXPECT_GT(DwarfContext.getCompileUnitAtIndex(I)->getNumDIEs(), 1u);
+
+  for (unsigned I = 0; I != NumCUs; ++I) {
+    DILineInfo Info = DwarfContext.getLineInfoForAddress(
+        0x1000 * (I + 1) + 4,
+        DILineInfoSpecifier(DILineInfoSpecifier::FileLineInfoKind::None,
+                            DINameKind::ShortName));
+    EXPECT_EQ(FuncNames[I], Info.FunctionName);
+  }
+}
+
 } // end anonymous namespace
@@ -0,0 +1,41 @@
+//===- ConcurrentIRCompileLayerTest.cpp - Unit tests for the async layer --===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "llvm/ExecutionEngine/RuntimeDyld.h"
+#include "llvm/ExecutionEngine/Orc/ConcurrentIRCompileLayer.h"
+#include "gtest/gtest.h"
+
+namespace {
+
+struct MockBaseLayer {
+  typedef int ObjSetHandleT;
+  ObjSetHandleT addObjectSet(
+      std::vector<std::unique_ptr<
+          llvm::object::OwningBinary<llvm::object::ObjectFile>>> Objects,
+      std::unique_ptr<llvm::RuntimeDyld::MemoryManager> MemMgr,
+      std::unique_ptr<llvm::JITSymbolResolver> Resolver) {
+    EXPECT_FALSE(MemMgr);
+    return 42;
+  }
+  void emitAndFinalize(ObjSetHandleT H) { EXPECT_EQ(42, H); }
+};
+
+TEST(ConcurrentIRCompileLayerTest, Empty) {
+  MockBaseLayer M;
+  auto Compile = [](llvm::Module &) {
+    return llvm::object::OwningBinary<llvm::object::ObjectFile>();
+  };
+  llvm::orc::ConcurrentIRCompileLayer<MockBaseLayer> L(M, Compile, 1);
+  auto H = L.addModuleSet(std::list<std::unique_ptr<llvm::Module>>(), nullptr,
+                          nullptr);
+  // Waits for the background compile before finalizing.
+  L.emitAndFinalize(H);
+}
+
+}
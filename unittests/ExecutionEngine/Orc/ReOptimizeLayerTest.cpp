@@ -0,0 +1,145 @@
+//===--- ReOptimizeLayerTest.cpp - Unit tests for the reoptimize layer ----===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "OrcTestCommon.h"
+#include "llvm/ExecutionEngine/Orc/ReOptimizeLayer.h"
+#include "gtest/gtest.h"
+
+using namespace llvm;
+using namespace llvm::orc;
+
+namespace {
+
+class RecordingStubsManager : public orc::IndirectStubsManager {
+public:
+  Error createStub(StringRef StubName, JITTargetAddress InitAddr,
+                   JITSymbolFlags Flags) override {
+    Stubs[StubName] = InitAddr;
+    return Error::success();
+  }
+
+  Error createStubs(const StubInitsMap &StubInits) override {
+    llvm_unreachable("Not implemented");
+  }
+
+  JITSymbol findStub(StringRef Name, bool ExportedStubsOnly) override {
+    auto I = Stubs.find(Name);
+    if (I == Stubs.end())
+      return nullptr;
+    return JITSymbol(I->second, JITSymbolFlags::Exported);
+  }
+
+  JITSymbol findPointer(StringRef Name) override {
+    llvm_unreachable("Not implemented");
+  }
+
+  Error updatePointer(StringRef Name, JITTargetAddress NewAddr) override {
+    EXPECT_TRUE(Stubs.count(Name)) << "Updated unknown stub " << Name;
+    Stubs[Name] = NewAddr;
+    return Error::success();
+  }
+
+  StringMap<JITTargetAddress> Stubs;
+};
+
+TEST(ReOptimizeLayerTest, HotFunctionIsRecompiledAndRepointed) {
+  uint64_t Counter = 0;
+  bool BaseModuleRemoved = false;
+
+  auto MockBaseLayer = createMockBaseLayer<int>(
+      DoNothingAndReturn<int>(1),
+      [&](int H) { BaseModuleRemoved = true; },
+      DoNothingAndReturn<JITSymbol>(nullptr),
+      [&](int H, const std::string &Name, bool) {
+        if (Name == "foo")
+          return JITSymbol(0x1234, JITSymbolFlags::Exported);
+        if (Name == "__orc_reopt_counter.foo")
+          return JITSymbol(static_cast<JITTargetAddress>(
+                               reinterpret_cast<uintptr_t>(&Counter)),
+                           JITSymbolFlags::None);
+        return JITSymbol(nullptr);
+      });
+
+  RecordingStubsManager StubsMgr;
+  unsigned RecompileCount = 0;
+  ReOptimizeLayer<decltype(MockBaseLayer)> ReOptLayer(
+      MockBaseLayer, StubsMgr,
+      [&](StringRef Name) -> Expected<JITTargetAddress> {
+        EXPECT_EQ(Name, "foo");
+        ++RecompileCount;
+        return 0x5678;
+      },
+      /*HotnessThreshold=*/10);
+
+  LLVMContext Context;
+  auto M = std::make_shared<Module>("dummy", Context);
+  M->setTargetTriple("x86_64-unknown-linux-gnu");
+  Function *F = Function::Create(
+      FunctionType::get(Type::getVoidTy(Context), false),
+      GlobalValue::ExternalLinkage, "foo", M.get());
+  BasicBlock *BB = BasicBlock::Create(Context, "entry", F);
+  ReturnInst::Create(Context, BB);
+
+  std::vector<std::shared_ptr<Module>> Ms;
+  Ms.push_back(M);
+  auto H = ReOptLayer.addModuleSet(std::move(Ms), nullptr, nullptr);
+  EXPECT_TRUE(!!H) << "addModuleSet failed";
+
+  // The module was instrumented with an entry counter and the stub points at
+  // the cheap-tier implementation.
+  EXPECT_NE(M->getNamedGlobal("__orc_reopt_counter.foo"), nullptr)
+      << "Entry counter not inserted";
+  EXPECT_EQ(StubsMgr.Stubs.lookup("foo"), 0x1234u)
+      << "Stub not pointing at the cheap tier";
+
+  // Below threshold: nothing should happen.
+  Counter = 9;
+  EXPECT_FALSE(!!ReOptLayer.pollForHotFunctions());
+  EXPECT_EQ(RecompileCount, 0u) << "Recompiled a cold function";
+
+  // At threshold: recompile, repoint, and reclaim the cheap tier.
+  Counter = 10;
+  EXPECT_FALSE(!!ReOptLayer.pollForHotFunctions());
+  EXPECT_EQ(RecompileCount, 1u) << "Hot function not recompiled";
+  EXPECT_EQ(StubsMgr.Stubs.lookup("foo"), 0x5678u)
+      << "Stub not repointed at the optimized tier";
+  EXPECT_TRUE(BaseModuleRemoved) << "Cheap-tier code not reclaimed";
+
+  // Further polls must not recompile again.
+  EXPECT_FALSE(!!ReOptLayer.pollForHotFunctions());
+  EXPECT_EQ(RecompileCount, 1u) << "Function recompiled twice";
+
+  ReOptLayer.removeModuleSet(*H);
+}
+
+TEST(ReOptimizeLayerTest, FindSymbolPrefersStubs) {
+  auto MockBaseLayer = createMockBaseLayer<int>(
+      DoNothingAndReturn<int>(1), DoNothingAndReturn<void>(),
+      [](const std::string &Name, bool) {
+        if (Name == "bar")
+          return JITSymbol(0x4321, JITSymbolFlags::Exported);
+        return JITSymbol(nullptr);
+      },
+      DoNothingAndReturn<JITSymbol>(nullptr));
+
+  RecordingStubsManager StubsMgr;
+  cantFail(StubsMgr.createStub("foo", 0x1111, JITSymbolFlags::Exported));
+
+  ReOptimizeLayer<decltype(MockBaseLayer)> ReOptLayer(
+      MockBaseLayer, StubsMgr,
+      [](StringRef) -> Expected<JITTargetAddress> { return 0; },
+      /*HotnessThreshold=*/10);
+
+  EXPECT_EQ(ReOptLayer.findSymbol("foo", true).getAddress(), 0x1111u)
+      << "Stubbed symbol not resolved through the stub";
+  EXPECT_EQ(ReOptLayer.findSymbol("bar", true).getAddress(), 0x4321u)
+      << "Unstubbed symbol not forwarded to the base layer";
+}
+
+} // end anonymous namespace
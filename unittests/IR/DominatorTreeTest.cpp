@@ -176,15 +176,16 @@ namespace llvm {
         EXPECT_EQ(DominatedBBs.size(), 0UL);
         EXPECT_EQ(PostDominatedBBs.size(), 0UL);
 
-        // Check DFS Numbers before
+        // Check DFS Numbers before. Numbers are assigned in steps of 8 so
+        // that later insertions can be numbered into the gaps.
         EXPECT_EQ(DT->getNode(BB0)->getDFSNumIn(), 0UL);
-        EXPECT_EQ(DT->getNode(BB0)->getDFSNumOut(), 7UL);
-        EXPECT_EQ(DT->getNode(BB1)->getDFSNumIn(), 1UL);
-        EXPECT_EQ(DT->getNode(BB1)->getDFSNumOut(), 2UL);
-        EXPECT_EQ(DT->getNode(BB2)->getDFSNumIn(), 5UL);
-        EXPECT_EQ(DT->getNode(BB2)->getDFSNumOut(), 6UL);
-        EXPECT_EQ(DT->getNode(BB4)->getDFSNumIn(), 3UL);
-        EXPECT_EQ(DT->getNode(BB4)->getDFSNumOut(), 4UL);
+        EXPECT_EQ(DT->getNode(BB0)->getDFSNumOut(), 56UL);
+        EXPECT_EQ(DT->getNode(BB1)->getDFSNumIn(), 8UL);
+        EXPECT_EQ(DT->getNode(BB1)->getDFSNumOut(), 16UL);
+        EXPECT_EQ(DT->getNode(BB2)->getDFSNumIn(), 40UL);
+        EXPECT_EQ(DT->getNode(BB2)->getDFSNumOut(), 48UL);
+        EXPECT_EQ(DT->getNode(BB4)->getDFSNumIn(), 24UL);
+        EXPECT_EQ(DT->getNode(BB4)->getDFSNumOut(), 32UL);
 
         // Reattach block 3 to block 1 and recalculate
         BB1->getTerminator()->eraseFromParent();
@@ -193,15 +194,15 @@ namespace llvm {
 
         // Check DFS Numbers after
         EXPECT_EQ(DT->getNode(BB0)->getDFSNumIn(), 0UL);
-        EXPECT_EQ(DT->getNode(BB0)->getDFSNumOut(), 9UL);
-        EXPECT_EQ(DT->getNode(BB1)->getDFSNumIn(), 1UL);
-        EXPECT_EQ(DT->getNode(BB1)->getDFSNumOut(), 4UL);
-        EXPECT_EQ(DT->getNode(BB2)->getDFSNumIn(), 7UL);
-        EXPECT_EQ(DT->getNode(BB2)->getDFSNumOut(), 8UL);
-        EXPECT_EQ(DT->getNode(BB3)->getDFSNumIn(), 2UL);
-        EXPECT_EQ(DT->getNode(BB3)->getDFSNumOut(), 3UL);
-        EXPECT_EQ(DT->getNode(BB4)->getDFSNumIn(), 5UL);
-        EXPECT_EQ(DT->getNode(BB4)->getDFSNumOut(), 6UL);
+        EXPECT_EQ(DT->getNode(BB0)->getDFSNumOut(), 72UL);
+        EXPECT_EQ(DT->getNode(BB1)->getDFSNumIn(), 8UL);
+        EXPECT_EQ(DT->getNode(BB1)->getDFSNumOut(), 32UL);
+        EXPECT_EQ(DT->getNode(BB2)->getDFSNumIn(), 56UL);
+        EXPECT_EQ(DT->getNode(BB2)->getDFSNumOut(), 64UL);
+        EXPECT_EQ(DT->getNode(BB3)->getDFSNumIn(), 16UL);
+        EXPECT_EQ(DT->getNode(BB3)->getDFSNumOut(), 24UL);
+        EXPECT_EQ(DT->getNode(BB4)->getDFSNumIn(), 40UL);
+        EXPECT_EQ(DT->getNode(BB4)->getDFSNumOut(), 48UL);
 
         // Change root node
         DT->verifyDomTree();
@@ -261,6 +262,63 @@ namespace llvm {
       Passes.add(P);
       Passes.run(*M);
     }
+
+    TEST(DominatorTree, BatchedEdgeUpdates) {
+      LLVMContext Context;
+      const char *ModuleString = "define void @f(i1 %cond) {\n"
+                                 "entry:\n"
+                                 "  br i1 %cond, label %a, label %b\n"
+                                 "a:\n"
+                                 "  br label %c\n"
+                                 "b:\n"
+                                 "  br label %c\n"
+                                 "c:\n"
+                                 "  br label %d\n"
+                                 "d:\n"
+                                 "  ret void\n"
+                                 "}\n";
+      SMDiagnostic Err;
+      std::unique_ptr<Module> M = parseAssemblyString(ModuleString, Err, Context);
+      Function *F = M->getFunction("f");
+      Argument *Cond = &*F->arg_begin();
+
+      Function::iterator FI = F->begin();
+      BasicBlock *Entry = &*FI++;
+      BasicBlock *A = &*FI++;
+      BasicBlock *B = &*FI++;
+      BasicBlock *C = &*FI++;
+      BasicBlock *D = &*FI++;
+
+      DominatorTree DT(*F);
+      EXPECT_FALSE(DT.hasPendingUpdates());
+
+      // Turn c's unconditional branch into "br i1 %cond, label %d, label %a".
+      // The new edge (c, a) does not change any immediate dominator, so the
+      // batch is retired without rebuilding the tree; the node objects stay
+      // the same.
+      DomTreeNodeBase<BasicBlock> *DNode = DT.getNode(D);
+      C->getTerminator()->eraseFromParent();
+      BranchInst::Create(D, A, Cond, C);
+      DT.queueEdgeInsertion(C, A);
+      EXPECT_TRUE(DT.hasPendingUpdates());
+      DT.applyPendingUpdates(*F);
+      EXPECT_FALSE(DT.hasPendingUpdates());
+      EXPECT_EQ(DT.getNode(D), DNode);
+      EXPECT_EQ(DT.getNode(C)->getIDom()->getBlock(), Entry);
+      DT.verifyDomTree();
+
+      // Retarget b from c to a. Deleting (b, c) moves c's immediate
+      // dominator, so this batch falls back to one recalculation.
+      B->getTerminator()->eraseFromParent();
+      BranchInst::Create(A, B);
+      DT.queueEdgeDeletion(B, C);
+      DT.queueEdgeInsertion(B, A);
+      DT.applyPendingUpdates(*F);
+      EXPECT_FALSE(DT.hasPendingUpdates());
+      EXPECT_EQ(DT.getNode(C)->getIDom()->getBlock(), A);
+      EXPECT_EQ(DT.getNode(A)->getIDom()->getBlock(), Entry);
+      DT.verifyDomTree();
+    }
   }
 }
 
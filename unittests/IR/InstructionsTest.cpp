@@ -103,6 +103,39 @@ TEST_F(ModuleWithFunctionTest, InvokeInst) {
   }
 }
 
+TEST(InstructionsTest, LargePHIBlockIndex) {
+  LLVMContext C;
+  Type *Int32Ty = Type::getInt32Ty(C);
+
+  // Use enough incoming edges to push the PHI past the threshold where
+  // getBasicBlockIndex switches to the hashed block index.
+  const unsigned NumPreds = 128;
+  std::vector<std::unique_ptr<BasicBlock>> Blocks;
+  for (unsigned i = 0; i != NumPreds; ++i)
+    Blocks.emplace_back(BasicBlock::Create(C));
+
+  std::unique_ptr<PHINode> PN(PHINode::Create(Int32Ty, NumPreds));
+  Value *V = ConstantInt::get(Int32Ty, 1);
+  for (unsigned i = 0; i != NumPreds; ++i)
+    PN->addIncoming(V, Blocks[i].get());
+
+  for (unsigned i = 0; i != NumPreds; ++i)
+    EXPECT_EQ((int)i, PN->getBasicBlockIndex(Blocks[i].get()));
+
+  // Mutating the incoming blocks must invalidate the index.
+  BasicBlock *Replacement = BasicBlock::Create(C);
+  std::unique_ptr<BasicBlock> ReplacementOwner(Replacement);
+  PN->setIncomingBlock(5, Replacement);
+  EXPECT_EQ(5, PN->getBasicBlockIndex(Replacement));
+  EXPECT_EQ(-1, PN->getBasicBlockIndex(Blocks[5].get()));
+
+  // Removal shifts later entries down.
+  PN->removeIncomingValue(0u, /*DeletePHIIfEmpty=*/false);
+  EXPECT_EQ(4, PN->getBasicBlockIndex(Replacement));
+  EXPECT_EQ((int)NumPreds - 2,
+            PN->getBasicBlockIndex(Blocks[NumPreds - 1].get()));
+}
+
 TEST(InstructionsTest, BranchInst) {
   LLVMContext C;
 
@@ -259,6 +259,33 @@ TEST_F(MDNodeTest, SelfReference) {
   }
 }
 
+TEST_F(MDNodeTest, GetMostGenericAliasScope) {
+  MDNode *Scope1 = getTuple();
+  MDNode *Scope2 = getTuple();
+  MDNode *Scope3 = getTuple();
+
+  MDNode *List12 = getNode(Scope1, Scope2);
+  MDNode *List21 = getNode(Scope2, Scope1);
+  Metadata *Ops123[] = {Scope1, Scope2, Scope3};
+  MDNode *List123 = MDNode::get(Context, Ops123);
+
+  // Merging a list with itself, or with a subset of itself, reuses the
+  // existing (larger) list rather than concatenating a new one.
+  EXPECT_EQ(List12, MDNode::getMostGenericAliasScope(List12, List12));
+  EXPECT_EQ(List123, MDNode::getMostGenericAliasScope(List12, List123));
+  EXPECT_EQ(List123, MDNode::getMostGenericAliasScope(List123, List12));
+
+  // Subset checks are order-insensitive.
+  EXPECT_EQ(List123, MDNode::getMostGenericAliasScope(List21, List123));
+
+  // Disjoint (and partially overlapping) lists still concatenate.
+  MDNode *List3 = getNode(Scope3);
+  MDNode *Merged = MDNode::getMostGenericAliasScope(List12, List3);
+  EXPECT_NE(Merged, List12);
+  EXPECT_NE(Merged, List3);
+  EXPECT_EQ(3u, Merged->getNumOperands());
+}
+
 TEST_F(MDNodeTest, Print) {
   Constant *C = ConstantInt::get(Type::getInt32Ty(Context), 7);
   MDString *S = MDString::get(Context, "foo");
@@ -0,0 +1,124 @@
+//===- ModuleSummaryIndexFlatTest.cpp - Flat summary format tests ---------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "llvm/IR/ModuleSummaryIndexFlat.h"
+#include "llvm/ADT/STLExtras.h"
+#include "llvm/IR/GlobalValue.h"
+#include "llvm/Support/raw_ostream.h"
+#include "gtest/gtest.h"
+
+using namespace llvm;
+
+namespace {
+
+TEST(ModuleSummaryIndexFlatTest, WriteAndRead) {
+  GlobalValue::GUID FooGUID = GlobalValue::getGUID("foo");
+  GlobalValue::GUID BarGUID = GlobalValue::getGUID("bar");
+  GlobalValue::GUID GVarGUID = GlobalValue::getGUID("gvar");
+  GlobalValue::GUID BazGUID = GlobalValue::getGUID("baz");
+
+  ModuleSummaryIndex Index;
+  auto ModIt = Index.addModulePath("m1.o", 1, ModuleHash{{1, 2, 3, 4, 5}});
+
+  GlobalValueSummary::GVFlags ExternalFlags(GlobalValue::ExternalLinkage,
+                                            /*NotEligibleToImport=*/false,
+                                            /*LiveRoot=*/false);
+  auto FS = llvm::make_unique<FunctionSummary>(
+      ExternalFlags, /*NumInsts=*/42,
+      std::vector<ValueInfo>{ValueInfo(GVarGUID)},
+      std::vector<FunctionSummary::EdgeTy>{
+          {ValueInfo(BarGUID), CalleeInfo(CalleeInfo::HotnessType::Hot)}},
+      std::vector<GlobalValue::GUID>{},
+      std::vector<FunctionSummary::VFuncId>{},
+      std::vector<FunctionSummary::VFuncId>{},
+      std::vector<FunctionSummary::ConstVCall>{},
+      std::vector<FunctionSummary::ConstVCall>{});
+  FS->setModulePath(ModIt->first());
+  Index.addGlobalValueSummary(FooGUID, std::move(FS));
+
+  GlobalValueSummary::GVFlags InternalFlags(GlobalValue::InternalLinkage,
+                                            /*NotEligibleToImport=*/true,
+                                            /*LiveRoot=*/true);
+  auto GVS = llvm::make_unique<GlobalVarSummary>(InternalFlags,
+                                                 std::vector<ValueInfo>{});
+  GVS->setModulePath(ModIt->first());
+  Index.addGlobalValueSummary(GVarGUID, std::move(GVS));
+
+  auto AS =
+      llvm::make_unique<AliasSummary>(ExternalFlags, std::vector<ValueInfo>{});
+  AS->setModulePath(ModIt->first());
+  AS->setAliasee(Index.getGlobalValueSummary(FooGUID, /*PerModuleIndex=*/false));
+  Index.addGlobalValueSummary(BazGUID, std::move(AS));
+
+  std::string Buffer;
+  raw_string_ostream OS(Buffer);
+  Error WriteErr = writeFlatSummaryIndex(Index, OS);
+  ASSERT_FALSE(bool(WriteErr));
+  consumeError(std::move(WriteErr));
+  OS.flush();
+
+  auto FlatOrErr =
+      FlatSummaryIndex::create(MemoryBufferRef(Buffer, "flat-index"));
+  ASSERT_TRUE((bool)FlatOrErr);
+  FlatSummaryIndex &Flat = **FlatOrErr;
+
+  EXPECT_EQ(3u, Flat.getNumGUIDs());
+  ASSERT_EQ(1u, Flat.getNumModules());
+  EXPECT_EQ("m1.o", Flat.getModulePath(0));
+  EXPECT_EQ(1u, Flat.getModuleId(0));
+  EXPECT_EQ((ModuleHash{{1, 2, 3, 4, 5}}), Flat.getModuleHash(0));
+
+  auto FooList = Flat.findSummaries(FooGUID);
+  ASSERT_EQ(1u, FooList.size());
+  auto Foo = FooList[0];
+  EXPECT_EQ(GlobalValueSummary::FunctionKind, Foo.getSummaryKind());
+  EXPECT_EQ(GlobalValue::ExternalLinkage, Foo.linkage());
+  EXPECT_FALSE(Foo.notEligibleToImport());
+  EXPECT_FALSE(Foo.liveRoot());
+  EXPECT_EQ(42u, Foo.instCount());
+  EXPECT_EQ("m1.o", Foo.modulePath());
+  ASSERT_EQ(1u, Foo.getNumRefs());
+  EXPECT_EQ(GVarGUID, Foo.ref(0));
+  ASSERT_EQ(1u, Foo.getNumCalls());
+  EXPECT_EQ(BarGUID, Foo.callGUID(0));
+  EXPECT_EQ(CalleeInfo::HotnessType::Hot, Foo.callHotness(0));
+
+  auto GVarList = Flat.findSummaries(GVarGUID);
+  ASSERT_EQ(1u, GVarList.size());
+  auto GVar = GVarList[0];
+  EXPECT_EQ(GlobalValueSummary::GlobalVarKind, GVar.getSummaryKind());
+  EXPECT_EQ(GlobalValue::InternalLinkage, GVar.linkage());
+  EXPECT_TRUE(GVar.notEligibleToImport());
+  EXPECT_TRUE(GVar.liveRoot());
+  EXPECT_EQ(0u, GVar.getNumRefs());
+  EXPECT_EQ(0u, GVar.getNumCalls());
+
+  auto BazList = Flat.findSummaries(BazGUID);
+  ASSERT_EQ(1u, BazList.size());
+  EXPECT_EQ(GlobalValueSummary::AliasKind, BazList[0].getSummaryKind());
+  EXPECT_EQ(FooGUID, BazList[0].getAliaseeGUID());
+
+  // bar is only referenced, never defined.
+  EXPECT_TRUE(Flat.findSummaries(BarGUID).empty());
+}
+
+TEST(ModuleSummaryIndexFlatTest, RejectsMalformedBuffers) {
+  auto ShortOrErr =
+      FlatSummaryIndex::create(MemoryBufferRef("short", "flat-index"));
+  EXPECT_FALSE(bool(ShortOrErr));
+  consumeError(ShortOrErr.takeError());
+
+  std::string Garbage(64, '\x2a');
+  auto GarbageOrErr =
+      FlatSummaryIndex::create(MemoryBufferRef(Garbage, "flat-index"));
+  EXPECT_FALSE(bool(GarbageOrErr));
+  consumeError(GarbageOrErr.takeError());
+}
+
+} // end anonymous namespace
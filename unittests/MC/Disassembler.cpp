@@ -8,7 +8,15 @@
 //===----------------------------------------------------------------------===//
 
 #include "llvm-c/Disassembler.h"
+#include "llvm/MC/MCAsmInfo.h"
+#include "llvm/MC/MCContext.h"
+#include "llvm/MC/MCDisassembler/MCDisassembler.h"
+#include "llvm/MC/MCObjectFileInfo.h"
+#include "llvm/MC/MCRegisterInfo.h"
+#include "llvm/MC/MCSubtargetInfo.h"
+#include "llvm/Support/TargetRegistry.h"
 #include "llvm/Support/TargetSelect.h"
+#include "llvm/Support/raw_ostream.h"
 #include "gtest/gtest.h"
 
 using namespace llvm;
@@ -62,3 +70,52 @@ TEST(Disassembler, Test1) {
 
   LLVMDisasmDispose(DCR);
 }
+
+TEST(Disassembler, BatchDecode) {
+  llvm::InitializeAllTargetInfos();
+  llvm::InitializeAllTargetMCs();
+  llvm::InitializeAllDisassemblers();
+
+  std::string TripleName = "x86_64-pc-linux";
+  std::string ErrStr;
+  const Target *TheTarget = TargetRegistry::lookupTarget(TripleName, ErrStr);
+  if (!TheTarget)
+    return;
+
+  std::unique_ptr<const MCRegisterInfo> MRI(
+      TheTarget->createMCRegInfo(TripleName));
+  ASSERT_TRUE(MRI);
+  std::unique_ptr<const MCAsmInfo> AsmInfo(
+      TheTarget->createMCAsmInfo(*MRI, TripleName));
+  ASSERT_TRUE(AsmInfo);
+  std::unique_ptr<const MCSubtargetInfo> STI(
+      TheTarget->createMCSubtargetInfo(TripleName, "", ""));
+  ASSERT_TRUE(STI);
+  MCObjectFileInfo MOFI;
+  MCContext Ctx(AsmInfo.get(), MRI.get(), &MOFI);
+  std::unique_ptr<MCDisassembler> DisAsm(
+      TheTarget->createMCDisassembler(*STI, Ctx));
+  ASSERT_TRUE(DisAsm);
+
+  // nop; nop; jmp -3; then a trailing byte that does not decode.
+  uint8_t Bytes[] = {0x90, 0x90, 0xeb, 0xfd, 0x0f};
+  std::vector<MCDisassembler::DecodedInst> Insts;
+  SmallString<64> Comments;
+  size_t Num = DisAsm->getInstructions(Insts, Comments,
+                                       ArrayRef<uint8_t>(Bytes), 0, nulls());
+  EXPECT_EQ(Insts.size(), Num);
+  ASSERT_GE(Num, 4u);
+  EXPECT_EQ(MCDisassembler::Success, Insts[0].Status);
+  EXPECT_EQ(1u, Insts[0].Size);
+  EXPECT_EQ(MCDisassembler::Success, Insts[1].Status);
+  EXPECT_EQ(1u, Insts[1].Size);
+  EXPECT_EQ(MCDisassembler::Success, Insts[2].Status);
+  EXPECT_EQ(2u, Insts[2].Size);
+  EXPECT_EQ(MCDisassembler::Fail, Insts.back().Status);
+
+  // The whole range is consumed even though the last byte does not decode.
+  uint64_t TotalSize = 0;
+  for (const MCDisassembler::DecodedInst &DI : Insts)
+    TotalSize += DI.Size;
+  EXPECT_EQ(sizeof(Bytes), TotalSize);
+}
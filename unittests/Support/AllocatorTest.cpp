@@ -185,4 +185,47 @@ TEST(AllocatorTest, TestBigAlignment) {
   EXPECT_GT(MockSlabAllocator::GetLastSlabSize(), 4096u);
 }
 
+// Test that standard-size slabs handed back to a PooledMallocAllocator are
+// recycled rather than returned to malloc.
+TEST(AllocatorTest, TestPooledSlabReuse) {
+  PooledMallocAllocator Alloc;
+
+  void *Slab = Alloc.Allocate(PooledMallocAllocator::PoolableSize, 0);
+  Alloc.Deallocate(Slab, PooledMallocAllocator::PoolableSize);
+
+  // The slab sits in the instance's local cache and is handed straight back.
+  void *Reused = Alloc.Allocate(PooledMallocAllocator::PoolableSize, 0);
+  EXPECT_EQ(Slab, Reused);
+  Alloc.Deallocate(Reused, PooledMallocAllocator::PoolableSize);
+
+  // Non-poolable sizes pass through to malloc and must still pair up with
+  // Deallocate correctly.
+  void *Big = Alloc.Allocate(2 * PooledMallocAllocator::PoolableSize, 0);
+  EXPECT_TRUE(Big != nullptr);
+  Alloc.Deallocate(Big, 2 * PooledMallocAllocator::PoolableSize);
+
+  PooledMallocAllocator::ReleasePooledMemory();
+}
+
+TEST(AllocatorTest, TestPooledBumpPtr) {
+  PooledBumpPtrAllocator Alloc;
+
+  // Spread allocations over several slabs and make sure resetting and
+  // reallocating off the pool produces usable memory.
+  for (unsigned Iteration = 0; Iteration != 2; ++Iteration) {
+    SmallVector<uint64_t *, 16> Ptrs;
+    for (unsigned i = 0; i != 1024; ++i) {
+      uint64_t *P = Alloc.Allocate<uint64_t>();
+      *P = i;
+      Ptrs.push_back(P);
+    }
+    for (unsigned i = 0; i != 1024; ++i)
+      EXPECT_EQ(i, *Ptrs[i]);
+    EXPECT_GT(Alloc.GetNumSlabs(), 1u);
+    Alloc.Reset();
+  }
+
+  PooledMallocAllocator::ReleasePooledMemory();
+}
+
 }  // anonymous namespace
@@ -11,6 +11,7 @@
 //
 //===----------------------------------------------------------------------===//
 
+#include "llvm/ADT/ArrayRef.h"
 #include "llvm/Support/FileSystem.h"
 #include "llvm/Support/FileUtilities.h"
 #include "llvm/Support/MemoryBuffer.h"
@@ -226,4 +227,37 @@ TEST_F(MemoryBufferTest, slice) {
   EXPECT_TRUE(BufData2.substr(0x1800,8).equals("abcdefgh"));
   EXPECT_TRUE(BufData2.substr(0x2FF8,8).equals("abcdefgh"));
 }
+
+TEST_F(MemoryBufferTest, getFiles) {
+  // Create a handful of small files with distinct contents.
+  std::vector<std::string> Paths;
+  std::vector<FileRemover> Cleanups;
+  for (unsigned i = 0; i < 4; ++i) {
+    int FD;
+    SmallString<64> TestPath;
+    sys::fs::createTemporaryFile("MemoryBufferTest_getFiles", "temp", FD,
+                                 TestPath);
+    Paths.push_back(TestPath.str());
+    Cleanups.emplace_back(TestPath);
+    raw_fd_ostream OF(FD, true);
+    OF << "file" << i;
+  }
+  // One path that does not exist; its failure must not affect the others.
+  Paths.push_back("/MemoryBufferTest/does/not/exist");
+
+  SmallVector<ErrorOr<OwningBuffer>, 5> Buffers;
+  MemoryBuffer::getFiles(Paths, Buffers);
+  ASSERT_EQ(Paths.size(), Buffers.size());
+  for (unsigned i = 0; i < 4; ++i) {
+    ASSERT_FALSE(Buffers[i].getError());
+    EXPECT_EQ(("file" + Twine(i)).str(), Buffers[i].get()->getBuffer());
+  }
+  EXPECT_TRUE(static_cast<bool>(Buffers[4].getError()));
+
+  // Single-threaded path.
+  MemoryBuffer::getFiles(Paths, Buffers, 1);
+  ASSERT_EQ(Paths.size(), Buffers.size());
+  ASSERT_FALSE(Buffers[0].getError());
+  EXPECT_EQ("file0", Buffers[0].get()->getBuffer());
+}
 }
@@ -0,0 +1,58 @@
+//===- unittests/Support/Parallel.cpp - Parallel loop tests ---------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "llvm/Support/Parallel.h"
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <atomic>
+#include <numeric>
+#include <vector>
+
+using namespace llvm;
+
+TEST(Parallel, ParallelFor) {
+  // Use a size guaranteed to span several chunks so both the serial and the
+  // pooled path get exercised across machines with different core counts.
+  std::vector<int> V(1024, 0);
+  parallel::parallel_for(0, V.size(), [&V](size_t I) { V[I] = 3; });
+  EXPECT_TRUE(std::all_of(V.begin(), V.end(), [](int X) { return X == 3; }));
+
+  // An empty range must not invoke the body at all.
+  std::atomic<unsigned> Count(0);
+  parallel::parallel_for(10, 10, [&Count](size_t) { ++Count; });
+  EXPECT_EQ(0u, Count.load());
+}
+
+TEST(Parallel, ParallelForEach) {
+  std::vector<int> V(512);
+  std::iota(V.begin(), V.end(), 0);
+  std::atomic<int> Sum(0);
+  parallel::parallel_for_each(V.begin(), V.end(),
+                              [&Sum](int X) { Sum += X; });
+  EXPECT_EQ(511 * 512 / 2, Sum.load());
+}
+
+TEST(Parallel, ParallelTransformReduce) {
+  std::vector<int> V(256);
+  std::iota(V.begin(), V.end(), 1);
+  int Sum = parallel::parallel_transform_reduce(
+      V.begin(), V.end(), 0, [](int A, int B) { return A + B; },
+      [](int X) { return X * 2; });
+  EXPECT_EQ(256 * 257, Sum);
+}
+
+TEST(Parallel, NestedParallelFor) {
+  // A loop body entering another parallel loop must complete rather than
+  // deadlock; the inner loop is expected to degrade to serial execution.
+  std::atomic<unsigned> Count(0);
+  parallel::parallel_for(0, 8, [&Count](size_t) {
+    parallel::parallel_for(0, 8, [&Count](size_t) { ++Count; });
+  });
+  EXPECT_EQ(64u, Count.load());
+}
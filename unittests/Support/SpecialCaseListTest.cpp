@@ -94,6 +94,34 @@ TEST_F(SpecialCaseListTest, Substring) {
   EXPECT_TRUE(SCL->inSection("fun", "foobar"));
 }
 
+TEST_F(SpecialCaseListTest, Wildcards) {
+  std::unique_ptr<SpecialCaseList> SCL = makeSpecialCaseList("fun:prefix*\n"
+                                                             "fun:*suffix\n"
+                                                             "fun:mid*dle\n"
+                                                             "fun:*a*b*\n"
+                                                             "src:*\n");
+  EXPECT_TRUE(SCL->inSection("fun", "prefix"));
+  EXPECT_TRUE(SCL->inSection("fun", "prefix_of_this"));
+  EXPECT_FALSE(SCL->inSection("fun", "prefi"));
+  EXPECT_FALSE(SCL->inSection("fun", "not_prefix"));
+
+  EXPECT_TRUE(SCL->inSection("fun", "suffix"));
+  EXPECT_TRUE(SCL->inSection("fun", "ends_with_suffix"));
+  EXPECT_FALSE(SCL->inSection("fun", "suffix_not_at_end"));
+
+  EXPECT_TRUE(SCL->inSection("fun", "middle"));
+  EXPECT_TRUE(SCL->inSection("fun", "mid_saddle"));
+  EXPECT_FALSE(SCL->inSection("fun", "middl"));
+  EXPECT_FALSE(SCL->inSection("fun", "xmiddle"));
+
+  EXPECT_TRUE(SCL->inSection("fun", "ab"));
+  EXPECT_TRUE(SCL->inSection("fun", "xxaxxbxx"));
+  EXPECT_FALSE(SCL->inSection("fun", "ba"));
+
+  EXPECT_TRUE(SCL->inSection("src", "anything_at_all"));
+  EXPECT_TRUE(SCL->inSection("src", ""));
+}
+
 TEST_F(SpecialCaseListTest, InvalidSpecialCaseList) {
   std::string Error;
   EXPECT_EQ(nullptr, makeSpecialCaseList("badline", Error));
@@ -0,0 +1,98 @@
+//===- raw_async_fd_ostream_test.cpp - write-behind stream tests ----------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "llvm/Support/raw_async_fd_ostream.h"
+#include "llvm/ADT/SmallString.h"
+#include "llvm/Support/FileSystem.h"
+#include "llvm/Support/FileUtilities.h"
+#include "llvm/Support/MemoryBuffer.h"
+#include "gtest/gtest.h"
+
+using namespace llvm;
+
+#define ASSERT_NO_ERROR(x)                                                     \
+  if (std::error_code ASSERT_NO_ERROR_ec = x) {                                \
+    SmallString<128> MessageStorage;                                           \
+    raw_svector_ostream Message(MessageStorage);                               \
+    Message << #x ": did not return errc::success.\n"                          \
+            << "error number: " << ASSERT_NO_ERROR_ec.value() << "\n"          \
+            << "error message: " << ASSERT_NO_ERROR_ec.message() << "\n";      \
+    GTEST_FATAL_FAILURE_(MessageStorage.c_str());                              \
+  } else {                                                                     \
+  }
+
+namespace {
+
+static std::string readFile(StringRef Path) {
+  auto BufferOrErr = MemoryBuffer::getFile(Path);
+  if (!BufferOrErr)
+    return "";
+  return (*BufferOrErr)->getBuffer().str();
+}
+
+TEST(raw_async_fd_ostreamTest, Write) {
+  SmallString<64> Path;
+  int FD;
+  ASSERT_NO_ERROR(sys::fs::createTemporaryFile("async", "txt", FD, Path));
+  FileRemover Cleanup(Path);
+
+  // Write enough data in odd-sized chunks to force several buffer
+  // hand-offs to the worker thread.
+  std::string Chunk = "0123456789abcdefghijklmnopqrstuvwxyz";
+  std::string Expected;
+  {
+    raw_async_fd_ostream OS(FD, true);
+    for (unsigned I = 0; I != 100000; ++I) {
+      OS << Chunk;
+      Expected += Chunk;
+    }
+    EXPECT_EQ(Expected.size(), OS.tell());
+    EXPECT_FALSE(OS.has_error());
+  }
+
+  EXPECT_EQ(Expected, readFile(Path));
+}
+
+TEST(raw_async_fd_ostreamTest, Pwrite) {
+  SmallString<64> Path;
+  int FD;
+  ASSERT_NO_ERROR(sys::fs::createTemporaryFile("async", "txt", FD, Path));
+  FileRemover Cleanup(Path);
+
+  std::string Body(1 << 22, 'x');
+  {
+    raw_async_fd_ostream OS(FD, true);
+    OS << "head" << Body;
+    // Patch the placeholder header once the size of the body is known, the
+    // way the object writers do.
+    StringRef Patch = "SIZE";
+    OS.pwrite(Patch.data(), Patch.size(), 0);
+    EXPECT_FALSE(OS.has_error());
+  }
+
+  std::string Contents = readFile(Path);
+  ASSERT_EQ(4 + Body.size(), Contents.size());
+  EXPECT_EQ("SIZE", Contents.substr(0, 4));
+  EXPECT_EQ(Body, Contents.substr(4));
+}
+
+TEST(raw_async_fd_ostreamTest, Close) {
+  SmallString<64> Path;
+  int FD;
+  ASSERT_NO_ERROR(sys::fs::createTemporaryFile("async", "txt", FD, Path));
+  FileRemover Cleanup(Path);
+
+  raw_async_fd_ostream OS(FD, true);
+  OS << "abcd";
+  OS.close();
+  EXPECT_FALSE(OS.has_error());
+  EXPECT_EQ("abcd", readFile(Path));
+}
+
+} // end anonymous namespace
@@ -246,6 +246,69 @@ TEST_F(CloneInstruction, DuplicateInstructionsToSplit) {
   delete F;
 }
 
+TEST(FunctionCloneTemplate, StampedClonesAreRemapped) {
+  LLVMContext C;
+  Module M("", C);
+
+  Type *I32 = Type::getInt32Ty(C);
+  FunctionType *FT = FunctionType::get(I32, {I32}, false);
+  Function *F = Function::Create(FT, Function::ExternalLinkage, "f", &M);
+  Argument *X = &*F->arg_begin();
+  X->setName("x");
+
+  BasicBlock *Entry = BasicBlock::Create(C, "entry", F);
+  BasicBlock *Then = BasicBlock::Create(C, "then", F);
+  BasicBlock *Else = BasicBlock::Create(C, "else", F);
+  BasicBlock *Merge = BasicBlock::Create(C, "merge", F);
+
+  IRBuilder<> Builder(Entry);
+  Value *Cmp = Builder.CreateICmpSGT(X, Builder.getInt32(0), "cmp");
+  Builder.CreateCondBr(Cmp, Then, Else);
+
+  Builder.SetInsertPoint(Then);
+  Value *A = Builder.CreateAdd(X, Builder.getInt32(1), "a");
+  Builder.CreateBr(Merge);
+
+  Builder.SetInsertPoint(Else);
+  Value *B = Builder.CreateMul(X, Builder.getInt32(2), "b");
+  Builder.CreateBr(Merge);
+
+  Builder.SetInsertPoint(Merge);
+  PHINode *Phi = Builder.CreatePHI(I32, 2, "phi");
+  Phi->addIncoming(A, Then);
+  Phi->addIncoming(B, Else);
+  Builder.CreateRet(Phi);
+
+  FunctionCloneTemplate Template(*F);
+
+  ValueToValueMapTy VMap1, VMap2;
+  Function *Clone1 = Template.cloneFunction(VMap1, ".1");
+  Function *Clone2 = Template.cloneFunction(VMap2, ".2");
+
+  EXPECT_NE(Clone1, Clone2);
+  EXPECT_EQ(Clone1->getParent(), &M);
+  EXPECT_EQ(F->size(), Clone1->size());
+
+  // Local operands must refer to the clone's values, not the original's.
+  Argument *NewX = &*Clone1->arg_begin();
+  EXPECT_EQ(NewX, VMap1[X]);
+  Instruction *NewA = cast<Instruction>(VMap1[A]);
+  EXPECT_EQ(NewX, NewA->getOperand(0));
+
+  // Constants are shared, not cloned.
+  EXPECT_EQ(cast<Instruction>(A)->getOperand(1), NewA->getOperand(1));
+
+  // Phis get their incoming values and blocks remapped.
+  PHINode *NewPhi = cast<PHINode>(VMap1[Phi]);
+  EXPECT_EQ(NewA, NewPhi->getIncomingValue(0));
+  EXPECT_EQ(cast<BasicBlock>(VMap1[Then]), NewPhi->getIncomingBlock(0));
+  EXPECT_EQ(cast<BasicBlock>(VMap1[Else]), NewPhi->getIncomingBlock(1));
+
+  // The second stamp is independent of the first.
+  EXPECT_EQ(&*Clone2->arg_begin(),
+            cast<Instruction>(VMap2[A])->getOperand(0));
+}
+
 class CloneFunc : public ::testing::Test {
 protected:
   void SetUp() override {
@@ -0,0 +1,131 @@
+//===- IRTransactionTest.cpp - Unit tests for IRTransaction ---------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "llvm/Transforms/Utils/IRTransaction.h"
+#include "llvm/IR/BasicBlock.h"
+#include "llvm/IR/Function.h"
+#include "llvm/IR/IRBuilder.h"
+#include "llvm/IR/Instructions.h"
+#include "llvm/IR/LLVMContext.h"
+#include "llvm/IR/Module.h"
+#include "gtest/gtest.h"
+
+using namespace llvm;
+
+namespace {
+
+/// Build "ret i32 (add (a, b))" so the tests have an instruction with uses
+/// to speculate on.
+struct TransactionTestIR {
+  LLVMContext C;
+  std::unique_ptr<Module> M;
+  Function *F;
+  BasicBlock *BB;
+  Argument *A, *B;
+  Instruction *Add;
+  ReturnInst *Ret;
+
+  TransactionTestIR() : M(new Module("m", C)) {
+    Type *I32 = Type::getInt32Ty(C);
+    F = cast<Function>(
+        M->getOrInsertFunction("f", FunctionType::get(I32, {I32, I32}, false)));
+    A = &*F->arg_begin();
+    B = &*std::next(F->arg_begin());
+    BB = BasicBlock::Create(C, "entry", F);
+    IRBuilder<> Builder(BB);
+    Add = cast<Instruction>(Builder.CreateAdd(A, B, "sum"));
+    Ret = Builder.CreateRet(Add);
+  }
+};
+
+TEST(IRTransactionTest, RollbackCreated) {
+  TransactionTestIR IR;
+  IRTransaction TX;
+
+  IRBuilder<> Builder(IR.Ret);
+  Instruction *Mul = cast<Instruction>(Builder.CreateMul(IR.Add, IR.B));
+  TX.createdInstruction(Mul);
+  TX.replaceAllUsesWith(IR.Add, Mul);
+  EXPECT_EQ(Mul, IR.Ret->getReturnValue());
+
+  TX.rollback();
+  EXPECT_EQ(IR.Add, IR.Ret->getReturnValue());
+  // entry: add, ret -- the mul is gone.
+  EXPECT_EQ(2u, IR.BB->size());
+  EXPECT_TRUE(IR.Add->hasOneUse());
+}
+
+TEST(IRTransactionTest, RollbackDeleted) {
+  TransactionTestIR IR;
+  IRTransaction TX;
+
+  // Speculatively "fold" the add to its first operand.
+  TX.replaceAllUsesWith(IR.Add, IR.A);
+  TX.deleteInstruction(IR.Add);
+  EXPECT_EQ(1u, IR.BB->size());
+  EXPECT_EQ(IR.A, IR.Ret->getReturnValue());
+
+  TX.rollback();
+  EXPECT_EQ(2u, IR.BB->size());
+  EXPECT_EQ(IR.Add, &IR.BB->front());
+  EXPECT_EQ(IR.Add, IR.Ret->getReturnValue());
+}
+
+TEST(IRTransactionTest, CommitDeleted) {
+  TransactionTestIR IR;
+  IRTransaction TX;
+
+  TX.replaceAllUsesWith(IR.Add, IR.A);
+  TX.deleteInstruction(IR.Add);
+  TX.commit();
+  EXPECT_FALSE(TX.isOpen());
+  EXPECT_EQ(1u, IR.BB->size());
+  EXPECT_EQ(IR.A, IR.Ret->getReturnValue());
+}
+
+TEST(IRTransactionTest, RollbackOperandRewrite) {
+  TransactionTestIR IR;
+  IRTransaction TX;
+
+  TX.aboutToChange(IR.Add);
+  IR.Add->setOperand(0, IR.B);
+  IR.Add->setOperand(1, IR.A);
+  // Snapshot is only taken once; a second call must not capture the swap.
+  TX.aboutToChange(IR.Add);
+
+  TX.rollback();
+  EXPECT_EQ(IR.A, IR.Add->getOperand(0));
+  EXPECT_EQ(IR.B, IR.Add->getOperand(1));
+}
+
+TEST(IRTransactionTest, RollbackAdjacentDeletions) {
+  TransactionTestIR IR;
+  IRTransaction TX;
+
+  // Insert a second instruction between add and ret, then delete both in
+  // order; rollback has to restore add's position relative to an instruction
+  // that was itself deleted.
+  IRBuilder<> Builder(IR.Ret);
+  Instruction *Mul = cast<Instruction>(Builder.CreateMul(IR.A, IR.B, "prod"));
+
+  TX.replaceAllUsesWith(IR.Add, IR.A);
+  TX.deleteInstruction(IR.Add);
+  TX.deleteInstruction(Mul);
+  EXPECT_EQ(1u, IR.BB->size());
+
+  TX.rollback();
+  ASSERT_EQ(3u, IR.BB->size());
+  auto It = IR.BB->begin();
+  EXPECT_EQ(IR.Add, &*It++);
+  EXPECT_EQ(Mul, &*It++);
+  EXPECT_EQ(IR.Ret, &*It);
+  EXPECT_EQ(IR.Add, IR.Ret->getReturnValue());
+}
+
+} // end anonymous namespace